@@ -71,6 +71,7 @@ public:
 	virtual ~RGTextOutput ();
 
 	Boolean FileIsValid () const;
+	RGFile* GetFile () const { return file; }
 
 	static void SetResolution (int res) { Resolution = res; }
 	static int GetResolution () { return Resolution; }
@@ -46,12 +46,12 @@ int RGClient::ReplyBufferSize = 10240;
 
 
 RGServerPort :: RGServerPort () : OKToReadHandle (0), OKToWriteHandle (0), ContinuationHandle (0), ImTryingToContactYouHandle (0),
-ServerPidHandle (0), BufferHandle (0), HotLineHandle (0), LastError (RGOK), FirstTime (TRUE), Connected (FALSE), ClientId (0),
+ServerPidHandle (0), HotLineHandle (0), BufferHandle (0), LastError (RGOK), FirstTime (TRUE), Connected (FALSE), ClientId (0),
 Parent (NULL) {}
 
 
 RGServerPort :: RGServerPort (const RGString& name) : Name (name), OKToReadHandle (0), OKToWriteHandle (0), ContinuationHandle (0), 
-ImTryingToContactYouHandle (0), ServerPidHandle (0), BufferHandle (0), HotLineHandle (0), LastError (RGOK), 
+ImTryingToContactYouHandle (0), ServerPidHandle (0), HotLineHandle (0), BufferHandle (0), LastError (RGOK), 
 FirstTime (TRUE), Connected (FALSE), ClientId (0), Parent (NULL) {}
 
 
@@ -425,7 +425,7 @@ Boolean operator==(const RGServerPort& sp1, const RGServerPort& sp2) {
 }
 
 
-RGClient :: RGClient (const RGString& name) : NextServerId (1), Name (name), OKToReadHandle (0), OKToWriteHandle (0), 
+RGClient :: RGClient (const RGString& name) : Name (name), NextServerId (1), OKToReadHandle (0), OKToWriteHandle (0), 
 ContinuationHandle (0), BufferSize (0),	BufferHandle (0), LastError (RGOK), Initialized (FALSE) {
 
 	Initialize ();
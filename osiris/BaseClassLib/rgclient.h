@@ -28,7 +28,8 @@
 *
 */
 //
-//  Header file for client operations in high level IPC.  Uses shared memory and Windows Win32 Events to coordinate
+//  Header file for client operations in high level IPC.  Uses shared memory and Windows Win32 Events (or their POSIX
+// equivalents in rgipcposix.h) to coordinate
 // between client and server.  Implements Send/Receive/Reply paradigm for blocking/non-blocking control and message
 // passing.
 //
@@ -40,7 +41,11 @@
 #ifndef _RGCLIENT_H_
 #define _RGCLIENT_H_
 
+#ifdef _WINDOWS
 #include <windows.h>
+#else
+#include "rgipcposix.h"
+#endif
 
 #include "rgstring.h"
 #include "rgcommlist.h"
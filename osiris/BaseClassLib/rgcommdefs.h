@@ -53,7 +53,12 @@ enum RGReplyTypes { RGREPLY, RGREPLYWITHCONTINUATION, RGPROBLEM };
 
 const unsigned long RGSERVERPROBLEM = 100;
 
-#define DATAMAPOFFSET 24
+const unsigned long RGNEWCLIENTWAIT = 250;  // milliseconds TestReceive waits for a new client to write before checking on it
+
+//  Five unsigned long header words (size, type, length and two pid/id words) precede the data in each buffer:  24 bytes
+// where unsigned long is 4 bytes, as on Windows, and room for the wider header where it is 8 bytes
+
+#define DATAMAPOFFSET (6 * sizeof (unsigned long))
 
 
 #endif   /*  _RGCOMMDEFS_H_  */
@@ -121,6 +121,34 @@ Boolean RGFile :: Close()
 	}
 	return bRtn;
 }
+
+RGFile :: RGFile (FILE* file, const char* name, const char* mode) : FileName (NULL), FilePtr (file), Mode (NULL) {
+
+	FileName = new char [strlen (name) + 1];
+	strcpy (FileName, name);
+	Mode = new char [strlen (mode) + 1];
+	strcpy (Mode, mode);
+}
+
+
+Boolean RGFile :: Reopen (const char* name, const char* mode) {
+
+	if (FilePtr != NULL)
+		FilePtr = freopen (name, mode, FilePtr);
+
+	else
+		FilePtr = fopen (name, mode);
+
+	delete[] FileName;
+	delete[] Mode;
+	FileName = new char [strlen (name) + 1];
+	strcpy (FileName, name);
+	Mode = new char [strlen (mode) + 1];
+	strcpy (Mode, mode);
+	return FilePtr != NULL;
+}
+
+
 Boolean RGFile :: Exists() {
 
 	if (FilePtr) return TRUE;
@@ -57,6 +57,7 @@ public:
   long GetSizeOfFile () const;
 
 	virtual Boolean Close();
+	Boolean Reopen (const char* name, const char* mode);  // Redirects this object to another file, e.g., in a worker process
   Boolean Read (char& c);
   Boolean Read (short& i);
   Boolean Read (int& i);
@@ -116,6 +117,8 @@ public:
   Boolean good () {return (isValid () && !Error() && !Eof());}
 
 protected:
+  RGFile (FILE* file, const char* name, const char* mode);  // adopts an open stream, e.g., one that writes to memory
+
   char* FileName;
   FILE* FilePtr;
   char* Mode;
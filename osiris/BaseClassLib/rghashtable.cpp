@@ -40,6 +40,12 @@ int RGHashTable::RGDefaultNumberOfHashLists = 257;  // This is a prime number:
 
 PERSISTENT_DEFINITION (RGHashTable, _RGHASHTABLE_, "HashTable")
 
+//
+//  The lists of the table are created when the first item is added to them:  most tables (for example, the message data tables
+//  of every signal) stay empty or nearly so, and creating and deleting hundreds of empty lists per table was a large part of the
+//  cost of creating and deleting signals.  A NULL list is an empty list
+//
+
 
 RGHashTable :: RGHashTable () : RGPersistent (), NumberOfEntries (0), 
 NumberOfLists (RGHashTable::RGDefaultNumberOfHashLists) {
@@ -47,7 +53,7 @@ NumberOfLists (RGHashTable::RGDefaultNumberOfHashLists) {
 	ListArray = new RGDList* [NumberOfLists];
 
 	for (int i=0; i<NumberOfLists; i++)
-		ListArray [i] = new RGDList;
+		ListArray [i] = NULL;
 }
 
 RGHashTable :: RGHashTable (int nTables) : RGPersistent (), NumberOfEntries (0),
@@ -59,7 +65,7 @@ NumberOfLists (nTables) {
 	ListArray = new RGDList* [NumberOfLists];
 
 	for (int i=0; i<NumberOfLists; i++)
-		ListArray [i] = new RGDList;
+		ListArray [i] = NULL;
 }
 
 
@@ -72,8 +78,14 @@ NumberOfEntries (hTable.NumberOfEntries), NumberOfLists (hTable.NumberOfLists) {
 
 	ListArray = new RGDList* [NumberOfLists];
 
-	for (int i=0; i<NumberOfLists; i++)
-		ListArray [i] = new RGDList (*hTable.ListArray [i]);
+	for (int i=0; i<NumberOfLists; i++) {
+
+		if (hTable.ListArray [i] != NULL)
+			ListArray [i] = new RGDList (*hTable.ListArray [i]);
+
+		else
+			ListArray [i] = NULL;
+	}
 }
 
 
@@ -81,8 +93,11 @@ RGHashTable :: ~RGHashTable () {
 
 	for (int i=0; i<NumberOfLists; i++) {
 
-		ListArray [i]->ClearAndDelete ();
-		delete ListArray [i];
+		if (ListArray [i] != NULL) {
+
+			ListArray [i]->ClearAndDelete ();
+			delete ListArray [i];
+		}
 	}
 
 	delete[] ListArray;
@@ -92,9 +107,16 @@ RGHashTable :: ~RGHashTable () {
 size_t RGHashTable :: StoreSize () const {
 
 	size_t size = 0;
+	RGDList empty;
 
-	for (int i=0; i<NumberOfLists; i++)
-		size += ListArray [i]->StoreSize ();
+	for (int i=0; i<NumberOfLists; i++) {
+
+		if (ListArray [i] != NULL)
+			size += ListArray [i]->StoreSize ();
+
+		else
+			size += empty.StoreSize ();
+	}
 
 	size += 2 * sizeof (int);
 	return size;
@@ -155,7 +177,7 @@ void RGHashTable :: RestoreAll (RGFile& f) {
 				TempArray [i] = ListArray [i];
 
 			else
-				TempArray [i] = new RGDList;
+				TempArray [i] = NULL;
 		}
 
 		delete[] ListArray;
@@ -166,7 +188,7 @@ void RGHashTable :: RestoreAll (RGFile& f) {
 	f.Read (NumberOfEntries);
 
 	for (int i=0; i<NumberOfLists; i++)
-		ListArray [i]->RestoreAll (f);
+		GetList (i)->RestoreAll (f);
 
 }
 
@@ -207,7 +229,7 @@ void RGHashTable :: RestoreAll (RGVInStream& f) {
 				TempArray [i] = ListArray [i];
 
 			else
-				TempArray [i] = new RGDList;
+				TempArray [i] = NULL;
 		}
 
 		delete[] ListArray;
@@ -218,7 +240,7 @@ void RGHashTable :: RestoreAll (RGVInStream& f) {
 	f >> NumberOfEntries;
 
 	for (int i=0; i<NumberOfLists; i++)
-		ListArray [i]->RestoreAll (f);
+		GetList (i)->RestoreAll (f);
 }
 
 
@@ -227,9 +249,16 @@ void RGHashTable :: SaveAll (RGFile& f) const {
 	RGPersistent::SaveAll (f);
 	f.Write (NumberOfLists);
 	f.Write (NumberOfEntries);
+	RGDList empty;
 
-	for (int i=0; i<NumberOfLists; i++)
-		ListArray [i]->SaveAll (f);
+	for (int i=0; i<NumberOfLists; i++) {
+
+		if (ListArray [i] != NULL)
+			ListArray [i]->SaveAll (f);
+
+		else
+			empty.SaveAll (f);
+	}
 }
 
 
@@ -238,9 +267,16 @@ void RGHashTable :: SaveAll (RGVOutStream& f) const {
 	RGPersistent::SaveAll (f);
 	f << NumberOfLists;
 	f << NumberOfEntries;
+	RGDList empty;
 
-	for (int i=0; i<NumberOfLists; i++)
-		ListArray [i]->SaveAll (f);
+	for (int i=0; i<NumberOfLists; i++) {
+
+		if (ListArray [i] != NULL)
+			ListArray [i]->SaveAll (f);
+
+		else
+			empty.SaveAll (f);
+	}
 }
 
 
@@ -257,8 +293,11 @@ RGHashTable& RGHashTable :: operator=(const RGHashTable& hTable) {
 
 	for (int i=0; i<NumberOfLists; i++) {
 
-		ListArray [i]->ClearAndDelete ();
-		delete ListArray [i];
+		if (ListArray [i] != NULL) {
+
+			ListArray [i]->ClearAndDelete ();
+			delete ListArray [i];
+		}
 	}
 
 	delete[] ListArray;
@@ -268,8 +307,14 @@ RGHashTable& RGHashTable :: operator=(const RGHashTable& hTable) {
 
 	ListArray = new RGDList* [NumberOfLists];
 
-	for (int i=0; i<NumberOfLists; i++)
-		ListArray [i] = new RGDList (*hTable.ListArray [i]);
+	for (int i=0; i<NumberOfLists; i++) {
+
+		if (hTable.ListArray [i] != NULL)
+			ListArray [i] = new RGDList (*hTable.ListArray [i]);
+
+		else
+			ListArray [i] = NULL;
+	}
 
 	return *this;
 }
@@ -292,7 +337,7 @@ void RGHashTable :: ResizeTable (int size) {
 				NewArray [i] = ListArray [i];
 
 			else
-				NewArray [i] = new RGDList;
+				NewArray [i] = NULL;
 		}
 
 		delete[] ListArray;
@@ -300,7 +345,7 @@ void RGHashTable :: ResizeTable (int size) {
 
 		for (i=0; i<NumberOfLists; i++) {
 
-			if (ListArray [i]->Entries() > 0) {
+			if ((ListArray [i] != NULL) && (ListArray [i]->Entries() > 0)) {
 
 				RGDListIterator* it = new RGDListIterator (*ListArray [i]);
 
@@ -312,7 +357,7 @@ void RGHashTable :: ResizeTable (int size) {
 					if (index != i) {
 
 						it->RemoveCurrentItem ();
-						ListArray [index]->Insert (next);
+						GetList (index)->Insert (next);
 					}
 				}
 
@@ -327,12 +372,12 @@ void RGHashTable :: ResizeTable (int size) {
 
 		RGDList** NewArray = new RGDList* [size];
 
-		for (int i=0; i<NumberOfLists; i++) {
+		for (i=0; i<size; i++)
+			NewArray [i] = ListArray [i];
 
-			if (i < size)
-				NewArray [i] = ListArray [i];
+		for (i=0; i<NumberOfLists; i++) {
 
-			if (ListArray [i]->Entries() > 0) {
+			if ((ListArray [i] != NULL) && (ListArray [i]->Entries() > 0)) {
 
 				RGDListIterator* it = new RGDListIterator (*ListArray [i]);
 
@@ -344,7 +389,11 @@ void RGHashTable :: ResizeTable (int size) {
 					if (index != i) {
 
 						it->RemoveCurrentItem ();
-						ListArray [index]->Insert (next);
+
+						if (NewArray [index] == NULL)
+							NewArray [index] = new RGDList;
+
+						NewArray [index]->Insert (next);
 					}
 				}
 
@@ -372,7 +421,7 @@ void RGHashTable :: ResetDefaultSize (int size) {
 
 RGPersistent* RGHashTable :: Append (RGPersistent* p) {
 
-	RGDList* list = SelectList (p);
+	RGDList* list = SelectListForInsertion (p);
 	NumberOfEntries++;
 	return list->Append (p);
 }
@@ -381,7 +430,7 @@ RGPersistent* RGHashTable :: Append (RGPersistent* p) {
 
 RGPersistent* RGHashTable :: Prepend (RGPersistent* p) {
 
-	RGDList* list = SelectList (p);
+	RGDList* list = SelectListForInsertion (p);
 	NumberOfEntries++;
 	return list->Prepend (p);
 }
@@ -390,6 +439,10 @@ RGPersistent* RGHashTable :: Prepend (RGPersistent* p) {
 Boolean RGHashTable :: Contains (const RGPersistent* p) const {
 
 	RGDList* list = SelectList (p);
+
+	if (list == NULL)
+		return FALSE;
+
 	return list->Contains (p);
 }
 
@@ -397,6 +450,10 @@ Boolean RGHashTable :: Contains (const RGPersistent* p) const {
 RGPersistent* RGHashTable :: Remove (const RGPersistent* target) {
 
 	RGDList* list = SelectList (target);
+
+	if (list == NULL)
+		return NULL;
+
 	RGPersistent* q = list->Remove (target);
 
 	if (q != NULL)
@@ -409,14 +466,21 @@ RGPersistent* RGHashTable :: Remove (const RGPersistent* target) {
 RGPersistent* RGHashTable :: Find (const RGPersistent* target) const {
 
 	RGDList* list = SelectList (target);
+
+	if (list == NULL)
+		return NULL;
+
 	return list->Find (target);
 }
 
 
 int RGHashTable :: Clear () {
 
-	for (int i=0; i<NumberOfLists; i++)
-		ListArray[i]->Clear ();
+	for (int i=0; i<NumberOfLists; i++) {
+
+		if (ListArray[i] != NULL)
+			ListArray[i]->Clear ();
+	}
 
 	NumberOfEntries = 0;
 	return 0;
@@ -425,8 +489,11 @@ int RGHashTable :: Clear () {
 
 int RGHashTable :: ClearAndDelete () {
 
-	for (int i=0; i<NumberOfLists; i++)
-		ListArray[i]->ClearAndDelete ();
+	for (int i=0; i<NumberOfLists; i++) {
+
+		if (ListArray[i] != NULL)
+			ListArray[i]->ClearAndDelete ();
+	}
 
 	NumberOfEntries = 0;
 	return 0;
@@ -448,6 +515,10 @@ int RGHashTable :: Entries () const {
 int RGHashTable :: OccurrencesOf (const RGPersistent* p) const {
 
 	RGDList* list = SelectList (p);
+
+	if (list == NULL)
+		return 0;
+
 	return list->OccurrencesOf (p);
 }
 
@@ -455,7 +526,7 @@ int RGHashTable :: OccurrencesOf (const RGPersistent* p) const {
 
 RGPersistent* RGHashTable :: Insert (RGPersistent* p) {
 
-	RGDList* list = SelectList (p);
+	RGDList* list = SelectListForInsertion (p);
 	NumberOfEntries++;
 	return list->Insert (p);
 }
@@ -465,6 +536,10 @@ Boolean RGHashTable :: ContainsReference (const RGPersistent* p) const {
 	// contains pointer
 
 	RGDList* list = SelectList (p);
+
+	if (list == NULL)
+		return FALSE;
+
 	return list->ContainsReference (p);
 }
 
@@ -472,6 +547,10 @@ Boolean RGHashTable :: ContainsReference (const RGPersistent* p) const {
 RGPersistent* RGHashTable :: FindReference (const RGPersistent* p) {
 
 	RGDList* list = SelectList (p);
+
+	if (list == NULL)
+		return NULL;
+
 	return list->FindReference (p);
 }
 
@@ -479,6 +558,10 @@ RGPersistent* RGHashTable :: FindReference (const RGPersistent* p) {
 int RGHashTable :: OccurrencesOfReference (const RGPersistent* p) const {
 
 	RGDList* list = SelectList (p);
+
+	if (list == NULL)
+		return 0;
+
 	return list->OccurrencesOfReference (p);
 }
 
@@ -487,6 +570,10 @@ int RGHashTable :: OccurrencesOfReference (const RGPersistent* p) const {
 RGPersistent* RGHashTable :: RemoveReference (const RGPersistent* p) {
 
 	RGDList* list = SelectList (p);
+
+	if (list == NULL)
+		return NULL;
+
 	RGPersistent* q = list->RemoveReference (p);
 
 	if (q != NULL)
@@ -499,6 +586,10 @@ RGPersistent* RGHashTable :: RemoveReference (const RGPersistent* p) {
 RGPersistent* RGHashTable :: RemoveAllReferences (const RGPersistent* p) {
 
 	RGDList* list = SelectList (p);
+
+	if (list == NULL)
+		return NULL;
+
 	int NEntriesStart = list->Entries ();
 	int NEntriesEnd;
 	RGPersistent* q = list->RemoveAllReferences (p);
@@ -510,6 +601,8 @@ RGPersistent* RGHashTable :: RemoveAllReferences (const RGPersistent* p) {
 
 RGDList* RGHashTable :: SelectList (const RGPersistent* p) const {
 
+	// returns NULL if the list has not been created, i.e., it is empty
+
 	unsigned hash = p->HashNumber (NumberOfLists);
 
 	if (hash >= NumberOfLists)
@@ -519,16 +612,40 @@ RGDList* RGHashTable :: SelectList (const RGPersistent* p) const {
 }
 
 
+RGDList* RGHashTable :: SelectListForInsertion (const RGPersistent* p) {
+
+	unsigned hash = p->HashNumber (NumberOfLists);
+
+	if (hash >= NumberOfLists)
+		hash = hash%NumberOfLists;
+
+	return GetList (hash);
+}
+
+
+RGDList* RGHashTable :: GetList (int i) {
+
+	// creates list if needed
+
+	if (ListArray [i] == NULL)
+		ListArray [i] = new RGDList;
+
+	return ListArray [i];
+}
+
+
 
 RGHashTableIterator :: RGHashTableIterator (RGHashTable& ht) : List (&ht), CurrentListIndex (0), 
 NumberOfLists (ht.NumberOfLists) {
 
+	//  Iterators for lists are created when needed, so that lists created after this iterator are included
+
 	ListIteratorArray = new RGDListIterator* [NumberOfLists];
 
 	for (int i=0; i<NumberOfLists; i++)
-		ListIteratorArray [i] = new RGDListIterator (*List->ListArray [i]);
+		ListIteratorArray [i] = NULL;
 
-	CurrentIterator = ListIteratorArray [0];
+	CurrentIterator = GetListIterator (0);
 }
 
 
@@ -547,12 +664,20 @@ RGPersistent* RGHashTableIterator :: FindNext (const RGPersistent* target) {
 	if (hash < CurrentListIndex)
 		return NULL;
 
-	return ListIteratorArray [hash]->FindNext (target);
+	RGDListIterator* it = GetListIterator (hash);
+
+	if (it == NULL)
+		return NULL;
+
+	return it->FindNext (target);
 }
 
 
 RGPersistent* RGHashTableIterator :: CurrentItem () {
 
+	if (CurrentIterator == NULL)
+		return NULL;
+
 	return CurrentIterator->CurrentItem ();
 }
 
@@ -561,10 +686,18 @@ RGPersistent* RGHashTableIterator :: operator()() {
 	
 	// Advances iterator to next item and returns it; at tail, stays and returns NULL
 
-	RGPersistent* Next = (*CurrentIterator) ();
+	RGPersistent* Next;
+
+	if (CurrentIterator == NULL)
+		CurrentIterator = GetListIterator (CurrentListIndex);
+
+	if (CurrentIterator != NULL) {
 
-	if (Next)
-		return Next;
+		Next = (*CurrentIterator) ();
+
+		if (Next)
+			return Next;
+	}
 
 	if (CurrentListIndex == NumberOfLists - 1)
 		return NULL;
@@ -572,7 +705,11 @@ RGPersistent* RGHashTableIterator :: operator()() {
 	while (CurrentListIndex < NumberOfLists - 1) {
 
 		CurrentListIndex++;
-		CurrentIterator = ListIteratorArray [CurrentListIndex];
+		CurrentIterator = GetListIterator (CurrentListIndex);
+
+		if (CurrentIterator == NULL)
+			continue;
+
 		Next = (*CurrentIterator) ();
 
 		if (Next)
@@ -588,10 +725,18 @@ RGPersistent* RGHashTableIterator :: operator--() {
 	
 	// Goes back one and returns it; at head, returns NULL and Current goes to NULL
 
-	RGPersistent* Previous = --(*CurrentIterator);
+	RGPersistent* Previous;
 
-	if (Previous)
-		return Previous;
+	if (CurrentIterator == NULL)
+		CurrentIterator = GetListIterator (CurrentListIndex);
+
+	if (CurrentIterator != NULL) {
+
+		Previous = --(*CurrentIterator);
+
+		if (Previous)
+			return Previous;
+	}
 
 	if (CurrentListIndex == 0)
 		return NULL;
@@ -599,7 +744,11 @@ RGPersistent* RGHashTableIterator :: operator--() {
 	while (CurrentListIndex > 0) {
 
 		CurrentListIndex--;
-		CurrentIterator = ListIteratorArray [CurrentListIndex];
+		CurrentIterator = GetListIterator (CurrentListIndex);
+
+		if (CurrentIterator == NULL)
+			continue;
+
 		Previous = --(*CurrentIterator);
 
 		if (Previous)
@@ -614,10 +763,18 @@ RGPersistent* RGHashTableIterator :: operator++() {
 	
 	// Goes forward one and returns it; at tail, stays and returns NULL
 
-	RGPersistent* Next = ++(*CurrentIterator);
+	RGPersistent* Next;
+
+	if (CurrentIterator == NULL)
+		CurrentIterator = GetListIterator (CurrentListIndex);
+
+	if (CurrentIterator != NULL) {
 
-	if (Next)
-		return Next;
+		Next = ++(*CurrentIterator);
+
+		if (Next)
+			return Next;
+	}
 
 	if (CurrentListIndex == NumberOfLists - 1)
 		return NULL;
@@ -625,7 +782,11 @@ RGPersistent* RGHashTableIterator :: operator++() {
 	while (CurrentListIndex < NumberOfLists - 1) {
 
 		CurrentListIndex++;
-		CurrentIterator = ListIteratorArray [CurrentListIndex];
+		CurrentIterator = GetListIterator (CurrentListIndex);
+
+		if (CurrentIterator == NULL)
+			continue;
+
 		Next = ++(*CurrentIterator);
 
 		if (Next)
@@ -641,10 +802,14 @@ void RGHashTableIterator :: Reset () {
 	// Resets iterator to beginning - needed also whenever underlying list changes; Current set to NULL
 
 	CurrentListIndex = 0;
-	CurrentIterator = ListIteratorArray [0];
 
-	for (int i=0; i<NumberOfLists; i++)
-		ListIteratorArray [i]->Reset ();
+	for (int i=0; i<NumberOfLists; i++) {
+
+		if (ListIteratorArray [i] != NULL)
+			ListIteratorArray [i]->Reset ();
+	}
+
+	CurrentIterator = GetListIterator (0);
 }
 
 
@@ -658,12 +823,20 @@ RGPersistent* RGHashTableIterator :: FindNextReference (const RGPersistent* targ
 	if (hash < CurrentListIndex)
 		return NULL;
 
-	return ListIteratorArray [hash]->FindNextReference (target);
+	RGDListIterator* it = GetListIterator (hash);
+
+	if (it == NULL)
+		return NULL;
+
+	return it->FindNextReference (target);
 }
 
 
 RGPersistent* RGHashTableIterator :: RemoveCurrentItem () {
 
+	if (CurrentIterator == NULL)
+		return NULL;
+
 	RGPersistent* current = CurrentIterator->RemoveCurrentItem ();
 
 	if (current == NULL)
@@ -685,3 +858,20 @@ unsigned RGHashTableIterator :: FindHashNumber (const RGPersistent* target) {
 	return hash;
 }
 
+
+RGDListIterator* RGHashTableIterator :: GetListIterator (int i) {
+
+	// returns NULL if list i has not been created
+
+	if (ListIteratorArray [i] == NULL) {
+
+		RGDList* list = List->ListArray [i];
+
+		if (list == NULL)
+			return NULL;
+
+		ListIteratorArray [i] = new RGDListIterator (*list);
+	}
+
+	return ListIteratorArray [i];
+}
@@ -116,7 +116,9 @@ protected:
 	int NumberOfEntries;
 	unsigned long NumberOfLists;
 
-	RGDList* SelectList (const RGPersistent*) const;
+	RGDList* SelectList (const RGPersistent*) const;  // NULL if list not yet created
+	RGDList* SelectListForInsertion (const RGPersistent*);
+	RGDList* GetList (int i);  // creates list if needed
 
 	static int RGDefaultNumberOfHashLists;
 };
@@ -148,6 +150,7 @@ protected:
 	RGDListIterator* CurrentIterator;
 
 	unsigned FindHashNumber (const RGPersistent* p);
+	RGDListIterator* GetListIterator (int i);  // NULL if list not yet created
 };
 
 
@@ -0,0 +1,527 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: rgipcposix.cpp
+*
+*/
+//
+//  POSIX versions of the Win32 calls used by rgserver and rgclient (see rgipcposix.h)
+//
+
+#include "rgipcposix.h"
+
+#ifndef _WINDOWS
+
+#include <semaphore.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <ctype.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <string>
+#include <map>
+
+using namespace std;
+
+
+#ifdef __APPLE__
+const size_t RGIPCMaxNameLength = 30;	// shm_open and sem_open names are limited to 31 characters
+#else
+const size_t RGIPCMaxNameLength = 250;
+#endif
+
+const DWORD RGIPCWaitSlice = 20;	// milliseconds between checks on process handles, while waiting on a semaphore
+
+enum RGIPCObjectType { RGIPCMAPPING, RGIPCEVENT, RGIPCSEMAPHORE, RGIPCPROCESS };
+
+
+struct RGIPCObject {
+
+	RGIPCObjectType mType;
+	string mName;		// the POSIX name; empty for process handles
+	bool mOwner;		// created the name, so removes it on close
+	int mFile;			// shared memory descriptor, for mappings
+	sem_t* mSemaphore;	// for events and semaphores
+	pid_t mPid;			// for process handles
+
+	RGIPCObject (RGIPCObjectType type) : mType (type), mOwner (false), mFile (-1), mSemaphore (SEM_FAILED), mPid (0) {}
+};
+
+
+static map<const void*, size_t> RGIPCViews;	// address and length of mapped views, for UnmapViewOfFile
+static pthread_mutex_t RGIPCViewsMutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+static string RGIPCName (const char* name) {
+
+	//  Win32 object names are arbitrary; POSIX names must begin with '/', contain no other '/' and, on the Macintosh,
+	//  be short.  Long names keep their beginning and end with a hash of the whole name
+
+	string result ("/");
+	const char* p;
+
+	for (p=name; *p != '\0'; p++) {
+
+		if (isalnum ((unsigned char) *p) || (*p == '_') || (*p == '-') || (*p == '.'))
+			result += *p;
+
+		else
+			result += '_';
+	}
+
+	if (result.length () <= RGIPCMaxNameLength)
+		return result;
+
+	unsigned long long hash = 14695981039346656037ULL;
+
+	for (p=name; *p != '\0'; p++) {
+
+		hash ^= (unsigned char) *p;
+		hash *= 1099511628211ULL;
+	}
+
+	char hex [17];
+	int i;
+
+	for (i=15; i>=0; i--) {
+
+		hex [i] = "0123456789abcdef" [hash & 0xf];
+		hash >>= 4;
+	}
+
+	hex [16] = '\0';
+	size_t keep = RGIPCMaxNameLength - 16;
+	return result.substr (0, keep / 2) + hex + result.substr (result.length () - (keep - keep / 2));
+}
+
+
+static bool RGIPCProcessIsAlive (pid_t pid) {
+
+	return (kill (pid, 0) == 0) || (errno == EPERM);
+}
+
+
+static bool RGIPCTimedWait (sem_t* semaphore, DWORD milliseconds) {
+
+	//  Returns true if the semaphore was decremented within the time allowed
+
+	if (milliseconds == INFINITE) {
+
+		while (sem_wait (semaphore) < 0) {
+
+			if (errno != EINTR)
+				return false;
+		}
+
+		return true;
+	}
+
+#ifdef __APPLE__
+	//  No sem_timedwait:  poll every millisecond
+
+	struct timespec pause;
+	pause.tv_sec = 0;
+	pause.tv_nsec = 1000000;
+	DWORD waited = 0;
+
+	while (true) {
+
+		if (sem_trywait (semaphore) == 0)
+			return true;
+
+		if ((errno != EAGAIN) && (errno != EINTR))
+			return false;
+
+		if (waited >= milliseconds)
+			return false;
+
+		nanosleep (&pause, NULL);
+		waited++;
+	}
+#else
+	struct timespec deadline;
+	clock_gettime (CLOCK_REALTIME, &deadline);
+	deadline.tv_sec += milliseconds / 1000;
+	deadline.tv_nsec += (long) (milliseconds % 1000) * 1000000;
+
+	if (deadline.tv_nsec >= 1000000000) {
+
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000;
+	}
+
+	while (sem_timedwait (semaphore, &deadline) < 0) {
+
+		if (errno != EINTR)
+			return false;
+	}
+
+	return true;
+#endif
+}
+
+
+static DWORD RGIPCElapsed (const struct timeval& start) {
+
+	struct timeval now;
+	gettimeofday (&now, NULL);
+	return (DWORD) ((now.tv_sec - start.tv_sec) * 1000 + (now.tv_usec - start.tv_usec) / 1000);
+}
+
+
+static HANDLE RGIPCOpenSemaphore (RGIPCObjectType type, const char* name, bool create, unsigned int initialValue) {
+
+	//  Opens the named semaphore, creating it first if create is true and it does not yet exist
+
+	if (name == NULL)
+		return NULL;
+
+	RGIPCObject* object = new RGIPCObject (type);
+	object->mName = RGIPCName (name);
+
+	if (create) {
+
+		object->mSemaphore = sem_open (object->mName.c_str (), O_CREAT | O_EXCL, 0600, initialValue);
+		object->mOwner = (object->mSemaphore != SEM_FAILED);
+	}
+
+	if ((object->mSemaphore == SEM_FAILED) && (!create || (errno == EEXIST)))
+		object->mSemaphore = sem_open (object->mName.c_str (), 0);
+
+	if (object->mSemaphore == SEM_FAILED) {
+
+		delete object;
+		return NULL;
+	}
+
+	return (HANDLE) object;
+}
+
+
+HANDLE CreateFileMapping (HANDLE file, void* security, DWORD protect, DWORD sizeHigh, DWORD sizeLow, const char* name) {
+
+	//  As with Win32, if the name already exists, the existing mapping is opened and the size is ignored
+
+	if (name == NULL)
+		return NULL;
+
+	RGIPCObject* object = new RGIPCObject (RGIPCMAPPING);
+	object->mName = RGIPCName (name);
+	object->mFile = shm_open (object->mName.c_str (), O_RDWR | O_CREAT | O_EXCL, 0600);
+
+	if (object->mFile >= 0) {
+
+		object->mOwner = true;
+
+		if (ftruncate (object->mFile, (off_t) sizeLow) < 0) {
+
+			close (object->mFile);
+			shm_unlink (object->mName.c_str ());
+			delete object;
+			return NULL;
+		}
+	}
+
+	else if (errno == EEXIST)
+		object->mFile = shm_open (object->mName.c_str (), O_RDWR, 0600);
+
+	if (object->mFile < 0) {
+
+		delete object;
+		return NULL;
+	}
+
+	return (HANDLE) object;
+}
+
+
+void* MapViewOfFile (HANDLE mapping, DWORD access, DWORD offsetHigh, DWORD offsetLow, size_t bytes) {
+
+	RGIPCObject* object = (RGIPCObject*) mapping;
+
+	if ((object == NULL) || (object->mType != RGIPCMAPPING))
+		return NULL;
+
+	if (bytes == 0) {
+
+		struct stat info;
+
+		if (fstat (object->mFile, &info) < 0)
+			return NULL;
+
+		bytes = (size_t) info.st_size;
+	}
+
+	void* address = mmap (NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, object->mFile, (off_t) offsetLow);
+
+	if (address == MAP_FAILED)
+		return NULL;
+
+	pthread_mutex_lock (&RGIPCViewsMutex);
+	RGIPCViews [address] = bytes;
+	pthread_mutex_unlock (&RGIPCViewsMutex);
+	return address;
+}
+
+
+BOOL UnmapViewOfFile (const void* address) {
+
+	pthread_mutex_lock (&RGIPCViewsMutex);
+	map<const void*, size_t>::iterator it = RGIPCViews.find (address);
+
+	if (it == RGIPCViews.end ()) {
+
+		pthread_mutex_unlock (&RGIPCViewsMutex);
+		return 0;
+	}
+
+	size_t bytes = it->second;
+	RGIPCViews.erase (it);
+	pthread_mutex_unlock (&RGIPCViewsMutex);
+	return munmap ((void*) address, bytes) == 0;
+}
+
+
+HANDLE CreateEvent (void* security, BOOL manualReset, BOOL initialState, const char* name) {
+
+	return RGIPCOpenSemaphore (RGIPCEVENT, name, true, initialState ? 1 : 0);
+}
+
+
+HANDLE OpenEvent (DWORD access, BOOL inherit, const char* name) {
+
+	return RGIPCOpenSemaphore (RGIPCEVENT, name, false, 0);
+}
+
+
+BOOL SetEvent (HANDLE event) {
+
+	//  An event is signaled or not:  drain the semaphore before posting so that its count is at most 1
+
+	RGIPCObject* object = (RGIPCObject*) event;
+
+	if ((object == NULL) || (object->mType != RGIPCEVENT))
+		return 0;
+
+	while (sem_trywait (object->mSemaphore) == 0)
+		;
+
+	return sem_post (object->mSemaphore) == 0;
+}
+
+
+HANDLE CreateSemaphore (void* security, LONG initialCount, LONG maximumCount, const char* name) {
+
+	return RGIPCOpenSemaphore (RGIPCSEMAPHORE, name, true, (unsigned int) initialCount);
+}
+
+
+HANDLE OpenSemaphore (DWORD access, BOOL inherit, const char* name) {
+
+	return RGIPCOpenSemaphore (RGIPCSEMAPHORE, name, false, 0);
+}
+
+
+BOOL ReleaseSemaphore (HANDLE semaphore, LONG releaseCount, LONG* previousCount) {
+
+	RGIPCObject* object = (RGIPCObject*) semaphore;
+
+	if ((object == NULL) || (object->mType != RGIPCSEMAPHORE) || (releaseCount <= 0))
+		return 0;
+
+	if (previousCount != NULL)
+		*previousCount = 0;
+
+	LONG i;
+
+	for (i=0; i<releaseCount; i++) {
+
+		if (sem_post (object->mSemaphore) < 0)
+			return 0;
+	}
+
+	return 1;
+}
+
+
+HANDLE OpenProcess (DWORD access, BOOL inherit, DWORD pid) {
+
+	if ((pid == 0) || !RGIPCProcessIsAlive ((pid_t) pid))
+		return NULL;
+
+	RGIPCObject* object = new RGIPCObject (RGIPCPROCESS);
+	object->mPid = (pid_t) pid;
+	return (HANDLE) object;
+}
+
+
+DWORD GetCurrentProcessId () {
+
+	return (DWORD) getpid ();
+}
+
+
+BOOL CloseHandle (HANDLE handle) {
+
+	RGIPCObject* object = (RGIPCObject*) handle;
+
+	if ((object == NULL) || (handle == INVALID_HANDLE_VALUE))
+		return 0;
+
+	switch (object->mType) {
+
+		case RGIPCMAPPING:
+			close (object->mFile);
+
+			if (object->mOwner)
+				shm_unlink (object->mName.c_str ());
+
+			break;
+
+		case RGIPCEVENT:
+		case RGIPCSEMAPHORE:
+			sem_close (object->mSemaphore);
+
+			if (object->mOwner)
+				sem_unlink (object->mName.c_str ());
+
+			break;
+
+		default:
+			break;
+	}
+
+	delete object;
+	return 1;
+}
+
+
+DWORD WaitForSingleObject (HANDLE handle, DWORD milliseconds) {
+
+	return WaitForMultipleObjects (1, &handle, 0, milliseconds);
+}
+
+
+DWORD WaitForMultipleObjects (DWORD count, const HANDLE* handles, BOOL waitAll, DWORD milliseconds) {
+
+	//  Returns WAIT_OBJECT_0 + i for the first handle that is signaled:  a process that has ended, or an event or
+	//  semaphore that could be decremented.  Between checks, the first event or semaphore is waited on, for at most
+	//  RGIPCWaitSlice milliseconds if there are other handles to check
+
+	RGIPCObject* object;
+	RGIPCObject* first = NULL;
+	DWORD firstIndex = 0;
+	bool others = false;
+	DWORD i;
+	DWORD elapsed;
+	DWORD slice;
+	struct timeval start;
+
+	if ((count == 0) || waitAll)
+		return WAIT_FAILED;
+
+	for (i=0; i<count; i++) {
+
+		object = (RGIPCObject*) handles [i];
+
+		if (object == NULL)
+			continue;
+
+		if ((object->mType == RGIPCMAPPING) || (handles [i] == INVALID_HANDLE_VALUE))
+			return WAIT_FAILED;
+
+		if ((first == NULL) && (object->mType != RGIPCPROCESS)) {
+
+			first = object;
+			firstIndex = i;
+		}
+
+		else
+			others = true;
+	}
+
+	gettimeofday (&start, NULL);
+
+	while (true) {
+
+		for (i=0; i<count; i++) {
+
+			object = (RGIPCObject*) handles [i];
+
+			if (object == NULL)
+				continue;
+
+			if (object->mType == RGIPCPROCESS) {
+
+				if (!RGIPCProcessIsAlive (object->mPid))
+					return WAIT_OBJECT_0 + i;
+			}
+
+			else if (sem_trywait (object->mSemaphore) == 0)
+				return WAIT_OBJECT_0 + i;
+
+			else if ((errno != EAGAIN) && (errno != EINTR))
+				return WAIT_FAILED;
+		}
+
+		if (milliseconds == 0)
+			return WAIT_TIMEOUT;
+
+		slice = INFINITE;
+
+		if (milliseconds != INFINITE) {
+
+			elapsed = RGIPCElapsed (start);
+
+			if (elapsed >= milliseconds)
+				return WAIT_TIMEOUT;
+
+			slice = milliseconds - elapsed;
+		}
+
+		if (others && ((slice == INFINITE) || (slice > RGIPCWaitSlice)))
+			slice = RGIPCWaitSlice;
+
+		if (first == NULL) {
+
+			struct timespec pause;
+			pause.tv_sec = 0;
+			pause.tv_nsec = (long) slice * 1000000;
+			nanosleep (&pause, NULL);
+		}
+
+		else if (RGIPCTimedWait (first->mSemaphore, slice))
+			return WAIT_OBJECT_0 + firstIndex;
+	}
+
+	return WAIT_FAILED;
+}
+
+#endif  /*  _WINDOWS  */
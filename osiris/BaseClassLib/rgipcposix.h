@@ -0,0 +1,87 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: rgipcposix.h
+*
+*/
+//
+//  POSIX versions of the Win32 calls used by rgserver and rgclient, so that the Send/Receive/Reply IPC works the same
+// way on Linux and the Macintosh.  Named shared memory uses shm_open and mmap, events and semaphores use named POSIX
+// semaphores and process "handles" test the pid with kill (pid, 0).  Only what rgserver and rgclient need is supported:
+// events are always auto-reset and waits on several objects return the first one that is signaled.
+//
+//  The process that creates a named object removes its name (shm_unlink, sem_unlink) when it closes the handle; processes
+// that opened it keep using it until they close their own handles.
+//
+
+#ifndef _RGIPCPOSIX_H_
+#define _RGIPCPOSIX_H_
+
+#ifndef _WINDOWS
+
+#include <stddef.h>
+
+typedef void* HANDLE;
+typedef unsigned int DWORD;
+typedef int BOOL;
+typedef long LONG;
+
+#define INVALID_HANDLE_VALUE ((HANDLE) -1)	// no file:  the mapping is backed by shared memory only
+#define PAGE_READWRITE 0x04
+#define FILE_MAP_WRITE 0x0002
+#define FILE_MAP_ALL_ACCESS 0x000F001F
+#define EVENT_ALL_ACCESS 0x001F0003
+#define SEMAPHORE_ALL_ACCESS 0x001F0003
+#define SYNCHRONIZE 0x00100000
+
+#define INFINITE 0xFFFFFFFF
+#define WAIT_OBJECT_0 0
+#define WAIT_ABANDONED_0 0x00000080
+#define WAIT_TIMEOUT 0x00000102
+#define WAIT_FAILED 0xFFFFFFFF
+
+
+HANDLE CreateFileMapping (HANDLE file, void* security, DWORD protect, DWORD sizeHigh, DWORD sizeLow, const char* name);
+void* MapViewOfFile (HANDLE mapping, DWORD access, DWORD offsetHigh, DWORD offsetLow, size_t bytes);
+BOOL UnmapViewOfFile (const void* address);
+
+HANDLE CreateEvent (void* security, BOOL manualReset, BOOL initialState, const char* name);
+HANDLE OpenEvent (DWORD access, BOOL inherit, const char* name);
+BOOL SetEvent (HANDLE event);
+
+HANDLE CreateSemaphore (void* security, LONG initialCount, LONG maximumCount, const char* name);
+HANDLE OpenSemaphore (DWORD access, BOOL inherit, const char* name);
+BOOL ReleaseSemaphore (HANDLE semaphore, LONG releaseCount, LONG* previousCount);
+
+HANDLE OpenProcess (DWORD access, BOOL inherit, DWORD pid);
+DWORD GetCurrentProcessId ();
+
+BOOL CloseHandle (HANDLE handle);
+DWORD WaitForSingleObject (HANDLE handle, DWORD milliseconds);
+DWORD WaitForMultipleObjects (DWORD count, const HANDLE* handles, BOOL waitAll, DWORD milliseconds);
+
+#endif  /*  _WINDOWS  */
+
+#endif  /*  _RGIPCPOSIX_H_  */
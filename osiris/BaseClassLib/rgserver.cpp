@@ -382,7 +382,8 @@ Boolean operator==(const RGClientPort& sp1, const RGClientPort& sp2) {
 
 
 RGServer :: RGServer (const RGString& name) : Name (name), NextClientId (1), OKToReadHandle (0), OKToWriteHandle (0),
-ContinuationHandle (0), ImTryingToContactYouHandle (0), BufferHandle (0), LastError (RGOK), Initialized (FALSE), MyOwnPid (0) {
+ContinuationHandle (0), ImTryingToContactYouHandle (0), BufferHandle (0), LastError (RGOK), Initialized (FALSE), MyOwnPid (0),
+TestingReceive (FALSE) {
 
 	RegisterName ();
 }
@@ -519,7 +520,23 @@ int RGServer :: Receive (int clientId, unsigned char*& receiveBuffer, int& recei
 	if (clientId == 0) {
 
 		SetEvent (OKToWriteHandle);
-		WaitStatus = WaitForSingleObject (OKToReadHandle, INFINITE);
+
+		if (TestingReceive) {
+
+			//
+			// A client is trying to send.  If the write access is still there to take back, no client took it:  the client
+			// ended before it could send, so report that there is nothing to receive
+			//
+
+			while ((WaitStatus = WaitForSingleObject (OKToReadHandle, RGNEWCLIENTWAIT)) == WAIT_TIMEOUT) {
+
+				if (WaitForSingleObject (OKToWriteHandle, 0) == WAIT_OBJECT_0)
+					return 0;
+			}
+		}
+
+		else
+			WaitStatus = WaitForSingleObject (OKToReadHandle, INFINITE);
 
 		if (WaitStatus != WAIT_OBJECT_0) {
 
@@ -599,7 +616,7 @@ int RGServer :: Receive (int clientId, unsigned char*& receiveBuffer, int& recei
 		// Test for buffer overflow...we don't like to encourage this!
 		//
 
-		if (len > receiveLength) {
+		if (len > (unsigned long) receiveLength) {
 
 			delete[] receiveBuffer;
 			receiveBuffer = new unsigned char [len];
@@ -685,10 +702,11 @@ int RGServer :: Receive (int clientId, unsigned char*& receiveBuffer, int& recei
 		//
 
 		port->TriggerHotLine ();
-		WaitStatus = port->WaitForReadAccessFromClient (OKToReadHandle);
+		status = port->WaitForReadAccessFromClient (OKToReadHandle);
 
-		if (WaitStatus < 0) {
+		if (status < 0) {
 
+			LastError = port->GetLastError ();
 			RemoveClient (clientId);
 			return -1;
 		}
@@ -699,7 +717,7 @@ int RGServer :: Receive (int clientId, unsigned char*& receiveBuffer, int& recei
 		// Test for buffer overflow...we don't like to encourage this!
 		//
 
-		if (len > receiveLength) {
+		if (len > (unsigned long) receiveLength) {
 
 			delete[] receiveBuffer;
 			receiveBuffer = new unsigned char [len];
@@ -789,6 +807,19 @@ int RGServer :: TestReceive (int clientId, unsigned char*& receiveBuffer, int& r
 
 			port = ClientPortList.GetElementAt (i);
 
+			if (port == NULL)  // removed client
+				continue;
+
+			if (WaitForSingleObject (port->GetClientHandle (), 0) == WAIT_OBJECT_0) {
+
+				//
+				// client has ended, possibly while blocking on send to this process
+				//
+
+				RemoveClient (i);
+				continue;
+			}
+
 			//
 			// check to see if client is blocking on send to this process
 			//
@@ -800,16 +831,28 @@ int RGServer :: TestReceive (int clientId, unsigned char*& receiveBuffer, int& r
 			}
 		}
 
-		if (Found)  // at least one client is trying to send, so can safely receive from anyone, highest priority first
-			return Receive (0, receiveBuffer, receiveLength);
+		if (!Found) {
 
-		WaitStatus = WaitForSingleObject (ImTryingToContactYouHandle, 0);
+			WaitStatus = WaitForSingleObject (ImTryingToContactYouHandle, 0);
 
-		if (WaitStatus == WAIT_TIMEOUT)
-			return 0;
+			if (WaitStatus == WAIT_TIMEOUT)
+				return 0;
 
-		ReleaseSemaphore (ImTryingToContactYouHandle, 1, NULL);
-		return Receive (0, receiveBuffer, receiveLength);
+			ReleaseSemaphore (ImTryingToContactYouHandle, 1, NULL);
+		}
+
+		//
+		// at least one client is trying to send, so can safely receive from anyone, highest priority first
+		//
+
+		TestingReceive = TRUE;
+		int Id = Receive (0, receiveBuffer, receiveLength);
+		TestingReceive = FALSE;
+
+		if ((Id == 0) && !Found)
+			WaitForSingleObject (ImTryingToContactYouHandle, 0);  // new client ended before it could send:  clear its contact
+
+		return Id;
 	}
 
 	else {
@@ -28,7 +28,8 @@
 *
 */
 //
-//  Header file for server operations in high level IPC.  Uses shared memory and Windows Win32 Events to coordinate
+//  Header file for server operations in high level IPC.  Uses shared memory and Windows Win32 Events (or their POSIX
+// equivalents in rgipcposix.h) to coordinate
 // between client and server.  Implements Send/Receive/Reply paradigm for blocking/non-blocking control and message
 // passing.
 //
@@ -40,7 +41,11 @@
 #ifndef _RGSERVER_H_
 #define _RGSERVER_H_
 
+#ifdef _WINDOWS
 #include <windows.h>
+#else
+#include "rgipcposix.h"
+#endif
 
 #include "rgstring.h"
 #include "rgcommlist.h"
@@ -142,6 +147,7 @@ protected:
 	unsigned long RemotePortID;   // ????
 	Boolean Initialized;
 	unsigned long MyOwnPid;
+	Boolean TestingReceive;  // Receive called from TestReceive:  do not wait for a client that has ended
 
 	int WaitForReadAccess (HANDLE* HandleArray);
 	int RegisterName ();
@@ -0,0 +1,173 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE                          
+*               National Center for Biotechnology Information
+*                                                                          
+*  This software/database is a "United States Government Work" under the   
+*  terms of the United States Copyright Act.  It was written as part of    
+*  the author's official duties as a United States Government employee and 
+*  thus cannot be copyrighted.  This software/database is freely available 
+*  to the public for use. The National Library of Medicine and the U.S.    
+*  Government have not placed any restriction on its use or reproduction.  
+*                                                                          
+*  Although all reasonable efforts have been taken to ensure the accuracy  
+*  and reliability of the software and data, the NLM and the U.S.          
+*  Government do not and cannot warrant the performance or results that    
+*  may be obtained by using this software or data. The NLM and the U.S.    
+*  Government disclaim all warranties, express or implied, including       
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.                                                                
+*                                                                          
+*  Please cite the author in any work or product based on this material.   
+*
+* ===========================================================================
+*
+
+*  FileName: CAnalysisStatus.cpp
+*
+*/
+#include "CAnalysisStatus.h"
+#include <string.h>
+#include <wx/utils.h>
+#include "BaseClassLib/rgserver.h"
+#include "OsirisLib2.01/AnalysisStatusRecord.h"
+
+int CAnalysisStatus::g_nCount = 0;
+
+CAnalysisStatus::CAnalysisStatus() :
+  m_pServer(NULL),
+  m_pBuffer(NULL),
+  m_nBufferSize(0),
+  m_dProgress(0.0),
+  m_nProcessed(0),
+  m_nTotal(0),
+  m_nFailed(0),
+  m_bFinished(false)
+{
+  g_nCount++;
+  m_sName = wxString::Format(_T("OsirisStatus%lu_%d"),
+    (unsigned long) ::wxGetProcessId(), g_nCount);
+  RGString sName(m_sName.c_str());
+  m_pServer = new RGServer(sName);
+  if(!m_pServer->IsActive())
+  {
+    delete m_pServer;
+    m_pServer = NULL;
+  }
+  else
+  {
+    // the analysis sends at most 8192 bytes at a time,
+    //  RGServer::TestReceive() will enlarge the buffer if needed
+
+    m_nBufferSize = 16384;
+    m_pBuffer = new unsigned char[m_nBufferSize];
+    memset(m_pBuffer,0,m_nBufferSize);
+  }
+}
+
+CAnalysisStatus::~CAnalysisStatus()
+{
+  if(m_pServer != NULL)
+  {
+    delete m_pServer;
+  }
+  if(m_pBuffer != NULL)
+  {
+    delete [] m_pBuffer;
+  }
+}
+
+bool CAnalysisStatus::Poll()
+{
+  // receive what the analysis has sent, a limited number
+  //  of messages at a time so that the user interface is
+  //  not held up
+
+  const int MAX_MESSAGES = 64;
+  bool bRtn = false;
+  int nReply = 0;
+  int nClient;
+  for(int i = 0; (m_pServer != NULL) && (i < MAX_MESSAGES); i++)
+  {
+    nClient = m_pServer->TestReceive(0,m_pBuffer,m_nBufferSize);
+    if(nClient <= 0)
+    {
+      break;
+    }
+    _ProcessMessage((size_t)m_nBufferSize);
+    memset(m_pBuffer,0,m_nBufferSize);
+    m_pServer->Reply(nClient,(unsigned char *)&nReply,(int)sizeof(nReply));
+    bRtn = true;
+  }
+  return bRtn;
+}
+
+void CAnalysisStatus::_ProcessMessage(size_t nLen)
+{
+  // the message length is not passed along with the message, so
+  //  Poll() clears the buffer after each message and the records
+  //  end at the first record type of 0
+
+  size_t nPos = 0;
+  int nType;
+  int nBodyLen;
+  while(nPos + ANALYSISSTATUSHEADERLENGTH <= nLen)
+  {
+    memcpy((void *)&nType,m_pBuffer + nPos,sizeof(int));
+    memcpy((void *)&nBodyLen,m_pBuffer + nPos + sizeof(int),sizeof(int));
+    if( (nType < ANALYSISSTATUSPROGRESS) ||
+        (nType > ANALYSISSTATUSFINISHED) ||
+        (nBodyLen < 0) ||
+        (nPos + ANALYSISSTATUSHEADERLENGTH + nBodyLen > nLen) )
+    {
+      break;
+    }
+    _ProcessRecord(nType,
+      m_pBuffer + nPos + ANALYSISSTATUSHEADERLENGTH,nBodyLen);
+    nPos += ANALYSISSTATUSHEADERLENGTH + nBodyLen;
+  }
+}
+
+void CAnalysisStatus::_ProcessRecord(
+  int nType, const unsigned char *pBody, int nLen)
+{
+  int nFlags = 0;
+  switch(nType)
+  {
+  case ANALYSISSTATUSPROGRESS:
+    if(nLen >= (int)(sizeof(double) + 2 * sizeof(int)))
+    {
+      memcpy((void *)&m_dProgress,pBody,sizeof(double));
+      memcpy((void *)&m_nProcessed,pBody + sizeof(double),sizeof(int));
+      memcpy((void *)&m_nTotal,
+        pBody + sizeof(double) + sizeof(int),sizeof(int));
+    }
+    break;
+  case ANALYSISSTATUSSAMPLESTARTED:
+  case ANALYSISSTATUSSAMPLEFINISHED:
+    if(nLen >= (int)sizeof(int))
+    {
+      memcpy((void *)&nFlags,pBody,sizeof(int));
+      wxString sFile(
+        (const char *)(pBody + sizeof(int)),nLen - sizeof(int));
+      if(nType == ANALYSISSTATUSSAMPLESTARTED)
+      {
+        m_sCurrentSample = sFile;
+      }
+      else
+      {
+        if(!(nFlags & ANALYSISSTATUSSAMPLEOK))
+        {
+          m_nFailed++;
+        }
+        m_sCurrentSample.Empty();
+      }
+    }
+    break;
+  case ANALYSISSTATUSFINISHED:
+    m_bFinished = true;
+    m_sCurrentSample.Empty();
+    break;
+  }
+}
@@ -0,0 +1,101 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE                          
+*               National Center for Biotechnology Information
+*                                                                          
+*  This software/database is a "United States Government Work" under the   
+*  terms of the United States Copyright Act.  It was written as part of    
+*  the author's official duties as a United States Government employee and 
+*  thus cannot be copyrighted.  This software/database is freely available 
+*  to the public for use. The National Library of Medicine and the U.S.    
+*  Government have not placed any restriction on its use or reproduction.  
+*                                                                          
+*  Although all reasonable efforts have been taken to ensure the accuracy  
+*  and reliability of the software and data, the NLM and the U.S.          
+*  Government do not and cannot warrant the performance or results that    
+*  may be obtained by using this software or data. The NLM and the U.S.    
+*  Government disclaim all warranties, express or implied, including       
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.                                                                
+*                                                                          
+*  Please cite the author in any work or product based on this material.   
+*
+* ===========================================================================
+*
+
+*  FileName: CAnalysisStatus.h
+*
+*/
+#ifndef __C_ANALYSIS_STATUS_H__
+#define __C_ANALYSIS_STATUS_H__
+
+#include <wx/string.h>
+
+//  CAnalysisStatus receives the progress and per-sample status
+//  records sent by TestAnalysisDirectoryLC (see
+//  OsirisLib2.01/AnalysisStatus.h) through an RGServer.  The
+//  name of the server is passed to the analysis as "StatusServer"
+//  and the records are read by Poll() from the timer
+//  in CFrameRunAnalysis so that the analysis does not have
+//  to write its progress to stdout
+
+class RGServer;
+
+class CAnalysisStatus
+{
+public:
+  CAnalysisStatus();
+  virtual ~CAnalysisStatus();
+  bool IsOK()
+  {
+    return (m_pServer != NULL);
+  }
+  const wxString &GetName()
+  {
+    return m_sName;
+  }
+  bool Poll(); // true if any record was received
+  double GetProgress()
+  {
+    return m_dProgress;
+  }
+  int GetSamplesProcessed()
+  {
+    return m_nProcessed;
+  }
+  int GetSampleCount()
+  {
+    return m_nTotal;
+  }
+  int GetSamplesFailed()
+  {
+    return m_nFailed;
+  }
+  const wxString &GetCurrentSample()
+  {
+    return m_sCurrentSample;
+  }
+  bool IsFinished()
+  {
+    return m_bFinished;
+  }
+private:
+  void _ProcessMessage(size_t nLen);
+  void _ProcessRecord(int nType, const unsigned char *pBody, int nLen);
+
+  wxString m_sName;
+  wxString m_sCurrentSample;
+  RGServer *m_pServer;
+  unsigned char *m_pBuffer;
+  int m_nBufferSize;
+  double m_dProgress;
+  int m_nProcessed;
+  int m_nTotal;
+  int m_nFailed;
+  bool m_bFinished;
+
+  static int g_nCount;  // for unique server names
+};
+
+#endif
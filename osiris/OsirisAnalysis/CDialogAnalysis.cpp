@@ -37,6 +37,7 @@
 #include "nwx/nwxTabOrder.h"
 #include "nwx/nwxFileUtil.h"
 #include <wx/filename.h>
+#include <wx/thread.h>
 
 // temporary, need to update wxIDS.h
 
@@ -62,6 +63,8 @@ CDialogAnalysis::CDialogAnalysis(
     m_pSpinRFU_Interlocus(NULL),
     m_pSpinRFU_LadderInterlocus(NULL),
     m_pSpinRFU_SampleDetection(NULL),
+    m_pSpinBatchConcurrent(NULL),
+    m_pSpinBatchJobs(NULL),
 
     m_bSave(bSave),
     m_bUseLabSettings(bUseLabSettings),
@@ -264,6 +267,38 @@ CDialogAnalysis::CDialogAnalysis(
       wxDefaultSize);
     pSizerRadio->Add(m_pRadioAnalyzed,0,wxALIGN_CENTER_VERTICAL | wxALIGN_LEFT | wxLEFT,ID_BORDER);
 
+    // batch, directories analyzed at once (0 for one per processor)
+    //  and samples analyzed at once in each directory
+
+    int nCPU = wxThread::GetCPUCount();
+    if(nCPU < 1)
+    {
+      nCPU = 1;
+    }
+    wxBoxSizer *pSizerBatch = new wxBoxSizer(wxHORIZONTAL);
+    pSizerBatch->Add(
+      pwTemp = new wxStaticText(this,wxID_ANY,CParmOsiris::LABEL_BATCH_CONCURRENT),
+      0, wxALIGN_CENTER_VERTICAL | wxALIGN_LEFT);
+    m_pSpinBatchConcurrent = new wxSpinCtrl(this,wxID_ANY,
+      _T("1"), wxDefaultPosition,
+      sizeSpin,
+      wxSP_ARROW_KEYS,
+      0, nCPU, 1);
+    m_pSpinBatchConcurrent->SetToolTip(
+      _T("0 analyzes one directory for each processor"));
+    pSizerBatch->Add(m_pSpinBatchConcurrent, 0,
+      wxALIGN_CENTER_VERTICAL | wxALIGN_LEFT);
+    pSizerBatch->Add(
+      pwTemp = new wxStaticText(this,wxID_ANY,CParmOsiris::LABEL_BATCH_JOBS),
+      0, wxALIGN_CENTER_VERTICAL | wxALIGN_LEFT | wxLEFT, ID_BORDER);
+    m_pSpinBatchJobs = new wxSpinCtrl(this,wxID_ANY,
+      _T("1"), wxDefaultPosition,
+      sizeSpin,
+      wxSP_ARROW_KEYS,
+      1, nCPU, 1);
+    pSizerBatch->Add(m_pSpinBatchJobs, 0,
+      wxALIGN_CENTER_VERTICAL | wxALIGN_LEFT);
+
 
 
     wxBoxSizer *pSizerButtons = new wxBoxSizer(wxHORIZONTAL);
@@ -294,6 +329,8 @@ CDialogAnalysis::CDialogAnalysis(
     pGrid->Add(pGridRFU, 0, FLAG);
     pGrid->Add(MakeBoxSizerText(CParmOsiris::LABEL_DATA), 0, FLAG);
     pGrid->Add(pSizerRadio,0,FLAG);
+    pGrid->Add(MakeBoxSizerText(CParmOsiris::LABEL_BATCH), 0, FLAG);
+    pGrid->Add(pSizerBatch,0,FLAG);
 
     {
       nwxTabOrder tabOrder;
@@ -313,6 +350,8 @@ CDialogAnalysis::CDialogAnalysis(
       tabOrder.push_back(m_pSpinRFU_ILS);
       tabOrder.push_back(m_pRadioRaw);
       tabOrder.push_back(m_pRadioAnalyzed);
+      tabOrder.push_back(m_pSpinBatchConcurrent);
+      tabOrder.push_back(m_pSpinBatchJobs);
       tabOrder.push_back(pButtonOK);
       tabOrder.push_back(pButtonCancel);
     }
@@ -577,6 +616,8 @@ bool CDialogAnalysis::TransferDataToWindow()
     FIX_FILE_NAME(sDir);
     m_pTextOutput->SetValue(sDir);
     m_pCheckSubDir->SetValue(m_pParm->GetTimeStampSubDir());
+    m_pSpinBatchConcurrent->SetValue((int)m_pParm->GetBatchConcurrent());
+    m_pSpinBatchJobs->SetValue((int)m_pParm->GetBatchJobs());
     if(m_sVolumeName.IsEmpty())
     {
       m_sVolumeName = m_pParm->GetVolumeOrKit();
@@ -744,6 +785,8 @@ bool CDialogAnalysis::TransferDataFromWindow()
       m_pParm->SetSampleDetectionThreshold(m_nMinRFU_SampleDetection);
       m_pParm->SetAnalysisOverride(m_sOverride);
       m_pParm->SetTimeStampSubDir(m_pCheckSubDir->GetValue());
+      m_pParm->SetBatchConcurrent((unsigned int)m_pSpinBatchConcurrent->GetValue());
+      m_pParm->SetBatchJobs((unsigned int)m_pSpinBatchJobs->GetValue());
 
 
       if(!( m_bSave && m_pParm->IsModified() )) {}
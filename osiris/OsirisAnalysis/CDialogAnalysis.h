@@ -225,6 +225,8 @@ private:
   wxSpinCtrl *m_pSpinRFU_SampleDetection;
   wxRadioButton *m_pRadioRaw;
   wxRadioButton *m_pRadioAnalyzed;
+  wxSpinCtrl *m_pSpinBatchConcurrent;
+  wxSpinCtrl *m_pSpinBatchJobs;
 
   wxString m_sInputDirectory;
   wxString m_sOutputDirectory;
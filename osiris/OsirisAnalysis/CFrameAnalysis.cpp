@@ -1996,6 +1996,33 @@ bool CFrameAnalysis::_SaveOERFile(const wxString &sFileName)
   bool bRtn = m_pOARfile->SaveFile(sFileName);
   return bRtn;
 }
+bool CFrameAnalysis::_CompactFile()
+{
+  // if the file has an edit journal and all changes
+  // have been saved, rewrite the entire file
+  // and remove the journal
+
+  bool bRtn = true;
+  if( _XmlFile() &&
+      m_pOARfile->HasJournal() &&
+      m_pOARfile->CanSave() &&
+      !m_pOARfile->IsModified() )
+  {
+    {
+      wxBusyCursor xxx;
+      bRtn = m_pOARfile->CompactFile();
+      if(bRtn)
+      {
+        m_pParent->UpdateHistory(m_pOARfile);
+      }
+    }
+    if(!bRtn)
+    {
+      ShowFileSaveError(m_pOARfile->GetFileName());
+    }
+  }
+  return bRtn;
+}
 bool CFrameAnalysis::SaveFile()
 {
   bool bRtn = false;
@@ -2143,6 +2170,7 @@ void CFrameAnalysis::OnClose(wxCloseEvent &e)
   bool bDone = CheckSaveOnCloseFile();
   if(bDone)
   {
+    _CompactFile();
     Destroy();
   }
   else
@@ -2861,6 +2889,11 @@ void CFrameAnalysis::OnUserExport(wxCommandEvent &e)
       "Would you like to save the analysis file now?"));
     bOK = PromptSaveFileNow(sCONFIRM);
   }
+  if(bOK)
+  {
+    // the export reads the file, not the edit journal
+    bOK = _CompactFile();
+  }
 #define ALL_FILES "All Files (*.*)|*.*"
   if(bOK)
   {
@@ -187,6 +187,7 @@ private:
   wxString _GetGraphicFileName(int nRow = -1,bool bMessage = false);
   wxString _GetLocusFromColumn(int nCol = -1);
   bool _SaveOERFile(const wxString &sFileName);
+  bool _CompactFile();
   void _Build();
   bool _IsCellEdited(int nRow,int nCol);
   void _OnAcceptLocus();
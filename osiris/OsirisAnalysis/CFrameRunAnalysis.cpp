@@ -33,6 +33,8 @@
 #include <wx/tglbtn.h>
 #include <wx/utils.h>
 #include <wx/mstream.h>
+#include <wx/dir.h>
+#include <wx/thread.h>
 #include "nwx/nwxTabOrder.h"
 #include "nwx/nwxColorUtil.h"
 #include "nwx/nwxXmlMRU.h"
@@ -69,13 +71,12 @@ CFrameRunAnalysis::CFrameRunAnalysis(
   m_pLabelElapsed(NULL),
   m_pTextOutput(NULL),
   m_pButtonDetails(NULL),
-  m_pAnalysis(NULL),
   m_pSizer(NULL),
   m_pListDir(NULL),
+  m_nJobs(1),
 //  m_pDlgAnalysis(NULL),
   m_tStart(0),
-  m_bOK(false),
-  m_nNext(0)
+  m_bOK(false)
 {
   wxString sTitle = _T("Running Analysis");
   m_DirList.SetParmOsirisAndTraverse(m_parmOsiris,m_volume.GetDataFileType());
@@ -101,13 +102,12 @@ CFrameRunAnalysis::CFrameRunAnalysis(
   m_pLabelElapsed(NULL),
   m_pTextOutput(NULL),
   m_pButtonDetails(NULL),
-  m_pAnalysis(NULL),
   m_pSizer(NULL),
   m_pListDir(NULL),
+  m_nJobs(1),
 //  m_pDlgAnalysis(NULL),
   m_tStart(0),
-  m_bOK(false),
-  m_nNext(0)
+  m_bOK(false)
 {
   wxString sTitle = _T("Running Analysis");
   CDirList &DirListPrev(pPrev->m_DirList);
@@ -164,13 +164,12 @@ CFrameRunAnalysis::CFrameRunAnalysis(
   m_pLabelElapsed(NULL),
   m_pTextOutput(NULL),
   m_pButtonDetails(NULL),
-  m_pAnalysis(NULL),
   m_pSizer(NULL),
   m_pListDir(NULL),
+  m_nJobs(1),
 //  m_pDlgAnalysis(NULL),
   m_tStart(0),
-  m_bOK(false),
-  m_nNext(0)
+  m_bOK(false)
 {
   wxString sTitle;
   if(m_DirList.LoadFile(sFileName))
@@ -221,13 +220,12 @@ CFrameRunAnalysis::CFrameRunAnalysis(
   m_pLabelElapsed(NULL),
   m_pTextOutput(NULL),
   m_pButtonDetails(NULL),
-  m_pAnalysis(NULL),
   m_pSizer(NULL),
   m_pListDir(NULL),
+  m_nJobs(1),
 //  m_pDlgAnalysis(NULL),
   m_tStart(0),
-  m_bOK(false),
-  m_nNext(0)
+  m_bOK(false)
 {
   wxString sTitle;
   sTitle = _T("Running Analysis");
@@ -361,32 +359,27 @@ void CFrameRunAnalysis::UpdateOutputText()
   {
     wxString sValue;
     const wxString SPACER(_T("\n--------------------\n\n"));
-    long nCurrent = -1;
     long nCount = (long)m_DirList.GetCount();
     long nInsertionPoint = m_pTextOutput->GetInsertionPoint();
     long nSize = (long) m_pTextOutput->GetValue().Len();
-    long nStart = 0;
-    long nEnd = nCount;
     int nItemCount = m_pListDir->GetSelectedItemCount();
     bool bDoAll = (nCount == 1);
+    bool bCurrent = false;
 
-    if(m_pAnalysis != NULL)
+    if(!(bDoAll || nItemCount))
     {
-      nCurrent = m_pAnalysis->GetDirEntry()->GetIndex();
-      if(!nItemCount)
-      {
-        nStart = nCurrent;
-        nEnd = nCurrent + 1;
-        bDoAll = true;
-      }
+      // nothing is selected, show the directories being analyzed
+      nItemCount = (int)_AnalysisCount();
+      bCurrent = (nItemCount > 0);
     }
     size_t nAlloc = bDoAll ? 1 : nItemCount;
     nAlloc <<= 13;
     sValue.Alloc(nAlloc);
 
-    for(long i = nStart; i < nEnd; i++)
+    for(long i = 0; i < nCount; i++)
     {
-      if(bDoAll || m_pListDir->IsSelected(i))
+      if(bDoAll ||
+        (bCurrent ? (_FindAnalysis(i) != NULL) : m_pListDir->IsSelected(i)))
       {
         if(sValue.Len())
         {
@@ -510,95 +503,132 @@ void CFrameRunAnalysis::_RunAutoExport(CDirEntry *pEntry)
 }
 void CFrameRunAnalysis::OnTimer(wxTimerEvent &e)
 {
-  if(m_pAnalysis != NULL)
+  size_t nSlots = m_vpAnalysis.size();
+  size_t nSlot;
+  CProcessAnalysis *pAnalysis;
+  double dProgress = 0.0;
+  int nRunning = 0;
+  bool bEnded = false;
+  bool bOpenOne = false;
+  bool bUpdate = false;
+  bool bDetails = m_pButtonDetails->GetValue();
+  for(nSlot = 0; nSlot < nSlots; nSlot++)
   {
-    bool bMod =
-      m_pButtonDetails->GetValue() &&
-      m_pListDir->IsSelected(m_pAnalysis->GetDirEntry()->GetIndex())
-      ;
-    bool bData = bMod && m_pAnalysis->IsOutputModified();
-    if(m_pAnalysis->IsRunning())
+    pAnalysis = m_vpAnalysis.at(nSlot);
+    if(pAnalysis == NULL)
     {
-      m_volume.SetInUseOnTimer(e.GetInterval());
-      if(m_pAnalysis->ProcessIO(8192))
+      continue; // free slot
+    }
+    long ndx = pAnalysis->GetDirEntry()->GetIndex();
+    bool bMod = bDetails && m_pListDir->IsSelected(ndx);
+    bool bData = bMod && pAnalysis->IsOutputModified();
+    if(pAnalysis->IsRunning())
+    {
+      if(pAnalysis->ProcessIO(8192))
       {
         bData = true;
       }
-      wxString sValue;
-      time_t tElapsed;
-      time(&tElapsed);
-      long nSec = tElapsed - m_tStart;
-      long nHour = 0;
-      long nMin = 0;
-      if(nSec >= 60)
-      {
-        nMin = nSec / 60;
-        nSec %= 60;
-        if(nMin >= 60)
-        {
-          nHour = nMin / 60;
-          nMin %= 60;
-          sValue = wxString::Format(_T("%ld:%02ld:%02ld"),nHour, nMin, nSec);
-        }
-      }
-      if(!nHour)
-      {
-        sValue = wxString::Format(_T("%02ld:%02ld"),nMin,nSec);
-      }
-      m_pLabelElapsed->SetLabel(sValue);
-      int nProgress = (int)floor(m_pAnalysis->GetProgress() * 4.0 + 0.5);
-      m_pGauge->SetValue(nProgress);
+      pAnalysis->ProcessStatus();
+      dProgress += pAnalysis->GetProgress();
+      nRunning++;
+      m_pListDir->UpdateProgress(ndx,pAnalysis);
     }
     else
     {
-      for(int i = 0; m_pAnalysis->ProcessIO() && (i < 3); i++)
-      {
-        // processIO for up to three seconds
-        ::wxSleep(1);
-        bData = true;
-      }
-      CDirEntry *pEntry = m_pAnalysis->GetDirEntry();
-      long ndx = pEntry->GetIndex();
-      CDirEntryStatus nStatus =
-        m_pAnalysis->GetExitStatus()
-        ? DIRENTRY_ERROR
-        : DIRENTRY_DONE;
-      wxString sStatus;
-      bool bOpenOne = false;
-      if(pEntry->GetStatus() == DIRENTRY_RUNNING)
+      // process ended, _EndAnalysis() runs the auto export
+      // for this directory and frees the slot
+      if(_EndAnalysis(nSlot))
       {
-        // process ended and the user did NOT cancel;
-        pEntry->SetStatus(nStatus);
-        pEntry->SetStopTime();
-        bOpenOne = (nStatus == DIRENTRY_DONE);
-        if(bOpenOne)
-        {
-          _RunAutoExport(pEntry);
-        }
+        bOpenOne = true;
       }
-      m_pListDir->UpdateStatus((int) ndx);
-      Cleanup(); // deletes m_pAnalysis and sets it to NULL
-
-      auto_ptr<nwxMRUBatch> pBatch(NULL);
-      if(m_DirList.GetCount() == 1)
+      bEnded = true;
+      bData = true;
+    }
+    if(bMod && bData)
+    {
+      bUpdate = true;
+    }
+  }
+  if(nRunning)
+  {
+    m_volume.SetInUseOnTimer(e.GetInterval());
+    wxString sValue;
+    time_t tElapsed;
+    time(&tElapsed);
+    long nSec = tElapsed - m_tStart;
+    long nHour = 0;
+    long nMin = 0;
+    if(nSec >= 60)
+    {
+      nMin = nSec / 60;
+      nSec %= 60;
+      if(nMin >= 60)
       {
-        m_pGauge->SetValue(0);
-        if(bOpenOne)
-        {
-          auto_ptr<nwxMRUBatch> _pBatch(new nwxMRUBatch(mainApp::GetMRU()));
-          pBatch = _pBatch;  // destructor will be called after _Run()
-          // bOpenOne is true only if the user did not cancel
-          m_pParent->OpenFile(pEntry->GetOutputFile());
-        }
+        nHour = nMin / 60;
+        nMin %= 60;
+        sValue = wxString::Format(_T("%ld:%02ld:%02ld"),nHour, nMin, nSec);
       }
-      _Run();  // run next item or save results in .obr file
-      UpdateButtonState();
     }
-    if(bMod && bData)
+    if(!nHour)
     {
-      UpdateOutputText();
+      sValue = wxString::Format(_T("%02ld:%02ld"),nMin,nSec);
+    }
+    m_pLabelElapsed->SetLabel(sValue);
+    // average progress of the directories being analyzed
+    int nProgress = (int)floor(dProgress * 4.0 / nRunning + 0.5);
+    m_pGauge->SetValue(nProgress);
+  }
+  if(bEnded)
+  {
+    auto_ptr<nwxMRUBatch> pBatch(NULL);
+    if(bOpenOne)
+    {
+      // only one directory and the user did not cancel
+      auto_ptr<nwxMRUBatch> _pBatch(new nwxMRUBatch(mainApp::GetMRU()));
+      pBatch = _pBatch;  // destructor will be called after _Run()
+      m_pParent->OpenFile(m_DirList.At(0)->GetOutputFile());
+    }
+    _Run();  // run next items or save results in .obr file
+    UpdateButtonState();
+  }
+  if(bUpdate)
+  {
+    UpdateOutputText();
+  }
+}
+bool CFrameRunAnalysis::_EndAnalysis(size_t nSlot)
+{
+  CProcessAnalysis *pAnalysis = m_vpAnalysis.at(nSlot);
+  for(int i = 0; pAnalysis->ProcessIO() && (i < 3); i++)
+  {
+    // processIO for up to three seconds
+    ::wxSleep(1);
+  }
+  CDirEntry *pEntry = pAnalysis->GetDirEntry();
+  long ndx = pEntry->GetIndex();
+  CDirEntryStatus nStatus =
+    pAnalysis->GetExitStatus()
+    ? DIRENTRY_ERROR
+    : DIRENTRY_DONE;
+  bool bOpenOne = false;
+  if(pEntry->GetStatus() == DIRENTRY_RUNNING)
+  {
+    // process ended and the user did NOT cancel;
+    pEntry->SetStatus(nStatus);
+    pEntry->SetStopTime();
+    bOpenOne = (nStatus == DIRENTRY_DONE);
+    if(bOpenOne)
+    {
+      _RunAutoExport(pEntry);
     }
   }
+  m_pListDir->UpdateStatus((int) ndx);
+  Cleanup(nSlot); // deletes the analysis and sets the slot to NULL
+  if(m_DirList.GetCount() != 1)
+  {
+    bOpenOne = false;
+  }
+  return bOpenOne;
 }
 bool CFrameRunAnalysis::IsDone()
 {
@@ -619,7 +649,7 @@ bool CFrameRunAnalysis::IsDone()
 
 bool CFrameRunAnalysis::CheckIsDone()
 {
-  if(m_pAnalysis != NULL)
+  if(_AnalysisCount())
   {
     OnButtonCancelAll( *((wxCommandEvent *)NULL) );
   }
@@ -758,7 +788,8 @@ void CFrameRunAnalysis::OnButtonReAnalyze(wxCommandEvent &)
 }
 void CFrameRunAnalysis::Run()
 {
-  m_nNext = 0;
+  _SetupSlots();
+  _LoadInputSizes();
   time(&m_tStart);
   _Run();
 }
@@ -847,36 +878,66 @@ void CFrameRunAnalysis::OnButtonCancel(wxCommandEvent &)
 }
 void CFrameRunAnalysis::DoCancel(bool bCancelAll)
 {
-  if( (m_pAnalysis != NULL) && m_pAnalysis->IsRunning() )
+  size_t nSlots = m_vpAnalysis.size();
+  size_t nSlot;
+  CProcessAnalysis *pAnalysis;
+  bool bRunning = false;
+  for(nSlot = 0; nSlot < nSlots; nSlot++)
+  {
+    pAnalysis = m_vpAnalysis.at(nSlot);
+    if( (pAnalysis != NULL) && pAnalysis->IsRunning() )
+    {
+      bRunning = true;
+    }
+  }
+  if(bRunning)
   {
     bool bCancel = false;
     {
-      CProcessPause x(m_pAnalysis);
+      for(nSlot = 0; nSlot < nSlots; nSlot++)
+      {
+        pAnalysis = m_vpAnalysis.at(nSlot);
+        if(pAnalysis != NULL)
+        {
+          pAnalysis->Pause(true);
+        }
+      }
       wxString sMessage(_T("Do you want to cancel the analysis?"));
       wxMessageDialog d(
         this,sMessage,_T("Cancel"), wxYES | wxNO | wxICON_QUESTION);
       int n = d.ShowModal();
       bCancel = (n == wxID_YES || n == wxID_OK);
+      for(nSlot = 0; nSlot < nSlots; nSlot++)
+      {
+        pAnalysis = m_vpAnalysis.at(nSlot);
+        if(pAnalysis != NULL)
+        {
+          pAnalysis->Continue();
+        }
+      }
     }
     if(bCancel)
     {
       long nCount = (long) m_pListDir->GetItemCount();
       CDirEntry *pEntry;
-      if((m_pAnalysis != NULL) && m_pAnalysis->IsRunning())
+      for(nSlot = 0; nSlot < nSlots; nSlot++)
       {
-        pEntry = m_pAnalysis->GetDirEntry();
-        if(bCancelAll || m_pListDir->IsSelected(pEntry->GetIndex()))
+        pAnalysis = m_vpAnalysis.at(nSlot);
+        if((pAnalysis != NULL) && pAnalysis->IsRunning())
         {
-          m_pAnalysis->Cancel();
-          while(m_pAnalysis->IsRunning())
+          pEntry = pAnalysis->GetDirEntry();
+          if(bCancelAll || m_pListDir->IsSelected(pEntry->GetIndex()))
           {
-            m_pAnalysis->ProcessIO();
+            pAnalysis->Cancel();
+            while(pAnalysis->IsRunning())
+            {
+              pAnalysis->ProcessIO();
+            }
+            // the slot is freed in OnTimer()
+            pEntry->SetStatus(DIRENTRY_CANCELED);
+            pEntry->CleanupFiles();
+            m_pListDir->UpdateStatus((int)pEntry->GetIndex());
           }
-          // m_pAnalysis->Wait();
-//          Cleanup();
-          pEntry->SetStatus(DIRENTRY_CANCELED);
-          pEntry->CleanupFiles();
-          m_pListDir->UpdateStatus((int)pEntry->GetIndex());
         }
       }
       for(long i = 0; i < nCount; i++)
@@ -900,36 +961,15 @@ void CFrameRunAnalysis::DoCancel(bool bCancelAll)
 void CFrameRunAnalysis::_Run()
 {
   CDirEntry *pDirEntry;
-  if(m_pAnalysis != NULL) {;} // do nothing
-  else if( (pDirEntry = NextDirEntry()) != NULL )
+  size_t nSlot;
+  bool bBusy = (_AnalysisCount() > 0);
+  while( ((nSlot = _FreeSlot()) < m_vpAnalysis.size()) &&
+    ((pDirEntry = NextDirEntry()) != NULL) )
   {
-    wxString sOutputDir(pDirEntry->GetOutputDir());
-    bool bRunning = false;
-    pDirEntry->ClearStartStopTime();
-    if(wxFileName::Mkdir(sOutputDir,0755,wxPATH_MKDIR_FULL))
-    {
-      CParmOsiris parm(m_parmOsiris);
-      parm.SetInputDirectory(pDirEntry->GetInputDir());
-      parm.SetOutputDirectory(sOutputDir);
-      pDirEntry->SetParmOsiris(parm);
-      pDirEntry->SetStartTime();
-        m_pAnalysis = new CProcessAnalysis(pDirEntry,&m_volume,this,IDprocess);
-      bRunning = m_pAnalysis->IsRunning();
-      pDirEntry->SetStatus(
-        bRunning ? DIRENTRY_RUNNING : DIRENTRY_ERROR);
-      if(!bRunning)
-      {
-        pDirEntry->SetStopTime();
-      }
-    }
-    else
-    {
-      pDirEntry->SetStatus(DIRENTRY_ERROR);
-      pDirEntry->AppendRunOutput(_T("Cannot create output directory:\n  "));
-      pDirEntry->AppendRunOutput(sOutputDir);
-    }
-    m_pListDir->UpdateStatus(pDirEntry->GetIndex());
+    _StartAnalysis(pDirEntry,nSlot);
+    bBusy = true;
   }
+  if(bBusy) {;} // do nothing until an analysis ends
   else if(!m_DirList.GetCount())
   {
     // input directory selected with no input files
@@ -970,16 +1010,192 @@ void CFrameRunAnalysis::_Run()
   m_pGauge->SetValue(0);
 }
 
+void CFrameRunAnalysis::_StartAnalysis(CDirEntry *pDirEntry, size_t nSlot)
+{
+  wxString sOutputDir(pDirEntry->GetOutputDir());
+  bool bRunning = false;
+  pDirEntry->ClearStartStopTime();
+  if(wxFileName::Mkdir(sOutputDir,0755,wxPATH_MKDIR_FULL))
+  {
+    CParmOsiris parm(m_parmOsiris);
+    CProcessAnalysis *pAnalysis;
+    size_t nSlots = m_vpAnalysis.size();
+    int nFirstCPU = -1;
+    int nCPUCount = 0;
+    int nCPU = wxThread::GetCPUCount();
+    if(m_parmOsiris.GetBatchAffinity() && (nSlots > 1) && (nCPU > 0))
+    {
+      // give each slot its own share of the processors,
+      // _SetupSlots() keeps the slots within the processor count
+      int nSlotCount = (int)nSlots;
+      int n = (int)nSlot;
+      nFirstCPU = n * nCPU / nSlotCount;
+      nCPUCount = ((n + 1) * nCPU / nSlotCount) - nFirstCPU;
+    }
+    parm.SetInputDirectory(pDirEntry->GetInputDir());
+    parm.SetOutputDirectory(sOutputDir);
+    parm.SetBatchJobs((unsigned int)m_nJobs);
+    pDirEntry->SetParmOsiris(parm);
+    pDirEntry->SetStartTime();
+    pAnalysis = new CProcessAnalysis(
+      pDirEntry,&m_volume,this,IDprocess,nFirstCPU,nCPUCount);
+    m_vpAnalysis.at(nSlot) = pAnalysis;
+    bRunning = pAnalysis->IsRunning();
+    pDirEntry->SetStatus(
+      bRunning ? DIRENTRY_RUNNING : DIRENTRY_ERROR);
+    if(!bRunning)
+    {
+      pDirEntry->SetStopTime();
+    }
+  }
+  else
+  {
+    pDirEntry->SetStatus(DIRENTRY_ERROR);
+    pDirEntry->AppendRunOutput(_T("Cannot create output directory:\n  "));
+    pDirEntry->AppendRunOutput(sOutputDir);
+  }
+  m_pListDir->UpdateStatus(pDirEntry->GetIndex());
+}
+
+void CFrameRunAnalysis::_SetupSlots()
+{
+  // number of directories analyzed at once, 0 is one for each
+  // processor, and number of samples analyzed at once in each
+  // directory.  Together they are kept within the processor count
+  if(!_AnalysisCount())
+  {
+    int nCPU = wxThread::GetCPUCount();
+    int n = (int)m_parmOsiris.GetBatchConcurrent();
+    int nJobs = (int)m_parmOsiris.GetBatchJobs();
+    if(nJobs < 1)
+    {
+      nJobs = 1;
+    }
+    if(nCPU > 0)
+    {
+      if(nJobs > nCPU)
+      {
+        nJobs = nCPU;
+      }
+      if((n < 1) || (n * nJobs > nCPU))
+      {
+        n = nCPU / nJobs;
+      }
+    }
+    if(n < 1)
+    {
+      n = 1;
+    }
+    m_nJobs = nJobs;
+    m_vpAnalysis.resize((size_t)n,(CProcessAnalysis *)NULL);
+  }
+}
+size_t CFrameRunAnalysis::_FreeSlot()
+{
+  size_t nSlots = m_vpAnalysis.size();
+  size_t nRtn;
+  for(nRtn = 0; nRtn < nSlots; nRtn++)
+  {
+    if(m_vpAnalysis.at(nRtn) == NULL)
+    {
+      break;
+    }
+  }
+  return nRtn;
+}
+size_t CFrameRunAnalysis::_AnalysisCount()
+{
+  vector<CProcessAnalysis *>::iterator itr;
+  size_t nRtn = 0;
+  for(itr = m_vpAnalysis.begin(); itr != m_vpAnalysis.end(); ++itr)
+  {
+    if((*itr) != NULL)
+    {
+      nRtn++;
+    }
+  }
+  return nRtn;
+}
+CProcessAnalysis *CFrameRunAnalysis::_FindAnalysis(long ndx)
+{
+  vector<CProcessAnalysis *>::iterator itr;
+  CProcessAnalysis *pRtn(NULL);
+  for(itr = m_vpAnalysis.begin();
+    (pRtn == NULL) && (itr != m_vpAnalysis.end());
+    ++itr)
+  {
+    if( ((*itr) != NULL) && ((*itr)->GetDirEntry()->GetIndex() == ndx) )
+    {
+      pRtn = *itr;
+    }
+  }
+  return pRtn;
+}
+void CFrameRunAnalysis::_LoadInputSizes()
+{
+  // the size of each input directory is found once, when the
+  // list is first run with more than one slot, and kept for
+  // reanalysis, so that filling a slot does not read directories
+  size_t nCount = m_DirList.GetCount();
+  if( (m_vpAnalysis.size() > 1) && (m_adInputSize.size() != nCount) )
+  {
+    wxBusyCursor xxx;
+    wxArrayString asFiles;
+    wxULongLong nSize;
+    size_t nFiles;
+    size_t i;
+    size_t j;
+    m_adInputSize.clear();
+    m_adInputSize.reserve(nCount);
+    for(i = 0; i < nCount; i++)
+    {
+      CDirEntry *pEntry = m_DirList.At(i);
+      double dSize = 0.0;
+      asFiles.Empty();
+      nFiles = pEntry->InputDirExists()
+        ? wxDir::GetAllFiles(
+            pEntry->GetInputDir(),&asFiles,wxEmptyString,wxDIR_FILES)
+        : 0;
+      for(j = 0; j < nFiles; j++)
+      {
+        nSize = wxFileName::GetSize(asFiles.Item(j));
+        if(nSize != wxInvalidSize)
+        {
+          dSize += nSize.ToDouble();
+        }
+      }
+      m_adInputSize.push_back(dSize);
+    }
+  }
+}
+double CFrameRunAnalysis::_GetInputSize(size_t ndx)
+{
+  return (ndx < m_adInputSize.size()) ? m_adInputSize.at(ndx) : 0.0;
+}
+
 CDirEntry *CFrameRunAnalysis::NextDirEntry()
 {
+  // when analyzing one directory at a time, use the order of the list,
+  // otherwise start the largest pending directory first so the last
+  // ones to finish are small and the batch ends sooner
   CDirEntry *pRtn(NULL);
+  CDirEntry *p;
   size_t nCount = m_DirList.GetCount();
-  while( (pRtn == NULL) && (m_nNext < nCount) )
+  bool bLargest = (m_vpAnalysis.size() > 1);
+  double dMax = -1.0;
+  double dSize;
+  for(size_t i = 0; i < nCount; i++)
   {
-    CDirEntry *p = m_DirList.At(m_nNext);
-    m_nNext++;
-    if(p->GetStatus() == DIRENTRY_PENDING)
+    p = m_DirList.At(i);
+    if(p->GetStatus() != DIRENTRY_PENDING) {;}
+    else if(!bLargest)
+    {
+      pRtn = p;
+      i = nCount; // done
+    }
+    else if( (dSize = _GetInputSize(i)) > dMax )
     {
+      dMax = dSize;
       pRtn = p;
     }
   }
@@ -987,11 +1203,20 @@ CDirEntry *CFrameRunAnalysis::NextDirEntry()
 }
 void CFrameRunAnalysis::Cleanup()
 {
-  if(m_pAnalysis != NULL)
+  size_t nSlots = m_vpAnalysis.size();
+  for(size_t nSlot = 0; nSlot < nSlots; nSlot++)
+  {
+    Cleanup(nSlot);
+  }
+}
+void CFrameRunAnalysis::Cleanup(size_t nSlot)
+{
+  CProcessAnalysis *pAnalysis = m_vpAnalysis.at(nSlot);
+  if(pAnalysis != NULL)
   {
-//    m_pAnalysis->Wait();
-    delete m_pAnalysis;
-    m_pAnalysis = NULL;
+//    pAnalysis->Wait();
+    delete pAnalysis;
+    m_vpAnalysis.at(nSlot) = NULL;
   }
 }
 void CFrameRunAnalysis::UpdateButtonState()
@@ -1051,9 +1276,14 @@ void CFrameRunAnalysis::UpdateButtonState()
 
 void CFrameRunAnalysis::OnEndProcess(wxProcessEvent &e)
 {
-  if(m_pAnalysis != NULL)
+  vector<CProcessAnalysis *>::iterator itr;
+  for(itr = m_vpAnalysis.begin(); itr != m_vpAnalysis.end(); ++itr)
   {
-    m_pAnalysis->OnTerminate(e.GetPid(),e.GetExitCode());
+    if((*itr) != NULL)
+    {
+      // OnTerminate() ignores the event if the PID is not its own
+      (*itr)->OnTerminate(e.GetPid(),e.GetExitCode());
+    }
   }
   e.Skip(true);
 }
@@ -100,8 +100,17 @@ private:
   void _RunAutoExport(CDirEntry *pEntry);
   void _BuildWindow(const wxString &sTitle, const wxSize &sz);
   void _Run();
+  void _StartAnalysis(CDirEntry *pDirEntry, size_t nSlot);
+  bool _EndAnalysis(size_t nSlot);
+  void _SetupSlots();
+  size_t _FreeSlot();
+  size_t _AnalysisCount();
+  CProcessAnalysis *_FindAnalysis(long ndx);
+  void _LoadInputSizes();
+  double _GetInputSize(size_t ndx);
   void DoCancel(bool bCancelAll);
   void Cleanup();
+  void Cleanup(size_t nSlot);
   CDirEntry *NextDirEntry();
   void UpdateOutputText();
   void UpdateButtonState();
@@ -121,13 +130,14 @@ private:
   wxStaticText *m_pLabelElapsed;
   wxTextCtrl *m_pTextOutput;
   wxToggleButton *m_pButtonDetails;
-  CProcessAnalysis *m_pAnalysis;
+  vector<CProcessAnalysis *> m_vpAnalysis; // one per slot, NULL if free
+  vector<double> m_adInputSize; // bytes in each input dir, see _LoadInputSizes()
   wxBoxSizer *m_pSizer;
   CListProcess *m_pListDir;
+  int m_nJobs; // samples analyzed at once in each directory
 //  CDialogAnalysis *m_pDlgAnalysis;
   time_t m_tStart;
   bool m_bOK;
-  size_t m_nNext;
   DECLARE_EVENT_TABLE();
 };
 #endif
@@ -30,6 +30,7 @@
 */
 #include "mainApp.h"
 #include "CListProcess.h"
+#include "CProcessAnalysis.h"
 #include <wx/imaglist.h>
 #include <wx/icon.h>
 
@@ -140,6 +141,46 @@ void CListProcess::SelectOne(long ndx)
     Select(i,i == ndx);
   }
 }
+void CListProcess::UpdateProgress(
+  long nItem, CProcessAnalysis *pAnalysis)
+{
+  // show the percent complete of a running analysis with its status
+  //  and, if known, the number of files analyzed and failed
+  //  and the file being analyzed
+  CDirEntry *pDirEntry = m_pDirList->At((size_t)nItem);
+  if(pDirEntry->GetStatus() == DIRENTRY_RUNNING)
+  {
+    wxString sStatus(pDirEntry->GetStatusString());
+    int nTotal = pAnalysis->GetSampleCount();
+    if(pAnalysis->IsFinished())
+    {
+      sStatus.Append(_T(" 100%, finishing"));
+    }
+    else
+    {
+      sStatus.Append(wxString::Format(_T(" %d%%"),
+        (int)(pAnalysis->GetProgress() + 0.5)));
+    }
+    if(nTotal > 0)
+    {
+      int nFailed = pAnalysis->GetSamplesFailed();
+      sStatus.Append(wxString::Format(_T(" (%d/%d"),
+        pAnalysis->GetSamplesProcessed(),nTotal));
+      if(nFailed > 0)
+      {
+        sStatus.Append(wxString::Format(_T(", %d failed"),nFailed));
+      }
+      sStatus.Append(_T(")"));
+    }
+    wxString sSample(pAnalysis->GetCurrentSample());
+    if(!sSample.IsEmpty())
+    {
+      sStatus.Append(_T(" "));
+      sStatus.Append(sSample);
+    }
+    SetItem(nItem,ITEM_STATUS,sStatus);
+  }
+}
 void CListProcess::UpdateStatus(int nItem)
 {
   wxString sTime;
@@ -34,6 +34,8 @@
 #include <wx/listctrl.h>
 #include "CDirList.h"
 
+class CProcessAnalysis;
+
 class CListProcess : public wxListCtrl
 {
 public:
@@ -45,6 +47,7 @@ public:
   virtual ~CListProcess();
   virtual bool TransferDataToWindow();
   void UpdateStatus(int nItem = -1);
+  void UpdateProgress(long nItem, CProcessAnalysis *pAnalysis);
   void GetInfo(wxListItem &itm, long ndx = 0)
   {
     itm.SetStateMask(-1);
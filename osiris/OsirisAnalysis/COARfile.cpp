@@ -1204,10 +1204,16 @@ bool COARfile::LoadFile(const wxString &sFileName)
   _ClearMessageBook();
   bool bRtn = nwxXmlPersist::LoadFile(sFileName);
   m_bModified = false;
+  m_journal.Clear();
   if(bRtn)
   {
     m_sFileName = sFileName;
+    _JournalReplay();
     _PostProcessFile();
+    if(CanSave())
+    {
+      _JournalBaseline();
+    }
 //    _UpdateFileVersion(); // if this is an old version, then update
     //  nevermind
 
@@ -1362,23 +1368,387 @@ void COARfile::UpdateVersion()
   SetIsModified();
 }
 
+static time_t TimeDiff(const wxDateTime &dt1, const wxDateTime &dt2)
+{
+  time_t t1 = dt1.GetTicks();
+  time_t t2 = dt2.GetTicks();
+  time_t nDiff = (t1 > t2) ? (t1 - t2) : (t2 - t1);
+  return nDiff;
+}
+
 bool COARfile::IsTampered(unsigned int nSeconds) const
 {
   bool bRtn = m_heading.IsTampered();
-  if(!bRtn)
+  if(!bRtn && m_journal.IsUsed())
+  {
+    // the save history includes the edit journal,
+    // check the time of the last full save against
+    // the file and the last journal entry against
+    // the journal file
+
+    bRtn =
+      (TimeDiff(m_journal.GetBase(),GetFileModTime()) > (time_t)nSeconds) ||
+      (TimeDiff(m_journal.GetLast(),m_journal.GetFileModTime()) > (time_t)nSeconds);
+  }
+  else if(!bRtn)
+  {
+    bRtn = (TimeDiff(GetXMLmodTime(),GetFileModTime()) > (time_t)nSeconds);
+  }
+  if(bRtn)
   {
-    time_t t1 = GetXMLmodTime().GetTicks();
-    time_t t2 = GetFileModTime().GetTicks();
-    time_t nDiff = (t1 > t2) ? (t1 - t2) : (t2 - t1);
-    bRtn = (nDiff > (time_t)nSeconds);
+    m_heading.SetTampered(true);
+  }
+  return bRtn;
+}
+
+bool COARfile::CheckFileModification(bool bReload)
+{
+  bool bRtn = nwxXmlPersist::CheckFileModification(false);
+  if( (!bRtn) && (m_dtFileModTime.GetTicks() > 0) )
+  {
+    // check if the edit journal was written, created, or
+    // removed by another program
+
+    wxDateTime dt = COARjournal::GetJournalModTime(GetLastFileName());
+    bRtn = (dt != m_journal.GetFileModTime());
+  }
+  if(bRtn && bReload)
+  {
+    bRtn = ReloadFile();
+  }
+  return bRtn;
+}
+
+//********************************************** edit journal
+
+nwxXmlPersist *COARfile::_GetJournalDirectory(
+  size_t n, wxString *psNodeName)
+{
+  // directory level items saved in the edit journal,
+  // node names are from COARfile::RegisterAll()
+
+  nwxXmlPersist *pRtn = NULL;
+  switch(n)
+  {
+  case 0:
+    *psNodeName = _T("DirectoryAlerts");
+    pRtn = &m_DirAlerts;
+    break;
+  case 1:
+    *psNodeName = _T("DirectoryNotes");
+    pRtn = &m_notes;
+    break;
+  case 2:
+    *psNodeName = _T("OldDirectoryNotes");
+    pRtn = &m_pvOldNotes;
+    break;
+  case 3:
+    *psNodeName = _T("DirectoryReviews");
+    pRtn = &m_DirReviews;
+    break;
+  case 4:
+    *psNodeName = _T("DirectoryAcceptance");
+    pRtn = &m_DirAcceptance;
+    break;
+  }
+  return pRtn;
+}
+
+wxXmlNode *COARfile::_JournalItem(
+  nwxXmlPersist *pItem,
+  const wxString &sNodeName,
+  const wxString &sKey,
+  map<wxString,wxUint64> *pmapHash,
+  wxXmlNode *pEntry)
+{
+  // compute the hash of one item, if pEntry is not NULL
+  // and the item has changed, append it to pEntry
+
+  auto_ptr<nwxXmlNodeList> apList(pItem->CreateNodeList(sNodeName));
+  wxXmlNode *pNode;
+  wxXmlNode *pRtn = NULL;
+  if(apList->empty())
+  {
+    // empty item, write an empty node so that
+    // the item is cleared when the journal is loaded
+    pNode = new wxXmlNode(wxXML_ELEMENT_NODE,sNodeName);
+  }
+  else
+  {
+    pNode = apList->at(0);
+    for(size_t i = apList->size() - 1; i > 0; --i)
+    {
+      delete apList->at(i);
+    }
+  }
+  wxUint64 nHash = COARjournal::Hash(pNode);
+  if( (pEntry != NULL) && m_journal.IsChanged(sKey,nHash) )
+  {
+    pEntry->AddChild(pNode);
+    pRtn = pNode;
+  }
+  else
+  {
+    delete pNode;
+  }
+  (*pmapHash)[sKey] = nHash;
+  return pRtn;
+}
+
+size_t COARfile::_JournalScan(
+  map<wxString,wxUint64> *pmapHash, wxXmlNode *pEntry)
+{
+  // compute the hash of each sample, message, and directory
+  // level item.  If pEntry is not NULL, append the items that
+  // changed since the file was loaded or saved and the
+  // message history entries that were added.
+  // Return the number of message history entries.
+
+  const wxString sSample(_T("Sample"));
+  const wxString sMessage(_T("Message"));
+  const wxString sOldMessage(_T("OldMessage"));
+  wxString sKey;
+  wxString sNodeName;
+  wxXmlNode *pNode;
+  nwxXmlPersist *pItem;
+  size_t nCount = m_vpTable.Size();
+  size_t i;
+  for(i = 0; i < nCount; ++i)
+  {
+    sKey.Printf(_T("Sample %u"),(unsigned int) i);
+    pNode = _JournalItem(m_vpTable.at(i),sSample,sKey,pmapHash,pEntry);
+    if(pNode != NULL)
+    {
+      sKey.Printf(_T("%u"),(unsigned int) i);
+      pNode->AddProperty(COARjournal::g_sAttrIndex,sKey);
+    }
+  }
+  COARmessage *pMsg;
+  nCount = m_messages.GetMessageCount();
+  for(i = 0; i < nCount; ++i)
+  {
+    pMsg = m_messages.GetMessage(i);
+    sKey.Printf(_T("Message %d"),pMsg->GetMessageNumber());
+    _JournalItem(pMsg,sMessage,sKey,pmapHash,pEntry);
+  }
+  for(i = 0; (pItem = _GetJournalDirectory(i,&sNodeName)) != NULL; ++i)
+  {
+    _JournalItem(pItem,sNodeName,sNodeName,pmapHash,pEntry);
+  }
+  nCount = m_messages.GetEditedCount();
+  if(pEntry != NULL)
+  {
+    for(i = m_journal.GetEditedCount(); i < nCount; ++i)
+    {
+      auto_ptr<nwxXmlNodeList> apList(
+        m_messages.GetEdited(i)->CreateNodeList(sOldMessage));
+      if(!apList->empty())
+      {
+        pEntry->AddChild(apList->at(0));
+      }
+    }
+  }
+  return nCount;
+}
+
+void COARfile::_JournalBaseline()
+{
+  map<wxString,wxUint64> mapHash;
+  m_journal.SetEditedCount(_JournalScan(&mapHash,NULL));
+  m_journal.SetHashes(&mapHash);
+}
+
+void COARfile::_JournalReset()
+{
+  // the entire file was saved, remove the edit journal
+
+  COARjournal::RemoveFile(m_sFileName);
+  m_journal.Clear();
+  m_journal.SetBase(m_heading.GetFileTime());
+  m_journal.SetFileModTime(COARjournal::GetJournalModTime(m_sFileName));
+  if(CanSave())
+  {
+    _JournalBaseline();
+  }
+}
+
+bool COARfile::_SaveJournal()
+{
+  // append the changes since the last load or save to the
+  // edit journal, return false if the entire file
+  // should be saved instead
+
+  bool bRtn = false;
+  wxFileName fn(m_sFileName);
+  if(!fn.FileExists()) {}
+  else if(fn.GetModificationTime() != m_dtFileModTime) {}
+    // file was modified by another program
+  else if(
+    COARjournal::GetJournalModTime(m_sFileName) !=
+      m_journal.GetFileModTime()) {}
+    // journal was modified by another program
+  else if( (!m_journal.IsUsed()) && COARjournal::FileExists(m_sFileName)) {}
+    // journal is from an older version of the file
+  else if(!m_journal.IsComplete()) {}
+    // journal has a partial or unreadable entry that
+    // would hide any entry appended after it
+  else if(
+    (COARjournal::GetFileSize(m_sFileName) << 1) >
+      (size_t) fn.GetSize().GetValue()) {}
+    // journal is large enough that the file should be compacted
+  else
+  {
+    wxDateTime dt = wxDateTime::Now();
+    wxXmlNode *pEntry =
+      COARjournal::CreateEntry(m_journal.GetBase(),dt,m_sVersion);
+    map<wxString,wxUint64> mapHash;
+    size_t nEdited = _JournalScan(&mapHash,pEntry);
+    bool bKeepLock = false;
+    if(m_pLock == NULL)
+    {
+      m_pLock = new nwxLockFile();
+    }
+    else
+    {
+      bKeepLock = m_pLock->HasLock(m_sFileName);
+    }
+    if(bKeepLock || m_pLock->LockWait(m_sFileName,3))
+    {
+      bRtn = COARjournal::Append(m_sFileName,pEntry);
+      if(!bKeepLock)
+      {
+        m_pLock->Unlock(m_sFileName);
+      }
+    }
+    else
+    {
+      delete pEntry;
+    }
     if(bRtn)
     {
-      m_heading.SetTampered(true);
+      m_heading.AppendHistory(dt);
+      m_journal.SetHashes(&mapHash);
+      m_journal.SetEditedCount(nEdited);
+      m_journal.SetUsed(dt);
+      m_journal.SetFileModTime(
+        COARjournal::GetJournalModTime(m_sFileName));
+      m_bModified = false;
+    }
+    else
+    {
+      // a failed append may leave a partial entry
+      m_journal.SetComplete(false);
     }
   }
   return bRtn;
 }
 
+void COARfile::_JournalReplayEntry(wxXmlNode *pEntry)
+{
+  const wxString sSample(_T("Sample"));
+  const wxString sMessage(_T("Message"));
+  const wxString sOldMessage(_T("OldMessage"));
+  wxString sName;
+  wxString sNodeName;
+  wxString sIndex;
+  long nIndex;
+  nwxXmlPersist *pItem;
+  size_t i;
+  for(wxXmlNode *pNode = pEntry->GetChildren();
+    pNode != NULL;
+    pNode = pNode->GetNext())
+  {
+    if(pNode->GetType() != wxXML_ELEMENT_NODE)
+    {
+      continue;
+    }
+    sName = pNode->GetName();
+    if(sName == sSample)
+    {
+      if( pNode->GetPropVal(COARjournal::g_sAttrIndex,&sIndex) &&
+          sIndex.ToLong(&nIndex) &&
+          (nIndex >= 0) &&
+          ((size_t)nIndex < m_vpTable.Size()) )
+      {
+        m_vpTable.at((size_t)nIndex)->LoadFromNode(pNode);
+      }
+    }
+    else if(sName == sMessage)
+    {
+      COARmessage msg;
+      if(msg.LoadFromNode(pNode))
+      {
+        m_messages.ReplaceMessage(msg);
+      }
+    }
+    else if(sName == sOldMessage)
+    {
+      COARmessage msg;
+      if(msg.LoadFromNode(pNode))
+      {
+        m_messages.AppendEdited(msg);
+      }
+    }
+    else
+    {
+      for(i = 0; (pItem = _GetJournalDirectory(i,&sNodeName)) != NULL; ++i)
+      {
+        if(sName == sNodeName)
+        {
+          pItem->LoadFromNode(pNode);
+          break;
+        }
+      }
+    }
+  }
+}
+
+void COARfile::_JournalReplay()
+{
+  // apply the edit journal to the file that was just loaded,
+  // entries for a different version of the file are ignored
+
+  vector<wxXmlDocument *> vpDoc;
+  vector<wxXmlDocument *>::iterator itr;
+  wxDateTime dtBase;
+  wxDateTime dtTime;
+  wxDateTime dtLast;
+  wxString sVersion;
+  bool bUsed = false;
+  bool bComplete = true;
+  m_journal.Clear();
+  m_journal.SetBase(m_heading.GetFileTime());
+  m_journal.SetFileModTime(COARjournal::GetJournalModTime(m_sFileName));
+  if( (m_journal.GetFileModTime().GetTicks() > 0) &&
+      COARjournal::Read(m_sFileName,&vpDoc,&bComplete) )
+  {
+    for(itr = vpDoc.begin(); itr != vpDoc.end(); ++itr)
+    {
+      wxXmlNode *pEntry = (*itr)->GetRoot();
+      if( !COARjournal::ParseEntry(pEntry,&dtBase,&dtTime,&sVersion) ||
+          (dtBase.GetTicks() != m_journal.GetBase().GetTicks()) )
+      {
+        bComplete = false;
+        break;
+      }
+      _JournalReplayEntry(pEntry);
+      m_heading.AppendHistory(dtTime);
+      if(!sVersion.IsEmpty())
+      {
+        m_sVersion = sVersion;
+      }
+      dtLast = dtTime;
+      bUsed = true;
+    }
+    vectorptr<wxXmlDocument>::cleanup(&vpDoc);
+  }
+  if(bUsed)
+  {
+    m_journal.SetUsed(dtLast);
+  }
+  m_journal.SetComplete(bComplete);
+}
+
 bool COARfile::SamplesDisabled() const
 {
   bool bRtn = false;
@@ -44,6 +44,7 @@
 #include "COARdirectoryAlerts.h"
 #include "COARreview.h"
 #include "COARMsgExport.h"
+#include "COARjournal.h"
 #include "CAlertViewStatus.h"
 class nwxXmlCMF;
 class nwxXmlCMFSpecimen;
@@ -186,6 +187,7 @@ public:
     {
       m_bModified = false;
       m_sFileName = sFileName;
+      _JournalReset();
     }
     else
     {
@@ -195,9 +197,22 @@ public:
   }
   virtual bool SaveFile()
   {
-    bool bRtn = CanSave() && SaveFile(m_sFileName);
+    // append the changes to the edit journal if possible,
+    // otherwise save the entire file
+    bool bRtn = CanSave() && (_SaveJournal() || SaveFile(m_sFileName));
     return bRtn;
   }
+  bool CompactFile()
+  {
+    // save the entire file and remove the edit journal
+    bool bRtn = !HasJournal() || (CanSave() && SaveFile(m_sFileName));
+    return bRtn;
+  }
+  bool HasJournal() const
+  {
+    return !m_sFileName.IsEmpty() && COARjournal::FileExists(m_sFileName);
+  }
+  virtual bool CheckFileModification(bool bReload = false);
   const wxString &GetFileName() const
   {
     return m_sFileName;
@@ -344,6 +359,7 @@ public:
     m_pLastSampleDisabled = NULL;
     m_sFileName.Clear();
     m_bModified = false;
+    m_journal.Clear();
     _ClearLocusInfo();
     _ClearMessageBook();
   }
@@ -655,6 +671,7 @@ private:
   mutable vector<wxString> m_vsLocus; //**
   mutable vector<int> m_vnChannelNr; //**
   mutable const COARsample *m_pLastSampleDisabled; //**
+  COARjournal m_journal; //**
   bool m_bModified; //**
   bool m_bCheckedMsgBook; //**
 
@@ -665,6 +682,23 @@ private:
     COmittedAlerts *pOmitted,
     size_t nLen = 32000);
   void _PostProcessFile();
+
+  // edit journal
+
+  bool _SaveJournal();
+  void _JournalReplay();
+  void _JournalReplayEntry(wxXmlNode *pEntry);
+  void _JournalReset();
+  void _JournalBaseline();
+  size_t _JournalScan(
+    map<wxString,wxUint64> *pmapHash, wxXmlNode *pEntry);
+  wxXmlNode *_JournalItem(
+    nwxXmlPersist *pItem,
+    const wxString &sNodeName,
+    const wxString &sKey,
+    map<wxString,wxUint64> *pmapHash,
+    wxXmlNode *pEntry);
+  nwxXmlPersist *_GetJournalDirectory(size_t n, wxString *psNodeName);
   void _FormatCommonAlerts(
     COmittedAlerts *pOmitted,
     const COARsample *pSample,
@@ -166,6 +166,11 @@ public:
     m_tNewFileCreationTime.SetToCurrent();
     m_setSaveHistory.GetSetPtr()->insert(m_tNewFileCreationTime);
   }
+  void AppendHistory(const wxDateTime &dt)
+  {
+    // save time from the edit journal
+    m_setSaveHistory.GetSetPtr()->insert(dt);
+  }
   const set<wxDateTime> *GetHistory() const
   {
     return m_setSaveHistory.GetSetPtr();
@@ -0,0 +1,257 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: COARjournal.cpp
+*
+*/
+#include "COARjournal.h"
+#include "OsirisFileTypes.h"
+#include <wx/file.h>
+#include <wx/filename.h>
+#include <wx/mstream.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nwx/vectorptr.h"
+
+const wxString COARjournal::g_sRoot(_T("OsirisJournal"));
+const wxString COARjournal::g_sAttrIndex(_T("journalIndex"));
+const wxString COARjournal::g_sAttrBase(_T("base"));
+const wxString COARjournal::g_sAttrTime(_T("time"));
+const wxString COARjournal::g_sAttrVersion(_T("version"));
+
+static const char JOURNAL_HEADER[] = "#OsirisJournal ";
+
+wxString COARjournal::GetFileName(const wxString &sFileName)
+{
+  wxString sRtn(sFileName);
+  sRtn.Append(_T(EXT_REPORT_JOURNAL));
+  return sRtn;
+}
+bool COARjournal::FileExists(const wxString &sFileName)
+{
+  return wxFileName::FileExists(GetFileName(sFileName));
+}
+bool COARjournal::RemoveFile(const wxString &sFileName)
+{
+  wxString sJournal = GetFileName(sFileName);
+  bool bRtn = !wxFileName::FileExists(sJournal) ||
+    wxRemoveFile(sJournal);
+  return bRtn;
+}
+size_t COARjournal::GetFileSize(const wxString &sFileName)
+{
+  wxFileName fn(GetFileName(sFileName));
+  size_t nRtn = 0;
+  if(fn.FileExists())
+  {
+    nRtn = (size_t) fn.GetSize().GetValue();
+  }
+  return nRtn;
+}
+wxDateTime COARjournal::GetJournalModTime(const wxString &sFileName)
+{
+  wxFileName fn(GetFileName(sFileName));
+  wxDateTime dtRtn((time_t)0);
+  if(fn.FileExists())
+  {
+    dtRtn = fn.GetModificationTime();
+  }
+  return dtRtn;
+}
+
+bool COARjournal::Append(const wxString &sFileName, wxXmlNode *pEntry)
+{
+  wxXmlDocument doc;
+  wxMemoryOutputStream stream;
+  doc.SetRoot(pEntry);  // doc deletes pEntry
+  bool bRtn = doc.Save(stream);
+  if(bRtn)
+  {
+    size_t nLen = (size_t) stream.GetLength();
+    char sHeader[64];
+    vector<char> vBuffer(nLen + 1);
+    stream.CopyTo(&vBuffer[0],nLen);
+    sprintf(sHeader,"%s%lu\n",JOURNAL_HEADER,(unsigned long) nLen);
+    size_t nHeader = strlen(sHeader);
+
+    // append the header and entry with a single write
+    // so that an interrupted save leaves, at most, one
+    // partial entry at the end of the file
+
+    vBuffer.insert(vBuffer.begin(),sHeader,sHeader + nHeader);
+    nLen += nHeader;
+    wxFile file;
+    bRtn = file.Open(GetFileName(sFileName),wxFile::write_append) &&
+      (file.Write(&vBuffer[0],nLen) == nLen) &&
+      file.Flush();
+    file.Close();
+  }
+  return bRtn;
+}
+
+bool COARjournal::Read(
+  const wxString &sFileName,
+  vector<wxXmlDocument *> *pvpDoc,
+  bool *pbComplete)
+{
+  wxFile file;
+  *pbComplete = false;
+  bool bRtn = file.Open(GetFileName(sFileName),wxFile::read);
+  if(bRtn)
+  {
+    size_t nLen = (size_t) file.Length();
+    vector<char> vBuffer(nLen + 1);
+    bRtn = (file.Read(&vBuffer[0],nLen) == (ssize_t) nLen);
+    file.Close();
+    vBuffer[nLen] = 0;
+    const size_t nHeaderLen = strlen(JOURNAL_HEADER);
+    const char *pBuffer = &vBuffer[0];
+    const char *pEnd;
+    size_t nPos = 0;
+    size_t nStart;
+    size_t nEntry;
+    while(bRtn && (nPos + nHeaderLen < nLen))
+    {
+      pEnd = strchr(pBuffer + nPos,'\n');
+      if( (pEnd == NULL) ||
+          strncmp(pBuffer + nPos,JOURNAL_HEADER,nHeaderLen) )
+      {
+        break;
+      }
+      nEntry = (size_t) strtoul(pBuffer + nPos + nHeaderLen,NULL,10);
+      nStart = (size_t)(pEnd - pBuffer) + 1;
+      if(nStart + nEntry > nLen)
+      {
+        break; // partial entry at the end of the file
+      }
+      wxMemoryInputStream stream(pBuffer + nStart,nEntry);
+      auto_ptr<wxXmlDocument> apDoc(new wxXmlDocument);
+      if(!apDoc->Load(stream))
+      {
+        break;
+      }
+      pvpDoc->push_back(apDoc.release());
+      nPos = nStart + nEntry;
+    }
+    *pbComplete = bRtn && (nPos == nLen);
+    if(!bRtn)
+    {
+      vectorptr<wxXmlDocument>::cleanup(pvpDoc);
+    }
+  }
+  return bRtn;
+}
+
+wxXmlNode *COARjournal::CreateEntry(
+  const wxDateTime &dtBase,
+  const wxDateTime &dtTime,
+  const wxString &sVersion)
+{
+  wxXmlNode *pRtn = new wxXmlNode(wxXML_ELEMENT_NODE,g_sRoot);
+  wxString s;
+  s.Printf(_T("%ld"),(long) dtBase.GetTicks());
+  pRtn->AddProperty(g_sAttrBase,s);
+  s.Printf(_T("%ld"),(long) dtTime.GetTicks());
+  pRtn->AddProperty(g_sAttrTime,s);
+  pRtn->AddProperty(g_sAttrVersion,sVersion);
+  return pRtn;
+}
+bool COARjournal::ParseEntry(
+  wxXmlNode *pEntry,
+  wxDateTime *pdtBase,
+  wxDateTime *pdtTime,
+  wxString *psVersion)
+{
+  wxString sBase;
+  wxString sTime;
+  long nBase = 0;
+  long nTime = 0;
+  bool bRtn = (pEntry != NULL) &&
+    (pEntry->GetName() == g_sRoot) &&
+    pEntry->GetPropVal(g_sAttrBase,&sBase) &&
+    pEntry->GetPropVal(g_sAttrTime,&sTime) &&
+    sBase.ToLong(&nBase) &&
+    sTime.ToLong(&nTime);
+  if(bRtn)
+  {
+    pdtBase->Set((time_t)nBase);
+    pdtTime->Set((time_t)nTime);
+    if(!pEntry->GetPropVal(g_sAttrVersion,psVersion))
+    {
+      psVersion->Clear();
+    }
+  }
+  return bRtn;
+}
+
+//  64 bit FNV-1a hash
+
+#define FNV_OFFSET wxULL(14695981039346656037)
+#define FNV_PRIME wxULL(1099511628211)
+
+void COARjournal::_Hash(wxUint64 *pn, const wxString &s)
+{
+  const wxChar *p = s.c_str();
+  size_t nLen = s.Len();
+  wxUint64 n = *pn;
+  for(size_t i = 0; i < nLen; ++i)
+  {
+    n ^= (wxUint64)(unsigned int) p[i];
+    n *= FNV_PRIME;
+  }
+  // separator
+  n ^= (wxUint64) 0xffff;
+  n *= FNV_PRIME;
+  *pn = n;
+}
+void COARjournal::_HashNode(wxUint64 *pn, wxXmlNode *pNode)
+{
+  wxString s;
+  s.Printf(_T("%d"),(int) pNode->GetType());
+  _Hash(pn,s);
+  _Hash(pn,pNode->GetName());
+  _Hash(pn,pNode->GetContent());
+  for(wxXmlProperty *pProp = pNode->GetProperties();
+    pProp != NULL;
+    pProp = pProp->GetNext())
+  {
+    _Hash(pn,pProp->GetName());
+    _Hash(pn,pProp->GetValue());
+  }
+  for(wxXmlNode *pChild = pNode->GetChildren();
+    pChild != NULL;
+    pChild = pChild->GetNext())
+  {
+    _HashNode(pn,pChild);
+  }
+  _Hash(pn,wxEmptyString); // end of children
+}
+wxUint64 COARjournal::Hash(wxXmlNode *pNode)
+{
+  wxUint64 nRtn = FNV_OFFSET;
+  _HashNode(&nRtn,pNode);
+  return nRtn;
+}
@@ -0,0 +1,202 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: COARjournal.h
+*
+*/
+#ifndef __COAR_JOURNAL_H__
+#define __COAR_JOURNAL_H__
+
+#include <wx/string.h>
+#include <wx/datetime.h>
+#include "nwx/nwxXmlPersist.h"
+#include "nwx/stdb.h"
+#include <map>
+#include <vector>
+#include "nwx/stde.h"
+
+//************************************************* COARjournal
+//
+//  edit journal for an .oer file
+//
+//  Instead of rewriting the entire .oer file each time the
+//  user saves, COARfile appends the samples, messages and
+//  directory level items that changed since the last save
+//  to a journal file next to the .oer file.  Each entry is
+//  a header line, "#OsirisJournal <length>", followed by
+//  an xml document with the root node, <OsirisJournal>.
+//  The root node has the attributes:
+//
+//    base - time of the last full save of the .oer file
+//    time - time of this entry, added to the save history
+//    version - COARfile version
+//
+//  If the .oer file is rewritten, the journal no longer
+//  matches 'base' and is ignored, then it is removed when
+//  the file is saved again.  A partially written entry at
+//  the end of the file and anything after it are ignored,
+//  and the next save rewrites the entire file instead of
+//  appending entries that could not be read back.
+//
+//  COARjournal keeps a hash of each item as it was last
+//  loaded or saved so that only changed items are written.
+//
+
+class COARjournal
+{
+public:
+  COARjournal()
+  {
+    Clear();
+  }
+  void Clear()
+  {
+    m_mapHash.clear();
+    m_nEditedCount = 0;
+    m_dtBase.Set((time_t)0);
+    m_dtLast.Set((time_t)0);
+    m_dtFileModTime.Set((time_t)0);
+    m_bUsed = false;
+    m_bComplete = true;
+  }
+
+  // file i/o
+
+  static wxString GetFileName(const wxString &sFileName);
+  static bool FileExists(const wxString &sFileName);
+  static bool RemoveFile(const wxString &sFileName);
+  static size_t GetFileSize(const wxString &sFileName);
+  static wxDateTime GetJournalModTime(const wxString &sFileName);
+  static bool Append(const wxString &sFileName, wxXmlNode *pEntry);
+    // appends pEntry to the journal for sFileName,
+    // pEntry is deleted
+  static bool Read(
+    const wxString &sFileName,
+    vector<wxXmlDocument *> *pvpDoc,
+    bool *pbComplete);
+    // reads all entries into *pvpDoc, the caller must delete them,
+    // *pbComplete is set to false if anything follows the
+    // last valid entry
+
+  static wxXmlNode *CreateEntry(
+    const wxDateTime &dtBase,
+    const wxDateTime &dtTime,
+    const wxString &sVersion);
+  static bool ParseEntry(
+    wxXmlNode *pEntry,
+    wxDateTime *pdtBase,
+    wxDateTime *pdtTime,
+    wxString *psVersion);
+
+  // change tracking
+
+  static wxUint64 Hash(wxXmlNode *pNode);
+  bool IsChanged(const wxString &sKey, wxUint64 nHash) const
+  {
+    map<wxString,wxUint64>::const_iterator itr = m_mapHash.find(sKey);
+    bool bRtn = (itr == m_mapHash.end()) || (itr->second != nHash);
+    return bRtn;
+  }
+  void SetHashes(map<wxString,wxUint64> *pMap)
+  {
+    // take the contents of *pMap
+    m_mapHash.swap(*pMap);
+    pMap->clear();
+  }
+  size_t GetEditedCount() const
+  {
+    return m_nEditedCount;
+  }
+  void SetEditedCount(size_t n)
+  {
+    m_nEditedCount = n;
+  }
+
+  // journal state of the loaded file
+
+  bool IsUsed() const
+  {
+    // true if entries were loaded from or appended to the journal
+    return m_bUsed;
+  }
+  void SetUsed(const wxDateTime &dtLast)
+  {
+    m_dtLast = dtLast;
+    m_bUsed = true;
+  }
+  bool IsComplete() const
+  {
+    // false if the journal file has bytes that are not part
+    // of an entry that was loaded or appended, entries must
+    // not be appended after them
+    return m_bComplete;
+  }
+  void SetComplete(bool b)
+  {
+    m_bComplete = b;
+  }
+  const wxDateTime &GetBase() const
+  {
+    return m_dtBase;
+  }
+  void SetBase(const wxDateTime &dt)
+  {
+    m_dtBase = dt;
+  }
+  const wxDateTime &GetLast() const
+  {
+    return m_dtLast;
+  }
+  const wxDateTime &GetFileModTime() const
+  {
+    // modification time of the journal file when it was
+    // last read or written, zero if there was no file
+    return m_dtFileModTime;
+  }
+  void SetFileModTime(const wxDateTime &dt)
+  {
+    m_dtFileModTime = dt;
+  }
+
+  static const wxString g_sRoot;
+  static const wxString g_sAttrIndex;
+private:
+  static void _Hash(wxUint64 *pn, const wxString &s);
+  static void _HashNode(wxUint64 *pn, wxXmlNode *pNode);
+
+  static const wxString g_sAttrBase;
+  static const wxString g_sAttrTime;
+  static const wxString g_sAttrVersion;
+
+  map<wxString,wxUint64> m_mapHash;
+  size_t m_nEditedCount;
+  wxDateTime m_dtBase;
+  wxDateTime m_dtLast;
+  wxDateTime m_dtFileModTime;
+  bool m_bUsed;
+  bool m_bComplete;
+};
+
+#endif
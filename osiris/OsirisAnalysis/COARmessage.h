@@ -389,6 +389,34 @@ public:
   {
     m_vpMessage.reserve(m_vpMessage.size() + nToAdd);
   }
+
+  // edit journal, see COARjournal.h
+
+  void ReplaceMessage(const COARmessage &msg)
+  {
+    COARmessage *pmsg = GetMessageByNumber(msg.GetMessageNumber());
+    if(pmsg == NULL)
+    {
+      AddMessage(msg);
+    }
+    else
+    {
+      (*pmsg) = msg;
+    }
+  }
+  void AppendEdited(const COARmessage &msg)
+  {
+    m_vpMessageEdited.push_back(new COARmessage(msg));
+    _InitMapEdited();
+  }
+  size_t GetEditedCount() const
+  {
+    return m_vpMessageEdited.size();
+  }
+  COARmessage *GetEdited(size_t n)
+  {
+    return m_vpMessageEdited.at(n);
+  }
   const COARmsgExportMap *GetMsgExport() const
   {
     return m_pMsgExport;
@@ -111,6 +111,13 @@ CParmOsiris &CParmOsiris::operator =(const CParmOsiris &x)
   CP(m_bWarnOnHistory);
   CP(m_dZoomLocusMargin);
 
+  //  batch analysis, directories analyzed at once (0 for one per processor), samples at once in each, nice value, pin to processors
+
+  CP(m_nBatchConcurrent);
+  CP(m_nBatchJobs);
+  CP(m_nBatchNice);
+  CP(m_bBatchAffinity);
+
   //  grid
 
   CP(m_nTableDisplayPeak);
@@ -212,6 +219,13 @@ bool CParmOsiris::IsEqual(const CParmOsiris &x) const
   CP(m_bWarnOnHistory)
   CP(m_dZoomLocusMargin)
 
+  //  batch analysis, directories analyzed at once (0 for one per processor), samples at once in each, nice value, pin to processors
+
+  CP(m_nBatchConcurrent)
+  CP(m_nBatchJobs)
+  CP(m_nBatchNice)
+  CP(m_bBatchAffinity)
+
   //  grid
 
   CP(m_nTableDisplayPeak)
@@ -322,6 +336,13 @@ void CParmOsiris::RegisterAll(bool bInConstructor)
   RegisterBoolTrue(_T("WarnOnHistory"), &m_bWarnOnHistory);
   RegisterDouble(_T("ZoomLocusMargin"), &m_dZoomLocusMargin);
 
+  //  batch analysis, directories analyzed at once (0 for one per processor), samples at once in each, nice value, pin to processors
+
+  Register(_T("BatchConcurrent"),&m_ioUint1,(void *) &m_nBatchConcurrent);
+  Register(_T("BatchJobs"),&m_ioUint1,(void *) &m_nBatchJobs);
+  RegisterInt(_T("BatchNice"), &m_nBatchNice);
+  RegisterBool(_T("BatchAffinity"), &m_bBatchAffinity);
+
   //  grid
 
   RegisterInt(_T("TableDisplayPeak"), &m_nTableDisplayPeak);
@@ -434,6 +455,13 @@ void CParmOsiris::SetDefaults()
   m_bWarnOnHistory = true;
   m_dZoomLocusMargin = 0.0;
 
+  //  batch analysis, directories analyzed at once (0 for one per processor), samples at once in each, nice value, pin to processors
+
+  m_nBatchConcurrent = 1;
+  m_nBatchJobs = 1;
+  m_nBatchNice = 0;
+  m_bBatchAffinity = false;
+
   //  grid
 
   m_nTableDisplayPeak = 0;
@@ -512,6 +540,9 @@ const wxString CParmOsiris::LABEL_DATA_ANALYZED(_T("Analyzed"));
 const wxString CParmOsiris::LABEL_ANALYSIS(_T("Analysis: "));
 const wxString CParmOsiris::LABEL_DETECTION(_T("Detection: "));
 const wxString CParmOsiris::LABEL_INTERLOCUS(_T("Interlocus: "));
+const wxString CParmOsiris::LABEL_BATCH(_T("Batch "));
+const wxString CParmOsiris::LABEL_BATCH_CONCURRENT(_T("Directories at once: "));
+const wxString CParmOsiris::LABEL_BATCH_JOBS(_T("Samples at once: "));
 const wxString CParmOsiris::ERROR_MSG_INTERLOCUS(_T("Minimum interlocus RFU must be\ngreater than or equal to the minimum RFU"));
 
 
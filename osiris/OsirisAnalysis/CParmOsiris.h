@@ -264,6 +264,25 @@ public:
     return m_dZoomLocusMargin;
   }
 
+  //  batch analysis, directories analyzed at once (0 for one per processor), samples at once in each, nice value, pin to processors
+
+  unsigned int GetBatchConcurrent() const
+  {
+    return m_nBatchConcurrent;
+  }
+  unsigned int GetBatchJobs() const
+  {
+    return m_nBatchJobs;
+  }
+  int GetBatchNice() const
+  {
+    return m_nBatchNice;
+  }
+  bool GetBatchAffinity() const
+  {
+    return m_bBatchAffinity;
+  }
+
   //  grid
 
   int GetTableDisplayPeak() const
@@ -608,6 +627,25 @@ public:
     __SET_VALUE(m_dZoomLocusMargin,d);
   }
 
+  //  batch analysis, directories analyzed at once (0 for one per processor), samples at once in each, nice value, pin to processors
+
+  void SetBatchConcurrent(unsigned int n)
+  {
+    __SET_VALUE(m_nBatchConcurrent,n);
+  }
+  void SetBatchJobs(unsigned int n)
+  {
+    __SET_VALUE(m_nBatchJobs,n);
+  }
+  void SetBatchNice(int n)
+  {
+    __SET_VALUE(m_nBatchNice,n);
+  }
+  void SetBatchAffinity(bool b)
+  {
+    __SET_VALUE(m_bBatchAffinity,b);
+  }
+
   //  grid
 
   void SetTableDisplayPeak(int n)
@@ -904,6 +942,13 @@ protected:
   bool m_bWarnOnHistory;
   double m_dZoomLocusMargin;
 
+  //  batch analysis, directories analyzed at once (0 for one per processor), samples at once in each, nice value, pin to processors
+
+  unsigned int m_nBatchConcurrent;
+  unsigned int m_nBatchJobs;
+  int m_nBatchNice;
+  bool m_bBatchAffinity;
+
   //  grid
 
   int m_nTableDisplayPeak;
@@ -970,6 +1015,9 @@ public:
   static const wxString LABEL_ANALYSIS;
   static const wxString LABEL_DETECTION;
   static const wxString LABEL_INTERLOCUS;
+  static const wxString LABEL_BATCH;
+  static const wxString LABEL_BATCH_CONCURRENT;
+  static const wxString LABEL_BATCH_JOBS;
   static const wxString ERROR_MSG_INTERLOCUS;
 
 
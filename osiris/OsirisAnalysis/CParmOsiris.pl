@@ -102,6 +102,13 @@ my $VARLIST =
   ["m_bWarnOnHistory", "bool true"],
   ["m_dZoomLocusMargin", "double"],
 
+  ["batch analysis, directories analyzed at once (0 for one per processor), samples at once in each, nice value, pin to processors"],
+
+  ["m_nBatchConcurrent", "unsigned int","1",undef,"m_ioUint1"],
+  ["m_nBatchJobs", "unsigned int","1",undef,"m_ioUint1"],
+  ["m_nBatchNice", "int"],
+  ["m_bBatchAffinity", "bool"],
+
   ["grid"],
 ##  m_bTableSortBySeverity is deprecated
 
@@ -172,6 +179,9 @@ my $STATIC_STRINGS =
   ["LABEL_ANALYSIS", "Analysis: "],
   ["LABEL_DETECTION", "Detection: "],
   ["LABEL_INTERLOCUS", "Interlocus: "],
+  ["LABEL_BATCH", "Batch "],
+  ["LABEL_BATCH_CONCURRENT", "Directories at once: "],
+  ["LABEL_BATCH_JOBS", "Samples at once: "],
   ["ERROR_MSG_INTERLOCUS","Minimum interlocus RFU must be\\ngreater than or equal to the minimum RFU"]
 
 ];
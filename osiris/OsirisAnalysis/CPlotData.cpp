@@ -46,10 +46,14 @@
 */
 #include "mainApp.h"
 #include <wx/dir.h>
+#include <wx/mstream.h>
+#include <wx/file.h>
 #include "CPlotData.h"
 #include "COARfile.h"
+#include "OsirisFileTypes.h"
 #include "nwx/stdb.h"
 #include <map>
+#include <memory>
 #include "nwx/stde.h"
 #include "nwx/nsstd.h"
 
@@ -206,6 +210,14 @@ size_t CPlotChannel::GetPointCount()
     if(n > m_nPointCount) { m_nPointCount = n;}
     n = m_vnBaselinePoints.size();
     if(n > m_nPointCount) { m_nPointCount = n;}
+    n = m_ptRaw.GetCount();
+    if(n > m_nPointCount) { m_nPointCount = n;}
+    n = m_ptAnalyzed.GetCount();
+    if(n > m_nPointCount) { m_nPointCount = n;}
+    n = m_ptLadder.GetCount();
+    if(n > m_nPointCount) { m_nPointCount = n;}
+    n = m_ptBaseline.GetCount();
+    if(n > m_nPointCount) { m_nPointCount = n;}
   }
   return m_nPointCount;
 }
@@ -227,6 +239,100 @@ void CPlotChannel::BuildList(vector<int> &vn, double **p, size_t nPointCount)
     pd++;
   }
 }
+void CPlotChannel::BuildList(
+  const CPlotPoints &pt, double **p, size_t nPointCount)
+{
+  size_t i = nPointCount * sizeof(double);
+  double *pd = (double *)malloc(i);
+  memset(pd,0,i);
+  *p = pd;
+  size_t nSize = pt.GetCount();
+  if(nSize > nPointCount)
+  {
+    nSize = nPointCount;
+  }
+  for(i = 0; i < nSize; i++)
+  {
+    (*pd) = double(pt.GetAt(i));
+    pd++;
+  }
+}
+bool CPlotChannel::_GetType(
+  int nType, vector<int> **ppvn, const CPlotPoints **ppPoints)
+{
+  bool bRtn = true;
+  if(nType == CPlotData::TYPE_ANALYZED)
+  {
+    *ppvn = &m_vnAnalyzedPoints;
+    *ppPoints = &m_ptAnalyzed;
+  }
+  else if(nType == CPlotData::TYPE_RAW)
+  {
+    *ppvn = &m_vnRawPoints;
+    *ppPoints = &m_ptRaw;
+  }
+  else if(nType == CPlotData::TYPE_LADDER)
+  {
+    *ppvn = &m_vnLadderPoints;
+    *ppPoints = &m_ptLadder;
+  }
+  else if(nType == CPlotData::TYPE_BASELINE)
+  {
+    *ppvn = &m_vnBaselinePoints;
+    *ppPoints = &m_ptBaseline;
+  }
+  else
+  {
+    bRtn = false;
+  }
+  return bRtn;
+}
+size_t CPlotChannel::GetTypeCount(int nType)
+{
+  vector<int> *pvn;
+  const CPlotPoints *ppt;
+  size_t nRtn = 0;
+  if(!_GetType(nType,&pvn,&ppt)) {}
+  else if(ppt->IsEmpty())
+  {
+    nRtn = pvn->size();
+  }
+  else
+  {
+    nRtn = ppt->GetCount();
+  }
+  return nRtn;
+}
+int CPlotChannel::GetTypeValue(int nType, size_t n)
+{
+  vector<int> *pvn;
+  const CPlotPoints *ppt;
+  int nRtn = 0;
+  if(!_GetType(nType,&pvn,&ppt)) {}
+  else if(ppt->IsEmpty())
+  {
+    nRtn = pvn->at(n);
+  }
+  else
+  {
+    nRtn = ppt->GetAt(n);
+  }
+  return nRtn;
+}
+void CPlotChannel::SetPoints(
+  const CPlotPoints *pPoints, unsigned int nBaselineStart)
+{
+  ClearDoubles();
+  m_ptRaw = pPoints[0];
+  m_ptAnalyzed = pPoints[1];
+  m_ptLadder = pPoints[2];
+  m_ptBaseline = pPoints[3];
+  m_nPointCount = 0;
+  if(!m_ptBaseline.IsEmpty())
+  {
+    m_nBaselineStart = nBaselineStart;
+  }
+}
 #if BASELINE_START
 double *CPlotChannel::GetBaselineX()
 {
@@ -249,6 +355,10 @@ double *CPlotChannel::GetBaselineX()
   return m_pdBaselineX;
 }
 #endif
+const unsigned int CPlotPoints::TYPE_NONE = 0;
+const unsigned int CPlotPoints::TYPE_SHORT = 1;
+const unsigned int CPlotPoints::TYPE_INT = 2;
+
 const int CPlotLocus::MARGIN = 10;
 
 void CPlotLocus::RegisterAll(bool bInConstructor)
@@ -265,6 +375,143 @@ void CPlotLocus::RegisterAll(bool bInConstructor)
   }
 }
 
+const char *CPlotDataMap::TAG = "OSIRPLTB";
+const unsigned int CPlotDataMap::BYTE_ORDER_MARK = 0x01020304;
+const unsigned int CPlotDataMap::FILE_VERSION = 2;
+const size_t CPlotDataMap::PREAMBLE_SIZE = 40;
+const size_t CPlotDataMap::CHANNEL_ENTRY_SIZE = 56;
+
+CPlotDataMap::CPlotDataMap() :
+  m_pData(NULL),
+  m_nSize(0)
+{}
+
+CPlotDataMap::~CPlotDataMap()
+{
+  Close();
+}
+
+bool CPlotDataMap::Open(const wxString &sFileName)
+{
+  // the whole file is read and the file is closed, so the
+  // analysis can rewrite it while the plot is shown
+  Close();
+  wxFile file(sFileName);
+  if(file.IsOpened())
+  {
+    wxFileOffset nLength = file.Length();
+    if( (nLength > 0) && (nLength <= (wxFileOffset)0x7fffffff) )
+    {
+      m_nSize = (size_t)nLength;
+      m_pData = (char *)malloc(m_nSize);
+    }
+    if( (m_pData != NULL) &&
+      ((size_t)file.Read((void *)m_pData,m_nSize) != m_nSize) )
+    {
+      Close();
+    }
+    file.Close();
+  }
+  bool bRtn = (m_pData != NULL) && _Validate();
+  if(!bRtn)
+  {
+    Close();
+  }
+  return bRtn;
+}
+
+void CPlotDataMap::Close()
+{
+  FREEPTR(m_pData);
+  m_nSize = 0;
+}
+
+bool CPlotDataMap::_Validate()
+{
+  // a file written with a different byte order or by
+  // another version is not used, the .plt file is used instead
+  bool bRtn = false;
+  if( (m_nSize < PREAMBLE_SIZE) || memcmp(m_pData,TAG,8) ) {}
+  else if( (_GetUint(8) != BYTE_ORDER_MARK) || (_GetUint(12) != FILE_VERSION) ) {}
+  else
+  {
+    size_t nHeader = _GetUint(16);
+    size_t nHeaderLength = _GetUint(20);
+    size_t nChannels = _GetUint(24);
+    size_t nTable = _GetUint(28);
+    bRtn =
+      (nHeader >= PREAMBLE_SIZE) &&
+      (nHeader <= m_nSize) &&
+      (nHeaderLength <= (m_nSize - nHeader)) &&
+      (!(nTable & 7)) &&
+      (nTable <= m_nSize) &&
+      (nChannels <= ((m_nSize - nTable) / CHANNEL_ENTRY_SIZE));
+  }
+  return bRtn;
+}
+
+const char *CPlotDataMap::GetHeader() const
+{
+  return IsOpen() ? (m_pData + _GetUint(16)) : NULL;
+}
+size_t CPlotDataMap::GetHeaderLength() const
+{
+  return IsOpen() ? (size_t)_GetUint(20) : 0;
+}
+size_t CPlotDataMap::GetPltLength() const
+{
+  return IsOpen() ? (size_t)_GetUint(32) : 0;
+}
+unsigned int CPlotDataMap::GetChannelCount() const
+{
+  return IsOpen() ? _GetUint(24) : 0;
+}
+
+bool CPlotDataMap::GetChannel(
+  unsigned int ndx, int *pnChannel,
+  unsigned int *pnBaselineStart, CPlotPoints *pPoints) const
+{
+  bool bRtn = (ndx < GetChannelCount());
+  if(bRtn)
+  {
+    size_t nEntry = _GetUint(28) + (ndx * CHANNEL_ENTRY_SIZE);
+    size_t nCount;
+    size_t nOffset;
+    size_t nPointSize;
+    unsigned int nType;
+    *pnChannel = (int)_GetUint(nEntry);
+    *pnBaselineStart = _GetUint(nEntry + 4);
+    nEntry += 8;
+    for(int i = 0; bRtn && (i < 4); i++)
+    {
+      nType = _GetUint(nEntry);
+      nCount = _GetUint(nEntry + 4);
+      nOffset = _GetUint(nEntry + 8);
+      nPointSize =
+        (nType == CPlotPoints::TYPE_SHORT)
+        ? sizeof(short)
+        : ((nType == CPlotPoints::TYPE_INT) ? sizeof(int) : 0);
+      if(nType == CPlotPoints::TYPE_NONE)
+      {
+        pPoints[i].Clear();
+      }
+      else if( (!nPointSize) ||
+        (nOffset & 7) ||
+        (nOffset > m_nSize) ||
+        (nCount > ((m_nSize - nOffset) / nPointSize)) )
+      {
+        bRtn = false;
+      }
+      else
+      {
+        pPoints[i].Set((const void *)(m_pData + nOffset),nCount,nType);
+      }
+      nEntry += 12;
+    }
+  }
+  return bRtn;
+}
+
 CPlotData::~CPlotData()
 {
   _Cleanup();
@@ -277,6 +524,11 @@ void CPlotData::_Cleanup()
   m_nPointCount = 0;
   m_IOchannel.Cleanup();
   m_IOlocus.Cleanup();
+  if(m_pMap != NULL)
+  {
+    delete m_pMap;
+    m_pMap = NULL;
+  }
 }
 void CPlotData::RegisterAll(bool bInConstructor)
 {
@@ -334,6 +586,95 @@ bool CPlotData::LoadFromNode(wxXmlNode *pNode)
   return bRtn;
 }
 
+wxString CPlotData::BinaryFileName(const wxString &sFileName)
+{
+  wxString sRtn;
+  if(IS_FILE_TYPE(sFileName,EXT_GRAPHIC))
+  {
+    sRtn = sFileName.Left(sFileName.Len() - strlen(EXT_GRAPHIC));
+    sRtn.Append(_T(EXT_GRAPHIC_BINARY));
+  }
+  return sRtn;
+}
+
+bool CPlotData::LoadFile(const wxString &sFileName, bool bLock)
+{
+  // use the binary file if it is there, otherwise parse the
+  // .plt file.  If the file is to be locked, leave it to
+  // nwxXmlPersist
+  bool bRtn = (!bLock) && _LoadBinaryFile(sFileName);
+  if(!bRtn)
+  {
+    bRtn = nwxXmlPersist::LoadFile(sFileName,bLock);
+  }
+  return bRtn;
+}
+
+bool CPlotData::_LoadBinaryFile(const wxString &sFileName)
+{
+  wxString sBinary = BinaryFileName(sFileName);
+  bool bRtn = false;
+  if( sBinary.IsEmpty() ||
+      !wxFileName::FileExists(sFileName) ||
+      !wxFileName::FileExists(sBinary) ) {}
+  else if(wxFileName(sBinary).GetModificationTime().IsEarlierThan(
+      wxFileName(sFileName).GetModificationTime()))
+  {
+    // left over from an earlier analysis
+  }
+  else
+  {
+    // the length of the .plt file is checked as well, because
+    // the modification times have a resolution of one second
+    auto_ptr<CPlotDataMap> pMap(new CPlotDataMap());
+    if( pMap->Open(sBinary) &&
+      (wxFileName::GetSize(sFileName) == wxULongLong(pMap->GetPltLength())) )
+    {
+      wxMemoryInputStream stream(pMap->GetHeader(),pMap->GetHeaderLength());
+      auto_ptr<wxXmlDocument> apDoc(new wxXmlDocument);
+      Init();
+      bRtn = apDoc->Load(stream) &&
+        LoadFromNode(apDoc->GetRoot()) &&
+        _AttachMap(pMap.get());
+      if(bRtn)
+      {
+        m_pMap = pMap.release();
+        _SetFileName(sFileName);
+      }
+      else
+      {
+        Init();
+      }
+    }
+  }
+  return bRtn;
+}
+
+bool CPlotData::_AttachMap(const CPlotDataMap *pMap)
+{
+  CPlotPoints aPoints[4];
+  CPlotChannel *pChannel;
+  unsigned int nCount = pMap->GetChannelCount();
+  unsigned int nBaselineStart;
+  int nChannel;
+  bool bRtn = (nCount == GetChannelCount());
+  for(unsigned int i = 0; bRtn && (i < nCount); i++)
+  {
+    bRtn = pMap->GetChannel(i,&nChannel,&nBaselineStart,aPoints);
+    pChannel = bRtn ? FindChannel((unsigned int)nChannel) : NULL;
+    if(pChannel == NULL)
+    {
+      bRtn = false;
+    }
+    else
+    {
+      pChannel->SetPoints(aPoints,nBaselineStart);
+    }
+  }
+  m_nPointCount = 0;
+  return bRtn;
+}
+
 size_t CPlotData::GetPointCount()
 {
   if( (!m_nPointCount) && (m_nInterval > 0) &&
@@ -511,8 +852,8 @@ bool CPlotData::GetLocusRange(
   if(bRtn)
   {
     // this could be in the for loop but is easier to read here
-    vector<int> *ppvn[4];
-    vector<int> *pvn;
+    int anType[4];
+    int nPointType;
     int y;
     int ndxMax = 0;
     int x1;
@@ -523,22 +864,22 @@ bool CPlotData::GetLocusRange(
 #endif
     if(nType & TYPE_ANALYZED)
     {
-      ppvn[ndxMax++] = &pCh->m_vnAnalyzedPoints;
+      anType[ndxMax++] = TYPE_ANALYZED;
     }
     if(nType & TYPE_RAW)
     {
-      ppvn[ndxMax++] = &pCh->m_vnRawPoints;
+      anType[ndxMax++] = TYPE_RAW;
     }
     if(nType & TYPE_LADDER)
     {
-      ppvn[ndxMax++] = &pCh->m_vnLadderPoints;
+      anType[ndxMax++] = TYPE_LADDER;
     }
     if(nType & TYPE_BASELINE)
     {
 #if BASELINE_START
       ndxBaseline = ndxMax;
 #endif
-      ppvn[ndxMax++] = &pCh->m_vnBaselinePoints;
+      anType[ndxMax++] = TYPE_BASELINE;
     }
     *px2 = ppl->GetEndExtended();
     *px1 = ppl->GetStartExtended();
@@ -546,7 +887,7 @@ bool CPlotData::GetLocusRange(
     *py2 = 1; // make it > *py1
     for(int j = 0; j < ndxMax; ++j)
     {
-      pvn = ppvn[j];
+      nPointType = anType[j];
       x1 = *px1;
       x2 = *px2;
 #if BASELINE_START
@@ -557,7 +898,7 @@ bool CPlotData::GetLocusRange(
         x2 -= nBaselineStart;
       }
 #endif
-      nSize = (int) pvn->size();
+      nSize = (int) pCh->GetTypeCount(nPointType);
       if(x2 >= nSize)
       {
         x2 = nSize;
@@ -569,7 +910,7 @@ bool CPlotData::GetLocusRange(
       }
       for(int n = x1; n <= x2; ++n)
       {
-        y = pvn->at((size_t)n);
+        y = pCh->GetTypeValue(nPointType,(size_t)n);
         if(y < *py1)
         {
           *py1 = y;
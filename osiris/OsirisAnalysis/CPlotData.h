@@ -450,6 +450,53 @@ private:
 };
 
 
+// CPlotPoints - points of one channel in a binary plot
+//  file (.pltb) read into memory, see CPlotDataMap below
+
+class CPlotPoints
+{
+public:
+  static const unsigned int TYPE_NONE;
+  static const unsigned int TYPE_SHORT;
+  static const unsigned int TYPE_INT;
+
+  CPlotPoints()
+  {
+    Clear();
+  }
+  void Clear()
+  {
+    m_pData = NULL;
+    m_nCount = 0;
+    m_nType = TYPE_NONE;
+  }
+  void Set(const void *pData, size_t nCount, unsigned int nType)
+  {
+    m_pData = pData;
+    m_nCount = nCount;
+    m_nType = nType;
+  }
+  size_t GetCount() const
+  {
+    return m_nCount;
+  }
+  bool IsEmpty() const
+  {
+    return !m_nCount;
+  }
+  int GetAt(size_t n) const
+  {
+    int nRtn = (m_nType == TYPE_SHORT)
+      ? int( ((const short *)m_pData)[n] )
+      : ((const int *)m_pData)[n];
+    return nRtn;
+  }
+private:
+  const void *m_pData;
+  size_t m_nCount;
+  unsigned int m_nType;
+};
+
 class CPlotChannel : public nwxXmlPersist
 {
 public:
@@ -487,7 +534,9 @@ public:
   size_t GetPointCount();
   size_t GetBaselinePointCount() const
   {
-    return m_vnBaselinePoints.size();
+    return m_ptBaseline.IsEmpty()
+      ? m_vnBaselinePoints.size()
+      : m_ptBaseline.GetCount();
   }
   const vector<CSamplePeak *> &GetPeaks()
   {
@@ -558,6 +607,10 @@ private:
     m_vnAnalyzedPoints.clear();
     m_vnLadderPoints.clear();
     m_vnBaselinePoints.clear();
+    m_ptRaw.Clear();
+    m_ptAnalyzed.Clear();
+    m_ptLadder.Clear();
+    m_ptBaseline.Clear();
   }
   void ClearDoubles()
   {
@@ -570,11 +623,25 @@ private:
 #endif
   }
   static void BuildList(vector<int> &vn, double **p, size_t nPointCount);
+  static void BuildList(const CPlotPoints &pt, double **p, size_t nPointCount);
+  static void BuildList(
+    vector<int> &vn, const CPlotPoints &pt, double **p, size_t nPointCount)
+  {
+    // points from a binary plot file take the place of the xml points
+    if(pt.IsEmpty())
+    {
+      BuildList(vn,p,nPointCount);
+    }
+    else
+    {
+      BuildList(pt,p,nPointCount);
+    }
+  }
   double *GetRaw()
   {
     if(m_pdRaw == NULL)
     {
-      BuildList(m_vnRawPoints,&m_pdRaw,GetPointCount());
+      BuildList(m_vnRawPoints,m_ptRaw,&m_pdRaw,GetPointCount());
     }
     return m_pdRaw;
   }
@@ -582,7 +649,7 @@ private:
   {
     if(m_pdAnalyzed == NULL)
     {
-      BuildList(m_vnAnalyzedPoints,&m_pdAnalyzed,GetPointCount());
+      BuildList(m_vnAnalyzedPoints,m_ptAnalyzed,&m_pdAnalyzed,GetPointCount());
     }
     return m_pdAnalyzed;
   }
@@ -590,22 +657,26 @@ private:
   {
     if(m_pdLadder == NULL)
     {
-      BuildList(m_vnLadderPoints,&m_pdLadder,GetPointCount());
+      BuildList(m_vnLadderPoints,m_ptLadder,&m_pdLadder,GetPointCount());
     }
     return m_pdLadder;
   }
   double *GetBaseline()
   {
-    if((m_pdBaseline == NULL) && m_vnBaselinePoints.size())
+    if((m_pdBaseline == NULL) && HasBaseline())
     {
-      BuildList(m_vnBaselinePoints,&m_pdBaseline,GetPointCount());
+      BuildList(m_vnBaselinePoints,m_ptBaseline,&m_pdBaseline,GetPointCount());
     }
     return m_pdBaseline;
   }
   bool HasBaseline()
   {
-    return !!m_vnBaselinePoints.size();
+    return !!GetBaselinePointCount();
   }
+  size_t GetTypeCount(int nType);
+  int GetTypeValue(int nType, size_t n);
+  void SetPoints(const CPlotPoints *pPoints, unsigned int nBaselineStart);
+  bool _GetType(int nType, vector<int> **ppvn, const CPlotPoints **ppPoints);
 #if BASELINE_START
   double *GetBaselineX();
   unsigned int GetBaselineStart() const
@@ -626,6 +697,10 @@ private:
   vector<CSamplePeak *> m_vSamplePeak;
   vector<CSamplePeak *> m_vLadderPeak;
   vector<CArtifact *> m_vArtifact;
+  CPlotPoints m_ptRaw;
+  CPlotPoints m_ptAnalyzed;
+  CPlotPoints m_ptLadder;
+  CPlotPoints m_ptBaseline;
   double m_dMinRfu;
   int m_nr;
   unsigned int m_nBaselineStart; // keeping it because it is in the .plt file
@@ -734,6 +809,49 @@ private:
   unsigned int m_nChannel;
 };
 
+// CPlotDataMap - binary plot file (.pltb) read into memory
+//
+//  The analysis writes it next to each .plt file.  It holds
+//  the .plt xml without the point lists, followed by a table
+//  of channels and the points of each channel as arrays of
+//  16 or 32 bit integers, so the points are used where they
+//  are instead of being parsed.  The layout is described in
+//  OsirisLib2.01/PlotDataPoints.h
+
+class CPlotDataMap
+{
+public:
+  CPlotDataMap();
+  virtual ~CPlotDataMap();
+  bool Open(const wxString &sFileName);
+  void Close();
+  bool IsOpen() const
+  {
+    return m_pData != NULL;
+  }
+  const char *GetHeader() const;
+  size_t GetHeaderLength() const;
+  size_t GetPltLength() const;
+  unsigned int GetChannelCount() const;
+  // pPoints is an array of 4: raw, analyzed, ladder, baseline
+  bool GetChannel(
+    unsigned int ndx, int *pnChannel,
+    unsigned int *pnBaselineStart, CPlotPoints *pPoints) const;
+private:
+  unsigned int _GetUint(size_t nOffset) const
+  {
+    return *((const unsigned int *)(m_pData + nOffset));
+  }
+  bool _Validate();
+  char *m_pData;
+  size_t m_nSize;
+  static const char *TAG;
+  static const unsigned int BYTE_ORDER_MARK;
+  static const unsigned int FILE_VERSION;
+  static const size_t PREAMBLE_SIZE;
+  static const size_t CHANNEL_ENTRY_SIZE;
+};
+
 class CPlotData : public nwxXmlPersist
 {
 public:
@@ -746,6 +864,7 @@ public:
   CPlotData() : m_IOchannel(true), m_IOlocus(true)
   {
     m_pdX = NULL;
+    m_pMap = NULL;
     m_nStart = 0;
     m_nBegin = 0;
     m_nInterval = 0;
@@ -778,6 +897,16 @@ public:
   }
 
   virtual bool LoadFromNode(wxXmlNode *pNode);
+  virtual bool LoadFile(const wxString &sFileName, bool bLock);
+  virtual bool LoadFile(const wxString &sFileName)
+  {
+    return LoadFile(sFileName,false);
+  }
+  bool IsBinary() const
+  {
+    return m_pMap != NULL;
+  }
+  static wxString BinaryFileName(const wxString &sFileName);
   size_t GetPointCount();
 #if BASELINE_START
   size_t GetBaselinePointCount(unsigned int nChannel);
@@ -936,6 +1065,8 @@ protected:
 private:
   void _FixBaseline();
   void _Cleanup();
+  bool _LoadBinaryFile(const wxString &sFileName);
+  bool _AttachMap(const CPlotDataMap *pMap);
   CPlotChannel *FindChannel(unsigned int n);
   CParmOsiris m_parm;
   wxString m_sFilename;
@@ -952,6 +1083,7 @@ private:
   unsigned int m_nILS;
   size_t m_nPointCount;
   double *m_pdX;
+  CPlotDataMap *m_pMap; // points of m_vChannels when loaded from .pltb
 
   TnwxXmlIOPersistVector<CPlotChannel> m_IOchannel;
   TnwxXmlIOPersistVector<CPlotLocus> m_IOlocus;
@@ -41,6 +41,13 @@
 #include <wx/utils.h>
 #ifndef __WXMSW__
 #include <sys/wait.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#else
+#include <wx/msw/wrapwin.h>
+#endif
+#ifdef __linux__
+#include <sched.h>
 #endif
 
 bool CProcess::Run(char **argv)
@@ -81,6 +88,74 @@ void CProcess::Cancel()
   }
 }
 
+bool CProcess::SetPriority(int nNice)
+{
+  bool bRtn = false;
+  if(m_nPID && m_bRunning)
+  {
+#ifdef __WXMSW__
+    DWORD nClass = NORMAL_PRIORITY_CLASS;
+    if(nNice >= 10)
+    {
+      nClass = IDLE_PRIORITY_CLASS;
+    }
+    else if(nNice > 0)
+    {
+      nClass = BELOW_NORMAL_PRIORITY_CLASS;
+    }
+    else if(nNice < 0)
+    {
+      nClass = ABOVE_NORMAL_PRIORITY_CLASS;
+    }
+    HANDLE hProcess = ::OpenProcess(
+      PROCESS_SET_INFORMATION,FALSE,(DWORD)m_nPID);
+    if(hProcess != NULL)
+    {
+      bRtn = !!::SetPriorityClass(hProcess,nClass);
+      ::CloseHandle(hProcess);
+    }
+#else
+    bRtn = !setpriority(PRIO_PROCESS,(id_t)m_nPID,nNice);
+#endif
+  }
+  return bRtn;
+}
+bool CProcess::SetAffinity(int nFirstCPU, int nCPUCount)
+{
+  bool bRtn = false;
+  if(m_nPID && m_bRunning && (nFirstCPU >= 0) && (nCPUCount > 0))
+  {
+#if defined(__WXMSW__)
+    int nEnd = nFirstCPU + nCPUCount;
+    const int MAX_CPU = (int)(sizeof(DWORD_PTR) * 8);
+    DWORD_PTR nMask = 0;
+    for(int i = nFirstCPU; (i < nEnd) && (i < MAX_CPU); i++)
+    {
+      nMask |= ((DWORD_PTR)1) << i;
+    }
+    HANDLE hProcess = (nMask == 0) ? NULL : ::OpenProcess(
+      PROCESS_SET_INFORMATION | PROCESS_QUERY_INFORMATION,
+      FALSE,(DWORD)m_nPID);
+    if(hProcess != NULL)
+    {
+      bRtn = !!::SetProcessAffinityMask(hProcess,nMask);
+      ::CloseHandle(hProcess);
+    }
+#elif defined(__linux__)
+    int nEnd = nFirstCPU + nCPUCount;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for(int i = nFirstCPU; (i < nEnd) && (i < CPU_SETSIZE); i++)
+    {
+      CPU_SET(i,&set);
+    }
+    bRtn = !sched_setaffinity((pid_t)m_nPID,sizeof(set),&set);
+#else
+    // no process affinity on the macintosh
+#endif
+  }
+  return bRtn;
+}
 
 void CProcess::OnTerminate(int nPID,int nStatus)
 {
@@ -81,6 +81,16 @@ public:
   {
     return m_bKilled;
   }
+  long GetPID()
+  {
+    return m_nPID;
+  }
+  // set the priority as a unix nice value, on windows > 0 is below
+  //  normal, >= 10 is idle and < 0 is above normal
+  bool SetPriority(int nNice);
+  // keep the process on processors nFirstCPU to nFirstCPU + nCPUCount - 1,
+  //  not available on the macintosh
+  bool SetAffinity(int nFirstCPU, int nCPUCount);
   void Wait();
   size_t ProcessIO(size_t nLimit = 0x7fffffff);
   bool IsErrorOpened() const;
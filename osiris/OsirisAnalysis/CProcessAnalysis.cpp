@@ -34,6 +34,7 @@
 #include <string.h>
 #include <wx/filename.h>
 #include "CProcessAnalysis.h"
+#include "CAnalysisStatus.h"
 #include "CDirList.h"
 #include "CParmOsiris.h"
 #include "CVolumes.h"
@@ -45,10 +46,12 @@
 CProcessAnalysis::CProcessAnalysis(
   CDirEntry *pDirEntry, 
   const CVolume *pVolume,
-  wxEvtHandler *parent, int nID) :
+  wxEvtHandler *parent, int nID,
+  int nFirstCPU, int nCPUCount) :
     CProcess(parent,nID),
     m_psExe(NULL),
-    m_pDirEntry(pDirEntry)
+    m_pDirEntry(pDirEntry),
+    m_pStatus(NULL)
 {
 #define END_LINE sStdin.Append(_T(";\n"))
 
@@ -111,6 +114,33 @@ CProcessAnalysis::CProcessAnalysis(
   APPEND_LINE("LabSettings",pVolume->GetLabSettingsFileName());
   APPEND_LINE("StandardSettings",pVolume->GetStdSettingsFileName());
   APPEND_LINE("MessageBook",pVolume->GetMessageBookFileName());
+  // reuse ILS peak selections of earlier analyses of this directory,
+  //  this makes reanalysis with different sample thresholds faster
+
+  APPEND_LINE("ILSCache",_T("true"));
+  // read sample files ahead of, and write plot files behind,
+  //  the analysis, which matters most on network drives
+
+  APPEND_INT("ReadAhead",4);
+  APPEND_INT("WriteBehind",8);
+  // receive progress and sample status through shared memory
+  //  instead of reading "Progress = " from stdout
+
+  m_pStatus = new CAnalysisStatus;
+  if(m_pStatus->IsOK())
+  {
+    APPEND_LINE("StatusServer",m_pStatus->GetName());
+    APPEND_LINE("ConsoleProgress",_T("false"));
+  }
+  else
+  {
+    delete m_pStatus;
+    m_pStatus = NULL;
+  }
+  if(pParm->GetBatchJobs() > 1)
+  {
+    APPEND_INT("Jobs",(int)pParm->GetBatchJobs());
+  }
   const wxString &sOverride(pParm->GetAnalysisOverride());
   if(!sOverride.IsEmpty())
   {
@@ -141,6 +171,23 @@ CProcessAnalysis::CProcessAnalysis(
   char *argv[] = { m_psExe, NULL  };
   m_dProgress = 0.0;
   Run(argv);
+
+  // the analysis starts its worker processes only after it has
+  //  read its input, so set the priority and processors first
+  //  and the workers inherit them
+
+  if(IsRunning())
+  {
+    int nNice = pParm->GetBatchNice();
+    if(nNice)
+    {
+      SetPriority(nNice);
+    }
+    if(nCPUCount > 0)
+    {
+      SetAffinity(nFirstCPU,nCPUCount);
+    }
+  }
   wxOutputStream *pOut = GetOutputStream();
   wxASSERT_MSG(pOut != NULL,_T("Cannot get output stream for process"));
   mainApp::LogMessage(sStdin);
@@ -173,6 +220,55 @@ CProcessAnalysis::~CProcessAnalysis()
     free((void *)m_psExe);
     m_psExe = NULL;
   }
+  if(m_pStatus != NULL)
+  {
+    delete m_pStatus;
+    m_pStatus = NULL;
+  }
+}
+
+bool CProcessAnalysis::ProcessStatus()
+{
+  bool bRtn = false;
+  if((m_pStatus != NULL) && m_pStatus->Poll())
+  {
+    double dProgress = m_pStatus->GetProgress();
+    if(m_pStatus->IsFinished())
+    {
+      m_dProgress = 100.0;
+    }
+    else if(dProgress > 0.0)
+    {
+      m_dProgress = dProgress;
+    }
+    bRtn = true;
+  }
+  return bRtn;
+}
+int CProcessAnalysis::GetSamplesProcessed()
+{
+  return (m_pStatus != NULL) ? m_pStatus->GetSamplesProcessed() : 0;
+}
+int CProcessAnalysis::GetSampleCount()
+{
+  return (m_pStatus != NULL) ? m_pStatus->GetSampleCount() : 0;
+}
+int CProcessAnalysis::GetSamplesFailed()
+{
+  return (m_pStatus != NULL) ? m_pStatus->GetSamplesFailed() : 0;
+}
+wxString CProcessAnalysis::GetCurrentSample()
+{
+  wxString sRtn;
+  if(m_pStatus != NULL)
+  {
+    sRtn = m_pStatus->GetCurrentSample();
+  }
+  return sRtn;
+}
+bool CProcessAnalysis::IsFinished()
+{
+  return (m_pStatus != NULL) && m_pStatus->IsFinished();
 }
 
 void CProcessAnalysis::ProcessLine(
@@ -36,22 +36,33 @@
 
 class CDirEntry;
 class CVolume;
+class CAnalysisStatus;
 
 class CProcessAnalysis : public CProcess
 {
 public:
+  // nFirstCPU and nCPUCount, if nCPUCount > 0, are the processors
+  //  for the analysis and the worker processes it starts
   CProcessAnalysis(
     CDirEntry *pDirEntry, 
     const CVolume *pVolume,
     wxEvtHandler *parent, 
-    int nID = wxID_ANY);
+    int nID = wxID_ANY,
+    int nFirstCPU = -1,
+    int nCPUCount = 0);
   virtual ~CProcessAnalysis();
   virtual void ProcessLine(
     const char *p, size_t nLen, bool bErrStream);
+  bool ProcessStatus(); // read records from the status server
   double GetProgress()
   {
     return m_dProgress;
   }
+  int GetSamplesProcessed();
+  int GetSampleCount();
+  int GetSamplesFailed();
+  wxString GetCurrentSample();
+  bool IsFinished(); // the analysis has reported that it is done
   bool IsOutputModified();
   CDirEntry *GetDirEntry()
   {
@@ -63,6 +74,7 @@ private:
   char *m_psExe;
   double m_dProgress;
   CDirEntry *m_pDirEntry;
+  CAnalysisStatus *m_pStatus;
 };
 
 
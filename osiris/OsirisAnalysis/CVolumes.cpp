@@ -44,17 +44,26 @@
 #define MESSAGE_BOOK_FILE _T("MessageBookV4.0.xml")
 #define STD_SETTINGS_FILE _T("StdSettings.xml")
 #define LAB_SETTINGS_FILE _T("LabSettings.xml")
+#define VOLUME_INDEX_FILE _T("volumeIndex.xml")
 
 #define LOCK_READ_MS  5000
 #define LOCK_MS 10000
 
 //******************************************************  CVolume
 
+const wxString CVolumeIndexMap::g_sRootVolumeIndex(_T("VolumeIndex"));
+
+CVolumeIndexMap CVolume::g_mapIndex;
+bool CVolume::g_bIndexLoaded = false;
+bool CVolume::g_bIndexModified = false;
+
 CVolume::CVolume(const wxString &sPath, bool bSetReadOnly)
 {
   m_bIgnoreReadLock = false;
   m_bNewVolume = false;
   m_bOK = true;
+  m_bLabLoaded = false;
+  m_bBookLoaded = false;
   m_nCountDown = 0;
   Load(sPath,bSetReadOnly);
 }
@@ -66,6 +75,10 @@ CVolume::CVolume()
 {
   m_bReadOnly = false;
   m_bOK = false;
+  m_bLabLoaded = false;
+  m_bBookLoaded = false;
+  m_dtLabMod.Set((time_t)0);
+  m_dtBookMod.Set((time_t)0);
   m_bIgnoreReadLock = false;
   m_bNewVolume = false;
   m_nCountDown = 0;
@@ -83,19 +96,6 @@ CVolume &CVolume::operator = (const CVolume &x)
 
 CVolume::~CVolume() {}
 
-wxString CVolume::GetKitName()
-{
-  wxString sRtn = m_lab.GetKitName();
-  return sRtn;
-}
-
-
-const wxString &CVolume::GetVolumeName()
-{
-  CLabSettingsInfo *p = m_lab.GetLabSettingsInfo();
-  return p->GetVolumeName();
-}
-
 wxString CVolume::_GetFilePath(const wxChar *pFileName) const
 {
   wxString sRtn;
@@ -127,20 +127,22 @@ wxString CVolume::GetLabSettingsFileName() const
 
 void CVolume::SetVolumeName(const wxString &s)
 {
-  if(IsOK() && !IsReadOnly() && HasLock())
+  if(IsOK() && !IsReadOnly() && HasLock() && _LoadLabSettings())
   {
     m_lab.GetLabSettingsInfo()->SetVolumeName(s);
+    m_sVolumeName = s;
   }
 }
 bool CVolume::InitNewVolume(const wxString &s)
 {
   bool bRtn = false;
   m_bIgnoreReadLock = true;
-  if(IsOK() && !IsReadOnly() && Lock())
+  if(IsOK() && !IsReadOnly() && Lock() && _LoadLabSettings())
   {
     CLabSettingsInfo *pInfo = m_lab.GetLabSettingsInfo();
     pInfo->SetNotes(_T(""));
     pInfo->SetVolumeName(s);
+    m_sVolumeName = s;
     bRtn = Save();
     m_bNewVolume = bRtn;
   }
@@ -153,18 +155,207 @@ bool CVolume::Load(const wxString &sPath, bool bSetReadOnly)
   m_sPath = sPath;
   m_bReadOnly = bSetReadOnly;
   m_bOK = true; // must be true for GetLabSettingsFileName() and GetMessageBookFileName()
-  m_bOK = m_lab.LoadFile(GetLabSettingsFileName())
-      && m_book.LoadFile(GetMessageBookFileName());
+  m_bLabLoaded = false;
+  m_bBookLoaded = false;
+  m_dtLabMod.Set((time_t)0);
+  m_dtBookMod.Set((time_t)0);
+  m_bOK = _LoadIndex();
   m_lockRead.SetFileName(GetAccessFileName());
   return m_bOK;
 }
 
+bool CVolume::_LoadIndex()
+{
+  // get the volume name and kit name from g_mapIndex if
+  // neither the lab settings file nor the message book has
+  // been modified since both were parsed, otherwise parse
+  // both now so that a volume with a broken file is not used
+  _LoadIndexFile();
+  wxString sFileName = GetLabSettingsFileName();
+  wxDateTime dtLabMod = _GetFileModTime(sFileName);
+  wxDateTime dtBookMod = _GetFileModTime(GetMessageBookFileName());
+  bool bRtn = (dtLabMod.GetTicks() > 0) && (dtBookMod.GetTicks() > 0);
+  if(bRtn)
+  {
+    const CVolumeIndex *pIndex = g_mapIndex.Find(sFileName);
+    if( (pIndex != NULL) &&
+      (pIndex->m_dtMod == dtLabMod) &&
+      (pIndex->m_dtBookMod == dtBookMod) )
+    {
+      m_sVolumeName = pIndex->m_sVolumeName;
+      m_sKitName = pIndex->m_sKitName;
+      m_dtLabMod = dtLabMod;
+      m_dtBookMod = dtBookMod;
+    }
+    else
+    {
+      if(pIndex != NULL)
+      {
+        _RemoveIndex();
+      }
+      m_bLabLoaded = false;
+      m_bBookLoaded = false;
+      m_dtBookMod.Set((time_t)0);
+      bRtn = _LoadLabSettings() && _LoadMessageBook();
+    }
+  }
+  return bRtn;
+}
+wxDateTime CVolume::_GetFileModTime(const wxString &sFileName)
+{
+  // zero if the file does not exist, whole seconds
+  // so that it compares equal to the time in the index file
+  wxFileName fn(sFileName);
+  wxDateTime dtRtn((time_t)0);
+  if(fn.FileExists())
+  {
+    dtRtn.Set(fn.GetModificationTime().GetTicks());
+  }
+  return dtRtn;
+}
+bool CVolume::_IsModified() const
+{
+  bool bRtn =
+    (_GetFileModTime(GetLabSettingsFileName()) != m_dtLabMod) ||
+    (_GetFileModTime(GetMessageBookFileName()) != m_dtBookMod);
+  return bRtn;
+}
+bool CVolume::_LoadLabSettings() const
+{
+  if(IsOK() && !m_bLabLoaded)
+  {
+    m_bLabLoaded = true;
+    m_bOK = m_lab.LoadFile(GetLabSettingsFileName());
+    if(m_bOK)
+    {
+      _UpdateIndex();
+    }
+    else
+    {
+      _RemoveIndex();
+    }
+  }
+  return IsOK();
+}
+bool CVolume::_LoadMessageBook() const
+{
+  if(IsOK() && !m_bBookLoaded)
+  {
+    m_bBookLoaded = true;
+    m_bOK = m_book.LoadFile(GetMessageBookFileName());
+    if(m_bOK)
+    {
+      m_dtBookMod = _GetFileModTime(GetMessageBookFileName());
+      _UpdateIndex();
+    }
+    else
+    {
+      _RemoveIndex();
+    }
+  }
+  return IsOK();
+}
+void CVolume::_UpdateIndex() const
+{
+  // called after m_lab or m_book is loaded or saved,
+  // the volume is indexed once both files have been parsed
+  if(m_bLabLoaded)
+  {
+    m_sVolumeName = m_lab.GetVolumeName();
+    m_sKitName = m_lab.GetKitName();
+    m_dtLabMod = _GetFileModTime(GetLabSettingsFileName());
+  }
+  if( (m_dtLabMod.GetTicks() > 0) && (m_dtBookMod.GetTicks() > 0) )
+  {
+    CVolumeIndex x;
+    x.SetKey(GetLabSettingsFileName());
+    x.m_sVolumeName = m_sVolumeName;
+    x.m_sKitName = m_sKitName;
+    x.m_dtMod = m_dtLabMod;
+    x.m_dtBookMod = m_dtBookMod;
+    const CVolumeIndex *pIndex = g_mapIndex.Find(x.GetKey());
+    if( (pIndex == NULL) || !((*pIndex) == x) )
+    {
+      g_mapIndex.InsertOrReplace(x);
+      g_bIndexModified = true;
+    }
+  }
+}
+void CVolume::_RemoveIndex() const
+{
+  // a file failed to parse, it is parsed again,
+  // and the volume excluded, the next time it is loaded
+  if(g_mapIndex.Delete(GetLabSettingsFileName()))
+  {
+    g_bIndexModified = true;
+  }
+}
+wxString CVolume::_GetIndexFileName()
+{
+  wxString sRtn = mainApp::GetConfig()->GetConfigPath();
+  nwxFileUtil::EndWithSeparator(&sRtn);
+  sRtn.Append(VOLUME_INDEX_FILE);
+  return sRtn;
+}
+void CVolume::_LoadIndexFile()
+{
+  // once, before the first volume is loaded
+  if(!g_bIndexLoaded)
+  {
+    g_bIndexLoaded = true;
+    wxString sFileName = _GetIndexFileName();
+    if( wxFileName::FileExists(sFileName) &&
+      !g_mapIndex.LoadFile(sFileName) )
+    {
+      // unreadable, every volume is parsed
+      // and the file is rewritten
+      g_mapIndex.Clear();
+      g_bIndexModified = true;
+    }
+  }
+}
+bool CVolume::SaveIndex()
+{
+  // write the index if it changed, without the entries
+  // of volumes that have been removed
+  bool bRtn = true;
+  if(g_bIndexLoaded)
+  {
+    vector<wxString> vsRemove;
+    CVolumeIndexMap::iterator itr;
+    for(itr = g_mapIndex.begin(); itr != g_mapIndex.end(); ++itr)
+    {
+      if(!wxFileName::FileExists(itr->first))
+      {
+        vsRemove.push_back(itr->first);
+      }
+    }
+    for(vector<wxString>::iterator itrs = vsRemove.begin();
+      itrs != vsRemove.end();
+      ++itrs)
+    {
+      g_mapIndex.Delete(*itrs);
+      g_bIndexModified = true;
+    }
+    if(g_bIndexModified)
+    {
+      bRtn = g_mapIndex.SaveFile(_GetIndexFileName());
+      g_bIndexModified = !bRtn;
+    }
+  }
+  return bRtn;
+}
+
 bool CVolume::Save()
 {
   bool bRtn = false;
-  if(IsOK() && !IsReadOnly() && HasLock())
+  if(IsOK() && !IsReadOnly() && HasLock() && _LoadLabSettings())
   {
     bRtn = m_lab.SaveFile(GetLabSettingsFileName());
+    if(bRtn)
+    {
+      _UpdateIndex();
+    }
   }
   return bRtn;
 }
@@ -172,6 +363,7 @@ bool CVolume::Save(const wxString &sPath)
 {
   wxString sPathSave(m_sPath);
   bool bRtn = false;
+  _LoadLabSettings(); // before m_sPath is changed
   m_sPath = sPath;
   if(IsOK() && !IsReadOnly() && Lock() && Save())
   {
@@ -192,19 +384,46 @@ bool CVolume::CheckReload(bool bForceReload)
   {} // not previously loaded
   else if(IsLocked() && !HasLock())
   {} // someone else has it locked, cannot load
+  else if(!m_bLabLoaded)
+  {
+    // not parsed yet, update the name and kit name if modified
+    if(bForceReload || _IsModified())
+    {
+      bRtn = _LoadIndex();
+      m_bOK = bRtn;
+    }
+  }
   else if(bForceReload)
   {
-    bRtn = m_lab.ReloadFile()
-        && m_book.LoadFile(GetMessageBookFileName());
+    bRtn = m_lab.ReloadFile() &&
+      ( (!m_bBookLoaded) ||
+        m_book.LoadFile(GetMessageBookFileName()) );
+    _UpdateReload(bRtn);
   }
-  else
+  else if(m_lab.CheckFileModification(true))
   {
-    bRtn = m_lab.CheckFileModification(true) &&
-      m_book.CheckReload();
+    bRtn = (!m_bBookLoaded) || m_book.CheckReload();
+    _UpdateReload(bRtn);
   }
   return bRtn;
 }
 
+void CVolume::_UpdateReload(bool bOK) const
+{
+  if(!bOK)
+  {
+    _RemoveIndex();
+  }
+  else
+  {
+    if(m_bBookLoaded)
+    {
+      m_dtBookMod = _GetFileModTime(GetMessageBookFileName());
+    }
+    _UpdateIndex();
+  }
+}
+
 bool CVolume::SetInUseOnTimer(int nms)
 {
   m_nCountDown -= nms;
@@ -315,6 +534,7 @@ wxString CVolume::GetPathPrefix(const wxString &_sDir)
 CVolumes::~CVolumes() 
 {
   _Cleanup();
+  CVolume::SaveIndex();
 }
 
 CVolumes::CVolumes() :
@@ -364,6 +584,7 @@ bool CVolumes::CheckReload(bool bForce)
   if(bReloadAll)
   {
     _Load();
+    CVolume::SaveIndex();
     if(wxDir::Exists(m_sDirVolume))
     {
       wxFileName fn(m_sDirVolume);
@@ -394,7 +615,7 @@ CVolume *CVolumes::Find(const wxString &sName)
     (pitr.first == pitr.second)
     ? NULL
     : pitr.first->second;
-  return pRtn;
+  return _SetInUse(pRtn);
 }
 
 size_t CVolumes::FindAll(
@@ -407,7 +628,7 @@ size_t CVolumes::FindAll(
   pvVol->clear();
   for(itr = pitr.first; itr != pitr.second; ++itr)
   {
-    pvVol->push_back(itr->second);
+    pvVol->push_back(_SetInUse(itr->second));
   }
   nRtn = pvVol->size();
   return nRtn;
@@ -472,7 +693,7 @@ CVolume *CVolumes::Create(
     else
     {
       _SetModified();
-      pRtn = apRtn.release();
+      pRtn = _SetInUse(apRtn.release());
     }
   }
   return pRtn;
@@ -492,6 +713,7 @@ bool CVolumes::Remove(CVolume *pVolume)
     if(!_HasFiles(pVolume->GetPath()))
     {
       bRtn = true;
+      m_setInUse.erase(pVolume);
       delete pVolume;
       m_mapVol.erase(itr);
       _SetModified();
@@ -545,6 +767,7 @@ bool CVolumes::Rename(CVolume *p,const wxString &_sNewName)
         itr = m_mapVol.insert(MapVolume::value_type(sOldName,p));
         if(itr == m_mapVol.end())
         {
+          m_setInUse.erase(p);
           delete p;
           m_sLastError.Append(_T("\nThis " Volume_string " has been removed from the list"));
         }
@@ -627,6 +850,7 @@ bool CVolumes::_HasFiles(const wxString &sDirName)
 void CVolumes::_Cleanup()
 {
   MapVolume::iterator itr;
+  m_setInUse.clear();
   for(itr = m_mapVol.begin();
     itr != m_mapVol.end();
     itr = m_mapVol.begin())
@@ -743,11 +967,13 @@ wxDirTraverseResult CVolumes::OnFile(const wxString &)
 }
 void CVolumes::RefreshLocks()
 {
-  for(MapVolume::iterator itr = m_mapVol.begin();
-    itr != m_mapVol.end();
+  // only a volume returned by Find(), FindAll(), or Create()
+  // can be locked
+  for(set<CVolume *>::iterator itr = m_setInUse.begin();
+    itr != m_setInUse.end();
     ++itr)
   {
-    itr->second->RefreshLock();
+    (*itr)->RefreshLock();
   }
 }
 
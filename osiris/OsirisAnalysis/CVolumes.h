@@ -46,16 +46,106 @@
 #include "nwx/nsstd.h"
 #include "nwx/nwxString.h"
 #include "nwx/nwxXmlPersist.h"
+#include "nwx/nwxXmlPersistCollections.h"
 #include "nwx/nwxLock.h"
 #include "CLabSettings.h"
 #include "CXMLmessageBook.h"
 
 //******************************************************  CVolume
 
+class CVolumeIndex : public nwxXmlPersist
+{
+  // volume name and kit name read from a lab settings file
+  // and the modification times of the file and of the message
+  // book when both were parsed without error, keyed by the
+  // lab settings file name
+public:
+  CVolumeIndex()
+  {
+    m_dtMod.Set((time_t)0);
+    m_dtBookMod.Set((time_t)0);
+    RegisterAll(true);
+  }
+  CVolumeIndex(const CVolumeIndex &x)
+  {
+    RegisterAll(true);
+    (*this) = x;
+  }
+  virtual ~CVolumeIndex() {}
+  CVolumeIndex &operator = (const CVolumeIndex &x)
+  {
+    m_sFileName = x.m_sFileName;
+    m_dtMod = x.m_dtMod;
+    m_dtBookMod = x.m_dtBookMod;
+    m_sVolumeName = x.m_sVolumeName;
+    m_sKitName = x.m_sKitName;
+    return *this;
+  }
+  bool operator == (const CVolumeIndex &x) const
+  {
+    bool bRtn = (m_sFileName == x.m_sFileName) &&
+      (m_dtMod == x.m_dtMod) &&
+      (m_dtBookMod == x.m_dtBookMod) &&
+      (m_sVolumeName == x.m_sVolumeName) &&
+      (m_sKitName == x.m_sKitName);
+    return bRtn;
+  }
+  const wxString &GetKey() const
+  {
+    return m_sFileName;
+  }
+  void SetKey(const wxString &s)
+  {
+    m_sFileName = s;
+  }
+  wxString m_sFileName;
+  wxDateTime m_dtMod;
+  wxDateTime m_dtBookMod;
+  wxString m_sVolumeName;
+  wxString m_sKitName;
+protected:
+  virtual void RegisterAll(bool = false)
+  {
+    RegisterWxString(_T("LabSettings"),&m_sFileName);
+    RegisterWxDateTime(_T("LabSettingsModTime"),&m_dtMod);
+    RegisterWxDateTime(_T("MessageBookModTime"),&m_dtBookMod);
+    RegisterWxString(_T("VolumeName"),&m_sVolumeName);
+    RegisterWxString(_T("KitName"),&m_sKitName);
+  }
+};
+
+class CVolumeIndexMap :
+  public TnwxXmlPersistMap<wxString,CVolumeIndex>
+{
+  // g_mapIndex, kept in volumeIndex.xml in the user's
+  // configuration directory so that the volumes are not
+  // parsed again each time OSIRIS starts
+public:
+  CVolumeIndexMap() :
+    TnwxXmlPersistMap<wxString,CVolumeIndex>(_T("Volume"))
+  {}
+  virtual ~CVolumeIndexMap()
+  {}
+  virtual const wxString &RootNode(void) const
+  {
+    return g_sRootVolumeIndex;
+  }
+private:
+  static const wxString g_sRootVolumeIndex;
+};
 
 class CVolume
 {
    // wrapper around a volume and manages CLabSettings
+   //
+   // Load() only reads the volume name and kit name, from
+   // g_mapIndex if neither the lab settings file nor the
+   // message book has been modified since both were last
+   // parsed.  Otherwise both are parsed by Load(), so a volume
+   // with a broken file is not OK.  An indexed volume parses
+   // its files on first access.  The index is read from the
+   // user's configuration directory the first time a volume
+   // is loaded and written back by SaveIndex().
 
 public:
   CVolume(const wxString &sPath, bool bSetReadOnly = false);
@@ -72,22 +162,32 @@ public:
   {
     return m_sPath;
   }
-  wxString GetKitName();
-  const wxString &GetVolumeName();
+  wxString GetKitName() const
+  {
+    return m_sKitName;
+  }
+  const wxString &GetVolumeName() const
+  {
+    return m_sVolumeName;
+  }
   CLabSettings *GetLabSettings()
   {
+    _LoadLabSettings();
     return &m_lab;
   }
   const CLabSettings *GetLabSettings() const
   {
+    _LoadLabSettings();
     return &m_lab;
   }
   const CXMLmessageBook *GetMessageBook()
   {
+    _LoadMessageBook();
     return &m_book;
   }
   const wxString &GetDataFileType() const
   {
+    _LoadLabSettings();
     return m_lab.GetLabSettingsInfo()->GetDataFileType();
   }
   wxString GetLabSettingsFileName() const;
@@ -147,20 +247,41 @@ public:
   }
 
   static wxString GetPathPrefix(const wxString &sDir);
+  static bool SaveIndex();
 private:
   void _InitError();
   wxString _GetFilePath(const wxChar *pFileName) const;
+  bool _LoadIndex();
+  bool _IsModified() const;
+  static wxDateTime _GetFileModTime(const wxString &sFileName);
+  bool _LoadLabSettings() const;
+  bool _LoadMessageBook() const;
+  void _UpdateIndex() const;
+  void _UpdateReload(bool bOK) const;
+  void _RemoveIndex() const;
+  static wxString _GetIndexFileName();
+  static void _LoadIndexFile();
   nwxLock m_lock;
   nwxLockRead m_lockRead;
-  CLabSettings m_lab;
-  CXMLmessageBook m_book;
+  mutable CLabSettings m_lab;
+  mutable CXMLmessageBook m_book;
   wxString m_sPath;
   wxString m_sLastError;
+  mutable wxString m_sVolumeName;
+  mutable wxString m_sKitName;
+  mutable wxDateTime m_dtLabMod;
+  mutable wxDateTime m_dtBookMod;
   int m_nCountDown;
   bool m_bReadOnly;
-  bool m_bOK;
+  mutable bool m_bOK;
+  mutable bool m_bLabLoaded;
+  mutable bool m_bBookLoaded;
   bool m_bIgnoreReadLock;
   bool m_bNewVolume;
+
+  static CVolumeIndexMap g_mapIndex;
+  static bool g_bIndexLoaded;
+  static bool g_bIndexModified;
 };
 
 typedef multimap<wxString, CVolume *,nwxStringLessNoCaseSort>
@@ -218,6 +339,7 @@ private:
   static const wxChar *g_psNames[]; // file names w/in volume
 
   MapVolume m_mapVol;
+  set<CVolume *> m_setInUse; // volumes returned by Find(), etc.
   map<wxString,CVolume *> m_mapKitVolume;
   mutable wxArrayString m_asKits;
   mutable wxArrayString m_asVolumeNames;
@@ -237,6 +359,14 @@ private:
   void _SetupKitVolumes();
   void _SetupPath();
   MapVolume::iterator _FindVolume(CVolume *pVolume);
+  CVolume *_SetInUse(CVolume *pVolume)
+  {
+    if(pVolume != NULL)
+    {
+      m_setInUse.insert(pVolume);
+    }
+    return pVolume;
+  }
   bool _BuildNewPath(const CVolume *pCopyFrom, wxString *psPath);
 
   void _SetErrorNameExists(const wxString &s);
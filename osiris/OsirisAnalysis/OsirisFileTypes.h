@@ -31,8 +31,10 @@
 #define __OSIRIS_FILE_TYPES_H__
 
 #define EXT_GRAPHIC ".plt"
+#define EXT_GRAPHIC_BINARY ".pltb"
 #define EXT_REPORT ".oar"
 #define EXT_REPORT_EDITED ".oer"
+#define EXT_REPORT_JOURNAL ".jnl"
 #define EXT_BATCH ".obr"
 #define EXT_CMF ".cmf"
 
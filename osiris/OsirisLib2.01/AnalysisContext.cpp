@@ -0,0 +1,251 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: AnalysisContext.cpp
+*
+*/
+//
+//  class AnalysisContext owns the state of one analysis (see AnalysisContext.h)
+//
+
+#include "AnalysisContext.h"
+#include "ParameterServer.h"
+#include "RGTextOutput.h"
+
+#include <math.h>
+
+
+//  The context current in each thread:  NULL until the thread makes one current, which means the default context
+
+#ifdef _WINDOWS
+static __declspec(thread) AnalysisContext* CurrentContext = NULL;
+#else
+static __thread AnalysisContext* CurrentContext = NULL;
+#endif
+
+AnalysisContext* AnalysisContext :: DefaultContext = NULL;
+
+
+AnalysisSettings :: AnalysisSettings () {
+
+	mTracePrequalification.noiseThreshold = 400.0;
+	mTracePrequalification.windowWidth = 9;
+	mTracePrequalification.lowHeightThreshold = 0.1;
+	mTracePrequalification.lowSlopeThreshold = 0.1;
+	mTracePrequalification.minSamplesForSlopeRegression = 4;
+	mTracePrequalification.defaultNoiseThreshold = 400.0;
+	mTracePrequalification.defaultWindowWidth = 9;
+
+	mLaneStandardChannel.minLaneStandardRFU = 150.0;
+	mLaneStandardChannel.maxLaneStandardRFU = -1.0;
+	mLaneStandardChannel.ILSStutterThreshold = 0.0;
+	mLaneStandardChannel.ILSAdenylationThreshold = 0.0;
+	mLaneStandardChannel.ILSFractionalFilter = -1.0;
+
+	mLadderChannel.minLadderRFU = 150.0;
+	mLadderChannel.maxLadderRFU = -1.0;
+	mLadderChannel.minInterlocusRFU = 150.0;
+
+	mSampleChannel.minSampleRFU = 150.0;
+	mSampleChannel.maxSampleRFU = -1.0;
+	mSampleChannel.minInterlocusRFU = 150.0;
+	mSampleChannel.sampleDetectionThreshold = 150.0;
+	mSampleChannel.UseOldBaselineEstimation = false;
+
+	mChannelData.MinDistanceBetweenPeaks = 1.5;
+	mChannelData.AveSecondsPerBP = 6.0;
+
+	mLocus.MinimumFractionOfAverageWidth = 0.5;
+	mLocus.MaximumMultipleOfAverageWidth = 2.0;
+	mLocus.MinimumFractionOfAveragePeak = 0.2;
+	mLocus.MaximumMultipleOfAveragePeak = -1.0;
+	mLocus.MinimumFractionOfAverageSampleWidth = 0.2;
+	mLocus.MaximumMultipleOfAverageSampleWidth = 3.0;
+	mLocus.MinimumFractionOfAverageSamplePeak = 0.2;
+	mLocus.MaximumMultipleOfAverageSamplePeak = -1.0;
+	mLocus.TestRatio = TRUE;
+	mLocus.HeterozygousImbalanceLimit = -1.0;
+	mLocus.MinBoundForHomozygote = -1.0;
+	mLocus.SampleStutterThreshold = 0.15;
+	mLocus.SamplePlusStutterThreshold = 0.05;
+	mLocus.SampleAdenylationThreshold = 0.3333;
+	mLocus.GridStutterThreshold = 0.15;
+	mLocus.GridAdenylationThreshold = 0.3333;
+	mLocus.SampleFractionalFilter = -1.0;
+	mLocus.GridFractionalFilter = -1.0;
+	mLocus.SamplePullupFractionalFilter = -1.0;
+	mLocus.GridPullupFractionalFilter = -1.0;
+	mLocus.ExpectRFUUnitsForHomozygoteBound = true;
+	mLocus.MaxResidualForAlleleCalls = -1.0;
+	mLocus.AlleleOverloadThreshold = -1.0;
+	mLocus.NoYForAMEL = false;
+
+	mDataSignal.SignalSpacing = 1.0;
+	mDataSignal.DebugFlag = FALSE;
+	mDataSignal.minHeight = 150.0;
+	mDataSignal.maxHeight = -1.0;
+
+	mSampledData.PeakFractionForFlatCurveTest = 0.25;
+	mSampledData.PeakLevelForFlatCurveTest = 60.0;
+	mSampledData.IgnoreNoiseAnalysisAboveDetectionInSmoothing = false;
+
+	mParametricCurve.FitTolerance = 0.999995;
+	mParametricCurve.TriggerForArtifactTest = 0.992;
+	mParametricCurve.MinimumFitThreshold = 0.99;
+	mParametricCurve.SigmaForSignature = 2.0;
+	mParametricCurve.AbsoluteMinimumFit = 0.85;
+
+	mGaussian.SigmaWidth = 10.0;
+	mGaussian.SampleSigmaWidth = 3.5;
+	mGaussian.NumberOfSteps = 50;
+
+	mNormalizedGaussian.SigmaTolerance = 1.5e-4;
+	mNormalizedGaussian.MaximumIterations = 5;
+
+	mDoubleGaussian.DefaultSigmaRatio = 4.5;
+	mDoubleGaussian.DefaultSqrtSigmaRatio = sqrt (mDoubleGaussian.DefaultSigmaRatio);
+
+	mSuperGaussian.NumberOfSteps = 50;
+	mSuperGaussian.SigmaWidth = 2.1;
+	mSuperGaussian.BlobDegree = 6;
+
+	mGaussianFitEngine.UseFastFit = false;
+
+	mCoreBioComponent.SearchByName = TRUE;
+	mCoreBioComponent.GaussianSignature = TRUE;
+	mCoreBioComponent.UseRawData = TRUE;
+	mCoreBioComponent.minBioIDForArtifacts = 0;
+
+	mTestCharacteristic.globalTestForNegative = false;
+
+	mDirectoryManager.DataFileType = "fsa";
+	mDirectoryManager.DataFileTypeWithDot = ".fsa";
+
+	mAnalysis.NumberOfJobs = 1;
+	mAnalysis.UseILSCache = false;
+	mAnalysis.ReadAhead = 0;
+	mAnalysis.WriteBehind = 0;
+
+	mNotice.MessageTrigger = 15;
+	mNotice.SeverityTrigger = 15;
+
+	mSmartMessage.SeverityTrigger = 15;
+
+	mSubsetSearch.NodeLimit = 0;
+
+	mTiming.mEnabled = false;
+	mTiming.mFormat = TIMINGNOFILE;
+	mTiming.mInOAR = false;
+}
+
+
+AnalysisNumbering :: AnalysisNumbering () : signalID (0), signalIDBase (0), signalIDOffset (0), CurrentMsgNumber (0),
+CurrentLinkNumber (0) {
+
+}
+
+
+AnalysisScratch :: AnalysisScratch () : OffScaleData (NULL), OffScaleDataLength (0), HeightFactor (1.0), FitWorkspace (NULL),
+FitWorkspaceSize (0), SearchLog (NULL), AlleleSearchByName (TRUE), TimingFile (NULL), TimingOARFile (NULL), TimingIsLadder (false), TimingSampleStart (0.0),
+Journal (NULL), MessageDebugFile (NULL), MessageDebugText (NULL) {
+
+	int i;
+
+	for (i=0; i<TIMINGNUMBEROFSTAGES; i++)
+		TimingSeconds [i] = 0.0;
+
+	for (i=0; i<TIMINGNUMBEROFCOUNTERS; i++)
+		TimingCounts [i] = 0;
+}
+
+
+AnalysisScratch :: ~AnalysisScratch () {
+
+	delete[] OffScaleData;
+	delete[] FitWorkspace;
+	ChannelArtifactTestNotices.ClearAndDelete ();
+
+	if (SearchLog != NULL)
+		fclose (SearchLog);
+
+	delete TimingFile;
+	delete TimingOARFile;
+	delete MessageDebugText;
+	delete MessageDebugFile;
+}
+
+
+
+AnalysisContext :: AnalysisContext () : mIsDefault (false), mParameterServer (NULL), mParameterServerReferenceCount (0) {
+
+	//  Numbering continues from the default context, which at startup includes the signals created by static initialization
+
+	mSettings = GetCurrentSettings ();
+	mNumbering = GetDefaultContext ()->mNumbering;
+}
+
+
+AnalysisContext :: AnalysisContext (bool isDefault) : mIsDefault (isDefault), mParameterServer (NULL),
+mParameterServerReferenceCount (0) {
+
+}
+
+
+AnalysisContext :: ~AnalysisContext () {
+
+	if (mIsDefault)
+		return;
+
+	//  The ParameterServer deletes its members from the context current when it is deleted
+
+	AnalysisContext* previous = CurrentContext;
+	CurrentContext = this;
+	ParameterServer::Kill ();
+	CurrentContext = (previous == this) ? NULL : previous;
+}
+
+
+void AnalysisContext :: MakeCurrent () {
+
+	CurrentContext = this;
+}
+
+
+AnalysisContext* AnalysisContext :: GetCurrentContext () {
+
+	if (CurrentContext == NULL)
+		return GetDefaultContext ();
+
+	return CurrentContext;
+}
+
+
+AnalysisContext* AnalysisContext :: GetDefaultContext () {
+
+	if (DefaultContext == NULL)
+		DefaultContext = new AnalysisContext (true);
+
+	return DefaultContext;
+}
@@ -0,0 +1,422 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: AnalysisContext.h
+*
+*/
+//
+//  class AnalysisContext owns the state of one analysis that the analysis classes used to keep in static members:  the settings
+//  (thresholds, curve fitting parameters, run options...), the loaded message book (SmartMessage tables, the message index of
+//  each SmartNotice type, export specifications and the initialization matrices), the ParameterServer, the message, link and
+//  signal numbering and the scratch state of the sample being analyzed.  STRLCAnalysis keeps the context in which it was set up
+//  and makes it current in its thread for each analysis; the CoreBioComponents, ChannelData and Loci it builds keep that context
+//  and read their settings from it.  The static accessors of the analysis classes, including the setters, are thin wrappers over
+//  the context current in the calling thread, which is the default context until the thread makes another one current.  So
+//  analyses in different contexts can be set up in one process and run in different threads.
+//
+//  A new context starts with a copy of the settings of the context current in the calling thread, the numbering of the default
+//  context and no message book.  State that belongs to an analysis is added here, to the struct of the class that uses it, and
+//  not as a static member of that class
+//
+
+#ifndef _ANALYSISCONTEXT_H_
+#define _ANALYSISCONTEXT_H_
+
+#include "rgstring.h"
+#include "rgdlist.h"
+#include "rghashtable.h"
+#include "AnalysisTiming.h"
+
+#include <vector>
+#include <stdio.h>
+
+using namespace std;
+
+class SmartMessage;
+class RGTextOutput;
+class SmartMessageJournal;
+class SmartMessagingObject;
+class ParameterServer;
+
+
+//
+//  The settings of each analysis class, by class.  A new context copies them from the context current in its thread
+//
+
+struct TracePrequalificationSettings {
+
+	double noiseThreshold;
+	int windowWidth;
+	double lowHeightThreshold;
+	double lowSlopeThreshold;
+	int minSamplesForSlopeRegression;
+	double defaultNoiseThreshold;
+	int defaultWindowWidth;
+};
+
+
+struct LaneStandardChannelSettings {
+
+	double minLaneStandardRFU;
+	double maxLaneStandardRFU;
+	double ILSStutterThreshold;
+	double ILSAdenylationThreshold;
+	double ILSFractionalFilter;
+};
+
+
+struct LadderChannelSettings {
+
+	double minLadderRFU;
+	double maxLadderRFU;
+	double minInterlocusRFU;
+};
+
+
+struct SampleChannelSettings {
+
+	double minSampleRFU;
+	double maxSampleRFU;
+	double minInterlocusRFU;
+	double sampleDetectionThreshold;
+	bool UseOldBaselineEstimation;
+};
+
+
+struct ChannelDataSettings {
+
+	double MinDistanceBetweenPeaks;
+	double AveSecondsPerBP;
+};
+
+
+struct LocusSettings {
+
+	double MinimumFractionOfAverageWidth;
+	double MaximumMultipleOfAverageWidth;
+	double MinimumFractionOfAveragePeak;
+	double MaximumMultipleOfAveragePeak;
+	double MinimumFractionOfAverageSampleWidth;
+	double MaximumMultipleOfAverageSampleWidth;
+	double MinimumFractionOfAverageSamplePeak;
+	double MaximumMultipleOfAverageSamplePeak;
+	Boolean TestRatio;
+	double HeterozygousImbalanceLimit;
+	double MinBoundForHomozygote;
+	double SampleStutterThreshold;
+	double SamplePlusStutterThreshold;
+	double SampleAdenylationThreshold;
+	double GridStutterThreshold;
+	double GridAdenylationThreshold;
+	double SampleFractionalFilter;
+	double GridFractionalFilter;
+	double SamplePullupFractionalFilter;
+	double GridPullupFractionalFilter;
+	bool ExpectRFUUnitsForHomozygoteBound;
+	double MaxResidualForAlleleCalls;
+	double AlleleOverloadThreshold;
+	bool NoYForAMEL;
+};
+
+
+struct DataSignalSettings {
+
+	double SignalSpacing;
+	Boolean DebugFlag;
+	double minHeight;
+	double maxHeight;
+};
+
+
+struct SampledDataSettings {
+
+	double PeakFractionForFlatCurveTest;
+	double PeakLevelForFlatCurveTest;
+	bool IgnoreNoiseAnalysisAboveDetectionInSmoothing;
+};
+
+
+struct ParametricCurveSettings {
+
+	double FitTolerance;
+	double TriggerForArtifactTest;
+	double MinimumFitThreshold;
+	double SigmaForSignature;
+	double AbsoluteMinimumFit;
+};
+
+
+struct GaussianSettings {
+
+	double SigmaWidth;
+	double SampleSigmaWidth;
+	int NumberOfSteps;
+};
+
+
+struct NormalizedGaussianSettings {
+
+	double SigmaTolerance;
+	int MaximumIterations;
+};
+
+
+struct DoubleGaussianSettings {
+
+	double DefaultSigmaRatio;
+	double DefaultSqrtSigmaRatio;
+};
+
+
+struct SuperGaussianSettings {
+
+	int NumberOfSteps;
+	double SigmaWidth;
+	int BlobDegree;
+};
+
+
+struct GaussianFitEngineSettings {
+
+	bool UseFastFit;
+};
+
+
+struct CoreBioComponentSettings {
+
+	Boolean SearchByName;
+	Boolean GaussianSignature;
+	Boolean UseRawData;
+	int minBioIDForArtifacts;
+};
+
+
+struct TestCharacteristicSettings {
+
+	bool globalTestForNegative;
+};
+
+
+struct MarkerSetSettings {
+
+	RGString UserLaneStandardName;
+};
+
+
+struct DirectoryManagerSettings {
+
+	RGString DataFileType;
+	RGString DataFileTypeWithDot;
+};
+
+
+struct AnalysisRunSettings {
+
+	RGString OverrideString;
+	RGString OutputSubDirectory;
+	RGString MsgBookBuildTime;
+	int NumberOfJobs;
+	bool UseILSCache;
+	int ReadAhead;
+	int WriteBehind;
+};
+
+
+struct NoticeSettings {
+
+	int MessageTrigger;
+	int SeverityTrigger;
+};
+
+
+struct SmartMessageSettings {
+
+	int SeverityTrigger;
+};
+
+
+struct SubsetSearchSettings {
+
+	long NodeLimit;
+};
+
+
+struct TimingSettings {
+
+	bool mEnabled;
+	int mFormat;
+	bool mInOAR;
+};
+
+
+struct AnalysisSettings {
+
+	AnalysisSettings ();	// the settings of the default context
+
+	TracePrequalificationSettings mTracePrequalification;
+	LaneStandardChannelSettings mLaneStandardChannel;
+	LadderChannelSettings mLadderChannel;
+	SampleChannelSettings mSampleChannel;
+	ChannelDataSettings mChannelData;
+	LocusSettings mLocus;
+	DataSignalSettings mDataSignal;
+	SampledDataSettings mSampledData;
+	ParametricCurveSettings mParametricCurve;
+	GaussianSettings mGaussian;
+	NormalizedGaussianSettings mNormalizedGaussian;
+	DoubleGaussianSettings mDoubleGaussian;
+	SuperGaussianSettings mSuperGaussian;
+	GaussianFitEngineSettings mGaussianFitEngine;
+	CoreBioComponentSettings mCoreBioComponent;
+	TestCharacteristicSettings mTestCharacteristic;
+	MarkerSetSettings mMarkerSet;
+	DirectoryManagerSettings mDirectoryManager;
+	AnalysisRunSettings mAnalysis;
+	NoticeSettings mNotice;
+	SmartMessageSettings mSmartMessage;
+	SubsetSearchSettings mSubsetSearch;
+	TimingSettings mTiming;
+};
+
+
+struct AnalysisMessageBook {
+
+	AnalysisMessageBook ();		// empty tables, as before any message book is loaded
+	~AnalysisMessageBook ();
+
+	void ClearTables ();		// the SmartMessage tables, which cannot be reloaded afterwards
+
+	RGHashTable* OverAllMessageTable;
+	RGDList OverAllMessageList;
+	int NumberOfMessageTables;
+	RGDList** MessageTables;
+	SmartMessage*** MessageArrays;
+	int* MessageArraySize;
+	int LastStage;
+	int** StageStartIndex;
+	int** StageEndIndex;
+	bool Initialized;
+	int* MessageValueArraySize;
+	RGString MsgBookText;
+	int DebugMode;
+
+	vector<int> NoticeIndex;		// by SmartNotice type (see SmartNotice::GetNoticeType)
+	vector<int> NoticeScope;
+	RGHashTable ExportSpecifications;
+
+	bool* DataSignalInitialMatrix;
+	bool* LocusInitialMatrix;
+	bool* BaseLocusInitialMatrix;
+	bool* ChannelDataInitialMatrix;
+	bool* CoreBioComponentInitialMatrix;
+	bool* AnalysisInitialMatrix;
+};
+
+
+struct AnalysisNumbering {
+
+	AnalysisNumbering ();
+
+	unsigned long signalID;
+	unsigned long signalIDBase;		// reported id's above base are shifted by offset (worker processes)
+	unsigned long signalIDOffset;
+	int CurrentMsgNumber;
+	int CurrentLinkNumber;
+};
+
+
+struct AnalysisScratch {
+
+	//  State built up by the analysis and the sample being analyzed
+
+	AnalysisScratch ();
+	~AnalysisScratch ();
+
+	bool* OffScaleData;
+	int OffScaleDataLength;
+	double HeightFactor;			// PeakInfoForClusters
+	double* FitWorkspace;			// GaussianFitEngine
+	int FitWorkspaceSize;			// in doubles
+	FILE* SearchLog;				// InnerProductSubsetSearch
+	RGDList ChannelArtifactTestNotices;	// CoreBioComponent
+	Boolean AlleleSearchByName;		// BaseAllele:  search allele lists by name or by curve number
+
+	RGFile* TimingFile;
+	RGFile* TimingOARFile;
+	RGString TimingSampleName;
+	bool TimingIsLadder;
+	double TimingSampleStart;
+	double TimingSeconds [TIMINGNUMBEROFSTAGES];
+	long TimingCounts [TIMINGNUMBEROFCOUNTERS];
+
+	vector<SmartMessagingObject*> DirectoryObjects;	// indexed by directory object id; ids are never reused
+	SmartMessageJournal* Journal;					// not owned
+	RGFile* MessageDebugFile;						// SmartMessage, when the message book turns on debug mode
+	RGTextOutput* MessageDebugText;
+};
+
+
+class AnalysisContext {
+
+public:
+	AnalysisContext ();		// the settings of the context current in this thread, the numbering of the default context, no message book
+	~AnalysisContext ();	// deletes the message book, ParameterServer and scratch state of this context
+
+	bool IsCurrent () const { return GetCurrentContext () == this; }
+	bool IsDefault () const { return mIsDefault; }
+	void MakeCurrent ();	// in the calling thread
+
+	AnalysisSettings& GetSettings () { return mSettings; }
+	AnalysisMessageBook& GetMessageBook () { return mMessageBook; }
+	AnalysisNumbering& GetNumbering () { return mNumbering; }
+	AnalysisScratch& GetScratch () { return mScratch; }
+
+	ParameterServer*& GetParameterServer () { return mParameterServer; }
+	int& GetParameterServerReferenceCount () { return mParameterServerReferenceCount; }
+
+	static AnalysisContext* GetCurrentContext ();	// of the calling thread
+	static AnalysisContext* GetDefaultContext ();
+
+	static AnalysisSettings& GetCurrentSettings () { return GetCurrentContext ()->mSettings; }
+	static AnalysisMessageBook& GetCurrentMessageBook () { return GetCurrentContext ()->mMessageBook; }
+	static AnalysisNumbering& GetCurrentNumbering () { return GetCurrentContext ()->mNumbering; }
+	static AnalysisScratch& GetCurrentScratch () { return GetCurrentContext ()->mScratch; }
+
+protected:
+	AnalysisContext (bool isDefault);
+
+	bool mIsDefault;
+	AnalysisSettings mSettings;
+	AnalysisMessageBook mMessageBook;
+	AnalysisNumbering mNumbering;
+	AnalysisScratch mScratch;
+	ParameterServer* mParameterServer;
+	int mParameterServerReferenceCount;
+
+	static AnalysisContext* DefaultContext;
+};
+
+
+#endif  /*  _ANALYSISCONTEXT_H_  */
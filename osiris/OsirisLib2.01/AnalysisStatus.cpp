@@ -0,0 +1,266 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: AnalysisStatus.cpp
+*
+*/
+
+#include "AnalysisStatus.h"
+#include "rgclient.h"
+
+#include <iostream>
+#include <string.h>
+
+
+const size_t AnalysisStatusMaxMessage = 8192;	// records sent at once; less than the RGServer receive buffer, so no continuation
+
+bool AnalysisStatus::mIsConnected = false;
+bool AnalysisStatus::mConsoleProgress = true;
+bool AnalysisStatus::mStopping = false;
+RGClient* AnalysisStatus::mClient = NULL;
+int AnalysisStatus::mServerId = 0;
+string AnalysisStatus::mQueue;
+int AnalysisStatus::mConnections = 0;
+
+#ifndef _WINDOWS
+pthread_mutex_t AnalysisStatus::mMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t AnalysisStatus::mCondition = PTHREAD_COND_INITIALIZER;
+pthread_t AnalysisStatus::mSender;
+#endif
+
+
+int AnalysisStatus :: Connect (const RGString& serverName) {
+
+	Disconnect ();
+	mConnections++;
+	RGString clientName;
+	clientName << "OsirisAnalysisStatus" << (unsigned long) GetCurrentProcessId () << "_" << mConnections;
+	mClient = new RGClient (clientName);
+
+	if (mClient->IsActive ())
+		mServerId = mClient->LocateServer (serverName);
+
+	if (!mClient->IsActive () || (mServerId <= 0)) {
+
+		delete mClient;
+		mClient = NULL;
+		mServerId = 0;
+		return -1;
+	}
+
+	mQueue = "";
+	mStopping = false;
+	mIsConnected = true;
+
+#ifndef _WINDOWS
+	if (pthread_create (&mSender, NULL, SenderThread, NULL) != 0) {
+
+		mIsConnected = false;
+		delete mClient;
+		mClient = NULL;
+		mServerId = 0;
+		return -1;
+	}
+#endif
+
+	return 0;
+}
+
+
+void AnalysisStatus :: Disconnect () {
+
+	if (mClient == NULL)
+		return;
+
+#ifndef _WINDOWS
+	pthread_mutex_lock (&mMutex);
+	mStopping = true;
+	pthread_cond_signal (&mCondition);
+	pthread_mutex_unlock (&mMutex);
+	pthread_join (mSender, NULL);
+#endif
+
+	delete mClient;
+	mClient = NULL;
+	mServerId = 0;
+	mIsConnected = false;
+	mQueue = "";
+}
+
+
+void AnalysisStatus :: ReportProgress (int filesProcessed, int totalFiles) {
+
+	double Progress = 100.0 * (double)filesProcessed / (double)totalFiles;
+
+	if (WriteConsoleProgress ())
+		cout << "Progress = " << Progress << "%." << endl;
+
+	if (!mIsConnected)
+		return;
+
+	string body;
+	body.append ((const char*) &Progress, sizeof (double));
+	body.append ((const char*) &filesProcessed, sizeof (int));
+	body.append ((const char*) &totalFiles, sizeof (int));
+	Queue (ANALYSISSTATUSPROGRESS, body);
+}
+
+
+void AnalysisStatus :: ReportSampleStarted (const RGString& fileName, int flags) {
+
+	if (!mIsConnected)
+		return;
+
+	string body;
+	body.append ((const char*) &flags, sizeof (int));
+	body.append (fileName.GetData (), fileName.Length ());
+	Queue (ANALYSISSTATUSSAMPLESTARTED, body);
+}
+
+
+void AnalysisStatus :: ReportSampleFinished (const RGString& fileName, int flags) {
+
+	if (!mIsConnected)
+		return;
+
+	string body;
+	body.append ((const char*) &flags, sizeof (int));
+	body.append (fileName.GetData (), fileName.Length ());
+	Queue (ANALYSISSTATUSSAMPLEFINISHED, body);
+}
+
+
+void AnalysisStatus :: ReportAnalysisFinished (int status) {
+
+	if (!mIsConnected)
+		return;
+
+	string body ((const char*) &status, sizeof (int));
+	Queue (ANALYSISSTATUSFINISHED, body);
+}
+
+
+#ifndef _WINDOWS
+
+void* AnalysisStatus :: SenderThread (void* unused) {
+
+	//  Sends the queued records, a message at a time, until Disconnect is called and the queue is empty or until the server
+	//  is gone
+
+	string message;
+	size_t length;
+	bool ok;
+	pthread_mutex_lock (&mMutex);
+
+	while (true) {
+
+		while (mQueue.empty () && !mStopping)
+			pthread_cond_wait (&mCondition, &mMutex);
+
+		if (mQueue.empty ())
+			break;
+
+		length = NextMessageLength (mQueue);
+		message = mQueue.substr (0, length);
+		mQueue.erase (0, length);
+		pthread_mutex_unlock (&mMutex);
+		ok = Send (message);
+		pthread_mutex_lock (&mMutex);
+
+		if (!ok) {
+
+			mIsConnected = false;
+			mQueue = "";
+			break;
+		}
+	}
+
+	pthread_mutex_unlock (&mMutex);
+	return NULL;
+}
+
+#endif
+
+
+void AnalysisStatus :: Queue (int type, const string& body) {
+
+	int length = (int) body.length ();
+	string record;
+	record.reserve (ANALYSISSTATUSHEADERLENGTH + length);
+	record.append ((const char*) &type, sizeof (int));
+	record.append ((const char*) &length, sizeof (int));
+	record.append (body);
+
+#ifdef _WINDOWS
+	//  No sender thread:  send now
+
+	if (!Send (record))
+		mIsConnected = false;
+#else
+	pthread_mutex_lock (&mMutex);
+
+	if (mIsConnected) {
+
+		mQueue.append (record);
+		pthread_cond_signal (&mCondition);
+	}
+
+	pthread_mutex_unlock (&mMutex);
+#endif
+}
+
+
+bool AnalysisStatus :: Send (const string& message) {
+
+	//  The receiving program replies to each message, but the reply is not used
+
+	int replyMax = 16;
+	unsigned char* reply = new unsigned char [replyMax];
+	int status = mClient->Send (mServerId, (unsigned char*) message.data (), reply, (int) message.length (), replyMax);
+	delete[] reply;
+	return (status == 0);
+}
+
+
+size_t AnalysisStatus :: NextMessageLength (const string& queue) {
+
+	//  Whole records, as many as fit in one message, but at least one
+
+	size_t total = 0;
+	int length;
+
+	while (total + ANALYSISSTATUSHEADERLENGTH <= queue.length ()) {
+
+		memcpy (&length, queue.data () + total + sizeof (int), sizeof (int));
+		size_t recordLength = ANALYSISSTATUSHEADERLENGTH + (size_t) length;
+
+		if ((total > 0) && (total + recordLength > AnalysisStatusMaxMessage))
+			break;
+
+		total += recordLength;
+	}
+
+	return total;
+}
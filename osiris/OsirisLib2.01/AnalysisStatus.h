@@ -0,0 +1,93 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: AnalysisStatus.h
+*
+*/
+//
+//  class AnalysisStatus sends the progress of the analysis, the file being analyzed and a summary of each finished file to the
+//  program that started the analysis, as binary records (see AnalysisStatusRecord.h), through an RGClient connection to that
+//  program's RGServer (input "StatusServer").  The analysis only queues records; on POSIX, a sender thread sends whatever is
+//  queued as one message, so the analysis does not wait for the receiving program to reply.  While connected, the "Progress = "
+//  console lines and the per-file console notices can be turned off (input "ConsoleProgress"); if the connection fails, they are
+//  written again
+//
+
+#ifndef _ANALYSISSTATUS_H_
+#define _ANALYSISSTATUS_H_
+
+#include "rgstring.h"
+#include "AnalysisStatusRecord.h"
+
+#include <string>
+
+#ifndef _WINDOWS
+#include <pthread.h>
+#endif
+
+using namespace std;
+
+class RGClient;
+
+
+class AnalysisStatus {
+
+public:
+	static int Connect (const RGString& serverName);	// 0, or -1 if the server cannot be found
+	static void Disconnect ();	// sends all queued records first
+	static bool IsConnected () { return mIsConnected; }
+
+	static void SetConsoleProgress (bool console) { mConsoleProgress = console; }
+	static bool WriteConsoleProgress () { return mConsoleProgress || !mIsConnected; }	// true if the per-file console lines are wanted
+
+	static void ReportProgress (int filesProcessed, int totalFiles);	// also writes the "Progress = " console line
+	static void ReportSampleStarted (const RGString& fileName, int flags);
+	static void ReportSampleFinished (const RGString& fileName, int flags);
+	static void ReportAnalysisFinished (int status);
+
+protected:
+	static bool mIsConnected;
+	static bool mConsoleProgress;
+	static bool mStopping;
+	static RGClient* mClient;
+	static int mServerId;
+	static string mQueue;	// records not yet sent
+	static int mConnections;	// for unique client names
+
+#ifndef _WINDOWS
+	static pthread_mutex_t mMutex;
+	static pthread_cond_t mCondition;
+	static pthread_t mSender;
+
+	static void* SenderThread (void* unused);
+#endif
+
+	static void Queue (int type, const string& body);
+	static bool Send (const string& message);	// false if the server is gone
+	static size_t NextMessageLength (const string& queue);
+};
+
+
+#endif  /*  _ANALYSISSTATUS_H_  */
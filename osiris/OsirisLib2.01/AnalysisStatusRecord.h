@@ -0,0 +1,55 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: AnalysisStatusRecord.h
+*
+*/
+//
+//  Layout of the status records that the analysis sends to the program that started it (see AnalysisStatus.h).  Each message
+//  holds one or more records; each record is an int type and an int body length (in bytes), followed by the body.  Both ends run
+//  on the same machine, so ints and doubles are in native byte order.  This header is also used by OsirisAnalysis, so it
+//  includes nothing
+//
+//  ANALYSISSTATUSPROGRESS:  double percent complete, int files processed, int total files
+//  ANALYSISSTATUSSAMPLESTARTED:  int flags (ANALYSISSTATUSLADDER only), file name (not terminated)
+//  ANALYSISSTATUSSAMPLEFINISHED:  int flags, file name (not terminated)
+//  ANALYSISSTATUSFINISHED:  int status returned by the analysis (negative on failure)
+//
+
+#ifndef _ANALYSISSTATUSRECORD_H_
+#define _ANALYSISSTATUSRECORD_H_
+
+enum AnalysisStatusRecordType { ANALYSISSTATUSPROGRESS = 1, ANALYSISSTATUSSAMPLESTARTED, ANALYSISSTATUSSAMPLEFINISHED,
+				ANALYSISSTATUSFINISHED };
+
+const int ANALYSISSTATUSSAMPLEOK = 1;			// sample (or ladder) was analyzed
+const int ANALYSISSTATUSPOSITIVECONTROL = 2;
+const int ANALYSISSTATUSNEGATIVECONTROL = 4;
+const int ANALYSISSTATUSLADDER = 8;
+
+const int ANALYSISSTATUSHEADERLENGTH = 2 * sizeof (int);
+
+
+#endif  /*  _ANALYSISSTATUSRECORD_H_  */
@@ -0,0 +1,390 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: AnalysisTiming.cpp
+*
+*/
+
+
+#include "AnalysisTiming.h"
+#include "xmlwriter.h"
+#include "AnalysisContext.h"
+
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+
+const char* AnalysisTiming::StageNames [TIMINGNUMBEROFSTAGES] = { "Total", "AnalyzeGrid", "AnalyzeGridLoci", "PrepareSample",
+	"PreliminaryAnalysis", "AnalyzeSampleLoci", "SmartMessageStage1", "SmartMessageStage2", "SmartMessageStage3",
+	"SmartMessageStage4", "SmartMessageStage5" };
+
+const char* AnalysisTiming::CounterNames [TIMINGNUMBEROFCOUNTERS] = { "DataIntervals", "CurveFits", "CurveFitEvaluations",
+	"ILSSearchNodes", "SmartMessages" };
+
+
+void AnalysisTiming :: SetFormat (int format) {
+
+	TimingSettings& settings = AnalysisContext::GetCurrentSettings ().mTiming;
+	settings.mFormat = format;
+	settings.mEnabled = (settings.mFormat != TIMINGNOFILE) || settings.mInOAR;
+}
+
+
+void AnalysisTiming :: SetInOAR (bool inOAR) {
+
+	TimingSettings& settings = AnalysisContext::GetCurrentSettings ().mTiming;
+	settings.mInOAR = inOAR;
+	settings.mEnabled = (settings.mFormat != TIMINGNOFILE) || settings.mInOAR;
+}
+
+
+bool AnalysisTiming :: IsEnabled () {
+
+	return AnalysisContext::GetCurrentSettings ().mTiming.mEnabled;
+}
+
+
+bool AnalysisTiming :: IsInOAR () {
+
+	return AnalysisContext::GetCurrentSettings ().mTiming.mInOAR;
+}
+
+
+RGFile* AnalysisTiming :: GetFile () {
+
+	return AnalysisContext::GetCurrentScratch ().TimingFile;
+}
+
+
+RGFile* AnalysisTiming :: GetOARFile () {
+
+	return AnalysisContext::GetCurrentScratch ().TimingOARFile;
+}
+
+
+void AnalysisTiming :: Count (int counter) {
+
+	AnalysisContext* context = AnalysisContext::GetCurrentContext ();
+
+	if (context->GetSettings ().mTiming.mEnabled)
+		context->GetScratch ().TimingCounts [counter]++;
+}
+
+
+void AnalysisTiming :: Count (int counter, long n) {
+
+	AnalysisContext* context = AnalysisContext::GetCurrentContext ();
+
+	if (context->GetSettings ().mTiming.mEnabled)
+		context->GetScratch ().TimingCounts [counter] += n;
+}
+
+
+void AnalysisTiming :: AddTime (int stage, double seconds) {
+
+	AnalysisContext::GetCurrentScratch ().TimingSeconds [stage] += seconds;
+}
+
+
+int AnalysisTiming :: OpenFiles (const RGString& fullPathBase, const RGString& fullPathTempOAR) {
+
+	TimingSettings& settings = AnalysisContext::GetCurrentSettings ().mTiming;
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+	int status = 0;
+	CloseFiles ();
+
+	if (settings.mFormat != TIMINGNOFILE) {
+
+		RGString fullPath = fullPathBase + ((settings.mFormat == TIMINGCSV) ? ".csv" : ".jsonl");
+		scratch.TimingFile = new RGFile (fullPath, "wt");
+
+		if (!scratch.TimingFile->isValid ()) {
+
+			cout << "Could not open timing file:  " << fullPath.GetData () << ".  Continuing..." << endl;
+			delete scratch.TimingFile;
+			scratch.TimingFile = NULL;
+			status = -1;
+		}
+
+		else if (settings.mFormat == TIMINGCSV)
+			WriteCSVHeader ();
+	}
+
+	if (settings.mInOAR) {
+
+		scratch.TimingOARFile = new RGFile (fullPathTempOAR, "wt");
+
+		if (!scratch.TimingOARFile->isValid ()) {
+
+			cout << "Could not open temporary timing file:  " << fullPathTempOAR.GetData () << ".  Continuing..." << endl;
+			delete scratch.TimingOARFile;
+			scratch.TimingOARFile = NULL;
+			status = -1;
+		}
+	}
+
+	return status;
+}
+
+
+void AnalysisTiming :: CloseFiles () {
+
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+
+	if (scratch.TimingFile != NULL) {
+
+		scratch.TimingFile->Flush ();
+		delete scratch.TimingFile;
+		scratch.TimingFile = NULL;
+	}
+
+	if (scratch.TimingOARFile != NULL) {
+
+		scratch.TimingOARFile->Flush ();
+		delete scratch.TimingOARFile;
+		scratch.TimingOARFile = NULL;
+	}
+}
+
+
+void AnalysisTiming :: BeginSample (const RGString& fileName, bool isLadder) {
+
+	TimingSettings& settings = AnalysisContext::GetCurrentSettings ().mTiming;
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+
+	if (!settings.mEnabled)
+		return;
+
+	int i;
+
+	for (i=0; i<TIMINGNUMBEROFSTAGES; i++)
+		scratch.TimingSeconds [i] = 0.0;
+
+	for (i=0; i<TIMINGNUMBEROFCOUNTERS; i++)
+		scratch.TimingCounts [i] = 0;
+
+	scratch.TimingSampleName = fileName;
+	scratch.TimingIsLadder = isLadder;
+	scratch.TimingSampleStart = Now ();
+}
+
+
+void AnalysisTiming :: FinishSample () {
+
+	TimingSettings& settings = AnalysisContext::GetCurrentSettings ().mTiming;
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+
+	if (settings.mEnabled)
+		scratch.TimingSeconds [TIMINGSAMPLE] = Now () - scratch.TimingSampleStart;
+}
+
+
+void AnalysisTiming :: WriteSample () {
+
+	TimingSettings& settings = AnalysisContext::GetCurrentSettings ().mTiming;
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+
+	if (!settings.mEnabled)
+		return;
+
+	if (scratch.TimingFile != NULL) {
+
+		if (settings.mFormat == TIMINGCSV)
+			WriteCSVRecord ();
+
+		else
+			WriteJSONRecord ();
+	}
+
+	if (scratch.TimingOARFile != NULL)
+		WriteOARRecord ();
+}
+
+
+double AnalysisTiming :: Now () {
+
+#ifdef _WIN32
+	LARGE_INTEGER count;
+	LARGE_INTEGER frequency;
+	QueryPerformanceCounter (&count);
+	QueryPerformanceFrequency (&frequency);
+	return (double)count.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timespec now;
+	clock_gettime (CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + 1.0e-9 * (double)now.tv_nsec;
+#endif
+}
+
+
+void AnalysisTiming :: WriteCSVHeader () {
+
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+	RGString line ("File,Type");
+	int i;
+
+	for (i=0; i<TIMINGNUMBEROFSTAGES; i++)
+		line << "," << StageNames [i] << "Ms";
+
+	for (i=0; i<TIMINGNUMBEROFCOUNTERS; i++)
+		line << "," << CounterNames [i];
+
+	line << "\n";
+	scratch.TimingFile->Write (line.GetData ());
+}
+
+
+void AnalysisTiming :: WriteCSVRecord () {
+
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+	RGString line = EscapeCSV (scratch.TimingSampleName);
+	int i;
+	line << (scratch.TimingIsLadder ? ",ladder" : ",sample");
+
+	for (i=0; i<TIMINGNUMBEROFSTAGES; i++)
+		line << "," << Milliseconds (scratch.TimingSeconds [i]);
+
+	for (i=0; i<TIMINGNUMBEROFCOUNTERS; i++)
+		line << "," << scratch.TimingCounts [i];
+
+	line << "\n";
+	scratch.TimingFile->Write (line.GetData ());
+}
+
+
+void AnalysisTiming :: WriteJSONRecord () {
+
+	//  One object per line, so that the records of worker processes can be appended in any number
+
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+	RGString line;
+	int i;
+	line << "{\"file\":\"" << EscapeJSON (scratch.TimingSampleName) << "\",\"type\":\"" << (scratch.TimingIsLadder ? "ladder" : "sample") << "\",\"ms\":{";
+
+	for (i=0; i<TIMINGNUMBEROFSTAGES; i++) {
+
+		if (i > 0)
+			line << ",";
+
+		line << "\"" << StageNames [i] << "\":" << Milliseconds (scratch.TimingSeconds [i]);
+	}
+
+	line << "},\"counts\":{";
+
+	for (i=0; i<TIMINGNUMBEROFCOUNTERS; i++) {
+
+		if (i > 0)
+			line << ",";
+
+		line << "\"" << CounterNames [i] << "\":" << scratch.TimingCounts [i];
+	}
+
+	line << "}}\n";
+	scratch.TimingFile->Write (line.GetData ());
+}
+
+
+void AnalysisTiming :: WriteOARRecord () {
+
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+	RGString text;
+	RGString pResult;
+	int i;
+	text << "\t\t<Sample>\n\t\t\t<Name>" << xmlwriter::EscAscii (scratch.TimingSampleName, &pResult) << "</Name>\n";
+	text << "\t\t\t<Type>" << (scratch.TimingIsLadder ? "ladder" : "sample") << "</Type>\n";
+
+	for (i=0; i<TIMINGNUMBEROFSTAGES; i++)
+		text << "\t\t\t<" << StageNames [i] << "Ms>" << Milliseconds (scratch.TimingSeconds [i]) << "</" << StageNames [i] << "Ms>\n";
+
+	for (i=0; i<TIMINGNUMBEROFCOUNTERS; i++)
+		text << "\t\t\t<" << CounterNames [i] << ">" << scratch.TimingCounts [i] << "</" << CounterNames [i] << ">\n";
+
+	text << "\t\t</Sample>\n";
+	scratch.TimingOARFile->Write (text.GetData ());
+}
+
+
+RGString AnalysisTiming :: Milliseconds (double seconds) {
+
+	char buffer [40];
+	sprintf (buffer, "%.3f", 1000.0 * seconds);
+	return RGString (buffer);
+}
+
+
+RGString AnalysisTiming :: EscapeJSON (const RGString& str) {
+
+	RGString result;
+	const char* p = str.GetData ();
+	char buffer [8];
+
+	for (; *p != '\0'; p++) {
+
+		if ((*p == '"') || (*p == '\\'))
+			result << "\\" << *p;
+
+		else if ((unsigned char)*p < 0x20) {
+
+			sprintf (buffer, "\\u%04x", (unsigned int)(unsigned char)*p);
+			result << buffer;
+		}
+
+		else
+			result << *p;
+	}
+
+	return result;
+}
+
+
+RGString AnalysisTiming :: EscapeCSV (const RGString& str) {
+
+	//  Quoted only if it contains a comma, a quote or a line break
+
+	if (strpbrk (str.GetData (), ",\"\r\n") == NULL)
+		return str;
+
+	RGString result ("\"");
+	const char* p = str.GetData ();
+
+	for (; *p != '\0'; p++) {
+
+		if (*p == '"')
+			result << "\"";
+
+		result << *p;
+	}
+
+	result << "\"";
+	return result;
+}
+
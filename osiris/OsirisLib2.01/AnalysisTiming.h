@@ -0,0 +1,121 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: AnalysisTiming.h
+*
+*/
+//
+//
+//  class AnalysisTiming shows where the time goes in an analysis (input "Timing" = "csv" or "json", and/or "TimingInOAR" =
+//  "true").  An AnalysisTimer at the top of each stage function adds the monotonic time spent in that stage to the current
+//  sample (or ladder), and the work counters (data intervals found, curve fits and their objective evaluations, ILS search nodes
+//  and smart messages evaluated) are incremented where the work is done.  Each sample's record is written when the sample is
+//  reported, so that records are in sample order even with worker processes:  a row of <OutputFileName>Timing.csv, or a line
+//  (one JSON object) of <OutputFileName>Timing.jsonl, and a <Sample> element of the <Timing> section of the .oar.  When timing
+//  is off, each timer and counter only tests a flag of the current context (see AnalysisContext.h), which holds the format,
+//  the files and the times and counts of the sample being analyzed.  The accessors are out of line because AnalysisContext.h
+//  includes this file for the stage and counter enumerations
+//
+
+#ifndef _ANALYSISTIMING_H_
+#define _ANALYSISTIMING_H_
+
+#include "rgstring.h"
+#include "rgfile.h"
+
+using namespace std;
+
+
+enum AnalysisTimingStage { TIMINGSAMPLE = 0, TIMINGANALYZEGRID, TIMINGANALYZEGRIDLOCI, TIMINGPREPARESAMPLE, TIMINGPRELIMINARYANALYSIS,
+				TIMINGANALYZESAMPLELOCI, TIMINGSMARTMESSAGESTAGE1, TIMINGSMARTMESSAGESTAGE2, TIMINGSMARTMESSAGESTAGE3,
+				TIMINGSMARTMESSAGESTAGE4, TIMINGSMARTMESSAGESTAGE5, TIMINGNUMBEROFSTAGES };
+
+enum AnalysisTimingCounter { TIMINGDATAINTERVALS = 0, TIMINGCURVEFITS, TIMINGCURVEFITEVALUATIONS, TIMINGILSSEARCHNODES,
+				TIMINGSMARTMESSAGES, TIMINGNUMBEROFCOUNTERS };
+
+enum AnalysisTimingFormat { TIMINGNOFILE = 0, TIMINGCSV, TIMINGJSON };
+
+
+class AnalysisTiming {
+
+public:
+	static void SetFormat (int format);
+	static void SetInOAR (bool inOAR);
+	static bool IsEnabled ();
+	static bool IsInOAR ();
+
+	static int OpenFiles (const RGString& fullPathBase, const RGString& fullPathTempOAR);	// base has no extension; -1 if a file could not be opened
+	static RGFile* GetFile ();
+	static RGFile* GetOARFile ();	// <Sample> elements, to be appended to the .oar inside <Timing>
+	static void CloseFiles ();
+
+	static void BeginSample (const RGString& fileName, bool isLadder);	// clears times and counts and starts the sample clock
+	static void FinishSample ();	// stops the sample clock
+	static void WriteSample ();
+
+	static void Count (int counter);
+	static void Count (int counter, long n);
+	static void AddTime (int stage, double seconds);
+	static double Now ();	// monotonic, in seconds
+
+protected:
+	static const char* StageNames [TIMINGNUMBEROFSTAGES];
+	static const char* CounterNames [TIMINGNUMBEROFCOUNTERS];
+
+	static void WriteCSVHeader ();
+	static void WriteCSVRecord ();
+	static void WriteJSONRecord ();
+	static void WriteOARRecord ();
+	static RGString Milliseconds (double seconds);
+	static RGString EscapeJSON (const RGString& str);
+	static RGString EscapeCSV (const RGString& str);
+};
+
+
+class AnalysisTimer {
+
+	//  Adds the time from construction to destruction to the stage of the current sample
+
+public:
+	AnalysisTimer (int stage) : mStage (stage), mRunning (AnalysisTiming::IsEnabled ()), mStart (0.0) {
+
+		if (mRunning)
+			mStart = AnalysisTiming::Now ();
+	}
+
+	~AnalysisTimer () {
+
+		if (mRunning)
+			AnalysisTiming::AddTime (mStage, AnalysisTiming::Now () - mStart);
+	}
+
+protected:
+	int mStage;
+	bool mRunning;
+	double mStart;
+};
+
+
+#endif  /*  _ANALYSISTIMING_H_  */
@@ -41,11 +41,6 @@
 #include "ChannelData.h"
 
 
-Boolean BaseAllele::SearchByName = TRUE;
-bool* BaseLocus::InitialMatrix = NULL;
-RGString BasePopulationMarkerSet::UserLaneStandardName;
-
-
 ABSTRACT_DEFINITION (BaseAllele)
 ABSTRACT_DEFINITION (BaseLocus)
 ABSTRACT_DEFINITION (BasePopulationMarkerSet)
@@ -158,7 +153,7 @@ int BaseAllele :: CompareTo (const RGPersistent* p) const {
 	BaseAllele* q = (BaseAllele*)p;
 	int tempID;
 
-	if (BaseAllele::SearchByName)
+	if (BaseAllele::SearchByName ())
 		return AlleleName.CompareTo (&(q->AlleleName));
 
 	tempID = Curve - q->Curve;
@@ -175,7 +170,7 @@ int BaseAllele :: CompareTo (const RGPersistent* p) const {
 
 unsigned BaseAllele :: HashNumber (unsigned long Base) const {
 
-	if (BaseAllele::SearchByName)
+	if (BaseAllele::SearchByName ())
 		return AlleleName.HashNumber (Base);
 
 	return Curve%Base;
@@ -187,7 +182,7 @@ Boolean BaseAllele :: IsEqualTo (const RGPersistent* p) const {
 
 	BaseAllele* q = (BaseAllele*)p;
 
-	if (BaseAllele::SearchByName)
+	if (BaseAllele::SearchByName ())
 		return AlleleName.IsEqualTo (&(q->AlleleName));
 
 	return (Curve == q->Curve);
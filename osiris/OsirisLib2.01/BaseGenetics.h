@@ -41,6 +41,7 @@
 #include "rghashtable.h"
 #include "rgdlist.h"
 #include "SmartMessagingObject.h"
+#include "AnalysisContext.h"
 
 
 class DataSignal;
@@ -66,8 +67,8 @@ public:
 	BaseAllele (const RGString& xmlInput);
 	virtual ~BaseAllele ();
 
-	static void SetSearchByName () { SearchByName = TRUE; }
-	static void SetSearchByCurve () { SearchByName = FALSE; }
+	static void SetSearchByName () { AnalysisContext::GetCurrentScratch ().AlleleSearchByName = TRUE; }
+	static void SetSearchByCurve () { AnalysisContext::GetCurrentScratch ().AlleleSearchByName = FALSE; }
 
 	Boolean IsValid () const { return Valid; }
 	RGString GetError () const { return Msg; }
@@ -102,7 +103,7 @@ protected:
 	RGString Msg;
 	int mRelativeHeight;
 
-	static Boolean SearchByName;
+	static Boolean SearchByName () { return AnalysisContext::GetCurrentScratch ().AlleleSearchByName; }
 };
 
 
@@ -211,7 +212,7 @@ public:
 
 	static void CreateInitializationData (int scope);
 	static void InitializeMessageMatrix (bool* matrix, int size);
-	static void ClearInitializationMatrix () { delete[] InitialMatrix; InitialMatrix = NULL; }
+	static void ClearInitializationMatrix ();
 	static int GetScope () { return 5; }
 
 	//***********************************************************************************************************************************************************
@@ -237,8 +238,6 @@ protected:
 	int mMaxExpectedAlleles;
 	int mMinExpectedAlleles;
 
-	static bool* InitialMatrix;
-
 //	RGHashTable AlleleListByName;   // items of type BaseAllele*
 //	RGHashTable AlleleListByCurve;   // items of type BaseAllele*
 //	RGDList AlleleList;
@@ -287,8 +286,8 @@ public:
 
 	virtual BaseLocus* GetNewLocus (const RGString& input);
 
-	static void SetUserLaneStandardName (const RGString& name) { UserLaneStandardName = name; }
-	static RGString GetUserLaneStandardName () { return UserLaneStandardName; }
+	static void SetUserLaneStandardName (const RGString& name) { Settings ().UserLaneStandardName = name; }
+	static RGString GetUserLaneStandardName () { return Settings ().UserLaneStandardName; }
 
 protected:
 	RGString MarkerSetName;
@@ -306,7 +305,7 @@ protected:
 	RGString Msg;
 	int* mChannelMap;
 //	CoordinateTransform** splineBPToTime;
-	static RGString UserLaneStandardName;
+	static MarkerSetSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mMarkerSet; }
 };
 
 
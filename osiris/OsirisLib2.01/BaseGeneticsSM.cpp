@@ -451,15 +451,16 @@ void BaseLocus :: CreateInitializationData (int scope) {
 	int size = SmartMessage::GetSizeOfArrayForScope (scope);
 	int i;
 	SmartMessage* msg;
-	delete[] InitialMatrix;
-	InitialMatrix = new bool [size];
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().BaseLocusInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = new bool [size];
 
 	for (i=0; i<size; i++) {
 
 		msg = SmartMessage::GetSmartMessageForScopeAndElement (scope, i);
 
 		if (msg != NULL)
-			InitialMatrix [i] = msg->GetInitialValue ();
+			initialMatrix [i] = msg->GetInitialValue ();
 	}
 }
 
@@ -467,9 +468,18 @@ void BaseLocus :: CreateInitializationData (int scope) {
 void BaseLocus :: InitializeMessageMatrix (bool* matrix, int size) {
 
 	int i;
+	bool* initialMatrix = AnalysisContext::GetCurrentMessageBook ().BaseLocusInitialMatrix;
 
 	for (i=0; i<size; i++)
-		matrix [i] = InitialMatrix [i];
+		matrix [i] = initialMatrix [i];
+}
+
+
+void BaseLocus :: ClearInitializationMatrix () {
+
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().BaseLocusInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = NULL;
 }
 
 
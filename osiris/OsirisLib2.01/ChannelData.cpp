@@ -50,10 +50,6 @@
 
 ABSTRACT_DEFINITION (ChannelData)
 
-double ChannelData::MinDistanceBetweenPeaks = 1.5;
-bool* ChannelData::InitialMatrix = NULL;
-double ChannelData::AveSecondsPerBP = 6.0;
-
 
 bool operator== (const RaisedBaseLineData& first, const RaisedBaseLineData& second) {
 
@@ -66,7 +62,8 @@ bool operator== (const RaisedBaseLineData& first, const RaisedBaseLineData& seco
 
 ChannelData :: ChannelData () : SmartMessagingObject (), mChannel (-1), mData (NULL), mBackupData (NULL),
 mTestPeak (NULL), Valid (FALSE), PreliminaryIterator (PreliminaryCurveList), CompleteIterator (CompleteCurveList), NumberOfAcceptedCurves (0), SetSize (0), MaxCorrelationIndex (0), 
-Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL), mLaneStandard (NULL), mDeleteLoci (false), mFsaChannel (-1), mBaseLine (NULL), mBaselineStart (-1) {
+Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL), mLaneStandard (NULL), mDeleteLoci (false), mFsaChannel (-1), mBaseLine (NULL), mBaselineStart (-1),
+mContext (AnalysisContext::GetCurrentContext ()) {
 
 	InitializeSmartMessages ();
 	//mNegativeCurveList.ClearAndDelete ();
@@ -75,7 +72,8 @@ Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL),
 
 ChannelData :: ChannelData (int channel) : SmartMessagingObject (), mChannel (channel), mData (NULL), mBackupData (NULL), 
 mTestPeak (NULL), Valid (FALSE), PreliminaryIterator (PreliminaryCurveList), CompleteIterator (CompleteCurveList), NumberOfAcceptedCurves (0), SetSize (0), MaxCorrelationIndex (0), 
-Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL), mLaneStandard (NULL), mDeleteLoci (false), mFsaChannel (channel), mBaseLine (NULL), mBaselineStart (-1) {
+Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL), mLaneStandard (NULL), mDeleteLoci (false), mFsaChannel (channel), mBaseLine (NULL), mBaselineStart (-1),
+mContext (AnalysisContext::GetCurrentContext ()) {
 
 	InitializeSmartMessages ();
 	//mNegativeCurveList.ClearAndDelete ();
@@ -84,7 +82,8 @@ Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL),
 
 ChannelData :: ChannelData (int channel, LaneStandard* inputLS) : SmartMessagingObject (), mChannel (channel), mData (NULL), mBackupData (NULL), 
 mTestPeak (NULL), Valid (FALSE), PreliminaryIterator (PreliminaryCurveList), CompleteIterator (CompleteCurveList), NumberOfAcceptedCurves (0), SetSize (0), MaxCorrelationIndex (0), 
-Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL), mLaneStandard (inputLS), mDeleteLoci (false), mFsaChannel (channel), mBaseLine (NULL), mBaselineStart (-1) {
+Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL), mLaneStandard (inputLS), mDeleteLoci (false), mFsaChannel (channel), mBaseLine (NULL), mBaselineStart (-1),
+mContext (AnalysisContext::GetCurrentContext ()) {
 
 	InitializeSmartMessages ();
 	//mNegativeCurveList.ClearAndDelete ();
@@ -94,7 +93,8 @@ Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL),
 ChannelData :: ChannelData (const ChannelData& cd) : SmartMessagingObject ((SmartMessagingObject&)cd), mChannel (cd.mChannel), mBackupData (NULL),
 Valid (cd.Valid), mTestPeak (cd.mTestPeak), PreliminaryIterator (PreliminaryCurveList), CompleteIterator (CompleteCurveList), NumberOfAcceptedCurves (cd.NumberOfAcceptedCurves),
 SetSize (cd.SetSize), MaxCorrelationIndex (cd.MaxCorrelationIndex), Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL), 
-mLaneStandard (NULL), mDeleteLoci (true), mFsaChannel (cd.mFsaChannel), mBaseLine (NULL), mBaselineStart (-1) {
+mLaneStandard (NULL), mDeleteLoci (true), mFsaChannel (cd.mFsaChannel), mBaseLine (NULL), mBaselineStart (-1),
+mContext (cd.mContext) {
 
 	mData = (DataSignal*)cd.mData->Copy ();
 	mLocusList = cd.mLocusList;
@@ -107,7 +107,8 @@ mLaneStandard (NULL), mDeleteLoci (true), mFsaChannel (cd.mFsaChannel), mBaseLin
 ChannelData :: ChannelData (const ChannelData& cd, CoordinateTransform* trans) : SmartMessagingObject ((SmartMessagingObject&)cd), mChannel (cd.mChannel), mBackupData (NULL),
 Valid (cd.Valid), mTestPeak (cd.mTestPeak), PreliminaryIterator (PreliminaryCurveList), CompleteIterator (CompleteCurveList), NumberOfAcceptedCurves (cd.NumberOfAcceptedCurves),
 SetSize (cd.SetSize), MaxCorrelationIndex (cd.MaxCorrelationIndex), 
-Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL), mLaneStandard (NULL), mDeleteLoci (true), mFsaChannel (cd.mFsaChannel), mBaseLine (NULL), mBaselineStart (-1) {
+Means (NULL), Sigmas (NULL), Fits (NULL), Peaks (NULL), SecondaryContent (NULL), mLaneStandard (NULL), mDeleteLoci (true), mFsaChannel (cd.mFsaChannel), mBaseLine (NULL), mBaselineStart (-1),
+mContext (cd.mContext) {
 
 	mData = NULL;
 	RGDList tempLocusList = cd.mLocusList;
@@ -776,7 +777,7 @@ int ChannelData :: FitAllCharacteristics (RGTextOutput& text, RGTextOutput& Exce
 	if (minAcceptableFit > minFit)
 		minFit = minAcceptableFit;
 
-	if (CoreBioComponent::GetGaussianSignature ())
+	if (mContext->GetSettings ().mCoreBioComponent.GaussianSignature)
 		signature = new NormalizedGaussian (0.0, ParametricCurve::GetSigmaForSignature ());
 
 	else
@@ -984,7 +985,7 @@ int ChannelData :: FinalTestForCriticalLaneStandardNotices () {
 
 int ChannelData :: SetAllApproximateIDs (ChannelData* laneStd) {
 
-	CoordinateTransform* globalSouthern = laneStd->GetIDMap ();
+	CTransformTable* globalSouthern = laneStd->GetIDTable ();
 
 	if (globalSouthern == NULL)
 		return -1;
@@ -1007,7 +1008,7 @@ int ChannelData :: SetAllApproximateIDs (ChannelData* laneStd) {
 		//if (mean > last)	// no longer "eliminate" peaks to right of ILS
 		//	break;
 
-		bp = globalSouthern->EvaluateWithExtrapolation (mean);
+		bp = globalSouthern->Evaluate (mean);
 //		ibp = (int) floor (bp + 0.5);
 //		nextSignal->SetApproximateBioID ((double) ibp);
 		nextSignal->SetApproximateBioID (bp);
@@ -1032,7 +1033,7 @@ int ChannelData :: SetAllApproximateIDs (ChannelData* laneStd) {
 		//if (mean > last)	// no longer "eliminate" peaks to right of ILS
 		//	break;
 
-		bp = globalSouthern->EvaluateWithExtrapolation (mean);
+		bp = globalSouthern->Evaluate (mean);
 		//ibp = (int) floor (bp + 0.5);
 		//nextSignal->SetApproximateBioID ((double) ibp);
 		nextSignal->SetApproximateBioID (bp);
@@ -1293,7 +1294,7 @@ int ChannelData :: RemoveSignalsOutsideLaneStandard (ChannelData* laneStandard)
 	double right = laneStandard->GetLastAnalyzedMean ();
 	double mean;
 
-	double minBioID = (double) CoreBioComponent::GetMinBioIDForArtifacts ();
+	double minBioID = (double) mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 	double approxBioID;
 
 	while (nextSignal = (DataSignal*) it()) {
@@ -1462,7 +1463,7 @@ int ChannelData :: TestArtifactListForNoticesWithinLaneStandard (ChannelData* la
 	double bp;
 	int ibp;
 	CoordinateTransform* transform = laneStandard->GetIDMap ();
-	double minID = (double)CoreBioComponent::GetMinBioIDForArtifacts ();
+	double minID = (double)mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 	double minReportTime; 
 	
 	if (minID > 0.0)
@@ -1994,6 +1995,12 @@ CoordinateTransform* ChannelData :: GetIDMap () {
 }
 
 
+CTransformTable* ChannelData :: GetIDTable () {
+
+	return NULL;
+}
+
+
 int ChannelData :: FindAndRemoveFixedOffset () {
 
 	return mData->FindAndRemoveFixedOffset ();
@@ -2735,70 +2742,82 @@ int ChannelData :: WriteLine (RGTextOutput& text, const RGString& delim, const D
 
 int ChannelData :: WriteRawData (RGTextOutput& text, const RGString& delim) {
 
-	if (mData == NULL)
-		return 0;
+	int numberOfPoints;
+	int* points = GetRawDataPoints (numberOfPoints);
+	WriteDataPoints (text, delim, points, numberOfPoints);
+	delete[] points;
+	return 0;
+}
 
-	int saveSamples = mData->GetNumberOfSamples () - 1;
-	
-	for (int j=0; j<saveSamples; j++) {
 
-		text << (int)floor (mData->Value (j)) << delim;
-	}
 
-	text << (int)floor (mData->Value (saveSamples));
+int ChannelData :: WriteFitData (RGTextOutput& text, const RGString& delim, bool useMaxValueMethod) {
+
+	int numberOfPoints;
+	int* points = GetFitDataPoints (numberOfPoints, useMaxValueMethod);
+	WriteDataPoints (text, delim, points, numberOfPoints);
+	delete[] points;
 	return 0;
 }
 
 
+int ChannelData :: WriteFitData (RGTextOutput& text, const RGString& delim, int numSamples, double left, double right, bool useMaxValueMethod) {
 
-int ChannelData :: WriteFitData (RGTextOutput& text, const RGString& delim, bool useMaxValueMethod) {
+	int numberOfPoints;
+	int* points = GetFitDataPoints (numberOfPoints, numSamples, left, right, useMaxValueMethod);
+	WriteDataPoints (text, delim, points, numberOfPoints);
+	delete[] points;
+	return 0;
+}
 
-	if (mData == NULL)
+
+int ChannelData :: WriteBaselineData (RGTextOutput& text, const RGString& delim, const RGString& indent) {
+
+	int numberOfPoints;
+	int* points = GetBaselineDataPoints (numberOfPoints);
+
+	if (points == NULL)
 		return 0;
 
-	int NSamples = mData->GetNumberOfSamples ();
+	Endl endLine;
+	text << indent << "<baselineStart>" << mBaselineStart << "</baselineStart>" << endLine;
+	text << indent << "<baselinePoints>";
+	WriteDataPoints (text, delim, points, numberOfPoints);
+	text << "</baselinePoints>" << endLine;
+	delete[] points;
+	return 1;
+}
 
-	DataSignal* FitCurve = new CompositeCurve (mData->LeftEndPoint (), mData->RightEndPoint (), CompleteCurveList);
-	DataSignal* FitData;
 
-	if (useMaxValueMethod) {
+int* ChannelData :: GetRawDataPoints (int& numberOfPoints) {
 
-		FitData = FitCurve->BuildSample (NSamples, mData->LeftEndPoint (), 1.0);
-	}
+	numberOfPoints = 0;
 
-	else {
+	if (mData == NULL)
+		return NULL;
 
-		FitCurve->ProjectNeighboringSignals (1.0, 1.0);
-		FitData = FitCurve->Digitize (NSamples, mData->LeftEndPoint (), 1.0);
-	}
+	numberOfPoints = mData->GetNumberOfSamples ();
+	int* points = new int [numberOfPoints];
 
-	//cout << "Prepared curve sets for output..." << endl;
-	int saveSamples = mData->GetNumberOfSamples () - 1;
-	int dataValue;
-	
-	for (int j=0; j<saveSamples; j++) {
+	for (int j=0; j<numberOfPoints; j++)
+		points [j] = (int)floor (mData->Value (j));
 
-		dataValue = (int)floor (FitData->Value (j));
+	return points;
+}
 
-		if (dataValue < 0)
-			dataValue = 0;
 
-		text << dataValue << delim;
-	}
+int* ChannelData :: GetFitDataPoints (int& numberOfPoints, bool useMaxValueMethod) {
 
-	dataValue = (int)floor (FitData->Value (saveSamples));
+	numberOfPoints = 0;
 
-	if (dataValue < 0)
-		dataValue = 0;
+	if (mData == NULL)
+		return NULL;
 
-	text << dataValue;
-	delete FitCurve;
-	delete FitData;
-	return 0;
+	return GetFitDataPoints (numberOfPoints, mData->GetNumberOfSamples (), mData->LeftEndPoint (), mData->RightEndPoint (), useMaxValueMethod);
 }
 
 
-int ChannelData :: WriteFitData (RGTextOutput& text, const RGString& delim, int numSamples, double left, double right, bool useMaxValueMethod) {
+int* ChannelData :: GetFitDataPoints (int& numberOfPoints, int numSamples, double left, double right, bool useMaxValueMethod) {
 
 	DataSignal* FitCurve = new CompositeCurve (left, right, CompleteCurveList);
 	DataSignal* FitData;
@@ -2815,53 +2834,71 @@ int ChannelData :: WriteFitData (RGTextOutput& text, const RGString& delim, int
 	}
 
 	//cout << "Prepared curve sets for output..." << endl;
-	int saveSamples = numSamples - 1;
+	numberOfPoints = numSamples;
+	int* points = new int [numberOfPoints];
 	int dataValue;
 	
-	for (int j=0; j<saveSamples; j++) {
+	for (int j=0; j<numberOfPoints; j++) {
 
 		dataValue = (int)floor (FitData->Value (j));
 
 		if (dataValue < 0)
 			dataValue = 0;
 
-		text << dataValue << delim;
+		points [j] = dataValue;
 	}
 
-	dataValue = (int)floor (FitData->Value (saveSamples));
-
-	if (dataValue < 0)
-		dataValue = 0;
-
-	text << dataValue;
 	delete FitCurve;
 	delete FitData;
-	return 0;
+	return points;
 }
 
 
-int ChannelData :: WriteBaselineData (RGTextOutput& text, const RGString& delim, const RGString& indent) {
+int* ChannelData :: GetBaselineDataPoints (int& numberOfPoints) {
+
+	//
+	//  Points from mBaselineStart on; there is always at least one
+	//
+
+	numberOfPoints = 0;
 
 	if (mBaseLine == NULL)
-		return 0;
+		return NULL;
 
-	Endl endLine;
-	text << indent << "<baselineStart>" << mBaselineStart << "</baselineStart>" << endLine;
 	int NSamples = mData->GetNumberOfSamples ();
 	int saveSamples = NSamples - 1;
 	int j;
-	text << indent << "<baselinePoints>";
+	int k = 0;
+
+	if (saveSamples > mBaselineStart)
+		numberOfPoints = saveSamples - mBaselineStart + 1;
+
+	else
+		numberOfPoints = 1;
+
+	int* points = new int [numberOfPoints];
 	double dynamicBaseline = mBaseLine->EvaluateSequenceStart (0.0, 1.0);
 	
 	for (j=mBaselineStart; j<saveSamples; j++) {
 
-		text << (int)floor (dynamicBaseline) << delim;
+		points [k++] = (int)floor (dynamicBaseline);
 		dynamicBaseline = mBaseLine->EvaluateSequenceNext ();
 	}
 
-	text << (int)floor (dynamicBaseline);
-	text << "</baselinePoints>" << endLine;
-	return 1;
+	points [k] = (int)floor (dynamicBaseline);
+	return points;
+}
+
+
+void ChannelData :: WriteDataPoints (RGTextOutput& text, const RGString& delim, const int* points, int numberOfPoints) {
+
+	int last = numberOfPoints - 1;
+
+	for (int j=0; j<last; j++)
+		text << points [j] << delim;
+
+	if (last >= 0)
+		text << points [last];
 }
 
 
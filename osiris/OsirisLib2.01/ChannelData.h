@@ -44,6 +44,7 @@
 #include "Notice.h"
 #include "SmartMessagingObject.h"
 #include "rgtptrdlist.h"
+#include "AnalysisContext.h"
 
 
 class SampleData;
@@ -124,6 +125,8 @@ public:
 
 	double GetFirstAnalyzedMean () const { if (Means != NULL) return Means [0]; return -DOUBLEMAX; }
 	double GetLastAnalyzedMean () const { if (Means != NULL) return Means [NumberOfAcceptedCurves-1]; return -DOUBLEMAX; }
+	const double* GetAnalyzedMeans () const { return Means; }
+	int GetNumberOfAnalyzedMeans () const { return NumberOfAcceptedCurves; }
 
 	RGDList& GetFinalCurveList () { return FinalCurveList; }
 	RGDList& GetMarginalCurveList () { return MarginalCurveList; }
@@ -160,6 +163,7 @@ public:
 	virtual double GetSecondaryContentAtTime (double t) const;
 	virtual double GetTimeForSpecifiedID (double id);
 	virtual CoordinateTransform* GetIDMap ();
+	virtual CTransformTable* GetIDTable ();	// same values as GetIDMap, by table lookup
 	virtual int FindAndRemoveFixedOffset ();
 	virtual int ProjectNeighboringSignalsAndTest (double horizontalResolution, double verticalTolerance);
 	
@@ -203,6 +207,13 @@ public:
 	virtual int WriteFitData (RGTextOutput& text, const RGString& delim, int numSamples, double left, double right, bool useMaxValueMethod = false);
 
 	virtual int WriteBaselineData (RGTextOutput& text, const RGString& delim, const RGString& indent);
+
+	int* GetRawDataPoints (int& numberOfPoints);	// the Get...Points functions return the points written by the Write...Data functions;
+	int* GetFitDataPoints (int& numberOfPoints, bool useMaxValueMethod = false);	// caller deletes[]
+	int* GetFitDataPoints (int& numberOfPoints, int numSamples, double left, double right, bool useMaxValueMethod = false);
+	int* GetBaselineDataPoints (int& numberOfPoints);	// NULL if no baseline; points start at GetBaselineStart ()
+	int GetBaselineStart () const { return mBaselineStart; }
+	static void WriteDataPoints (RGTextOutput& text, const RGString& delim, const int* points, int numberOfPoints);
 	
 	virtual int WriteLocusInfoToXML (RGTextOutput& text, const RGString& indent);
 
@@ -408,15 +419,17 @@ public:
 
 	friend CSplineTransform* TimeTransform (const ChannelData& cd1, const ChannelData& cd2);
 
-	static double GetMinimumDistanceBetweenPeaks () { return MinDistanceBetweenPeaks; }
-	static void SetMinimumDistanceBetweenPeaks (double distance) { MinDistanceBetweenPeaks = distance; }
+	AnalysisContext* GetContext () const { return mContext; }
+
+	static double GetMinimumDistanceBetweenPeaks () { return Settings ().MinDistanceBetweenPeaks; }
+	static void SetMinimumDistanceBetweenPeaks (double distance) { Settings ().MinDistanceBetweenPeaks = distance; }
 	static void CreateInitializationData (int scope);
 	static void InitializeMessageMatrix (bool* matrix, int size);
-	static void ClearInitializationMatrix () { delete[] InitialMatrix; InitialMatrix = NULL; }
+	static void ClearInitializationMatrix ();
 	static int GetScope () { return 3; }
 
-	static void SetAveSecondsPerBP (double s) { AveSecondsPerBP = s; }
-	static double GetAveSecondsPerBP () { return AveSecondsPerBP; }
+	static void SetAveSecondsPerBP (double s) { Settings ().AveSecondsPerBP = s; }
+	static double GetAveSecondsPerBP () { return Settings ().AveSecondsPerBP; }
 
 protected:
 	int mChannel;
@@ -467,9 +480,9 @@ protected:
 	CSplineTransform* mBaseLine;
 	int mBaselineStart;
 
-	static double MinDistanceBetweenPeaks;
-	static bool* InitialMatrix;
-	static double AveSecondsPerBP;
+	AnalysisContext* mContext;
+
+	static ChannelDataSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mChannelData; }
 };
 
 
@@ -1082,7 +1082,7 @@ int ChannelData :: FitAllCharacteristicsSM (RGTextOutput& text, RGTextOutput& Ex
 	if (minAcceptableFit > minFit)
 		minFit = minAcceptableFit;
 
-	if (CoreBioComponent::GetGaussianSignature ())
+	if (mContext->GetSettings ().mCoreBioComponent.GaussianSignature)
 		signature = new NormalizedGaussian (0.0, ParametricCurve::GetSigmaForSignature ());
 
 	else
@@ -1695,7 +1695,7 @@ int ChannelData :: RemoveSignalsOutsideLaneStandardSM (ChannelData* laneStandard
 	smPeakOutsideILS peakOutsideILS;
 	smPeakToRightOfILS peakToRightOfILS;
 	smTestRelativeBaselinePreset testRelativeBaselinePreset;
-	double reportMin = (double) CoreBioComponent::GetMinBioIDForArtifacts ();
+	double reportMin = (double) mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 	double reportMinTime = laneStandard->GetTimeForSpecifiedID (reportMin);
 	TestForRaisedBaselineAndExcessiveNoiseSM (left, reportMinTime);
 
@@ -2324,15 +2324,16 @@ void ChannelData :: CreateInitializationData (int scope) {
 	int size = SmartMessage::GetSizeOfArrayForScope (scope);
 	int i;
 	SmartMessage* msg;
-	delete[] InitialMatrix;
-	InitialMatrix = new bool [size];
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().ChannelDataInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = new bool [size];
 
 	for (i=0; i<size; i++) {
 
 		msg = SmartMessage::GetSmartMessageForScopeAndElement (scope, i);
 
 		if (msg != NULL)
-			InitialMatrix [i] = msg->GetInitialValue ();
+			initialMatrix [i] = msg->GetInitialValue ();
 	}
 }
 
@@ -2340,9 +2341,18 @@ void ChannelData :: CreateInitializationData (int scope) {
 void ChannelData :: InitializeMessageMatrix (bool* matrix, int size) {
 
 	int i;
+	bool* initialMatrix = AnalysisContext::GetCurrentMessageBook ().ChannelDataInitialMatrix;
 
 	for (i=0; i<size; i++)
-		matrix [i] = InitialMatrix [i];
+		matrix [i] = initialMatrix [i];
+}
+
+
+void ChannelData :: ClearInitializationMatrix () {
+
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().ChannelDataInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = NULL;
 }
 
 
@@ -50,17 +50,6 @@
 #include "DirectoryManager.h"
 
 
-Boolean CoreBioComponent::SearchByName = TRUE;
-Boolean CoreBioComponent::GaussianSignature = TRUE;
-Boolean CoreBioComponent::UseRawData = TRUE;
-RGDList CoreBioComponent::testChannelArtifactNoticeList;
-int CoreBioComponent::minBioIDForArtifacts = 0;
-bool* CoreBioComponent::InitialMatrix = NULL;
-bool* CoreBioComponent::OffScaleData = NULL;
-int CoreBioComponent::OffScaleDataLength = 0;
-
-
-
 ABSTRACT_DEFINITION (CoreBioComponent)
 
 /*
@@ -101,7 +90,7 @@ mPrint (print) {
 
 
 CoreBioComponent :: CoreBioComponent () : SmartMessagingObject (), mDataChannels (NULL), mNumberOfChannels (-1), mMarkerSet (NULL), 
-mLSData (NULL), mLaneStandard (NULL), mAssociatedGrid (NULL) {
+mLSData (NULL), mLaneStandard (NULL), mAssociatedGrid (NULL), mContext (AnalysisContext::GetCurrentContext ()) {
 
 	InitializeSmartMessages ();
 }
@@ -109,7 +98,7 @@ mLSData (NULL), mLaneStandard (NULL), mAssociatedGrid (NULL) {
 
 CoreBioComponent :: CoreBioComponent (const RGString& name) : SmartMessagingObject (), mName (name), 
 mDataChannels (NULL), mNumberOfChannels (-1), mMarkerSet (NULL), mLSData (NULL), mLaneStandard (NULL), 
-mAssociatedGrid (NULL) {
+mAssociatedGrid (NULL), mContext (AnalysisContext::GetCurrentContext ()) {
 
 	InitializeSmartMessages ();
 }
@@ -118,7 +107,7 @@ mAssociatedGrid (NULL) {
 CoreBioComponent :: CoreBioComponent (const CoreBioComponent& component) : SmartMessagingObject ((SmartMessagingObject&) component),
 mName (component.mName), mSampleName (component.mSampleName), mTime (component.mTime), mDate (component.mDate), mDataChannels (NULL), mNumberOfChannels (component.mNumberOfChannels), 
 mMarkerSet (NULL), mLaneStandardChannel (component.mLaneStandardChannel), mTest (NULL), mLSData (NULL), mLaneStandard (NULL), 
-mAssociatedGrid (component.mAssociatedGrid) {
+mAssociatedGrid (component.mAssociatedGrid), mContext (component.mContext) {
 
 	InitializeSmartMessages (component);
 }
@@ -127,7 +116,7 @@ mAssociatedGrid (component.mAssociatedGrid) {
 CoreBioComponent :: CoreBioComponent (const CoreBioComponent& component, CoordinateTransform* trans)  : SmartMessagingObject ((SmartMessagingObject&) component),
 mName (component.mName), mSampleName (component.mSampleName), mTime (component.mTime), mDate (component.mDate), mDataChannels (NULL), mNumberOfChannels (component.mNumberOfChannels), 
 mMarkerSet (NULL), mLaneStandardChannel (component.mLaneStandardChannel), mTest (NULL), mLSData (NULL), mLaneStandard (NULL), 
-mAssociatedGrid (component.mAssociatedGrid) {
+mAssociatedGrid (component.mAssociatedGrid), mContext (component.mContext) {
 
 	mDataChannels = new ChannelData* [mNumberOfChannels + 1];
 
@@ -1136,7 +1125,6 @@ CoreBioComponent* CoreBioComponent :: GetBestGridBasedOnMax2DerivForAnalysis (RG
 	RGDListIterator it (gridList);
 	CoreBioComponent* nextGrid;
 	CoreBioComponent* minGrid;
-	CSplineTransform* nextTrans;
 	double min2Deriv;
 	double current2Deriv;
 	smLadderFitThreshold ladderFitThreshold;
@@ -1146,27 +1134,26 @@ CoreBioComponent* CoreBioComponent :: GetBestGridBasedOnMax2DerivForAnalysis (RG
 	timeMap = NULL;
 	min2Deriv = DOUBLEMAX;
 
-	while (nextGrid = (CoreBioComponent*) it()) {
+	//  The transforms from this sample's ILS times to each ladder's share their knots, so the spline elimination is done once
+	//  (see CSplineCurvature in coordtrans.h).  A ladder is dropped as soon as one of its moments reaches the best maximum so
+	//  far, and only the selected ladder's transform is built
 
-		nextTrans = TimeTransform (*this, *nextGrid);
+	CSplineCurvature curvature (mLSData->GetAnalyzedMeans (), mLSData->GetNumberOfAnalyzedMeans ());
 
-		if (nextTrans == NULL)
-			continue;
+	while (nextGrid = (CoreBioComponent*) it()) {
 
-		current2Deriv = nextTrans->MaxSecondDerivative ();
+		current2Deriv = curvature.MaxSecondDerivative (nextGrid->mLSData->GetAnalyzedMeans (), min2Deriv);
 
 		if (current2Deriv < min2Deriv) {
 
 			min2Deriv = current2Deriv;
-			delete timeMap;
 			minGrid = nextGrid;
-			timeMap = nextTrans;
 		}
-
-		else
-			delete nextTrans;
 	}
 
+	if (minGrid != NULL)
+		timeMap = TimeTransform (*this, *minGrid);
+
 	cout << "Best grid for sample file " << (char*)mName.GetData () << " is ladder " << (char*)minGrid->GetSampleName ().GetData () << " with min 2nd deriv " << min2Deriv << "\n";
 	int scaledMin2Deriv = (int)ceil (min2Deriv * 1.0e6);
 	int threshold = GetThreshold (ladderFitThreshold);
@@ -1490,7 +1477,7 @@ int CoreBioComponent :: AnalyzeGrid (SampleData& fileData, GridDataStruct* gridD
 		return -1;
 	}
 
-	if (CoreBioComponent::UseRawData)
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData)
 		status = SetAllRawData (fileData, gridData->mTestControlPeak, gridData->mTestControlPeak);
 	
 	else		
@@ -1505,7 +1492,7 @@ int CoreBioComponent :: AnalyzeGrid (SampleData& fileData, GridDataStruct* gridD
 		return -2;
 	}
 
-	if (CoreBioComponent::UseRawData)
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData)
 		FindAndRemoveFixedOffsets ();
 
 	status = AnalyzeGrid (gridData->mText, gridData->mExcelText, gridData->mMsg);
@@ -1551,7 +1538,7 @@ int CoreBioComponent :: PrepareSampleForAnalysis (SampleData& fileData, SampleDa
 
 	Progress = 1;
 
-	if (CoreBioComponent::UseRawData)
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData)
 		status = SetAllRawData (fileData, sampleData->mTestControlPeak, sampleData->mTestSamplePeak);
 	
 	else		
@@ -1568,7 +1555,7 @@ int CoreBioComponent :: PrepareSampleForAnalysis (SampleData& fileData, SampleDa
 
 	Progress = 2;
 
-	if (CoreBioComponent::UseRawData) {
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData) {
 
 		status = FindAndRemoveFixedOffsets ();
 
@@ -1613,7 +1600,7 @@ int CoreBioComponent :: PrepareSampleForAnalysis (SampleData& fileData, SampleDa
 
 //			if (i != mLaneStandardChannel) {
 
-				mDataChannels [i]->TestArtifactListForNotices (CoreBioComponent::testChannelArtifactNoticeList);
+				mDataChannels [i]->TestArtifactListForNotices (mContext->GetScratch ().ChannelArtifactTestNotices);
 //			}
 
 //			MergeListAIntoListB (CoreBioComponent::testChannelArtifactNoticeList, NewNoticeList);
@@ -1650,7 +1637,7 @@ int CoreBioComponent :: PrepareSampleForAnalysis (SampleData& fileData, SampleDa
 
 //		if (j != mLaneStandardChannel) {
 
-			mDataChannels [j]->TestArtifactListForNoticesWithinLaneStandard (CoreBioComponent::testChannelArtifactNoticeList, mLSData);
+			mDataChannels [j]->TestArtifactListForNoticesWithinLaneStandard (mContext->GetScratch ().ChannelArtifactTestNotices, mLSData);
 //		}
 	}*/
 
@@ -1805,7 +1792,7 @@ int CoreBioComponent :: FilterNoticesBelowMinBioID () {
 	if (Progress < 4)
 		return 0;
 
-	int minBioID = CoreBioComponent::GetMinBioIDForArtifacts ();
+	int minBioID = mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 
 	if (minBioID <= 0)
 		return 0;
@@ -1905,7 +1892,7 @@ int CoreBioComponent :: CompareTo (const RGPersistent* p) const {
 
 	CoreBioComponent* q = (CoreBioComponent*) p;
 
-	if (CoreBioComponent::SearchByName) {
+	if (mContext->GetSettings ().mCoreBioComponent.SearchByName) {
 
 		return mName.CompareTo (&q->mName);
 	}
@@ -1916,7 +1903,7 @@ int CoreBioComponent :: CompareTo (const RGPersistent* p) const {
 
 unsigned CoreBioComponent :: HashNumber (unsigned long Base) const {
 
-	if (CoreBioComponent::SearchByName) {
+	if (mContext->GetSettings ().mCoreBioComponent.SearchByName) {
 
 		return mName.HashNumber (Base);
 	}
@@ -1929,7 +1916,7 @@ Boolean CoreBioComponent :: IsEqualTo (const RGPersistent* p) const {
 
 	CoreBioComponent* q = (CoreBioComponent*) p;
 
-	if (CoreBioComponent::SearchByName) {
+	if (mContext->GetSettings ().mCoreBioComponent.SearchByName) {
 
 		return mName.IsEqualTo (&q->mName);
 	}
@@ -2019,6 +2006,12 @@ int CoreBioComponent :: WriteFitDataForChannel (int channelNum, RGTextOutput& te
 }
 
 
+int* CoreBioComponent :: GetFitDataPointsForChannel (int channelNum, int& numberOfPoints, ChannelData* cd) {
+
+	return mDataChannels [channelNum]->GetFitDataPoints (numberOfPoints, cd->GetNumberOfSamples (), cd->GetLeftEndpoint (), cd->GetRightEndpoint (), false);
+}
+
+
 int CoreBioComponent :: WritePeakInfoToXMLForChannel (int channel, RGTextOutput& text, const RGString& indent, const RGString& tagName) {
 
 	mDataChannels [channel]->WritePeakInfoToXML (text, indent, tagName);
@@ -2047,7 +2040,11 @@ int CoreBioComponent :: WriteLocusInfoToXML (RGTextOutput& text, const RGString&
 
 bool CoreBioComponent :: TestForOffScale (double time) {
 
-	if ((OffScaleData == NULL) || (OffScaleDataLength == 0))
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+	bool* offScaleData = scratch.OffScaleData;
+	int offScaleDataLength = scratch.OffScaleDataLength;
+
+	if ((offScaleData == NULL) || (offScaleDataLength == 0))
 		return false;
 
 	int low = (int) floor (time);
@@ -2059,27 +2056,27 @@ bool CoreBioComponent :: TestForOffScale (double time) {
 	bool low1OffScale = false;
 	bool high1OffScale = false;
 
-	if ((low >= 0) && (low < OffScaleDataLength)) {
+	if ((low >= 0) && (low < offScaleDataLength)) {
 
-		if (OffScaleData [low])
+		if (offScaleData [low])
 			lowOffScale = true;
 	}
 
-	if ((high >= 0) && (high < OffScaleDataLength)) {
+	if ((high >= 0) && (high < offScaleDataLength)) {
 
-		if (OffScaleData [high])
+		if (offScaleData [high])
 			highOffScale = true;
 	}
 
-	if ((low1 >= 0) && (low1 < OffScaleDataLength)) {
+	if ((low1 >= 0) && (low1 < offScaleDataLength)) {
 
-		if (OffScaleData [low1])
+		if (offScaleData [low1])
 			low1OffScale = true;
 	}
 
-	if ((high1 >= 0) && (high1 < OffScaleDataLength)) {
+	if ((high1 >= 0) && (high1 < offScaleDataLength)) {
 
-		if (OffScaleData [high1])
+		if (offScaleData [high1])
 			high1OffScale = true;
 	}
 
@@ -2089,6 +2086,7 @@ bool CoreBioComponent :: TestForOffScale (double time) {
 
 int CoreBioComponent :: InitializeOffScaleData (SampleData& sd) {
 
+	AnalysisScratch& scratch = mContext->GetScratch ();
 	int nPoints;
 	const long* temp = sd.GetOffScaleData (nPoints);
 	int i;
@@ -2097,27 +2095,27 @@ int CoreBioComponent :: InitializeOffScaleData (SampleData& sd) {
 	if (temp == NULL) {
 
 		cout << "Could not retrieve offscale data for sample" << endl;
-		OffScaleData = NULL;
-		OffScaleDataLength = 0;
+		scratch.OffScaleData = NULL;
+		scratch.OffScaleDataLength = 0;
 		return -1;
 	}
 
 	if (nPoints <= 0)
-		OffScaleData = NULL;
+		scratch.OffScaleData = NULL;
 
 	else {
 
-		OffScaleData = new bool [OffScaleDataLength];
+		scratch.OffScaleData = new bool [scratch.OffScaleDataLength];
 
-		for (i=0; i<OffScaleDataLength; i++)
-			OffScaleData [i] = false;
+		for (i=0; i<scratch.OffScaleDataLength; i++)
+			scratch.OffScaleData [i] = false;
 
 		for (i=0; i<nPoints; i++) {
 
 			j = (int)temp [i];
 
-			if ((j >= 0) && (j < OffScaleDataLength))
-				OffScaleData [j] = true;
+			if ((j >= 0) && (j < scratch.OffScaleDataLength))
+				scratch.OffScaleData [j] = true;
 		}
 	}
 
@@ -2127,9 +2125,10 @@ int CoreBioComponent :: InitializeOffScaleData (SampleData& sd) {
 
 void CoreBioComponent :: ReleaseOffScaleData () {
 
-	delete [] OffScaleData;
-	OffScaleData = NULL;
-	OffScaleDataLength = 0;
+	AnalysisScratch& scratch = mContext->GetScratch ();
+	delete [] scratch.OffScaleData;
+	scratch.OffScaleData = NULL;
+	scratch.OffScaleDataLength = 0;
 }
 
 
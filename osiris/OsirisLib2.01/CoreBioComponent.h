@@ -49,6 +49,7 @@
 #include "coordtrans.h"
 #include "Notice.h"
 #include "SmartMessagingObject.h"
+#include "AnalysisContext.h"
 
 #include <list>
 
@@ -154,6 +155,7 @@ public:
 
 	virtual void WriteRawDataAndFitData (RGTextOutput& text, SampleData* data);
 	virtual int WriteFitDataForChannel (int channelNum, RGTextOutput& text, const RGString& delim, ChannelData* cd);
+	virtual int* GetFitDataPointsForChannel (int channelNum, int& numberOfPoints, ChannelData* cd);	// caller deletes[]
 	virtual int WriteLocusInfoToXML (RGTextOutput& text, const RGString& indent);
 
 	virtual CoreBioComponent* GetBestGridBasedOnTimeForAnalysis (RGDList& gridList);
@@ -367,31 +369,33 @@ public:
 
 	// Static and friend functions********************************************************************************************************
 
-	static void SetSearchByName () { SearchByName = TRUE; }
-	static void SetSearchByTime () { SearchByName = FALSE; }
+	AnalysisContext* GetContext () const { return mContext; }
 
-	static void SetGaussianSignature () { GaussianSignature = TRUE; }
-	static void SetOtherSignature () { GaussianSignature = FALSE; }
-	static Boolean GetGaussianSignature () { return GaussianSignature; }
+	static void SetSearchByName () { Settings ().SearchByName = TRUE; }
+	static void SetSearchByTime () { Settings ().SearchByName = FALSE; }
 
-	static void SetUseRawData () { UseRawData = TRUE; }
-	static void DontUseRawData () { UseRawData = FALSE; }
-	static Boolean GetUseRawData () { return UseRawData; }
+	static void SetGaussianSignature () { Settings ().GaussianSignature = TRUE; }
+	static void SetOtherSignature () { Settings ().GaussianSignature = FALSE; }
+	static Boolean GetGaussianSignature () { return Settings ().GaussianSignature; }
 
-	static void AddNoticeToChannelArtifactTestList (Notice* target) { testChannelArtifactNoticeList.Append (target); }
-	static void ClearAllTestNotices () { testChannelArtifactNoticeList.ClearAndDelete (); }
+	static void SetUseRawData () { Settings ().UseRawData = TRUE; }
+	static void DontUseRawData () { Settings ().UseRawData = FALSE; }
+	static Boolean GetUseRawData () { return Settings ().UseRawData; }
 
-	static int GetMinBioIDForArtifacts () { return minBioIDForArtifacts; }
-	static void SetMinBioIDForArtifacts (int minBioID) { minBioIDForArtifacts = minBioID; }
+	static void AddNoticeToChannelArtifactTestList (Notice* target) { AnalysisContext::GetCurrentScratch ().ChannelArtifactTestNotices.Append (target); }
+	static void ClearAllTestNotices () { AnalysisContext::GetCurrentScratch ().ChannelArtifactTestNotices.ClearAndDelete (); }
+
+	static int GetMinBioIDForArtifacts () { return Settings ().minBioIDForArtifacts; }
+	static void SetMinBioIDForArtifacts (int minBioID) { Settings ().minBioIDForArtifacts = minBioID; }
 
 	friend CSplineTransform* TimeTransform (const CoreBioComponent& cd1, const CoreBioComponent& cd2);
 	static void CreateInitializationData (int scope);
 	static void InitializeMessageMatrix (bool* matrix, int size);
-	static void ClearInitializationMatrix () { delete[] InitialMatrix; InitialMatrix = NULL; }
+	static void ClearInitializationMatrix ();
 	static int GetScope () { return 4; }
 	static bool TestForOffScale (double time);
 
-	static void SetOffScaleDataLength (int length) { OffScaleDataLength = length; }
+	static void SetOffScaleDataLength (int length) { AnalysisContext::GetCurrentScratch ().OffScaleDataLength = length; }
 
 	//************************************************************************************************************************************
 
@@ -436,17 +440,12 @@ protected:
 	//************************************************************************************************************************************
 	//************************************************************************************************************************************
 
-	static Boolean SearchByName;
-	static Boolean GaussianSignature;
-	static Boolean UseRawData;
-	static RGDList testChannelArtifactNoticeList;
-	static int minBioIDForArtifacts;
-	static bool* InitialMatrix;
-	static bool* OffScaleData;
-	static int OffScaleDataLength;
-
-	static int InitializeOffScaleData (SampleData& sd);
-	static void ReleaseOffScaleData ();
+	AnalysisContext* mContext;
+
+	static CoreBioComponentSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mCoreBioComponent; }
+
+	int InitializeOffScaleData (SampleData& sd);
+	void ReleaseOffScaleData ();
 
 
 	// Smart Message Functions************************************************************************************************************
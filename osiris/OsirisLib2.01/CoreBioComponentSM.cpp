@@ -50,6 +50,7 @@
 #include "STRSmartNotices.h"
 #include "TracePrequalification.h"
 #include "DirectoryManager.h"
+#include "AnalysisTiming.h"
 
 
 // Smart Message Functions**************************************************************************************************************
@@ -106,6 +107,7 @@ bool CoreBioComponent :: EvaluateSmartMessagesForStage (SmartMessagingComm& comm
 
 bool CoreBioComponent :: EvaluateSmartMessagesAndTriggersForStage (SmartMessagingComm& comm, int numHigherObjects, int stage, bool allMessages, bool signalsOnly) {
 
+	AnalysisTimer timer (TIMINGSMARTMESSAGESTAGE1 + stage - 1);
 	int i;
 	comm.SMOStack [numHigherObjects] = (SmartMessagingObject*) this;
 	int topNum = numHigherObjects + 1;
@@ -982,9 +984,34 @@ int CoreBioComponent :: SetAllRawDataWithMatrixSM (SampleData& fileData, TestCha
 		return SetAllRawDataSM (fileData, testControlPeak, testSamplePeak);
 	}
 
+	int numDataPoints;
+	double** correctedChannelData = fileData.GetColorCorrectedRawData (matrix, mNumberOfChannels, numDataPoints);
+
+	if (correctedChannelData != NULL) {
+
+		//  Decoded and corrected in one pass over the file data; the channels own the arrays
+
+		delete[] matrix;
+
+		for (i=1; i<=mNumberOfChannels; i++) {
+
+			if (mDataChannels [i]->SetRawDataFromColorCorrectedArraySM (correctedChannelData [i], numDataPoints, testControlPeak, testSamplePeak) < 0) {
+
+				ErrorString << mDataChannels [i]->GetError ();
+				status = -1;
+			}
+		}
+
+		delete[] correctedChannelData;
+
+		if (status == 0)
+			Progress = 2;
+
+		return status;
+	}
+
 	double* matrixBase = matrix;
 	double** rawChannelData = new double* [mNumberOfChannels + 1];
-	int numDataPoints;
 	double sum;
 
 	for (i=1; i<=mNumberOfChannels; i++) {
@@ -1009,7 +1036,7 @@ int CoreBioComponent :: SetAllRawDataWithMatrixSM (SampleData& fileData, TestCha
 		return status;
 	}
 	
-	double** correctedChannelData = new double* [mNumberOfChannels + 1];
+	correctedChannelData = new double* [mNumberOfChannels + 1];
 
 	for (i=1; i<=mNumberOfChannels; i++)
 		correctedChannelData [i] = new double [numDataPoints];
@@ -1261,6 +1288,7 @@ int CoreBioComponent :: AnalyzeGridSM (SampleData& fileData, GridDataStruct* gri
 	//  This is ladder stage 1
 	//
 
+	AnalysisTimer timer (TIMINGANALYZEGRID);
 	Endl endLine;
 	RGString Notice;
 	smTestForColorCorrectionMatrixPreset testForColorCorrectionMatrixPreset;
@@ -1275,7 +1303,7 @@ int CoreBioComponent :: AnalyzeGridSM (SampleData& fileData, GridDataStruct* gri
 		return -1;
 	}
 
-	if (CoreBioComponent::UseRawData) {
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData) {
 
 		if (GetMessageValue (testForColorCorrectionMatrixPreset))
 			status = SetAllRawDataWithMatrixSM (fileData, gridData->mTestControlPeak, gridData->mTestControlPeak);
@@ -1296,7 +1324,7 @@ int CoreBioComponent :: AnalyzeGridSM (SampleData& fileData, GridDataStruct* gri
 		return -2;
 	}
 
-	if (CoreBioComponent::UseRawData)
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData)
 		FindAndRemoveFixedOffsets ();
 
 	status = AnalyzeGridSM (gridData->mText, gridData->mExcelText, gridData->mMsg);
@@ -1321,6 +1349,7 @@ int CoreBioComponent :: PrepareSampleForAnalysisSM (SampleData& fileData, Sample
 	//  This is sample stage 1
 	//
 
+	AnalysisTimer timer (TIMINGPREPARESAMPLE);
 	Endl endLine;
 
 	smTestForColorCorrectionMatrixPreset testForColorCorrectionMatrixPreset;
@@ -1351,7 +1380,7 @@ int CoreBioComponent :: PrepareSampleForAnalysisSM (SampleData& fileData, Sample
 
 	Progress = 1;
 
-	if (CoreBioComponent::UseRawData) {
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData) {
 
 		if (GetMessageValue (testForColorCorrectionMatrixPreset))
 			status = SetAllRawDataWithMatrixSM (fileData, sampleData->mTestControlPeak, sampleData->mTestSamplePeak);
@@ -1375,7 +1404,7 @@ int CoreBioComponent :: PrepareSampleForAnalysisSM (SampleData& fileData, Sample
 	CoreBioComponent::InitializeOffScaleData (fileData);
 	Progress = 2;
 
-	if (CoreBioComponent::UseRawData) {
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData) {
 
 		status = FindAndRemoveFixedOffsets ();
 
@@ -1632,7 +1661,7 @@ int CoreBioComponent :: FilterSmartNoticesBelowMinBioID () {
 	if (Progress < 4)
 		return 0;
 
-	int minBioID = CoreBioComponent::GetMinBioIDForArtifacts ();
+	int minBioID = mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 
 	if (minBioID <= 0)
 		return 0;
@@ -1676,6 +1705,7 @@ int CoreBioComponent :: PreliminarySampleAnalysisSM (RGDList& gridList, SampleDa
 	//  This is sample stage 1
 	//
 
+	AnalysisTimer timer (TIMINGPRELIMINARYANALYSIS);
 	smAssociatedLadderIsCritical associatedLadderIsCritical;
 
 //	CoreBioComponent* grid = GetBestGridBasedOnTimeForAnalysis (gridList);
@@ -1713,6 +1743,7 @@ int CoreBioComponent :: PreliminarySampleAnalysisSM (RGDList& gridList, SampleDa
 	RemoveAllSignalsOutsideLaneStandardSM ();
 //	ValidateAndCorrectCrossChannelAnalysesSM ();
 	int status = AssignSampleCharacteristicsToLociSM (grid, timeMap);
+	delete timeMap;
 
 	return status;
 }
@@ -1792,15 +1823,16 @@ void CoreBioComponent :: CreateInitializationData (int scope) {
 	int size = SmartMessage::GetSizeOfArrayForScope (scope);
 	int i;
 	SmartMessage* msg;
-	delete[] InitialMatrix;
-	InitialMatrix = new bool [size];
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().CoreBioComponentInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = new bool [size];
 
 	for (i=0; i<size; i++) {
 
 		msg = SmartMessage::GetSmartMessageForScopeAndElement (scope, i);
 
 		if (msg != NULL)
-			InitialMatrix [i] = msg->GetInitialValue ();
+			initialMatrix [i] = msg->GetInitialValue ();
 	}
 }
 
@@ -1808,9 +1840,18 @@ void CoreBioComponent :: CreateInitializationData (int scope) {
 void CoreBioComponent :: InitializeMessageMatrix (bool* matrix, int size) {
 
 	int i;
+	bool* initialMatrix = AnalysisContext::GetCurrentMessageBook ().CoreBioComponentInitialMatrix;
 
 	for (i=0; i<size; i++)
-		matrix [i] = InitialMatrix [i];
+		matrix [i] = initialMatrix [i];
+}
+
+
+void CoreBioComponent :: ClearInitializationMatrix () {
+
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().CoreBioComponentInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = NULL;
 }
 
 
@@ -43,11 +43,13 @@ PERSISTENT_DEFINITION(NoiseInterval, _NOISEINTERVAL_, "NoiseInterval")
 
 
 DataInterval :: DataInterval () : RGPersistent (), Left (0), Right (0), Center (0), Mass (0.0), Height (0.0),
-Mode (0), MaxAtMode (-DOUBLEMAX), FixedLeft (FALSE), FixedRight (FALSE), mPureMinimum (FALSE) {}
+Mode (0), MaxAtMode (-DOUBLEMAX), FixedLeft (FALSE), FixedRight (FALSE), LeftMinimum (0.0), RightMinimum (0.0),
+mNumberOfMinima (0), mLocalMinimum (0), mLocalMinValue (0.0), mSecondaryMode (0), mMaxAtSecondaryMode (0.0), mPureMinimum (FALSE) {}
 
 
 DataInterval :: DataInterval (int left, int center, int right) : RGPersistent (), Left (left), Right (right), 
-Center (center), Mass (0.0), Height (0.0), Mode (0), MaxAtMode (-DOUBLEMAX), FixedLeft (FALSE), FixedRight (FALSE), mPureMinimum (FALSE) {}
+Center (center), Mass (0.0), Height (0.0), Mode (0), MaxAtMode (-DOUBLEMAX), FixedLeft (FALSE), FixedRight (FALSE), LeftMinimum (0.0), RightMinimum (0.0),
+mNumberOfMinima (0), mLocalMinimum (0), mLocalMinValue (0.0), mSecondaryMode (0), mMaxAtSecondaryMode (0.0), mPureMinimum (FALSE) {}
 
 
 DataInterval :: ~DataInterval () {}
@@ -50,40 +50,11 @@
 #include "SmartMessage.h"
 #include "STRSmartNotices.h"
 #include "OsirisPosix.h"
+#include "SignalKernels.h"
+#include "GaussianFitEngine.h"
+#include "AnalysisTiming.h"
 
 
-
-double PeakInfoForClusters::HeightFactor = 1.0;
-Boolean DataSignal :: DebugFlag = FALSE;
-double DataSignal :: SignalSpacing = 1.0;
-double DataSignal :: minHeight = 150.0;
-double DataSignal :: maxHeight = -1.0;
-unsigned long DataSignal :: signalID = 0;
-bool* DataSignal::InitialMatrix = NULL;
-
-double SampledData::PeakFractionForFlatCurveTest = 0.25;
-double SampledData::PeakLevelForFlatCurveTest = 60.0;
-bool SampledData::IgnoreNoiseAnalysisAboveDetectionInSmoothing = false;
-
-double ParametricCurve::FitTolerance = 0.999995;
-double ParametricCurve::TriggerForArtifactTest = 0.992;
-double ParametricCurve::MinimumFitThreshold = 0.99;
-double ParametricCurve::SigmaForSignature = 2.0;
-double ParametricCurve::AbsoluteMinimumFit = 0.85;
-
-double Gaussian :: SigmaWidth = 10.0;
-double Gaussian :: SampleSigmaWidth = 3.5;
-int Gaussian :: NumberOfSteps = 50;
-
-int NormalizedGaussian::MaximumIterations = 5;
-double NormalizedGaussian::SigmaTolerance = 1.5e-4;
-
-double DoubleGaussian :: DefaultSigmaRatio = 4.5;
-double DoubleGaussian :: DefaultSqrtSigmaRatio = sqrt (DoubleGaussian::DefaultSigmaRatio);
-
-int SuperGaussian :: NumberOfSteps = 50;
-double SuperGaussian :: SigmaWidth = 2.1;
-
 double SuperGaussian :: SuperNorms [8] = {1.785928938266120E+00,
 1.812804952863950E+00,
 1.836337486880030E+00,
@@ -114,8 +85,6 @@ double SuperGaussian :: RootTwos [8] = {1.259921049894870E+00,
 1.071773462536290E+00,
 };
 
-int SuperGaussian::BlobDegree = 6;
-
 int MaxIndex (double* array, int N);
 int MinIndex (double* array, int N);
 
@@ -733,7 +702,7 @@ PeakInfoForClusters :: ~PeakInfoForClusters () {
 
 double PeakInfoForClusters :: Distance (const PeakInfoForClusters& pifc) {
 
-	double peakDiff = PeakInfoForClusters::HeightFactor * (mPeak - pifc.GetPeak ());
+	double peakDiff = PeakInfoForClusters::GetHeightFactor () * (mPeak - pifc.GetPeak ());
 	double meanDiff = mMean - pifc.GetMean ();
 	return sqrt (peakDiff * peakDiff + meanDiff * meanDiff);
 }
@@ -742,7 +711,7 @@ double PeakInfoForClusters :: Distance (const PeakInfoForClusters& pifc) {
 
 double PeakInfoForClusters :: Distance (double peak, double mean) {
 
-	double peakDiff = PeakInfoForClusters::HeightFactor * (mPeak - peak);
+	double peakDiff = PeakInfoForClusters::GetHeightFactor () * (mPeak - peak);
 	double meanDiff = mMean - mean;
 	return sqrt (peakDiff * peakDiff + meanDiff * meanDiff);
 }
@@ -853,6 +822,21 @@ DataSignal :: ~DataSignal () {
 }
 
 
+unsigned long DataSignal :: GetSignalID () const {
+
+	const AnalysisNumbering& numbering = AnalysisContext::GetCurrentNumbering ();
+	return (mSignalID > numbering.signalIDBase) ? mSignalID + numbering.signalIDOffset : mSignalID;
+}
+
+
+void DataSignal :: SetSignalIDOffset (unsigned long base, unsigned long offset) {
+
+	AnalysisNumbering& numbering = AnalysisContext::GetCurrentNumbering ();
+	numbering.signalIDBase = base;
+	numbering.signalIDOffset = offset;
+}
+
+
 double DataSignal :: LeftTestValue () const {
 
 	return Value (mTestLeftEndPoint);
@@ -2649,6 +2633,7 @@ DataSignal* SampledData :: FindNextCharacteristicFromRight (const DataSignal& Si
 
 	while (value == NULL) {
 	
+		AnalysisTiming::Count (TIMINGCURVEFITS);
 		value = Signature.FindCharacteristic (this, nextInterval, TraceWindowSize, fit, previous);
 
 		if (value != NULL) {
@@ -2675,6 +2660,7 @@ DataSignal* SampledData :: FindNextCharacteristicFromLeft (const DataSignal& Sig
 	if (nextInterval == NULL)
 		return NULL;
 
+	AnalysisTiming::Count (TIMINGCURVEFITS);
 	DataSignal* value = Signature.FindCharacteristic (this, nextInterval, TraceWindowSize, fit, previous);
 
 	if (value != NULL)
@@ -2706,6 +2692,7 @@ DataSignal* SampledData :: FindNextCharacteristicRetry (const DataSignal& Signat
 	if (nextInterval == NULL)
 		return NULL;
 
+	AnalysisTiming::Count (TIMINGCURVEFITS);
 	DataSignal* value = Signature.FindCharacteristic (this, nextInterval, TraceWindowSize, fit, previous);
 
 	if (value != NULL)
@@ -2854,6 +2841,7 @@ DataSignal* SampledData :: FindNextCharacteristicRetry (const DataSignal& Signat
 		delete leftInterval;
 	}
 
+	AnalysisTiming::Count (TIMINGCURVEFITS);
 	DataSignal* value = Signature.FindCharacteristic (this, testInterval, TraceWindowSize, fit, previous);
 
 	if (value != NULL)
@@ -3039,9 +3027,23 @@ int SampledData :: Add (list<DataSignal*>& WaveList) { return 0; }  // list of p
 int SampledData :: TruncateToResolution (double resolution) {
 
 	double r = 1.0 / resolution;
+	double temp;
 	
-	for (int i=0; i<NumberOfSamples; i++)
-		Measurements [i] = resolution * floor (r * Measurements [i]);
+	for (int i=0; i<NumberOfSamples; i++) {
+
+		//  For 0 < temp < 2^31, conversion to int is floor, and much cheaper.  Zeros keep their sign, as with floor
+
+		temp = r * Measurements [i];
+
+		if ((temp > 0.0) && (temp < 2147483647.0))
+			Measurements [i] = resolution * (double)(int)temp;
+
+		else if (temp == 0.0)
+			Measurements [i] = resolution * temp;
+
+		else
+			Measurements [i] = resolution * floor (temp);
+	}
 
 	return 0;
 }
@@ -3702,6 +3704,125 @@ int ParametricCurve :: AddToSample (double* sample, double sampleLeft, double sa
 }
 
 
+//  Digitized values, in units of the resolution, at or above this are checked with Value (double)
+
+static const double DigitizeGuardLimit = 1073741824.0;
+
+
+int ParametricCurve :: DigitizeToResolution (double* sample, double sampleLeft, double sampleRight, double resolution) const {
+
+	//
+	//  Sets the same samples as AddToSample, to values that truncate to resolution (SampledData::TruncateToResolution) exactly
+	//  as Value (x) does.  Only the samples within the support are evaluated, a block at a time, by SupportValues.  A value v is
+	//  kept if every number within the error bound of v truncates the same way;  otherwise the sample is recomputed with Value.
+	//  Outside of the support, the samples are 0 if tailBound truncates to 0, and Value (x) otherwise
+	//
+
+	double supportLeft;
+	double supportRight;
+	double tailBound;
+
+	if ((resolution <= 0.0) || !GetSupport (supportLeft, supportRight, tailBound) || !(supportLeft <= supportRight))
+		return AddToSample (sample, sampleLeft, sampleRight);
+
+	int Low;
+	int High;
+	double spacing = DataSignal::GetSampleSpacing ();
+	double right;
+	double x;
+
+	if (Left <= sampleLeft)
+		Low = 0;
+
+	else
+		Low = (int) ceil ((Left - sampleLeft) / spacing);
+
+	if (Right >= sampleRight)
+		right = sampleRight;
+
+	else
+		right = Right;
+
+	High = (int) floor ((right - sampleLeft) / spacing);
+
+	if (High < Low)
+		return High - Low;
+
+	double r = 1.0 / resolution;
+	double epsilon = SignalKernels::GetVectorExpErrorBound ();
+	bool tailIsZero = (floor (r * tailBound) == 0.0);
+	double supportLow = ceil ((supportLeft - sampleLeft) / spacing);
+	double supportHigh = floor ((supportRight - sampleLeft) / spacing);
+	int first = Low;
+	int last = High;
+	int i;
+
+	if (supportLow > Low)
+		first = (supportLow > High) ? High + 1 : (int) supportLow;
+
+	if (supportHigh < High)
+		last = (supportHigh < Low) ? Low - 1 : (int) supportHigh;
+
+	if (first > last) {
+
+		first = High + 1;
+		last = High;
+	}
+
+	for (i=Low; i<=High; i++) {
+
+		if ((i >= first) && (i <= last))
+			continue;
+
+		if (tailIsZero)
+			sample [i] = 0.0;
+
+		else
+			sample [i] = Value (sampleLeft + i * spacing);
+	}
+
+	double values [DigitizeBlockSize];
+	double u;
+	double margin;
+	double lower;
+	int count;
+	int k;
+
+	for (i=first; i<=last; i+=DigitizeBlockSize) {
+
+		count = last - i + 1;
+
+		if (count > DigitizeBlockSize)
+			count = DigitizeBlockSize;
+
+		SupportValues (sampleLeft, i, count, values);
+
+		for (k=0; k<count; k++) {
+
+			//  Value (x) is not negative, and for 0 <= u < 2^31 truncation to int is floor
+
+			u = r * values [k];
+			margin = epsilon * u;
+			lower = u - margin;
+
+			if (lower < 0.0)
+				lower = 0.0;
+
+			if ((u >= 0.0) && (u < DigitizeGuardLimit) && ((int) lower == (int) (u + margin)))
+				sample [i + k] = values [k];
+
+			else {
+
+				x = sampleLeft + (i + k) * spacing;
+				sample [i + k] = Value (x);
+			}
+		}
+	}
+
+	return High - Low;
+}
+
+
 int ParametricCurve :: AddToSampleArray (double* sample, double sampleLeft, double sampleRight, double verticalResolution) const {
 
 	int Low;
@@ -4057,11 +4178,11 @@ double ParametricCurve :: TruncateWithResolution (double value, double resolutio
 }
 
 
-Gaussian :: Gaussian () : ParametricCurve (-Gaussian::SigmaWidth, Gaussian::SigmaWidth), Mean (0.0), StandardDeviation (1.0) {}
+Gaussian :: Gaussian () : ParametricCurve (-Gaussian::Settings ().SigmaWidth, Gaussian::Settings ().SigmaWidth), Mean (0.0), StandardDeviation (1.0) {}
 
 
 Gaussian :: Gaussian (double mean, double standardDeviation) : 
-ParametricCurve (mean - Gaussian::SigmaWidth * standardDeviation, mean + Gaussian::SigmaWidth * standardDeviation), Mean (mean), 
+ParametricCurve (mean - Gaussian::Settings ().SigmaWidth * standardDeviation, mean + Gaussian::Settings ().SigmaWidth * standardDeviation), Mean (mean), 
 StandardDeviation (standardDeviation) {
 																				
 }
@@ -4080,7 +4201,7 @@ Gaussian :: Gaussian (const Gaussian& gau) : ParametricCurve (gau), Mean (gau.Me
 
 
 Gaussian :: Gaussian (double mean, const Gaussian& gau) : 
-ParametricCurve (mean - Gaussian::SigmaWidth * gau.StandardDeviation, mean + Gaussian::SigmaWidth * gau.StandardDeviation),
+ParametricCurve (mean - Gaussian::Settings ().SigmaWidth * gau.StandardDeviation, mean + Gaussian::Settings ().SigmaWidth * gau.StandardDeviation),
 Mean (mean), StandardDeviation (gau.StandardDeviation) {
 
 }
@@ -4138,6 +4259,28 @@ void Gaussian :: ComputeTails (double& tailLeft, double& tailRight) const {
 }
 
 
+bool Gaussian :: GetSupport (double& supportLeft, double& supportRight, double& tailBound) const {
+
+	//  The tail is bounded a little inside the edge of the support, to allow for rounding of the sample positions
+
+	if (!(StandardDeviation > 0.0) || !(Scale >= 0.0))
+		return false;
+
+	double width = Gaussian::Settings ().SigmaWidth * StandardDeviation;
+	double edge = 0.999 * Gaussian::Settings ().SigmaWidth;
+	supportLeft = Mean - width;
+	supportRight = Mean + width;
+	tailBound = Scale * exp (-0.5 * edge * edge);
+	return true;
+}
+
+
+void Gaussian :: SupportValues (double sampleLeft, int first, int count, double* values) const {
+
+	SignalKernels::VectorPeakValues (sampleLeft, DataSignal::GetSampleSpacing (), first, count, Mean, StandardDeviation, 0, Scale, values);
+}
+
+
 double Gaussian :: Value (double x) const {
 
 	double temp = (x - Mean) / StandardDeviation;
@@ -4244,10 +4387,10 @@ double Gaussian :: Norm2 (double left, double right) {
 		return Norm2 ();
 
 	double sum = 0.0;
-	double width = (right - left) / Gaussian::NumberOfSteps;
+	double width = (right - left) / Gaussian::Settings ().NumberOfSteps;
 	double temp;
 	double x;
-	int Total = Gaussian::NumberOfSteps;
+	int Total = Gaussian::Settings ().NumberOfSteps;
 
 	for (int i=1; i<Total; i++) {
 
@@ -4304,10 +4447,10 @@ double Gaussian :: OneNorm (double left, double right) {
 		return OneNorm ();
 
 	double sum = 0.0;
-	double width = (right - left) / Gaussian::NumberOfSteps;
+	double width = (right - left) / Gaussian::Settings ().NumberOfSteps;
 	double temp;
 	double x;
-	int Total = Gaussian::NumberOfSteps;
+	int Total = Gaussian::Settings ().NumberOfSteps;
 
 	for (int i=1; i<Total; i++) {
 
@@ -4340,11 +4483,11 @@ int Gaussian :: FirstMomentForOneNorm (double left, double right, double& oneNor
 
 	double sum = 0.0;
 	double sum1 = 0.0;
-	double width = (right - left) / Gaussian::NumberOfSteps;
+	double width = (right - left) / Gaussian::Settings ().NumberOfSteps;
 	double temp;
 	double tempExp;
 	double x;
-	int Total = Gaussian::NumberOfSteps;
+	int Total = Gaussian::Settings ().NumberOfSteps;
 
 	for (int i=1; i<Total; i++) {
 
@@ -4395,11 +4538,11 @@ int Gaussian :: SecondMomentForOneNorm (double left, double right, double& oneNo
 	double sum = 0.0;
 	double sum1 = 0.0;
 	double sum2 = 0.0;
-	double width = (right - left) / Gaussian::NumberOfSteps;
+	double width = (right - left) / Gaussian::Settings ().NumberOfSteps;
 	double temp;
 	double tempExp;
 	double x;
-	int Total = Gaussian::NumberOfSteps;
+	int Total = Gaussian::Settings ().NumberOfSteps;
 
 	for (int i=1; i<Total; i++) {
 
@@ -5222,6 +5365,8 @@ void NormalizedGaussian :: SaveAll (RGVOutStream& f) const {
 
 double NormalizedGaussian :: InnerProductWithOffsetAndStandardDeviation (double offset, double sigma, double* coeffs, const SampleDataInfo& info) const {
 
+	AnalysisTiming::Count (TIMINGCURVEFITEVALUATIONS);
+
 	//
 	//  This is a "dot" product based on integration using the trapezoidal rule:  assumes
 	//  target is a sampled curve and it is to be "convoluted" with a normalized Gaussian
@@ -5238,6 +5383,15 @@ double NormalizedGaussian :: InnerProductWithOffsetAndStandardDeviation (double
 	const double* ptargetMinus = ptargetPlus;
 	double sampleSpacing = info.Spacing;
 	double center = info.AbscissaLeft + info.IndexCenter * sampleSpacing;
+	int halfWidth = (int)(info.DataRight - info.DataCenter);
+
+	if (GaussianFitEngine::GetUseFastFit () && (halfWidth > 0)) {
+
+		double fastSum = GaussianFitEngine::GaussianInnerProduct (info.DataCenter - halfWidth, 2 * halfWidth + 1, 
+			center - halfWidth * sampleSpacing, sampleSpacing, offset, sigma);
+		return fastSum * sampleSpacing / (sqrt (sqrtPi * sigma));
+	}
+
 	double x = (center - offset) / sigma;
 	x *= 0.5 * x;
 	double sum = exp (-x) * (*ptargetPlus);
@@ -5280,10 +5434,21 @@ double NormalizedGaussian :: InnerProductWithOffsetAndStandardDeviation (double
 
 double NormalizedGaussian :: AsymmetricInnerProductWithOffsetAndStandardDeviation (double offset, double sigma, double* coeffs, const SampleDataInfo& info) const {
 
+	AnalysisTiming::Count (TIMINGCURVEFITEVALUATIONS);
 	const double* ptargetPlus = info.DataLeft;
 	const double* ptargetPlusEnd = info.DataRight;
 	double sampleSpacing = info.Spacing;
 	double left = info.AbscissaLeft + info.Spacing * info.IndexLeft;
+
+	if (GaussianFitEngine::GetUseFastFit () && (info.DataRight > info.DataLeft)) {
+
+		double fastSum = GaussianFitEngine::GaussianInnerProduct (info.DataLeft, (int)(info.DataRight - info.DataLeft) + 1, left, 
+			sampleSpacing, offset, sigma);
+		fastSum *= sampleSpacing / (sqrt (sqrtPi * sigma));
+		*coeffs = fastSum / (sqrt (sqrtPi * sigma));
+		return fastSum;
+	}
+
 	double x = (left - offset) / sigma;
 	x *= 0.5 * x;
 	double sum = 0.5 * exp (-x) * (*ptargetPlus);
@@ -5578,6 +5743,40 @@ void DoubleGaussian :: ComputeTails (double& tailLeft, double& tailRight) const
 }
 
 
+bool DoubleGaussian :: GetSupport (double& supportLeft, double& supportRight, double& tailBound) const {
+
+	double left2;
+	double right2;
+	double tail2;
+
+	if (!(PrimaryScale >= 0.0) || !(SecondaryScale >= 0.0))
+		return false;
+
+	if (!PrimaryCurve->GetSupport (supportLeft, supportRight, tailBound) || !SecondaryCurve->GetSupport (left2, right2, tail2))
+		return false;
+
+	if (left2 < supportLeft)
+		supportLeft = left2;
+
+	if (right2 > supportRight)
+		supportRight = right2;
+
+	tailBound = PrimaryScale * tailBound + SecondaryScale * tail2;
+	return true;
+}
+
+
+void DoubleGaussian :: SupportValues (double sampleLeft, int first, int count, double* values) const {
+
+	double secondary [DigitizeBlockSize];
+	PrimaryCurve->SupportValues (sampleLeft, first, count, values);
+	SecondaryCurve->SupportValues (sampleLeft, first, count, secondary);
+
+	for (int k=0; k<count; k++)
+		values [k] = PrimaryScale * values [k] + SecondaryScale * secondary [k];
+}
+
+
 bool DoubleGaussian :: IsUnimodal () const {
 
 	if ((PrimaryScale >= 0.0) && (SecondaryScale >= 0.0)) {
@@ -6676,7 +6875,7 @@ double DoubleGaussian :: InnerProductWithStandardSpacing (double* ogCoeffs, cons
 
 double DoubleGaussian :: InnerProductWithOffsetAndStandardDeviation (double offset, double sigma, double* ogCoeffs, const SampleDataInfo& info) const {
 
-	double sigma2 = SigmaRatio * sigma;
+	AnalysisTiming::Count (TIMINGCURVEFITEVALUATIONS);
 	double SigmaCorrection = 1.0 / (SigmaRatio * SigmaRatio);
 
 	const double* ptargetPlus = info.DataCenter;
@@ -6684,6 +6883,16 @@ double DoubleGaussian :: InnerProductWithOffsetAndStandardDeviation (double offs
 	const double* ptargetMinus = ptargetPlus;
 	double sampleSpacing = info.Spacing;
 	double center = info.AbscissaLeft + info.IndexCenter * sampleSpacing;
+	int halfWidth = (int)(info.DataRight - info.DataCenter);
+
+	if (GaussianFitEngine::GetUseFastFit () && (halfWidth > 0)) {
+
+		double sums [5];
+		GaussianFitEngine::DoubleGaussianSums (info.DataCenter - halfWidth, 2 * halfWidth + 1, center - halfWidth * sampleSpacing, 
+			sampleSpacing, offset, sigma, SigmaRatio, sums [0], sums [1], sums [2], sums [3], sums [4]);
+		return ProjectOntoGaussianPair (sums [0], sums [1], sums [2], sums [3], sums [4], sigma, sampleSpacing, ogCoeffs);
+	}
+
 	double x = (center - offset) / sigma;
 	double z;
 	x *= 0.5 * x;
@@ -6752,84 +6961,28 @@ double DoubleGaussian :: InnerProductWithOffsetAndStandardDeviation (double offs
 	sumv1 += 0.5 * (tempx * tempx + tempy * tempy);
 	sumv1v2 += 0.5 * (tempx * tempw + tempy * tempz);
 
-	sum *= sampleSpacing / (sqrt (sqrtPi * sigma));  // this is inner product of sample with first Gaussian
-	sum2 *= sampleSpacing / (sqrt (sqrtPi * sigma2));  // this is inner product of (projected) sample with (projected) second Gaussian
-	sum3 *= sampleSpacing / (sqrtPi * sigma2);  // this is norm^2 for second Gaussian
-	sumv1 *= sampleSpacing / (sqrtPi * sigma);
-	sumv1v2 *= sampleSpacing / (sqrtPi * sqrt (sigma * sigma2));
-
-//	*ogCoeffs = sum;
-	double* second = ogCoeffs + 1;
-	double alpha1;
-	double normv1;
-
-	if (sumv1 * sum3 <= sumv1v2 * sumv1v2) {
-
-		if (sumv1 <= 0.0)
-			normv1 = alpha1 = *ogCoeffs = 0.0;
-		
-		else {
-
-			normv1 = sqrt (sumv1);
-			alpha1 = sum / normv1;
-			*ogCoeffs = (alpha1 / normv1);
-		}
-
-		*second = 0.0;
-		*(second + 1) = 1.0;
-
-		return fabs (alpha1);
-	}
-
-	tempz = sum3 - ((sumv1v2 * sumv1v2) / sumv1);  // This should now be positive
-
-/*	if (tempz <= 0.0) {
-
-//		if (DataSignal::DebugFlag)
-//		cout << "Normalization problem!!!  Sample Number = " << *info.DataCenter << ", sigma = " << sigma << ", v1 norm2 = " << sumv1 << endl;
-		normv1 = sqrt (sumv1);
-		alpha1 = sum / normv1;
-		*ogCoeffs = (alpha1 / normv1);
-		*second = 0.0;
-		*(second + 1) = 1.0;
-
-		return abs (alpha1);
-	}*/
-
-	double Radical = sqrt (tempz);
-	normv1 = sqrt (sumv1);
-
-//	*second = temp = (sum2 - Correlation * sum) / sqrt (tempz);
-	double* third = second + 1;  // We'd better make sure that the calling program passes a pointer to 3 doubles
-	*third = sum3;
-
-	alpha1 = sum / normv1;
-	double alpha2 = (sum2 / Radical) - ((sumv1v2 * sum) / (sumv1 * Radical));
-	double pctAlpha1 = 0.05 * alpha1;
-
-	if ((alpha2 < 0.0) && (fabs (alpha2) > pctAlpha1))
-		alpha2 = pctAlpha1;
-
-	// The coefficients below have changed from the initial version:  they now represent the coefficients of the actual
-	// Gaussians, not the orthonormalized pair of functions
-
-	*ogCoeffs = (alpha1 / normv1) - ((alpha2 * sumv1v2) / (sumv1 * Radical));  // This is now a1, the coeff. of primary Gaussian
-	*second = alpha2 / Radical;   // This is now a2, the coeff. of secondary Gaussian
-
-	return sqrt (alpha1 * alpha1 + alpha2 * alpha2);  // This is the inner product of the sum of the two Gaussians with the 
-	       // sample.  It uses the two components of the perpendicular projections.
+	return ProjectOntoGaussianPair (sum, sum2, sum3, sumv1, sumv1v2, sigma, sampleSpacing, ogCoeffs);
 }
 
 
 double DoubleGaussian :: AsymmetricInnerProductWithOffsetAndStandardDeviation (double offset, double sigma, double* ogCoeffs, const SampleDataInfo& info) const {
 
-	double sigma2 = SigmaRatio * sigma;
+	AnalysisTiming::Count (TIMINGCURVEFITEVALUATIONS);
 	double SigmaCorrection = 1.0 / (SigmaRatio * SigmaRatio);
 
 	const double* ptargetPlus = info.DataLeft;
 	const double* ptargetPlusEnd = info.DataRight;
 	double sampleSpacing = info.Spacing;
 	double left = info.AbscissaLeft + info.Spacing * info.IndexLeft;
+
+	if (GaussianFitEngine::GetUseFastFit () && (info.DataRight > info.DataLeft)) {
+
+		double sums [5];
+		GaussianFitEngine::DoubleGaussianSums (info.DataLeft, (int)(info.DataRight - info.DataLeft) + 1, left, sampleSpacing, offset, 
+			sigma, SigmaRatio, sums [0], sums [1], sums [2], sums [3], sums [4]);
+		return ProjectOntoGaussianPair (sums [0], sums [1], sums [2], sums [3], sums [4], sigma, sampleSpacing, ogCoeffs);
+	}
+
 	double x = (left - offset) / sigma;
 	x *= 0.5 * x;
 	double w;
@@ -6880,6 +7033,21 @@ double DoubleGaussian :: AsymmetricInnerProductWithOffsetAndStandardDeviation (d
 	sumv1 += 0.5 * (tempx * tempx);
 	sumv1v2 += 0.5 * (tempx * tempw);
 
+	return ProjectOntoGaussianPair (sum, sum2, sum3, sumv1, sumv1v2, sigma, sampleSpacing, ogCoeffs);
+}
+
+
+double DoubleGaussian :: ProjectOntoGaussianPair (double sum, double sum2, double sum3, double sumv1, double sumv1v2, double sigma,
+double sampleSpacing, double* ogCoeffs) const {
+
+	//
+	//  Scales the trapezoidal sums of the inner product functions and projects the sample onto the primary Gaussian and the
+	//  part of the secondary Gaussian orthogonal to it
+	//
+
+	double sigma2 = SigmaRatio * sigma;
+	double tempz;
+
 	sum *= sampleSpacing / (sqrt (sqrtPi * sigma));  // this is inner product of sample with first Gaussian
 	sum2 *= sampleSpacing / (sqrt (sqrtPi * sigma2));  // this is inner product of (projected) sample with (projected) second Gaussian
 	sum3 *= sampleSpacing / (sqrtPi * sigma2);  // this is norm^2 for second Gaussian
@@ -6909,9 +7077,9 @@ double DoubleGaussian :: AsymmetricInnerProductWithOffsetAndStandardDeviation (d
 		return fabs (alpha1);
 	}
 
-	tempw = sum3 - ((sumv1v2 * sumv1v2) / sumv1);  // This should now be positive
+	tempz = sum3 - ((sumv1v2 * sumv1v2) / sumv1);  // This should now be positive
 
-/*	if (tempw <= 0.0) {
+/*	if (tempz <= 0.0) {
 
 //		if (DataSignal::DebugFlag)
 //		cout << "Normalization problem!!!  Sample Number = " << *info.DataCenter << ", sigma = " << sigma << ", v1 norm2 = " << sumv1 << endl;
@@ -6924,7 +7092,7 @@ double DoubleGaussian :: AsymmetricInnerProductWithOffsetAndStandardDeviation (d
 		return abs (alpha1);
 	}*/
 
-	double Radical = sqrt (tempw);
+	double Radical = sqrt (tempz);
 	normv1 = sqrt (sumv1);
 
 //	*second = temp = (sum2 - Correlation * sum) / sqrt (tempz);
@@ -7261,7 +7429,7 @@ void DoubleGaussian :: SaveAll (RGVOutStream& f) const {
 
 
 
-SuperGaussian :: SuperGaussian () : ParametricCurve (-SuperGaussian::SigmaWidth, SuperGaussian::SigmaWidth), Mean (0.0), StandardDeviation (1.0), Degree (3) {
+SuperGaussian :: SuperGaussian () : ParametricCurve (-SuperGaussian::Settings ().SigmaWidth, SuperGaussian::Settings ().SigmaWidth), Mean (0.0), StandardDeviation (1.0), Degree (3) {
 
 	SuperNorm = SuperGaussian::SuperNorms [0];
 	RootTwo = SuperGaussian::RootTwos [0];
@@ -7276,7 +7444,7 @@ SuperGaussian :: SuperGaussian () : ParametricCurve (-SuperGaussian::SigmaWidth,
 
 
 SuperGaussian :: SuperGaussian (double mean, double standardDeviation, int degree) : 
-ParametricCurve (mean - SuperGaussian::SigmaWidth * standardDeviation, mean + SuperGaussian::SigmaWidth * standardDeviation), Mean (mean), 
+ParametricCurve (mean - SuperGaussian::Settings ().SigmaWidth * standardDeviation, mean + SuperGaussian::Settings ().SigmaWidth * standardDeviation), Mean (mean), 
 StandardDeviation (standardDeviation), Degree (degree) {
 
 	if (Degree > 10)
@@ -7336,7 +7504,7 @@ SuperSigma2 (sg.SuperSigma2) {
 
 
 SuperGaussian :: SuperGaussian (double mean, const SuperGaussian& sg) : 
-ParametricCurve (mean - SuperGaussian::SigmaWidth * sg.StandardDeviation, mean + SuperGaussian::SigmaWidth * sg.StandardDeviation), Mean (mean),
+ParametricCurve (mean - SuperGaussian::Settings ().SigmaWidth * sg.StandardDeviation, mean + SuperGaussian::Settings ().SigmaWidth * sg.StandardDeviation), Mean (mean),
 StandardDeviation (sg.StandardDeviation), Degree (sg.Degree), SuperNorm (sg.SuperNorm),
 RootTwo (sg.RootTwo), TwoNorm2WithoutScale (sg.TwoNorm2WithoutScale), Sigma2 (sg.Sigma2), Sigma1 (sg.Sigma1),
 SuperSigma2 (sg.SuperSigma2) {
@@ -7445,6 +7613,31 @@ void SuperGaussian :: ComputeTails (double& tailLeft, double& tailRight) const {
 }
 
 
+bool SuperGaussian :: GetSupport (double& supportLeft, double& supportRight, double& tailBound) const {
+
+	if (!(StandardDeviation > 0.0) || !(Scale >= 0.0) || (Degree < 1))
+		return false;
+
+	double width = Gaussian::GetSigmaWidth () * StandardDeviation;
+	double edge = 0.999 * Gaussian::GetSigmaWidth ();
+	double exponent = 1.0;
+
+	for (int i=0; i<Degree; i++)
+		exponent *= edge;
+
+	supportLeft = Mean - width;
+	supportRight = Mean + width;
+	tailBound = Scale * exp (-exponent);
+	return true;
+}
+
+
+void SuperGaussian :: SupportValues (double sampleLeft, int first, int count, double* values) const {
+
+	SignalKernels::VectorPeakValues (sampleLeft, DataSignal::GetSampleSpacing (), first, count, Mean, StandardDeviation, Degree, Scale, values);
+}
+
+
 DataSignal* SuperGaussian :: Project (double left, double right) const {
 
 	double l = left;
@@ -7521,10 +7714,10 @@ double SuperGaussian :: Norm2 (double left, double right) {
 		return Norm2 ();
 
 	double sum = 0.0;
-	double width = (right - left) / SuperGaussian::NumberOfSteps;
+	double width = (right - left) / SuperGaussian::Settings ().NumberOfSteps;
 	double temp;
 	double x;
-	int Total = SuperGaussian::NumberOfSteps;
+	int Total = SuperGaussian::Settings ().NumberOfSteps;
 
 	for (int i=1; i<Total; i++) {
 
@@ -7577,9 +7770,9 @@ double SuperGaussian :: OneNorm (double left, double right) {
 		return OneNorm ();
 
 	double sum = 0.0;
-	double width = (right - left) / SuperGaussian::NumberOfSteps;
+	double width = (right - left) / SuperGaussian::Settings ().NumberOfSteps;
 	double x;
-	int Total = SuperGaussian::NumberOfSteps;
+	int Total = SuperGaussian::Settings ().NumberOfSteps;
 
 	for (int i=1; i<Total; i++) {
 
@@ -7605,10 +7798,10 @@ int SuperGaussian :: FirstMomentForOneNorm (double left, double right, double& o
 
 	double sum = 0.0;
 	double sum1 = 0.0;
-	double width = (right - left) / SuperGaussian::NumberOfSteps;
+	double width = (right - left) / SuperGaussian::Settings ().NumberOfSteps;
 	double tempExp;
 	double x;
-	int Total = SuperGaussian::NumberOfSteps;
+	int Total = SuperGaussian::Settings ().NumberOfSteps;
 
 	for (int i=1; i<Total; i++) {
 
@@ -7653,11 +7846,11 @@ int SuperGaussian :: SecondMomentForOneNorm (double left, double right, double&
 	double sum = 0.0;
 	double sum1 = 0.0;
 	double sum2 = 0.0;
-	double width = (right - left) / SuperGaussian::NumberOfSteps;
+	double width = (right - left) / SuperGaussian::Settings ().NumberOfSteps;
 	double temp;
 	double tempExp;
 	double x;
-	int Total = SuperGaussian::NumberOfSteps;
+	int Total = SuperGaussian::Settings ().NumberOfSteps;
 
 	for (int i=1; i<Total; i++) {
 
@@ -8497,6 +8690,8 @@ void NormalizedSuperGaussian :: SaveAll (RGVOutStream& f) const {
 
 double NormalizedSuperGaussian :: InnerProductWithOffsetAndStandardDeviation (double offset, double sigma, double* coeffs, const SampleDataInfo& info) const {
 
+	AnalysisTiming::Count (TIMINGCURVEFITEVALUATIONS);
+
 	//
 	//  This is a "dot" product based on integration using the trapezoidal rule:  assumes
 	//  target is a sampled curve and it is to be "convoluted" with a normalized Gaussian
@@ -8685,7 +8880,33 @@ RGString CompositeCurve :: GetSignalType () const {
 
 DataSignal* CompositeCurve :: Digitize (int numSamples, double left, double resolution) {
 
-	SampledData* sd = (SampledData*)Digitize (numSamples, left);
+	//
+	//  Same result as Digitize (numSamples, left) followed by TruncateToResolution, but each curve evaluates its exponentials
+	//  only over its support, with the vector exponential (see ParametricCurve::DigitizeToResolution)
+	//
+
+	double spacing = SampledData::GetSampleSpacing ();
+
+	double* sample = new double [numSamples];
+	double* lastPoint = sample + numSamples;
+	double right = left + (numSamples - 1) * spacing;
+
+	double* pplus;
+
+	for (pplus = sample; pplus < lastPoint; pplus++) {
+
+		*pplus = 0.0;
+	}
+	
+	RGDListIterator it (mTempCurveList);
+	DataSignal* nextSignal;
+
+	while ((nextSignal = (DataSignal*)it ())) {
+
+		nextSignal->DigitizeToResolution (sample, left, right, resolution);
+	}
+
+	SampledData* sd = new SampledData (numSamples, left, right, sample);
 	sd->TruncateToResolution (resolution);
 	return sd;
 }
@@ -40,6 +40,7 @@
 #include "Notice.h"
 #include "SmartNotice.h"
 #include "SmartMessagingObject.h"
+#include "AnalysisContext.h"
 
 
 #include <list>
@@ -218,8 +219,8 @@ public:
 
 	friend double GetDistance (const PeakInfoForClusters& p1, const PeakInfoForClusters& p2);
 
-	static double GetHeightFactor () { return HeightFactor; }
-	static void SetHeightFactor (double factor) { HeightFactor = factor; }
+	static double GetHeightFactor () { return AnalysisContext::GetCurrentScratch ().HeightFactor; }
+	static void SetHeightFactor (double factor) { AnalysisContext::GetCurrentScratch ().HeightFactor = factor; }
 
 protected:
 	double mPeak;
@@ -232,8 +233,6 @@ protected:
 
 	bool mChosen;
 	bool mProcessed;
-
-	static double HeightFactor;
 };
 
 
@@ -270,8 +269,7 @@ public:
 	mLocus (NULL), mMaxMessageLevel (1), mDoNotCall (false), mReportersAdded (false), mAllowPeakEdit (true), mCannotBePrimaryPullup (false), mMayBeUnacceptable (false),
 	mHasRaisedBaseline (false), mBaseline (0.0) {
 
-		DataSignal::signalID++;
-		mSignalID = DataSignal::signalID;
+		mSignalID = NextSignalID ();
 		InitializeSmartMessages ();
 	}
 
@@ -286,8 +284,7 @@ public:
 	mLocus (NULL), mMaxMessageLevel (1), mDoNotCall (false), mReportersAdded (false), mAllowPeakEdit (true), mCannotBePrimaryPullup (false), mMayBeUnacceptable (false),
 	mHasRaisedBaseline (false), mBaseline (0.0) {
 
-		DataSignal::signalID++;
-		mSignalID = DataSignal::signalID;
+		mSignalID = NextSignalID ();
 		InitializeSmartMessages ();
 	}
 
@@ -322,7 +319,7 @@ public:
 	virtual DataSignal* GetPreviousLinkedSignal () { return NULL; }
 	virtual DataSignal* GetNextLinkedSignal () { return NULL; }
 
-	unsigned long GetSignalID () const { return mSignalID; }
+	unsigned long GetSignalID () const;
 
 	void MarkForDeletion (bool mark) { markForDeletion = mark; }
 	bool GetMarkForDeletion () const { return markForDeletion; }
@@ -492,16 +489,20 @@ public:
 	double GetBioIDResidual (int position) const;
 	const Locus* GetLocus (int position) const;
 
-	static void SetSampleSpacing (double spacing) { SignalSpacing = spacing; }
-	static double GetSampleSpacing () { return SignalSpacing; }
+	static void SetSampleSpacing (double spacing) { Settings ().SignalSpacing = spacing; }
+	static double GetSampleSpacing () { return Settings ().SignalSpacing; }
+
+	static void SetDebugFlag (Boolean flag) { Settings ().DebugFlag = flag; }
+	static Boolean GetDebugFlag () { return Settings ().DebugFlag; }
 
-	static void SetDebugFlag (Boolean flag) { DebugFlag = flag; }
-	static Boolean GetDebugFlag () { return DebugFlag; }
+	static void SetMinimumHeight (double height) { Settings ().minHeight = height; }
+	static double GetMinimumHeight () { return Settings ().minHeight; }
+	static void SetMaximumHeight (double height) { Settings ().maxHeight = height; }
+	static double GetMaximumHeight () { return Settings ().maxHeight; }
 
-	static void SetMinimumHeight (double height) { minHeight = height; }
-	static double GetMinimumHeight () { return minHeight; }
-	static void SetMaximumHeight (double height) { maxHeight = height; }
-	static double GetMaximumHeight () { return maxHeight; }
+	static unsigned long GetCurrentSignalID () { return AnalysisContext::GetCurrentNumbering ().signalID; }
+	static void SetCurrentSignalID (unsigned long id) { AnalysisContext::GetCurrentNumbering ().signalID = id; }
+	static void SetSignalIDOffset (unsigned long base, unsigned long offset);	// reported id's above base are shifted by offset (worker processes)
 
 	virtual RGString GetSignalType () const;
 
@@ -515,6 +516,7 @@ public:
 	virtual double Peak () const { return -DOUBLEMAX; }
 	virtual Boolean CanBeNegative () const { return FALSE; }
 	virtual int AddToSample (double* sample, double sampleLeft, double sampleRight) const { return -1; }
+	virtual int DigitizeToResolution (double* sample, double sampleLeft, double sampleRight, double resolution) const { return AddToSample (sample, sampleLeft, sampleRight); }
 	virtual int AddToSampleArray (double* sample, double sampleLeft, double sampleRight, double verticalResolution) const { return -1; }
 	virtual void ComputeTails (double& tailLeft, double& tailRight) const { tailLeft = tailRight = 0.0; }
 	virtual double GetMean () const { return -DOUBLEMAX; }
@@ -644,6 +646,7 @@ public:
 	virtual Boolean ReportNotices (RGFile& file, const RGString& indent, const RGString& delim);
 	virtual void ClearNotices ();
 	virtual int NumberOfNotices ();
+	RGDList& GetNoticeList () { return NoticeList; }	// RGIndexedLabel's, in order of level
 
 
 	//******************************************************************************************************************************************************************************
@@ -720,7 +723,7 @@ public:
 
 	static void CreateInitializationData (int scope);
 	static void InitializeMessageMatrix (bool* matrix, int size);
-	static void ClearInitializationMatrix () { delete[] InitialMatrix; InitialMatrix = NULL; }
+	static void ClearInitializationMatrix ();
 	static int GetScope () { return 1; }
 
 
@@ -802,12 +805,8 @@ protected:
 	bool mHasRaisedBaseline;
 	double mBaseline;
 
-	static double SignalSpacing;
-	static Boolean DebugFlag;
-	static double minHeight;
-	static double maxHeight;
-	static unsigned long signalID;
-	static bool* InitialMatrix;
+	static DataSignalSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mDataSignal; }
+	static unsigned long NextSignalID () { return ++AnalysisContext::GetCurrentNumbering ().signalID; }
 
 	// Smart Message functions*******************************************************************************
 	//*******************************************************************************************************
@@ -907,13 +906,13 @@ public:
 	virtual void SaveAll (RGFile&) const;
 	virtual void SaveAll (RGVOutStream&) const;
 
-	static void SetPeakFractionForFlatCurveTest (double fraction) { PeakFractionForFlatCurveTest = fraction; }
-	static double GetPeakFractionForFlatCurveTest () { return PeakFractionForFlatCurveTest; }
+	static void SetPeakFractionForFlatCurveTest (double fraction) { Settings ().PeakFractionForFlatCurveTest = fraction; }
+	static double GetPeakFractionForFlatCurveTest () { return Settings ().PeakFractionForFlatCurveTest; }
 
-	static void SetPeakLevelForFlatCurveTest (double level) { PeakLevelForFlatCurveTest = level; }
-	static double GetPeakLevelForFlatCurveTest () { return PeakLevelForFlatCurveTest; }
-	static void SetIgnoreNoiseAnalysisAboveDetectionInSmoothing (bool ignore) { IgnoreNoiseAnalysisAboveDetectionInSmoothing = ignore; }
-	static bool GetIgnoreNoiseAnalysisAboveDetectionInSmoothing () { return IgnoreNoiseAnalysisAboveDetectionInSmoothing; }
+	static void SetPeakLevelForFlatCurveTest (double level) { Settings ().PeakLevelForFlatCurveTest = level; }
+	static double GetPeakLevelForFlatCurveTest () { return Settings ().PeakLevelForFlatCurveTest; }
+	static void SetIgnoreNoiseAnalysisAboveDetectionInSmoothing (bool ignore) { Settings ().IgnoreNoiseAnalysisAboveDetectionInSmoothing = ignore; }
+	static bool GetIgnoreNoiseAnalysisAboveDetectionInSmoothing () { return Settings ().IgnoreNoiseAnalysisAboveDetectionInSmoothing; }
 
 protected:
 	int NumberOfSamples;
@@ -938,9 +937,7 @@ protected:
 	bool mDeleteArray;
 	double mNoiseRange;
 
-	static double PeakFractionForFlatCurveTest;
-	static double PeakLevelForFlatCurveTest;
-	static bool IgnoreNoiseAnalysisAboveDetectionInSmoothing;
+	static SampledDataSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mSampledData; }
 
 	int GetSampleNumber (double abscissa) const;
 	double GetNorm2 (int nleft, int nright);
@@ -958,27 +955,37 @@ public:
 	ParametricCurve (const ParametricCurve& pc, CoordinateTransform* trans);
 	virtual ~ParametricCurve () = 0;
 
-	static double GetFitTolerance () { return FitTolerance; }
-	static void SetFitTolerance (double tol) { FitTolerance = tol; }
+	static double GetFitTolerance () { return Settings ().FitTolerance; }
+	static void SetFitTolerance (double tol) { Settings ().FitTolerance = tol; }
 
-	static double GetTriggerForArtifactTest () { return TriggerForArtifactTest; }
-	static void SetTriggerForArtifactTest (double tol) { TriggerForArtifactTest = tol; }
+	static double GetTriggerForArtifactTest () { return Settings ().TriggerForArtifactTest; }
+	static void SetTriggerForArtifactTest (double tol) { Settings ().TriggerForArtifactTest = tol; }
 
-	static double GetMinimumFitThreshold () { return MinimumFitThreshold; }
-	static void SetMinimumFitThreshold (double tol) { MinimumFitThreshold = tol; }
+	static double GetMinimumFitThreshold () { return Settings ().MinimumFitThreshold; }
+	static void SetMinimumFitThreshold (double tol) { Settings ().MinimumFitThreshold = tol; }
 
-	static double GetAbsoluteMinimumFit () { return AbsoluteMinimumFit; }
-	static void SetAbsoluteMinimumFit (double tol) { AbsoluteMinimumFit = tol; }
+	static double GetAbsoluteMinimumFit () { return Settings ().AbsoluteMinimumFit; }
+	static void SetAbsoluteMinimumFit (double tol) { Settings ().AbsoluteMinimumFit = tol; }
 
-	static double GetSigmaForSignature () { return SigmaForSignature; }
-	static void SetSigmaForSignature (double sigma) { SigmaForSignature = sigma; }
+	static double GetSigmaForSignature () { return Settings ().SigmaForSignature; }
+	static void SetSigmaForSignature (double sigma) { Settings ().SigmaForSignature = sigma; }
 
 	virtual double Value (double x) const = 0;
 	virtual double Value (int n) const { return -1.0; }
 	virtual int AddToSample (double* sample, double sampleLeft, double sampleRight) const;
+	virtual int DigitizeToResolution (double* sample, double sampleLeft, double sampleRight, double resolution) const;
 	virtual int AddToSampleArray (double* sample, double sampleLeft, double sampleRight, double verticalResolution) const;
 	virtual void ComputeTails (double& tailLeft, double& tailRight) const { tailLeft = tailRight = 0.0; }
 
+	//  Support for DigitizeToResolution:  outside of [supportLeft, supportRight], 0 <= Value (x) <= tailBound.  SupportValues
+	//  approximates Value at count <= DigitizeBlockSize consecutive samples, starting at sampleLeft + first * spacing, to within
+	//  SignalKernels::GetVectorExpErrorBound () relative error.  Curves without these return false and are digitized by AddToSample
+
+	virtual bool GetSupport (double& supportLeft, double& supportRight, double& tailBound) const { return false; }
+	virtual void SupportValues (double sampleLeft, int first, int count, double* values) const {}
+
+	static const int DigitizeBlockSize = 256;
+
 	virtual void SetDisplacement (double disp);
 	virtual void SetScale (double scale);
 	virtual double GetScale (int curve) const;
@@ -1028,12 +1035,8 @@ protected:
 	double Displacement;
 	double Scale;
 	RGString mWouldBeAlleleName;
-	static double FitTolerance;
 
-	static double TriggerForArtifactTest;
-	static double MinimumFitThreshold;
-	static double SigmaForSignature;
-	static double AbsoluteMinimumFit;
+	static ParametricCurveSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mParametricCurve; }
 
 	double TruncateWithResolution (double value, double resolution);
 };
@@ -1057,14 +1060,14 @@ public:
 
 	virtual void OutputDebugID (SmartMessagingComm& comm, int numHigherObjects);
 
-	static double GetSigmaWidth () { return SigmaWidth; }
-	static void SetSigmaWidth (double width) { SigmaWidth = width; }
+	static double GetSigmaWidth () { return Settings ().SigmaWidth; }
+	static void SetSigmaWidth (double width) { Settings ().SigmaWidth = width; }
 
-	static double GetSampleSigmaWidth () { return SampleSigmaWidth; }
-	static void SetSampleSigmaWidth (double width) { SampleSigmaWidth = width; }
+	static double GetSampleSigmaWidth () { return Settings ().SampleSigmaWidth; }
+	static void SetSampleSigmaWidth (double width) { Settings ().SampleSigmaWidth = width; }
 
-	static int GetNumberOfIntegrationSteps () { return NumberOfSteps; }
-	static void SetNumberOfIntegrationSteps (int steps) { NumberOfSteps = steps; }
+	static int GetNumberOfIntegrationSteps () { return Settings ().NumberOfSteps; }
+	static void SetNumberOfIntegrationSteps (int steps) { Settings ().NumberOfSteps = steps; }
 
 	virtual void SetDisplacement (double disp);
 	virtual void SetScale (double scale);
@@ -1075,6 +1078,8 @@ public:
 	virtual double GetVariance () const;
 	virtual void SetPeak (double peak);
 	virtual void ComputeTails (double& tailLeft, double& tailRight) const;
+	virtual bool GetSupport (double& supportLeft, double& supportRight, double& tailBound) const;
+	virtual void SupportValues (double sampleLeft, int first, int count, double* values) const;
 
 	virtual DataSignal* Project (double left, double right) const;
 	virtual DataSignal* Project (const DataSignal* target) const;
@@ -1108,9 +1113,7 @@ protected:
 	double Mean;
 	double StandardDeviation;
 
-	static int NumberOfSteps;
-	static double SigmaWidth;
-	static double SampleSigmaWidth;
+	static GaussianSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mGaussian; }
 };
 
 
@@ -1129,11 +1132,11 @@ public:
 
 	virtual RGString GetSignalType () const;
 
-	static double GetSigmaTolerance () { return SigmaTolerance; }
-	static void SetSigmaTolerance (double tol) { SigmaTolerance = tol; }
+	static double GetSigmaTolerance () { return Settings ().SigmaTolerance; }
+	static void SetSigmaTolerance (double tol) { Settings ().SigmaTolerance = tol; }
 
-	static int GetMaximumIterations () { return MaximumIterations; }
-	static void SetMaximumIterations (int maxIterations) { MaximumIterations = maxIterations; }
+	static int GetMaximumIterations () { return Settings ().MaximumIterations; }
+	static void SetMaximumIterations (int maxIterations) { Settings ().MaximumIterations = maxIterations; }
 
 //	virtual void SetDisplacement (double disp);
 	virtual void SetScale (double scale);
@@ -1172,8 +1175,7 @@ public:
 protected:
 	double SampleSpacing;
 
-	static double SigmaTolerance;
-	static int MaximumIterations;
+	static NormalizedGaussianSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mNormalizedGaussian; }
 };
 
 
@@ -1196,9 +1198,9 @@ public:
 
 	virtual void OutputDebugID (SmartMessagingComm& comm, int numHigherObjects);
 
-	static void SetDefaultSigmaRatio (double ratio) { DefaultSigmaRatio = ratio; DefaultSqrtSigmaRatio = sqrt (ratio); }
-	static double GetDefaultSigmaRatio () { return DefaultSigmaRatio; }
-	static double GetDefaultSqrtSigmaRatio () { return DefaultSqrtSigmaRatio; }
+	static void SetDefaultSigmaRatio (double ratio) { Settings ().DefaultSigmaRatio = ratio; Settings ().DefaultSqrtSigmaRatio = sqrt (ratio); }
+	static double GetDefaultSigmaRatio () { return Settings ().DefaultSigmaRatio; }
+	static double GetDefaultSqrtSigmaRatio () { return Settings ().DefaultSqrtSigmaRatio; }
 
 	virtual void SetScale (double scale);
 	virtual void SetScale (int curve, double scale);
@@ -1213,6 +1215,8 @@ public:
 	virtual double GetScale (int curve) const;
 	virtual double GetOrthogonalScale (int curve) const;
 	virtual void ComputeTails (double& tailLeft, double& tailRight) const;
+	virtual bool GetSupport (double& supportLeft, double& supportRight, double& tailBound) const;
+	virtual void SupportValues (double sampleLeft, int first, int count, double* values) const;
 	virtual bool IsUnimodal () const;
 
 	virtual DataSignal* FindNextCharacteristicFromRight (const DataSignal& Signature, 
@@ -1282,8 +1286,10 @@ protected:
 	double Mean;
 	double StandardDeviation;
 
-	static double DefaultSigmaRatio;
-	static double DefaultSqrtSigmaRatio;
+	static DoubleGaussianSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mDoubleGaussian; }
+
+	double ProjectOntoGaussianPair (double sum, double sum2, double sum3, double sumv1, double sumv1v2, double sigma, 
+		double sampleSpacing, double* ogCoeffs) const;
 };
 
 
@@ -1305,14 +1311,14 @@ public:
 
 	virtual void OutputDebugID (SmartMessagingComm& comm, int numHigherObjects);
 
-	static double GetSigmaWidth () { return SigmaWidth; }
-	static void SetSigmaWidth (double width) { SigmaWidth = width; }
+	static double GetSigmaWidth () { return Settings ().SigmaWidth; }
+	static void SetSigmaWidth (double width) { Settings ().SigmaWidth = width; }
 
-	static int GetNumberOfIntegrationSteps () { return NumberOfSteps; }
-	static void SetNumberOfIntegrationSteps (int steps) { NumberOfSteps = steps; }
+	static int GetNumberOfIntegrationSteps () { return Settings ().NumberOfSteps; }
+	static void SetNumberOfIntegrationSteps (int steps) { Settings ().NumberOfSteps = steps; }
 
-	static int GetBlobDegree () { return BlobDegree; }
-	static void SetBlobDegree (int degree) { BlobDegree = degree; }
+	static int GetBlobDegree () { return Settings ().BlobDegree; }
+	static void SetBlobDegree (int degree) { Settings ().BlobDegree = degree; }
 
 	virtual void SetDisplacement (double disp);
 	virtual void SetScale (double scale);
@@ -1323,6 +1329,8 @@ public:
 	virtual double GetVariance () const;
 	virtual void SetPeak (double peak);
 	virtual void ComputeTails (double& tailLeft, double& tailRight) const;
+	virtual bool GetSupport (double& supportLeft, double& supportRight, double& tailBound) const;
+	virtual void SupportValues (double sampleLeft, int first, int count, double* values) const;
 
 	virtual DataSignal* Project (double left, double right) const;
 	virtual DataSignal* Project (const DataSignal* target) const;
@@ -1364,12 +1372,10 @@ protected:
 	double Sigma1;
 	double SuperSigma2;
 
-	static int NumberOfSteps;
-	static double SigmaWidth;
+	static SuperGaussianSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mSuperGaussian; }
 	static double SuperNorms [8];
 	static double SuperSigma2s [8];
 	static double RootTwos [8];
-	static int BlobDegree;
 
 	double UnscaledValue (double x) const;
 };
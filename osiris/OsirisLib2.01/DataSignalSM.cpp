@@ -1236,15 +1236,16 @@ void DataSignal :: CreateInitializationData (int scope) {
 	int size = SmartMessage::GetSizeOfArrayForScope (scope);
 	int i;
 	SmartMessage* msg;
-	delete[] InitialMatrix;
-	InitialMatrix = new bool [size];
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().DataSignalInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = new bool [size];
 
 	for (i=0; i<size; i++) {
 
 		msg = SmartMessage::GetSmartMessageForScopeAndElement (scope, i);
 
 		if (msg != NULL)
-			InitialMatrix [i] = msg->GetInitialValue ();
+			initialMatrix [i] = msg->GetInitialValue ();
 	}
 }
 
@@ -1252,9 +1253,18 @@ void DataSignal :: CreateInitializationData (int scope) {
 void DataSignal :: InitializeMessageMatrix (bool* matrix, int size) {
 
 	int i;
+	bool* initialMatrix = AnalysisContext::GetCurrentMessageBook ().DataSignalInitialMatrix;
 
 	for (i=0; i<size; i++)
-		matrix [i] = InitialMatrix [i];
+		matrix [i] = initialMatrix [i];
+}
+
+
+void DataSignal :: ClearInitializationMatrix () {
+
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().DataSignalInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = NULL;
 }
 
 
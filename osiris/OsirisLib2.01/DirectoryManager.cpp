@@ -37,8 +37,6 @@
 
 
 Boolean DirectoryManager::Cycle = TRUE;
-RGString DirectoryManager::DataFileType = "fsa";
-RGString DirectoryManager::DataFileTypeWithDot = ".fsa";
 
 
 
@@ -147,7 +145,7 @@ bool DirectoryManager :: TestForExtension (const RGString& fileName) {
 	if (length > 4)
 		Extension = fileName.ExtractSubstring (length-4, length-1);
 	
-	if ((length > 4) && (Extension == DirectoryManager::DataFileTypeWithDot))
+	if ((length > 4) && (Extension == DirectoryManager::Settings ().DataFileTypeWithDot))
 		return true;
 
 	return false;
@@ -221,7 +219,7 @@ Boolean DirectoryManager :: TestForLadder (const RGString& fileName) {
 //	FoundLadder = localFileName.FindSubstring ("ladder", position);
 	FoundLadder = mPServer->LadderDoesTargetStringContainASynonymCaseIndep (fileName);
 	
-	if ((length > 4) && (Extension == DirectoryManager::DataFileTypeWithDot) && FoundLadder)	//old = if ((length > 4) && (Extension == ".fsa") && FoundLadder)
+	if ((length > 4) && (Extension == DirectoryManager::Settings ().DataFileTypeWithDot) && FoundLadder)	//old = if ((length > 4) && (Extension == ".fsa") && FoundLadder)
 		return TRUE;
 
 	return FALSE;
@@ -245,7 +243,7 @@ Boolean DirectoryManager :: TestForSample (const RGString& fileName) {
 	FoundControl = mPServer->LadderDoesTargetStringContainASynonymCaseIndep (fileName) ||
 		mPServer->ControlDoesTargetStringContainASynonymCaseIndep (fileName);
 	
-	if ((length > 4) && (Extension == DirectoryManager::DataFileTypeWithDot) && !FoundControl)		//old = if ((length > 4) && (Extension == ".fsa") && !FoundControl)
+	if ((length > 4) && (Extension == DirectoryManager::Settings ().DataFileTypeWithDot) && !FoundControl)		//old = if ((length > 4) && (Extension == ".fsa") && !FoundControl)
 		return TRUE;
 
 	return FALSE;
@@ -267,7 +265,7 @@ Boolean DirectoryManager :: TestForNonLadder (const RGString& fileName) {
 //	FoundControl = localFileName.FindSubstring ("ladder", position);
 	FoundControl = mPServer->LadderDoesTargetStringContainASynonymCaseIndep (fileName);
 	
-	if ((length > 4) && (Extension == DirectoryManager::DataFileTypeWithDot) && !FoundControl)		//old = if ((length > 4) && (Extension == ".fsa") && !FoundControl)
+	if ((length > 4) && (Extension == DirectoryManager::Settings ().DataFileTypeWithDot) && !FoundControl)		//old = if ((length > 4) && (Extension == ".fsa") && !FoundControl)
 		return TRUE;
 
 	return FALSE;
@@ -287,7 +285,7 @@ Boolean DirectoryManager :: TestForPositiveControl (const RGString& fileName) {
 	FoundPosControl = mPServer->PosControlDoesTargetStringContainASynonymCaseIndep (fileName);
 	FoundLadder = mPServer->LadderDoesTargetStringContainASynonymCaseIndep (fileName);
 	
-	if ((length > 4) && (Extension == DirectoryManager::DataFileTypeWithDot) && FoundPosControl && !FoundLadder)		//old = if ((length > 4) && (Extension == ".fsa") && FoundPosControl && !FoundLadder)
+	if ((length > 4) && (Extension == DirectoryManager::Settings ().DataFileTypeWithDot) && FoundPosControl && !FoundLadder)		//old = if ((length > 4) && (Extension == ".fsa") && FoundPosControl && !FoundLadder)
 		return TRUE;
 
 	return FALSE;
@@ -309,7 +307,7 @@ Boolean DirectoryManager :: TestForNegativeControl (const RGString& fileName) {
 	FoundNegControl = mPServer->NegControlDoesTargetStringContainASynonymCaseIndep (fileName);
 	FoundLadder = mPServer->LadderDoesTargetStringContainASynonymCaseIndep (fileName);
 	
-	if ((length > 4) && (Extension == DirectoryManager::DataFileTypeWithDot) && !FoundPosControl && FoundNegControl && !FoundLadder)		//old = if ((length > 4) && (Extension == ".fsa") && !FoundPosControl && FoundNegControl && !FoundLadder)
+	if ((length > 4) && (Extension == DirectoryManager::Settings ().DataFileTypeWithDot) && !FoundPosControl && FoundNegControl && !FoundLadder)		//old = if ((length > 4) && (Extension == ".fsa") && !FoundPosControl && FoundNegControl && !FoundLadder)
 		return TRUE;
 
 	return FALSE;
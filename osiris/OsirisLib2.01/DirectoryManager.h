@@ -38,6 +38,7 @@
 #include "rgstring.h"
 #include "rgdefs.h"
 #include "rgdlist.h"
+#include "AnalysisContext.h"
 
 class ParameterServer;
 
@@ -66,9 +67,9 @@ public:
 
 	int GetNumberOfFilesInDirectory () const;
 
-	static void SetDataFileType (const RGString& type) { DataFileType = type; DataFileTypeWithDot = "." + type; }
-	static RGString GetDataFileType () { return DataFileType; }
-	static RGString GetDataFileTypeWithDot () { return DataFileTypeWithDot; }
+	static void SetDataFileType (const RGString& type) { Settings ().DataFileType = type; Settings ().DataFileTypeWithDot = "." + type; }
+	static RGString GetDataFileType () { return Settings ().DataFileType; }
+	static RGString GetDataFileTypeWithDot () { return Settings ().DataFileTypeWithDot; }
 
 protected:
 	RGString DirectoryName;
@@ -88,8 +89,7 @@ protected:
 
 
 	static Boolean Cycle;
-	static RGString DataFileType;
-	static RGString DataFileTypeWithDot;
+	static DirectoryManagerSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mDirectoryManager; }
 };
 
 
@@ -1383,6 +1383,7 @@ bool SingleMessage :: Evaluate (const bool* msgArray, RGDList& subObjects) const
 
 bool SingleMessage :: Evaluate (SmartMessagingComm& comm, int numHigherObjects) const {
 
+	SmartMessagingObject::TestForDirectoryDataRead (mScope);
 	int topNum = numHigherObjects - 1;
 	SmartMessagingObject* smo = comm.SMOStack [topNum];
 
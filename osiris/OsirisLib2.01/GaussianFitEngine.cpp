@@ -0,0 +1,148 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: GaussianFitEngine.cpp
+*
+*/
+//
+//  class GaussianFitEngine samples Gaussians by recurrence and forms their inner products with sampled data using the
+//  vector kernels.  See GaussianFitEngine.h
+//
+
+#include "GaussianFitEngine.h"
+#include "SignalKernels.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+
+//  Number of samples between restarts of the recurrence from exp ()
+
+static const int GaussianBlockSize = 16;
+
+//  Exponents beyond this are left to exp () sample by sample:  the recurrence factors would underflow or overflow
+
+static const double MaxRecurrenceExponent = 600.0;
+
+
+void GaussianFitEngine :: SampleGaussian (double first, double spacing, double sigma, int n, double* weights) {
+
+	double v = spacing / sigma;
+	double v2 = v * v;
+	double c = exp (-v2);
+	double u;
+	double g;
+	double r;
+	double e1;
+	double e2;
+	double x;
+	int k;
+	int j;
+	int blockEnd;
+
+	for (k=0; k<n; k=blockEnd) {
+
+		blockEnd = k + GaussianBlockSize;
+
+		if (blockEnd > n)
+			blockEnd = n;
+
+		u = (first + k * spacing) / sigma;
+		e1 = 0.5 * u * u;
+		e2 = u * v + 0.5 * v2;
+
+		if ((e1 > MaxRecurrenceExponent) || (fabs (e2) > MaxRecurrenceExponent)) {
+
+			for (j=k; j<blockEnd; j++) {
+
+				x = (first + j * spacing) / sigma;
+				weights [j] = exp (-0.5 * x * x);
+			}
+
+			continue;
+		}
+
+		g = exp (-e1);
+		r = exp (-e2);
+
+		for (j=k; j<blockEnd; j++) {
+
+			weights [j] = g;
+			g *= r;
+			r *= c;
+		}
+	}
+}
+
+
+double GaussianFitEngine :: TrapezoidInnerProduct (const double* a, const double* b, int n) {
+
+	if (n <= 0)
+		return 0.0;
+
+	int n1 = n - 1;
+	double sum = SignalKernels::VectorDotProduct (a, b, n);
+	return sum - 0.5 * (a [0] * b [0] + a [n1] * b [n1]);
+}
+
+
+double GaussianFitEngine :: GaussianInnerProduct (const double* data, int n, double left, double spacing, double offset, double sigma) {
+
+	double* weights = GetWorkspace (n);
+	SampleGaussian (left - offset, spacing, sigma, n, weights);
+	return TrapezoidInnerProduct (data, weights, n);
+}
+
+
+void GaussianFitEngine :: DoubleGaussianSums (const double* data, int n, double left, double spacing, double offset, double sigma,
+		double sigmaRatio, double& sum, double& sum2, double& sum3, double& sumv1, double& sumv1v2) {
+
+	double* primary = GetWorkspace (n);
+	double* secondary = primary + n;
+	SampleGaussian (left - offset, spacing, sigma, n, primary);
+	SampleGaussian (left - offset, spacing, sigmaRatio * sigma, n, secondary);
+
+	sum = TrapezoidInnerProduct (data, primary, n);
+	sum2 = TrapezoidInnerProduct (data, secondary, n);
+	sum3 = TrapezoidInnerProduct (secondary, secondary, n);
+	sumv1 = TrapezoidInnerProduct (primary, primary, n);
+	sumv1v2 = TrapezoidInnerProduct (primary, secondary, n);
+}
+
+
+double* GaussianFitEngine :: GetWorkspace (int n) {
+
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+
+	if (2 * n > scratch.FitWorkspaceSize) {
+
+		delete[] scratch.FitWorkspace;
+		scratch.FitWorkspaceSize = 2 * n;
+		scratch.FitWorkspace = new double [scratch.FitWorkspaceSize];
+	}
+
+	return scratch.FitWorkspace;
+}
+
@@ -0,0 +1,90 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: GaussianFitEngine.h
+*
+*/
+//
+//  class GaussianFitEngine is the fast alternative to the inner products of NormalizedGaussian and DoubleGaussian with the
+//  sampled data, which are evaluated at every step of the Brent iterations on sigma and mean in FindCharacteristic.  The
+//  legacy functions evaluate exp () twice per sample per Gaussian.  The engine samples each Gaussian in closed form by the
+//  recurrence g (x + h) = g (x) * r (x), r (x + h) = r (x) * exp (-h^2 / sigma^2), restarted from exp () every
+//  GaussianBlockSize samples to bound rounding, and forms the inner products with the vector kernels of SignalKernels.  The
+//  Brent iterations themselves are unchanged:  the engine makes each inner product cheaper, it does not fit the peaks of a
+//  channel together on a sigma grid.
+//
+//  The fast fit is off by default.  It is turned on by <FastGaussianFit>true</FastGaussianFit> in the curve fit parameters
+//  of the standard settings, so that a lab can analyze the same plate both ways and compare them sample by sample.  The
+//  inner products differ from the legacy ones only by rounding, and fitted means, sigmas and heights agree to about 1e-9
+//  relative, well inside ParametricCurve::FitTolerance.  A peak whose fit or width is at a decision threshold can still
+//  come out on the other side, changing its curve, its area or the artifacts reported for it
+//
+
+#ifndef _GAUSSIANFITENGINE_H_
+#define _GAUSSIANFITENGINE_H_
+
+#include "AnalysisContext.h"
+
+class GaussianFitEngine {
+
+public:
+	static bool GetUseFastFit () { return AnalysisContext::GetCurrentSettings ().mGaussianFitEngine.UseFastFit; }
+	static void SetUseFastFit (bool fast) { AnalysisContext::GetCurrentSettings ().mGaussianFitEngine.UseFastFit = fast; }
+
+	//
+	//  weights [k] = exp (-0.5 * ((first + k * spacing) / sigma)^2) for 0 <= k < n
+	//
+
+	static void SampleGaussian (double first, double spacing, double sigma, int n, double* weights);
+
+	//
+	//  Trapezoidal rule sum of a [k] * b [k], 0 <= k < n:  the end points have weight 1/2
+	//
+
+	static double TrapezoidInnerProduct (const double* a, const double* b, int n);
+
+	//
+	//  Unscaled trapezoidal inner product of data [0..n-1] (abscissa of data [0] = left) with the Gaussian of mean offset and
+	//  standard deviation sigma, as computed by NormalizedGaussian::AsymmetricInnerProductWithOffsetAndStandardDeviation
+	//  before normalization
+	//
+
+	static double GaussianInnerProduct (const double* data, int n, double left, double spacing, double offset, double sigma);
+
+	//
+	//  The five unscaled sums of DoubleGaussian:  data with primary and secondary Gaussians, the norm^2 of each and their
+	//  inner product.  The secondary Gaussian has standard deviation sigmaRatio * sigma
+	//
+
+	static void DoubleGaussianSums (const double* data, int n, double left, double spacing, double offset, double sigma,
+		double sigmaRatio, double& sum, double& sum2, double& sum3, double& sumv1, double& sumv1v2);
+
+protected:
+	static double* GetWorkspace (int n);	// room for 2 * n doubles in the scratch state of the current context, reused from call to call
+};
+
+
+#endif  /*  _GAUSSIANFITENGINE_H_  */
+
@@ -45,6 +45,7 @@
 #include "ControlFit.h"
 #include "ListFunctions.h"
 #include "RecursiveInnerProduct.h"
+#include "InnerProductSubsetSearch.h"
 #include "ChannelData.h"
 #include "IndividualGenotype.h"
 #include "SmartMessage.h"
@@ -59,37 +60,6 @@
 
 using namespace std;
 
-double Locus::MinimumFractionOfAverageWidth = 0.5;
-double Locus::MaximumMultipleOfAverageWidth = 2.0; 
-double Locus::MinimumFractionOfAveragePeak = 0.2;
-double Locus::MaximumMultipleOfAveragePeak = -1.0;
-
-double Locus::MinimumFractionOfAverageSampleWidth = 0.2;
-double Locus::MaximumMultipleOfAverageSampleWidth = 3.0; 
-double Locus::MinimumFractionOfAverageSamplePeak = 0.2;
-double Locus::MaximumMultipleOfAverageSamplePeak = -1.0;
-
-double Locus::HeterozygousImbalanceLimit = -1.0;
-double Locus::MinBoundForHomozygote = -1.0;
-
-double Locus::SampleStutterThreshold = 0.15;
-double Locus::SamplePlusStutterThreshold = 0.05;
-double Locus::SampleAdenylationThreshold = 0.3333;
-double Locus::GridStutterThreshold = 0.15;
-double Locus::GridAdenylationThreshold = 0.3333;
-
-double Locus::SampleFractionalFilter = -1.0;
-double Locus::GridFractionalFilter = -1.0;
-double Locus::SamplePullupFractionalFilter = -1.0;
-double Locus::GridPullupFractionalFilter = -1.0;
-bool Locus::ExpectRFUUnitsForHomozygoteBound = true;
-double Locus::MaxResidualForAlleleCalls = -1.0;
-double Locus::AlleleOverloadThreshold = -1.0;
-bool* Locus::InitialMatrix = NULL;
-bool Locus::NoYForAMEL = false;
-
-
-Boolean Locus::TestRatio = TRUE;
 
 
 PERSISTENT_DEFINITION (Allele, _ALLELE_, "Allele")
@@ -253,10 +223,11 @@ void Allele :: Write (RGFile& textOutput, const RGString& indent) {
 
 
 
-Locus :: Locus () : SmartMessagingObject (), mLink (NULL), Linked (FALSE), mSampleAnalysisMap (NULL), mSampleTimeFromBPMap (NULL), 
+Locus :: Locus () : SmartMessagingObject (), mLink (NULL), mAlleleArray (NULL), mAlleleBinIndex (NULL), mNearestAlleleBinIndex (NULL), mFirstAlleleBin (0), mLastAlleleBin (-1), 
+Linked (FALSE), mSampleAnalysisMap (NULL), mSampleTimeFromBPMap (NULL), 
 MaximumSampleTime (0.0), MinimumSampleTime (0.0), mMinTimeForSample (0.0), mMaxTimeForSample (0.0), mTimeForOneIDUnitLeft (0.0),
 mTimeForOneIDUnitRight (0.0), mNumberOfCraters (0), mIsOK (false), mIsAMEL (false), mMinExtendedLocusTime (-1.0), mMaxExtendedLocusTime (-1.0),
-mMaxPeak (0.0) {
+mMaxPeak (0.0), mContext (AnalysisContext::GetCurrentContext ()) {
 
 	mLink = new BaseLocus ();
 	AlleleIterator = new RGDListIterator (AlleleList);
@@ -264,13 +235,15 @@ mMaxPeak (0.0) {
 }
 
 
-Locus :: Locus (BaseLocus* link, const RGString& xmlString) : SmartMessagingObject (), mLink (link), Linked (TRUE),
-mSampleAnalysisMap (NULL), mSampleTimeFromBPMap (NULL), MaximumSampleTime (0.0), MinimumSampleTime (0.0), 
+Locus :: Locus (BaseLocus* link, const RGString& xmlString) : SmartMessagingObject (), mLink (link), mAlleleArray (NULL), mAlleleBinIndex (NULL), mNearestAlleleBinIndex (NULL), mFirstAlleleBin (0), mLastAlleleBin (-1), 
+Linked (TRUE), mSampleAnalysisMap (NULL), mSampleTimeFromBPMap (NULL), MaximumSampleTime (0.0), MinimumSampleTime (0.0), 
 mMinTimeForSample (0.0), mMaxTimeForSample (0.0), mTimeForOneIDUnitLeft (0.0), mTimeForOneIDUnitRight (0.0), 
-mNumberOfCraters (0), mIsOK (false), mIsAMEL (false), mMinExtendedLocusTime (-1.0), mMaxExtendedLocusTime (-1.0), mMaxPeak (0.0) {
+mNumberOfCraters (0), mIsOK (false), mIsAMEL (false), mMinExtendedLocusTime (-1.0), mMaxExtendedLocusTime (-1.0), mMaxPeak (0.0),
+mContext (AnalysisContext::GetCurrentContext ()) {
 
 	AlleleIterator = new RGDListIterator (AlleleList);
 	Valid = BuildAlleleLists (xmlString);
+	BuildAlleleBinIndex ();
 
 	if (link->GetLocusName () == "AMEL")
 		mIsAMEL = true;
@@ -279,11 +252,11 @@ mNumberOfCraters (0), mIsOK (false), mIsAMEL (false), mMinExtendedLocusTime (-1.
 }
 
 
-Locus :: Locus (const Locus& locus) : SmartMessagingObject ((SmartMessagingObject&)locus), mSampleAnalysisMap (NULL), mSampleTimeFromBPMap (NULL), 
-MaximumSampleTime (locus.MaximumSampleTime), MinimumSampleTime (locus.MinimumSampleTime),
+Locus :: Locus (const Locus& locus) : SmartMessagingObject ((SmartMessagingObject&)locus), mAlleleArray (NULL), mAlleleBinIndex (NULL), mNearestAlleleBinIndex (NULL), mFirstAlleleBin (0), mLastAlleleBin (-1), 
+mSampleAnalysisMap (NULL), mSampleTimeFromBPMap (NULL), MaximumSampleTime (locus.MaximumSampleTime), MinimumSampleTime (locus.MinimumSampleTime),
 mMinTimeForSample (0.0), mMaxTimeForSample (0.0), mTimeForOneIDUnitLeft (0.0), mTimeForOneIDUnitRight (0.0), 
 mNumberOfCraters (locus.mNumberOfCraters), mIsOK (locus.mIsOK), mIsAMEL (locus.mIsAMEL), mMinExtendedLocusTime (locus.mMinExtendedLocusTime), 
-mMaxExtendedLocusTime (locus.mMaxExtendedLocusTime), mMaxPeak (locus.mMaxPeak) {
+mMaxExtendedLocusTime (locus.mMaxExtendedLocusTime), mMaxPeak (locus.mMaxPeak), mContext (locus.mContext) {
 
 	AlleleIterator = new RGDListIterator (AlleleList);
 
@@ -303,6 +276,8 @@ mMaxExtendedLocusTime (locus.mMaxExtendedLocusTime), mMaxPeak (locus.mMaxPeak) {
 			BaseAllele::SetSearchByCurve ();
 			AlleleListByCurve.Insert (nextAllele);
 		}
+
+		CopyAlleleBinIndex (locus);
 	}
 
 	else {
@@ -316,10 +291,10 @@ mMaxExtendedLocusTime (locus.mMaxExtendedLocusTime), mMaxPeak (locus.mMaxPeak) {
 }
 
 
-Locus :: Locus (const Locus& locus, CoordinateTransform* trans) : SmartMessagingObject ((SmartMessagingObject&)locus), mSampleAnalysisMap (NULL), mSampleTimeFromBPMap (NULL), 
-MaximumSampleTime (locus.MaximumSampleTime), MinimumSampleTime (locus.MinimumSampleTime),
+Locus :: Locus (const Locus& locus, CoordinateTransform* trans) : SmartMessagingObject ((SmartMessagingObject&)locus), mAlleleArray (NULL), mAlleleBinIndex (NULL), mNearestAlleleBinIndex (NULL), mFirstAlleleBin (0), mLastAlleleBin (-1), 
+mSampleAnalysisMap (NULL), mSampleTimeFromBPMap (NULL), MaximumSampleTime (locus.MaximumSampleTime), MinimumSampleTime (locus.MinimumSampleTime),
 mMinTimeForSample (0.0), mMaxTimeForSample (0.0), mTimeForOneIDUnitLeft (0.0), mTimeForOneIDUnitRight (0.0), mNumberOfCraters (locus.mNumberOfCraters), mIsOK (locus.mIsOK), 
-mIsAMEL (locus.mIsAMEL), mMaxPeak (locus.mMaxPeak) {
+mIsAMEL (locus.mIsAMEL), mMaxPeak (locus.mMaxPeak), mContext (locus.mContext) {
 
 	AlleleIterator = new RGDListIterator (AlleleList);
 
@@ -350,6 +325,7 @@ mIsAMEL (locus.mIsAMEL), mMaxPeak (locus.mMaxPeak) {
 			FinalSignalList.Append ((DataSignal*)nextAllele->GetCurvePointer ());
 		}
 
+		CopyAlleleBinIndex (locus);
 		MaximumSampleTime = trans->EvaluateWithExtrapolation (locus.MaximumSampleTime);
 		MinimumSampleTime = trans->EvaluateWithExtrapolation (locus.MinimumSampleTime);
 		mMinExtendedLocusTime = trans->EvaluateWithExtrapolation (locus.mMinExtendedLocusTime);
@@ -374,6 +350,7 @@ Locus :: ~Locus () {
 	AlleleList.ClearAndDelete ();
 	NonStandardAlleleList.ClearAndDelete ();
 	delete AlleleIterator;
+	ClearAlleleBinIndex ();
 
 	if (!Linked)
 		delete mLink;
@@ -414,6 +391,7 @@ void Locus :: ClearAndDestroy () {
 	AlleleList.ClearAndDelete ();
 	AlleleListByName.Clear ();
 	AlleleListByCurve.Clear ();
+	ClearAlleleBinIndex ();
 }
 
 
@@ -515,6 +493,19 @@ Allele* Locus :: FindAllele (int curve) {
 
 Allele* Locus :: FindAlleleByID (int id) {
 
+	if (mAlleleBinIndex != NULL) {
+
+		if ((id < mFirstAlleleBin) || (id > mLastAlleleBin))
+			return NULL;
+
+		int k = mAlleleBinIndex [id - mFirstAlleleBin];
+
+		if (k < 0)
+			return NULL;
+
+		return mAlleleArray [k];
+	}
+
 	RGDListIterator it (AlleleList);
 	Allele* nextAllele;
 
@@ -530,6 +521,17 @@ Allele* Locus :: FindAlleleByID (int id) {
 
 Allele* Locus :: FindNearestAllele (int id) {
 
+	if (mNearestAlleleBinIndex != NULL) {
+
+		if (id < mFirstAlleleBin)
+			id = mFirstAlleleBin;
+
+		else if (id > mLastAlleleBin)
+			id = mLastAlleleBin;
+
+		return mAlleleArray [mNearestAlleleBinIndex [id - mFirstAlleleBin]];
+	}
+
 	RGDListIterator it (AlleleList);
 	Allele* nextAllele;
 	Allele* nearestAllele = (Allele*) it ();
@@ -971,7 +973,7 @@ int Locus :: AnalyzeGridLocus (RGDList& artifactList, RGDList& originalList, RGD
 	}
 
 	double fractionalThreshold = 0.0;
-	double fractionalFilter = Locus::GetGridFractionalFilter ();
+	double fractionalFilter = mContext->GetSettings ().mLocus.GridFractionalFilter;
 	
 	if (fractionalFilter > 0.0) {
 	
@@ -1078,7 +1080,7 @@ int Locus :: AnalyzeGridLocus (RGDList& artifactList, RGDList& originalList, RGD
 
 		while (FollowingSignal = (DataSignal*)FinalIterator2 ()) {
 
-			if (nextSignal->Peak () <= Locus::GridStutterThreshold * FollowingSignal->Peak ()) {
+			if (nextSignal->Peak () <= mContext->GetSettings ().mLocus.GridStutterThreshold * FollowingSignal->Peak ()) {
 
 				FinalIterator.RemoveCurrentItem ();
 				newNotice = new StutterFound;
@@ -1619,7 +1621,7 @@ int Locus :: AnalyzeSampleLocus (ChannelData* lsData, RGDList& artifactList, RGD
 	RGDListIterator it (LocusSignalList);
 
 	while (nextSignal = (DataSignal*) it())
-		TestSampleAverages (lsData, nextSignal, Locus::TestRatio);
+		TestSampleAverages (lsData, nextSignal, mContext->GetSettings ().mLocus.TestRatio);
 	
 	return 0;
 }
@@ -1638,8 +1640,8 @@ int Locus :: TestFractionalFilters (RGDList& artifactList, RGDList& supplemental
 	double peak;
 	double fractionalThreshold = 0.0;
 	double pullupFractionalThreshold = 0.0;
-	double fractionalFilter = Locus::GetSampleFractionalFilter ();
-	double pullupFractionalFilter = Locus::GetSamplePullupFractionalFilter ();
+	double fractionalFilter = mContext->GetSettings ().mLocus.SampleFractionalFilter;
+	double pullupFractionalFilter = mContext->GetSettings ().mLocus.SamplePullupFractionalFilter;
 	bool peakIsLessThanFractionalThreshold;
 	bool peakIsLessThanPullupFractionalThreshold;
 //	unsigned signalId;
@@ -1898,7 +1900,7 @@ int Locus :: TestInterlocusSignals (RGDList& signalSet, RGDList& artifacts, Chan
 	DataSignal* nextSignal;
 	DataSignal* nextLocusSignal;
 	int repeatNo = mLink->GetCoreNumber ();
-	CoordinateTransform* globalSouthern = laneStd->GetIDMap ();
+	CTransformTable* globalSouthern = laneStd->GetIDTable ();
 	RGDList tempLocus;
 
 	if (globalSouthern == NULL)
@@ -1909,12 +1911,12 @@ int Locus :: TestInterlocusSignals (RGDList& signalSet, RGDList& artifacts, Chan
 
 	firstSignal = (DataSignal*) LocusSignalList.First ();
 	double firstTime = firstSignal->GetMean ();
-	double approxBioID1 = globalSouthern->EvaluateWithExtrapolation (firstTime);
+	double approxBioID1 = globalSouthern->Evaluate (firstTime);
 	double bioID1 = firstSignal->GetBioID ();
 
 	lastSignal = (DataSignal*) LocusSignalList.Last ();
 	double lastTime = lastSignal->GetMean ();
-	double approxBioID2 = globalSouthern->EvaluateWithExtrapolation (lastTime);
+	double approxBioID2 = globalSouthern->Evaluate (lastTime);
 	double bioID2 = lastSignal->GetBioID ();
 
 	RGDListIterator it (signalSet);
@@ -1929,8 +1931,8 @@ int Locus :: TestInterlocusSignals (RGDList& signalSet, RGDList& artifacts, Chan
 	double delTime2;
 	double locusBioID;
 	double locusPeak;
-	double stutterLimit = Locus::GetSampleStutterThreshold ();
-	double adenylationLimit = Locus::GetSampleAdenylationThreshold ();
+	double stutterLimit = mContext->GetSettings ().mLocus.SampleStutterThreshold;
+	double adenylationLimit = mContext->GetSettings ().mLocus.SampleAdenylationThreshold;
 	bool isExtraLocusAllele;
 	RGString data;
 
@@ -1940,7 +1942,7 @@ int Locus :: TestInterlocusSignals (RGDList& signalSet, RGDList& artifacts, Chan
 
 		isExtraLocusAllele = false;
 		mean = nextSignal->GetMean ();
-		approxBioID = globalSouthern->EvaluateWithExtrapolation (mean);
+		approxBioID = globalSouthern->Evaluate (mean);
 		delTime1 = fabs (firstTime - mean);
 		delTime2 = fabs (lastTime - mean);
 		
@@ -2229,8 +2231,8 @@ int Locus :: TestInterlocusSignals (RGDList& signalSet, RGDList& artifacts, RGDL
 	RGDListIterator it (signalSet);
 	double mean;
 	Notice* newNotice;
-	double stutterLimit = Locus::GetSampleStutterThreshold ();
-	double adenylationLimit = Locus::GetSampleAdenylationThreshold ();
+	double stutterLimit = mContext->GetSettings ().mLocus.SampleStutterThreshold;
+	double adenylationLimit = mContext->GetSettings ().mLocus.SampleAdenylationThreshold;
 	RGString data;
 	PossibleUnreportedOLAlleles unreportedNotice;
 
@@ -2556,8 +2558,8 @@ int Locus :: TestNeighbors (DataSignal* previous, DataSignal* testSignal, DataSi
 	Notice* newNotice;
 	RGString info;
 
-	double stutterLimit = Locus::GetGridStutterThreshold ();
-	double adenylationLimit = Locus::GetGridAdenylationThreshold ();
+	double stutterLimit = mContext->GetSettings ().mLocus.GridStutterThreshold;
+	double adenylationLimit = mContext->GetSettings ().mLocus.GridAdenylationThreshold;
 
 /*	if (Width < Locus::MinimumFractionOfAverageWidth * averageWidth) {
 
@@ -2566,7 +2568,7 @@ int Locus :: TestNeighbors (DataSignal* previous, DataSignal* testSignal, DataSi
 	}*/
 /*
 
-	if (Width > Locus::MaximumMultipleOfAverageWidth * averageWidth) {
+	if (Width > mContext->GetSettings ().mLocus.MaximumMultipleOfAverageWidth * averageWidth) {
 
 		NotAcceptable = TRUE;
 		testSignal->AddNoticeToList (OutputLevelManager::SignalTooWide, "", "Signal is too wide for set");
@@ -2576,13 +2578,13 @@ int Locus :: TestNeighbors (DataSignal* previous, DataSignal* testSignal, DataSi
 		testSignal->AddNoticeToList (newNotice);
 	}
 
-	if (peak < Locus::MinimumFractionOfAveragePeak * averagePeak) {
+	if (peak < mContext->GetSettings ().mLocus.MinimumFractionOfAveragePeak * averagePeak) {
 
 		Marginal = TRUE;
 		testSignal->AddNoticeToList (OutputLevelManager::SignalTooLow, "", "Signal is too low for set");
 	}
 
-	if ((Locus::MaximumMultipleOfAveragePeak > 0.0) && (peak > Locus::MaximumMultipleOfAveragePeak * averagePeak)) {
+	if ((mContext->GetSettings ().mLocus.MaximumMultipleOfAveragePeak > 0.0) && (peak > mContext->GetSettings ().mLocus.MaximumMultipleOfAveragePeak * averagePeak)) {
 
 		Marginal = TRUE;
 		testSignal->AddNoticeToList (OutputLevelManager::SignalTooHigh, "", "Signal is too high for set");
@@ -2711,8 +2713,8 @@ int Locus :: TestSampleNeighbors (DataSignal* previous, DataSignal* testSignal,
 	double ThisPeak = testSignal->Peak ();
 	double ThisSigma = testSignal->GetStandardDeviation ();
 
-	double stutterLimit = Locus::GetSampleStutterThreshold ();
-	double adenylationLimit = Locus::GetSampleAdenylationThreshold ();
+	double stutterLimit = mContext->GetSettings ().mLocus.SampleStutterThreshold;
+	double adenylationLimit = mContext->GetSettings ().mLocus.SampleAdenylationThreshold;
 
 	//
 	// test for non-template addition (-A and +A) and for stutter (n - 4 and n + 4)
@@ -3038,8 +3040,8 @@ int Locus :: FinalTestForPeakSizeAndNumber (double averageHeight, Boolean isNegC
 	double peak;
 	double peak2;
 	double temp;
-	double heteroLimit = Locus::GetHeterozygousImbalanceLimit ();
-	double minBoundForHomozygote = Locus::GetMinBoundForHomozygote ();
+	double heteroLimit = mContext->GetSettings ().mLocus.HeterozygousImbalanceLimit;
+	double minBoundForHomozygote = mContext->GetSettings ().mLocus.MinBoundForHomozygote;
 	RGDList alleleList;
 	IndividualAllele* newAllele;
 	RGString alleleName;
@@ -3054,7 +3056,7 @@ int Locus :: FinalTestForPeakSizeAndNumber (double averageHeight, Boolean isNegC
 	bool foundOLAllele = false;
 	ResidualExceedsThreshold residualTarget;
 
-	double minBioID = (double) CoreBioComponent::GetMinBioIDForArtifacts ();
+	double minBioID = (double) mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 
 	if (mIsAMEL) {
 
@@ -3304,9 +3306,9 @@ int Locus :: CorrectCrossChannelAnalyses (RGDList& artifacts, bool isNegCntl) {
 //	int id;
 //	int id2;
 
-	double stutterLimit = Locus::GetSampleStutterThreshold ();
-	double adenylationLimit = Locus::GetSampleAdenylationThreshold ();
-	double pullupFractionalLimit = Locus::GetSamplePullupFractionalFilter ();
+	double stutterLimit = mContext->GetSettings ().mLocus.SampleStutterThreshold;
+	double adenylationLimit = mContext->GetSettings ().mLocus.SampleAdenylationThreshold;
+	double pullupFractionalLimit = mContext->GetSettings ().mLocus.SamplePullupFractionalFilter;
 
 	while (nextSignal = (DataSignal*) it ()) {
 
@@ -3360,7 +3362,7 @@ int Locus :: CorrectCrossChannelAnalyses (RGDList& artifacts, bool isNegCntl) {
 
 	it.Reset ();
 	peakThreshold = pullupFractionalLimit * maxPeak;  // allows ignoring OL allele with "low" peak
-	alleleThreshold = Locus::GetHeterozygousImbalanceLimit () * maxPeak;  // allows ignoring pull-up
+	alleleThreshold = mContext->GetSettings ().mLocus.HeterozygousImbalanceLimit * maxPeak;  // allows ignoring pull-up
 	int N = LocusSignalList.Entries ();
 	double p;
 //	InterchannelLinkage* iChannel;
@@ -3443,7 +3445,7 @@ int Locus :: CleanUpSignalList (RGDList& artifacts) {
 	Notice* newNotice;
 	Notice* oldNotice;
 	double residual;
-	double residualThreshold = Locus::GetMaxResidualForAlleleCalls ();
+	double residualThreshold = mContext->GetSettings ().mLocus.MaxResidualForAlleleCalls;
 	RGString data;
 	Notice* locusLevelResidualMsg;
 	bool addedResidualToLocus = false;
@@ -4318,8 +4320,8 @@ int Locus :: TestProximityArtifacts (RGDList& artifacts, RGDList& type1List, RGD
 	int location;
 	bool removedExtraneousNotices;
 
-	double stutterLimit = Locus::GetSampleStutterThreshold ();
-	double adenylationLimit = Locus::GetSampleAdenylationThreshold ();
+	double stutterLimit = mContext->GetSettings ().mLocus.SampleStutterThreshold;
+	double adenylationLimit = mContext->GetSettings ().mLocus.SampleAdenylationThreshold;
 
 	while (nextSignal = (DataSignal*) it ()) {
 
@@ -5622,6 +5624,132 @@ Boolean Locus :: BuildMappings (RGDList& signalList) {
 }
 
 
+const int LocusMaxAlleleBins = 10000;
+
+
+void Locus :: BuildAlleleBinIndex () {
+
+	//  One bin per integer bp from the smallest to the largest allele id:  the exact allele (first in list order) and the allele
+	//  that the list search in FindNearestAllele would return for that id.  Ids outside the range have the same nearest allele as
+	//  the closest end of the range
+
+	ClearAlleleBinIndex ();
+	int N = AlleleList.Entries ();
+
+	if (N == 0)
+		return;
+
+	mAlleleArray = new Allele* [N];
+	RGDListIterator it (AlleleList);
+	Allele* nextAllele;
+	int i = 0;
+	int id;
+
+	while ((nextAllele = (Allele*) it ())) {
+
+		mAlleleArray [i] = nextAllele;
+		id = nextAllele->GetBioID ();
+
+		if ((i == 0) || (id < mFirstAlleleBin))
+			mFirstAlleleBin = id;
+
+		if ((i == 0) || (id > mLastAlleleBin))
+			mLastAlleleBin = id;
+
+		i++;
+	}
+
+	int nBins = mLastAlleleBin - mFirstAlleleBin + 1;
+
+	if (nBins > LocusMaxAlleleBins) {
+
+		//  Keep the list search
+
+		ClearAlleleBinIndex ();
+		return;
+	}
+
+	mAlleleBinIndex = new int [nBins];
+	mNearestAlleleBinIndex = new int [nBins];
+	int j;
+	int nearest;
+	int nearestDistance;
+	int distance;
+
+	for (j=0; j<nBins; j++)
+		mAlleleBinIndex [j] = -1;
+
+	for (i=N-1; i>=0; i--)
+		mAlleleBinIndex [mAlleleArray [i]->GetBioID () - mFirstAlleleBin] = i;
+
+	for (j=0; j<nBins; j++) {
+
+		id = mFirstAlleleBin + j;
+		nearest = 0;
+		nearestDistance = abs (id - mAlleleArray [0]->GetBioID ());
+
+		for (i=1; i<N; i++) {
+
+			distance = abs (id - mAlleleArray [i]->GetBioID ());
+
+			if (distance > nearestDistance)
+				break;
+
+			nearestDistance = distance;
+			nearest = i;
+		}
+
+		mNearestAlleleBinIndex [j] = nearest;
+	}
+}
+
+
+void Locus :: CopyAlleleBinIndex (const Locus& locus) {
+
+	ClearAlleleBinIndex ();
+	int N = AlleleList.Entries ();
+
+	if ((locus.mAlleleBinIndex == NULL) || (N != locus.AlleleList.Entries ()))
+		return;
+
+	mAlleleArray = new Allele* [N];
+	RGDListIterator it (AlleleList);
+	Allele* nextAllele;
+	int i = 0;
+
+	while ((nextAllele = (Allele*) it ())) {
+
+		mAlleleArray [i] = nextAllele;
+		i++;
+	}
+
+	mFirstAlleleBin = locus.mFirstAlleleBin;
+	mLastAlleleBin = locus.mLastAlleleBin;
+	int nBins = mLastAlleleBin - mFirstAlleleBin + 1;
+	mAlleleBinIndex = new int [nBins];
+	mNearestAlleleBinIndex = new int [nBins];
+
+	for (i=0; i<nBins; i++) {
+
+		mAlleleBinIndex [i] = locus.mAlleleBinIndex [i];
+		mNearestAlleleBinIndex [i] = locus.mNearestAlleleBinIndex [i];
+	}
+}
+
+
+void Locus :: ClearAlleleBinIndex () {
+
+	delete[] mAlleleArray;
+	delete[] mAlleleBinIndex;
+	delete[] mNearestAlleleBinIndex;
+	mAlleleArray = NULL;
+	mAlleleBinIndex = NULL;
+	mNearestAlleleBinIndex = NULL;
+	mFirstAlleleBin = 0;
+	mLastAlleleBin = -1;
+}
+
+
 LaneStandard :: LaneStandard () : RGPersistent (), Linked (FALSE), Valid (FALSE) {
 
 	mLink = new BaseLaneStandard ();
@@ -7517,8 +7645,8 @@ int PopulationMarkerSet :: SearchRecursivelyForBestSubset (RGDList& set, RGDList
 	for (i=0; i<NCandidates; i++)
 		selectionArray [i] = 0;
 
-	RecursiveInnerProduct rightRecursion (set, ideal.mPts, ideal.mDiffs, ideal.mHeightIndices, ideal.mRightNorm2s, setSize, maxHeight, ideal.mDiscrepancy);
-	RecursiveInnerProduct leftRecursion (set, ideal.mPts, ideal.mDiffs, ideal.mHeightIndices, ideal.mLeftNorm2s, setSize, maxHeight, ideal.mDiscrepancy);
+	InnerProductSubsetSearch rightRecursion (set, ideal.mPts, ideal.mDiffs, ideal.mHeightIndices, ideal.mRightNorm2s, setSize, maxHeight, ideal.mDiscrepancy);
+	InnerProductSubsetSearch leftRecursion (set, ideal.mPts, ideal.mDiffs, ideal.mHeightIndices, ideal.mLeftNorm2s, setSize, maxHeight, ideal.mDiscrepancy);
 	rightRecursion.SetSignalIntervalIsAccurate (ideal.mSignalIntervalIsAccurate);
 	leftRecursion.SetSignalIntervalIsAccurate (ideal.mSignalIntervalIsAccurate);
 
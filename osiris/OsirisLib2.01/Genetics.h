@@ -63,6 +63,7 @@
 #include "BaseGenetics.h"
 #include "Notices.h"
 #include "SmartMessagingObject.h"
+#include "AnalysisContext.h"
 
 #include <list>
 
@@ -430,8 +431,10 @@ public:
 	//*******************************************************************************************************
 	//*******************************************************************************************************
 
-	static Boolean GetTestRatio () { return TestRatio; }
-	static void SetTestRatio (Boolean test) { TestRatio = test; }
+	AnalysisContext* GetContext () const { return mContext; }
+
+	static Boolean GetTestRatio () { return Settings ().TestRatio; }
+	static void SetTestRatio (Boolean test) { Settings ().TestRatio = test; }
 
 	static bool ExclusiveOr (bool arg1, bool arg2);
 	static double MaximumPeakHeight (RGDList& incomingList);
@@ -439,50 +442,50 @@ public:
 	static int DivideListByPeakHeight (RGDList& incomingList, RGDList& junkList, RGDList& individualList,
 		double minValue, double maxValue, double factor, int size);
 
-	static void SetHeterozygousImbalanceLimit (double limit) { HeterozygousImbalanceLimit = limit; }
-	static double GetHeterozygousImbalanceLimit () { return HeterozygousImbalanceLimit; }
-	static void SetMinBoundForHomozygote (double minBound) { MinBoundForHomozygote = minBound; }
-	static double GetMinBoundForHomozygote () { return MinBoundForHomozygote; }
-
-	static void SetSampleStutterThreshold (double limit) { if (limit > 0.0) SampleStutterThreshold = limit;  else SampleStutterThreshold = 0.0; }
-	static double GetSampleStutterThreshold () { return SampleStutterThreshold; }
-	static void SetSamplePlusStutterThreshold (double limit) { if (limit > 0.0) SamplePlusStutterThreshold = limit;  else SamplePlusStutterThreshold = 0.0; }
-	static double GetSamplePlusStutterThreshold () { return SamplePlusStutterThreshold; }
-	static void SetGridStutterThreshold (double limit) { GridStutterThreshold = limit; }
-	static double GetGridStutterThreshold () { return GridStutterThreshold; }
-
-	static void SetSampleAdenylationThreshold (double limit) { SampleAdenylationThreshold = limit; }
-	static double GetSampleAdenylationThreshold () { return SampleAdenylationThreshold; }
-	static void SetGridAdenylationThreshold (double limit) { GridAdenylationThreshold = limit; }
-	static double GetGridAdenylationThreshold () { return GridAdenylationThreshold; }
-
-	static void SetSampleFractionalFilter (double limit) { SampleFractionalFilter = limit; }
-	static double GetSampleFractionalFilter () { return SampleFractionalFilter; }
-	static void SetGridFractionalFilter (double limit) { GridFractionalFilter = limit; }
-	static double GetGridFractionalFilter () { return GridFractionalFilter; }
-
-	static void SetSamplePullupFractionalFilter (double limit) { SamplePullupFractionalFilter = limit; }
-	static double GetSamplePullupFractionalFilter () { return SamplePullupFractionalFilter; }
-	static void SetGridPullupFractionalFilter (double limit) { GridPullupFractionalFilter = limit; }
-	static double GetGridPullupFractionalFilter () { return GridPullupFractionalFilter; }
-
-	static void SetExpectRFUUnitsForHomozygoteBound (bool truth) { ExpectRFUUnitsForHomozygoteBound = truth; }
-	static bool GetExpectRFUUnitsForHomozygoteBound () { return ExpectRFUUnitsForHomozygoteBound; }
-
-	static void SetMaxResidualForAlleleCalls (double limit) { MaxResidualForAlleleCalls = limit; }
-	static double GetMaxResidualForAlleleCalls () { return MaxResidualForAlleleCalls; }
-
-	static void SetAlleleOverloadThreshold (double limit) { AlleleOverloadThreshold = limit; }
-	static double GetAlleleOverloadThreshold () { return AlleleOverloadThreshold; }
+	static void SetHeterozygousImbalanceLimit (double limit) { Settings ().HeterozygousImbalanceLimit = limit; }
+	static double GetHeterozygousImbalanceLimit () { return Settings ().HeterozygousImbalanceLimit; }
+	static void SetMinBoundForHomozygote (double minBound) { Settings ().MinBoundForHomozygote = minBound; }
+	static double GetMinBoundForHomozygote () { return Settings ().MinBoundForHomozygote; }
+
+	static void SetSampleStutterThreshold (double limit) { if (limit > 0.0) Settings ().SampleStutterThreshold = limit;  else Settings ().SampleStutterThreshold = 0.0; }
+	static double GetSampleStutterThreshold () { return Settings ().SampleStutterThreshold; }
+	static void SetSamplePlusStutterThreshold (double limit) { if (limit > 0.0) Settings ().SamplePlusStutterThreshold = limit;  else Settings ().SamplePlusStutterThreshold = 0.0; }
+	static double GetSamplePlusStutterThreshold () { return Settings ().SamplePlusStutterThreshold; }
+	static void SetGridStutterThreshold (double limit) { Settings ().GridStutterThreshold = limit; }
+	static double GetGridStutterThreshold () { return Settings ().GridStutterThreshold; }
+
+	static void SetSampleAdenylationThreshold (double limit) { Settings ().SampleAdenylationThreshold = limit; }
+	static double GetSampleAdenylationThreshold () { return Settings ().SampleAdenylationThreshold; }
+	static void SetGridAdenylationThreshold (double limit) { Settings ().GridAdenylationThreshold = limit; }
+	static double GetGridAdenylationThreshold () { return Settings ().GridAdenylationThreshold; }
+
+	static void SetSampleFractionalFilter (double limit) { Settings ().SampleFractionalFilter = limit; }
+	static double GetSampleFractionalFilter () { return Settings ().SampleFractionalFilter; }
+	static void SetGridFractionalFilter (double limit) { Settings ().GridFractionalFilter = limit; }
+	static double GetGridFractionalFilter () { return Settings ().GridFractionalFilter; }
+
+	static void SetSamplePullupFractionalFilter (double limit) { Settings ().SamplePullupFractionalFilter = limit; }
+	static double GetSamplePullupFractionalFilter () { return Settings ().SamplePullupFractionalFilter; }
+	static void SetGridPullupFractionalFilter (double limit) { Settings ().GridPullupFractionalFilter = limit; }
+	static double GetGridPullupFractionalFilter () { return Settings ().GridPullupFractionalFilter; }
+
+	static void SetExpectRFUUnitsForHomozygoteBound (bool truth) { Settings ().ExpectRFUUnitsForHomozygoteBound = truth; }
+	static bool GetExpectRFUUnitsForHomozygoteBound () { return Settings ().ExpectRFUUnitsForHomozygoteBound; }
+
+	static void SetMaxResidualForAlleleCalls (double limit) { Settings ().MaxResidualForAlleleCalls = limit; }
+	static double GetMaxResidualForAlleleCalls () { return Settings ().MaxResidualForAlleleCalls; }
+
+	static void SetAlleleOverloadThreshold (double limit) { Settings ().AlleleOverloadThreshold = limit; }
+	static double GetAlleleOverloadThreshold () { return Settings ().AlleleOverloadThreshold; }
 	static bool RemoveExtraneousNoticesFromSignal (DataSignal* ds);
 
 	static void CreateInitializationData (int scope);
 	static void InitializeMessageMatrix (bool* matrix, int size);
-	static void ClearInitializationMatrix () { delete[] InitialMatrix; InitialMatrix = NULL; }
+	static void ClearInitializationMatrix ();
 	static int GetScope () { return 2; }
 
-	static void SetNoYForAMEL (bool value) { NoYForAMEL = value; }
-	static bool IsNoYForAMEL () { return NoYForAMEL; }
+	static void SetNoYForAMEL (bool value) { Settings ().NoYForAMEL = value; }
+	static bool IsNoYForAMEL () { return Settings ().NoYForAMEL; }
 
 protected:
 	BaseLocus* mLink;
@@ -494,6 +497,12 @@ protected:
 	RGDList mSmartList;
 	RGHashTable NonStandardAlleleList;
 	RGDListIterator* AlleleIterator;
+
+	Allele** mAlleleArray;		// AlleleList, in list order, for the allele bin index (see BuildAlleleBinIndex)
+	int* mAlleleBinIndex;
+	int* mNearestAlleleBinIndex;
+	int mFirstAlleleBin;
+	int mLastAlleleBin;
 	Boolean Valid;
 	RGString ErrorString;
 	Boolean Linked;
@@ -539,40 +548,17 @@ protected:
 	//*******************************************************************************************************
 	//*******************************************************************************************************
 
-	static double MinimumFractionOfAverageWidth;
-	static double MaximumMultipleOfAverageWidth; 
-	static double MinimumFractionOfAveragePeak;
-	static double MaximumMultipleOfAveragePeak;
-
-	static double MinimumFractionOfAverageSampleWidth;
-	static double MaximumMultipleOfAverageSampleWidth; 
-	static double MinimumFractionOfAverageSamplePeak;
-	static double MaximumMultipleOfAverageSamplePeak;
-	static Boolean TestRatio;
-	static double HeterozygousImbalanceLimit;
-	static double MinBoundForHomozygote;
-	static double SampleStutterThreshold;
-	static double SamplePlusStutterThreshold;
-	static double SampleAdenylationThreshold;
-	static double GridStutterThreshold;
-	static double GridAdenylationThreshold;
-
-	static double SampleFractionalFilter;
-	static double GridFractionalFilter;
-
-	static double SamplePullupFractionalFilter;
-	static double GridPullupFractionalFilter;
-
-	static bool ExpectRFUUnitsForHomozygoteBound;
-
-	static double MaxResidualForAlleleCalls;
-	static double AlleleOverloadThreshold;
-	static bool* InitialMatrix;
-	static bool NoYForAMEL;
+	AnalysisContext* mContext;
+
+	static LocusSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mLocus; }
 
 	Boolean BuildAlleleLists (const RGString& xmlString);
 	Boolean BuildMappings (RGDList& signalList);
 
+	void BuildAlleleBinIndex ();
+	void CopyAlleleBinIndex (const Locus& locus);	// locus has the same alleles, in the same order
+	void ClearAlleleBinIndex ();
+
 	// Smart Message functions*******************************************************************************
 	//*******************************************************************************************************
 
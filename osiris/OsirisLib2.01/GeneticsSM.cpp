@@ -2117,7 +2117,7 @@ int Locus :: AnalyzeSampleLocusSM (ChannelData* lsData, RGDList& artifactList, R
 	RGDListIterator it (LocusSignalList);
 
 	while (nextSignal = (DataSignal*) it())
-		TestSampleAveragesSM (lsData, nextSignal, Locus::TestRatio);
+		TestSampleAveragesSM (lsData, nextSignal, mContext->GetSettings ().mLocus.TestRatio);
 	
 	return 0;
 }
@@ -2504,7 +2504,7 @@ int Locus :: TestInterlocusSignalsSM (RGDList& signalSet, RGDList& artifacts, Ch
 	DataSignal* nextSignal;
 	DataSignal* nextLocusSignal;
 	int repeatNo = mLink->GetCoreNumber ();
-	CoordinateTransform* globalSouthern = laneStd->GetIDMap ();
+	CTransformTable* globalSouthern = laneStd->GetIDTable ();
 	RGDList tempLocus;
 
 	if (globalSouthern == NULL)
@@ -2515,12 +2515,12 @@ int Locus :: TestInterlocusSignalsSM (RGDList& signalSet, RGDList& artifacts, Ch
 
 	firstSignal = (DataSignal*) LocusSignalList.First ();
 	double firstTime = firstSignal->GetMean ();
-	double approxBioID1 = globalSouthern->EvaluateWithExtrapolation (firstTime);
+	double approxBioID1 = globalSouthern->Evaluate (firstTime);
 	double bioID1 = firstSignal->GetBioID ();
 
 	lastSignal = (DataSignal*) LocusSignalList.Last ();
 	double lastTime = lastSignal->GetMean ();
-	double approxBioID2 = globalSouthern->EvaluateWithExtrapolation (lastTime);
+	double approxBioID2 = globalSouthern->Evaluate (lastTime);
 	double bioID2 = lastSignal->GetBioID ();
 
 	RGDListIterator it (signalSet);
@@ -2553,7 +2553,7 @@ int Locus :: TestInterlocusSignalsSM (RGDList& signalSet, RGDList& artifacts, Ch
 
 		isExtraLocusAllele = false;
 		mean = nextSignal->GetMean ();
-		approxBioID = globalSouthern->EvaluateWithExtrapolation (mean);
+		approxBioID = globalSouthern->Evaluate (mean);
 		delTime1 = fabs (firstTime - mean);
 		delTime2 = fabs (lastTime - mean);
 		
@@ -3726,15 +3726,16 @@ void Locus :: CreateInitializationData (int scope) {
 	int size = SmartMessage::GetSizeOfArrayForScope (scope);
 	int i;
 	SmartMessage* msg;
-	delete[] InitialMatrix;
-	InitialMatrix = new bool [size];
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().LocusInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = new bool [size];
 
 	for (i=0; i<size; i++) {
 
 		msg = SmartMessage::GetSmartMessageForScopeAndElement (scope, i);
 
 		if (msg != NULL)
-			InitialMatrix [i] = msg->GetInitialValue ();
+			initialMatrix [i] = msg->GetInitialValue ();
 	}
 }
 
@@ -3742,9 +3743,18 @@ void Locus :: CreateInitializationData (int scope) {
 void Locus :: InitializeMessageMatrix (bool* matrix, int size) {
 
 	int i;
+	bool* initialMatrix = AnalysisContext::GetCurrentMessageBook ().LocusInitialMatrix;
 
 	for (i=0; i<size; i++)
-		matrix [i] = InitialMatrix [i];
+		matrix [i] = initialMatrix [i];
+}
+
+
+void Locus :: ClearInitializationMatrix () {
+
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().LocusInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = NULL;
 }
 
 
@@ -3785,7 +3795,7 @@ int Locus :: FinalTestForPeakSizeAndNumberSM (double averageHeight, Boolean isNe
 	smNumberAllelesBelowExpectation numberOfAllelesBelowExpectation;
 	int retValue = 0;
 
-	double minBioID = (double) CoreBioComponent::GetMinBioIDForArtifacts ();
+	double minBioID = (double) mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 	
 	//
 	// Consider eliminating the whole next while loop!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
@@ -4086,7 +4096,7 @@ int Locus :: CleanUpSignalListSM (RGDList& artifacts) {
 	RGDListIterator it (LocusSignalList);
 	DataSignal* nextSignal;
 	double residual;
-	double residualThreshold = Locus::GetMaxResidualForAlleleCalls ();
+	double residualThreshold = mContext->GetSettings ().mLocus.MaxResidualForAlleleCalls;
 	RGString data;
 	bool addedResidualToLocus = false;
 	double absResidual;
@@ -4976,7 +4986,7 @@ void Locus :: TestAllelesAgainstOverloadThresholdSM () {
 	RGDListIterator it (LocusSignalList);
 	DataSignal* nextSignal;
 
-	double alleleOverloadThreshold = Locus::GetAlleleOverloadThreshold ();
+	double alleleOverloadThreshold = mContext->GetSettings ().mLocus.AlleleOverloadThreshold;
 
 	if (alleleOverloadThreshold > 0.0) {
 
@@ -0,0 +1,438 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: InnerProductSubsetSearch.cpp
+*
+*/
+//
+//  class InnerProductSubsetSearch finds the same subset of ILS candidate peaks as the RecursiveInnerProduct tree, depth first and
+//  with correlation bounds, in a node array allocated once per search
+//
+
+#include "InnerProductSubsetSearch.h"
+#include "RecursiveInnerProduct.h"
+#include "DataSignal.h"
+#include "AnalysisTiming.h"
+
+#include <math.h>
+#include <string>
+
+using namespace std;
+
+
+//  A path is abandoned only if its bound is below the best correlation by more than the rounding in the bound
+const double InnerProductBoundTolerance = 1.0e-9;
+
+
+InnerProductSubsetSearch :: InnerProductSubsetSearch (RGDList& signalList, const double* idealPts, const double* idealDiffs, const int* htIndices, const double* idealNorm2s, int setSize, double maxHeight, int allowedDiscrepancy) :
+mArraySize (signalList.Entries ()), mMaximumHeight (maxHeight), mIdealPts (idealPts), mIdealDiffs (idealDiffs), mHeightIndices (htIndices), mIdealNorm2s (idealNorm2s), mSetSize (setSize),
+mSignalIntervalIsAccurate (true), mMinimumSignalRatio (0.7), mMaximumSignalRatio (1.2), mAllowedHeightDiscrepancy (allowedDiscrepancy) {
+
+	mMeans = new double [mArraySize];
+	mPeaks = new double [mArraySize];
+	RGDListIterator it (signalList);
+	DataSignal* nextSignal;
+	int i = 0;
+
+	while ((nextSignal = (DataSignal*) it ())) {
+
+		mMeans [i] = nextSignal->GetMean ();
+		mPeaks [i] = nextSignal->Peak ();
+		i++;
+	}
+
+	Initialize ();
+}
+
+
+InnerProductSubsetSearch :: InnerProductSubsetSearch (const double* means, const double* peaks, int arraySize, const double* idealPts, const double* idealDiffs, const int* htIndices, const double* idealNorm2s, int setSize, double maxHeight, int allowedDiscrepancy) :
+mArraySize (arraySize), mMaximumHeight (maxHeight), mIdealPts (idealPts), mIdealDiffs (idealDiffs), mHeightIndices (htIndices), mIdealNorm2s (idealNorm2s), mSetSize (setSize),
+mSignalIntervalIsAccurate (true), mMinimumSignalRatio (0.7), mMaximumSignalRatio (1.2), mAllowedHeightDiscrepancy (allowedDiscrepancy) {
+
+	mMeans = new double [mArraySize];
+	mPeaks = new double [mArraySize];
+
+	for (int i=0; i<mArraySize; i++) {
+
+		mMeans [i] = means [i];
+		mPeaks [i] = peaks [i];
+	}
+
+	Initialize ();
+}
+
+
+InnerProductSubsetSearch :: ~InnerProductSubsetSearch () {
+
+	delete[] mMeans;
+	delete[] mPeaks;
+	delete[] mCumulativeDiff2s;
+	delete[] mPath;
+	delete[] mBestSelection;
+}
+
+
+int InnerProductSubsetSearch :: BuildFromRight (int ptsRemaining, int extraPts, double clim) {
+
+	if (ptsRemaining < 2)
+		return -1;
+
+	if ((ptsRemaining == 2) && (mHeightIndices == NULL))
+		return -1;
+
+	LogSearch (false, ptsRemaining, extraPts, clim);
+	int status = Search (false, ptsRemaining, extraPts, clim);
+	AnalysisTiming::Count (TIMINGILSSEARCHNODES, mNumberOfNodes);
+	return status;
+}
+
+
+int InnerProductSubsetSearch :: BuildFromLeft (int ptsRemaining, int extraPts, double clim) {
+
+	if (ptsRemaining < 2)
+		return -1;
+
+	if ((ptsRemaining == 2) && (mHeightIndices == NULL))
+		return -1;
+
+	LogSearch (true, ptsRemaining, extraPts, clim);
+	int status = Search (true, ptsRemaining, extraPts, clim);
+	AnalysisTiming::Count (TIMINGILSSEARCHNODES, mNumberOfNodes);
+	return status;
+}
+
+
+void InnerProductSubsetSearch :: SetSignalIntervalIsAccurate (bool accurate) {
+
+	mSignalIntervalIsAccurate = accurate;
+	
+	if (accurate) {
+
+		mMinimumSignalRatio = 0.5;
+		mMaximumSignalRatio = 1.5;
+	}
+
+	else {
+
+		mMinimumSignalRatio = 0.45;
+		mMaximumSignalRatio = 1.5;
+	}
+}
+
+
+double InnerProductSubsetSearch :: GetBestSelection (int* indexVector) const {
+
+	// returns correlation
+
+	if (mBestCorrelation <= 0.0)
+		return 0.0;
+
+	for (int i=0; i<mBestLength; i++)
+		indexVector [mBestSelection [i]] = 1;
+
+	return mBestCorrelation;
+}
+
+
+bool InnerProductSubsetSearch :: OpenSearchLog (const RGString& fileName) {
+
+	CloseSearchLog ();
+	FILE*& searchLog = AnalysisContext::GetCurrentScratch ().SearchLog;
+	searchLog = fopen (fileName.GetData (), "a");
+
+	if (searchLog == NULL) {
+
+		cout << "Could not open ILS search log " << fileName.GetData () << endl;
+		return false;
+	}
+
+	// Each search is written with a single write, so that the searches of several worker processes do not interleave
+
+	setvbuf (searchLog, NULL, _IOFBF, 1 << 20);
+	return true;
+}
+
+
+void InnerProductSubsetSearch :: CloseSearchLog () {
+
+	FILE*& searchLog = AnalysisContext::GetCurrentScratch ().SearchLog;
+
+	if (searchLog != NULL)
+		fclose (searchLog);
+
+	searchLog = NULL;
+}
+
+
+void InnerProductSubsetSearch :: Initialize () {
+
+	int i;
+	mCumulativeDiff2s = new double [mSetSize];
+	mCumulativeDiff2s [0] = 0.0;
+
+	for (i=1; i<mSetSize; i++)
+		mCumulativeDiff2s [i] = mCumulativeDiff2s [i-1] + mIdealDiffs [i-1] * mIdealDiffs [i-1];
+
+	mPath = new InnerProductSearchNode [mSetSize];
+	mBestSelection = new int [mSetSize];
+	mBestLength = 0;
+	mBestCorrelation = 0.0;
+	mNumberOfNodes = 0;
+	mReachedNodeLimit = false;
+}
+
+
+int InnerProductSubsetSearch :: Search (bool fromLeft, int ptsRemaining, int extraPts, double clim) {
+
+	// Visits the nodes of RecursiveInnerProduct::BuildFromLeft (BuildFromRight) in the order in which GetCumulativeCorrelation compares
+	// them, so that, of equal correlations, the first found is kept, as in the tree.  A node that fails a test has correlation 0 and no
+	// descendants that count.
+
+	double clim2 = clim * clim;
+	int step = fromLeft ? 1 : -1;
+	double firstMean = mMeans [0];
+	double lastMean = mMeans [mArraySize - 1];
+	double delFull = lastMean - firstMean;
+	double idealSpan = mIdealPts [mSetSize - 1] - mIdealPts [0];
+	int finalDiffIndex = fromLeft ? ptsRemaining - 2 : mSetSize - ptsRemaining;
+	double finalNorm2 = mIdealNorm2s [finalDiffIndex];
+	int depth;
+	int i;
+	int k;
+	int startSignalIndex;
+	int signalIndex;
+	int idealIndex;
+	int diffIndex;
+	int pts;
+	double diff;
+	double gamma;
+	double norm2;
+	double ip;
+	double remainingDiff2s;
+	double boundCorrelation;
+	double correlation;
+	InnerProductSearchNode* node;
+	InnerProductSearchNode* child;
+	long nodeLimit = GetNodeLimit ();
+
+	mBestLength = 0;
+	mBestCorrelation = 0.0;
+	mNumberOfNodes = 0;
+	mReachedNodeLimit = false;
+
+	for (i=0; i<=extraPts; i++) {
+
+		startSignalIndex = fromLeft ? i : mArraySize - 1 - i;
+		idealIndex = fromLeft ? 0 : mSetSize - 1;
+		mNumberOfNodes++;
+
+		if (RecursiveInnerProduct::HeightOutsideLimit (mHeightIndices, idealIndex, mPeaks [startSignalIndex], mMaximumHeight, mAllowedHeightDiscrepancy))
+			continue;
+
+		node = mPath;
+		node->mSignalIndex = startSignalIndex;
+		node->mIdealIndex = idealIndex;
+		node->mPtsRemaining = ptsRemaining;
+		node->mExtraPts = extraPts - i;
+		node->mNextChild = 0;
+		node->mCumulativeIP = 0.0;
+		node->mCumulativeNorm2 = 0.0;
+		depth = 0;
+
+		while (depth >= 0) {
+
+			node = mPath + depth;
+
+			if (node->mNextChild > node->mExtraPts) {
+
+				depth--;
+				continue;
+			}
+
+			if ((nodeLimit > 0) && (mNumberOfNodes >= nodeLimit)) {
+
+				mReachedNodeLimit = true;
+				cout << "ILS subset search stopped after " << mNumberOfNodes << " nodes; keeping best subset found, with correlation " << mBestCorrelation << endl;
+				return 0;
+			}
+
+			mNumberOfNodes++;
+			k = node->mNextChild;
+			node->mNextChild++;
+			signalIndex = node->mSignalIndex + step * (k + 1);
+			pts = node->mPtsRemaining - 1;
+
+			if (fromLeft) {
+
+				idealIndex = node->mIdealIndex + 1;
+				diffIndex = node->mIdealIndex;
+				diff = mMeans [signalIndex] - mMeans [node->mSignalIndex];
+			}
+
+			else {
+
+				idealIndex = node->mIdealIndex - 1;
+				diffIndex = idealIndex;
+				diff = mMeans [node->mSignalIndex] - mMeans [signalIndex];
+			}
+
+			if (pts > 1) {
+
+				gamma = diff / (mIdealDiffs [diffIndex] / idealSpan);
+
+				if ((gamma <= mMinimumSignalRatio * delFull) || (gamma >= mMaximumSignalRatio * delFull))
+					continue;  // Signal interval is either too small or too large for region
+
+				if (fromLeft) {
+
+					if (gamma >= mMaximumSignalRatio * (lastMean - mMeans [mPath->mSignalIndex]))
+						continue;  // Signal interval is too far right
+				}
+
+				else if (gamma >= mMaximumSignalRatio * (mMeans [mPath->mSignalIndex] - firstMean))
+					continue;  // Signal interval is too far left
+			}
+
+			norm2 = diff * diff + node->mCumulativeNorm2;
+			ip = diff * mIdealDiffs [diffIndex] + node->mCumulativeIP;
+
+			if ((pts > 1) && (ip * ip <= clim2 * norm2 * mIdealNorm2s [diffIndex]))
+				continue;
+
+			if (RecursiveInnerProduct::HeightOutsideLimit (mHeightIndices, idealIndex, mPeaks [signalIndex], mMaximumHeight, mAllowedHeightDiscrepancy))
+				continue;
+
+			if (pts <= 1) {
+
+				correlation = ip / sqrt (norm2 * mIdealNorm2s [diffIndex]);
+
+				if (correlation > mBestCorrelation) {
+
+					mBestCorrelation = correlation;
+
+					for (mBestLength=0; mBestLength<=depth; mBestLength++)
+						mBestSelection [mBestLength] = mPath [mBestLength].mSignalIndex;
+
+					mBestSelection [mBestLength] = signalIndex;
+					mBestLength++;
+				}
+
+				continue;
+			}
+
+			if ((mBestCorrelation > 0.0) && (norm2 > 0.0)) {
+
+				// Any completion of this path has correlation at most boundCorrelation
+
+				if (fromLeft)
+					remainingDiff2s = mCumulativeDiff2s [finalDiffIndex + 1] - mCumulativeDiff2s [diffIndex + 1];
+
+				else
+					remainingDiff2s = mCumulativeDiff2s [diffIndex] - mCumulativeDiff2s [finalDiffIndex];
+
+				boundCorrelation = sqrt ((ip * ip / norm2 + remainingDiff2s) / finalNorm2);
+
+				if (boundCorrelation < mBestCorrelation - InnerProductBoundTolerance)
+					continue;
+			}
+
+			depth++;
+			child = mPath + depth;
+			child->mSignalIndex = signalIndex;
+			child->mIdealIndex = idealIndex;
+			child->mPtsRemaining = pts;
+			child->mExtraPts = node->mExtraPts - k;
+			child->mNextChild = 0;
+			child->mCumulativeIP = ip;
+			child->mCumulativeNorm2 = norm2;
+		}
+	}
+
+	return 0;
+}
+
+
+void InnerProductSubsetSearch :: LogSearch (bool fromLeft, int ptsRemaining, int extraPts, double clim) const {
+
+	FILE* searchLog = AnalysisContext::GetCurrentScratch ().SearchLog;
+
+	if (searchLog == NULL)
+		return;
+
+	string record;
+	char buffer [256];
+	int i;
+
+	snprintf (buffer, sizeof (buffer), "ILSSearch %d %d %d %d %d %.17g %.17g %d %d\n", fromLeft ? 1 : 0, mSetSize, mArraySize, ptsRemaining, extraPts, clim, mMaximumHeight, mAllowedHeightDiscrepancy, mSignalIntervalIsAccurate ? 1 : 0);
+	record += buffer;
+
+	for (i=0; i<mSetSize; i++) {
+
+		snprintf (buffer, sizeof (buffer), " %.17g", mIdealPts [i]);
+		record += buffer;
+	}
+
+	record += "\n";
+
+	for (i=0; i<mSetSize-1; i++) {
+
+		snprintf (buffer, sizeof (buffer), " %.17g", mIdealDiffs [i]);
+		record += buffer;
+	}
+
+	record += "\n";
+
+	for (i=0; i<mSetSize-1; i++) {
+
+		snprintf (buffer, sizeof (buffer), " %.17g", mIdealNorm2s [i]);
+		record += buffer;
+	}
+
+	record += "\n";
+
+	if (mHeightIndices == NULL)
+		record += " none";
+
+	else {
+
+		for (i=0; i<mSetSize; i++) {
+
+			snprintf (buffer, sizeof (buffer), " %d", mHeightIndices [i]);
+			record += buffer;
+		}
+	}
+
+	record += "\n";
+
+	for (i=0; i<mArraySize; i++) {
+
+		snprintf (buffer, sizeof (buffer), " %.17g %.17g", mMeans [i], mPeaks [i]);
+		record += buffer;
+	}
+
+	record += "\n";
+	fwrite (record.data (), 1, record.length (), searchLog);
+	fflush (searchLog);
+}
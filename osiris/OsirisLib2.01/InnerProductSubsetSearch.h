@@ -0,0 +1,113 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: InnerProductSubsetSearch.h
+*
+*/
+//
+//  class InnerProductSubsetSearch finds the same subset of ILS candidate peaks as the RecursiveInnerProduct tree, with the same
+//  tests (signal interval ratios, cumulative inner product criterion, relative heights) and the same choice among equal correlations,
+//  but without building the tree.  It walks the candidate paths depth first in the order of the tree, keeping only the current path in
+//  a node array allocated once, and it abandons a path as soon as the best correlation that any completion of it could reach (by the
+//  Cauchy-Schwarz inequality, from the squared ideal differences not yet used) is below the best correlation already found.  The
+//  number of nodes visited per search can be capped (SetNodeLimit; the default, 0, is no limit); a search that reaches the cap keeps
+//  the best subset found so far.  If a search log is open, each search appends its input, which ILSSearchBenchmark replays
+//
+
+#ifndef _INNERPRODUCTSUBSETSEARCH_H_
+#define _INNERPRODUCTSUBSETSEARCH_H_
+
+#include "rgdlist.h"
+#include "rgstring.h"
+#include "AnalysisContext.h"
+
+#include <stdio.h>
+
+
+struct InnerProductSearchNode {
+
+	int mSignalIndex;
+	int mIdealIndex;
+	int mPtsRemaining;
+	int mExtraPts;
+	int mNextChild;
+	double mCumulativeIP;
+	double mCumulativeNorm2;
+};
+
+
+class InnerProductSubsetSearch {
+
+public:
+	InnerProductSubsetSearch (RGDList& signalList, const double* idealPts, const double* idealDiffs, const int* htIndices, const double* idealNorm2s, int setSize, double maxHeight, int allowedDiscrepancy);
+	InnerProductSubsetSearch (const double* means, const double* peaks, int arraySize, const double* idealPts, const double* idealDiffs, const int* htIndices, const double* idealNorm2s, int setSize, double maxHeight, int allowedDiscrepancy);
+	~InnerProductSubsetSearch ();
+
+	int BuildFromRight (int ptsRemaining, int extraPts, double clim);
+	int BuildFromLeft (int ptsRemaining, int extraPts, double clim);
+	void SetSignalIntervalIsAccurate (bool accurate);
+
+	double GetBestSelection (int* indexVector) const;  // returns correlation
+	double GetCumulativeCorrelation () const { return mBestCorrelation; }
+	long GetNumberOfNodes () const { return mNumberOfNodes; }
+	bool ReachedNodeLimit () const { return mReachedNodeLimit; }
+
+	static void SetNodeLimit (long limit) { AnalysisContext::GetCurrentSettings ().mSubsetSearch.NodeLimit = limit; }
+	static long GetNodeLimit () { return AnalysisContext::GetCurrentSettings ().mSubsetSearch.NodeLimit; }
+	static bool OpenSearchLog (const RGString& fileName);
+	static void CloseSearchLog ();
+
+protected:
+	double* mMeans;
+	double* mPeaks;
+	int mArraySize;
+	double mMaximumHeight;
+
+	const double* mIdealPts;
+	const double* mIdealDiffs;
+	const int* mHeightIndices;
+	const double* mIdealNorm2s;
+	int mSetSize;
+	double* mCumulativeDiff2s;	// mCumulativeDiff2s [i] = sum of squares of mIdealDiffs [0 ... i-1]
+
+	bool mSignalIntervalIsAccurate;
+	double mMinimumSignalRatio;
+	double mMaximumSignalRatio;
+	int mAllowedHeightDiscrepancy;
+
+	InnerProductSearchNode* mPath;
+	int* mBestSelection;
+	int mBestLength;
+	double mBestCorrelation;
+	long mNumberOfNodes;
+	bool mReachedNodeLimit;
+
+	void Initialize ();
+	int Search (bool fromLeft, int ptsRemaining, int extraPts, double clim);
+	void LogSearch (bool fromLeft, int ptsRemaining, int extraPts, double clim) const;
+};
+
+
+#endif  /*  _INNERPRODUCTSUBSETSEARCH_H_  */
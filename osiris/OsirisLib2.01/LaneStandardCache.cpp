@@ -0,0 +1,675 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: LaneStandardCache.cpp
+*
+*/
+//
+//  class LaneStandardCache keeps ILS peak selections of earlier analyses for reuse.  See LaneStandardCache.h
+//
+
+#include "LaneStandardCache.h"
+#include "Genetics.h"
+#include "DataSignal.h"
+#include "OsirisVersion.h"
+#include "rgindexedlabel.h"
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+using namespace std;
+
+
+bool LaneStandardCache::mIsOpen = false;
+RGString LaneStandardCache::mFullPath;
+map<string, LaneStandardSelection*> LaneStandardCache::mSelections;
+
+
+//  Two 32 bit FNV-1a hashes with different offsets make up the 64 bit key
+
+struct LaneStandardCacheHash {
+
+	unsigned int h1;
+	unsigned int h2;
+
+	LaneStandardCacheHash () : h1 (2166136261u), h2 (84696351u) {}
+
+	void AddBytes (const void* data, size_t n) {
+
+		const unsigned char* p = (const unsigned char*) data;
+
+		for (size_t i=0; i<n; i++) {
+
+			h1 = (h1 ^ p [i]) * 16777619u;
+			h2 = (h2 ^ p [i]) * 16777619u;
+		}
+	}
+
+	void Add (double d) { AddBytes (&d, sizeof (double)); }
+	void Add (int i) { AddBytes (&i, sizeof (int)); }
+
+	void Add (const double* array, int n) {
+
+		Add (n);
+
+		if (array != NULL && n > 0)
+			AddBytes (array, n * sizeof (double));
+	}
+
+	void Add (const int* array, int n) {
+
+		Add (n);
+
+		if (array != NULL && n > 0)
+			AddBytes (array, n * sizeof (int));
+	}
+};
+
+
+static bool ListToIndices (RGDList& candidates, RGDList& list, vector<int>& indices) {
+
+	RGDListIterator it (candidates);
+	RGDListIterator listIt (list);
+	DataSignal* nextSignal;
+	DataSignal* nextInList;
+	int j;
+
+	indices.clear ();
+
+	while ((nextInList = (DataSignal*) listIt ())) {
+
+		it.Reset ();
+		j = 0;
+
+		while ((nextSignal = (DataSignal*) it ())) {
+
+			if (nextSignal == nextInList)
+				break;
+
+			j++;
+		}
+
+		if (nextSignal == NULL)
+			return false;
+
+		indices.push_back (j);
+	}
+
+	return true;
+}
+
+
+static void FormatIndices (RGString& line, const vector<int>& indices) {
+
+	size_t i;
+
+	if (indices.empty ()) {
+
+		line << "-";
+		return;
+	}
+
+	for (i=0; i<indices.size (); i++) {
+
+		if (i > 0)
+			line << ",";
+
+		line << indices [i];
+	}
+}
+
+
+static bool ParseIndices (char*& p, vector<int>& indices, int nCandidates) {
+
+	//  p points to a list of indices followed by a tab; on return, p points to the tab
+
+	int index;
+	indices.clear ();
+
+	if (*p == '-') {
+
+		p++;
+		return (*p == '\t');
+	}
+
+	while (true) {
+
+		index = (int) strtol (p, &p, 10);
+
+		if ((index < 0) || (index >= nCandidates))
+			return false;
+
+		indices.push_back (index);
+
+		if (*p != ',')
+			break;
+
+		p++;
+	}
+
+	return (*p == '\t');
+}
+
+
+static void FormatNoticeString (RGString& line, const RGString& str) {
+
+	//  Characters that separate fields, and %, are written as %XX
+
+	const char* p = str.GetData ();
+	char buffer [4];
+
+	for (; *p != '\0'; p++) {
+
+		if (strchr ("%,:\t\n\r", *p) != NULL) {
+
+			sprintf (buffer, "%%%02X", (unsigned char) *p);
+			line << buffer;
+		}
+
+		else {
+
+			buffer [0] = *p;
+			buffer [1] = '\0';
+			line << buffer;
+		}
+	}
+}
+
+
+static bool ParseNoticeString (char*& p, RGString& str) {
+
+	//  On return, p points to the separator that ends the string
+
+	string result;
+	char hex [3];
+	char* end;
+
+	while ((*p != '\0') && (strchr (",:\t", *p) == NULL)) {
+
+		if (*p == '%') {
+
+			if ((p [1] == '\0') || (p [2] == '\0'))
+				return false;
+
+			hex [0] = p [1];
+			hex [1] = p [2];
+			hex [2] = '\0';
+			result += (char) strtol (hex, &end, 16);
+
+			if (*end != '\0')
+				return false;
+
+			p += 3;
+		}
+
+		else
+			result += *p++;
+	}
+
+	str = result.c_str ();
+	return true;
+}
+
+
+LaneStandardSelection :: LaneStandardSelection () : mReducedPeaks (-1), mReducedMinPeak (0.0), mReducedMaxPeak (0.0), mFinallyReducedPeaks (-1),
+mRelativeHeightsInconsistent (false), mCouldNotPareDown (false), mCouldNotPareDownForMethod1 (false), mNumberOfCandidates (0) {
+
+}
+
+
+LaneStandardSelection :: LaneStandardSelection (const RGString& key) : mReducedPeaks (-1), mReducedMinPeak (0.0), mReducedMaxPeak (0.0),
+mFinallyReducedPeaks (-1), mRelativeHeightsInconsistent (false), mCouldNotPareDown (false), mCouldNotPareDownForMethod1 (false), mKey (key),
+mNumberOfCandidates (0) {
+
+}
+
+
+LaneStandardSelection :: ~LaneStandardSelection () {
+
+}
+
+
+void LaneStandardSelection :: RecordNoticesBefore (RGDList& candidates) {
+
+	RGDListIterator it (candidates);
+	DataSignal* nextSignal;
+	RGPersistent* nextNotice;
+
+	mNumberOfCandidates = candidates.Entries ();
+	mNewNotices.clear ();
+	mNoticesBefore.clear ();
+
+	while ((nextSignal = (DataSignal*) it ())) {
+
+		mNoticesBefore.push_back (vector<RGPersistent*> ());
+		RGDListIterator noticeIt (nextSignal->GetNoticeList ());
+
+		while ((nextNotice = noticeIt ()))
+			mNoticesBefore.back ().push_back (nextNotice);
+	}
+}
+
+
+bool LaneStandardSelection :: Finish (RGDList& candidates, RGDList& selected, RGDList& rejected) {
+
+	RGDListIterator it (candidates);
+	DataSignal* nextSignal;
+	RGIndexedLabel* nextNotice;
+	LaneStandardNotice newNotice;
+	int i = 0;
+
+	if ((candidates.Entries () != mNumberOfCandidates) || ((int) mNoticesBefore.size () != mNumberOfCandidates))
+		return false;
+
+	mNewNotices.clear ();
+
+	while ((nextSignal = (DataSignal*) it ())) {
+
+		const vector<RGPersistent*>& before = mNoticesBefore [i];
+		RGDListIterator noticeIt (nextSignal->GetNoticeList ());
+
+		while ((nextNotice = (RGIndexedLabel*) noticeIt ())) {
+
+			if (find (before.begin (), before.end (), (RGPersistent*) nextNotice) != before.end ())
+				continue;
+
+			newNotice.mCandidate = i;
+			newNotice.mLevel = nextNotice->GetIndex ();
+			newNotice.mLabel = nextNotice->GetLabel ();
+			newNotice.mText = nextNotice->GetText ();
+			mNewNotices.push_back (newNotice);
+		}
+
+		i++;
+	}
+
+	mNoticesBefore.clear ();
+
+	if (!ListToIndices (candidates, selected, mSelectedIndices))
+		return false;
+
+	return ListToIndices (candidates, rejected, mRejectedIndices);
+}
+
+
+bool LaneStandardSelection :: Restore (RGDList& candidates, RGDList& selected, RGDList& rejected) const {
+
+	if (candidates.Entries () != mNumberOfCandidates)
+		return false;
+
+	vector<DataSignal*> candidateArray;
+	RGDListIterator it (candidates);
+	DataSignal* nextSignal;
+	size_t i;
+	int k;
+
+	while ((nextSignal = (DataSignal*) it ()))
+		candidateArray.push_back (nextSignal);
+
+	selected.Clear ();
+	rejected.Clear ();
+
+	for (i=0; i<mSelectedIndices.size (); i++)
+		selected.Append (candidateArray [mSelectedIndices [i]]);
+
+	for (i=0; i<mRejectedIndices.size (); i++)
+		rejected.Append (candidateArray [mRejectedIndices [i]]);
+
+	//  A notice is inserted ahead of those of the same level, so adding them in reverse list order leaves each candidate's
+	//  list as the search did
+
+	for (k=(int)mNewNotices.size ()-1; k>=0; k--) {
+
+		const LaneStandardNotice& notice = mNewNotices [k];
+		candidateArray [notice.mCandidate]->AddNoticeToList (notice.mLevel, notice.mLabel, notice.mText);
+	}
+
+	return true;
+}
+
+
+RGString LaneStandardSelection :: Format () const {
+
+	RGString line (mKey);
+	char buffer [128];
+	int flags = 0;
+	size_t i;
+
+	if (mRelativeHeightsInconsistent)
+		flags |= 1;
+
+	if (mCouldNotPareDown)
+		flags |= 2;
+
+	if (mCouldNotPareDownForMethod1)
+		flags |= 4;
+
+	sprintf (buffer, "\t%d\t%d\t%d\t%.17g\t%.17g\t%d\t", mNumberOfCandidates, flags, mReducedPeaks, mReducedMinPeak, mReducedMaxPeak, mFinallyReducedPeaks);
+	line << buffer;
+	FormatIndices (line, mSelectedIndices);
+	line << "\t";
+	FormatIndices (line, mRejectedIndices);
+	line << "\t";
+
+	for (i=0; i<mNewNotices.size (); i++) {
+
+		const LaneStandardNotice& notice = mNewNotices [i];
+
+		if (i > 0)
+			line << ",";
+
+		sprintf (buffer, "%d:%lu:", notice.mCandidate, notice.mLevel);
+		line << buffer;
+		FormatNoticeString (line, notice.mLabel);
+		line << ":";
+		FormatNoticeString (line, notice.mText);
+	}
+
+	if (mNewNotices.empty ())
+		line << "-";
+
+	line << "\tend\n";	// marks a complete entry
+	return line;
+}
+
+
+LaneStandardSelection* LaneStandardSelection :: Parse (const char* line) {
+
+	const char* tab = strchr (line, '\t');
+
+	if (tab == NULL)
+		return NULL;
+
+	string key (line, tab - line);
+	LaneStandardSelection* selection = new LaneStandardSelection (RGString (key.c_str ()));
+	char* p;
+	int flags;
+	LaneStandardNotice notice;
+	bool ok = true;
+
+	selection->mNumberOfCandidates = (int) strtol (tab + 1, &p, 10);
+	flags = (int) strtol (p, &p, 10);
+	selection->mReducedPeaks = (int) strtol (p, &p, 10);
+	selection->mReducedMinPeak = strtod (p, &p);
+	selection->mReducedMaxPeak = strtod (p, &p);
+	selection->mFinallyReducedPeaks = (int) strtol (p, &p, 10);
+	selection->mRelativeHeightsInconsistent = ((flags & 1) != 0);
+	selection->mCouldNotPareDown = ((flags & 2) != 0);
+	selection->mCouldNotPareDownForMethod1 = ((flags & 4) != 0);
+
+	if ((*p != '\t') || (selection->mNumberOfCandidates <= 0) || (selection->mNumberOfCandidates > LANESTANDARDCACHE_MAXCANDIDATES)) {
+
+		delete selection;
+		return NULL;
+	}
+
+	p++;
+
+	if (!ParseIndices (p, selection->mSelectedIndices, selection->mNumberOfCandidates)) {
+
+		delete selection;
+		return NULL;
+	}
+
+	p++;
+
+	if (!ParseIndices (p, selection->mRejectedIndices, selection->mNumberOfCandidates)) {
+
+		delete selection;
+		return NULL;
+	}
+
+	p++;
+
+	if (*p == '-')
+		p++;
+
+	else {
+
+		while (true) {
+
+			notice.mCandidate = (int) strtol (p, &p, 10);
+
+			if ((*p != ':') || (notice.mCandidate < 0) || (notice.mCandidate >= selection->mNumberOfCandidates)) {
+
+				ok = false;
+				break;
+			}
+
+			notice.mLevel = strtoul (p + 1, &p, 10);
+
+			if ((*p != ':') || !ParseNoticeString (++p, notice.mLabel) || (*p != ':') || !ParseNoticeString (++p, notice.mText)) {
+
+				ok = false;
+				break;
+			}
+
+			selection->mNewNotices.push_back (notice);
+
+			if (*p != ',')
+				break;
+
+			p++;
+		}
+	}
+
+	if (!ok || (strcmp (p, "\tend") != 0)) {
+
+		delete selection;
+		return NULL;
+	}
+
+	return selection;
+}
+
+
+
+int LaneStandardCache :: Open (const RGString& fullPath) {
+
+	Close ();
+	mFullPath = fullPath;
+	RGString header = FileHeader ();
+	FILE* file = fopen (fullPath.GetData (), "rb");
+	int n = 0;
+
+	if (file != NULL) {
+
+		fseek (file, 0, SEEK_END);
+		long size = ftell (file);
+		fseek (file, 0, SEEK_SET);
+		char* contents = new char [size + 1];
+		size_t nRead = fread (contents, 1, size, file);
+		contents [nRead] = '\0';
+		fclose (file);
+
+		//  Entries written by other versions are discarded
+
+		if (strncmp (contents, header.GetData (), header.Length ()) == 0) {
+
+			char* line = contents + header.Length ();
+			char* end;
+			LaneStandardSelection* selection;
+
+			while (*line != '\0') {
+
+				end = strchr (line, '\n');
+
+				if (end == NULL) {
+
+					//  Incomplete last entry:  start the next one on a new line
+
+					file = fopen (fullPath.GetData (), "ab");
+
+					if (file != NULL) {
+
+						fwrite ("\n", 1, 1, file);
+						fclose (file);
+					}
+
+					break;
+				}
+
+				*end = '\0';
+				selection = LaneStandardSelection::Parse (line);
+
+				if (selection != NULL) {
+
+					string key (selection->GetKey ().GetData ());
+
+					if (mSelections.find (key) == mSelections.end ()) {
+
+						mSelections [key] = selection;
+						n++;
+					}
+
+					else
+						delete selection;
+				}
+
+				line = end + 1;
+			}
+
+			delete[] contents;
+			mIsOpen = true;
+			return n;
+		}
+
+		delete[] contents;
+	}
+
+	file = fopen (fullPath.GetData (), "wb");
+
+	if (file == NULL) {
+
+		cout << "Could not open ILS cache file " << fullPath.GetData () << ".  ILS selections will not be reused" << endl;
+		return -1;
+	}
+
+	fwrite (header.GetData (), 1, header.Length (), file);
+	fclose (file);
+	mIsOpen = true;
+	return 0;
+}
+
+
+void LaneStandardCache :: Close () {
+
+	map<string, LaneStandardSelection*>::iterator it;
+
+	for (it=mSelections.begin (); it!=mSelections.end (); it++)
+		delete it->second;
+
+	mSelections.clear ();
+	mIsOpen = false;
+}
+
+
+RGString LaneStandardCache :: MakeKey (LaneStandard* ls, const DataSignal* data, RGDList& candidates, double maxPeak) {
+
+	LaneStandardCacheHash hash;
+	RGString name = ls->GetLaneStandardName ();
+	const double* array;
+	const int* heights;
+	int n;
+
+	if (data != NULL)
+		hash.Add (data->GetData (), data->GetNumberOfSamples ());
+
+	hash.AddBytes (name.GetData (), name.Length ());
+	n = ls->GetCharacteristicArray (array);
+	hash.Add (array, n);
+	n = ls->GetUnnormalizedCharacteristicDifferenceArray (array);
+	hash.Add (array, n);
+	n = ls->GetNormsSquaredLeft (array);
+	hash.Add (array, n);
+	n = ls->GetNormsSquaredRight (array);
+	hash.Add (array, n);
+	n = ls->GetRelativeHeights (heights);
+	hash.Add (heights, n);
+	hash.Add (ls->GetMaxRelativeHeight ());
+	hash.Add (ls->GetCorrelationAcceptanceThreshold ());
+	hash.Add (ls->GetCorrelationAutoAcceptanceThreshold ());
+	hash.Add (maxPeak);
+	hash.Add (candidates.Entries ());
+
+	RGDListIterator it (candidates);
+	DataSignal* nextSignal;
+
+	while ((nextSignal = (DataSignal*) it ())) {
+
+		hash.Add (nextSignal->GetMean ());
+		hash.Add (nextSignal->Peak ());
+	}
+
+	char buffer [24];
+	sprintf (buffer, "%08x%08x", hash.h1, hash.h2);
+	return RGString (buffer);
+}
+
+
+const LaneStandardSelection* LaneStandardCache :: Find (const RGString& key) {
+
+	map<string, LaneStandardSelection*>::const_iterator it = mSelections.find (string (key.GetData ()));
+
+	if (it == mSelections.end ())
+		return NULL;
+
+	return it->second;
+}
+
+
+int LaneStandardCache :: Save (LaneStandardSelection* selection) {
+
+	string key (selection->GetKey ().GetData ());
+
+	if (!mIsOpen || (mSelections.find (key) != mSelections.end ())) {
+
+		delete selection;
+		return -1;
+	}
+
+	mSelections [key] = selection;
+	RGString line = selection->Format ();
+	FILE* file = fopen (mFullPath.GetData (), "ab");
+
+	if (file == NULL)
+		return -1;
+
+	fwrite (line.GetData (), 1, line.Length (), file);
+	fclose (file);
+	return 0;
+}
+
+
+RGString LaneStandardCache :: FileHeader () {
+
+	RGString header ("Osiris ILS cache 3 ");
+	header << OSIRIS_VERSION << "\n";
+	return header;
+}
+
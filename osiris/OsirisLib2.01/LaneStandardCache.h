@@ -0,0 +1,123 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: LaneStandardCache.h
+*
+*/
+//
+//  class LaneStandardCache keeps the ILS peak selections of earlier analyses of a directory in a file next to the reports, so
+//  that a reanalysis (for example, after a change to sample thresholds) can skip the recursive subset search of the density
+//  method.  An entry is keyed by a hash of the ILS channel trace, of the lane standard definition and of the height and time
+//  of every candidate peak, so it is found only if the search would start from exactly the same input file and the settings
+//  that shape the candidates (thresholds, raw or analyzed data, fit parameters) leave them unchanged.  The entry records which candidates were selected or
+//  rejected and everything else the search leaves behind (the notices it added to each candidate, the relative height message
+//  and the paring log lines), so that a cached selection produces the same output as the search.  Only successful selections
+//  are cached.  Entries are appended with a single write, one line each, so that worker processes can share the file
+//
+
+#ifndef _LANESTANDARDCACHE_H_
+#define _LANESTANDARDCACHE_H_
+
+#include "rgstring.h"
+#include "rgdlist.h"
+
+#include <map>
+#include <vector>
+#include <string>
+
+using namespace std;
+
+class LaneStandard;
+class DataSignal;
+class RGPersistent;
+
+const int LANESTANDARDCACHE_MAXCANDIDATES = 100000;	// entries with more candidates are not read
+
+
+struct LaneStandardNotice {
+
+	int mCandidate;
+	unsigned long mLevel;
+	RGString mLabel;
+	RGString mText;
+};
+
+
+class LaneStandardSelection {
+
+public:
+	LaneStandardSelection (const RGString& key);
+	~LaneStandardSelection ();
+
+	RGString GetKey () const { return mKey; }
+
+	void RecordNoticesBefore (RGDList& candidates);	// call before the search
+	bool Finish (RGDList& candidates, RGDList& selected, RGDList& rejected);	// call after a successful search; false if selection cannot be cached
+	bool Restore (RGDList& candidates, RGDList& selected, RGDList& rejected) const;	// repopulates lists and replays notices; false if candidates do not match
+
+	RGString Format () const;
+	static LaneStandardSelection* Parse (const char* line);	// NULL if line cannot be parsed
+
+	int mReducedPeaks;		// "Reduced number of peaks..." log line, or -1 if none
+	double mReducedMinPeak;
+	double mReducedMaxPeak;
+	int mFinallyReducedPeaks;	// "Finally reduced number of peaks..." log line, or -1 if none
+	bool mRelativeHeightsInconsistent;
+	bool mCouldNotPareDown;
+	bool mCouldNotPareDownForMethod1;
+
+protected:
+	RGString mKey;
+	int mNumberOfCandidates;
+	vector<int> mSelectedIndices;	// indices of selected peaks in candidate list, in selection order
+	vector<int> mRejectedIndices;	// indices of peaks removed by paring down and by the search
+	vector<LaneStandardNotice> mNewNotices;	// notices added to candidates by the search, in candidate and list order
+	vector< vector<RGPersistent*> > mNoticesBefore;	// notices of each candidate before the search; not saved
+
+	LaneStandardSelection ();
+};
+
+
+class LaneStandardCache {
+
+public:
+	static int Open (const RGString& fullPath);	// reads existing entries; returns number read or -1 if file cannot be written
+	static void Close ();
+	static bool IsOpen () { return mIsOpen; }
+
+	static RGString MakeKey (LaneStandard* ls, const DataSignal* data, RGDList& candidates, double maxPeak);
+	static const LaneStandardSelection* Find (const RGString& key);
+	static int Save (LaneStandardSelection* selection);	// appends to file; takes ownership
+
+protected:
+	static bool mIsOpen;
+	static RGString mFullPath;
+	static map<string, LaneStandardSelection*> mSelections;
+
+	static RGString FileHeader ();
+};
+
+
+#endif  /*  _LANESTANDARDCACHE_H_  */
@@ -49,11 +49,7 @@
 
 using namespace std;
 
-int Notice::CurrentLinkNumber = 0;
 int Notice::sSubject = 1;
-int Notice::MessageTrigger = 15;
-int Notice::SeverityTrigger = 15;
-int Notice::CurrentMsgNumber = 0;
 int NoticeWarehouse::ReferenceCount = 0;
 NoticeWarehouse* NoticeWarehouse::OneAndOnlySelf = NULL;
 Boolean NoticeWarehouse::DebugFlag = FALSE;
@@ -41,6 +41,7 @@
 #include "RGTextOutput.h"
 #include "rgfile.h"
 #include "rghashtable.h"
+#include "AnalysisContext.h"
 
 
 class NoticeBook;
@@ -100,16 +101,20 @@ public:
 	virtual unsigned HashNumber (unsigned long Base) const;
 
 	static int LoadType () { return -1; }
-	static int GetNextLinkNumber () { CurrentLinkNumber++; return CurrentLinkNumber; }
-	static int GetNextMessageNumber () { CurrentMsgNumber++; return CurrentMsgNumber; }
+	static int GetNextLinkNumber () { return ++Numbering ().CurrentLinkNumber; }
+	static int GetNextMessageNumber () { return ++Numbering ().CurrentMsgNumber; }
+	static int GetCurrentLinkNumber () { return Numbering ().CurrentLinkNumber; }
+	static int GetCurrentMessageNumber () { return Numbering ().CurrentMsgNumber; }
+	static void SetCurrentLinkNumber (int n) { Numbering ().CurrentLinkNumber = n; }
+	static void SetCurrentMessageNumber (int n) { Numbering ().CurrentMsgNumber = n; }
 
 	static int GetSubjectCategory () { return sSubject; }
 
-	static int GetMessageTrigger () { return MessageTrigger; }
-	static void SetMessageTrigger (int severity) { MessageTrigger = severity; }
+	static int GetMessageTrigger () { return Settings ().MessageTrigger; }
+	static void SetMessageTrigger (int severity) { Settings ().MessageTrigger = severity; }
 
-	static int GetSeverityTrigger () { return SeverityTrigger; }
-	static void SetSeverityTrigger (int severity) { SeverityTrigger = severity; }
+	static int GetSeverityTrigger () { return Settings ().SeverityTrigger; }
+	static void SetSeverityTrigger (int severity) { Settings ().SeverityTrigger = severity; }
 
 
 protected:
@@ -123,11 +128,9 @@ protected:
 	Boolean mEnded;
 	int mMessageNumber;
 
-	static int CurrentLinkNumber;
 	static int sSubject;
-	static int MessageTrigger;
-	static int SeverityTrigger;
-	static int CurrentMsgNumber;
+	static NoticeSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mNotice; }
+	static AnalysisNumbering& Numbering () { return AnalysisContext::GetCurrentNumbering (); }
 };
 
 
@@ -38,9 +38,9 @@
 using namespace std;
 
 
-OsirisInputFile :: OsirisInputFile (bool debug) : mDebug (debug), mInputFile (NULL), mCriticalOutputLevel (15), mMinSampleRFU (0.0),
+OsirisInputFile :: OsirisInputFile (bool debug) : mDebug (debug), mInputFile (NULL), mInputStream (&cin), mCriticalOutputLevel (15), mMinSampleRFU (0.0),
 mMinLadderRFU (0.0), mMinLaneStandardRFU (0.0), mMinInterlocusRFU (0.0), mMinLadderInterlocusRFU (0.0), mSampleDetectionThreshold (-1.0), 
-mUseRawData (true), mUserNamedSettingsFiles (true) {
+mNumberOfJobs (1), mUseILSCache (false), mReadAhead (0), mWriteBehind (0), mILSSearchNodeLimit (-1), mConsoleProgress (true), mTimingInOAR (false), mUseRawData (true), mUserNamedSettingsFiles (true) {
 
 	mInputLinesIterator = new RGDListIterator (mInputLines);
 }
@@ -81,6 +81,15 @@ int OsirisInputFile :: ReadAllInputs (const RGString& inputFileName) {
 }
 
 
+int OsirisInputFile :: ReadAllInputs (istream& input) {
+
+	mInputStream = &input;
+	int status = ReadAllInputs ();
+	mInputStream = &cin;
+	return status;
+}
+
+
 int OsirisInputFile :: ReadAllInputs () {
 	
 	// reads either named file or stdin, depending on debug flag
@@ -214,7 +223,11 @@ int OsirisInputFile :: ReadLine () {
 
 	while (true) {
 
-		cin >> noskipws >> T;
+		if (!(*mInputStream >> noskipws >> T)) {
+
+			cout << "Found end of input before end of data:  " << thisLine.GetData () << endl;
+			return -1;
+		}
 
 		if (T == '\n')
 			continue;
@@ -364,6 +377,123 @@ int OsirisInputFile :: AssignString () {
 		status = 0;
 	}
 
+	else if (mStringLeft == "Jobs") {
+
+		// Number of samples analyzed concurrently (like "-j N").  This does not affect the analysis, so it is left
+		// out of the input lines, which are echoed to the .oar file
+
+		mNumberOfJobs = mStringRight.ConvertToInteger ();
+
+		if (mNumberOfJobs < 1)
+			mNumberOfJobs = 1;
+
+		delete mInputLines.GetLast ();
+		cout << "Number of jobs = " << mNumberOfJobs << endl;
+		status = 0;
+	}
+
+	else if (mStringLeft == "ILSCache") {
+
+		// Reuse ILS peak selections of earlier analyses of the same data (see LaneStandardCache.h).  The results are the same,
+		// so, like "Jobs", this is left out of the input lines
+
+		mUseILSCache = (mStringRight == "true");
+		delete mInputLines.GetLast ();
+		cout << "Use ILS cache = " << mStringRight.GetData () << endl;
+		status = 0;
+	}
+
+	else if ((mStringLeft == "ReadAhead") || (mStringLeft == "WriteBehind")) {
+
+		// Queue depths of the sample I/O pipeline:  the number of sample files read ahead of the analysis and the number of
+		// graphics files that may wait to be written (see SampleIOPipeline.h).  0 turns a stage off.  Like "Jobs", these are
+		// left out of the input lines
+
+		int depth = mStringRight.ConvertToInteger ();
+
+		if (depth < 0)
+			depth = 0;
+
+		if (mStringLeft == "ReadAhead")
+			mReadAhead = depth;
+
+		else
+			mWriteBehind = depth;
+
+		delete mInputLines.GetLast ();
+		cout << mStringLeft.GetData () << " = " << depth << endl;
+		status = 0;
+	}
+
+	else if (mStringLeft == "ILSSearchNodeLimit") {
+
+		// Largest number of candidate paths visited by one ILS subset search (see InnerProductSubsetSearch.h); 0 for no limit.
+		// Left out of the input lines
+
+		mILSSearchNodeLimit = mStringRight.ConvertToInteger ();
+
+		if (mILSSearchNodeLimit < 0)
+			mILSSearchNodeLimit = 0;
+
+		delete mInputLines.GetLast ();
+		cout << "ILS search node limit = " << mILSSearchNodeLimit << endl;
+		status = 0;
+	}
+
+	else if (mStringLeft == "ILSSearchLog") {
+
+		// Each ILS subset search appends its input to this file, for replay by ILSSearchBenchmark.  Left out of the input lines
+
+		mILSSearchLog = mStringRight;
+		delete mInputLines.GetLast ();
+		cout << "ILS search log = " << mILSSearchLog.GetData () << endl;
+		status = 0;
+	}
+
+	else if (mStringLeft == "StatusServer") {
+
+		// Name of the RGServer of the program that started the analysis, which receives progress and sample status records
+		// (see AnalysisStatus.h).  Left out of the input lines
+
+		mStatusServer = mStringRight;
+		delete mInputLines.GetLast ();
+		cout << "Status server = " << mStatusServer.GetData () << endl;
+		status = 0;
+	}
+
+	else if (mStringLeft == "ConsoleProgress") {
+
+		// "false" leaves the "Progress = " lines out of the console output while the status server receives progress records.
+		// Left out of the input lines
+
+		mConsoleProgress = (mStringRight != "false");
+		delete mInputLines.GetLast ();
+		cout << "Console progress = " << mStringRight.GetData () << endl;
+		status = 0;
+	}
+
+	else if (mStringLeft == "Timing") {
+
+		// "csv" or "json" writes the stage times and work counts of each sample to a file in the report directory (see
+		// AnalysisTiming.h).  Left out of the input lines
+
+		mTiming = mStringRight;
+		delete mInputLines.GetLast ();
+		cout << "Timing = " << mTiming.GetData () << endl;
+		status = 0;
+	}
+
+	else if (mStringLeft == "TimingInOAR") {
+
+		// "true" adds the stage times and work counts of each sample to the .oar file, in a <Timing> section.  Left out of the
+		// input lines
+
+		mTimingInOAR = (mStringRight == "true");
+		delete mInputLines.GetLast ();
+		cout << "Timing in OAR = " << mStringRight.GetData () << endl;
+		status = 0;
+	}
+
 	else if (mStringLeft == "RawDataString") {
 
 		if (!(mStringRight.Length () == 0)) {
@@ -39,6 +39,10 @@
 #include "rgfile.h"
 #include "rgdlist.h"
 
+#include <iostream>
+
+using namespace std;
+
 class OsirisInputFile {
 
 public:
@@ -47,6 +51,7 @@ public:
 
 	int ReadAllInputs (const RGString& inputFileName);
 	int ReadAllInputs ();  // reads stdin
+	int ReadAllInputs (istream& input);  // reads input exactly as it would stdin
 	int ReadLine ();
 	int AssignString ();
 	void OutputAllData ();
@@ -81,6 +86,17 @@ public:
 	double GetMinLadderInterlocusRFU () const { return mMinLadderInterlocusRFU; }
 	double GetSampleDetectionThreshold () const { return mSampleDetectionThreshold; }
 
+	int GetNumberOfJobs () const { return mNumberOfJobs; }
+	bool UseILSCache () const { return mUseILSCache; }
+	int GetReadAhead () const { return mReadAhead; }
+	int GetWriteBehind () const { return mWriteBehind; }
+	int GetILSSearchNodeLimit () const { return mILSSearchNodeLimit; }	// -1 if not set
+	const RGString& GetILSSearchLog () const { return mILSSearchLog; }
+	const RGString& GetStatusServer () const { return mStatusServer; }
+	bool UseConsoleProgress () const { return mConsoleProgress; }
+	const RGString& GetTiming () const { return mTiming; }	// "csv", "json" or empty
+	bool UseTimingInOAR () const { return mTimingInOAR; }
+
 	bool UseRawData () const { return mUseRawData; }
 	bool UserNamedSettingsFiles () const { return mUserNamedSettingsFiles; }
 
@@ -90,6 +106,7 @@ public:
 protected:
 	bool mDebug;
 	RGFile* mInputFile;
+	istream* mInputStream;
 	RGString mCumulativeStringWithNewLines;
 	RGString mCumulativeStringWithoutNewLines;
 	RGString mOutputString;
@@ -130,6 +147,16 @@ protected:
 	double mMinInterlocusRFU;
 	double mMinLadderInterlocusRFU;
 	double mSampleDetectionThreshold;
+	int mNumberOfJobs;
+	bool mUseILSCache;
+	int mReadAhead;
+	int mWriteBehind;
+	int mILSSearchNodeLimit;
+	RGString mILSSearchLog;
+	RGString mStatusServer;
+	bool mConsoleProgress;
+	RGString mTiming;
+	bool mTimingInOAR;
 
 	bool mUseRawData;
 	bool mUserNamedSettingsFiles;
@@ -51,6 +51,7 @@
 #include "ParameterServer.h"
 #include "TracePrequalification.h"
 #include "DataSignal.h"
+#include "GaussianFitEngine.h"
 #include "RGTextOutput.h"
 #include "rgtokenizer.h"
 #include "STRChannelData.h"
@@ -62,9 +63,6 @@
 
 static ParameterServerKill g_kill;
 
-int ParameterServer :: ReferenceCount = 0;
-ParameterServer* ParameterServer :: OneAndOnlySelf = NULL;
-
 
 locusSpecificLimitsStruct :: locusSpecificLimitsStruct () : 
 fractionOfMaxPeak (-1.0),
@@ -136,7 +134,7 @@ void locusSpecificLimitsStruct :: Reset () {
 
 ParameterServer :: ParameterServer () {
 
-	if (ParameterServer::ReferenceCount == 0) {
+	if (ReferenceCount () == 0) {
 
 		Changed = FALSE;
 		mSet = NULL;
@@ -151,13 +149,13 @@ ParameterServer :: ParameterServer () {
 		mSampleLocusSpecificThresholds = new list<locusSpecificLimitsStruct*>;
 	}
 
-	ParameterServer::ReferenceCount++;
+	ReferenceCount ()++;
 }
 
 
 ParameterServer :: ParameterServer (const RGString& xmlString) : mValid (true) {
 
-	if (ParameterServer::ReferenceCount == 0) {
+	if (ReferenceCount () == 0) {
 
 		Changed = TRUE;
 		mStandardPositiveControlName = new RGString;
@@ -169,7 +167,7 @@ ParameterServer :: ParameterServer (const RGString& xmlString) : mValid (true) {
 		mSampleLocusSpecificThresholds = new list<locusSpecificLimitsStruct*>;
 	}
 
-	ParameterServer::ReferenceCount++;
+	ReferenceCount ()++;
 
 	RGString XMLString (xmlString);
 	mSet = new GenotypeSet (xmlString, false);
@@ -208,9 +206,9 @@ ParameterServer :: ParameterServer (const RGString& xmlString) : mValid (true) {
 
 ParameterServer :: ~ParameterServer () {
 
-	ParameterServer::ReferenceCount--;
+	ReferenceCount ()--;
 
-	if (ReferenceCount <= 0) {
+	if (ReferenceCount () <= 0) {
 
 		delete mSet;
 		delete LadderIDs;
@@ -257,20 +255,20 @@ void* ParameterServer :: operator new (size_t nbytes) {
 
 	void* p;
 	
-	if (ParameterServer::ReferenceCount > 0) {
+	if (ReferenceCount () > 0) {
 		
-		return ParameterServer::OneAndOnlySelf;
+		return OneAndOnlySelf ();
 	}
 	
 	p = malloc (nbytes);
-	ParameterServer::OneAndOnlySelf = (ParameterServer*) p;
+	OneAndOnlySelf () = (ParameterServer*) p;
 	return p;
 }
 
 
 void ParameterServer :: operator delete (void* ptr) {
 
-	if (ParameterServer::ReferenceCount <= 0)
+	if (ReferenceCount () <= 0)
 		free (ptr);
 }
 
@@ -1029,6 +1027,7 @@ bool ParameterServer :: ReadCurveFitParameters (const RGString& xmlString) {
 	RGXMLTagSearch lowTailHeightSearch ("LowTailHeightThreshold", XMLString);
 	RGXMLTagSearch lowTailSlopeSearch ("LowTailSlopeThreshold", XMLString);
 	RGXMLTagSearch minRegressionSamplesSearch ("MinSamplesForSlopeRegression", XMLString);
+	RGXMLTagSearch fastGaussianFitSearch ("FastGaussianFit", XMLString);
 
 
 	if (!noiseSearch.FindNextTag (startOffset, endOffset, numString))
@@ -1267,6 +1266,19 @@ bool ParameterServer :: ReadCurveFitParameters (const RGString& xmlString) {
 		TracePrequalification::SetMinSamplesForSlopeRegression (intNumValue);
 	}
 
+	//
+	//  FastGaussianFit is optional and may appear anywhere in the curve fit parameters.  Without it, the legacy fit is used
+	//
+
+	bool fastFit = false;
+
+	if (fastGaussianFitSearch.FindNextTag (0, endOffset, numString)) {
+
+		numString.ToLower ();
+		fastFit = (numString == "true");
+	}
+
+	GaussianFitEngine::SetUseFastFit (fastFit);
 	return returnValue;
 }
 
@@ -58,6 +58,7 @@
 #include "RGLogBook.h"
 #include "SmartMessage.h"
 #include "BaseGenetics.h"
+#include "AnalysisContext.h"
 
 #include <list>
 
@@ -208,19 +209,19 @@ public:
 
 	static void Kill() {
 
-		if(OneAndOnlySelf != NULL) {
+		if(OneAndOnlySelf () != NULL) {
 
-			ReferenceCount = 1; // problem with reference count
-			delete OneAndOnlySelf;
-			OneAndOnlySelf = NULL;
+			ReferenceCount () = 1; // problem with reference count
+			delete OneAndOnlySelf ();
+			OneAndOnlySelf () = NULL;
 		}
   }
 
   static void UnescapeXML (RGString& target);
 
 protected:
-	static int ReferenceCount;
-	static ParameterServer* OneAndOnlySelf;
+	static int& ReferenceCount () { return AnalysisContext::GetCurrentContext ()->GetParameterServerReferenceCount (); }
+	static ParameterServer*& OneAndOnlySelf () { return AnalysisContext::GetCurrentContext ()->GetParameterServer (); }	// one per context
 
 	GenotypeSet* mSet;
 	bool mValid;
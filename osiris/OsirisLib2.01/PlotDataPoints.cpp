@@ -0,0 +1,324 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: PlotDataPoints.cpp
+*
+*/
+//
+//  class PlotDataPoints holds the point arrays of each channel for the graphics file and writes the binary sidecar.  See
+//  PlotDataPoints.h for the layout of the sidecar
+//
+
+#include "PlotDataPoints.h"
+#include "SampleIOPipeline.h"
+
+#include <string.h>
+#include <iostream>
+
+using namespace std;
+
+
+const char* const PlotDataPoints::BinaryTag = "OSIRPLTB";
+const unsigned int PlotDataPoints::BinaryByteOrder = 0x01020304;
+const unsigned int PlotDataPoints::BinaryVersion = 2;
+const unsigned long PlotDataPoints::PreambleSize = 40;
+const unsigned long PlotDataPoints::ChannelEntrySize = 56;
+
+
+PlotDataPoints :: PlotDataPoints (int numberOfChannels) : mNumberOfChannels (numberOfChannels) {
+
+	int size = mNumberOfChannels * PLOTPOINTS_NUMBEROFTYPES;
+	int i;
+	mPoints = new int* [size];
+	mNumberOfPoints = new int [size];
+	mBaselineStart = new int [mNumberOfChannels];
+
+	for (i=0; i<size; i++) {
+
+		mPoints [i] = NULL;
+		mNumberOfPoints [i] = 0;
+	}
+
+	for (i=0; i<mNumberOfChannels; i++)
+		mBaselineStart [i] = 0;
+}
+
+
+PlotDataPoints :: ~PlotDataPoints () {
+
+	int size = mNumberOfChannels * PLOTPOINTS_NUMBEROFTYPES;
+
+	for (int i=0; i<size; i++)
+		delete[] mPoints [i];
+
+	delete[] mPoints;
+	delete[] mNumberOfPoints;
+	delete[] mBaselineStart;
+}
+
+
+void PlotDataPoints :: SetPoints (int channel, int pointType, int* points, int numberOfPoints) {
+
+	int index = Index (channel, pointType);
+	delete[] mPoints [index];
+	mPoints [index] = points;
+
+	if (points == NULL)
+		mNumberOfPoints [index] = 0;
+
+	else
+		mNumberOfPoints [index] = numberOfPoints;
+}
+
+
+void PlotDataPoints :: SetBaselineStart (int channel, int start) {
+
+	mBaselineStart [channel - 1] = start;
+}
+
+
+bool PlotDataPoints :: HasPoints (int channel, int pointType) const {
+
+	return mPoints [Index (channel, pointType)] != NULL;
+}
+
+
+const int* PlotDataPoints :: GetPoints (int channel, int pointType, int& numberOfPoints) const {
+
+	int index = Index (channel, pointType);
+	numberOfPoints = mNumberOfPoints [index];
+	return mPoints [index];
+}
+
+
+int PlotDataPoints :: GetBaselineStart (int channel) const {
+
+	return mBaselineStart [channel - 1];
+}
+
+
+int PlotDataPoints :: WritePoints (RGTextOutput& text, int channel, int pointType, const RGString& delim) const {
+
+	int n;
+	const int* points = GetPoints (channel, pointType, n);
+
+	if (points == NULL)
+		return 0;
+
+	int last = n - 1;
+
+	for (int j=0; j<last; j++)
+		text << points [j] << delim;
+
+	if (last >= 0)
+		text << points [last];
+
+	return 0;
+}
+
+
+RGFile* PlotDataPoints :: BeginBinaryFile (const RGString& fullPath) const {
+
+	RGFile* file = SampleIOPipeline::OpenOutputFile (fullPath, "wb");
+
+	if (file == NULL) {
+
+		cout << "Could not write graphic file:  " << fullPath << endl;
+		return NULL;
+	}
+
+	// placeholder for the preamble, which is written by EndBinaryFile
+
+	char preamble [40];
+	memset (preamble, 0, PreambleSize);
+	file->Write (preamble, PreambleSize);
+	return file;
+}
+
+
+int PlotDataPoints :: EndBinaryFile (RGFile* file, unsigned long pltLength) const {
+
+	int status = 0;
+	unsigned long headerLength = file->CurrentOffset () - PreambleSize;
+
+	if (!WritePadding (file))
+		status = -1;
+
+	//
+	//  Channel table, then the arrays in table order
+	//
+
+	unsigned long tableOffset = file->CurrentOffset ();
+	unsigned long offset = tableOffset + mNumberOfChannels * ChannelEntrySize;
+	unsigned int type;
+	unsigned int size;
+	int i;
+	int j;
+	int k;
+
+	for (i=1; i<=mNumberOfChannels; i++) {
+
+		file->Write (i);
+		file->Write (mBaselineStart [i - 1]);
+
+		for (j=0; j<PLOTPOINTS_NUMBEROFTYPES; j++) {
+
+			type = StorageType (i, j);
+			size = mNumberOfPoints [Index (i, j)];
+
+			if (type == PLOTPOINTS_TYPENONE) {
+
+				file->Write ((unsigned int)0);
+				file->Write ((unsigned int)0);
+				file->Write ((unsigned int)0);
+				continue;
+			}
+
+			file->Write (type);
+			file->Write (size);
+			file->Write ((unsigned int)offset);
+			offset += size * StorageSize (type);
+			offset = (offset + 7) & ~7UL;
+		}
+	}
+
+	int n;
+	const int* points;
+	short* shortPoints;
+
+	for (i=1; i<=mNumberOfChannels; i++) {
+
+		for (j=0; j<PLOTPOINTS_NUMBEROFTYPES; j++) {
+
+			type = StorageType (i, j);
+			points = GetPoints (i, j, n);
+
+			if (type == PLOTPOINTS_TYPESHORT) {
+
+				shortPoints = new short [n];
+
+				for (k=0; k<n; k++)
+					shortPoints [k] = (short) points [k];
+
+				if (!file->Write (shortPoints, n))
+					status = -1;
+
+				delete[] shortPoints;
+			}
+
+			else if (type == PLOTPOINTS_TYPEINT) {
+
+				if (!file->Write (points, n))
+					status = -1;
+			}
+
+			else
+				continue;
+
+			if (!WritePadding (file))
+				status = -1;
+		}
+	}
+
+	//
+	//  Now that the offsets are known, the preamble
+	//
+
+	file->SeekToBegin ();
+	file->Write (BinaryTag, 8);
+	file->Write (BinaryByteOrder);
+	file->Write (BinaryVersion);
+	file->Write ((unsigned int)PreambleSize);
+	file->Write ((unsigned int)headerLength);
+	file->Write ((unsigned int)mNumberOfChannels);
+	file->Write ((unsigned int)tableOffset);
+	file->Write ((unsigned int)pltLength);
+	file->Write ((unsigned int)0);
+
+	if (file->Error ())
+		status = -1;
+
+	RGString name = file->GetName ();
+	file->Close ();
+	delete file;
+
+	if (status < 0)
+		cout << "Could not write graphic file:  " << name << endl;
+
+	return status;
+}
+
+
+RGString PlotDataPoints :: BinaryFileName (const RGString& pltFileName) {
+
+	return pltFileName + "b";
+}
+
+
+unsigned int PlotDataPoints :: StorageType (int channel, int pointType) const {
+
+	int n;
+	const int* points = GetPoints (channel, pointType, n);
+
+	if (points == NULL)
+		return PLOTPOINTS_TYPENONE;
+
+	for (int j=0; j<n; j++) {
+
+		if ((points [j] < -32768) || (points [j] > 32767))
+			return PLOTPOINTS_TYPEINT;
+	}
+
+	return PLOTPOINTS_TYPESHORT;
+}
+
+
+unsigned long PlotDataPoints :: StorageSize (unsigned int type) {
+
+	switch (type) {
+
+		case PLOTPOINTS_TYPESHORT:
+			return sizeof (short);
+
+		case PLOTPOINTS_TYPEINT:
+			return sizeof (int);
+	}
+
+	return 0;
+}
+
+
+Boolean PlotDataPoints :: WritePadding (RGFile* file) {
+
+	unsigned long offset = file->CurrentOffset ();
+	unsigned long padding = ((offset + 7) & ~7UL) - offset;
+
+	if (padding == 0)
+		return TRUE;
+
+	char zeros [8];
+	memset (zeros, 0, 8);
+	return file->Write (zeros, padding);
+}
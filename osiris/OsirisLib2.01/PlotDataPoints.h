@@ -0,0 +1,107 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: PlotDataPoints.h
+*
+*/
+//
+//  class PlotDataPoints holds the raw, analyzed, ladder and baseline points of each channel of a sample, computed once for the
+//  graphics (.plt) file and for its binary sidecar (.pltb).  The sidecar lets the viewer use the point arrays as they are
+//  instead of parsing them from the XML text.  Its layout, in native byte order, is:
+//
+//      preamble (40 bytes):  char tag [8] = "OSIRPLTB", unsigned int byteOrder = 0x01020304, version = 2, headerOffset,
+//          headerLength, numberOfChannels, channelTableOffset, pltLength (the length of the .plt file it goes with), 0
+//      header:  the .plt XML without the point lists (peaks, artifacts, loci...)
+//      channel table:  one entry of 56 bytes per channel:  int channel, int baselineStart and, for raw, analyzed, ladder and
+//          baseline points in that order, unsigned int type, numberOfPoints and offset
+//      point arrays:  each starting on an 8 byte boundary
+//
+//  The points of an array are stored as 16 bit integers (type 1) if they all fit, otherwise as 32 bit integers (type 2).  All
+//  offsets are from the start of the file.  A point type that is not present has type 0 and no points.  The preamble is
+//  written last, so a sidecar that was not finished has no tag, and the viewer uses the .plt file instead
+//
+
+#ifndef _PLOTDATAPOINTS_H_
+#define _PLOTDATAPOINTS_H_
+
+#include "rgstring.h"
+#include "rgfile.h"
+#include "RGTextOutput.h"
+
+
+const int PLOTPOINTS_RAW = 0;
+const int PLOTPOINTS_ANALYZED = 1;
+const int PLOTPOINTS_LADDER = 2;
+const int PLOTPOINTS_BASELINE = 3;
+const int PLOTPOINTS_NUMBEROFTYPES = 4;
+
+const unsigned int PLOTPOINTS_TYPENONE = 0;
+const unsigned int PLOTPOINTS_TYPESHORT = 1;
+const unsigned int PLOTPOINTS_TYPEINT = 2;
+
+
+class PlotDataPoints {
+
+public:
+	PlotDataPoints (int numberOfChannels);
+	~PlotDataPoints ();
+
+	void SetPoints (int channel, int pointType, int* points, int numberOfPoints);	// takes ownership of points (new[]); NULL means not present
+	void SetBaselineStart (int channel, int start);
+
+	bool HasPoints (int channel, int pointType) const;
+	const int* GetPoints (int channel, int pointType, int& numberOfPoints) const;
+	int GetBaselineStart (int channel) const;
+
+	int WritePoints (RGTextOutput& text, int channel, int pointType, const RGString& delim) const;
+
+	// The caller writes the header text to the file returned by BeginBinaryFile, then calls EndBinaryFile, which closes
+	// and deletes the file.  pltLength is the length of the .plt file, which the viewer compares with the .plt file it finds
+
+	RGFile* BeginBinaryFile (const RGString& fullPath) const;
+	int EndBinaryFile (RGFile* file, unsigned long pltLength) const;
+
+	static RGString BinaryFileName (const RGString& pltFileName);
+
+	static const char* const BinaryTag;
+	static const unsigned int BinaryByteOrder;
+	static const unsigned int BinaryVersion;
+	static const unsigned long PreambleSize;
+	static const unsigned long ChannelEntrySize;
+
+protected:
+	int mNumberOfChannels;
+	int** mPoints;					// indexed by (channel - 1) * PLOTPOINTS_NUMBEROFTYPES + pointType
+	int* mNumberOfPoints;
+	int* mBaselineStart;
+
+	int Index (int channel, int pointType) const { return (channel - 1) * PLOTPOINTS_NUMBEROFTYPES + pointType; }
+	unsigned int StorageType (int channel, int pointType) const;
+	static unsigned long StorageSize (unsigned int type);
+	static Boolean WritePadding (RGFile* file);
+};
+
+
+#endif  /*  _PLOTDATAPOINTS_H_  */
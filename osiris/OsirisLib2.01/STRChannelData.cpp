@@ -49,23 +49,6 @@
 #include "STRSmartNotices.h"
 
 
-double STRLaneStandardChannelData::minLaneStandardRFU = 150.0;
-double STRLadderChannelData::minLadderRFU = 150.0;
-double STRLadderChannelData::minInterlocusRFU = 150;
-double STRSampleChannelData::minSampleRFU = 150.0;
-double STRSampleChannelData::minInterlocusRFU = 150;
-double STRSampleChannelData::sampleDetectionThreshold = 150.0;
-bool STRSampleChannelData::UseOldBaselineEstimation = false;
-
-double STRLaneStandardChannelData::maxLaneStandardRFU = -1.0;
-double STRLadderChannelData::maxLadderRFU = -1.0;
-double STRSampleChannelData::maxSampleRFU = -1.0;
-
-double STRLaneStandardChannelData::ILSStutterThreshold;
-double STRLaneStandardChannelData::ILSAdenylationThreshold;
-double STRLaneStandardChannelData::ILSFractionalFilter = -1.0;
-
-
 PERSISTENT_DEFINITION (STRChannelData, _STRCHANNELDATA_, "STRChannelData")
 PERSISTENT_DEFINITION (STRLaneStandardChannelData, _STRLANESTANDARDCHANNELDATA_, "STRLaneStandardChannelData")
 PERSISTENT_DEFINITION (STRLadderChannelData, _STRLADDERCHANNELDATA_, "STRLadderChannelData")
@@ -562,25 +545,28 @@ int STRChannelData :: WriteArtifactInfoToXML (RGTextOutput& text, const RGString
 }
 
 
-STRLaneStandardChannelData :: STRLaneStandardChannelData () : STRChannelData (), mInverseSouthern (NULL), mGlobalSouthern (NULL) {
+STRLaneStandardChannelData :: STRLaneStandardChannelData () : STRChannelData (), mInverseSouthern (NULL), mGlobalSouthern (NULL),
+mInverseSouthernTable (NULL), mGlobalSouthernTable (NULL) {
 
 }
 
 
 STRLaneStandardChannelData :: STRLaneStandardChannelData (int channel) : STRChannelData (channel), mInverseSouthern (NULL), 
-mGlobalSouthern (NULL) {
+mGlobalSouthern (NULL), mInverseSouthernTable (NULL), mGlobalSouthernTable (NULL) {
 
 }
 
 
 STRLaneStandardChannelData :: STRLaneStandardChannelData (int channel, LaneStandard* inputLS) : STRChannelData (channel, inputLS), 
-mInverseSouthern (NULL), mGlobalSouthern (NULL) {
+mInverseSouthern (NULL), mGlobalSouthern (NULL),
+mInverseSouthernTable (NULL), mGlobalSouthernTable (NULL) {
 
 }
 
 
 STRLaneStandardChannelData :: STRLaneStandardChannelData (const STRLaneStandardChannelData& strLS) :
-STRChannelData (strLS), mInverseSouthern (NULL), mGlobalSouthern (NULL) {
+STRChannelData (strLS), mInverseSouthern (NULL), mGlobalSouthern (NULL),
+mInverseSouthernTable (NULL), mGlobalSouthernTable (NULL) {
 
 }
 
@@ -589,6 +575,8 @@ STRLaneStandardChannelData :: ~STRLaneStandardChannelData () {
 
 	delete mInverseSouthern;
 	delete mGlobalSouthern;
+	delete mInverseSouthernTable;
+	delete mGlobalSouthernTable;
 }
 
 
@@ -1672,6 +1660,7 @@ int STRLaneStandardChannelData :: AnalyzeLaneStandardChannelRecursivelyUsingDens
 	fit2.Regress (SecondaryContent, QFit2);
 	mInverseSouthern = new CSplineTransform (actualArray, Means, NumberOfAcceptedCurves);
 	mGlobalSouthern = new CSplineTransform (Means, actualArray, NumberOfAcceptedCurves);
+	ResetSouthernTables ();
 
 	CurveIterator.Reset ();
 	DataSignal* prevSignal = NULL;
@@ -2455,6 +2444,7 @@ int STRLaneStandardChannelData :: AnalyzeLaneStandardChannel (RGTextOutput& text
 	fit2.Regress (SecondaryContent, QFit2);
 	mInverseSouthern = new CSplineTransform (actualArray, Means, NumberOfAcceptedCurves);
 	mGlobalSouthern = new CSplineTransform (Means, actualArray, NumberOfAcceptedCurves);
+	ResetSouthernTables ();
 
 	if (!print) {
 
@@ -3276,6 +3266,7 @@ int STRLaneStandardChannelData :: AnalyzeLaneStandardChannelRecursively (RGTextO
 	fit2.Regress (SecondaryContent, QFit2);
 	mInverseSouthern = new CSplineTransform (actualArray, Means, NumberOfAcceptedCurves);
 	mGlobalSouthern = new CSplineTransform (Means, actualArray, NumberOfAcceptedCurves);
+	ResetSouthernTables ();
 
 	if (!print) {
 
@@ -3466,8 +3457,17 @@ double STRLaneStandardChannelData :: GetTimeForSpecifiedID (double id) {
 
 	if (mInverseSouthern == NULL)
 		return 0.0;
+
+	//  One bin per bp over the lane standard
+
+	if (mInverseSouthernTable == NULL) {
+
+		int first = (int) floor (mInverseSouthern->GetLeftAbscissa ());
+		int last = (int) ceil (mInverseSouthern->GetRightAbscissa ());
+		mInverseSouthernTable = new CTransformTable (mInverseSouthern, first, last);
+	}
 	
-	return mInverseSouthern->EvaluateWithExtrapolation (id);
+	return mInverseSouthernTable->Evaluate (id);
 }
 
 
@@ -3477,21 +3477,44 @@ CoordinateTransform* STRLaneStandardChannelData :: GetIDMap () {
 }
 
 
+CTransformTable* STRLaneStandardChannelData :: GetIDTable () {
+
+	if (mGlobalSouthern == NULL)
+		return NULL;
+
+	//  One bin per scan over the whole sample, for the peaks of every channel and for the graphics file
+
+	if (mGlobalSouthernTable == NULL)
+		mGlobalSouthernTable = new CTransformTable (mGlobalSouthern, 0, GetNumberOfSamples () - 1);
+
+	return mGlobalSouthernTable;
+}
+
+
+void STRLaneStandardChannelData :: ResetSouthernTables () {
+
+	delete mInverseSouthernTable;
+	delete mGlobalSouthernTable;
+	mInverseSouthernTable = NULL;
+	mGlobalSouthernTable = NULL;
+}
+
+
 double STRLaneStandardChannelData :: GetMinimumHeight () const {
 
-	return STRLaneStandardChannelData::minLaneStandardRFU;
+	return mContext->GetSettings ().mLaneStandardChannel.minLaneStandardRFU;
 }
 
 
 double STRLaneStandardChannelData :: GetMaximumHeight () const {
 
-	return STRLaneStandardChannelData::maxLaneStandardRFU;
+	return mContext->GetSettings ().mLaneStandardChannel.maxLaneStandardRFU;
 }
 
 
 double STRLaneStandardChannelData :: GetDetectionThreshold () const {
 
-	return STRLaneStandardChannelData::minLaneStandardRFU;
+	return mContext->GetSettings ().mLaneStandardChannel.minLaneStandardRFU;
 }
 
 
@@ -3707,25 +3730,25 @@ ChannelData* STRLadderChannelData :: CreateNewTransformedChannel (const ChannelD
 
 double STRLadderChannelData :: GetMinimumHeight () const {
 
-	return STRLadderChannelData::minLadderRFU;
+	return mContext->GetSettings ().mLadderChannel.minLadderRFU;
 }
 
 
 double STRLadderChannelData :: GetMaximumHeight () const {
 
-	return STRLadderChannelData::maxLadderRFU;
+	return mContext->GetSettings ().mLadderChannel.maxLadderRFU;
 }
 
 
 double STRLadderChannelData :: GetFractionalFilter () const {
 
-	return Locus::GetGridFractionalFilter ();
+	return mContext->GetSettings ().mLocus.GridFractionalFilter;
 }
 
 
 double STRLadderChannelData :: GetDetectionThreshold () const {
 
-	return STRLadderChannelData::minLadderRFU;
+	return mContext->GetSettings ().mLadderChannel.minLadderRFU;
 }
 
 
@@ -3914,7 +3937,7 @@ int STRSampleChannelData :: TestForInterlocusProximityArtifacts () {
 	double rightLimit;
 	double leftUpperLimit;
 	double rightLowerLimit;
-	double threshold = Locus::GetSampleAdenylationThreshold ();
+	double threshold = mContext->GetSettings ().mLocus.SampleAdenylationThreshold;
 
 	while (nextSignal = (DataSignal*) signalIterator ()) {
 
@@ -4677,7 +4700,7 @@ int STRSampleChannelData :: ResolveAmbiguousInterlocusSignals () {
 
 bool STRSampleChannelData :: TestInterlocusSignalHeightBelowThreshold (DataSignal* signal) {
 
-	double minInterlocusRFU = STRSampleChannelData::GetMinInterlocusRFU ();
+	double minInterlocusRFU = mContext->GetSettings ().mSampleChannel.minInterlocusRFU;
 
 	if (signal->Peak () <= minInterlocusRFU)
 		return true;
@@ -4694,25 +4717,25 @@ ChannelData* STRSampleChannelData :: CreateNewTransformedChannel (const ChannelD
 
 double STRSampleChannelData :: GetMinimumHeight () const {
 
-	return STRSampleChannelData::minSampleRFU;
+	return mContext->GetSettings ().mSampleChannel.minSampleRFU;
 }
 
 
 double STRSampleChannelData :: GetMaximumHeight () const {
 
-	return STRSampleChannelData::maxSampleRFU;
+	return mContext->GetSettings ().mSampleChannel.maxSampleRFU;
 }
 
 
 double STRSampleChannelData :: GetFractionalFilter () const {
 
-	return Locus::GetSampleFractionalFilter ();
+	return mContext->GetSettings ().mLocus.SampleFractionalFilter;
 }
 
 
 double STRSampleChannelData :: GetDetectionThreshold () const {
 
-	return STRSampleChannelData::sampleDetectionThreshold;
+	return mContext->GetSettings ().mSampleChannel.sampleDetectionThreshold;
 }
 
 
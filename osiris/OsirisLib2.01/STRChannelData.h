@@ -176,6 +176,7 @@ public:
 	virtual double GetSecondaryContentAtTime (double t) const;
 	virtual double GetTimeForSpecifiedID (double id);
 	virtual CoordinateTransform* GetIDMap ();
+	virtual CTransformTable* GetIDTable ();
 
 	virtual double GetMinimumHeight () const;
 	virtual double GetMaximumHeight () const;
@@ -225,37 +226,36 @@ public:
 
 	//******************************************************************************************************************************************
 
-	static void SetLSMinimumRFU (double rfu) { minLaneStandardRFU = rfu; }
-	static double GetMinRFU () { return minLaneStandardRFU; }
-	static void SetLSMaximumRFU (double rfu) { maxLaneStandardRFU = rfu; }
-	static double GetMaxRFU () { return maxLaneStandardRFU; }
+	static void SetLSMinimumRFU (double rfu) { Settings ().minLaneStandardRFU = rfu; }
+	static double GetMinRFU () { return Settings ().minLaneStandardRFU; }
+	static void SetLSMaximumRFU (double rfu) { Settings ().maxLaneStandardRFU = rfu; }
+	static double GetMaxRFU () { return Settings ().maxLaneStandardRFU; }
 
-	static double GetILSStutterThreshold () { return ILSStutterThreshold; }
-	static void SetILSStutterThreshold (double limit) {ILSStutterThreshold = limit; }
-	static double GetILSAdenylationThreshold () { return ILSAdenylationThreshold; }
-	static void SetILSAdenylationThreshold (double limit) {ILSAdenylationThreshold = limit; }
+	static double GetILSStutterThreshold () { return Settings ().ILSStutterThreshold; }
+	static void SetILSStutterThreshold (double limit) { Settings ().ILSStutterThreshold = limit; }
+	static double GetILSAdenylationThreshold () { return Settings ().ILSAdenylationThreshold; }
+	static void SetILSAdenylationThreshold (double limit) { Settings ().ILSAdenylationThreshold = limit; }
 
-	static void SetILSFractionalFilter (double limit) { ILSFractionalFilter = limit; }
-	static double GetILSFractionalFilter () { return ILSFractionalFilter; }
+	static void SetILSFractionalFilter (double limit) { Settings ().ILSFractionalFilter = limit; }
+	static double GetILSFractionalFilter () { return Settings ().ILSFractionalFilter; }
 
 protected:
 	Quadratic QFit;
 	Quadratic QFit2;
 	CSplineTransform* mInverseSouthern;
 	CSplineTransform* mGlobalSouthern;
+	CTransformTable* mInverseSouthernTable;	// built from the transforms when first used; see ResetSouthernTables
+	CTransformTable* mGlobalSouthernTable;
 
 	// Not message-related**********************************************************************************************************************************************************
 	//******************************************************************************************************************************************************************************
 
 	double DotProductWithQuadraticFit (RGDList& set, int size, const double* idealValues, const double* idealDifferences, double idealNorm2);
+	void ResetSouthernTables ();	// call whenever mInverseSouthern or mGlobalSouthern is replaced
 
 	//******************************************************************************************************************************************************************************
 
-	static double minLaneStandardRFU;
-	static double maxLaneStandardRFU;
-	static double ILSStutterThreshold;
-	static double ILSAdenylationThreshold;
-	static double ILSFractionalFilter;
+	static LaneStandardChannelSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mLaneStandardChannel; }
 };
 
 
@@ -306,17 +306,15 @@ public:
 	//******************************************************************************************************************************************
 
 	
-	static void SetLadderMinimumRFU (double rfu) { minLadderRFU = rfu; }
-	static double GetMinRFU () { return minLadderRFU; }
-	static void SetLadderMaximumRFU (double rfu) { maxLadderRFU = rfu; }
-	static double GetMaxRFU () { return maxLadderRFU; }
-	static void SetMinInterlocusRFU (double rfu) { minInterlocusRFU = rfu; }
-	static double GetMinInterlocusRFU () { return minInterlocusRFU; }
+	static void SetLadderMinimumRFU (double rfu) { Settings ().minLadderRFU = rfu; }
+	static double GetMinRFU () { return Settings ().minLadderRFU; }
+	static void SetLadderMaximumRFU (double rfu) { Settings ().maxLadderRFU = rfu; }
+	static double GetMaxRFU () { return Settings ().maxLadderRFU; }
+	static void SetMinInterlocusRFU (double rfu) { Settings ().minInterlocusRFU = rfu; }
+	static double GetMinInterlocusRFU () { return Settings ().minInterlocusRFU; }
 
 protected:
-	static double minLadderRFU;
-	static double maxLadderRFU;
-	static double minInterlocusRFU;
+	static LadderChannelSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mLadderChannel; }
 };
 
 
@@ -344,14 +342,14 @@ public:
 	virtual double GetFractionalFilter () const;
 	virtual double GetDetectionThreshold () const;
 
-	static void SetSampleMinimumRFU (double rfu) { minSampleRFU = rfu; }
-	static double GetMinRFU () { return minSampleRFU; }
-	static void SetSampleMaximumRFU (double rfu) { maxSampleRFU = rfu; }
-	static double GetMaxRFU () { return maxSampleRFU; }
-	static void SetMinInterlocusRFU (double rfu) { minInterlocusRFU = rfu; }
-	static double GetMinInterlocusRFU () { return minInterlocusRFU; }
-	static void SetDetectionThreshold (double rfu) { sampleDetectionThreshold = rfu; }
-	static double GetSampleDetectionThreshold () { return sampleDetectionThreshold; }
+	static void SetSampleMinimumRFU (double rfu) { Settings ().minSampleRFU = rfu; }
+	static double GetMinRFU () { return Settings ().minSampleRFU; }
+	static void SetSampleMaximumRFU (double rfu) { Settings ().maxSampleRFU = rfu; }
+	static double GetMaxRFU () { return Settings ().maxSampleRFU; }
+	static void SetMinInterlocusRFU (double rfu) { Settings ().minInterlocusRFU = rfu; }
+	static double GetMinInterlocusRFU () { return Settings ().minInterlocusRFU; }
+	static void SetDetectionThreshold (double rfu) { Settings ().sampleDetectionThreshold = rfu; }
+	static double GetSampleDetectionThreshold () { return Settings ().sampleDetectionThreshold; }
 
 
 	// Legacy Message functions*****************************************************************************************************************
@@ -409,11 +407,7 @@ public:
 	//******************************************************************************************************************************************
 
 protected:
-	static double minSampleRFU;
-	static double maxSampleRFU;
-	static double minInterlocusRFU;
-	static double sampleDetectionThreshold;
-	static bool UseOldBaselineEstimation;
+	static SampleChannelSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mSampleChannel; }
 
 	bool FindNextFitDataIntervalBelowThreshold (double threshold, int start, int end, int& beginInterval, int& endInterval, DataSignal* fitData);
 	bool FindNextFitDataIntervalBelowThreshold (double threshold, int start, int end, int& beginInterval, int& endInterval, DataSignal* fitData, DataSignal* fitNegData);
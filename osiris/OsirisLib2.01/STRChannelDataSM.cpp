@@ -46,6 +46,7 @@
 #include "Notices.h"
 #include "ListFunctions.h"
 #include "RecursiveInnerProduct.h"
+#include "LaneStandardCache.h"
 #include "SmartNotice.h"
 #include "STRSmartNotices.h"
 
@@ -1098,6 +1099,7 @@ int STRLaneStandardChannelData :: AnalyzeLaneStandardChannelRecursivelySM (RGTex
 	fit2.Regress (SecondaryContent, QFit2);
 	mInverseSouthern = new CSplineTransform (actualArray, Means, NumberOfAcceptedCurves);
 	mGlobalSouthern = new CSplineTransform (Means, actualArray, NumberOfAcceptedCurves);
+	ResetSouthernTables ();
 
 
 	RGDListIterator SmartIt (SmartPeaks);
@@ -1389,145 +1391,214 @@ int STRLaneStandardChannelData :: AnalyzeLaneStandardChannelRecursivelyUsingDens
 	if (reduction > reductionMax)
 		reduction = reductionMax;
 
-	if (hts != NULL) {
+	//  A reanalysis of the same data finds the selection in the ILS cache (see LaneStandardCache.h) and skips the search
 
-		testedRelativeHeights = true;
+	LaneStandardSelection* newSelection = NULL;
+	const LaneStandardSelection* cachedSelection = NULL;
 
-		// Recalculate maxPeak based on FinalCurveList; calculate minPeak if needed to pare down number of curves; nothing is changed if number of peaks would be too small
-		maxPeak = PopulationMarkerSet::RecalculateMaxPeakBasedOnRelativeHeightInfo (FinalCurveList, maxPeak, hts, Size, maxRelativeHeight, sizeFactor, minPeak) + 0.1;
+	if (LaneStandardCache::IsOpen ()) {
 
-		finalIterator.Reset ();
+		RGString cacheKey = LaneStandardCache::MakeKey (mLaneStandard, mData, tempCurveList, maxPeak);
+		cachedSelection = LaneStandardCache::Find (cacheKey);
 
-		if (FinalCurveList.Entries () > sizeFactor) {
+		if (cachedSelection == NULL) {
 
-			while (nextSignal = (DataSignal*) finalIterator ()) {
-
-				lastPeak = nextSignal->Peak ();
-
-				if (lastPeak > maxPeak) {
+			newSelection = new LaneStandardSelection (cacheKey);
+			newSelection->RecordNoticesBefore (tempCurveList);
+		}
+	}
 
-					finalIterator.RemoveCurrentItem ();
-					overFlow.Append (nextSignal);
-				}
+	if ((cachedSelection != NULL) && cachedSelection->Restore (tempCurveList, FinalCurveList, overFlow)) {
 
-				else if (lastPeak <= minPeak) {
+		Endl endline;
 
-					finalIterator.RemoveCurrentItem ();
-					overFlow.Append (nextSignal);
-				}
-			}
+		if (cachedSelection->mReducedPeaks >= 0) {
 
-			Endl endline;
 			ExcelText.SetOutputLevel (1);
-			ExcelText << "Reduced number of peaks to " << FinalCurveList.Entries () << " with min height = " << minPeak << " and max height = " << maxPeak << endline;
+			ExcelText << "Reduced number of peaks to " << cachedSelection->mReducedPeaks << " with min height = " << cachedSelection->mReducedMinPeak << " and max height = " << cachedSelection->mReducedMaxPeak << endline;
 			ExcelText.ResetOutputLevel ();
 		}
-	}
 
-	else if (FinalCurveList.Entries () > sizeFactor) {
+		if (cachedSelection->mCouldNotPareDown)
+			cout << "Could not pare down ILS list sufficiently..." << endl;
 
-		downsizeStatus = PopulationMarkerSet::PareDownSignalListBasedOnHeight (FinalCurveList, overFlow, sizeFactor - reduction);
-	}
+		if (cachedSelection->mRelativeHeightsInconsistent)
+			SetMessageValue (relativeHeightsInconsistent, true);
 
-//	MergeListAIntoListB (overFlow, ArtifactList);  //????????????????????????????????????????????????????
-	overFlow.Clear ();
+		if (cachedSelection->mCouldNotPareDownForMethod1)
+			cout << "Could not pare down ILS list sufficiently for Method 1..." << endl;
 
-	if (FinalCurveList.Entries () == Size) {
+		if (cachedSelection->mFinallyReducedPeaks >= 0) {
+
+			ExcelText.SetOutputLevel (1);
+			ExcelText << "Finally reduced number of peaks to " << cachedSelection->mFinallyReducedPeaks << endline;
+			ExcelText.ResetOutputLevel ();
+		}
 
 		correlation = DotProductWithQuadraticFit (FinalCurveList, Size, actualArray, differenceArray, leftNorm2s [Size-2]);
 	}
 
 	else {
 
-		overFlow.Clear ();
+		if (hts != NULL) {
 
-		if (FinalCurveList.Entries () <= sizeFactor2)
-			startPts = Size;  // See above
+			testedRelativeHeights = true;
 
-		else {
+			// Recalculate maxPeak based on FinalCurveList; calculate minPeak if needed to pare down number of curves; nothing is changed if number of peaks would be too small
+			maxPeak = PopulationMarkerSet::RecalculateMaxPeakBasedOnRelativeHeightInfo (FinalCurveList, maxPeak, hts, Size, maxRelativeHeight, sizeFactor, minPeak) + 0.1;
 
-			startPts = (Size / 2);
+			finalIterator.Reset ();
 
-			if (2 * startPts == Size)
-				startPts--;
+			if (FinalCurveList.Entries () > sizeFactor) {
 
-			if (startPts > 6)
-				startPts = 6;
+				while (nextSignal = (DataSignal*) finalIterator ()) {
 
-			cout << "Could not pare down ILS list sufficiently..." << endl;
-		}
+					lastPeak = nextSignal->Peak ();
 
-		ClearAndRepopulateFromList (FinalCurveList, totallyTempCurveList, overFlow);
-		recursiveStatus = PopulationMarkerSet::SearchRecursivelyForBestSubset (FinalCurveList, overFlow, ctlInfo, correlation, 0.98, startPts, heightFactor * maxPeak);
+					if (lastPeak > maxPeak) {
 
-		if (recursiveStatus < 0) {
+						finalIterator.RemoveCurrentItem ();
+						overFlow.Append (nextSignal);
+					}
 
-			//newNotice = new ILSRelativeHeightsInconsistent;
-			//AddNoticeToList (newNotice);
-			correlation = 0.0;
-			relativeHeightsFailed = true;
-		}
+					else if (lastPeak <= minPeak) {
 
-		else {
+						finalIterator.RemoveCurrentItem ();
+						overFlow.Append (nextSignal);
+					}
+				}
 
-			correlation = DotProductWithQuadraticFit (FinalCurveList, Size, actualArray, differenceArray, leftNorm2s [Size-2]);
+				if (newSelection != NULL) {
 
-			if (correlation < correlationAcceptanceThreshold)
-				relativeHeightsFailed = true;
+					newSelection->mReducedPeaks = FinalCurveList.Entries ();
+					newSelection->mReducedMinPeak = minPeak;
+					newSelection->mReducedMaxPeak = maxPeak;
+				}
+
+				Endl endline;
+				ExcelText.SetOutputLevel (1);
+				ExcelText << "Reduced number of peaks to " << FinalCurveList.Entries () << " with min height = " << minPeak << " and max height = " << maxPeak << endline;
+				ExcelText.ResetOutputLevel ();
+			}
 		}
 
-		bool searchForSubset = (testedRelativeHeights && relativeHeightsFailed) || (!testedRelativeHeights);
+		else if (FinalCurveList.Entries () > sizeFactor) {
 
-		if (testedRelativeHeights && relativeHeightsFailed) {
+			downsizeStatus = PopulationMarkerSet::PareDownSignalListBasedOnHeight (FinalCurveList, overFlow, sizeFactor - reduction);
+		}
 
-			//ClearAndRepopulateFromList (totallyTempCurveList, FinalCurveList, overFlow);	//??????????????????????????????????????????????????????????????????????????????????
-			ClearAndRepopulateFromList (tempCurveList, FinalCurveList, overFlow);	//??????????????????????????????????????????????????????????????????????????????????
-			SetMessageValue (relativeHeightsInconsistent, true);
+	//	MergeListAIntoListB (overFlow, ArtifactList);  //????????????????????????????????????????????????????
+		overFlow.Clear ();
+
+		if (FinalCurveList.Entries () == Size) {
+
+			correlation = DotProductWithQuadraticFit (FinalCurveList, Size, actualArray, differenceArray, leftNorm2s [Size-2]);
 		}
 
-		if (searchForSubset) {
+		else {
 
-			if (FinalCurveList.Entries () <= sizeFactor)
+			overFlow.Clear ();
+
+			if (FinalCurveList.Entries () <= sizeFactor2)
 				startPts = Size;  // See above
 
 			else {
 
-				if (PopulationMarkerSet::PareDownSignalListBasedOnHeight (FinalCurveList, overFlow, sizeFactor - reduction) < 0) {
+				startPts = (Size / 2);
 
-					startPts = (Size / 2);
+				if (2 * startPts == Size)
+					startPts--;
 
-					if (2 * startPts == Size)
-						startPts--;
+				if (startPts > 6)
+					startPts = 6;
 
-					if (startPts > 6)
-						startPts = 6;
+				cout << "Could not pare down ILS list sufficiently..." << endl;
 
-					cout << "Could not pare down ILS list sufficiently for Method 1..." << endl;
-				}
+				if (newSelection != NULL)
+					newSelection->mCouldNotPareDown = true;
+			}
 
-				else
-					startPts = Size;
+			ClearAndRepopulateFromList (FinalCurveList, totallyTempCurveList, overFlow);
+			recursiveStatus = PopulationMarkerSet::SearchRecursivelyForBestSubset (FinalCurveList, overFlow, ctlInfo, correlation, 0.98, startPts, heightFactor * maxPeak);
 
-				Endl endline;
-				ExcelText.SetOutputLevel (1);
-				ExcelText << "Finally reduced number of peaks to " << FinalCurveList.Entries () << endline;
-				ExcelText.ResetOutputLevel ();
+			if (recursiveStatus < 0) {
+
+				//newNotice = new ILSRelativeHeightsInconsistent;
+				//AddNoticeToList (newNotice);
+				correlation = 0.0;
+				relativeHeightsFailed = true;
 			}
 
-			ctlInfo.mHeightIndices = NULL;
-			recursiveStatus = PopulationMarkerSet::SearchRecursivelyForBestSubset (FinalCurveList, overFlow, ctlInfo, correlation, 0.98, startPts, heightFactor * maxPeak);
-		}
+			else {
 
-		if (recursiveStatus < 0) {
+				correlation = DotProductWithQuadraticFit (FinalCurveList, Size, actualArray, differenceArray, leftNorm2s [Size-2]);
 
-			status = -1;
-			correlation = 0.0;
-			overFlow.Clear ();
-		}
+				if (correlation < correlationAcceptanceThreshold)
+					relativeHeightsFailed = true;
+			}
 
-		else
-			correlation = DotProductWithQuadraticFit (FinalCurveList, Size, actualArray, differenceArray, leftNorm2s [Size-2]);
+			bool searchForSubset = (testedRelativeHeights && relativeHeightsFailed) || (!testedRelativeHeights);
+
+			if (testedRelativeHeights && relativeHeightsFailed) {
+
+				//ClearAndRepopulateFromList (totallyTempCurveList, FinalCurveList, overFlow);	//??????????????????????????????????????????????????????????????????????????????????
+				ClearAndRepopulateFromList (tempCurveList, FinalCurveList, overFlow);	//??????????????????????????????????????????????????????????????????????????????????
+				SetMessageValue (relativeHeightsInconsistent, true);
+
+				if (newSelection != NULL)
+					newSelection->mRelativeHeightsInconsistent = true;
+			}
+
+			if (searchForSubset) {
+
+				if (FinalCurveList.Entries () <= sizeFactor)
+					startPts = Size;  // See above
+
+				else {
+
+					if (PopulationMarkerSet::PareDownSignalListBasedOnHeight (FinalCurveList, overFlow, sizeFactor - reduction) < 0) {
+
+						startPts = (Size / 2);
+
+						if (2 * startPts == Size)
+							startPts--;
+
+						if (startPts > 6)
+							startPts = 6;
+
+						cout << "Could not pare down ILS list sufficiently for Method 1..." << endl;
 
+						if (newSelection != NULL)
+							newSelection->mCouldNotPareDownForMethod1 = true;
+					}
+
+					else
+						startPts = Size;
+
+					if (newSelection != NULL)
+						newSelection->mFinallyReducedPeaks = FinalCurveList.Entries ();
+
+					Endl endline;
+					ExcelText.SetOutputLevel (1);
+					ExcelText << "Finally reduced number of peaks to " << FinalCurveList.Entries () << endline;
+					ExcelText.ResetOutputLevel ();
+				}
+
+				ctlInfo.mHeightIndices = NULL;
+				recursiveStatus = PopulationMarkerSet::SearchRecursivelyForBestSubset (FinalCurveList, overFlow, ctlInfo, correlation, 0.98, startPts, heightFactor * maxPeak);
+			}
+
+			if (recursiveStatus < 0) {
+
+				status = -1;
+				correlation = 0.0;
+				overFlow.Clear ();
+			}
+
+			else
+				correlation = DotProductWithQuadraticFit (FinalCurveList, Size, actualArray, differenceArray, leftNorm2s [Size-2]);
+
+		}
 	}
 
 	if (correlation < correlationAcceptanceThreshold) {
@@ -1541,6 +1612,7 @@ int STRLaneStandardChannelData :: AnalyzeLaneStandardChannelRecursivelyUsingDens
 		indivList.Clear ();
 		tempCurveList.Clear ();
 		totallyTempCurveList.Clear ();
+		delete newSelection;
 		return status;
 	}
 
@@ -1552,9 +1624,19 @@ int STRLaneStandardChannelData :: AnalyzeLaneStandardChannelRecursivelyUsingDens
 		indivList.Clear ();
 		tempCurveList.Clear ();
 		totallyTempCurveList.Clear ();
+		delete newSelection;
 		return -1;
 	}
 
+	if (newSelection != NULL) {
+
+		if (newSelection->Finish (tempCurveList, FinalCurveList, overFlow))
+			LaneStandardCache::Save (newSelection);
+
+		else
+			delete newSelection;
+	}
+
 	double tempCorrelation;
 
 	if (correlation < correlationAutoAcceptanceThreshold) {
@@ -1677,6 +1759,7 @@ int STRLaneStandardChannelData :: AnalyzeLaneStandardChannelRecursivelyUsingDens
 	fit2.Regress (SecondaryContent, QFit2);
 	mInverseSouthern = new CSplineTransform (actualArray, Means, NumberOfAcceptedCurves);
 	mGlobalSouthern = new CSplineTransform (Means, actualArray, NumberOfAcceptedCurves);
+	ResetSouthernTables ();
 
 	CurveIterator.Reset ();
 	DataSignal* prevSignal = NULL;
@@ -2006,8 +2089,11 @@ int STRLaneStandardChannelData :: TestForRaisedBaselineAndExcessiveNoiseSM (doub
 
 		while (rbld = mRaisedBaseLines.RemoveFirst ()) {
 
-			if (rbld->GetLeft () < minTest)
+			if (rbld->GetLeft () < minTest) {
+
+				delete rbld;
 				continue;
+			}
 
 			height = rbld->GetHeight ();
 
@@ -2016,8 +2102,11 @@ int STRLaneStandardChannelData :: TestForRaisedBaselineAndExcessiveNoiseSM (doub
 				SetMessageValue (channelHasRaisedBaseline, true);
 				AppendDataForSmartMessage (channelHasRaisedBaseline, (int) floor ((double)height));
 				AppendDataForSmartMessage (channelHasRaisedBaseline, (int) floor ((double)rbld->GetLeft ()));
+				delete rbld;
 				break;
 			}
+
+			delete rbld;
 		}
 	}
 
@@ -2025,10 +2114,14 @@ int STRLaneStandardChannelData :: TestForRaisedBaselineAndExcessiveNoiseSM (doub
 
 	while (pfpd = mPoorFits.RemoveFirst ()) {
 
-		if (pfpd->GetMode () < minTest)
+		if (pfpd->GetMode () < minTest) {
+
+			delete pfpd;
 			continue;
+		}
 
 		height = pfpd->GetHeight ();
+		delete pfpd;
 
 		if (height >= analysisThreshold) {
 
@@ -2138,7 +2231,7 @@ int STRLadderChannelData :: AnalyzeGridLociSM (RGTextOutput& text, RGTextOutput&
 
 	RGDListIterator PreliminaryIterator (PreliminaryCurveList);
 	double ladderInterlocusMinRFU = STRLadderChannelData::GetMinInterlocusRFU ();
-	double ladderFractionalFilter = Locus::GetGridFractionalFilter ();
+	double ladderFractionalFilter = mContext->GetSettings ().mLocus.GridFractionalFilter;
 	double interlocusFractionalThreshold = maxPeak * ladderFractionalFilter;
 	bool removeSignal;
 
@@ -2328,8 +2421,8 @@ int STRSampleChannelData :: TestFractionalFiltersSM () {
 	DataSignal* nextSignal;
 	RGDListIterator cIt (PreliminaryCurveList);
 
-	double fractionalFilter = Locus::GetSampleFractionalFilter ();
-	double pullupFractionalFilter = Locus::GetSamplePullupFractionalFilter ();
+	double fractionalFilter = mContext->GetSettings ().mLocus.SampleFractionalFilter;
+	double pullupFractionalFilter = mContext->GetSettings ().mLocus.SamplePullupFractionalFilter;
 
 	smPartOfExtendedLocusLeft extendedLocusLeft;
 	smPartOfExtendedLocusRight extendedLocusRight;
@@ -2495,7 +2588,7 @@ int STRSampleChannelData :: TestForInterlocusProximityArtifactsSM () {
 	double rightLimit;
 	double leftUpperLimit;
 	double rightLowerLimit;
-	double threshold = Locus::GetSampleAdenylationThreshold ();
+	double threshold = mContext->GetSettings ().mLocus.SampleAdenylationThreshold;
 
 	while (nextSignal = (DataSignal*) signalIterator ()) {
 
@@ -3333,8 +3426,11 @@ int STRSampleChannelData :: TestForRaisedBaselineAndExcessiveNoiseSM (double lef
 
 		while (rbld = mRaisedBaseLines.RemoveFirst ()) {
 
-			if (rbld->GetLeft () < minTest)
+			if (rbld->GetLeft () < minTest) {
+
+				delete rbld;
 				continue;
+			}
 
 			height = rbld->GetHeight ();
 
@@ -3343,8 +3439,11 @@ int STRSampleChannelData :: TestForRaisedBaselineAndExcessiveNoiseSM (double lef
 				SetMessageValue (channelHasRaisedBaseline, true);
 				AppendDataForSmartMessage (channelHasRaisedBaseline, (int) floor ((double)height));
 				AppendDataForSmartMessage (channelHasRaisedBaseline, (int) floor ((double)rbld->GetLeft ()));
+				delete rbld;
 				break;
 			}
+
+			delete rbld;
 		}
 	}
 
@@ -3352,10 +3451,14 @@ int STRSampleChannelData :: TestForRaisedBaselineAndExcessiveNoiseSM (double lef
 
 	while (pfpd = mPoorFits.RemoveFirst ()) {
 
-		if (pfpd->GetMode () < minTest)
+		if (pfpd->GetMode () < minTest) {
+
+			delete pfpd;
 			continue;
+		}
 
 		height = pfpd->GetHeight ();
+		delete pfpd;
 
 		if (height >= analysisThreshold) {
 
@@ -3397,7 +3500,7 @@ int STRSampleChannelData :: FitAllNegativeCharacteristicsSM (RGTextOutput& text,
 	if (minAcceptableFit > minFit)
 		minFit = minAcceptableFit;
 
-	if (CoreBioComponent::GetGaussianSignature ())
+	if (mContext->GetSettings ().mCoreBioComponent.GaussianSignature)
 		signature = new NormalizedGaussian (0.0, ParametricCurve::GetSigmaForSignature ());
 
 	else
@@ -3456,6 +3559,8 @@ int STRSampleChannelData :: FitAllNegativeCharacteristicsSM (RGTextOutput& text,
 
 	}   //  We are done finding negative characteristics
 
+	delete negativePeaks;
+
 	//cout << "Done finding characteristics" << endl;
 	DataSignal* prevSignal = NULL;
 	RGDList tempList;
@@ -3467,7 +3572,7 @@ int STRSampleChannelData :: FitAllNegativeCharacteristicsSM (RGTextOutput& text,
 		return 0;
 	}
 
-	double minDistance = ChannelData::GetMinimumDistanceBetweenPeaks ();
+	double minDistance = mContext->GetSettings ().mChannelData.MinDistanceBetweenPeaks;
 	//cout << "Eliminating neg peaks that are too close (2)" << endl;
 
 	while (nextSignal = (DataSignal*) mNegativeCurveList.GetFirst ()) {
@@ -3712,7 +3817,7 @@ int STRSampleChannelData :: AnalyzeDynamicBaselineSM (int startTime) {
 	list<double> knotValues2;
 	double tempValue;
 
-	if (STRSampleChannelData::UseOldBaselineEstimation)
+	if (mContext->GetSettings ().mSampleChannel.UseOldBaselineEstimation)
 		ShapeBaselineData (knotTimes, knotValues);  // commented and added below 08/26/2013
 
 	else {
@@ -4013,7 +4118,7 @@ int STRSampleChannelData :: AnalyzeDynamicBaselineAndNormalizeRawDataSM (int sta
 	list<double> knotValues2;
 	double tempValue;
 
-	if (STRSampleChannelData::UseOldBaselineEstimation)
+	if (mContext->GetSettings ().mSampleChannel.UseOldBaselineEstimation)
 		ShapeBaselineData (knotTimes, knotValues);  // commented and added below 08/26/2013
 
 	else {
@@ -4576,7 +4681,7 @@ void STRSampleChannelData :: AppendKnotDataWithEditingToLists (int intervalLeft,
 		}
 	}
 
-	else if (!STRSampleChannelData::UseOldBaselineEstimation) {
+	else if (!mContext->GetSettings ().mSampleChannel.UseOldBaselineEstimation) {
 
 		time = (double) (intervalLeft + 15);
 		right = intervalLeft + 30;
@@ -4684,7 +4789,7 @@ int STRSampleChannelData :: EditOutFitBaselineForNormalization (RGDList& fitPeak
 
 	RGDListIterator it (fitPeaks);
 	DataSignal* nextSignal;
-	double detectionThreshold = 0.6 * STRSampleChannelData::sampleDetectionThreshold;
+	double detectionThreshold = 0.6 * mContext->GetSettings ().mSampleChannel.sampleDetectionThreshold;
 	double peakHeight;
 	//double rawAverage;
 	//double rawMinimum;
@@ -5159,7 +5264,7 @@ bool STRSampleChannelData :: FindRawDataMinimumOnInterval (double& minimum, int
 
 bool STRSampleChannelData :: CurveIsBaselineFit (DataSignal* signal) {
 
-	double secs = ChannelData::GetAveSecondsPerBP ();
+	double secs = mContext->GetSettings ().mChannelData.AveSecondsPerBP;
 	double peak = signal->Peak ();
 	double mean = signal->GetMean ();
 	double left = signal->Value (mean - secs);
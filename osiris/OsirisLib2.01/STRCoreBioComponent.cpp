@@ -1064,7 +1064,7 @@ int STRLadderCoreBioComponent :: GridQualityTest () {
 
 	double ilsLeft = mLSData->GetFirstAnalyzedMean ();
 	double ilsRight = mLSData->GetLastAnalyzedMean ();
-	int minBP = CoreBioComponent::GetMinBioIDForArtifacts ();
+	int minBP = mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 	double startTime = mLSData->GetTimeForSpecifiedID ((double) minBP);
 	double effectiveLeft = ilsLeft;
 
@@ -1831,7 +1831,7 @@ int STRSampleCoreBioComponent :: SampleQualityTest (GenotypesForAMarkerSet* geno
 	NegCtrlReqReview negCtlTarget;
 	double ilsLeft = mLSData->GetFirstAnalyzedMean ();
 	double ilsRight = mLSData->GetLastAnalyzedMean ();
-	int minBP = CoreBioComponent::GetMinBioIDForArtifacts ();
+	int minBP = mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 	double startTime = mLSData->GetTimeForSpecifiedID ((double) minBP);
 	double effectiveLeft = ilsLeft;
 
@@ -36,6 +36,7 @@
 
 #include "CoreBioComponent.h"
 
+class PlotDataPoints;
 
 const int _STRLADDERCOREBIOCOMPONENT_ = 1070;
 const int _STRSAMPLECOREBIOCOMPONENT_= 1071;
@@ -81,6 +82,7 @@ public:
 	virtual int AnalyzeGridSM (RGTextOutput& text, RGTextOutput& ExcelText, OsirisMsg& msg, Boolean print = TRUE);
 	virtual int AnalyzeCrossChannelSM ();
 	virtual int WriteXMLGraphicDataSM (const RGString& graphicDirectory, const RGString& localFileName, SampleData* data, int analysisStage, const RGString& intro);
+	virtual int WriteXMLGraphicContentSM (RGTextOutput& output, const RGString& fileName, const RGString& intro, const PlotDataPoints& points, bool includePoints);
 	virtual void ReevaluateNoiseThresholdBasedOnMachineType (const RGString& machine);
 
 	//******************************************************************************************************************************************
@@ -91,6 +93,8 @@ public:
 	virtual void SaveAll (RGVOutStream& f) const;*/
 
 protected:
+	int WriteXMLGraphicFilesSM (const RGString& graphicDirectory, const RGString& fileName, const RGString& intro, const PlotDataPoints& points);	// .plt and binary sidecar
+
 /*	RGString mName;
 	PackedTime mTime;
 	ChannelData** mDataChannels;
@@ -146,6 +150,7 @@ public:
 	virtual int GridQualityTestSMPart2 (SmartMessagingComm& comm, int numHigherObjects);
 	virtual int RemoveInterlocusSignalsSM ();
 	virtual int WriteXMLGraphicDataSM (const RGString& graphicDirectory, const RGString& localFileName, SampleData* data, int analysisStage, const RGString& intro);
+	virtual int WriteXMLGraphicContentSM (RGTextOutput& output, const RGString& fileName, const RGString& intro, const PlotDataPoints& points, bool includePoints);
 
 	//******************************************************************************************************************************************
 
@@ -45,6 +45,62 @@
 #include "SmartNotice.h"
 #include "STRSmartNotices.h"
 #include "DirectoryManager.h"
+#include "PlotDataPoints.h"
+#include "SampleIOPipeline.h"
+#include "AnalysisTiming.h"
+
+#include <vector>
+
+using namespace std;
+
+
+//  The cross channel analyses merge the candidate peaks of all channels into one time ordered array and sweep it once.  This iterator
+//  steps through the array with the semantics of RGDListIterator, which the sweep was written for:  operator() returns the next signal
+//  (NULL and no move at the end), operator-- returns the previous signal (NULL and back to the start at the beginning)
+
+class CrossChannelSweepIterator {
+
+public:
+	CrossChannelSweepIterator (const vector<DataSignal*>& signals) : mSignals (signals), mCurrent (-1), mLast ((int)signals.size () - 1) {}
+
+	DataSignal* operator()() {
+
+		if (mLast < 0)
+			return NULL;
+
+		if (mCurrent == mLast)
+			return NULL;
+
+		mCurrent++;
+		return mSignals [mCurrent];
+	}
+
+	DataSignal* operator--() {
+
+		if (mCurrent < 0)
+			return NULL;
+
+		mCurrent--;
+
+		if (mCurrent < 0)
+			return NULL;
+
+		return mSignals [mCurrent];
+	}
+
+	DataSignal* CurrentItem () const {
+
+		if (mCurrent < 0)
+			return NULL;
+
+		return mSignals [mCurrent];
+	}
+
+protected:
+	const vector<DataSignal*>& mSignals;
+	int mCurrent;
+	int mLast;
+};
 
 
 // Smart Message related*********************************************************************************************************************************
@@ -70,7 +126,7 @@ int STRCoreBioComponent :: AnalyzeCrossChannelSM () {
 	double* means = new double [size];
 	int currentIndex;
 	bool* isDone = new bool [size];
-	RGDList OverallList;
+	vector<DataSignal*> OverallList;	// all channels, in time order
 	bool NowWeAreDone = false;
 	DataSignal* nextSignal;
 	DataSignal* nextSignal2;
@@ -219,6 +275,13 @@ int STRCoreBioComponent :: AnalyzeCrossChannelSM () {
 		delete tempIterator;
 	}
 
+	int nCandidates = 0;
+
+	for (i=1; i<=mNumberOfChannels; i++)
+		nCandidates += TempList [i]->Entries ();
+
+	OverallList.reserve (nCandidates);
+
 	for (i=1; i<=mNumberOfChannels; i++) {
 	
 		OnDeck [i] = (DataSignal*) TempList [i]->GetFirst ();  //used to be:  mDataChannels [i]->GetNextPreliminaryCurve ();
@@ -246,7 +309,7 @@ int STRCoreBioComponent :: AnalyzeCrossChannelSM () {
 			NowWeAreDone = true;
 			currentIndex = MinimumIndex (means, mNumberOfChannels);
 
-			OverallList.Append (OnDeck [currentIndex]);
+			OverallList.push_back (OnDeck [currentIndex]);
 			OnDeck [currentIndex] = (DataSignal*) TempList [currentIndex]->GetFirst ();   //used to be:  mDataChannels [currentIndex]->GetNextPreliminaryCurve ();
 
 			if (OnDeck [currentIndex] == NULL) {
@@ -277,7 +340,7 @@ int STRCoreBioComponent :: AnalyzeCrossChannelSM () {
 
 	delete[] TempList;
 
-	RGDListIterator it (OverallList);
+	CrossChannelSweepIterator it (OverallList);
 
 	for (i=1; i<=mNumberOfChannels; i++) {
 
@@ -642,7 +705,7 @@ int STRCoreBioComponent :: AnalyzeCrossChannelSM () {
 		}
 	}
 
-	OverallList.Clear ();
+	OverallList.clear ();
 
 	delete[] OnDeck;
 	delete[] means;
@@ -657,22 +720,48 @@ int STRCoreBioComponent :: AnalyzeCrossChannelSM () {
 int STRCoreBioComponent :: WriteXMLGraphicDataSM (const RGString& graphicDirectory, const RGString& localFileName, SampleData* data, int analysisStage, const RGString& intro) {
 
 	RGString fileName = localFileName;
-	int begin;
-	RGString pResult;
+	int numberOfPoints;
+	int* points;
 
 	if (fileName.ExtractLastCharacters (4) == DirectoryManager::GetDataFileTypeWithDot ())
 		fileName.ExtractAndRemoveLastCharacters (4);
 
-	RGString fullPath = graphicDirectory + "/" + fileName + ".plt";	
-	RGFile outputFile (fullPath, "wt");
-	RGTextOutput output (&outputFile, FALSE);
+	//
+	//  Compute the points once, for both the .plt file and its binary sidecar
+	//
 
-	if (!output.FileIsValid ()) {
+	PlotDataPoints plotPoints (mNumberOfChannels);
 
-		cout << "Could not write graphic file:  " << fullPath << endl; 
-		return -1;
+	for (int i=1; i<=mNumberOfChannels; i++) {
+
+		points = mDataChannels [i]->GetRawDataPoints (numberOfPoints);
+		plotPoints.SetPoints (i, PLOTPOINTS_RAW, points, numberOfPoints);
+		points = mDataChannels [i]->GetFitDataPoints (numberOfPoints);
+		plotPoints.SetPoints (i, PLOTPOINTS_ANALYZED, points, numberOfPoints);
+
+		if ((mAssociatedGrid != NULL) && (i != mLaneStandardChannel)) {
+
+			points = mAssociatedGrid->GetFitDataPointsForChannel (i, numberOfPoints, mDataChannels [i]);
+			plotPoints.SetPoints (i, PLOTPOINTS_LADDER, points, numberOfPoints);
+		}
+
+		points = mDataChannels [i]->GetBaselineDataPoints (numberOfPoints);
+
+		if (points != NULL) {
+
+			plotPoints.SetPoints (i, PLOTPOINTS_BASELINE, points, numberOfPoints);
+			plotPoints.SetBaselineStart (i, mDataChannels [i]->GetBaselineStart ());
+		}
 	}
 
+	return WriteXMLGraphicFilesSM (graphicDirectory, fileName, intro, plotPoints);
+}
+
+
+int STRCoreBioComponent :: WriteXMLGraphicContentSM (RGTextOutput& output, const RGString& fileName, const RGString& intro, const PlotDataPoints& points, bool includePoints) {
+
+	int begin;
+	RGString pResult;
 	RGString indent = "\t";
 	Endl endLine;
 	output << "<plt>" << endLine;
@@ -708,25 +797,39 @@ int STRCoreBioComponent :: WriteXMLGraphicDataSM (const RGString& graphicDirecto
 		output << indent << "<channel>" << endLine;
 		output << indent2 << "<nr>" << i << "</nr>" << endLine;
 		output << indent2 << "<minRFU>" << mDataChannels [i]->GetMinimumHeight () << "</minRFU>" << endLine;
-		output << indent2 << "<rawPoints>";
-		mDataChannels [i]->WriteRawData (output, " ");
-		output << "</rawPoints>" << endLine;
-		output << indent2 << "<analyzedPoints>";
-		mDataChannels [i]->WriteFitData (output, " ");
-		output << "</analyzedPoints>" << endLine;
+
+		if (includePoints) {
+
+			output << indent2 << "<rawPoints>";
+			points.WritePoints (output, i, PLOTPOINTS_RAW, " ");
+			output << "</rawPoints>" << endLine;
+			output << indent2 << "<analyzedPoints>";
+			points.WritePoints (output, i, PLOTPOINTS_ANALYZED, " ");
+			output << "</analyzedPoints>" << endLine;
 		
-		if ((mAssociatedGrid != NULL) && (i != mLaneStandardChannel)) {
+			if ((mAssociatedGrid != NULL) && (i != mLaneStandardChannel)) {
 
-			output << indent2 << "<ladderPoints>";
-			mAssociatedGrid->WriteFitDataForChannel (i, output, " ", mDataChannels [i]);
-			output << "</ladderPoints>" << endLine;
+				output << indent2 << "<ladderPoints>";
+				points.WritePoints (output, i, PLOTPOINTS_LADDER, " ");
+				output << "</ladderPoints>" << endLine;
+			}
 		}
 
 		//
 		//	Write Baseline data, if available
 		//
 
-		mDataChannels [i]->WriteBaselineData (output, " ", indent2);
+		if (points.HasPoints (i, PLOTPOINTS_BASELINE)) {
+
+			output << indent2 << "<baselineStart>" << points.GetBaselineStart (i) << "</baselineStart>" << endLine;
+
+			if (includePoints) {
+
+				output << indent2 << "<baselinePoints>";
+				points.WritePoints (output, i, PLOTPOINTS_BASELINE, " ");
+				output << "</baselinePoints>" << endLine;
+			}
+		}
 
 		WriteSmartPeakInfoToXMLForChannel (i, output, indent2, "samplePeak");
 		WriteSmartArtifactInfoToXMLForChannel (i, output, indent2);
@@ -741,12 +844,58 @@ int STRCoreBioComponent :: WriteXMLGraphicDataSM (const RGString& graphicDirecto
 		mAssociatedGrid->WriteLocusInfoToXML (output, indent);	// This should be OK - not message-related
 
 	output << "</plt>" << endLine;
-	outputFile.Flush ();
-
 	return 0;
 }
 
 
+int STRCoreBioComponent :: WriteXMLGraphicFilesSM (const RGString& graphicDirectory, const RGString& fileName, const RGString& intro, const PlotDataPoints& points) {
+
+	RGString fullPath = graphicDirectory + "/" + fileName + ".plt";	
+	RGString binaryPath = PlotDataPoints::BinaryFileName (fullPath);
+	unsigned long pltLength;
+
+	//  A sidecar left from an earlier analysis is removed first, so that the viewer never pairs it with the new .plt file,
+	//  even if this one cannot be finished
+
+	remove (binaryPath.GetData ());
+
+	RGFile* outputFile = SampleIOPipeline::OpenOutputFile (fullPath, "wt");	// written behind the analysis, if a pipeline is active
+
+	if (outputFile == NULL) {
+
+		cout << "Could not write graphic file:  " << fullPath << endl; 
+		return -1;
+	}
+
+	{
+		RGTextOutput output (outputFile, FALSE);
+		WriteXMLGraphicContentSM (output, fileName, intro, points, true);
+	}
+
+	outputFile->Flush ();
+	pltLength = outputFile->CurrentOffset ();
+	outputFile->Close ();
+	delete outputFile;
+
+	//
+	//  The binary sidecar is written after the .plt file, so it is never older than the .plt file it goes with.  Its header
+	//  is the .plt file without the point lists
+	//
+
+	RGFile* binaryFile = points.BeginBinaryFile (binaryPath);
+
+	if (binaryFile == NULL)
+		return -1;
+
+	{
+		RGTextOutput header (binaryFile, FALSE);
+		WriteXMLGraphicContentSM (header, fileName, intro, points, false);
+	}
+
+	return points.EndBinaryFile (binaryFile, pltLength);
+}
+
+
 void STRCoreBioComponent :: ReevaluateNoiseThresholdBasedOnMachineType (const RGString& machine) {
 
 	double fractionOfStandard = 1.0;
@@ -790,6 +939,7 @@ int STRLadderCoreBioComponent :: AnalyzeGridLociSM (RGTextOutput& text, RGTextOu
 	//  This is ladder stage 2
 	//
 
+	AnalysisTimer timer (TIMINGANALYZEGRIDLOCI);
 	int status = 0;
 	
 	for (int i=1; i<=mNumberOfChannels; i++) {
@@ -928,7 +1078,7 @@ int STRLadderCoreBioComponent :: AnalyzeCrossChannelSM () {
 	double* means = new double [size];
 	int currentIndex;
 	bool* isDone = new bool [size];
-	RGDList OverallList;
+	vector<DataSignal*> OverallList;	// all channels, in time order
 	bool NowWeAreDone = false;
 	DataSignal* nextSignal;
 	DataSignal* nextSignal2;
@@ -999,7 +1149,7 @@ int STRLadderCoreBioComponent :: AnalyzeCrossChannelSM () {
 
 			NowWeAreDone = true;
 			currentIndex = MinimumIndex (means, mNumberOfChannels);
-			OverallList.Append (OnDeck [currentIndex]);
+			OverallList.push_back (OnDeck [currentIndex]);
 			OnDeck [currentIndex] = mDataChannels [currentIndex]->GetNextPreliminaryCurve ();
 
 			if (OnDeck [currentIndex] == NULL) {
@@ -1022,7 +1172,7 @@ int STRLadderCoreBioComponent :: AnalyzeCrossChannelSM () {
 		}
 	}
 
-	RGDListIterator it (OverallList);
+	CrossChannelSweepIterator it (OverallList);
 
 	for (i=1; i<=mNumberOfChannels; i++) {
 
@@ -1321,7 +1471,7 @@ int STRLadderCoreBioComponent :: AnalyzeCrossChannelSM () {
 		}
 	}
 
-	OverallList.Clear ();
+	OverallList.clear ();
 
 	delete[] OnDeck;
 	delete[] means;
@@ -1439,7 +1589,7 @@ int STRLadderCoreBioComponent :: RemoveInterlocusSignalsSM () {
 
 	double ilsLeft = mLSData->GetFirstAnalyzedMean ();
 	double ilsRight = mLSData->GetLastAnalyzedMean ();
-	int minBP = CoreBioComponent::GetMinBioIDForArtifacts ();
+	int minBP = mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 	double startTime = mLSData->GetTimeForSpecifiedID ((double) minBP);
 	double effectiveLeft = ilsLeft;
 
@@ -1461,22 +1611,30 @@ int STRLadderCoreBioComponent :: RemoveInterlocusSignalsSM () {
 int STRLadderCoreBioComponent :: WriteXMLGraphicDataSM (const RGString& graphicDirectory, const RGString& localFileName, SampleData* data, int analysisStage, const RGString& intro) {
 
 	RGString fileName = localFileName;
-	int begin;
-	RGString pResult;
+	int numberOfPoints;
+	int* points;
 
 	if (fileName.ExtractLastCharacters (4) == DirectoryManager::GetDataFileTypeWithDot ())
 		fileName.ExtractAndRemoveLastCharacters (4);
 
-	RGString fullPath = graphicDirectory + "/" + fileName + ".plt";	
-	RGFile outputFile (fullPath, "wt");
-	RGTextOutput output (&outputFile, FALSE);
+	PlotDataPoints plotPoints (mNumberOfChannels);
 
-	if (!output.FileIsValid ()) {
+	for (int i=1; i<=mNumberOfChannels; i++) {
 
-		cout << "Could not write graphic file:  " << fullPath << endl; 
-		return -1;
+		points = mDataChannels [i]->GetRawDataPoints (numberOfPoints);
+		plotPoints.SetPoints (i, PLOTPOINTS_RAW, points, numberOfPoints);
+		points = mDataChannels [i]->GetFitDataPoints (numberOfPoints);
+		plotPoints.SetPoints (i, PLOTPOINTS_ANALYZED, points, numberOfPoints);
 	}
 
+	return WriteXMLGraphicFilesSM (graphicDirectory, fileName, intro, plotPoints);
+}
+
+
+int STRLadderCoreBioComponent :: WriteXMLGraphicContentSM (RGTextOutput& output, const RGString& fileName, const RGString& intro, const PlotDataPoints& points, bool includePoints) {
+
+	int begin;
+	RGString pResult;
 	RGString indent = "\t";
 	Endl endLine;
 	output << "<plt>" << endLine;
@@ -1507,12 +1665,17 @@ int STRLadderCoreBioComponent :: WriteXMLGraphicDataSM (const RGString& graphicD
 		output << indent << "<channel>" << endLine;
 		output << indent2 << "<nr>" << i << "</nr>" << endLine;
 		output << indent2 << "<minRFU>" << mDataChannels [i]->GetMinimumHeight () << "</minRFU>" << endLine;
-		output << indent2 << "<rawPoints>";
-		mDataChannels [i]->WriteRawData (output, " ");
-		output << "</rawPoints>" << endLine;
-		output << indent2 << "<analyzedPoints>";
-		mDataChannels [i]->WriteFitData (output, " ");
-		output << "</analyzedPoints>" << endLine;
+
+		if (includePoints) {
+
+			output << indent2 << "<rawPoints>";
+			points.WritePoints (output, i, PLOTPOINTS_RAW, " ");
+			output << "</rawPoints>" << endLine;
+			output << indent2 << "<analyzedPoints>";
+			points.WritePoints (output, i, PLOTPOINTS_ANALYZED, " ");
+			output << "</analyzedPoints>" << endLine;
+		}
+
 		WriteSmartPeakInfoToXMLForChannel (i, output, indent2, "samplePeak");
 		WriteSmartArtifactInfoToXMLForChannel (i, output, indent2);
 		output << indent << "</channel>" << endLine;
@@ -1525,8 +1688,6 @@ int STRLadderCoreBioComponent :: WriteXMLGraphicDataSM (const RGString& graphicD
 	}
 
 	output << "</plt>" << endLine;
-	outputFile.Flush ();
-
 	return 0;
 }
 
@@ -1547,6 +1708,7 @@ int STRSampleCoreBioComponent :: AnalyzeSampleLociSM (RGTextOutput& text, RGText
 	//  This is sample stage 2
 	//
 
+	AnalysisTimer timer (TIMINGANALYZESAMPLELOCI);
 	int status = 0;
 
 	for (int i=1; i<=mNumberOfChannels; i++) {
@@ -1586,7 +1748,7 @@ int STRSampleCoreBioComponent :: SampleQualityTestSM (GenotypesForAMarkerSet* ge
 
 	double ilsLeft = mLSData->GetFirstAnalyzedMean ();
 	double ilsRight = mLSData->GetLastAnalyzedMean ();
-	int minBP = CoreBioComponent::GetMinBioIDForArtifacts ();
+	int minBP = mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 	double startTime = mLSData->GetTimeForSpecifiedID ((double) minBP);
 	double effectiveLeft = ilsLeft;
 
@@ -1623,7 +1785,7 @@ int STRSampleCoreBioComponent :: SampleQualityTestSM (GenotypesForAMarkerSet* ge
 		}
 	}
 
-	if (Locus::IsNoYForAMEL ())
+	if (mContext->GetSettings ().mLocus.NoYForAMEL)
 		SetMessageValue (noYForAMEL, true);
 
 	if (mLSData->FinalTestForCriticalLaneStandardNoticesSM () < 0)
@@ -1663,7 +1825,7 @@ int STRSampleCoreBioComponent :: SignalQualityTestSM () {
 
 	double ilsLeft = mLSData->GetFirstAnalyzedMean ();
 	double ilsRight = mLSData->GetLastAnalyzedMean ();
-	int minBP = CoreBioComponent::GetMinBioIDForArtifacts ();
+	int minBP = mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 	double startTime = mLSData->GetTimeForSpecifiedID ((double) minBP);
 	double effectiveLeft = ilsLeft;
 
@@ -1810,7 +1972,7 @@ int STRSampleCoreBioComponent :: RemoveInterlocusSignalsSM () {
 	
 	double ilsLeft = mLSData->GetFirstAnalyzedMean ();
 	double ilsRight = mLSData->GetLastAnalyzedMean ();
-	int minBP = CoreBioComponent::GetMinBioIDForArtifacts ();
+	int minBP = mContext->GetSettings ().mCoreBioComponent.minBioIDForArtifacts;
 	double startTime = mLSData->GetTimeForSpecifiedID ((double) minBP);
 	double effectiveLeft = ilsLeft;
 
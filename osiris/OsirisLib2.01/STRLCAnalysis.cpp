@@ -60,15 +60,33 @@
 
 using namespace std;
 
-bool* STRLCAnalysis::InitialMatrix = NULL;
-RGString STRLCAnalysis::OverrideString;
-RGString STRLCAnalysis::OutputSubDirectory;
-RGString STRLCAnalysis::MsgBookBuildTime;
-
 
 PERSISTENT_DEFINITION (STRLCAnalysis, _STRLCANALYSIS_, "STRLCAnalysis")
 
 
+SampleAnalysisStruct :: SampleAnalysisStruct (SampleDataStruct* sampleData, RGDList& ladderList, ParameterServer* pServer, GenotypesForAMarkerSet* pGenotypes,
+	RGTextOutput& excelSummary, RGTextOutput& excelLinks, RGTextOutput& xmlExcelLinks, RGTextOutput& tempXMLExcelLinks,
+	RGTextOutput& tempExcelSummary, RGTextOutput& tempExcelLinks) :
+mSampleData (sampleData),
+mLadderList (ladderList),
+mServer (pServer),
+mGenotypes (pGenotypes),
+mPrintGraphics (false),
+mExcelSummary (excelSummary),
+mExcelLinks (excelLinks),
+mXMLExcelLinks (xmlExcelLinks),
+mTempXMLExcelLinks (tempXMLExcelLinks),
+mTempExcelSummary (tempExcelSummary),
+mTempExcelLinks (tempExcelLinks),
+mHasPosControl (false),
+mHasNegControl (false),
+mPopulatedBaseLocusList (false),
+mSamplesProcessed (0),
+mNumberOfSampleFiles (0) {
+
+}
+
+
 bool DoesStringContainOneOfSubset (const RGString& target, RGDList& subset) {
 
 	RGString* nextString;
@@ -85,7 +103,7 @@ bool DoesStringContainOneOfSubset (const RGString& target, RGDList& subset) {
 }
 
 
-STRLCAnalysis :: STRLCAnalysis () : SmartMessagingObject (), WorkingFile (NULL), mCollection (NULL) {
+STRLCAnalysis :: STRLCAnalysis () : SmartMessagingObject (), WorkingFile (NULL), mCollection (NULL), mContext (AnalysisContext::GetCurrentContext ()) {
 
 	InitializeSmartMessages ();
 	mValid = false;
@@ -93,7 +111,8 @@ STRLCAnalysis :: STRLCAnalysis () : SmartMessagingObject (), WorkingFile (NULL),
 
 
 STRLCAnalysis :: STRLCAnalysis (PopulationCollection* collection, const RGString& parentDirectoryForReports, const RGString& messageBookPath) :
-SmartMessagingObject (), mCollection (collection), mParentDirectoryForReports (parentDirectoryForReports), WorkingFile (NULL) {
+SmartMessagingObject (), mCollection (collection), mParentDirectoryForReports (parentDirectoryForReports), WorkingFile (NULL),
+mContext (AnalysisContext::GetCurrentContext ()) {
 
 	RGString MessageBookName = messageBookPath + "/OsirisMessageBook2.xml";
 	RGFile messages (MessageBookName, "rt");
@@ -1197,7 +1216,7 @@ int STRLCAnalysis :: AnalyzeIncrementally (const RGString& prototypeInputDirecto
 	XMLExcelLinks << "\t\t\t<minRFUinterlocus>" << minInterlocusRFU << "</minRFUinterlocus>\n";
 	XMLExcelLinks << "\t\t\t<DataAnalyzed>";
 
-	if (CoreBioComponent::GetUseRawData ())
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData)
 		XMLExcelLinks << "false</DataAnalyzed>\n";
 
 	else
@@ -1242,7 +1261,7 @@ int STRLCAnalysis :: AnalyzeIncrementally (const RGString& prototypeInputDirecto
 	PlotString << minLaneStdRFU << "</minRFUILS>\n\t\t<minRFUladder>" << minLadderRFU;
 	PlotString << "</minRFUladder>\n\t\t<minRFUinterlocus>" << minInterlocusRFU << "</minRFUinterlocus>\n\t\t<DataAnalyzed>";
 
-	if (CoreBioComponent::GetUseRawData ())
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData)
 		PlotString << "false</DataAnalyzed>\n\t\t<StdPosControlName>";
 
 	else
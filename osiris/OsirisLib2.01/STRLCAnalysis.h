@@ -40,6 +40,7 @@
 #include "Notice.h"
 #include "rgpersist.h"
 #include "SmartMessagingObject.h"
+#include "AnalysisContext.h"
 
 #include <string>
 #include <math.h>
@@ -49,12 +50,48 @@ using namespace std;
 
 class SmartMessage;
 class SmartNotice;
+class CoreBioComponent;
+class fsaFileData;
+class ParameterServer;
+class GenotypesForAMarkerSet;
+class SampleWorkerPool;
+struct SampleDataStruct;
+struct SampleWorkerResult;
 
 const int _STRLCANALYSIS_ = 1507;
 
 PERSISTENT_PREDECLARATION (STRLCAnalysis)
 
 
+struct SampleAnalysisStruct {
+
+	SampleDataStruct* mSampleData;
+	RGDList& mLadderList;
+	ParameterServer* mServer;
+	GenotypesForAMarkerSet* mGenotypes;
+	RGString mDirectoryName;
+	RGString mGraphicsDirectory;
+	RGString mPlotString;
+	bool mPrintGraphics;
+	RGTextOutput& mExcelSummary;
+	RGTextOutput& mExcelLinks;
+	RGTextOutput& mXMLExcelLinks;
+	RGTextOutput& mTempXMLExcelLinks;
+	RGTextOutput& mTempExcelSummary;
+	RGTextOutput& mTempExcelLinks;
+
+	bool mHasPosControl;
+	bool mHasNegControl;
+	bool mPopulatedBaseLocusList;
+	int mSamplesProcessed;
+	int mNumberOfSampleFiles;
+
+	SampleAnalysisStruct (SampleDataStruct* sampleData, RGDList& ladderList, ParameterServer* pServer, GenotypesForAMarkerSet* pGenotypes,
+		RGTextOutput& excelSummary, RGTextOutput& excelLinks, RGTextOutput& xmlExcelLinks, RGTextOutput& tempXMLExcelLinks,
+		RGTextOutput& tempExcelSummary, RGTextOutput& tempExcelLinks);
+};
+
+
 class STRLCAnalysis : public SmartMessagingObject {
 
 	PERSISTENT_DECLARATION (STRLCAnalysis)
@@ -72,13 +109,27 @@ public:
 
 	bool isValid () const { return mValid; }
 	void SetXMLCommandLineString (const RGString& cmdString) { mCommandLineString = cmdString; }
+	void SetParentDirectoryForReports (const RGString& parentDirectory) { mParentDirectoryForReports = parentDirectory; }
 	void SetTableLink (int linkNumber);
+	AnalysisContext* GetContext () const { return mContext; }
 
 	static void SetMaximumNumberOfChannels (int maxChannels) { mMaximumNumberOfChannels = maxChannels; }
 	static int GetMaximumNumberOfChannels () { return mMaximumNumberOfChannels; }
 
-	static void SetMsgBookBuildTime (const RGString& buildTime) { MsgBookBuildTime = buildTime; }
-	static RGString GetMsgBookBuildTime () { return MsgBookBuildTime; }
+	static void SetMsgBookBuildTime (const RGString& buildTime) { Settings ().MsgBookBuildTime = buildTime; }
+	static RGString GetMsgBookBuildTime () { return Settings ().MsgBookBuildTime; }
+
+	static void SetNumberOfJobs (int jobs) { Settings ().NumberOfJobs = jobs; }
+	static int GetNumberOfJobs () { return Settings ().NumberOfJobs; }
+
+	static void SetUseILSCache (bool use) { Settings ().UseILSCache = use; }
+	static bool GetUseILSCache () { return Settings ().UseILSCache; }
+
+	static void SetReadAhead (int depth) { Settings ().ReadAhead = depth; }
+	static int GetReadAhead () { return Settings ().ReadAhead; }
+
+	static void SetWriteBehind (int depth) { Settings ().WriteBehind = depth; }
+	static int GetWriteBehind () { return Settings ().WriteBehind; }
 
 	// Legacy message functions************************************************************************************************************************
 	// ************************************************************************************************************************************************
@@ -123,16 +174,16 @@ public:
 
 	static void CreateInitializationData (int scope);
 	static void InitializeMessageMatrix (bool* matrix, int size);
-	static void ClearInitializationMatrix () { delete[] InitialMatrix; InitialMatrix = NULL; }
+	static void ClearInitializationMatrix ();
 	static int GetScope () { return 6; }
 	static void CreateAllInitializationMatrices ();
 	static void ClearAllInitializationMatrices ();
-	static void SetOverrideString (const RGString& str) { OverrideString = str; }
-	static bool OverrideStringIsEmpty () { return (OverrideString.Length () == 0); }
-	static RGString GetOverrideString () { return OverrideString; }
+	static void SetOverrideString (const RGString& str) { Settings ().OverrideString = str; }
+	static bool OverrideStringIsEmpty () { return (Settings ().OverrideString.Length () == 0); }
+	static RGString GetOverrideString () { return Settings ().OverrideString; }
 
-	static void SetOutputSubDirectory (const RGString& subDir) { OutputSubDirectory = subDir; }
-	static RGString GetOutputSubDirectory () { return OutputSubDirectory; }
+	static void SetOutputSubDirectory (const RGString& subDir) { Settings ().OutputSubDirectory = subDir; }
+	static RGString GetOutputSubDirectory () { return Settings ().OutputSubDirectory; }
 
 protected:
 	PopulationCollection* mCollection;
@@ -150,6 +201,7 @@ protected:
 	RGString WorkingFileName;
 	RGFile* WorkingFile;
 	RGDList mBaseLocusList;	// This is the list of BaseLoci - the directory level equivalent of Locus links
+	AnalysisContext* mContext;	// the context current at construction; made current for each analysis
 
 	// Smart Message Data*****************************************************************************************************************
 	//************************************************************************************************************************************
@@ -165,11 +217,17 @@ protected:
 	//void InitializeSmartMessages ();
 	//void CleanupSmartMessages ();
 
+	CoreBioComponent* AnalyzeSampleSM (const RGString& fileName, fsaFileData*& data, SampleAnalysisStruct& analysis, SampleWorkerResult& result);
+	void ReportSampleSM (CoreBioComponent* bioComponent, const RGString& fileName, fsaFileData* data, SampleAnalysisStruct& analysis);
+	void ProcessSampleSM (const RGString& fileName, SampleAnalysisStruct& analysis);
+	void RunSampleWorkerSM (SampleWorkerPool& workers, const RGString& fileName, SampleAnalysisStruct& analysis);
+	void CollectSampleWorkerSM (SampleWorkerPool& workers, SampleAnalysisStruct& analysis);
+	void RecordSampleResultSM (const RGString& fileName, const SampleWorkerResult& result, SampleAnalysisStruct& analysis);
+
+	static int AppendTemporaryFile (RGTextOutput& text, const RGString& fileName);	// copies file to text in blocks; -1 if file cannot be opened
+
 	static int mMaximumNumberOfChannels;
-	static bool* InitialMatrix;
-	static RGString OverrideString;
-	static RGString OutputSubDirectory;
-	static RGString MsgBookBuildTime;
+	static AnalysisRunSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mAnalysis; }
 };
 
 
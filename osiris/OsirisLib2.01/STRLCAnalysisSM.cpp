@@ -60,6 +60,11 @@
 #include "Genetics.h"
 #include "OsirisVersion.h"
 #include "TracePrequalification.h"
+#include "SampleWorkerPool.h"
+#include "SampleIOPipeline.h"
+#include "LaneStandardCache.h"
+#include "AnalysisStatus.h"
+#include "AnalysisTiming.h"
 #include <list>
 #include <iostream>
 #include <time.h>
@@ -69,7 +74,8 @@ using namespace std;
 
 
 STRLCAnalysis :: STRLCAnalysis (PopulationCollection* collection, const RGString& parentDirectoryForReports, const RGString& messageBookPath, bool isSmartMsgAnalysis) :
-SmartMessagingObject (), mCollection (collection), mParentDirectoryForReports (parentDirectoryForReports), WorkingFile (NULL) {
+SmartMessagingObject (), mCollection (collection), mParentDirectoryForReports (parentDirectoryForReports), WorkingFile (NULL),
+mContext (AnalysisContext::GetCurrentContext ()) {
 
 	RGString MessageBookName;
 	mValid = false;
@@ -130,7 +136,8 @@ SmartMessagingObject (), mCollection (collection), mParentDirectoryForReports (p
 
 
 STRLCAnalysis :: STRLCAnalysis (const RGString& ladderInformationDirectory, const RGString& markerSetName, const RGString& parentDirectoryForReports, const RGString& messageBookPath, bool isSmartMsgAnalysis) :
-SmartMessagingObject (), mCollection (NULL), mParentDirectoryForReports (parentDirectoryForReports), WorkingFile (NULL) {
+SmartMessagingObject (), mCollection (NULL), mParentDirectoryForReports (parentDirectoryForReports), WorkingFile (NULL),
+mContext (AnalysisContext::GetCurrentContext ()) {
 
 	RGString MessageBookName;
 	mValid = false;
@@ -205,7 +212,8 @@ SmartMessagingObject (), mCollection (NULL), mParentDirectoryForReports (parentD
 
 
 STRLCAnalysis :: STRLCAnalysis (const RGString& ladderInformationDirectory, const RGString& markerSetName, const RGString& parentDirectoryForReports, const RGString& messageBookPath, bool isSmartMsgAnalysis, bool isFileInput) :
-SmartMessagingObject (), mCollection (NULL), mParentDirectoryForReports (parentDirectoryForReports), WorkingFile (NULL) {
+SmartMessagingObject (), mCollection (NULL), mParentDirectoryForReports (parentDirectoryForReports), WorkingFile (NULL),
+mContext (AnalysisContext::GetCurrentContext ()) {
 
 	RGString MessageBookName;
 	mValid = false;
@@ -290,6 +298,8 @@ SmartMessagingObject (), mCollection (NULL), mParentDirectoryForReports (parentD
 
 int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirectory, const RGString& markerSet, int outputLevel, const RGString& graphicsDirectory) {
 
+	mContext->MakeCurrent ();		// the context in which this analysis was constructed, in case another has been made current since
+	AnalysisRunSettings& runSettings = mContext->GetSettings ().mAnalysis;
 	Boolean print = TRUE;
 	smDefaultsAreOverridden defaultsAreOverridden;
 	smUseSampleNamesForControlSampleTestsPreset useSampleNamesForControlSampleTests;
@@ -312,10 +322,10 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 		//return -20;
 	}
 
-	if (!STRLCAnalysis::OverrideStringIsEmpty ()) {
+	if (runSettings.OverrideString.Length () > 0) {
 
 		SetMessageValue (defaultsAreOverridden, true);
-		AppendDataForSmartMessage (defaultsAreOverridden, STRLCAnalysis::GetOverrideString ());
+		AppendDataForSmartMessage (defaultsAreOverridden, runSettings.OverrideString);
 	}
 
 	//Notice* newNotice;
@@ -367,7 +377,11 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 
 	RGDirectory::MakeDirectory (FullPathForReports);
 
-	RGString outputSubDirectory = STRLCAnalysis::GetOutputSubDirectory ();
+	//  The ILS cache is shared by all analyses of the input directory, so it is not in the (time stamped) output subdirectory
+
+	RGString ILSCacheFullPath = FullPathForReports + "/" + OutputDirectoryBase + ".ilsCache";
+
+	RGString outputSubDirectory = runSettings.OutputSubDirectory;
 
 	if (outputSubDirectory.Length () > 0) {
 
@@ -412,7 +426,6 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 	int ChannelNumber = 1;
 	SampleDirectory->Initialize ();
 	int NSampleFiles = SampleDirectory->GetNumberOfFilesInDirectory ();
-	double Progress;
 	int SamplesProcessed = 0;
 
 	TestCharacteristic* testPeak = new STRTestControlCharacteristic ();
@@ -427,7 +440,6 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 	int status;
 	RGString CurrentMarkerSet;
 
-	CoreBioComponent* bioComponent;
 	CoreBioComponent* ladderBioComponent;
 
 	RGString FileName;
@@ -450,6 +462,7 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 	RGString tempSummaryFullPath = FullPathForReports + "/temp" + OutputFileName + "Summary.txt";
 	RGString tempSummaryFullPathWithLinks = FullPathForReports + "/temp" + OutputFileName + ".txt";
 	RGString tempXMLSummaryFullPathWithLinks = FullPathForReports + "/temp" + OutputFileName + "XML.txt";
+	RGString tempTimingFullPath = FullPathForReports + "/temp" + OutputFileName + "Timing.txt";
 
 	RGString debugOutputFullPath = FullPathForReports + "/" + OutputFileName + "Debug.txt";
 
@@ -560,6 +573,10 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 	RGLogBook tempExcelLinks (&tempOutputSummaryLinks, outputLevel, FALSE);
 	RGLogBook tempXMLExcelLinks (&tempXMLOutputSummaryLinks, outputLevel, FALSE);
 	SmartMessage::CreateDebugFile (debugOutputFullPath);
+
+	if (AnalysisTiming::IsEnabled ())
+		AnalysisTiming::OpenFiles (FullPathForReports + "/" + OutputFileName + "Timing", tempTimingFullPath);
+
 	GridDataStruct* GridData = new GridDataStruct (mCollection, markerSetName, testPeak, text, ExcelText, Message, print);
 	SampleDataStruct* SampleData = new SampleDataStruct (mCollection, markerSetName, testPeak, testPeak, text, ExcelText, Message, print);
 	PopulationMarkerSet* set = mCollection->GetNamedPopulationMarkerSet (markerSetName);
@@ -625,7 +642,7 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 	XMLExcelLinks.SetOutputLevel (1);
 	XMLExcelLinks << "<OsirisAnalysisReport>\n\t<Version>" << OSIRIS_VERSION << "</Version>\n\t";
 	XMLExcelLinks << "<FullVersion>" << OSIRIS_FULLNAME << "</FullVersion>\n\t";
-	XMLExcelLinks << "<MsgBookBuildTime>" << STRLCAnalysis::GetMsgBookBuildTime () << "</MsgBookBuildTime>\n\t<Heading>\n\t\t<FileName>";
+	XMLExcelLinks << "<MsgBookBuildTime>" << runSettings.MsgBookBuildTime << "</MsgBookBuildTime>\n\t<Heading>\n\t\t<FileName>";
 	XMLExcelLinks << xmlwriter::EscAscii (XMLSummaryFullPathWithLinks, &pResult) << "</FileName>\n\t\t";
 	XMLExcelLinks << "<CreationTime>" << (long)thisTime << "</CreationTime>\n\t\t";
 	XMLExcelLinks << "<CommandLine>\n" << mCommandLineString.GetData () << "\t\t</CommandLine>\n\t\t";
@@ -643,7 +660,7 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 	XMLExcelLinks << "\t\t\t<minRFUsampleDetection>" << minRFUSampleDetectionRFU << "</minRFUsampleDetection>\n";
 	XMLExcelLinks << "\t\t\t<DataAnalyzed>";
 
-	if (CoreBioComponent::GetUseRawData ())
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData)
 		XMLExcelLinks << "false</DataAnalyzed>\n";
 
 	else
@@ -683,7 +700,7 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 
 	PlotString << "\t<Version>" << OSIRIS_VERSION << "</Version>\n";
 	PlotString << "\t<FullVersion>" << OSIRIS_FULLNAME << "</FullVersion>\n";
-	PlotString << "\t<MsgBookBuildTime>" << STRLCAnalysis::GetMsgBookBuildTime () << "</MsgBookBuildTime>\n";
+	PlotString << "\t<MsgBookBuildTime>" << runSettings.MsgBookBuildTime << "</MsgBookBuildTime>\n";
 	PlotString << "\t<parameters>\n\t\t<inputDirectory>" << xmlwriter::EscAscii (DirectoryName, &pResult) << "</inputDirectory>\n\t\t<outputDirectory>";
 	PlotString << xmlwriter::EscAscii (FullPathForReports, &pResult) << "</outputDirectory>\n\t\t<kit>";
 	PlotString << xmlwriter::EscAscii (markerSet, &pResult) << "</kit>\n\t\t<ls>";
@@ -691,7 +708,7 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 	PlotString << minLaneStdRFU << "</minRFUILS>\n\t\t<minRFUladder>" << minLadderRFU;
 	PlotString << "</minRFUladder>\n\t\t<minRFUinterlocus>" << minInterlocusRFU << "</minRFUinterlocus>\n\t\t<DataAnalyzed>";
 
-	if (CoreBioComponent::GetUseRawData ())
+	if (mContext->GetSettings ().mCoreBioComponent.UseRawData)
 		PlotString << "false</DataAnalyzed>\n\t\t<StdPosControlName>";
 
 	else
@@ -730,14 +747,9 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 	RGString FitDataName;
 //	RGString OsirisGraphics (graphicsDirectory);
 	bool ladderOK;
-	bool hasPosControl = false;
-	bool hasNegControl = false;
 	bool foundALadder = true;
 	smLadderFailed ladderFailed;
 	smSampleIsLadder sampleIsLadder;
-	smSampleUnanalyzable sampleFailed;
-	smSampleIsPosCtrl sampleIsPosCtrl;
-	smSampleIsNegCtrl sampleIsNegCtrl;
 	smNoPosCtrlFound noPosCtrlFound;
 	smNoNegCtrlFound noNegCtrlFound;
 
@@ -760,7 +772,15 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 
 //	RGString GraphicsDirectory = OsirisGraphics + OutputDirectoryBase;
 	RGString GraphicsDirectory = FullPathForReports;
-	RGString idString;
+	SampleAnalysisStruct SampleAnalysis (SampleData, LadderList, pServer, pGenotypes, ExcelSummary, ExcelLinks, XMLExcelLinks, tempXMLExcelLinks,
+		tempExcelSummary, tempExcelLinks);
+	SampleAnalysis.mDirectoryName = DirectoryName;
+	SampleAnalysis.mGraphicsDirectory = GraphicsDirectory;
+	SampleAnalysis.mPlotString = PlotString;
+	SampleAnalysis.mPrintGraphics = printGraphics;
+	SampleWorkerPool* workers = NULL;
+	SampleIOPipeline* pipeline = NULL;
+	int graphicsWriteErrors = 0;
 
 	//if (printGraphics)
 	//	RGDirectory::MakeDirectory (GraphicsDirectory);
@@ -771,6 +791,16 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 	bool isFirstLadder = true;
 	RGString ABIModelNumber;
 
+	LaneStandardCache::Close ();
+
+	if (runSettings.UseILSCache) {
+
+		int nCached = LaneStandardCache::Open (ILSCacheFullPath);
+
+		if (nCached > 0)
+			cout << "Found " << nCached << " ILS selections in ILS cache" << endl;
+	}
+
 	while (SampleDirectory->GetNextLadderFile (LadderFileName, cycled) && !cycled) {
 
 		FullPathName = DirectoryName + "/" + LadderFileName;
@@ -781,6 +811,8 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 			WorkingFile->Flush ();
 		}
 
+		AnalysisStatus::ReportSampleStarted (LadderFileName, ANALYSISSTATUSLADDER);
+		AnalysisTiming::BeginSample (LadderFileName, true);
 		data = new fsaFileData (FullPathName);
 		NumFiles++;
 		ladderOK = true;
@@ -789,11 +821,15 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 		if (!data->IsValid ()) {
 
 			NoticeStr << "Oops, " << LadderFileName.GetData () << " is not valid...Skipping";
-			cout << NoticeStr << endl;
+
+			if (AnalysisStatus::WriteConsoleProgress ())
+				cout << NoticeStr << endl;
+
 			NoticeStr << "\n";
 			ExcelText.Write (1, NoticeStr);
 			text << NoticeStr;
 			delete data;
+			AnalysisStatus::ReportSampleFinished (LadderFileName, ANALYSISSTATUSLADDER);
 			continue;
 		}
 
@@ -920,7 +956,7 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 			if (SampleOutput->FileIsValid ())
 				ladderBioComponent->WriteRawDataAndFitData (*SampleOutput, data);
 
-			else
+			else if (AnalysisStatus::WriteConsoleProgress ())
 				cout << "Could not write graphics info to file " << FitDataName << ".  Skipping..." << endl;
 
 			delete SampleOutput;
@@ -928,8 +964,7 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 		}
 
 		SamplesProcessed++;
-		Progress = 100.0 * (double)SamplesProcessed / (double)NSampleFiles;
-		cout << "Progress = " << Progress << "%." << endl;
+		AnalysisStatus::ReportProgress (SamplesProcessed, NSampleFiles);
 
 		delete data;
 		data = NULL;
@@ -981,6 +1016,8 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 		ladderBioComponent->AddAllSmartMessageReporters (commSM, numHigherObjects);	// this does non-signals only; signals have already been done
 
 		ladderBioComponent->WriteXMLGraphicDataSM (GraphicsDirectory, LadderFileName, data, 4, PlotString);
+		AnalysisTiming::FinishSample ();
+		AnalysisTiming::WriteSample ();
 		ladderBioComponent->PrepareLociForOutput ();
 		ladderBioComponent->ReportGridTableRow (ExcelSummary);
 		ladderBioComponent->ReportGridTableRowWithLinks (ExcelLinks);
@@ -991,7 +1028,10 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 		if (!ladderOK) {
 
 			NoticeStr = "BIOCOMPONENT COULD NOT ANALYZE LADDER.  Skipping...";
-			cout << NoticeStr << "Return = " << status << endl;
+
+			if (AnalysisStatus::WriteConsoleProgress ())
+				cout << NoticeStr << "Return = " << status << endl;
+
 			ExcelText << CLevel (1) << NoticeStr << "\n";
 			text << NoticeStr << "\n";
 			ExcelText << ladderBioComponent->GetError () << PLevel ();
@@ -1006,17 +1046,19 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 			LadderList.Append (ladderBioComponent);
 			NoticeStr = "";
 			NoticeStr << CurrentMarkerSet.GetData () << " ladder fit was successful";
-			cout << NoticeStr << endl;
+
+			if (AnalysisStatus::WriteConsoleProgress ())
+				cout << NoticeStr << endl;
+
 			NoticeStr << "\n";
 			ExcelText.Write (1, NoticeStr);
 			text << NoticeStr;
 		}
+
+		AnalysisStatus::ReportSampleFinished (LadderFileName, ladderOK ? (ANALYSISSTATUSLADDER | ANALYSISSTATUSSAMPLEOK) : ANALYSISSTATUSLADDER);
 	}
 
 	cout << "Processed all ladders.  Number of ladders = " << LadderList.Entries () << endl;
-	RGString SampleName;
-	bool sampleOK;
-	bool populatedBaseLocusList = false;
 
 	if (LadderList.Entries () == 0) {
 
@@ -1029,12 +1071,40 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 	}
 
 	SampleDirectory->RewindDirectory ();
+	SampleAnalysis.mSamplesProcessed = SamplesProcessed;
+	SampleAnalysis.mNumberOfSampleFiles = NSampleFiles;
+
+	if ((runSettings.NumberOfJobs > 1) && SampleWorkerPool::IsAvailable ()) {
+
+		//  Samples are analyzed by worker processes, whose output is merged in sample order (see SampleWorkerPool.h)
+
+		workers = new SampleWorkerPool (runSettings.NumberOfJobs, FullPathForReports + "/temp" + OutputFileName + "Worker");
+		workers->AddOutputFile (text.GetFile ());
+		workers->AddOutputFile (&OutputFile);
+		workers->AddOutputFile (&OutputSummary);
+		workers->AddOutputFile (&OutputSummaryLinks);
+		workers->AddOutputFile (&XMLOutputSummaryLinks);
+		workers->AddOutputFile (&tempOutputSummary);
+		workers->AddOutputFile (&tempOutputSummaryLinks);
+		workers->AddOutputFile (&tempXMLOutputSummaryLinks);
+		workers->AddOutputFile (SmartMessage::GetDebugFile ());
+		workers->AddOutputFile (AnalysisTiming::GetFile ());
+		workers->AddOutputFile (AnalysisTiming::GetOARFile ());
+		cout << "Analyzing up to " << runSettings.NumberOfJobs << " samples at a time..." << endl;
+	}
+
+	else if (((runSettings.ReadAhead > 0) || (runSettings.WriteBehind > 0)) && SampleIOPipeline::IsAvailable ()) {
+
+		//  Sample files are read ahead of, and graphics files written behind, the analysis (see SampleIOPipeline.h).  Not
+		//  used with workers, which are forked
+
+		pipeline = new SampleIOPipeline (runSettings.ReadAhead, runSettings.WriteBehind);
+	}
 
 	// Modify below functions to accumlate partial work, as possible, in spite of "errors", and report
 
-	while (SampleDirectory->GetNextOrderedSampleFile (FileName)) {
+	while ((pipeline != NULL) ? pipeline->GetNextOrderedSampleFile (*SampleDirectory, DirectoryName, FileName) : SampleDirectory->GetNextOrderedSampleFile (FileName)) {
 
-		sampleOK = true;
 		FullPathName = DirectoryName + "/" + FileName;
 
 		if (WorkingFile != NULL) {
@@ -1043,326 +1113,534 @@ int STRLCAnalysis :: AnalyzeIncrementallySM (const RGString& prototypeInputDirec
 			WorkingFile->Flush ();
 		}
 
-		data = new fsaFileData (FullPathName);
-		bioComponent = new STRSampleCoreBioComponent (data->GetName ());
-		bioComponent->SetSampleName (data->GetSampleName ());
-		bioComponent->SetFileName (FileName);
-
-		if (GetMessageValue (useSampleNamesForControlSampleTests))
-			bioComponent->SetControlIdName (bioComponent->GetDataSampleName ());
+		if (workers != NULL)
+			RunSampleWorkerSM (*workers, FileName, SampleAnalysis);
 
 		else
-			bioComponent->SetControlIdName (FileName);
+			ProcessSampleSM (FileName, SampleAnalysis);
+	}
 
-		commSM.SMOStack [1] = (SmartMessagingObject*) bioComponent;
+	if (workers != NULL) {
 
-		if (bioComponent->PrepareSampleForAnalysisSM (*data, SampleData) < 0) {
+		while (!workers->IsEmpty ())
+			CollectSampleWorkerSM (*workers, SampleAnalysis);
 
-			sampleOK = false;
-			NoticeStr = "";
-			NoticeStr << "COULD NOT INITIALIZE AND PREPARE FOR ANALYSIS, FOR FILE:  " << FileName << "\n";
-			ExcelText << CLevel (1) << NoticeStr << bioComponent->GetError ();
-			ExcelText << "COULD NOT ANALYZE FSA FILE:  " << FullPathName << ".  Skipping..." << "\n" << PLevel ();
-			cout << NoticeStr.GetData () << endl;
-			NoticeStr = "";
-			bioComponent->SetMessageValue (sampleFailed, true);
-		}
+		delete workers;
+		workers = NULL;
+	}
 
-		if (sampleOK && !populatedBaseLocusList) {
+	if (pipeline != NULL) {
 
-			populatedBaseLocusList = true;
-			bioComponent->AppendAllBaseLociToList (mBaseLocusList);
-		}
+		pipeline->FinishWrites ();
+		graphicsWriteErrors = pipeline->GetNumberOfWriteErrors ();
+		cout << "Time waiting for sample files = " << pipeline->GetSecondsWaitingForInput () << " sec; waiting for graphics output = ";
+		cout << pipeline->GetSecondsWaitingForOutput () << " sec" << endl;
+		delete pipeline;
+		pipeline = NULL;
+	}
 
-		if (sampleOK && printGraphics) {
+	if (!SampleAnalysis.mHasPosControl) {
 
-			FitDataName = GraphicsDirectory + "/Fit" + FileName + ".txt";
-			SampleOutput = new RGTextOutput (FitDataName, FALSE);
+		SetMessageValue (noPosCtrlFound, true);
+	}
 
-			if (SampleOutput->FileIsValid ())
-				bioComponent->WriteRawDataAndFitData (*SampleOutput, data);
+	if (!SampleAnalysis.mHasNegControl) {
 
-			else
-				cout << "Could not write graphics info for file " << FitDataName << ".  Skipping..." << endl;
+		SetMessageValue (noNegCtrlFound, true);
+	}
 
-			delete SampleOutput;
-			SampleOutput = NULL;
-		}
+finishOutput:
 
-		if (sampleOK && (bioComponent->PreliminarySampleAnalysisSM (LadderList, SampleData) < 0)) {
+	delete SampleDirectory;
 
-			sampleOK = false;
-			NoticeStr = "";
-			NoticeStr << "COULD NOT PERFORM PRELIMINARY ANALYSIS, FILE:  " << FileName << "\n";
-			ExcelText << CLevel (1) << NoticeStr << bioComponent->GetError () << "\n";
-			ExcelText << "COULD NOT ANALYZE FSA FILE:  " << FullPathName << ".  Skipping..." << "\n" << PLevel ();
-			NoticeStr = "";
-			bioComponent->SetMessageValue (sampleFailed, true);
-		}
+	for (i=1; i<=5; i++) {
 
-		bioComponent->SetNegativeControlFalseSM ();
-		bioComponent->SetPositiveControlFalseSM ();
-		idString = bioComponent->GetControlIdName ();
-	//	cout << "ID String = " << (char*) idString.GetData () << " for file name " << (char*) FileName.GetData () << endl;
+		EvaluateSmartMessagesForStage (commSM, 1, i);
+		SetTriggersForAllMessages (commSM, 1, i);
+	}
 
-		if (sampleOK && pServer->ControlDoesTargetStringContainASynonymCaseIndep (idString)) {
+	numHigherObjects = 1;
 
-			if (pServer->NegControlDoesTargetStringContainASynonymCaseIndep (idString)) {
+	//
+	// Add all SmartMessageReporters for file level
+	//
 
-				hasNegControl = true;;
-				bioComponent->SetNegativeControlTrueSM ();
-				bioComponent->SetMessageValue (sampleIsNegCtrl, true);
-			}
+	AddAllSmartMessageReporters (commSM, numHigherObjects);
 
-			else if (pServer->PosControlDoesTargetStringContainASynonymCaseIndep (idString)) {
+	ExcelSummary << CLevel (1) << "\n" << PLevel ();
+	ExcelLinks << CLevel (1) << "\n" << PLevel ();
 
-				hasPosControl = true;
-				bioComponent->SetPositiveControlTrueSM ();
-				bioComponent->SetMessageValue (sampleIsPosCtrl, true);
-			}
-		}
+	XMLExcelLinks << CLevel (1) << "\t</Table>\n" << PLevel ();
+	ReportXMLSmartNoticeObjects (XMLExcelLinks, tempXMLExcelLinks, " ");
+	XMLExcelLinks << CLevel (1) << "\t<Messages>\n" << PLevel ();
 
-		//
-		// End stage 1 for sample
-		//
+	tempXMLOutputSummaryLinks.Flush ();
+	tempXMLOutputSummaryLinks.Close ();
 
-		bioComponent->SetMessageValue (stage1Successful, true);
-		bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 1, true, false);
+	//  The temporary files are copied a block at a time, so that memory does not grow with the number of samples
 
-//		bioComponent->EvaluateSmartMessagesForStage (commSM, numHigherObjects, 1, true, false);
-//		bioComponent->SetTriggersForAllMessages (commSM, numHigherObjects, 1, true, false);
+	if (AppendTemporaryFile (XMLExcelLinks, tempXMLSummaryFullPathWithLinks) < 0) {
 
-		if (sampleOK && (bioComponent->AnalyzeSampleLociSM (text, ExcelText, Message, TRUE) < 0)) {
+		cout << "Could not complete output xml summary; temporary file unavailable..." << endl;
+		return -5;
+	}
 
-			NoticeStr = "";
-			NoticeStr << "COULD NOT ANALYZE LOCI FOR FILE:  " << FileName << "\n";
-			ExcelText << CLevel (1) << NoticeStr << bioComponent->GetError () << "\n";
-			ExcelText << "COULD NOT ANALYZE FSA FILE:  " << FullPathName << ".  Skipping..." << "\n" << PLevel ();
-			NoticeStr = "";
-		}
+	XMLExcelLinks << CLevel (1) << "\t</Messages>\n" << PLevel ();
+	SmartMessagingObject::ReportAllExportSpecifications (XMLExcelLinks);
 
-		//
-		// Question:  do we put the SmartMessage activation before or after relevant code.  The intent was that the code performs
-		// tests, then the SmartMessages perform the logic and then the code cleans up the results.  We probably have to reorganize
-		// somewhat!!!
-		//
+	if (AnalysisTiming::GetOARFile () != NULL) {
 
-		if (sampleOK)
-			bioComponent->TestFractionalFiltersSM ();	// first tests for stutter and adenylation; then removes peaks below fractional filter(s)
+		AnalysisTiming::CloseFiles ();
+		XMLExcelLinks << CLevel (1) << "\t<Timing>\n" << PLevel ();
 
-		bioComponent->SetMessageValue (stage2Successful, true);
-		bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 2, true, false);
+		if (AppendTemporaryFile (XMLExcelLinks, tempTimingFullPath) < 0)
+			cout << "Could not add timing to output xml summary; temporary file unavailable..." << endl;
 
-//		bioComponent->EvaluateSmartMessagesForStage (commSM, numHigherObjects, 2, true, false);
-//		bioComponent->SetTriggersForAllMessages (commSM, numHigherObjects, 2, true, false);
+		XMLExcelLinks << CLevel (1) << "\t</Timing>\n" << PLevel ();
+		remove (tempTimingFullPath.GetData ());
+	}
 
-		if (sampleOK) 
-			bioComponent->MakePreliminaryCallsSM (pGenotypes);
+	AnalysisTiming::CloseFiles ();
 
-		//cout << "Preliminary calls done" << endl;
-		
-//		if (sampleOK)
-//			bioComponent->ValidateAndCorrectCrossChannelAnalysesSM ();
+	// First add directory alerts and then...Merge here to get messages...
+
+	XMLExcelLinks << CLevel (1) << "</OsirisAnalysisReport>" << endLine << PLevel ();
+	SmartMessagingObject::ClearExportSpecifications ();
+	
+	ReportSmartNoticeObjects (ExcelSummary, "", " ", FALSE);
+	ReportSmartNoticeObjects (ExcelLinks, "", " ", TRUE);
+
+	tempOutputSummary.Flush ();
+	tempOutputSummary.Close ();
+	tempOutputSummaryLinks.Flush ();
+	tempOutputSummaryLinks.Close ();
 
-//		if (sampleOK)	// Resolution now occurs after end of stage 3, below.
-//			bioComponent->ResolveAmbiguousInterlocusSignalsSM ();	// at this point, easily resolved ambiguities already removed
+	LadderList.ClearAndDelete ();
+	delete SampleData;
+	delete GridData;
+	delete testPeak;
 
-		if (sampleOK)
-			bioComponent->MeasureAllInterlocusSignalAttributesSM ();	// at this point, easily resolved ambiguities already removed
+	ExcelSummary.SetOutputLevel (1);
+	ExcelLinks.SetOutputLevel (1);
 
-		bioComponent->SetMessageValue (stage3Successful, true);
-		bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 3, true, false);
+	if ((AppendTemporaryFile (ExcelSummary, tempSummaryFullPath) < 0) || (AppendTemporaryFile (ExcelLinks, tempSummaryFullPathWithLinks) < 0)) {
 
-//		bioComponent->EvaluateSmartMessagesForStage (commSM, numHigherObjects, 3, true, false);
-//		bioComponent->SetTriggersForAllMessages (commSM, numHigherObjects, 3, true, false);
+		cout << "Could not complete output summary; temporary file unavailable..." << endl;
+		return -5;
+	}
 
-		// Now, resolve ambiguities based on calculations from end of stage 3:
+	ExcelSummary << "\n";
+	ExcelLinks << "\n";
 
-		if (sampleOK) {
+	// delete temporary files
 
-			bioComponent->ResolveAmbiguousInterlocusSignalsUsingSmartMessageDataSM ();	// Removes ambiguous signals from loci or assigns them and records message
-			bioComponent->FilterSmartNoticesBelowMinBioID ();
-		}
+	remove (tempSummaryFullPath.GetData ());
+	remove (tempSummaryFullPathWithLinks.GetData ());
+	remove (tempXMLSummaryFullPathWithLinks.GetData ());
+	
+	OutputFile.Flush ();
+	OutputFile.Close ();
+	LaneStandardCache::Close ();
 
-		if (sampleOK)
-			bioComponent->SignalQualityTestSM ();
+	if (!foundALadder)
+		return -20;
 
-		bioComponent->SetMessageValue (stage4Successful, true);
-		bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 4, true, false);
+	if (graphicsWriteErrors > 0) {
 
-		// The following records, at the locus level, interlocus peaks to right and left for purposes of reporting
+		//  The reports are complete, but the samples whose graphics files were lost cannot be viewed
 
-		if (sampleOK)
-			bioComponent->RemoveInterlocusSignalsSM ();
+		cout << "Could not write " << graphicsWriteErrors << " graphic file(s)..." << endl;
+		return -25;
+	}
 
-//		bioComponent->EvaluateSmartMessagesForStage (commSM, numHigherObjects, 4, true, false);
-//		bioComponent->SetTriggersForAllMessages (commSM, numHigherObjects, 4, true, false);
+	return 0;
+}
 
-		bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 5, false, true);
-		bioComponent->AddAllSmartMessageReportersForSignals (commSM, numHigherObjects);	// still in wrong place???
 
-		if (sampleOK)
-			bioComponent->SampleQualityTestSM (pGenotypes);
+CoreBioComponent* STRLCAnalysis :: AnalyzeSampleSM (const RGString& fileName, fsaFileData*& data, SampleAnalysisStruct& analysis, SampleWorkerResult& result) {
 
-		if (sampleOK)
-			bioComponent->TestPositiveControlSM (pGenotypes);
+	//  Everything up to and including the sample data text and the graphics (.plt) file; no directory numbering (messages, links and signal id's) is
+	//  reported until ReportSampleSM.  Returns the sample's bioComponent and fsaFileData, which the caller owns
+
+	smUseSampleNamesForControlSampleTestsPreset useSampleNamesForControlSampleTests;
+	smSampleUnanalyzable sampleFailed;
+	smSampleIsPosCtrl sampleIsPosCtrl;
+	smSampleIsNegCtrl sampleIsNegCtrl;
 
-		// Moved this section because it requires setting artifact for signal, which must precede stage 4 and it should only depend on removing extraneous
-		// signals from each locus, which should be done in "SignalQualityTest" above.
-		//if (sampleOK)
-		//	bioComponent->TestPositiveControlSM (pGenotypes);
+	smStage1Successful stage1Successful;
+	smStage2Successful stage2Successful;
+	smStage3Successful stage3Successful;
+	smStage4Successful stage4Successful;
+	smStage5Successful stage5Successful;
 
-		bioComponent->OrganizeNoticeObjectsSM ();  // Have to do this here, before last evaluation and adding smart message reporters!!
+	SampleDataStruct* SampleData = analysis.mSampleData;
+	RGTextOutput& text = SampleData->mText;
+	RGTextOutput& ExcelText = SampleData->mExcelText;
+	OsirisMsg& Message = SampleData->mMsg;
+	ParameterServer* pServer = analysis.mServer;
+	GenotypesForAMarkerSet* pGenotypes = analysis.mGenotypes;
 
-		bioComponent->SetMessageValue (stage5Successful, true);
-		bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 5, false, false);	// These do not include signals...already done
+	SmartMessagingComm commSM;
+	commSM.SMOStack [0] = (SmartMessagingObject*) this;
+	int numHigherObjects = 2;
+	bool sampleOK = true;
+	RGString NoticeStr;
+	RGString idString;
+	RGString FullPathName = analysis.mDirectoryName + "/" + fileName;
+	CoreBioComponent* bioComponent;
+	RGTextOutput* SampleOutput;
+	RGString FitDataName;
 
-//		bioComponent->EvaluateSmartMessagesForStage (commSM, numHigherObjects, 5, false, false);	// These do not include signals...already done
-//		bioComponent->SetTriggersForAllMessages (commSM, numHigherObjects, 5, false, false);
+	result.Reset ();
+	AnalysisTiming::BeginSample (fileName, false);
+	data = new fsaFileData (FullPathName);
+	bioComponent = new STRSampleCoreBioComponent (data->GetName ());
+	bioComponent->SetSampleName (data->GetSampleName ());
+	bioComponent->SetFileName (fileName);
 
-		if (!sampleOK)
-			bioComponent->LocatePositiveControlName (pGenotypes);
+	if (GetMessageValue (useSampleNamesForControlSampleTests))
+		bioComponent->SetControlIdName (bioComponent->GetDataSampleName ());
 
-		bioComponent->AddAllSmartMessageReporters (commSM, numHigherObjects);	// These do not include signals...already done
+	else
+		bioComponent->SetControlIdName (fileName);
 
-		if (bioComponent->SampleIsValid ()) {
+	commSM.SMOStack [1] = (SmartMessagingObject*) bioComponent;
 
-			bioComponent->ReportSampleData(ExcelText);
-			bioComponent->WriteXMLGraphicDataSM (GraphicsDirectory, FileName, data, 4, PlotString);
-		}
+	if (bioComponent->PrepareSampleForAnalysisSM (*data, SampleData) < 0) {
 
-		bioComponent->PrepareLociForOutput ();
-		bioComponent->ReportSampleTableRow (ExcelSummary);
-		bioComponent->ReportSampleTableRowWithLinks (ExcelLinks);
-		bioComponent->ReportXMLSmartSampleTableRowWithLinks (XMLExcelLinks, tempXMLExcelLinks);
+		sampleOK = false;
+		NoticeStr = "";
+		NoticeStr << "COULD NOT INITIALIZE AND PREPARE FOR ANALYSIS, FOR FILE:  " << fileName << "\n";
+		ExcelText << CLevel (1) << NoticeStr << bioComponent->GetError ();
+		ExcelText << "COULD NOT ANALYZE FSA FILE:  " << FullPathName << ".  Skipping..." << "\n" << PLevel ();
 
-		bioComponent->ReportAllSmartNoticeObjects (tempExcelSummary, "", " ", FALSE);
-		bioComponent->ReportAllSmartNoticeObjects (tempExcelLinks, "", " ", TRUE);
-		//cout << "All data reported" << endl;
+		if (AnalysisStatus::WriteConsoleProgress ())
+			cout << NoticeStr.GetData () << endl;
 
-		SamplesProcessed++;
-		Progress = 100.0 * (double)SamplesProcessed / (double)NSampleFiles;
-		cout << "Progress = " << Progress << "%." << endl;
-		delete data;
-		delete bioComponent;
-		data = NULL;
-		bioComponent = NULL;
-		//cout << "Clean up time and on to the next" << endl;
+		NoticeStr = "";
+		bioComponent->SetMessageValue (sampleFailed, true);
 	}
 
-	if (!hasPosControl) {
+	if (sampleOK) {
 
-		SetMessageValue (noPosCtrlFound, true);
+		result.mSampleWasPrepared = true;
+		bioComponent->AppendAllBaseLociToList (result.mBaseLoci);
 	}
 
-	if (!hasNegControl) {
+	if (sampleOK && analysis.mPrintGraphics) {
 
-		SetMessageValue (noNegCtrlFound, true);
+		FitDataName = analysis.mGraphicsDirectory + "/Fit" + fileName + ".txt";
+		SampleOutput = new RGTextOutput (FitDataName, FALSE);
+
+		if (SampleOutput->FileIsValid ())
+			bioComponent->WriteRawDataAndFitData (*SampleOutput, data);
+
+		else if (AnalysisStatus::WriteConsoleProgress ())
+			cout << "Could not write graphics info for file " << FitDataName << ".  Skipping..." << endl;
+
+		delete SampleOutput;
+		SampleOutput = NULL;
 	}
 
-finishOutput:
+	if (sampleOK && (bioComponent->PreliminarySampleAnalysisSM (analysis.mLadderList, SampleData) < 0)) {
 
-	delete SampleDirectory;
+		sampleOK = false;
+		NoticeStr = "";
+		NoticeStr << "COULD NOT PERFORM PRELIMINARY ANALYSIS, FILE:  " << fileName << "\n";
+		ExcelText << CLevel (1) << NoticeStr << bioComponent->GetError () << "\n";
+		ExcelText << "COULD NOT ANALYZE FSA FILE:  " << FullPathName << ".  Skipping..." << "\n" << PLevel ();
+		NoticeStr = "";
+		bioComponent->SetMessageValue (sampleFailed, true);
+	}
 
-	for (i=1; i<=5; i++) {
+	bioComponent->SetNegativeControlFalseSM ();
+	bioComponent->SetPositiveControlFalseSM ();
+	idString = bioComponent->GetControlIdName ();
+//	cout << "ID String = " << (char*) idString.GetData () << " for file name " << (char*) fileName.GetData () << endl;
 
-		EvaluateSmartMessagesForStage (commSM, 1, i);
-		SetTriggersForAllMessages (commSM, 1, i);
+	if (sampleOK && pServer->ControlDoesTargetStringContainASynonymCaseIndep (idString)) {
+
+		if (pServer->NegControlDoesTargetStringContainASynonymCaseIndep (idString)) {
+
+			result.mIsNegativeControl = true;
+			bioComponent->SetNegativeControlTrueSM ();
+			bioComponent->SetMessageValue (sampleIsNegCtrl, true);
+		}
+
+		else if (pServer->PosControlDoesTargetStringContainASynonymCaseIndep (idString)) {
+
+			result.mIsPositiveControl = true;
+			bioComponent->SetPositiveControlTrueSM ();
+			bioComponent->SetMessageValue (sampleIsPosCtrl, true);
+		}
 	}
 
-	numHigherObjects = 1;
+	//
+	// End stage 1 for sample
+	//
+
+	bioComponent->SetMessageValue (stage1Successful, true);
+	bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 1, true, false);
+
+//	bioComponent->EvaluateSmartMessagesForStage (commSM, numHigherObjects, 1, true, false);
+//	bioComponent->SetTriggersForAllMessages (commSM, numHigherObjects, 1, true, false);
+
+	if (sampleOK && (bioComponent->AnalyzeSampleLociSM (text, ExcelText, Message, TRUE) < 0)) {
+
+		NoticeStr = "";
+		NoticeStr << "COULD NOT ANALYZE LOCI FOR FILE:  " << fileName << "\n";
+		ExcelText << CLevel (1) << NoticeStr << bioComponent->GetError () << "\n";
+		ExcelText << "COULD NOT ANALYZE FSA FILE:  " << FullPathName << ".  Skipping..." << "\n" << PLevel ();
+		NoticeStr = "";
+	}
 
 	//
-	// Add all SmartMessageReporters for file level
+	// Question:  do we put the SmartMessage activation before or after relevant code.  The intent was that the code performs
+	// tests, then the SmartMessages perform the logic and then the code cleans up the results.  We probably have to reorganize
+	// somewhat!!!
 	//
 
-	AddAllSmartMessageReporters (commSM, numHigherObjects);
+	if (sampleOK)
+		bioComponent->TestFractionalFiltersSM ();	// first tests for stutter and adenylation; then removes peaks below fractional filter(s)
 
-	ExcelSummary << CLevel (1) << "\n" << PLevel ();
-	ExcelLinks << CLevel (1) << "\n" << PLevel ();
+	bioComponent->SetMessageValue (stage2Successful, true);
+	bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 2, true, false);
 
-	XMLExcelLinks << CLevel (1) << "\t</Table>\n" << PLevel ();
-	ReportXMLSmartNoticeObjects (XMLExcelLinks, tempXMLExcelLinks, " ");
-	XMLExcelLinks << CLevel (1) << "\t<Messages>\n" << PLevel ();
+//	bioComponent->EvaluateSmartMessagesForStage (commSM, numHigherObjects, 2, true, false);
+//	bioComponent->SetTriggersForAllMessages (commSM, numHigherObjects, 2, true, false);
 
-	tempXMLOutputSummaryLinks.Flush ();
-	tempXMLOutputSummaryLinks.Close ();
-	RGFile tempInputXMLSummaryLinks (tempXMLSummaryFullPathWithLinks, "rt");
+	if (sampleOK) 
+		bioComponent->MakePreliminaryCallsSM (pGenotypes);
 
-	if (!tempInputXMLSummaryLinks.isValid ()) {
+	//cout << "Preliminary calls done" << endl;
+	
+//	if (sampleOK)
+//		bioComponent->ValidateAndCorrectCrossChannelAnalysesSM ();
 
-		cout << "Could not complete output xml summary; temporary file unavailable..." << endl;
-		return -5;
+//	if (sampleOK)	// Resolution now occurs after end of stage 3, below.
+//		bioComponent->ResolveAmbiguousInterlocusSignalsSM ();	// at this point, easily resolved ambiguities already removed
+
+	if (sampleOK)
+		bioComponent->MeasureAllInterlocusSignalAttributesSM ();	// at this point, easily resolved ambiguities already removed
+
+	bioComponent->SetMessageValue (stage3Successful, true);
+	bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 3, true, false);
+
+//	bioComponent->EvaluateSmartMessagesForStage (commSM, numHigherObjects, 3, true, false);
+//	bioComponent->SetTriggersForAllMessages (commSM, numHigherObjects, 3, true, false);
+
+	// Now, resolve ambiguities based on calculations from end of stage 3:
+
+	if (sampleOK) {
+
+		bioComponent->ResolveAmbiguousInterlocusSignalsUsingSmartMessageDataSM ();	// Removes ambiguous signals from loci or assigns them and records message
+		bioComponent->FilterSmartNoticesBelowMinBioID ();
 	}
 
-	RGString in3;
-	in3.ReadTextFile (tempInputXMLSummaryLinks);
-	XMLExcelLinks << CLevel (1) << in3;
-	XMLExcelLinks << "\t</Messages>\n" << PLevel ();
-	SmartMessagingObject::ReportAllExportSpecifications (XMLExcelLinks);
+	if (sampleOK)
+		bioComponent->SignalQualityTestSM ();
 
-	// First add directory alerts and then...Merge here to get messages...
+	bioComponent->SetMessageValue (stage4Successful, true);
+	bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 4, true, false);
 
-	XMLExcelLinks << CLevel (1) << "</OsirisAnalysisReport>" << endLine << PLevel ();
-	SmartMessagingObject::ClearExportSpecifications ();
+	// The following records, at the locus level, interlocus peaks to right and left for purposes of reporting
 
-	tempInputXMLSummaryLinks.Close ();
-	
-	ReportSmartNoticeObjects (ExcelSummary, "", " ", FALSE);
-	ReportSmartNoticeObjects (ExcelLinks, "", " ", TRUE);
+	if (sampleOK)
+		bioComponent->RemoveInterlocusSignalsSM ();
 
-	tempOutputSummary.Flush ();
-	tempOutputSummary.Close ();
-	tempOutputSummaryLinks.Flush ();
-	tempOutputSummaryLinks.Close ();
+//	bioComponent->EvaluateSmartMessagesForStage (commSM, numHigherObjects, 4, true, false);
+//	bioComponent->SetTriggersForAllMessages (commSM, numHigherObjects, 4, true, false);
 
-	LadderList.ClearAndDelete ();
-	delete SampleData;
-	delete GridData;
-	delete testPeak;
+	bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 5, false, true);
+	bioComponent->AddAllSmartMessageReportersForSignals (commSM, numHigherObjects);	// still in wrong place???
 
-	RGFile tempInputSummary (tempSummaryFullPath, "rt");
-	RGFile tempInputSummaryLinks (tempSummaryFullPathWithLinks, "rt");
+	if (sampleOK)
+		bioComponent->SampleQualityTestSM (pGenotypes);
 
-	if (!tempInputSummary.isValid ()) {
+	if (sampleOK)
+		bioComponent->TestPositiveControlSM (pGenotypes);
 
-		cout << "Could not complete output summary; temporary file unavailable..." << endl;
-		return -5;
+	// Moved this section because it requires setting artifact for signal, which must precede stage 4 and it should only depend on removing extraneous
+	// signals from each locus, which should be done in "SignalQualityTest" above.
+	//if (sampleOK)
+	//	bioComponent->TestPositiveControlSM (pGenotypes);
+
+	bioComponent->OrganizeNoticeObjectsSM ();  // Have to do this here, before last evaluation and adding smart message reporters!!
+
+	bioComponent->SetMessageValue (stage5Successful, true);
+	bioComponent->EvaluateSmartMessagesAndTriggersForStage (commSM, numHigherObjects, 5, false, false);	// These do not include signals...already done
+
+//	bioComponent->EvaluateSmartMessagesForStage (commSM, numHigherObjects, 5, false, false);	// These do not include signals...already done
+//	bioComponent->SetTriggersForAllMessages (commSM, numHigherObjects, 5, false, false);
+
+	if (!sampleOK)
+		bioComponent->LocatePositiveControlName (pGenotypes);
+
+	bioComponent->AddAllSmartMessageReporters (commSM, numHigherObjects);	// These do not include signals...already done
+
+	if (bioComponent->SampleIsValid ()) {
+
+		bioComponent->ReportSampleData (ExcelText);
+		bioComponent->WriteXMLGraphicDataSM (analysis.mGraphicsDirectory, fileName, data, 4, analysis.mPlotString);
 	}
 
-	if (!tempInputSummaryLinks.isValid ()) {
+	AnalysisTiming::FinishSample ();
+	result.mSampleOK = sampleOK;
+	return bioComponent;
+}
 
-		cout << "Could not complete output summary; temporary file unavailable..." << endl;
-		return -5;
+
+void STRLCAnalysis :: ReportSampleSM (CoreBioComponent* bioComponent, const RGString& fileName, fsaFileData* data, SampleAnalysisStruct& analysis) {
+
+	//  Writes the sample's rows and messages to the directory output files, in the order in which samples are listed
+
+	bioComponent->PrepareLociForOutput ();
+	bioComponent->ReportSampleTableRow (analysis.mExcelSummary);
+	bioComponent->ReportSampleTableRowWithLinks (analysis.mExcelLinks);
+	bioComponent->ReportXMLSmartSampleTableRowWithLinks (analysis.mXMLExcelLinks, analysis.mTempXMLExcelLinks);
+
+	bioComponent->ReportAllSmartNoticeObjects (analysis.mTempExcelSummary, "", " ", FALSE);
+	bioComponent->ReportAllSmartNoticeObjects (analysis.mTempExcelLinks, "", " ", TRUE);
+	AnalysisTiming::WriteSample ();
+	//cout << "All data reported" << endl;
+}
+
+
+void STRLCAnalysis :: ProcessSampleSM (const RGString& fileName, SampleAnalysisStruct& analysis) {
+
+	AnalysisStatus::ReportSampleStarted (fileName, 0);
+
+	fsaFileData* data;
+	SampleWorkerResult result;
+	CoreBioComponent* bioComponent = AnalyzeSampleSM (fileName, data, analysis, result);
+	ReportSampleSM (bioComponent, fileName, data, analysis);
+	RecordSampleResultSM (fileName, result, analysis);
+
+	delete data;
+	delete bioComponent;
+	//cout << "Clean up time and on to the next" << endl;
+}
+
+
+void STRLCAnalysis :: RunSampleWorkerSM (SampleWorkerPool& workers, const RGString& fileName, SampleAnalysisStruct& analysis) {
+
+	//  Starts a worker process for the sample, first collecting the oldest worker(s) if the pool is full
+
+	while (workers.IsFull ())
+		CollectSampleWorkerSM (workers, analysis);
+
+	int status = workers.StartWorker (fileName);
+
+	if (status > 0) {
+
+		//  Reported here, in the parent, once the worker is running:  the worker itself has no status sender
+
+		AnalysisStatus::ReportSampleStarted (fileName, 0);
+		return;
 	}
-	
-	RGString in1;
-	RGString in2;
 
-	in1.ReadTextFile (tempInputSummary);
-	in2.ReadTextFile (tempInputSummaryLinks);
+	if (status < 0) {
 
-	tempInputSummary.Close ();
-	tempInputSummaryLinks.Close ();
+		// No worker available:  finish the samples in progress, to preserve order, and analyze this one here
 
-	// delete temporary files
+		while (!workers.IsEmpty ())
+			CollectSampleWorkerSM (workers, analysis);
 
-	remove (tempSummaryFullPath.GetData ());
-	remove (tempSummaryFullPathWithLinks.GetData ());
-	remove (tempXMLSummaryFullPathWithLinks.GetData ());
+		ProcessSampleSM (fileName, analysis);
+		return;
+	}
 
-	ExcelSummary.SetOutputLevel (1);
-	ExcelLinks.SetOutputLevel (1);
+	//  In the worker process...the worker exits when done and its output is merged by the parent
 
-	ExcelSummary << in1 << "\n";
-	ExcelLinks << in2 << "\n";
-	
-	OutputFile.Flush ();
-	OutputFile.Close ();
+	fsaFileData* data;
+	SampleWorkerResult result;
+	CoreBioComponent* bioComponent;
+
+	try {
+
+		bioComponent = AnalyzeSampleSM (fileName, data, analysis, result);
+		workers.WaitForReportingTurn ();
+		ReportSampleSM (bioComponent, fileName, data, analysis);
+	}
+
+	catch (...) {
+
+		workers.AbandonWorker ();
+	}
+
+	workers.FinishWorker (result);
+}
 
-	if (!foundALadder)
-		return -20;
 
+void STRLCAnalysis :: CollectSampleWorkerSM (SampleWorkerPool& workers, SampleAnalysisStruct& analysis) {
+
+	RGString fileName = workers.GetNextFileName ();
+	SampleWorkerResult result;
+
+	if (workers.CollectNextWorker (result) < 0) {
+
+		// The worker failed, or its result may depend on samples that were in progress when it started
+
+		ProcessSampleSM (fileName, analysis);
+		return;
+	}
+
+	RecordSampleResultSM (fileName, result, analysis);
+}
+
+
+void STRLCAnalysis :: RecordSampleResultSM (const RGString& fileName, const SampleWorkerResult& result, SampleAnalysisStruct& analysis) {
+
+	if (result.mIsPositiveControl)
+		analysis.mHasPosControl = true;
+
+	if (result.mIsNegativeControl)
+		analysis.mHasNegControl = true;
+
+	if (result.mSampleWasPrepared && !analysis.mPopulatedBaseLocusList) {
+
+		analysis.mPopulatedBaseLocusList = true;
+		RGDListIterator it ((RGDList&) result.mBaseLoci);
+		RGPersistent* nextBaseLocus;
+
+		while ((nextBaseLocus = it ()))
+			mBaseLocusList.Append (nextBaseLocus);
+	}
+
+	analysis.mSamplesProcessed++;
+	AnalysisStatus::ReportProgress (analysis.mSamplesProcessed, analysis.mNumberOfSampleFiles);
+	int flags = 0;
+
+	if (result.mSampleOK)
+		flags |= ANALYSISSTATUSSAMPLEOK;
+
+	if (result.mIsPositiveControl)
+		flags |= ANALYSISSTATUSPOSITIVECONTROL;
+
+	if (result.mIsNegativeControl)
+		flags |= ANALYSISSTATUSNEGATIVECONTROL;
+
+	AnalysisStatus::ReportSampleFinished (fileName, flags);
+}
+
+
+int STRLCAnalysis :: AppendTemporaryFile (RGTextOutput& text, const RGString& fileName) {
+
+	FILE* input = fopen (fileName.GetData (), "rt");
+
+	if (input == NULL)
+		return -1;
+
+	char buffer [8193];
+	size_t n;
+
+	while ((n = fread (buffer, 1, 8192, input)) > 0) {
+
+		buffer [n] = '\0';
+		text.Write (1, buffer);
+	}
+
+	fclose (input);
 	return 0;
 }
 
@@ -1797,15 +2075,16 @@ void STRLCAnalysis :: CreateInitializationData (int scope) {
 	int size = SmartMessage::GetSizeOfArrayForScope (scope);
 	int i;
 	SmartMessage* msg;
-	delete[] InitialMatrix;
-	InitialMatrix = new bool [size];
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().AnalysisInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = new bool [size];
 
 	for (i=0; i<size; i++) {
 
 		msg = SmartMessage::GetSmartMessageForScopeAndElement (scope, i);
 
 		if (msg != NULL)
-			InitialMatrix [i] = msg->GetInitialValue ();
+			initialMatrix [i] = msg->GetInitialValue ();
 	}
 }
 
@@ -1813,9 +2092,18 @@ void STRLCAnalysis :: CreateInitializationData (int scope) {
 void STRLCAnalysis :: InitializeMessageMatrix (bool* matrix, int size) {
 
 	int i;
+	bool* initialMatrix = AnalysisContext::GetCurrentMessageBook ().AnalysisInitialMatrix;
 
 	for (i=0; i<size; i++)
-		matrix [i] = InitialMatrix [i];
+		matrix [i] = initialMatrix [i];
+}
+
+
+void STRLCAnalysis :: ClearInitializationMatrix () {
+
+	bool*& initialMatrix = AnalysisContext::GetCurrentMessageBook ().AnalysisInitialMatrix;
+	delete[] initialMatrix;
+	initialMatrix = NULL;
 }
 
 
@@ -1618,7 +1618,7 @@ bool STRBaseSmartMessage :: Report (const bool* msgMatrix) const {
 bool STRBaseSmartMessage :: IsCritical (const bool* msgMatrix) const {
 
 	int level = EvaluateReportLevel (msgMatrix);
-	int criticalLevel = SmartMessage::SeverityTrigger;  // !!!!!!Change this when ready to integrate with OsirisLib
+	int criticalLevel = SmartMessage::GetSeverityTrigger ();  // !!!!!!Change this when ready to integrate with OsirisLib
 
 	if ((level > 0) && (level < criticalLevel))
 		return true;
@@ -2498,6 +2498,7 @@ int STRSmartCountingMessage :: GetIntegerValue (SmartMessagingComm& comm, int nu
 
 	SmartMessagingObject* smo;
 	int i;
+	SmartMessagingObject::TestForDirectoryDataRead (mScope);
 
 	for (i=numHigherObjects-1; i>=0; i--) {
 
@@ -2877,6 +2878,7 @@ int STRSmartPercentMessage :: GetIntegerValue (SmartMessagingComm& comm, int num
 
 	SmartMessagingObject* smo;
 	int i;
+	SmartMessagingObject::TestForDirectoryDataRead (mScope);
 
 	for (i=numHigherObjects-1; i>=0; i--) {
 
@@ -8,1112 +8,927 @@
 
 RGString smILSFailed::sName = "smILSFailed";
 int smILSFailed::sSubject = smILSFailed::LoadType ();
-int smILSFailed::sMessageIndex = 0;
-int smILSFailed::sMessageScope = 0;
+int smILSFailed::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLocusIsAMEL::sName = "smLocusIsAMEL";
 int smLocusIsAMEL::sSubject = smLocusIsAMEL::LoadType ();
-int smLocusIsAMEL::sMessageIndex = 0;
-int smLocusIsAMEL::sMessageScope = 0;
+int smLocusIsAMEL::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSampleIsLadder::sName = "smSampleIsLadder";
 int smSampleIsLadder::sSubject = smSampleIsLadder::LoadType ();
-int smSampleIsLadder::sMessageIndex = 0;
-int smSampleIsLadder::sMessageScope = 0;
+int smSampleIsLadder::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSampleIsPosCtrl::sName = "smSampleIsPosCtrl";
 int smSampleIsPosCtrl::sSubject = smSampleIsPosCtrl::LoadType ();
-int smSampleIsPosCtrl::sMessageIndex = 0;
-int smSampleIsPosCtrl::sMessageScope = 0;
+int smSampleIsPosCtrl::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSampleIsNegCtrl::sName = "smSampleIsNegCtrl";
 int smSampleIsNegCtrl::sSubject = smSampleIsNegCtrl::LoadType ();
-int smSampleIsNegCtrl::sMessageIndex = 0;
-int smSampleIsNegCtrl::sMessageScope = 0;
+int smSampleIsNegCtrl::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smILSSpacingFailed::sName = "smILSSpacingFailed";
 int smILSSpacingFailed::sSubject = smILSSpacingFailed::LoadType ();
-int smILSSpacingFailed::sMessageIndex = 0;
-int smILSSpacingFailed::sMessageScope = 0;
+int smILSSpacingFailed::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNoLadderFile::sName = "smNoLadderFile";
 int smNoLadderFile::sSubject = smNoLadderFile::LoadType ();
-int smNoLadderFile::sMessageIndex = 0;
-int smNoLadderFile::sMessageScope = 0;
+int smNoLadderFile::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLadderTypeUnknown::sName = "smLadderTypeUnknown";
 int smLadderTypeUnknown::sSubject = smLadderTypeUnknown::LoadType ();
-int smLadderTypeUnknown::sMessageIndex = 0;
-int smLadderTypeUnknown::sMessageScope = 0;
+int smLadderTypeUnknown::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smReagentKitUnknown::sName = "smReagentKitUnknown";
 int smReagentKitUnknown::sSubject = smReagentKitUnknown::LoadType ();
-int smReagentKitUnknown::sMessageIndex = 0;
-int smReagentKitUnknown::sMessageScope = 0;
+int smReagentKitUnknown::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smMoreThanOneReagentKit::sName = "smMoreThanOneReagentKit";
 int smMoreThanOneReagentKit::sSubject = smMoreThanOneReagentKit::LoadType ();
-int smMoreThanOneReagentKit::sMessageIndex = 0;
-int smMoreThanOneReagentKit::sMessageScope = 0;
+int smMoreThanOneReagentKit::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smCurveFitFailed::sName = "smCurveFitFailed";
 int smCurveFitFailed::sSubject = smCurveFitFailed::LoadType ();
-int smCurveFitFailed::sMessageIndex = 0;
-int smCurveFitFailed::sMessageScope = 0;
+int smCurveFitFailed::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smCurveFitMarginal::sName = "smCurveFitMarginal";
 int smCurveFitMarginal::sSubject = smCurveFitMarginal::LoadType ();
-int smCurveFitMarginal::sMessageIndex = 0;
-int smCurveFitMarginal::sMessageScope = 0;
+int smCurveFitMarginal::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSpike::sName = "smSpike";
 int smSpike::sSubject = smSpike::LoadType ();
-int smSpike::sMessageIndex = 0;
-int smSpike::sMessageScope = 0;
+int smSpike::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smStutter::sName = "smStutter";
 int smStutter::sSubject = smStutter::LoadType ();
-int smStutter::sMessageIndex = 0;
-int smStutter::sMessageScope = 0;
+int smStutter::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smAdenylation::sName = "smAdenylation";
 int smAdenylation::sSubject = smAdenylation::LoadType ();
-int smAdenylation::sMessageIndex = 0;
-int smAdenylation::sMessageScope = 0;
+int smAdenylation::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBlob::sName = "smBlob";
 int smBlob::sSubject = smBlob::LoadType ();
-int smBlob::sMessageIndex = 0;
-int smBlob::sMessageScope = 0;
+int smBlob::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPullUp::sName = "smPullUp";
 int smPullUp::sSubject = smPullUp::LoadType ();
-int smPullUp::sMessageIndex = 0;
-int smPullUp::sMessageScope = 0;
+int smPullUp::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smILSTooFewPeaks::sName = "smILSTooFewPeaks";
 int smILSTooFewPeaks::sSubject = smILSTooFewPeaks::LoadType ();
-int smILSTooFewPeaks::sMessageIndex = 0;
-int smILSTooFewPeaks::sMessageScope = 0;
+int smILSTooFewPeaks::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPeakOutsideILS::sName = "smPeakOutsideILS";
 int smPeakOutsideILS::sSubject = smPeakOutsideILS::LoadType ();
-int smPeakOutsideILS::sMessageIndex = 0;
-int smPeakOutsideILS::sMessageScope = 0;
+int smPeakOutsideILS::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smMarkerSetNameUnknown::sName = "smMarkerSetNameUnknown";
 int smMarkerSetNameUnknown::sSubject = smMarkerSetNameUnknown::LoadType ();
-int smMarkerSetNameUnknown::sMessageIndex = 0;
-int smMarkerSetNameUnknown::sMessageScope = 0;
+int smMarkerSetNameUnknown::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNamedILSUnknown::sName = "smNamedILSUnknown";
 int smNamedILSUnknown::sSubject = smNamedILSUnknown::LoadType ();
-int smNamedILSUnknown::sMessageIndex = 0;
-int smNamedILSUnknown::sMessageScope = 0;
+int smNamedILSUnknown::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBelowMinRFU::sName = "smBelowMinRFU";
 int smBelowMinRFU::sSubject = smBelowMinRFU::LoadType ();
-int smBelowMinRFU::sMessageIndex = 0;
-int smBelowMinRFU::sMessageScope = 0;
+int smBelowMinRFU::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smUnexpectedILSPeak::sName = "smUnexpectedILSPeak";
 int smUnexpectedILSPeak::sSubject = smUnexpectedILSPeak::LoadType ();
-int smUnexpectedILSPeak::sMessageIndex = 0;
-int smUnexpectedILSPeak::sMessageScope = 0;
+int smUnexpectedILSPeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNoPosCtrlFound::sName = "smNoPosCtrlFound";
 int smNoPosCtrlFound::sSubject = smNoPosCtrlFound::LoadType ();
-int smNoPosCtrlFound::sMessageIndex = 0;
-int smNoPosCtrlFound::sMessageScope = 0;
+int smNoPosCtrlFound::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNoNegCtrlFound::sName = "smNoNegCtrlFound";
 int smNoNegCtrlFound::sSubject = smNoNegCtrlFound::LoadType ();
-int smNoNegCtrlFound::sMessageIndex = 0;
-int smNoNegCtrlFound::sMessageScope = 0;
+int smNoNegCtrlFound::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNamedPosCtrlNotFound::sName = "smNamedPosCtrlNotFound";
 int smNamedPosCtrlNotFound::sSubject = smNamedPosCtrlNotFound::LoadType ();
-int smNamedPosCtrlNotFound::sMessageIndex = 0;
-int smNamedPosCtrlNotFound::sMessageScope = 0;
+int smNamedPosCtrlNotFound::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPeakHeightAboveMax::sName = "smPeakHeightAboveMax";
 int smPeakHeightAboveMax::sSubject = smPeakHeightAboveMax::LoadType ();
-int smPeakHeightAboveMax::sMessageIndex = 0;
-int smPeakHeightAboveMax::sMessageScope = 0;
+int smPeakHeightAboveMax::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smCannotSeparateILSPrimerPeaks::sName = "smCannotSeparateILSPrimerPeaks";
 int smCannotSeparateILSPrimerPeaks::sSubject = smCannotSeparateILSPrimerPeaks::LoadType ();
-int smCannotSeparateILSPrimerPeaks::sMessageIndex = 0;
-int smCannotSeparateILSPrimerPeaks::sMessageScope = 0;
+int smCannotSeparateILSPrimerPeaks::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smILSNeighborFilterTooAggressive::sName = "smILSNeighborFilterTooAggressive";
 int smILSNeighborFilterTooAggressive::sSubject = smILSNeighborFilterTooAggressive::LoadType ();
-int smILSNeighborFilterTooAggressive::sMessageIndex = 0;
-int smILSNeighborFilterTooAggressive::sMessageScope = 0;
+int smILSNeighborFilterTooAggressive::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smILSFractionFilterTooAggressive::sName = "smILSFractionFilterTooAggressive";
 int smILSFractionFilterTooAggressive::sSubject = smILSFractionFilterTooAggressive::LoadType ();
-int smILSFractionFilterTooAggressive::sMessageIndex = 0;
-int smILSFractionFilterTooAggressive::sMessageScope = 0;
+int smILSFractionFilterTooAggressive::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smILSRelativeHeightsInconsistent::sName = "smILSRelativeHeightsInconsistent";
 int smILSRelativeHeightsInconsistent::sSubject = smILSRelativeHeightsInconsistent::LoadType ();
-int smILSRelativeHeightsInconsistent::sMessageIndex = 0;
-int smILSRelativeHeightsInconsistent::sMessageScope = 0;
+int smILSRelativeHeightsInconsistent::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smOsirisBelowMinRFUButRawDataAbove::sName = "smOsirisBelowMinRFUButRawDataAbove";
 int smOsirisBelowMinRFUButRawDataAbove::sSubject = smOsirisBelowMinRFUButRawDataAbove::LoadType ();
-int smOsirisBelowMinRFUButRawDataAbove::sMessageIndex = 0;
-int smOsirisBelowMinRFUButRawDataAbove::sMessageScope = 0;
+int smOsirisBelowMinRFUButRawDataAbove::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smRawDataBelowMinRFUButOsirisAbove::sName = "smRawDataBelowMinRFUButOsirisAbove";
 int smRawDataBelowMinRFUButOsirisAbove::sSubject = smRawDataBelowMinRFUButOsirisAbove::LoadType ();
-int smRawDataBelowMinRFUButOsirisAbove::sMessageIndex = 0;
-int smRawDataBelowMinRFUButOsirisAbove::sMessageScope = 0;
+int smRawDataBelowMinRFUButOsirisAbove::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smOsirisAboveMaxRFUButRawDataBelow::sName = "smOsirisAboveMaxRFUButRawDataBelow";
 int smOsirisAboveMaxRFUButRawDataBelow::sSubject = smOsirisAboveMaxRFUButRawDataBelow::LoadType ();
-int smOsirisAboveMaxRFUButRawDataBelow::sMessageIndex = 0;
-int smOsirisAboveMaxRFUButRawDataBelow::sMessageScope = 0;
+int smOsirisAboveMaxRFUButRawDataBelow::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smRawDataAboveMaxRFUButOsirisBelow::sName = "smRawDataAboveMaxRFUButOsirisBelow";
 int smRawDataAboveMaxRFUButOsirisBelow::sSubject = smRawDataAboveMaxRFUButOsirisBelow::LoadType ();
-int smRawDataAboveMaxRFUButOsirisBelow::sMessageIndex = 0;
-int smRawDataAboveMaxRFUButOsirisBelow::sMessageScope = 0;
+int smRawDataAboveMaxRFUButOsirisBelow::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smStage1Successful::sName = "smStage1Successful";
 int smStage1Successful::sSubject = smStage1Successful::LoadType ();
-int smStage1Successful::sMessageIndex = 0;
-int smStage1Successful::sMessageScope = 0;
+int smStage1Successful::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSignalIsCtrlPeak::sName = "smSignalIsCtrlPeak";
 int smSignalIsCtrlPeak::sSubject = smSignalIsCtrlPeak::LoadType ();
-int smSignalIsCtrlPeak::sMessageIndex = 0;
-int smSignalIsCtrlPeak::sMessageScope = 0;
+int smSignalIsCtrlPeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLocusTooFewPeaks::sName = "smLocusTooFewPeaks";
 int smLocusTooFewPeaks::sSubject = smLocusTooFewPeaks::LoadType ();
-int smLocusTooFewPeaks::sMessageIndex = 0;
-int smLocusTooFewPeaks::sMessageScope = 0;
+int smLocusTooFewPeaks::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smInterlocusLadderPeak::sName = "smInterlocusLadderPeak";
 int smInterlocusLadderPeak::sSubject = smInterlocusLadderPeak::LoadType ();
-int smInterlocusLadderPeak::sMessageIndex = 0;
-int smInterlocusLadderPeak::sMessageScope = 0;
+int smInterlocusLadderPeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smUnexpectedLadderLocusPeak::sName = "smUnexpectedLadderLocusPeak";
 int smUnexpectedLadderLocusPeak::sSubject = smUnexpectedLadderLocusPeak::LoadType ();
-int smUnexpectedLadderLocusPeak::sMessageIndex = 0;
-int smUnexpectedLadderLocusPeak::sMessageScope = 0;
+int smUnexpectedLadderLocusPeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPoorPeakMorphology::sName = "smPoorPeakMorphology";
 int smPoorPeakMorphology::sSubject = smPoorPeakMorphology::LoadType ();
-int smPoorPeakMorphology::sMessageIndex = 0;
-int smPoorPeakMorphology::sMessageScope = 0;
+int smPoorPeakMorphology::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPoorLocusMorphology::sName = "smPoorLocusMorphology";
 int smPoorLocusMorphology::sSubject = smPoorLocusMorphology::LoadType ();
-int smPoorLocusMorphology::sMessageIndex = 0;
-int smPoorLocusMorphology::sMessageScope = 0;
+int smPoorLocusMorphology::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLocusMayHaveUnreportedOLs::sName = "smLocusMayHaveUnreportedOLs";
 int smLocusMayHaveUnreportedOLs::sSubject = smLocusMayHaveUnreportedOLs::LoadType ();
-int smLocusMayHaveUnreportedOLs::sMessageIndex = 0;
-int smLocusMayHaveUnreportedOLs::sMessageScope = 0;
+int smLocusMayHaveUnreportedOLs::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNPeaksForLocusUnavailable::sName = "smNPeaksForLocusUnavailable";
 int smNPeaksForLocusUnavailable::sSubject = smNPeaksForLocusUnavailable::LoadType ();
-int smNPeaksForLocusUnavailable::sMessageIndex = 0;
-int smNPeaksForLocusUnavailable::sMessageScope = 0;
+int smNPeaksForLocusUnavailable::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smRelativeHeightImbalance::sName = "smRelativeHeightImbalance";
 int smRelativeHeightImbalance::sSubject = smRelativeHeightImbalance::LoadType ();
-int smRelativeHeightImbalance::sMessageIndex = 0;
-int smRelativeHeightImbalance::sMessageScope = 0;
+int smRelativeHeightImbalance::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smHeightBelowFractionalFilter::sName = "smHeightBelowFractionalFilter";
 int smHeightBelowFractionalFilter::sSubject = smHeightBelowFractionalFilter::LoadType ();
-int smHeightBelowFractionalFilter::sMessageIndex = 0;
-int smHeightBelowFractionalFilter::sMessageScope = 0;
+int smHeightBelowFractionalFilter::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPartOfExtendedLocusLeft::sName = "smPartOfExtendedLocusLeft";
 int smPartOfExtendedLocusLeft::sSubject = smPartOfExtendedLocusLeft::LoadType ();
-int smPartOfExtendedLocusLeft::sMessageIndex = 0;
-int smPartOfExtendedLocusLeft::sMessageScope = 0;
+int smPartOfExtendedLocusLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPartOfExtendedLocusRight::sName = "smPartOfExtendedLocusRight";
 int smPartOfExtendedLocusRight::sSubject = smPartOfExtendedLocusRight::LoadType ();
-int smPartOfExtendedLocusRight::sMessageIndex = 0;
-int smPartOfExtendedLocusRight::sMessageScope = 0;
+int smPartOfExtendedLocusRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBelowFractionalFilterLeft::sName = "smBelowFractionalFilterLeft";
 int smBelowFractionalFilterLeft::sSubject = smBelowFractionalFilterLeft::LoadType ();
-int smBelowFractionalFilterLeft::sMessageIndex = 0;
-int smBelowFractionalFilterLeft::sMessageScope = 0;
+int smBelowFractionalFilterLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBelowFractionalFilterRight::sName = "smBelowFractionalFilterRight";
 int smBelowFractionalFilterRight::sSubject = smBelowFractionalFilterRight::LoadType ();
-int smBelowFractionalFilterRight::sMessageIndex = 0;
-int smBelowFractionalFilterRight::sMessageScope = 0;
+int smBelowFractionalFilterRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smStage2Successful::sName = "smStage2Successful";
 int smStage2Successful::sSubject = smStage2Successful::LoadType ();
-int smStage2Successful::sMessageIndex = 0;
-int smStage2Successful::sMessageScope = 0;
+int smStage2Successful::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPullUpAtControlPeak::sName = "smPullUpAtControlPeak";
 int smPullUpAtControlPeak::sSubject = smPullUpAtControlPeak::LoadType ();
-int smPullUpAtControlPeak::sMessageIndex = 0;
-int smPullUpAtControlPeak::sMessageScope = 0;
+int smPullUpAtControlPeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smInterlocusPullUpWithPoorFit::sName = "smInterlocusPullUpWithPoorFit";
 int smInterlocusPullUpWithPoorFit::sSubject = smInterlocusPullUpWithPoorFit::LoadType ();
-int smInterlocusPullUpWithPoorFit::sMessageIndex = 0;
-int smInterlocusPullUpWithPoorFit::sMessageScope = 0;
+int smInterlocusPullUpWithPoorFit::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPossibleValidInterlocusLeft::sName = "smPossibleValidInterlocusLeft";
 int smPossibleValidInterlocusLeft::sSubject = smPossibleValidInterlocusLeft::LoadType ();
-int smPossibleValidInterlocusLeft::sMessageIndex = 0;
-int smPossibleValidInterlocusLeft::sMessageScope = 0;
+int smPossibleValidInterlocusLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPossibleValidInterlocusRight::sName = "smPossibleValidInterlocusRight";
 int smPossibleValidInterlocusRight::sSubject = smPossibleValidInterlocusRight::LoadType ();
-int smPossibleValidInterlocusRight::sMessageIndex = 0;
-int smPossibleValidInterlocusRight::sMessageScope = 0;
+int smPossibleValidInterlocusRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smUnassignedInterlocusPeak::sName = "smUnassignedInterlocusPeak";
 int smUnassignedInterlocusPeak::sSubject = smUnassignedInterlocusPeak::LoadType ();
-int smUnassignedInterlocusPeak::sMessageIndex = 0;
-int smUnassignedInterlocusPeak::sMessageScope = 0;
+int smUnassignedInterlocusPeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smAmbiguousInterlocus::sName = "smAmbiguousInterlocus";
 int smAmbiguousInterlocus::sSubject = smAmbiguousInterlocus::LoadType ();
-int smAmbiguousInterlocus::sMessageIndex = 0;
-int smAmbiguousInterlocus::sMessageScope = 0;
+int smAmbiguousInterlocus::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smTooLowInterlocusPeak::sName = "smTooLowInterlocusPeak";
 int smTooLowInterlocusPeak::sSubject = smTooLowInterlocusPeak::LoadType ();
-int smTooLowInterlocusPeak::sMessageIndex = 0;
-int smTooLowInterlocusPeak::sMessageScope = 0;
+int smTooLowInterlocusPeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPossibleInterlocusArtifactLeft::sName = "smPossibleInterlocusArtifactLeft";
 int smPossibleInterlocusArtifactLeft::sSubject = smPossibleInterlocusArtifactLeft::LoadType ();
-int smPossibleInterlocusArtifactLeft::sMessageIndex = 0;
-int smPossibleInterlocusArtifactLeft::sMessageScope = 0;
+int smPossibleInterlocusArtifactLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPossibleInterlocusArtifactRight::sName = "smPossibleInterlocusArtifactRight";
 int smPossibleInterlocusArtifactRight::sSubject = smPossibleInterlocusArtifactRight::LoadType ();
-int smPossibleInterlocusArtifactRight::sMessageIndex = 0;
-int smPossibleInterlocusArtifactRight::sMessageScope = 0;
+int smPossibleInterlocusArtifactRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smFirstAlleleEqFirstLadderPeak::sName = "smFirstAlleleEqFirstLadderPeak";
 int smFirstAlleleEqFirstLadderPeak::sSubject = smFirstAlleleEqFirstLadderPeak::LoadType ();
-int smFirstAlleleEqFirstLadderPeak::sMessageIndex = 0;
-int smFirstAlleleEqFirstLadderPeak::sMessageScope = 0;
+int smFirstAlleleEqFirstLadderPeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSignalOL::sName = "smSignalOL";
 int smSignalOL::sSubject = smSignalOL::LoadType ();
-int smSignalOL::sMessageIndex = 0;
-int smSignalOL::sMessageScope = 0;
+int smSignalOL::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smAMELMisaligned::sName = "smAMELMisaligned";
 int smAMELMisaligned::sSubject = smAMELMisaligned::LoadType ();
-int smAMELMisaligned::sMessageIndex = 0;
-int smAMELMisaligned::sMessageScope = 0;
+int smAMELMisaligned::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smCrater::sName = "smCrater";
 int smCrater::sSubject = smCrater::LoadType ();
-int smCrater::sMessageIndex = 0;
-int smCrater::sMessageScope = 0;
+int smCrater::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smAcceptedOLLeft::sName = "smAcceptedOLLeft";
 int smAcceptedOLLeft::sSubject = smAcceptedOLLeft::LoadType ();
-int smAcceptedOLLeft::sMessageIndex = 0;
-int smAcceptedOLLeft::sMessageScope = 0;
+int smAcceptedOLLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smAcceptedOLRight::sName = "smAcceptedOLRight";
 int smAcceptedOLRight::sSubject = smAcceptedOLRight::LoadType ();
-int smAcceptedOLRight::sMessageIndex = 0;
-int smAcceptedOLRight::sMessageScope = 0;
+int smAcceptedOLRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smStage3Successful::sName = "smStage3Successful";
 int smStage3Successful::sSubject = smStage3Successful::LoadType ();
-int smStage3Successful::sMessageIndex = 0;
-int smStage3Successful::sMessageScope = 0;
+int smStage3Successful::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smValidOLInterlocusLeft::sName = "smValidOLInterlocusLeft";
 int smValidOLInterlocusLeft::sSubject = smValidOLInterlocusLeft::LoadType ();
-int smValidOLInterlocusLeft::sMessageIndex = 0;
-int smValidOLInterlocusLeft::sMessageScope = 0;
+int smValidOLInterlocusLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smValidOLInterlocusRight::sName = "smValidOLInterlocusRight";
 int smValidOLInterlocusRight::sSubject = smValidOLInterlocusRight::LoadType ();
-int smValidOLInterlocusRight::sMessageIndex = 0;
-int smValidOLInterlocusRight::sMessageScope = 0;
+int smValidOLInterlocusRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smAcceptedInterlocusLeft::sName = "smAcceptedInterlocusLeft";
 int smAcceptedInterlocusLeft::sSubject = smAcceptedInterlocusLeft::LoadType ();
-int smAcceptedInterlocusLeft::sMessageIndex = 0;
-int smAcceptedInterlocusLeft::sMessageScope = 0;
+int smAcceptedInterlocusLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smAcceptedInterlocusRight::sName = "smAcceptedInterlocusRight";
 int smAcceptedInterlocusRight::sSubject = smAcceptedInterlocusRight::LoadType ();
-int smAcceptedInterlocusRight::sMessageIndex = 0;
-int smAcceptedInterlocusRight::sMessageScope = 0;
+int smAcceptedInterlocusRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNoXForAMEL::sName = "smNoXForAMEL";
 int smNoXForAMEL::sSubject = smNoXForAMEL::LoadType ();
-int smNoXForAMEL::sMessageIndex = 0;
-int smNoXForAMEL::sMessageScope = 0;
+int smNoXForAMEL::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSignalIsAllele::sName = "smSignalIsAllele";
 int smSignalIsAllele::sSubject = smSignalIsAllele::LoadType ();
-int smSignalIsAllele::sMessageIndex = 0;
-int smSignalIsAllele::sMessageScope = 0;
+int smSignalIsAllele::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPosCtrlLocusMismatch::sName = "smPosCtrlLocusMismatch";
 int smPosCtrlLocusMismatch::sSubject = smPosCtrlLocusMismatch::LoadType ();
-int smPosCtrlLocusMismatch::sMessageIndex = 0;
-int smPosCtrlLocusMismatch::sMessageScope = 0;
+int smPosCtrlLocusMismatch::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNoGenotypeFound::sName = "smNoGenotypeFound";
 int smNoGenotypeFound::sSubject = smNoGenotypeFound::LoadType ();
-int smNoGenotypeFound::sMessageIndex = 0;
-int smNoGenotypeFound::sMessageScope = 0;
+int smNoGenotypeFound::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smThreeOrMoreAlleles::sName = "smThreeOrMoreAlleles";
 int smThreeOrMoreAlleles::sSubject = smThreeOrMoreAlleles::LoadType ();
-int smThreeOrMoreAlleles::sMessageIndex = 0;
-int smThreeOrMoreAlleles::sMessageScope = 0;
+int smThreeOrMoreAlleles::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smTwoOrMoreAlleles::sName = "smTwoOrMoreAlleles";
 int smTwoOrMoreAlleles::sSubject = smTwoOrMoreAlleles::LoadType ();
-int smTwoOrMoreAlleles::sMessageIndex = 0;
-int smTwoOrMoreAlleles::sMessageScope = 0;
+int smTwoOrMoreAlleles::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smHeterozygousImbalance::sName = "smHeterozygousImbalance";
 int smHeterozygousImbalance::sSubject = smHeterozygousImbalance::LoadType ();
-int smHeterozygousImbalance::sMessageIndex = 0;
-int smHeterozygousImbalance::sMessageScope = 0;
+int smHeterozygousImbalance::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smOLAlleles::sName = "smOLAlleles";
 int smOLAlleles::sSubject = smOLAlleles::LoadType ();
-int smOLAlleles::sMessageIndex = 0;
-int smOLAlleles::sMessageScope = 0;
+int smOLAlleles::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smHomozygoteHeightProblem::sName = "smHomozygoteHeightProblem";
 int smHomozygoteHeightProblem::sSubject = smHomozygoteHeightProblem::LoadType ();
-int smHomozygoteHeightProblem::sMessageIndex = 0;
-int smHomozygoteHeightProblem::sMessageScope = 0;
+int smHomozygoteHeightProblem::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPullUpAtAllele::sName = "smPullUpAtAllele";
 int smPullUpAtAllele::sSubject = smPullUpAtAllele::LoadType ();
-int smPullUpAtAllele::sMessageIndex = 0;
-int smPullUpAtAllele::sMessageScope = 0;
+int smPullUpAtAllele::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPosCtrlLocusNotFound::sName = "smPosCtrlLocusNotFound";
 int smPosCtrlLocusNotFound::sSubject = smPosCtrlLocusNotFound::LoadType ();
-int smPosCtrlLocusNotFound::sMessageIndex = 0;
-int smPosCtrlLocusNotFound::sMessageScope = 0;
+int smPosCtrlLocusNotFound::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBPResidualTooLarge::sName = "smBPResidualTooLarge";
 int smBPResidualTooLarge::sSubject = smBPResidualTooLarge::LoadType ();
-int smBPResidualTooLarge::sMessageIndex = 0;
-int smBPResidualTooLarge::sMessageScope = 0;
+int smBPResidualTooLarge::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smExtraLadderAllele::sName = "smExtraLadderAllele";
 int smExtraLadderAllele::sSubject = smExtraLadderAllele::LoadType ();
-int smExtraLadderAllele::sMessageIndex = 0;
-int smExtraLadderAllele::sMessageScope = 0;
+int smExtraLadderAllele::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smCriticalMessagesAtILS::sName = "smCriticalMessagesAtILS";
 int smCriticalMessagesAtILS::sSubject = smCriticalMessagesAtILS::LoadType ();
-int smCriticalMessagesAtILS::sMessageIndex = 0;
-int smCriticalMessagesAtILS::sMessageScope = 0;
+int smCriticalMessagesAtILS::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smAMELHasExtraneousPeaks::sName = "smAMELHasExtraneousPeaks";
 int smAMELHasExtraneousPeaks::sSubject = smAMELHasExtraneousPeaks::LoadType ();
-int smAMELHasExtraneousPeaks::sMessageIndex = 0;
-int smAMELHasExtraneousPeaks::sMessageScope = 0;
+int smAMELHasExtraneousPeaks::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smExtraneousAMELPeak::sName = "smExtraneousAMELPeak";
 int smExtraneousAMELPeak::sSubject = smExtraneousAMELPeak::LoadType ();
-int smExtraneousAMELPeak::sMessageIndex = 0;
-int smExtraneousAMELPeak::sMessageScope = 0;
+int smExtraneousAMELPeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNegCtrlChannelHasNoPrimerPeaks::sName = "smNegCtrlChannelHasNoPrimerPeaks";
 int smNegCtrlChannelHasNoPrimerPeaks::sSubject = smNegCtrlChannelHasNoPrimerPeaks::LoadType ();
-int smNegCtrlChannelHasNoPrimerPeaks::sMessageIndex = 0;
-int smNegCtrlChannelHasNoPrimerPeaks::sMessageScope = 0;
+int smNegCtrlChannelHasNoPrimerPeaks::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smMinimumHeightForPrimerPeaks::sName = "smMinimumHeightForPrimerPeaks";
 int smMinimumHeightForPrimerPeaks::sSubject = smMinimumHeightForPrimerPeaks::LoadType ();
-int smMinimumHeightForPrimerPeaks::sMessageIndex = 0;
-int smMinimumHeightForPrimerPeaks::sMessageScope = 0;
+int smMinimumHeightForPrimerPeaks::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smInterlocusPeaksToRight::sName = "smInterlocusPeaksToRight";
 int smInterlocusPeaksToRight::sSubject = smInterlocusPeaksToRight::LoadType ();
-int smInterlocusPeaksToRight::sMessageIndex = 0;
-int smInterlocusPeaksToRight::sMessageScope = 0;
+int smInterlocusPeaksToRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smInterlocusPeaksToLeft::sName = "smInterlocusPeaksToLeft";
 int smInterlocusPeaksToLeft::sSubject = smInterlocusPeaksToLeft::LoadType ();
-int smInterlocusPeaksToLeft::sMessageIndex = 0;
-int smInterlocusPeaksToLeft::sMessageScope = 0;
+int smInterlocusPeaksToLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLadderFailed::sName = "smLadderFailed";
 int smLadderFailed::sSubject = smLadderFailed::LoadType ();
-int smLadderFailed::sMessageIndex = 0;
-int smLadderFailed::sMessageScope = 0;
+int smLadderFailed::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSampleUnanalyzable::sName = "smSampleUnanalyzable";
 int smSampleUnanalyzable::sSubject = smSampleUnanalyzable::LoadType ();
-int smSampleUnanalyzable::sMessageIndex = 0;
-int smSampleUnanalyzable::sMessageScope = 0;
+int smSampleUnanalyzable::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smCriticalMessagesAtAlleles::sName = "smCriticalMessagesAtAlleles";
 int smCriticalMessagesAtAlleles::sSubject = smCriticalMessagesAtAlleles::LoadType ();
-int smCriticalMessagesAtAlleles::sMessageIndex = 0;
-int smCriticalMessagesAtAlleles::sMessageScope = 0;
+int smCriticalMessagesAtAlleles::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smHeightBelowPullupFractionalFilter::sName = "smHeightBelowPullupFractionalFilter";
 int smHeightBelowPullupFractionalFilter::sSubject = smHeightBelowPullupFractionalFilter::LoadType ();
-int smHeightBelowPullupFractionalFilter::sMessageIndex = 0;
-int smHeightBelowPullupFractionalFilter::sMessageScope = 0;
+int smHeightBelowPullupFractionalFilter::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBelowPullupFractionalFilterLeft::sName = "smBelowPullupFractionalFilterLeft";
 int smBelowPullupFractionalFilterLeft::sSubject = smBelowPullupFractionalFilterLeft::LoadType ();
-int smBelowPullupFractionalFilterLeft::sMessageIndex = 0;
-int smBelowPullupFractionalFilterLeft::sMessageScope = 0;
+int smBelowPullupFractionalFilterLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBelowPullupFractionalFilterRight::sName = "smBelowPullupFractionalFilterRight";
 int smBelowPullupFractionalFilterRight::sSubject = smBelowPullupFractionalFilterRight::LoadType ();
-int smBelowPullupFractionalFilterRight::sMessageIndex = 0;
-int smBelowPullupFractionalFilterRight::sMessageScope = 0;
+int smBelowPullupFractionalFilterRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPossibleExtraLocusAllele::sName = "smPossibleExtraLocusAllele";
 int smPossibleExtraLocusAllele::sSubject = smPossibleExtraLocusAllele::LoadType ();
-int smPossibleExtraLocusAllele::sMessageIndex = 0;
-int smPossibleExtraLocusAllele::sMessageScope = 0;
+int smPossibleExtraLocusAllele::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smUnexpectedPeakInNegativeControl::sName = "smUnexpectedPeakInNegativeControl";
 int smUnexpectedPeakInNegativeControl::sSubject = smUnexpectedPeakInNegativeControl::LoadType ();
-int smUnexpectedPeakInNegativeControl::sMessageIndex = 0;
-int smUnexpectedPeakInNegativeControl::sMessageScope = 0;
+int smUnexpectedPeakInNegativeControl::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLocusContainsPeaksWithExcessiveResiduals::sName = "smLocusContainsPeaksWithExcessiveResiduals";
 int smLocusContainsPeaksWithExcessiveResiduals::sSubject = smLocusContainsPeaksWithExcessiveResiduals::LoadType ();
-int smLocusContainsPeaksWithExcessiveResiduals::sMessageIndex = 0;
-int smLocusContainsPeaksWithExcessiveResiduals::sMessageScope = 0;
+int smLocusContainsPeaksWithExcessiveResiduals::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPrimaryInterchannelLink::sName = "smPrimaryInterchannelLink";
 int smPrimaryInterchannelLink::sSubject = smPrimaryInterchannelLink::LoadType ();
-int smPrimaryInterchannelLink::sMessageIndex = 0;
-int smPrimaryInterchannelLink::sMessageScope = 0;
+int smPrimaryInterchannelLink::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNotInterchannelLink::sName = "smNotInterchannelLink";
 int smNotInterchannelLink::sSubject = smNotInterchannelLink::LoadType ();
-int smNotInterchannelLink::sMessageIndex = 0;
-int smNotInterchannelLink::sMessageScope = 0;
+int smNotInterchannelLink::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smHeightBelowInterlocusMinRFU::sName = "smHeightBelowInterlocusMinRFU";
 int smHeightBelowInterlocusMinRFU::sSubject = smHeightBelowInterlocusMinRFU::LoadType ();
-int smHeightBelowInterlocusMinRFU::sMessageIndex = 0;
-int smHeightBelowInterlocusMinRFU::sMessageScope = 0;
+int smHeightBelowInterlocusMinRFU::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smFSAChannelUnreadable::sName = "smFSAChannelUnreadable";
 int smFSAChannelUnreadable::sSubject = smFSAChannelUnreadable::LoadType ();
-int smFSAChannelUnreadable::sMessageIndex = 0;
-int smFSAChannelUnreadable::sMessageScope = 0;
+int smFSAChannelUnreadable::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smAmbiguousInterlocusCrater::sName = "smAmbiguousInterlocusCrater";
 int smAmbiguousInterlocusCrater::sSubject = smAmbiguousInterlocusCrater::LoadType ();
-int smAmbiguousInterlocusCrater::sMessageIndex = 0;
-int smAmbiguousInterlocusCrater::sMessageScope = 0;
+int smAmbiguousInterlocusCrater::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPossibleAmbiguousInterlocusAssignedToLocus::sName = "smPossibleAmbiguousInterlocusAssignedToLocus";
 int smPossibleAmbiguousInterlocusAssignedToLocus::sSubject = smPossibleAmbiguousInterlocusAssignedToLocus::LoadType ();
-int smPossibleAmbiguousInterlocusAssignedToLocus::sMessageIndex = 0;
-int smPossibleAmbiguousInterlocusAssignedToLocus::sMessageScope = 0;
+int smPossibleAmbiguousInterlocusAssignedToLocus::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smWouldCauseHeterozygousImbalanceLeft::sName = "smWouldCauseHeterozygousImbalanceLeft";
 int smWouldCauseHeterozygousImbalanceLeft::sSubject = smWouldCauseHeterozygousImbalanceLeft::LoadType ();
-int smWouldCauseHeterozygousImbalanceLeft::sMessageIndex = 0;
-int smWouldCauseHeterozygousImbalanceLeft::sMessageScope = 0;
+int smWouldCauseHeterozygousImbalanceLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smWouldCauseHeterozygousImbalanceRight::sName = "smWouldCauseHeterozygousImbalanceRight";
 int smWouldCauseHeterozygousImbalanceRight::sSubject = smWouldCauseHeterozygousImbalanceRight::LoadType ();
-int smWouldCauseHeterozygousImbalanceRight::sMessageIndex = 0;
-int smWouldCauseHeterozygousImbalanceRight::sMessageScope = 0;
+int smWouldCauseHeterozygousImbalanceRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSignalOffGridLeft::sName = "smSignalOffGridLeft";
 int smSignalOffGridLeft::sSubject = smSignalOffGridLeft::LoadType ();
-int smSignalOffGridLeft::sMessageIndex = 0;
-int smSignalOffGridLeft::sMessageScope = 0;
+int smSignalOffGridLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSignalOffGridRight::sName = "smSignalOffGridRight";
 int smSignalOffGridRight::sSubject = smSignalOffGridRight::LoadType ();
-int smSignalOffGridRight::sMessageIndex = 0;
-int smSignalOffGridRight::sMessageScope = 0;
+int smSignalOffGridRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm0UnambiguousPeaksLeft::sName = "sm0UnambiguousPeaksLeft";
 int sm0UnambiguousPeaksLeft::sSubject = sm0UnambiguousPeaksLeft::LoadType ();
-int sm0UnambiguousPeaksLeft::sMessageIndex = 0;
-int sm0UnambiguousPeaksLeft::sMessageScope = 0;
+int sm0UnambiguousPeaksLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm0UnambiguousPeaksRight::sName = "sm0UnambiguousPeaksRight";
 int sm0UnambiguousPeaksRight::sSubject = sm0UnambiguousPeaksRight::LoadType ();
-int sm0UnambiguousPeaksRight::sMessageIndex = 0;
-int sm0UnambiguousPeaksRight::sMessageScope = 0;
+int sm0UnambiguousPeaksRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm1UnambiguousPeakLeft::sName = "sm1UnambiguousPeakLeft";
 int sm1UnambiguousPeakLeft::sSubject = sm1UnambiguousPeakLeft::LoadType ();
-int sm1UnambiguousPeakLeft::sMessageIndex = 0;
-int sm1UnambiguousPeakLeft::sMessageScope = 0;
+int sm1UnambiguousPeakLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm1UnambiguousPeakRight::sName = "sm1UnambiguousPeakRight";
 int sm1UnambiguousPeakRight::sSubject = sm1UnambiguousPeakRight::LoadType ();
-int sm1UnambiguousPeakRight::sMessageIndex = 0;
-int sm1UnambiguousPeakRight::sMessageScope = 0;
+int sm1UnambiguousPeakRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm2PlusUnambiguousPeaksLeft::sName = "sm2PlusUnambiguousPeaksLeft";
 int sm2PlusUnambiguousPeaksLeft::sSubject = sm2PlusUnambiguousPeaksLeft::LoadType ();
-int sm2PlusUnambiguousPeaksLeft::sMessageIndex = 0;
-int sm2PlusUnambiguousPeaksLeft::sMessageScope = 0;
+int sm2PlusUnambiguousPeaksLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm2PlusUnambiguousPeaksRight::sName = "sm2PlusUnambiguousPeaksRight";
 int sm2PlusUnambiguousPeaksRight::sSubject = sm2PlusUnambiguousPeaksRight::LoadType ();
-int sm2PlusUnambiguousPeaksRight::sMessageIndex = 0;
-int sm2PlusUnambiguousPeaksRight::sMessageScope = 0;
+int sm2PlusUnambiguousPeaksRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm0AmbiguousPeaksLeft::sName = "sm0AmbiguousPeaksLeft";
 int sm0AmbiguousPeaksLeft::sSubject = sm0AmbiguousPeaksLeft::LoadType ();
-int sm0AmbiguousPeaksLeft::sMessageIndex = 0;
-int sm0AmbiguousPeaksLeft::sMessageScope = 0;
+int sm0AmbiguousPeaksLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm0AmbiguousPeaksRight::sName = "sm0AmbiguousPeaksRight";
 int sm0AmbiguousPeaksRight::sSubject = sm0AmbiguousPeaksRight::LoadType ();
-int sm0AmbiguousPeaksRight::sMessageIndex = 0;
-int sm0AmbiguousPeaksRight::sMessageScope = 0;
+int sm0AmbiguousPeaksRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm1AmbiguousPeakLeft::sName = "sm1AmbiguousPeakLeft";
 int sm1AmbiguousPeakLeft::sSubject = sm1AmbiguousPeakLeft::LoadType ();
-int sm1AmbiguousPeakLeft::sMessageIndex = 0;
-int sm1AmbiguousPeakLeft::sMessageScope = 0;
+int sm1AmbiguousPeakLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm1AmbiguousPeakRight::sName = "sm1AmbiguousPeakRight";
 int sm1AmbiguousPeakRight::sSubject = sm1AmbiguousPeakRight::LoadType ();
-int sm1AmbiguousPeakRight::sMessageIndex = 0;
-int sm1AmbiguousPeakRight::sMessageScope = 0;
+int sm1AmbiguousPeakRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm2PlusAmbiguousPeaksLeft::sName = "sm2PlusAmbiguousPeaksLeft";
 int sm2PlusAmbiguousPeaksLeft::sSubject = sm2PlusAmbiguousPeaksLeft::LoadType ();
-int sm2PlusAmbiguousPeaksLeft::sMessageIndex = 0;
-int sm2PlusAmbiguousPeaksLeft::sMessageScope = 0;
+int sm2PlusAmbiguousPeaksLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString sm2PlusAmbiguousPeaksRight::sName = "sm2PlusAmbiguousPeaksRight";
 int sm2PlusAmbiguousPeaksRight::sSubject = sm2PlusAmbiguousPeaksRight::LoadType ();
-int sm2PlusAmbiguousPeaksRight::sMessageIndex = 0;
-int sm2PlusAmbiguousPeaksRight::sMessageScope = 0;
+int sm2PlusAmbiguousPeaksRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smCouldBelongToLocusLeft::sName = "smCouldBelongToLocusLeft";
 int smCouldBelongToLocusLeft::sSubject = smCouldBelongToLocusLeft::LoadType ();
-int smCouldBelongToLocusLeft::sMessageIndex = 0;
-int smCouldBelongToLocusLeft::sMessageScope = 0;
+int smCouldBelongToLocusLeft::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smCouldBelongToLocusRight::sName = "smCouldBelongToLocusRight";
 int smCouldBelongToLocusRight::sSubject = smCouldBelongToLocusRight::LoadType ();
-int smCouldBelongToLocusRight::sMessageIndex = 0;
-int smCouldBelongToLocusRight::sMessageScope = 0;
+int smCouldBelongToLocusRight::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smChannelIsNegControl::sName = "smChannelIsNegControl";
 int smChannelIsNegControl::sSubject = smChannelIsNegControl::LoadType ();
-int smChannelIsNegControl::sMessageIndex = 0;
-int smChannelIsNegControl::sMessageScope = 0;
+int smChannelIsNegControl::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLocusIsNegControl::sName = "smLocusIsNegControl";
 int smLocusIsNegControl::sSubject = smLocusIsNegControl::LoadType ();
-int smLocusIsNegControl::sMessageIndex = 0;
-int smLocusIsNegControl::sMessageScope = 0;
+int smLocusIsNegControl::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smChannelIsPosControl::sName = "smChannelIsPosControl";
 int smChannelIsPosControl::sSubject = smChannelIsPosControl::LoadType ();
-int smChannelIsPosControl::sMessageIndex = 0;
-int smChannelIsPosControl::sMessageScope = 0;
+int smChannelIsPosControl::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLocusIsPosControl::sName = "smLocusIsPosControl";
 int smLocusIsPosControl::sSubject = smLocusIsPosControl::LoadType ();
-int smLocusIsPosControl::sMessageIndex = 0;
-int smLocusIsPosControl::sMessageScope = 0;
+int smLocusIsPosControl::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPurePullup::sName = "smPurePullup";
 int smPurePullup::sSubject = smPurePullup::LoadType ();
-int smPurePullup::sMessageIndex = 0;
-int smPurePullup::sMessageScope = 0;
+int smPurePullup::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smChannelPeaksHaveCriticalArtifacts::sName = "smChannelPeaksHaveCriticalArtifacts";
 int smChannelPeaksHaveCriticalArtifacts::sSubject = smChannelPeaksHaveCriticalArtifacts::LoadType ();
-int smChannelPeaksHaveCriticalArtifacts::sMessageIndex = 0;
-int smChannelPeaksHaveCriticalArtifacts::sMessageScope = 0;
+int smChannelPeaksHaveCriticalArtifacts::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPreliminaryLocusHas2OrMoreAlleles::sName = "smPreliminaryLocusHas2OrMoreAlleles";
 int smPreliminaryLocusHas2OrMoreAlleles::sSubject = smPreliminaryLocusHas2OrMoreAlleles::LoadType ();
-int smPreliminaryLocusHas2OrMoreAlleles::sMessageIndex = 0;
-int smPreliminaryLocusHas2OrMoreAlleles::sMessageScope = 0;
+int smPreliminaryLocusHas2OrMoreAlleles::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smCraterSidePeak::sName = "smCraterSidePeak";
 int smCraterSidePeak::sSubject = smCraterSidePeak::LoadType ();
-int smCraterSidePeak::sMessageIndex = 0;
-int smCraterSidePeak::sMessageScope = 0;
+int smCraterSidePeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSignalNotACrater::sName = "smSignalNotACrater";
 int smSignalNotACrater::sSubject = smSignalNotACrater::LoadType ();
-int smSignalNotACrater::sMessageIndex = 0;
-int smSignalNotACrater::sMessageScope = 0;
+int smSignalNotACrater::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSignalNotACraterSidePeak::sName = "smSignalNotACraterSidePeak";
 int smSignalNotACraterSidePeak::sSubject = smSignalNotACraterSidePeak::LoadType ();
-int smSignalNotACraterSidePeak::sMessageIndex = 0;
-int smSignalNotACraterSidePeak::sMessageScope = 0;
+int smSignalNotACraterSidePeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLocusIsHomozygous::sName = "smLocusIsHomozygous";
 int smLocusIsHomozygous::sSubject = smLocusIsHomozygous::LoadType ();
-int smLocusIsHomozygous::sMessageIndex = 0;
-int smLocusIsHomozygous::sMessageScope = 0;
+int smLocusIsHomozygous::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLocusMissingGenotype::sName = "smLocusMissingGenotype";
 int smLocusMissingGenotype::sSubject = smLocusMissingGenotype::LoadType ();
-int smLocusMissingGenotype::sMessageIndex = 0;
-int smLocusMissingGenotype::sMessageScope = 0;
+int smLocusMissingGenotype::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smStage4Successful::sName = "smStage4Successful";
 int smStage4Successful::sSubject = smStage4Successful::LoadType ();
-int smStage4Successful::sMessageIndex = 0;
-int smStage4Successful::sMessageScope = 0;
+int smStage4Successful::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smStage5Successful::sName = "smStage5Successful";
 int smStage5Successful::sSubject = smStage5Successful::LoadType ();
-int smStage5Successful::sMessageIndex = 0;
-int smStage5Successful::sMessageScope = 0;
+int smStage5Successful::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPeakInCoreLadderLocus::sName = "smPeakInCoreLadderLocus";
 int smPeakInCoreLadderLocus::sSubject = smPeakInCoreLadderLocus::LoadType ();
-int smPeakInCoreLadderLocus::sMessageIndex = 0;
-int smPeakInCoreLadderLocus::sMessageScope = 0;
+int smPeakInCoreLadderLocus::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPeakAboveOverloadLimit::sName = "smPeakAboveOverloadLimit";
 int smPeakAboveOverloadLimit::sSubject = smPeakAboveOverloadLimit::LoadType ();
-int smPeakAboveOverloadLimit::sMessageIndex = 0;
-int smPeakAboveOverloadLimit::sMessageScope = 0;
+int smPeakAboveOverloadLimit::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smRestrictedPriorityPeak::sName = "smRestrictedPriorityPeak";
 int smRestrictedPriorityPeak::sSubject = smRestrictedPriorityPeak::LoadType ();
-int smRestrictedPriorityPeak::sMessageIndex = 0;
-int smRestrictedPriorityPeak::sMessageScope = 0;
+int smRestrictedPriorityPeak::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smChannelIsILS::sName = "smChannelIsILS";
 int smChannelIsILS::sSubject = smChannelIsILS::LoadType ();
-int smChannelIsILS::sMessageIndex = 0;
-int smChannelIsILS::sMessageScope = 0;
+int smChannelIsILS::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smILSSpacingIsMarginal::sName = "smILSSpacingIsMarginal";
 int smILSSpacingIsMarginal::sSubject = smILSSpacingIsMarginal::LoadType ();
-int smILSSpacingIsMarginal::sMessageIndex = 0;
-int smILSSpacingIsMarginal::sMessageScope = 0;
+int smILSSpacingIsMarginal::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPoorPeakMorphologyOrResolution::sName = "smPoorPeakMorphologyOrResolution";
 int smPoorPeakMorphologyOrResolution::sSubject = smPoorPeakMorphologyOrResolution::LoadType ();
-int smPoorPeakMorphologyOrResolution::sMessageIndex = 0;
-int smPoorPeakMorphologyOrResolution::sMessageScope = 0;
+int smPoorPeakMorphologyOrResolution::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPeakToRightOfILS::sName = "smPeakToRightOfILS";
 int smPeakToRightOfILS::sSubject = smPeakToRightOfILS::LoadType ();
-int smPeakToRightOfILS::sMessageIndex = 0;
-int smPeakToRightOfILS::sMessageScope = 0;
+int smPeakToRightOfILS::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPreliminaryLocusHasNoAlleles::sName = "smPreliminaryLocusHasNoAlleles";
 int smPreliminaryLocusHasNoAlleles::sSubject = smPreliminaryLocusHasNoAlleles::LoadType ();
-int smPreliminaryLocusHasNoAlleles::sMessageIndex = 0;
-int smPreliminaryLocusHasNoAlleles::sMessageScope = 0;
+int smPreliminaryLocusHasNoAlleles::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLocusHasPeaksBetweenDetectionAndAnalysisThresholds::sName = "smLocusHasPeaksBetweenDetectionAndAnalysisThresholds";
 int smLocusHasPeaksBetweenDetectionAndAnalysisThresholds::sSubject = smLocusHasPeaksBetweenDetectionAndAnalysisThresholds::LoadType ();
-int smLocusHasPeaksBetweenDetectionAndAnalysisThresholds::sMessageIndex = 0;
-int smLocusHasPeaksBetweenDetectionAndAnalysisThresholds::sMessageScope = 0;
+int smLocusHasPeaksBetweenDetectionAndAnalysisThresholds::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smUnexpectedNoOfGridPeaks::sName = "smUnexpectedNoOfGridPeaks";
 int smUnexpectedNoOfGridPeaks::sSubject = smUnexpectedNoOfGridPeaks::LoadType ();
-int smUnexpectedNoOfGridPeaks::sMessageIndex = 0;
-int smUnexpectedNoOfGridPeaks::sMessageScope = 0;
+int smUnexpectedNoOfGridPeaks::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smMoreThanThreeAlleles::sName = "smMoreThanThreeAlleles";
 int smMoreThanThreeAlleles::sSubject = smMoreThanThreeAlleles::LoadType ();
-int smMoreThanThreeAlleles::sMessageIndex = 0;
-int smMoreThanThreeAlleles::sMessageScope = 0;
+int smMoreThanThreeAlleles::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smDefaultsAreOverridden::sName = "smDefaultsAreOverridden";
 int smDefaultsAreOverridden::sSubject = smDefaultsAreOverridden::LoadType ();
-int smDefaultsAreOverridden::sMessageIndex = 0;
-int smDefaultsAreOverridden::sMessageScope = 0;
+int smDefaultsAreOverridden::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLaserOffScalePullupOrCraterNotPrimary::sName = "smLaserOffScalePullupOrCraterNotPrimary";
 int smLaserOffScalePullupOrCraterNotPrimary::sSubject = smLaserOffScalePullupOrCraterNotPrimary::LoadType ();
-int smLaserOffScalePullupOrCraterNotPrimary::sMessageIndex = 0;
-int smLaserOffScalePullupOrCraterNotPrimary::sMessageScope = 0;
+int smLaserOffScalePullupOrCraterNotPrimary::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLaserOffScalePrimary::sName = "smLaserOffScalePrimary";
 int smLaserOffScalePrimary::sSubject = smLaserOffScalePrimary::LoadType ();
-int smLaserOffScalePrimary::sMessageIndex = 0;
-int smLaserOffScalePrimary::sMessageScope = 0;
+int smLaserOffScalePrimary::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLaserOffScaleNoInterchannelLink::sName = "smLaserOffScaleNoInterchannelLink";
 int smLaserOffScaleNoInterchannelLink::sSubject = smLaserOffScaleNoInterchannelLink::LoadType ();
-int smLaserOffScaleNoInterchannelLink::sMessageIndex = 0;
-int smLaserOffScaleNoInterchannelLink::sMessageScope = 0;
+int smLaserOffScaleNoInterchannelLink::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smAssociatedLadderIsCritical::sName = "smAssociatedLadderIsCritical";
 int smAssociatedLadderIsCritical::sSubject = smAssociatedLadderIsCritical::LoadType ();
-int smAssociatedLadderIsCritical::sMessageIndex = 0;
-int smAssociatedLadderIsCritical::sMessageScope = 0;
+int smAssociatedLadderIsCritical::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smAssociatedLadderLocusIsCritical::sName = "smAssociatedLadderLocusIsCritical";
 int smAssociatedLadderLocusIsCritical::sSubject = smAssociatedLadderLocusIsCritical::LoadType ();
-int smAssociatedLadderLocusIsCritical::sMessageIndex = 0;
-int smAssociatedLadderLocusIsCritical::sMessageScope = 0;
+int smAssociatedLadderLocusIsCritical::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smChannelHasRaisedBaseline::sName = "smChannelHasRaisedBaseline";
 int smChannelHasRaisedBaseline::sSubject = smChannelHasRaisedBaseline::LoadType ();
-int smChannelHasRaisedBaseline::sMessageIndex = 0;
-int smChannelHasRaisedBaseline::sMessageScope = 0;
+int smChannelHasRaisedBaseline::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smChannelHasExcessiveNoiseAboveAnalysisThreshold::sName = "smChannelHasExcessiveNoiseAboveAnalysisThreshold";
 int smChannelHasExcessiveNoiseAboveAnalysisThreshold::sSubject = smChannelHasExcessiveNoiseAboveAnalysisThreshold::LoadType ();
-int smChannelHasExcessiveNoiseAboveAnalysisThreshold::sMessageIndex = 0;
-int smChannelHasExcessiveNoiseAboveAnalysisThreshold::sMessageScope = 0;
+int smChannelHasExcessiveNoiseAboveAnalysisThreshold::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smChannelHasExcessiveNoiseAboveDetectionThreshold::sName = "smChannelHasExcessiveNoiseAboveDetectionThreshold";
 int smChannelHasExcessiveNoiseAboveDetectionThreshold::sSubject = smChannelHasExcessiveNoiseAboveDetectionThreshold::LoadType ();
-int smChannelHasExcessiveNoiseAboveDetectionThreshold::sMessageIndex = 0;
-int smChannelHasExcessiveNoiseAboveDetectionThreshold::sMessageScope = 0;
+int smChannelHasExcessiveNoiseAboveDetectionThreshold::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSampleChannelRaisedBaselineThreshold::sName = "smSampleChannelRaisedBaselineThreshold";
 int smSampleChannelRaisedBaselineThreshold::sSubject = smSampleChannelRaisedBaselineThreshold::LoadType ();
-int smSampleChannelRaisedBaselineThreshold::sMessageIndex = 0;
-int smSampleChannelRaisedBaselineThreshold::sMessageScope = 0;
+int smSampleChannelRaisedBaselineThreshold::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSampleILSChannelRaisedBaselineThreshold::sName = "smSampleILSChannelRaisedBaselineThreshold";
 int smSampleILSChannelRaisedBaselineThreshold::sSubject = smSampleILSChannelRaisedBaselineThreshold::LoadType ();
-int smSampleILSChannelRaisedBaselineThreshold::sMessageIndex = 0;
-int smSampleILSChannelRaisedBaselineThreshold::sMessageScope = 0;
+int smSampleILSChannelRaisedBaselineThreshold::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smILSPeakMayBeIncorrect::sName = "smILSPeakMayBeIncorrect";
 int smILSPeakMayBeIncorrect::sSubject = smILSPeakMayBeIncorrect::LoadType ();
-int smILSPeakMayBeIncorrect::sMessageIndex = 0;
-int smILSPeakMayBeIncorrect::sMessageScope = 0;
+int smILSPeakMayBeIncorrect::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smTestForColorCorrectionMatrixPreset::sName = "smTestForColorCorrectionMatrixPreset";
 int smTestForColorCorrectionMatrixPreset::sSubject = smTestForColorCorrectionMatrixPreset::LoadType ();
-int smTestForColorCorrectionMatrixPreset::sMessageIndex = 0;
-int smTestForColorCorrectionMatrixPreset::sMessageScope = 0;
+int smTestForColorCorrectionMatrixPreset::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smColorCorrectionMatrixExpectedButNotFound::sName = "smColorCorrectionMatrixExpectedButNotFound";
 int smColorCorrectionMatrixExpectedButNotFound::sSubject = smColorCorrectionMatrixExpectedButNotFound::LoadType ();
-int smColorCorrectionMatrixExpectedButNotFound::sMessageIndex = 0;
-int smColorCorrectionMatrixExpectedButNotFound::sMessageScope = 0;
+int smColorCorrectionMatrixExpectedButNotFound::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smColorCorrectionMatrixWrongSize::sName = "smColorCorrectionMatrixWrongSize";
 int smColorCorrectionMatrixWrongSize::sSubject = smColorCorrectionMatrixWrongSize::LoadType ();
-int smColorCorrectionMatrixWrongSize::sMessageIndex = 0;
-int smColorCorrectionMatrixWrongSize::sMessageScope = 0;
+int smColorCorrectionMatrixWrongSize::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing::sName = "smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing";
 int smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing::sSubject = smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing::LoadType ();
-int smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing::sMessageIndex = 0;
-int smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing::sMessageScope = 0;
+int smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smMinimumNumberOfPrimerPeaksForNegativeControlChannel::sName = "smMinimumNumberOfPrimerPeaksForNegativeControlChannel";
 int smMinimumNumberOfPrimerPeaksForNegativeControlChannel::sSubject = smMinimumNumberOfPrimerPeaksForNegativeControlChannel::LoadType ();
-int smMinimumNumberOfPrimerPeaksForNegativeControlChannel::sMessageIndex = 0;
-int smMinimumNumberOfPrimerPeaksForNegativeControlChannel::sMessageScope = 0;
+int smMinimumNumberOfPrimerPeaksForNegativeControlChannel::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smUseSampleNamesForControlSampleTestsPreset::sName = "smUseSampleNamesForControlSampleTestsPreset";
 int smUseSampleNamesForControlSampleTestsPreset::sSubject = smUseSampleNamesForControlSampleTestsPreset::LoadType ();
-int smUseSampleNamesForControlSampleTestsPreset::sMessageIndex = 0;
-int smUseSampleNamesForControlSampleTestsPreset::sMessageScope = 0;
+int smUseSampleNamesForControlSampleTestsPreset::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNoYForAMEL::sName = "smNoYForAMEL";
 int smNoYForAMEL::sSubject = smNoYForAMEL::LoadType ();
-int smNoYForAMEL::sMessageIndex = 0;
-int smNoYForAMEL::sMessageScope = 0;
+int smNoYForAMEL::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLocusIsYLinked::sName = "smLocusIsYLinked";
 int smLocusIsYLinked::sSubject = smLocusIsYLinked::LoadType ();
-int smLocusIsYLinked::sMessageIndex = 0;
-int smLocusIsYLinked::sMessageScope = 0;
+int smLocusIsYLinked::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNumberAllelesBelowExpectation::sName = "smNumberAllelesBelowExpectation";
 int smNumberAllelesBelowExpectation::sSubject = smNumberAllelesBelowExpectation::LoadType ();
-int smNumberAllelesBelowExpectation::sMessageIndex = 0;
-int smNumberAllelesBelowExpectation::sMessageScope = 0;
+int smNumberAllelesBelowExpectation::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBaselineRelativeStutter::sName = "smBaselineRelativeStutter";
 int smBaselineRelativeStutter::sSubject = smBaselineRelativeStutter::LoadType ();
-int smBaselineRelativeStutter::sMessageIndex = 0;
-int smBaselineRelativeStutter::sMessageScope = 0;
+int smBaselineRelativeStutter::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBaselineRelativeAdenylation::sName = "smBaselineRelativeAdenylation";
 int smBaselineRelativeAdenylation::sSubject = smBaselineRelativeAdenylation::LoadType ();
-int smBaselineRelativeAdenylation::sMessageIndex = 0;
-int smBaselineRelativeAdenylation::sMessageScope = 0;
+int smBaselineRelativeAdenylation::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBaselineRelativeFractionalFilter::sName = "smBaselineRelativeFractionalFilter";
 int smBaselineRelativeFractionalFilter::sSubject = smBaselineRelativeFractionalFilter::LoadType ();
-int smBaselineRelativeFractionalFilter::sMessageIndex = 0;
-int smBaselineRelativeFractionalFilter::sMessageScope = 0;
+int smBaselineRelativeFractionalFilter::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBaselineRelativePullupFractionalFilter::sName = "smBaselineRelativePullupFractionalFilter";
 int smBaselineRelativePullupFractionalFilter::sSubject = smBaselineRelativePullupFractionalFilter::LoadType ();
-int smBaselineRelativePullupFractionalFilter::sMessageIndex = 0;
-int smBaselineRelativePullupFractionalFilter::sMessageScope = 0;
+int smBaselineRelativePullupFractionalFilter::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBaselineRelativeBelowMinRFU::sName = "smBaselineRelativeBelowMinRFU";
 int smBaselineRelativeBelowMinRFU::sSubject = smBaselineRelativeBelowMinRFU::LoadType ();
-int smBaselineRelativeBelowMinRFU::sMessageIndex = 0;
-int smBaselineRelativeBelowMinRFU::sMessageScope = 0;
+int smBaselineRelativeBelowMinRFU::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBaselineRelativeBelowMinInterlocusRFU::sName = "smBaselineRelativeBelowMinInterlocusRFU";
 int smBaselineRelativeBelowMinInterlocusRFU::sSubject = smBaselineRelativeBelowMinInterlocusRFU::LoadType ();
-int smBaselineRelativeBelowMinInterlocusRFU::sMessageIndex = 0;
-int smBaselineRelativeBelowMinInterlocusRFU::sMessageScope = 0;
+int smBaselineRelativeBelowMinInterlocusRFU::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smTestRelativeBaselinePreset::sName = "smTestRelativeBaselinePreset";
 int smTestRelativeBaselinePreset::sSubject = smTestRelativeBaselinePreset::LoadType ();
-int smTestRelativeBaselinePreset::sMessageIndex = 0;
-int smTestRelativeBaselinePreset::sMessageScope = 0;
+int smTestRelativeBaselinePreset::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smIgnoreNegativeRelativeBaselinePreset::sName = "smIgnoreNegativeRelativeBaselinePreset";
 int smIgnoreNegativeRelativeBaselinePreset::sSubject = smIgnoreNegativeRelativeBaselinePreset::LoadType ();
-int smIgnoreNegativeRelativeBaselinePreset::sMessageIndex = 0;
-int smIgnoreNegativeRelativeBaselinePreset::sMessageScope = 0;
+int smIgnoreNegativeRelativeBaselinePreset::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smNormalizeRawDataRelativeToBaselinePreset::sName = "smNormalizeRawDataRelativeToBaselinePreset";
 int smNormalizeRawDataRelativeToBaselinePreset::sSubject = smNormalizeRawDataRelativeToBaselinePreset::LoadType ();
-int smNormalizeRawDataRelativeToBaselinePreset::sMessageIndex = 0;
-int smNormalizeRawDataRelativeToBaselinePreset::sMessageScope = 0;
+int smNormalizeRawDataRelativeToBaselinePreset::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smPercentOfStandardNoiseThreshold::sName = "smPercentOfStandardNoiseThreshold";
 int smPercentOfStandardNoiseThreshold::sSubject = smPercentOfStandardNoiseThreshold::LoadType ();
-int smPercentOfStandardNoiseThreshold::sMessageIndex = 0;
-int smPercentOfStandardNoiseThreshold::sMessageScope = 0;
+int smPercentOfStandardNoiseThreshold::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smLadderFitThreshold::sName = "smLadderFitThreshold";
 int smLadderFitThreshold::sSubject = smLadderFitThreshold::LoadType ();
-int smLadderFitThreshold::sMessageIndex = 0;
-int smLadderFitThreshold::sMessageScope = 0;
+int smLadderFitThreshold::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smSampleToLadderFitBelowExpectations::sName = "smSampleToLadderFitBelowExpectations";
 int smSampleToLadderFitBelowExpectations::sSubject = smSampleToLadderFitBelowExpectations::LoadType ();
-int smSampleToLadderFitBelowExpectations::sMessageIndex = 0;
-int smSampleToLadderFitBelowExpectations::sMessageScope = 0;
+int smSampleToLadderFitBelowExpectations::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smEnableRawDataFilterForNormalizationPreset::sName = "smEnableRawDataFilterForNormalizationPreset";
 int smEnableRawDataFilterForNormalizationPreset::sSubject = smEnableRawDataFilterForNormalizationPreset::LoadType ();
-int smEnableRawDataFilterForNormalizationPreset::sMessageIndex = 0;
-int smEnableRawDataFilterForNormalizationPreset::sMessageScope = 0;
+int smEnableRawDataFilterForNormalizationPreset::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smBaselineEstimationThreshold::sName = "smBaselineEstimationThreshold";
 int smBaselineEstimationThreshold::sSubject = smBaselineEstimationThreshold::LoadType ();
-int smBaselineEstimationThreshold::sMessageIndex = 0;
-int smBaselineEstimationThreshold::sMessageScope = 0;
+int smBaselineEstimationThreshold::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 RGString smFilterWindowWidthForBaselineEstimation::sName = "smFilterWindowWidthForBaselineEstimation";
 int smFilterWindowWidthForBaselineEstimation::sSubject = smFilterWindowWidthForBaselineEstimation::LoadType ();
-int smFilterWindowWidthForBaselineEstimation::sMessageIndex = 0;
-int smFilterWindowWidthForBaselineEstimation::sMessageScope = 0;
+int smFilterWindowWidthForBaselineEstimation::sNoticeType = SmartNotice::GetNextNoticeType ();
 
 
 PERSISTENT_DEFINITION (smILSFailed, 2051, "smILSFailed")
@@ -1329,20 +1144,19 @@ int smILSFailed :: GetSubject () const {
 
 void smILSFailed :: SetIndexAndScope (int index, int scope) const {
 
-	smILSFailed::sMessageIndex = index;
-	smILSFailed::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smILSFailed::sNoticeType, index, scope);
 }
 
 
 int smILSFailed :: GetMessageIndex () const {
 
-	return smILSFailed :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smILSFailed::sNoticeType);
 }
 
 
 int smILSFailed :: GetScope () const {
 
-	return smILSFailed :: sMessageScope;
+	return SmartNotice::GetScopeForType (smILSFailed::sNoticeType);
 }
 
 
@@ -1389,20 +1203,19 @@ int smLocusIsAMEL :: GetSubject () const {
 
 void smLocusIsAMEL :: SetIndexAndScope (int index, int scope) const {
 
-	smLocusIsAMEL::sMessageIndex = index;
-	smLocusIsAMEL::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLocusIsAMEL::sNoticeType, index, scope);
 }
 
 
 int smLocusIsAMEL :: GetMessageIndex () const {
 
-	return smLocusIsAMEL :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLocusIsAMEL::sNoticeType);
 }
 
 
 int smLocusIsAMEL :: GetScope () const {
 
-	return smLocusIsAMEL :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLocusIsAMEL::sNoticeType);
 }
 
 
@@ -1449,20 +1262,19 @@ int smSampleIsLadder :: GetSubject () const {
 
 void smSampleIsLadder :: SetIndexAndScope (int index, int scope) const {
 
-	smSampleIsLadder::sMessageIndex = index;
-	smSampleIsLadder::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSampleIsLadder::sNoticeType, index, scope);
 }
 
 
 int smSampleIsLadder :: GetMessageIndex () const {
 
-	return smSampleIsLadder :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSampleIsLadder::sNoticeType);
 }
 
 
 int smSampleIsLadder :: GetScope () const {
 
-	return smSampleIsLadder :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSampleIsLadder::sNoticeType);
 }
 
 
@@ -1509,20 +1321,19 @@ int smSampleIsPosCtrl :: GetSubject () const {
 
 void smSampleIsPosCtrl :: SetIndexAndScope (int index, int scope) const {
 
-	smSampleIsPosCtrl::sMessageIndex = index;
-	smSampleIsPosCtrl::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSampleIsPosCtrl::sNoticeType, index, scope);
 }
 
 
 int smSampleIsPosCtrl :: GetMessageIndex () const {
 
-	return smSampleIsPosCtrl :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSampleIsPosCtrl::sNoticeType);
 }
 
 
 int smSampleIsPosCtrl :: GetScope () const {
 
-	return smSampleIsPosCtrl :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSampleIsPosCtrl::sNoticeType);
 }
 
 
@@ -1569,20 +1380,19 @@ int smSampleIsNegCtrl :: GetSubject () const {
 
 void smSampleIsNegCtrl :: SetIndexAndScope (int index, int scope) const {
 
-	smSampleIsNegCtrl::sMessageIndex = index;
-	smSampleIsNegCtrl::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSampleIsNegCtrl::sNoticeType, index, scope);
 }
 
 
 int smSampleIsNegCtrl :: GetMessageIndex () const {
 
-	return smSampleIsNegCtrl :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSampleIsNegCtrl::sNoticeType);
 }
 
 
 int smSampleIsNegCtrl :: GetScope () const {
 
-	return smSampleIsNegCtrl :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSampleIsNegCtrl::sNoticeType);
 }
 
 
@@ -1629,20 +1439,19 @@ int smILSSpacingFailed :: GetSubject () const {
 
 void smILSSpacingFailed :: SetIndexAndScope (int index, int scope) const {
 
-	smILSSpacingFailed::sMessageIndex = index;
-	smILSSpacingFailed::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smILSSpacingFailed::sNoticeType, index, scope);
 }
 
 
 int smILSSpacingFailed :: GetMessageIndex () const {
 
-	return smILSSpacingFailed :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smILSSpacingFailed::sNoticeType);
 }
 
 
 int smILSSpacingFailed :: GetScope () const {
 
-	return smILSSpacingFailed :: sMessageScope;
+	return SmartNotice::GetScopeForType (smILSSpacingFailed::sNoticeType);
 }
 
 
@@ -1689,20 +1498,19 @@ int smNoLadderFile :: GetSubject () const {
 
 void smNoLadderFile :: SetIndexAndScope (int index, int scope) const {
 
-	smNoLadderFile::sMessageIndex = index;
-	smNoLadderFile::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNoLadderFile::sNoticeType, index, scope);
 }
 
 
 int smNoLadderFile :: GetMessageIndex () const {
 
-	return smNoLadderFile :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNoLadderFile::sNoticeType);
 }
 
 
 int smNoLadderFile :: GetScope () const {
 
-	return smNoLadderFile :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNoLadderFile::sNoticeType);
 }
 
 
@@ -1749,20 +1557,19 @@ int smLadderTypeUnknown :: GetSubject () const {
 
 void smLadderTypeUnknown :: SetIndexAndScope (int index, int scope) const {
 
-	smLadderTypeUnknown::sMessageIndex = index;
-	smLadderTypeUnknown::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLadderTypeUnknown::sNoticeType, index, scope);
 }
 
 
 int smLadderTypeUnknown :: GetMessageIndex () const {
 
-	return smLadderTypeUnknown :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLadderTypeUnknown::sNoticeType);
 }
 
 
 int smLadderTypeUnknown :: GetScope () const {
 
-	return smLadderTypeUnknown :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLadderTypeUnknown::sNoticeType);
 }
 
 
@@ -1809,20 +1616,19 @@ int smReagentKitUnknown :: GetSubject () const {
 
 void smReagentKitUnknown :: SetIndexAndScope (int index, int scope) const {
 
-	smReagentKitUnknown::sMessageIndex = index;
-	smReagentKitUnknown::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smReagentKitUnknown::sNoticeType, index, scope);
 }
 
 
 int smReagentKitUnknown :: GetMessageIndex () const {
 
-	return smReagentKitUnknown :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smReagentKitUnknown::sNoticeType);
 }
 
 
 int smReagentKitUnknown :: GetScope () const {
 
-	return smReagentKitUnknown :: sMessageScope;
+	return SmartNotice::GetScopeForType (smReagentKitUnknown::sNoticeType);
 }
 
 
@@ -1869,20 +1675,19 @@ int smMoreThanOneReagentKit :: GetSubject () const {
 
 void smMoreThanOneReagentKit :: SetIndexAndScope (int index, int scope) const {
 
-	smMoreThanOneReagentKit::sMessageIndex = index;
-	smMoreThanOneReagentKit::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smMoreThanOneReagentKit::sNoticeType, index, scope);
 }
 
 
 int smMoreThanOneReagentKit :: GetMessageIndex () const {
 
-	return smMoreThanOneReagentKit :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smMoreThanOneReagentKit::sNoticeType);
 }
 
 
 int smMoreThanOneReagentKit :: GetScope () const {
 
-	return smMoreThanOneReagentKit :: sMessageScope;
+	return SmartNotice::GetScopeForType (smMoreThanOneReagentKit::sNoticeType);
 }
 
 
@@ -1929,20 +1734,19 @@ int smCurveFitFailed :: GetSubject () const {
 
 void smCurveFitFailed :: SetIndexAndScope (int index, int scope) const {
 
-	smCurveFitFailed::sMessageIndex = index;
-	smCurveFitFailed::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smCurveFitFailed::sNoticeType, index, scope);
 }
 
 
 int smCurveFitFailed :: GetMessageIndex () const {
 
-	return smCurveFitFailed :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smCurveFitFailed::sNoticeType);
 }
 
 
 int smCurveFitFailed :: GetScope () const {
 
-	return smCurveFitFailed :: sMessageScope;
+	return SmartNotice::GetScopeForType (smCurveFitFailed::sNoticeType);
 }
 
 
@@ -1989,20 +1793,19 @@ int smCurveFitMarginal :: GetSubject () const {
 
 void smCurveFitMarginal :: SetIndexAndScope (int index, int scope) const {
 
-	smCurveFitMarginal::sMessageIndex = index;
-	smCurveFitMarginal::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smCurveFitMarginal::sNoticeType, index, scope);
 }
 
 
 int smCurveFitMarginal :: GetMessageIndex () const {
 
-	return smCurveFitMarginal :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smCurveFitMarginal::sNoticeType);
 }
 
 
 int smCurveFitMarginal :: GetScope () const {
 
-	return smCurveFitMarginal :: sMessageScope;
+	return SmartNotice::GetScopeForType (smCurveFitMarginal::sNoticeType);
 }
 
 
@@ -2049,20 +1852,19 @@ int smSpike :: GetSubject () const {
 
 void smSpike :: SetIndexAndScope (int index, int scope) const {
 
-	smSpike::sMessageIndex = index;
-	smSpike::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSpike::sNoticeType, index, scope);
 }
 
 
 int smSpike :: GetMessageIndex () const {
 
-	return smSpike :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSpike::sNoticeType);
 }
 
 
 int smSpike :: GetScope () const {
 
-	return smSpike :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSpike::sNoticeType);
 }
 
 
@@ -2109,20 +1911,19 @@ int smStutter :: GetSubject () const {
 
 void smStutter :: SetIndexAndScope (int index, int scope) const {
 
-	smStutter::sMessageIndex = index;
-	smStutter::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smStutter::sNoticeType, index, scope);
 }
 
 
 int smStutter :: GetMessageIndex () const {
 
-	return smStutter :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smStutter::sNoticeType);
 }
 
 
 int smStutter :: GetScope () const {
 
-	return smStutter :: sMessageScope;
+	return SmartNotice::GetScopeForType (smStutter::sNoticeType);
 }
 
 
@@ -2169,20 +1970,19 @@ int smAdenylation :: GetSubject () const {
 
 void smAdenylation :: SetIndexAndScope (int index, int scope) const {
 
-	smAdenylation::sMessageIndex = index;
-	smAdenylation::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smAdenylation::sNoticeType, index, scope);
 }
 
 
 int smAdenylation :: GetMessageIndex () const {
 
-	return smAdenylation :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smAdenylation::sNoticeType);
 }
 
 
 int smAdenylation :: GetScope () const {
 
-	return smAdenylation :: sMessageScope;
+	return SmartNotice::GetScopeForType (smAdenylation::sNoticeType);
 }
 
 
@@ -2229,20 +2029,19 @@ int smBlob :: GetSubject () const {
 
 void smBlob :: SetIndexAndScope (int index, int scope) const {
 
-	smBlob::sMessageIndex = index;
-	smBlob::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBlob::sNoticeType, index, scope);
 }
 
 
 int smBlob :: GetMessageIndex () const {
 
-	return smBlob :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBlob::sNoticeType);
 }
 
 
 int smBlob :: GetScope () const {
 
-	return smBlob :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBlob::sNoticeType);
 }
 
 
@@ -2289,20 +2088,19 @@ int smPullUp :: GetSubject () const {
 
 void smPullUp :: SetIndexAndScope (int index, int scope) const {
 
-	smPullUp::sMessageIndex = index;
-	smPullUp::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPullUp::sNoticeType, index, scope);
 }
 
 
 int smPullUp :: GetMessageIndex () const {
 
-	return smPullUp :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPullUp::sNoticeType);
 }
 
 
 int smPullUp :: GetScope () const {
 
-	return smPullUp :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPullUp::sNoticeType);
 }
 
 
@@ -2349,20 +2147,19 @@ int smILSTooFewPeaks :: GetSubject () const {
 
 void smILSTooFewPeaks :: SetIndexAndScope (int index, int scope) const {
 
-	smILSTooFewPeaks::sMessageIndex = index;
-	smILSTooFewPeaks::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smILSTooFewPeaks::sNoticeType, index, scope);
 }
 
 
 int smILSTooFewPeaks :: GetMessageIndex () const {
 
-	return smILSTooFewPeaks :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smILSTooFewPeaks::sNoticeType);
 }
 
 
 int smILSTooFewPeaks :: GetScope () const {
 
-	return smILSTooFewPeaks :: sMessageScope;
+	return SmartNotice::GetScopeForType (smILSTooFewPeaks::sNoticeType);
 }
 
 
@@ -2409,20 +2206,19 @@ int smPeakOutsideILS :: GetSubject () const {
 
 void smPeakOutsideILS :: SetIndexAndScope (int index, int scope) const {
 
-	smPeakOutsideILS::sMessageIndex = index;
-	smPeakOutsideILS::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPeakOutsideILS::sNoticeType, index, scope);
 }
 
 
 int smPeakOutsideILS :: GetMessageIndex () const {
 
-	return smPeakOutsideILS :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPeakOutsideILS::sNoticeType);
 }
 
 
 int smPeakOutsideILS :: GetScope () const {
 
-	return smPeakOutsideILS :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPeakOutsideILS::sNoticeType);
 }
 
 
@@ -2469,20 +2265,19 @@ int smMarkerSetNameUnknown :: GetSubject () const {
 
 void smMarkerSetNameUnknown :: SetIndexAndScope (int index, int scope) const {
 
-	smMarkerSetNameUnknown::sMessageIndex = index;
-	smMarkerSetNameUnknown::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smMarkerSetNameUnknown::sNoticeType, index, scope);
 }
 
 
 int smMarkerSetNameUnknown :: GetMessageIndex () const {
 
-	return smMarkerSetNameUnknown :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smMarkerSetNameUnknown::sNoticeType);
 }
 
 
 int smMarkerSetNameUnknown :: GetScope () const {
 
-	return smMarkerSetNameUnknown :: sMessageScope;
+	return SmartNotice::GetScopeForType (smMarkerSetNameUnknown::sNoticeType);
 }
 
 
@@ -2529,20 +2324,19 @@ int smNamedILSUnknown :: GetSubject () const {
 
 void smNamedILSUnknown :: SetIndexAndScope (int index, int scope) const {
 
-	smNamedILSUnknown::sMessageIndex = index;
-	smNamedILSUnknown::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNamedILSUnknown::sNoticeType, index, scope);
 }
 
 
 int smNamedILSUnknown :: GetMessageIndex () const {
 
-	return smNamedILSUnknown :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNamedILSUnknown::sNoticeType);
 }
 
 
 int smNamedILSUnknown :: GetScope () const {
 
-	return smNamedILSUnknown :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNamedILSUnknown::sNoticeType);
 }
 
 
@@ -2589,20 +2383,19 @@ int smBelowMinRFU :: GetSubject () const {
 
 void smBelowMinRFU :: SetIndexAndScope (int index, int scope) const {
 
-	smBelowMinRFU::sMessageIndex = index;
-	smBelowMinRFU::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBelowMinRFU::sNoticeType, index, scope);
 }
 
 
 int smBelowMinRFU :: GetMessageIndex () const {
 
-	return smBelowMinRFU :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBelowMinRFU::sNoticeType);
 }
 
 
 int smBelowMinRFU :: GetScope () const {
 
-	return smBelowMinRFU :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBelowMinRFU::sNoticeType);
 }
 
 
@@ -2649,20 +2442,19 @@ int smUnexpectedILSPeak :: GetSubject () const {
 
 void smUnexpectedILSPeak :: SetIndexAndScope (int index, int scope) const {
 
-	smUnexpectedILSPeak::sMessageIndex = index;
-	smUnexpectedILSPeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smUnexpectedILSPeak::sNoticeType, index, scope);
 }
 
 
 int smUnexpectedILSPeak :: GetMessageIndex () const {
 
-	return smUnexpectedILSPeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smUnexpectedILSPeak::sNoticeType);
 }
 
 
 int smUnexpectedILSPeak :: GetScope () const {
 
-	return smUnexpectedILSPeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smUnexpectedILSPeak::sNoticeType);
 }
 
 
@@ -2709,20 +2501,19 @@ int smNoPosCtrlFound :: GetSubject () const {
 
 void smNoPosCtrlFound :: SetIndexAndScope (int index, int scope) const {
 
-	smNoPosCtrlFound::sMessageIndex = index;
-	smNoPosCtrlFound::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNoPosCtrlFound::sNoticeType, index, scope);
 }
 
 
 int smNoPosCtrlFound :: GetMessageIndex () const {
 
-	return smNoPosCtrlFound :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNoPosCtrlFound::sNoticeType);
 }
 
 
 int smNoPosCtrlFound :: GetScope () const {
 
-	return smNoPosCtrlFound :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNoPosCtrlFound::sNoticeType);
 }
 
 
@@ -2769,20 +2560,19 @@ int smNoNegCtrlFound :: GetSubject () const {
 
 void smNoNegCtrlFound :: SetIndexAndScope (int index, int scope) const {
 
-	smNoNegCtrlFound::sMessageIndex = index;
-	smNoNegCtrlFound::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNoNegCtrlFound::sNoticeType, index, scope);
 }
 
 
 int smNoNegCtrlFound :: GetMessageIndex () const {
 
-	return smNoNegCtrlFound :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNoNegCtrlFound::sNoticeType);
 }
 
 
 int smNoNegCtrlFound :: GetScope () const {
 
-	return smNoNegCtrlFound :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNoNegCtrlFound::sNoticeType);
 }
 
 
@@ -2829,20 +2619,19 @@ int smNamedPosCtrlNotFound :: GetSubject () const {
 
 void smNamedPosCtrlNotFound :: SetIndexAndScope (int index, int scope) const {
 
-	smNamedPosCtrlNotFound::sMessageIndex = index;
-	smNamedPosCtrlNotFound::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNamedPosCtrlNotFound::sNoticeType, index, scope);
 }
 
 
 int smNamedPosCtrlNotFound :: GetMessageIndex () const {
 
-	return smNamedPosCtrlNotFound :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNamedPosCtrlNotFound::sNoticeType);
 }
 
 
 int smNamedPosCtrlNotFound :: GetScope () const {
 
-	return smNamedPosCtrlNotFound :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNamedPosCtrlNotFound::sNoticeType);
 }
 
 
@@ -2889,20 +2678,19 @@ int smPeakHeightAboveMax :: GetSubject () const {
 
 void smPeakHeightAboveMax :: SetIndexAndScope (int index, int scope) const {
 
-	smPeakHeightAboveMax::sMessageIndex = index;
-	smPeakHeightAboveMax::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPeakHeightAboveMax::sNoticeType, index, scope);
 }
 
 
 int smPeakHeightAboveMax :: GetMessageIndex () const {
 
-	return smPeakHeightAboveMax :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPeakHeightAboveMax::sNoticeType);
 }
 
 
 int smPeakHeightAboveMax :: GetScope () const {
 
-	return smPeakHeightAboveMax :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPeakHeightAboveMax::sNoticeType);
 }
 
 
@@ -2949,20 +2737,19 @@ int smCannotSeparateILSPrimerPeaks :: GetSubject () const {
 
 void smCannotSeparateILSPrimerPeaks :: SetIndexAndScope (int index, int scope) const {
 
-	smCannotSeparateILSPrimerPeaks::sMessageIndex = index;
-	smCannotSeparateILSPrimerPeaks::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smCannotSeparateILSPrimerPeaks::sNoticeType, index, scope);
 }
 
 
 int smCannotSeparateILSPrimerPeaks :: GetMessageIndex () const {
 
-	return smCannotSeparateILSPrimerPeaks :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smCannotSeparateILSPrimerPeaks::sNoticeType);
 }
 
 
 int smCannotSeparateILSPrimerPeaks :: GetScope () const {
 
-	return smCannotSeparateILSPrimerPeaks :: sMessageScope;
+	return SmartNotice::GetScopeForType (smCannotSeparateILSPrimerPeaks::sNoticeType);
 }
 
 
@@ -3009,20 +2796,19 @@ int smILSNeighborFilterTooAggressive :: GetSubject () const {
 
 void smILSNeighborFilterTooAggressive :: SetIndexAndScope (int index, int scope) const {
 
-	smILSNeighborFilterTooAggressive::sMessageIndex = index;
-	smILSNeighborFilterTooAggressive::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smILSNeighborFilterTooAggressive::sNoticeType, index, scope);
 }
 
 
 int smILSNeighborFilterTooAggressive :: GetMessageIndex () const {
 
-	return smILSNeighborFilterTooAggressive :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smILSNeighborFilterTooAggressive::sNoticeType);
 }
 
 
 int smILSNeighborFilterTooAggressive :: GetScope () const {
 
-	return smILSNeighborFilterTooAggressive :: sMessageScope;
+	return SmartNotice::GetScopeForType (smILSNeighborFilterTooAggressive::sNoticeType);
 }
 
 
@@ -3069,20 +2855,19 @@ int smILSFractionFilterTooAggressive :: GetSubject () const {
 
 void smILSFractionFilterTooAggressive :: SetIndexAndScope (int index, int scope) const {
 
-	smILSFractionFilterTooAggressive::sMessageIndex = index;
-	smILSFractionFilterTooAggressive::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smILSFractionFilterTooAggressive::sNoticeType, index, scope);
 }
 
 
 int smILSFractionFilterTooAggressive :: GetMessageIndex () const {
 
-	return smILSFractionFilterTooAggressive :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smILSFractionFilterTooAggressive::sNoticeType);
 }
 
 
 int smILSFractionFilterTooAggressive :: GetScope () const {
 
-	return smILSFractionFilterTooAggressive :: sMessageScope;
+	return SmartNotice::GetScopeForType (smILSFractionFilterTooAggressive::sNoticeType);
 }
 
 
@@ -3129,20 +2914,19 @@ int smILSRelativeHeightsInconsistent :: GetSubject () const {
 
 void smILSRelativeHeightsInconsistent :: SetIndexAndScope (int index, int scope) const {
 
-	smILSRelativeHeightsInconsistent::sMessageIndex = index;
-	smILSRelativeHeightsInconsistent::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smILSRelativeHeightsInconsistent::sNoticeType, index, scope);
 }
 
 
 int smILSRelativeHeightsInconsistent :: GetMessageIndex () const {
 
-	return smILSRelativeHeightsInconsistent :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smILSRelativeHeightsInconsistent::sNoticeType);
 }
 
 
 int smILSRelativeHeightsInconsistent :: GetScope () const {
 
-	return smILSRelativeHeightsInconsistent :: sMessageScope;
+	return SmartNotice::GetScopeForType (smILSRelativeHeightsInconsistent::sNoticeType);
 }
 
 
@@ -3189,20 +2973,19 @@ int smOsirisBelowMinRFUButRawDataAbove :: GetSubject () const {
 
 void smOsirisBelowMinRFUButRawDataAbove :: SetIndexAndScope (int index, int scope) const {
 
-	smOsirisBelowMinRFUButRawDataAbove::sMessageIndex = index;
-	smOsirisBelowMinRFUButRawDataAbove::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smOsirisBelowMinRFUButRawDataAbove::sNoticeType, index, scope);
 }
 
 
 int smOsirisBelowMinRFUButRawDataAbove :: GetMessageIndex () const {
 
-	return smOsirisBelowMinRFUButRawDataAbove :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smOsirisBelowMinRFUButRawDataAbove::sNoticeType);
 }
 
 
 int smOsirisBelowMinRFUButRawDataAbove :: GetScope () const {
 
-	return smOsirisBelowMinRFUButRawDataAbove :: sMessageScope;
+	return SmartNotice::GetScopeForType (smOsirisBelowMinRFUButRawDataAbove::sNoticeType);
 }
 
 
@@ -3249,20 +3032,19 @@ int smRawDataBelowMinRFUButOsirisAbove :: GetSubject () const {
 
 void smRawDataBelowMinRFUButOsirisAbove :: SetIndexAndScope (int index, int scope) const {
 
-	smRawDataBelowMinRFUButOsirisAbove::sMessageIndex = index;
-	smRawDataBelowMinRFUButOsirisAbove::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smRawDataBelowMinRFUButOsirisAbove::sNoticeType, index, scope);
 }
 
 
 int smRawDataBelowMinRFUButOsirisAbove :: GetMessageIndex () const {
 
-	return smRawDataBelowMinRFUButOsirisAbove :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smRawDataBelowMinRFUButOsirisAbove::sNoticeType);
 }
 
 
 int smRawDataBelowMinRFUButOsirisAbove :: GetScope () const {
 
-	return smRawDataBelowMinRFUButOsirisAbove :: sMessageScope;
+	return SmartNotice::GetScopeForType (smRawDataBelowMinRFUButOsirisAbove::sNoticeType);
 }
 
 
@@ -3309,20 +3091,19 @@ int smOsirisAboveMaxRFUButRawDataBelow :: GetSubject () const {
 
 void smOsirisAboveMaxRFUButRawDataBelow :: SetIndexAndScope (int index, int scope) const {
 
-	smOsirisAboveMaxRFUButRawDataBelow::sMessageIndex = index;
-	smOsirisAboveMaxRFUButRawDataBelow::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smOsirisAboveMaxRFUButRawDataBelow::sNoticeType, index, scope);
 }
 
 
 int smOsirisAboveMaxRFUButRawDataBelow :: GetMessageIndex () const {
 
-	return smOsirisAboveMaxRFUButRawDataBelow :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smOsirisAboveMaxRFUButRawDataBelow::sNoticeType);
 }
 
 
 int smOsirisAboveMaxRFUButRawDataBelow :: GetScope () const {
 
-	return smOsirisAboveMaxRFUButRawDataBelow :: sMessageScope;
+	return SmartNotice::GetScopeForType (smOsirisAboveMaxRFUButRawDataBelow::sNoticeType);
 }
 
 
@@ -3369,20 +3150,19 @@ int smRawDataAboveMaxRFUButOsirisBelow :: GetSubject () const {
 
 void smRawDataAboveMaxRFUButOsirisBelow :: SetIndexAndScope (int index, int scope) const {
 
-	smRawDataAboveMaxRFUButOsirisBelow::sMessageIndex = index;
-	smRawDataAboveMaxRFUButOsirisBelow::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smRawDataAboveMaxRFUButOsirisBelow::sNoticeType, index, scope);
 }
 
 
 int smRawDataAboveMaxRFUButOsirisBelow :: GetMessageIndex () const {
 
-	return smRawDataAboveMaxRFUButOsirisBelow :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smRawDataAboveMaxRFUButOsirisBelow::sNoticeType);
 }
 
 
 int smRawDataAboveMaxRFUButOsirisBelow :: GetScope () const {
 
-	return smRawDataAboveMaxRFUButOsirisBelow :: sMessageScope;
+	return SmartNotice::GetScopeForType (smRawDataAboveMaxRFUButOsirisBelow::sNoticeType);
 }
 
 
@@ -3429,20 +3209,19 @@ int smStage1Successful :: GetSubject () const {
 
 void smStage1Successful :: SetIndexAndScope (int index, int scope) const {
 
-	smStage1Successful::sMessageIndex = index;
-	smStage1Successful::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smStage1Successful::sNoticeType, index, scope);
 }
 
 
 int smStage1Successful :: GetMessageIndex () const {
 
-	return smStage1Successful :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smStage1Successful::sNoticeType);
 }
 
 
 int smStage1Successful :: GetScope () const {
 
-	return smStage1Successful :: sMessageScope;
+	return SmartNotice::GetScopeForType (smStage1Successful::sNoticeType);
 }
 
 
@@ -3489,20 +3268,19 @@ int smSignalIsCtrlPeak :: GetSubject () const {
 
 void smSignalIsCtrlPeak :: SetIndexAndScope (int index, int scope) const {
 
-	smSignalIsCtrlPeak::sMessageIndex = index;
-	smSignalIsCtrlPeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSignalIsCtrlPeak::sNoticeType, index, scope);
 }
 
 
 int smSignalIsCtrlPeak :: GetMessageIndex () const {
 
-	return smSignalIsCtrlPeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSignalIsCtrlPeak::sNoticeType);
 }
 
 
 int smSignalIsCtrlPeak :: GetScope () const {
 
-	return smSignalIsCtrlPeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSignalIsCtrlPeak::sNoticeType);
 }
 
 
@@ -3549,20 +3327,19 @@ int smLocusTooFewPeaks :: GetSubject () const {
 
 void smLocusTooFewPeaks :: SetIndexAndScope (int index, int scope) const {
 
-	smLocusTooFewPeaks::sMessageIndex = index;
-	smLocusTooFewPeaks::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLocusTooFewPeaks::sNoticeType, index, scope);
 }
 
 
 int smLocusTooFewPeaks :: GetMessageIndex () const {
 
-	return smLocusTooFewPeaks :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLocusTooFewPeaks::sNoticeType);
 }
 
 
 int smLocusTooFewPeaks :: GetScope () const {
 
-	return smLocusTooFewPeaks :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLocusTooFewPeaks::sNoticeType);
 }
 
 
@@ -3609,20 +3386,19 @@ int smInterlocusLadderPeak :: GetSubject () const {
 
 void smInterlocusLadderPeak :: SetIndexAndScope (int index, int scope) const {
 
-	smInterlocusLadderPeak::sMessageIndex = index;
-	smInterlocusLadderPeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smInterlocusLadderPeak::sNoticeType, index, scope);
 }
 
 
 int smInterlocusLadderPeak :: GetMessageIndex () const {
 
-	return smInterlocusLadderPeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smInterlocusLadderPeak::sNoticeType);
 }
 
 
 int smInterlocusLadderPeak :: GetScope () const {
 
-	return smInterlocusLadderPeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smInterlocusLadderPeak::sNoticeType);
 }
 
 
@@ -3669,20 +3445,19 @@ int smUnexpectedLadderLocusPeak :: GetSubject () const {
 
 void smUnexpectedLadderLocusPeak :: SetIndexAndScope (int index, int scope) const {
 
-	smUnexpectedLadderLocusPeak::sMessageIndex = index;
-	smUnexpectedLadderLocusPeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smUnexpectedLadderLocusPeak::sNoticeType, index, scope);
 }
 
 
 int smUnexpectedLadderLocusPeak :: GetMessageIndex () const {
 
-	return smUnexpectedLadderLocusPeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smUnexpectedLadderLocusPeak::sNoticeType);
 }
 
 
 int smUnexpectedLadderLocusPeak :: GetScope () const {
 
-	return smUnexpectedLadderLocusPeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smUnexpectedLadderLocusPeak::sNoticeType);
 }
 
 
@@ -3729,20 +3504,19 @@ int smPoorPeakMorphology :: GetSubject () const {
 
 void smPoorPeakMorphology :: SetIndexAndScope (int index, int scope) const {
 
-	smPoorPeakMorphology::sMessageIndex = index;
-	smPoorPeakMorphology::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPoorPeakMorphology::sNoticeType, index, scope);
 }
 
 
 int smPoorPeakMorphology :: GetMessageIndex () const {
 
-	return smPoorPeakMorphology :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPoorPeakMorphology::sNoticeType);
 }
 
 
 int smPoorPeakMorphology :: GetScope () const {
 
-	return smPoorPeakMorphology :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPoorPeakMorphology::sNoticeType);
 }
 
 
@@ -3789,20 +3563,19 @@ int smPoorLocusMorphology :: GetSubject () const {
 
 void smPoorLocusMorphology :: SetIndexAndScope (int index, int scope) const {
 
-	smPoorLocusMorphology::sMessageIndex = index;
-	smPoorLocusMorphology::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPoorLocusMorphology::sNoticeType, index, scope);
 }
 
 
 int smPoorLocusMorphology :: GetMessageIndex () const {
 
-	return smPoorLocusMorphology :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPoorLocusMorphology::sNoticeType);
 }
 
 
 int smPoorLocusMorphology :: GetScope () const {
 
-	return smPoorLocusMorphology :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPoorLocusMorphology::sNoticeType);
 }
 
 
@@ -3849,20 +3622,19 @@ int smLocusMayHaveUnreportedOLs :: GetSubject () const {
 
 void smLocusMayHaveUnreportedOLs :: SetIndexAndScope (int index, int scope) const {
 
-	smLocusMayHaveUnreportedOLs::sMessageIndex = index;
-	smLocusMayHaveUnreportedOLs::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLocusMayHaveUnreportedOLs::sNoticeType, index, scope);
 }
 
 
 int smLocusMayHaveUnreportedOLs :: GetMessageIndex () const {
 
-	return smLocusMayHaveUnreportedOLs :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLocusMayHaveUnreportedOLs::sNoticeType);
 }
 
 
 int smLocusMayHaveUnreportedOLs :: GetScope () const {
 
-	return smLocusMayHaveUnreportedOLs :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLocusMayHaveUnreportedOLs::sNoticeType);
 }
 
 
@@ -3909,20 +3681,19 @@ int smNPeaksForLocusUnavailable :: GetSubject () const {
 
 void smNPeaksForLocusUnavailable :: SetIndexAndScope (int index, int scope) const {
 
-	smNPeaksForLocusUnavailable::sMessageIndex = index;
-	smNPeaksForLocusUnavailable::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNPeaksForLocusUnavailable::sNoticeType, index, scope);
 }
 
 
 int smNPeaksForLocusUnavailable :: GetMessageIndex () const {
 
-	return smNPeaksForLocusUnavailable :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNPeaksForLocusUnavailable::sNoticeType);
 }
 
 
 int smNPeaksForLocusUnavailable :: GetScope () const {
 
-	return smNPeaksForLocusUnavailable :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNPeaksForLocusUnavailable::sNoticeType);
 }
 
 
@@ -3969,20 +3740,19 @@ int smRelativeHeightImbalance :: GetSubject () const {
 
 void smRelativeHeightImbalance :: SetIndexAndScope (int index, int scope) const {
 
-	smRelativeHeightImbalance::sMessageIndex = index;
-	smRelativeHeightImbalance::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smRelativeHeightImbalance::sNoticeType, index, scope);
 }
 
 
 int smRelativeHeightImbalance :: GetMessageIndex () const {
 
-	return smRelativeHeightImbalance :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smRelativeHeightImbalance::sNoticeType);
 }
 
 
 int smRelativeHeightImbalance :: GetScope () const {
 
-	return smRelativeHeightImbalance :: sMessageScope;
+	return SmartNotice::GetScopeForType (smRelativeHeightImbalance::sNoticeType);
 }
 
 
@@ -4029,20 +3799,19 @@ int smHeightBelowFractionalFilter :: GetSubject () const {
 
 void smHeightBelowFractionalFilter :: SetIndexAndScope (int index, int scope) const {
 
-	smHeightBelowFractionalFilter::sMessageIndex = index;
-	smHeightBelowFractionalFilter::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smHeightBelowFractionalFilter::sNoticeType, index, scope);
 }
 
 
 int smHeightBelowFractionalFilter :: GetMessageIndex () const {
 
-	return smHeightBelowFractionalFilter :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smHeightBelowFractionalFilter::sNoticeType);
 }
 
 
 int smHeightBelowFractionalFilter :: GetScope () const {
 
-	return smHeightBelowFractionalFilter :: sMessageScope;
+	return SmartNotice::GetScopeForType (smHeightBelowFractionalFilter::sNoticeType);
 }
 
 
@@ -4089,20 +3858,19 @@ int smPartOfExtendedLocusLeft :: GetSubject () const {
 
 void smPartOfExtendedLocusLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smPartOfExtendedLocusLeft::sMessageIndex = index;
-	smPartOfExtendedLocusLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPartOfExtendedLocusLeft::sNoticeType, index, scope);
 }
 
 
 int smPartOfExtendedLocusLeft :: GetMessageIndex () const {
 
-	return smPartOfExtendedLocusLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPartOfExtendedLocusLeft::sNoticeType);
 }
 
 
 int smPartOfExtendedLocusLeft :: GetScope () const {
 
-	return smPartOfExtendedLocusLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPartOfExtendedLocusLeft::sNoticeType);
 }
 
 
@@ -4149,20 +3917,19 @@ int smPartOfExtendedLocusRight :: GetSubject () const {
 
 void smPartOfExtendedLocusRight :: SetIndexAndScope (int index, int scope) const {
 
-	smPartOfExtendedLocusRight::sMessageIndex = index;
-	smPartOfExtendedLocusRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPartOfExtendedLocusRight::sNoticeType, index, scope);
 }
 
 
 int smPartOfExtendedLocusRight :: GetMessageIndex () const {
 
-	return smPartOfExtendedLocusRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPartOfExtendedLocusRight::sNoticeType);
 }
 
 
 int smPartOfExtendedLocusRight :: GetScope () const {
 
-	return smPartOfExtendedLocusRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPartOfExtendedLocusRight::sNoticeType);
 }
 
 
@@ -4209,20 +3976,19 @@ int smBelowFractionalFilterLeft :: GetSubject () const {
 
 void smBelowFractionalFilterLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smBelowFractionalFilterLeft::sMessageIndex = index;
-	smBelowFractionalFilterLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBelowFractionalFilterLeft::sNoticeType, index, scope);
 }
 
 
 int smBelowFractionalFilterLeft :: GetMessageIndex () const {
 
-	return smBelowFractionalFilterLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBelowFractionalFilterLeft::sNoticeType);
 }
 
 
 int smBelowFractionalFilterLeft :: GetScope () const {
 
-	return smBelowFractionalFilterLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBelowFractionalFilterLeft::sNoticeType);
 }
 
 
@@ -4269,20 +4035,19 @@ int smBelowFractionalFilterRight :: GetSubject () const {
 
 void smBelowFractionalFilterRight :: SetIndexAndScope (int index, int scope) const {
 
-	smBelowFractionalFilterRight::sMessageIndex = index;
-	smBelowFractionalFilterRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBelowFractionalFilterRight::sNoticeType, index, scope);
 }
 
 
 int smBelowFractionalFilterRight :: GetMessageIndex () const {
 
-	return smBelowFractionalFilterRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBelowFractionalFilterRight::sNoticeType);
 }
 
 
 int smBelowFractionalFilterRight :: GetScope () const {
 
-	return smBelowFractionalFilterRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBelowFractionalFilterRight::sNoticeType);
 }
 
 
@@ -4329,20 +4094,19 @@ int smStage2Successful :: GetSubject () const {
 
 void smStage2Successful :: SetIndexAndScope (int index, int scope) const {
 
-	smStage2Successful::sMessageIndex = index;
-	smStage2Successful::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smStage2Successful::sNoticeType, index, scope);
 }
 
 
 int smStage2Successful :: GetMessageIndex () const {
 
-	return smStage2Successful :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smStage2Successful::sNoticeType);
 }
 
 
 int smStage2Successful :: GetScope () const {
 
-	return smStage2Successful :: sMessageScope;
+	return SmartNotice::GetScopeForType (smStage2Successful::sNoticeType);
 }
 
 
@@ -4389,20 +4153,19 @@ int smPullUpAtControlPeak :: GetSubject () const {
 
 void smPullUpAtControlPeak :: SetIndexAndScope (int index, int scope) const {
 
-	smPullUpAtControlPeak::sMessageIndex = index;
-	smPullUpAtControlPeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPullUpAtControlPeak::sNoticeType, index, scope);
 }
 
 
 int smPullUpAtControlPeak :: GetMessageIndex () const {
 
-	return smPullUpAtControlPeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPullUpAtControlPeak::sNoticeType);
 }
 
 
 int smPullUpAtControlPeak :: GetScope () const {
 
-	return smPullUpAtControlPeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPullUpAtControlPeak::sNoticeType);
 }
 
 
@@ -4449,20 +4212,19 @@ int smInterlocusPullUpWithPoorFit :: GetSubject () const {
 
 void smInterlocusPullUpWithPoorFit :: SetIndexAndScope (int index, int scope) const {
 
-	smInterlocusPullUpWithPoorFit::sMessageIndex = index;
-	smInterlocusPullUpWithPoorFit::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smInterlocusPullUpWithPoorFit::sNoticeType, index, scope);
 }
 
 
 int smInterlocusPullUpWithPoorFit :: GetMessageIndex () const {
 
-	return smInterlocusPullUpWithPoorFit :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smInterlocusPullUpWithPoorFit::sNoticeType);
 }
 
 
 int smInterlocusPullUpWithPoorFit :: GetScope () const {
 
-	return smInterlocusPullUpWithPoorFit :: sMessageScope;
+	return SmartNotice::GetScopeForType (smInterlocusPullUpWithPoorFit::sNoticeType);
 }
 
 
@@ -4509,20 +4271,19 @@ int smPossibleValidInterlocusLeft :: GetSubject () const {
 
 void smPossibleValidInterlocusLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smPossibleValidInterlocusLeft::sMessageIndex = index;
-	smPossibleValidInterlocusLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPossibleValidInterlocusLeft::sNoticeType, index, scope);
 }
 
 
 int smPossibleValidInterlocusLeft :: GetMessageIndex () const {
 
-	return smPossibleValidInterlocusLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPossibleValidInterlocusLeft::sNoticeType);
 }
 
 
 int smPossibleValidInterlocusLeft :: GetScope () const {
 
-	return smPossibleValidInterlocusLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPossibleValidInterlocusLeft::sNoticeType);
 }
 
 
@@ -4569,20 +4330,19 @@ int smPossibleValidInterlocusRight :: GetSubject () const {
 
 void smPossibleValidInterlocusRight :: SetIndexAndScope (int index, int scope) const {
 
-	smPossibleValidInterlocusRight::sMessageIndex = index;
-	smPossibleValidInterlocusRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPossibleValidInterlocusRight::sNoticeType, index, scope);
 }
 
 
 int smPossibleValidInterlocusRight :: GetMessageIndex () const {
 
-	return smPossibleValidInterlocusRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPossibleValidInterlocusRight::sNoticeType);
 }
 
 
 int smPossibleValidInterlocusRight :: GetScope () const {
 
-	return smPossibleValidInterlocusRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPossibleValidInterlocusRight::sNoticeType);
 }
 
 
@@ -4629,20 +4389,19 @@ int smUnassignedInterlocusPeak :: GetSubject () const {
 
 void smUnassignedInterlocusPeak :: SetIndexAndScope (int index, int scope) const {
 
-	smUnassignedInterlocusPeak::sMessageIndex = index;
-	smUnassignedInterlocusPeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smUnassignedInterlocusPeak::sNoticeType, index, scope);
 }
 
 
 int smUnassignedInterlocusPeak :: GetMessageIndex () const {
 
-	return smUnassignedInterlocusPeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smUnassignedInterlocusPeak::sNoticeType);
 }
 
 
 int smUnassignedInterlocusPeak :: GetScope () const {
 
-	return smUnassignedInterlocusPeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smUnassignedInterlocusPeak::sNoticeType);
 }
 
 
@@ -4689,20 +4448,19 @@ int smAmbiguousInterlocus :: GetSubject () const {
 
 void smAmbiguousInterlocus :: SetIndexAndScope (int index, int scope) const {
 
-	smAmbiguousInterlocus::sMessageIndex = index;
-	smAmbiguousInterlocus::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smAmbiguousInterlocus::sNoticeType, index, scope);
 }
 
 
 int smAmbiguousInterlocus :: GetMessageIndex () const {
 
-	return smAmbiguousInterlocus :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smAmbiguousInterlocus::sNoticeType);
 }
 
 
 int smAmbiguousInterlocus :: GetScope () const {
 
-	return smAmbiguousInterlocus :: sMessageScope;
+	return SmartNotice::GetScopeForType (smAmbiguousInterlocus::sNoticeType);
 }
 
 
@@ -4749,20 +4507,19 @@ int smTooLowInterlocusPeak :: GetSubject () const {
 
 void smTooLowInterlocusPeak :: SetIndexAndScope (int index, int scope) const {
 
-	smTooLowInterlocusPeak::sMessageIndex = index;
-	smTooLowInterlocusPeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smTooLowInterlocusPeak::sNoticeType, index, scope);
 }
 
 
 int smTooLowInterlocusPeak :: GetMessageIndex () const {
 
-	return smTooLowInterlocusPeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smTooLowInterlocusPeak::sNoticeType);
 }
 
 
 int smTooLowInterlocusPeak :: GetScope () const {
 
-	return smTooLowInterlocusPeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smTooLowInterlocusPeak::sNoticeType);
 }
 
 
@@ -4809,20 +4566,19 @@ int smPossibleInterlocusArtifactLeft :: GetSubject () const {
 
 void smPossibleInterlocusArtifactLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smPossibleInterlocusArtifactLeft::sMessageIndex = index;
-	smPossibleInterlocusArtifactLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPossibleInterlocusArtifactLeft::sNoticeType, index, scope);
 }
 
 
 int smPossibleInterlocusArtifactLeft :: GetMessageIndex () const {
 
-	return smPossibleInterlocusArtifactLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPossibleInterlocusArtifactLeft::sNoticeType);
 }
 
 
 int smPossibleInterlocusArtifactLeft :: GetScope () const {
 
-	return smPossibleInterlocusArtifactLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPossibleInterlocusArtifactLeft::sNoticeType);
 }
 
 
@@ -4869,20 +4625,19 @@ int smPossibleInterlocusArtifactRight :: GetSubject () const {
 
 void smPossibleInterlocusArtifactRight :: SetIndexAndScope (int index, int scope) const {
 
-	smPossibleInterlocusArtifactRight::sMessageIndex = index;
-	smPossibleInterlocusArtifactRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPossibleInterlocusArtifactRight::sNoticeType, index, scope);
 }
 
 
 int smPossibleInterlocusArtifactRight :: GetMessageIndex () const {
 
-	return smPossibleInterlocusArtifactRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPossibleInterlocusArtifactRight::sNoticeType);
 }
 
 
 int smPossibleInterlocusArtifactRight :: GetScope () const {
 
-	return smPossibleInterlocusArtifactRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPossibleInterlocusArtifactRight::sNoticeType);
 }
 
 
@@ -4929,20 +4684,19 @@ int smFirstAlleleEqFirstLadderPeak :: GetSubject () const {
 
 void smFirstAlleleEqFirstLadderPeak :: SetIndexAndScope (int index, int scope) const {
 
-	smFirstAlleleEqFirstLadderPeak::sMessageIndex = index;
-	smFirstAlleleEqFirstLadderPeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smFirstAlleleEqFirstLadderPeak::sNoticeType, index, scope);
 }
 
 
 int smFirstAlleleEqFirstLadderPeak :: GetMessageIndex () const {
 
-	return smFirstAlleleEqFirstLadderPeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smFirstAlleleEqFirstLadderPeak::sNoticeType);
 }
 
 
 int smFirstAlleleEqFirstLadderPeak :: GetScope () const {
 
-	return smFirstAlleleEqFirstLadderPeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smFirstAlleleEqFirstLadderPeak::sNoticeType);
 }
 
 
@@ -4989,20 +4743,19 @@ int smSignalOL :: GetSubject () const {
 
 void smSignalOL :: SetIndexAndScope (int index, int scope) const {
 
-	smSignalOL::sMessageIndex = index;
-	smSignalOL::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSignalOL::sNoticeType, index, scope);
 }
 
 
 int smSignalOL :: GetMessageIndex () const {
 
-	return smSignalOL :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSignalOL::sNoticeType);
 }
 
 
 int smSignalOL :: GetScope () const {
 
-	return smSignalOL :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSignalOL::sNoticeType);
 }
 
 
@@ -5049,20 +4802,19 @@ int smAMELMisaligned :: GetSubject () const {
 
 void smAMELMisaligned :: SetIndexAndScope (int index, int scope) const {
 
-	smAMELMisaligned::sMessageIndex = index;
-	smAMELMisaligned::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smAMELMisaligned::sNoticeType, index, scope);
 }
 
 
 int smAMELMisaligned :: GetMessageIndex () const {
 
-	return smAMELMisaligned :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smAMELMisaligned::sNoticeType);
 }
 
 
 int smAMELMisaligned :: GetScope () const {
 
-	return smAMELMisaligned :: sMessageScope;
+	return SmartNotice::GetScopeForType (smAMELMisaligned::sNoticeType);
 }
 
 
@@ -5109,20 +4861,19 @@ int smCrater :: GetSubject () const {
 
 void smCrater :: SetIndexAndScope (int index, int scope) const {
 
-	smCrater::sMessageIndex = index;
-	smCrater::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smCrater::sNoticeType, index, scope);
 }
 
 
 int smCrater :: GetMessageIndex () const {
 
-	return smCrater :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smCrater::sNoticeType);
 }
 
 
 int smCrater :: GetScope () const {
 
-	return smCrater :: sMessageScope;
+	return SmartNotice::GetScopeForType (smCrater::sNoticeType);
 }
 
 
@@ -5169,20 +4920,19 @@ int smAcceptedOLLeft :: GetSubject () const {
 
 void smAcceptedOLLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smAcceptedOLLeft::sMessageIndex = index;
-	smAcceptedOLLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smAcceptedOLLeft::sNoticeType, index, scope);
 }
 
 
 int smAcceptedOLLeft :: GetMessageIndex () const {
 
-	return smAcceptedOLLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smAcceptedOLLeft::sNoticeType);
 }
 
 
 int smAcceptedOLLeft :: GetScope () const {
 
-	return smAcceptedOLLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smAcceptedOLLeft::sNoticeType);
 }
 
 
@@ -5229,20 +4979,19 @@ int smAcceptedOLRight :: GetSubject () const {
 
 void smAcceptedOLRight :: SetIndexAndScope (int index, int scope) const {
 
-	smAcceptedOLRight::sMessageIndex = index;
-	smAcceptedOLRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smAcceptedOLRight::sNoticeType, index, scope);
 }
 
 
 int smAcceptedOLRight :: GetMessageIndex () const {
 
-	return smAcceptedOLRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smAcceptedOLRight::sNoticeType);
 }
 
 
 int smAcceptedOLRight :: GetScope () const {
 
-	return smAcceptedOLRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smAcceptedOLRight::sNoticeType);
 }
 
 
@@ -5289,20 +5038,19 @@ int smStage3Successful :: GetSubject () const {
 
 void smStage3Successful :: SetIndexAndScope (int index, int scope) const {
 
-	smStage3Successful::sMessageIndex = index;
-	smStage3Successful::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smStage3Successful::sNoticeType, index, scope);
 }
 
 
 int smStage3Successful :: GetMessageIndex () const {
 
-	return smStage3Successful :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smStage3Successful::sNoticeType);
 }
 
 
 int smStage3Successful :: GetScope () const {
 
-	return smStage3Successful :: sMessageScope;
+	return SmartNotice::GetScopeForType (smStage3Successful::sNoticeType);
 }
 
 
@@ -5349,20 +5097,19 @@ int smValidOLInterlocusLeft :: GetSubject () const {
 
 void smValidOLInterlocusLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smValidOLInterlocusLeft::sMessageIndex = index;
-	smValidOLInterlocusLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smValidOLInterlocusLeft::sNoticeType, index, scope);
 }
 
 
 int smValidOLInterlocusLeft :: GetMessageIndex () const {
 
-	return smValidOLInterlocusLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smValidOLInterlocusLeft::sNoticeType);
 }
 
 
 int smValidOLInterlocusLeft :: GetScope () const {
 
-	return smValidOLInterlocusLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smValidOLInterlocusLeft::sNoticeType);
 }
 
 
@@ -5409,20 +5156,19 @@ int smValidOLInterlocusRight :: GetSubject () const {
 
 void smValidOLInterlocusRight :: SetIndexAndScope (int index, int scope) const {
 
-	smValidOLInterlocusRight::sMessageIndex = index;
-	smValidOLInterlocusRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smValidOLInterlocusRight::sNoticeType, index, scope);
 }
 
 
 int smValidOLInterlocusRight :: GetMessageIndex () const {
 
-	return smValidOLInterlocusRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smValidOLInterlocusRight::sNoticeType);
 }
 
 
 int smValidOLInterlocusRight :: GetScope () const {
 
-	return smValidOLInterlocusRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smValidOLInterlocusRight::sNoticeType);
 }
 
 
@@ -5469,20 +5215,19 @@ int smAcceptedInterlocusLeft :: GetSubject () const {
 
 void smAcceptedInterlocusLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smAcceptedInterlocusLeft::sMessageIndex = index;
-	smAcceptedInterlocusLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smAcceptedInterlocusLeft::sNoticeType, index, scope);
 }
 
 
 int smAcceptedInterlocusLeft :: GetMessageIndex () const {
 
-	return smAcceptedInterlocusLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smAcceptedInterlocusLeft::sNoticeType);
 }
 
 
 int smAcceptedInterlocusLeft :: GetScope () const {
 
-	return smAcceptedInterlocusLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smAcceptedInterlocusLeft::sNoticeType);
 }
 
 
@@ -5529,20 +5274,19 @@ int smAcceptedInterlocusRight :: GetSubject () const {
 
 void smAcceptedInterlocusRight :: SetIndexAndScope (int index, int scope) const {
 
-	smAcceptedInterlocusRight::sMessageIndex = index;
-	smAcceptedInterlocusRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smAcceptedInterlocusRight::sNoticeType, index, scope);
 }
 
 
 int smAcceptedInterlocusRight :: GetMessageIndex () const {
 
-	return smAcceptedInterlocusRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smAcceptedInterlocusRight::sNoticeType);
 }
 
 
 int smAcceptedInterlocusRight :: GetScope () const {
 
-	return smAcceptedInterlocusRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smAcceptedInterlocusRight::sNoticeType);
 }
 
 
@@ -5589,20 +5333,19 @@ int smNoXForAMEL :: GetSubject () const {
 
 void smNoXForAMEL :: SetIndexAndScope (int index, int scope) const {
 
-	smNoXForAMEL::sMessageIndex = index;
-	smNoXForAMEL::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNoXForAMEL::sNoticeType, index, scope);
 }
 
 
 int smNoXForAMEL :: GetMessageIndex () const {
 
-	return smNoXForAMEL :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNoXForAMEL::sNoticeType);
 }
 
 
 int smNoXForAMEL :: GetScope () const {
 
-	return smNoXForAMEL :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNoXForAMEL::sNoticeType);
 }
 
 
@@ -5649,20 +5392,19 @@ int smSignalIsAllele :: GetSubject () const {
 
 void smSignalIsAllele :: SetIndexAndScope (int index, int scope) const {
 
-	smSignalIsAllele::sMessageIndex = index;
-	smSignalIsAllele::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSignalIsAllele::sNoticeType, index, scope);
 }
 
 
 int smSignalIsAllele :: GetMessageIndex () const {
 
-	return smSignalIsAllele :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSignalIsAllele::sNoticeType);
 }
 
 
 int smSignalIsAllele :: GetScope () const {
 
-	return smSignalIsAllele :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSignalIsAllele::sNoticeType);
 }
 
 
@@ -5709,20 +5451,19 @@ int smPosCtrlLocusMismatch :: GetSubject () const {
 
 void smPosCtrlLocusMismatch :: SetIndexAndScope (int index, int scope) const {
 
-	smPosCtrlLocusMismatch::sMessageIndex = index;
-	smPosCtrlLocusMismatch::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPosCtrlLocusMismatch::sNoticeType, index, scope);
 }
 
 
 int smPosCtrlLocusMismatch :: GetMessageIndex () const {
 
-	return smPosCtrlLocusMismatch :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPosCtrlLocusMismatch::sNoticeType);
 }
 
 
 int smPosCtrlLocusMismatch :: GetScope () const {
 
-	return smPosCtrlLocusMismatch :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPosCtrlLocusMismatch::sNoticeType);
 }
 
 
@@ -5769,20 +5510,19 @@ int smNoGenotypeFound :: GetSubject () const {
 
 void smNoGenotypeFound :: SetIndexAndScope (int index, int scope) const {
 
-	smNoGenotypeFound::sMessageIndex = index;
-	smNoGenotypeFound::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNoGenotypeFound::sNoticeType, index, scope);
 }
 
 
 int smNoGenotypeFound :: GetMessageIndex () const {
 
-	return smNoGenotypeFound :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNoGenotypeFound::sNoticeType);
 }
 
 
 int smNoGenotypeFound :: GetScope () const {
 
-	return smNoGenotypeFound :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNoGenotypeFound::sNoticeType);
 }
 
 
@@ -5829,20 +5569,19 @@ int smThreeOrMoreAlleles :: GetSubject () const {
 
 void smThreeOrMoreAlleles :: SetIndexAndScope (int index, int scope) const {
 
-	smThreeOrMoreAlleles::sMessageIndex = index;
-	smThreeOrMoreAlleles::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smThreeOrMoreAlleles::sNoticeType, index, scope);
 }
 
 
 int smThreeOrMoreAlleles :: GetMessageIndex () const {
 
-	return smThreeOrMoreAlleles :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smThreeOrMoreAlleles::sNoticeType);
 }
 
 
 int smThreeOrMoreAlleles :: GetScope () const {
 
-	return smThreeOrMoreAlleles :: sMessageScope;
+	return SmartNotice::GetScopeForType (smThreeOrMoreAlleles::sNoticeType);
 }
 
 
@@ -5889,20 +5628,19 @@ int smTwoOrMoreAlleles :: GetSubject () const {
 
 void smTwoOrMoreAlleles :: SetIndexAndScope (int index, int scope) const {
 
-	smTwoOrMoreAlleles::sMessageIndex = index;
-	smTwoOrMoreAlleles::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smTwoOrMoreAlleles::sNoticeType, index, scope);
 }
 
 
 int smTwoOrMoreAlleles :: GetMessageIndex () const {
 
-	return smTwoOrMoreAlleles :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smTwoOrMoreAlleles::sNoticeType);
 }
 
 
 int smTwoOrMoreAlleles :: GetScope () const {
 
-	return smTwoOrMoreAlleles :: sMessageScope;
+	return SmartNotice::GetScopeForType (smTwoOrMoreAlleles::sNoticeType);
 }
 
 
@@ -5949,20 +5687,19 @@ int smHeterozygousImbalance :: GetSubject () const {
 
 void smHeterozygousImbalance :: SetIndexAndScope (int index, int scope) const {
 
-	smHeterozygousImbalance::sMessageIndex = index;
-	smHeterozygousImbalance::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smHeterozygousImbalance::sNoticeType, index, scope);
 }
 
 
 int smHeterozygousImbalance :: GetMessageIndex () const {
 
-	return smHeterozygousImbalance :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smHeterozygousImbalance::sNoticeType);
 }
 
 
 int smHeterozygousImbalance :: GetScope () const {
 
-	return smHeterozygousImbalance :: sMessageScope;
+	return SmartNotice::GetScopeForType (smHeterozygousImbalance::sNoticeType);
 }
 
 
@@ -6009,20 +5746,19 @@ int smOLAlleles :: GetSubject () const {
 
 void smOLAlleles :: SetIndexAndScope (int index, int scope) const {
 
-	smOLAlleles::sMessageIndex = index;
-	smOLAlleles::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smOLAlleles::sNoticeType, index, scope);
 }
 
 
 int smOLAlleles :: GetMessageIndex () const {
 
-	return smOLAlleles :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smOLAlleles::sNoticeType);
 }
 
 
 int smOLAlleles :: GetScope () const {
 
-	return smOLAlleles :: sMessageScope;
+	return SmartNotice::GetScopeForType (smOLAlleles::sNoticeType);
 }
 
 
@@ -6069,20 +5805,19 @@ int smHomozygoteHeightProblem :: GetSubject () const {
 
 void smHomozygoteHeightProblem :: SetIndexAndScope (int index, int scope) const {
 
-	smHomozygoteHeightProblem::sMessageIndex = index;
-	smHomozygoteHeightProblem::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smHomozygoteHeightProblem::sNoticeType, index, scope);
 }
 
 
 int smHomozygoteHeightProblem :: GetMessageIndex () const {
 
-	return smHomozygoteHeightProblem :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smHomozygoteHeightProblem::sNoticeType);
 }
 
 
 int smHomozygoteHeightProblem :: GetScope () const {
 
-	return smHomozygoteHeightProblem :: sMessageScope;
+	return SmartNotice::GetScopeForType (smHomozygoteHeightProblem::sNoticeType);
 }
 
 
@@ -6129,20 +5864,19 @@ int smPullUpAtAllele :: GetSubject () const {
 
 void smPullUpAtAllele :: SetIndexAndScope (int index, int scope) const {
 
-	smPullUpAtAllele::sMessageIndex = index;
-	smPullUpAtAllele::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPullUpAtAllele::sNoticeType, index, scope);
 }
 
 
 int smPullUpAtAllele :: GetMessageIndex () const {
 
-	return smPullUpAtAllele :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPullUpAtAllele::sNoticeType);
 }
 
 
 int smPullUpAtAllele :: GetScope () const {
 
-	return smPullUpAtAllele :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPullUpAtAllele::sNoticeType);
 }
 
 
@@ -6189,20 +5923,19 @@ int smPosCtrlLocusNotFound :: GetSubject () const {
 
 void smPosCtrlLocusNotFound :: SetIndexAndScope (int index, int scope) const {
 
-	smPosCtrlLocusNotFound::sMessageIndex = index;
-	smPosCtrlLocusNotFound::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPosCtrlLocusNotFound::sNoticeType, index, scope);
 }
 
 
 int smPosCtrlLocusNotFound :: GetMessageIndex () const {
 
-	return smPosCtrlLocusNotFound :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPosCtrlLocusNotFound::sNoticeType);
 }
 
 
 int smPosCtrlLocusNotFound :: GetScope () const {
 
-	return smPosCtrlLocusNotFound :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPosCtrlLocusNotFound::sNoticeType);
 }
 
 
@@ -6249,20 +5982,19 @@ int smBPResidualTooLarge :: GetSubject () const {
 
 void smBPResidualTooLarge :: SetIndexAndScope (int index, int scope) const {
 
-	smBPResidualTooLarge::sMessageIndex = index;
-	smBPResidualTooLarge::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBPResidualTooLarge::sNoticeType, index, scope);
 }
 
 
 int smBPResidualTooLarge :: GetMessageIndex () const {
 
-	return smBPResidualTooLarge :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBPResidualTooLarge::sNoticeType);
 }
 
 
 int smBPResidualTooLarge :: GetScope () const {
 
-	return smBPResidualTooLarge :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBPResidualTooLarge::sNoticeType);
 }
 
 
@@ -6309,20 +6041,19 @@ int smExtraLadderAllele :: GetSubject () const {
 
 void smExtraLadderAllele :: SetIndexAndScope (int index, int scope) const {
 
-	smExtraLadderAllele::sMessageIndex = index;
-	smExtraLadderAllele::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smExtraLadderAllele::sNoticeType, index, scope);
 }
 
 
 int smExtraLadderAllele :: GetMessageIndex () const {
 
-	return smExtraLadderAllele :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smExtraLadderAllele::sNoticeType);
 }
 
 
 int smExtraLadderAllele :: GetScope () const {
 
-	return smExtraLadderAllele :: sMessageScope;
+	return SmartNotice::GetScopeForType (smExtraLadderAllele::sNoticeType);
 }
 
 
@@ -6369,20 +6100,19 @@ int smCriticalMessagesAtILS :: GetSubject () const {
 
 void smCriticalMessagesAtILS :: SetIndexAndScope (int index, int scope) const {
 
-	smCriticalMessagesAtILS::sMessageIndex = index;
-	smCriticalMessagesAtILS::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smCriticalMessagesAtILS::sNoticeType, index, scope);
 }
 
 
 int smCriticalMessagesAtILS :: GetMessageIndex () const {
 
-	return smCriticalMessagesAtILS :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smCriticalMessagesAtILS::sNoticeType);
 }
 
 
 int smCriticalMessagesAtILS :: GetScope () const {
 
-	return smCriticalMessagesAtILS :: sMessageScope;
+	return SmartNotice::GetScopeForType (smCriticalMessagesAtILS::sNoticeType);
 }
 
 
@@ -6429,20 +6159,19 @@ int smAMELHasExtraneousPeaks :: GetSubject () const {
 
 void smAMELHasExtraneousPeaks :: SetIndexAndScope (int index, int scope) const {
 
-	smAMELHasExtraneousPeaks::sMessageIndex = index;
-	smAMELHasExtraneousPeaks::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smAMELHasExtraneousPeaks::sNoticeType, index, scope);
 }
 
 
 int smAMELHasExtraneousPeaks :: GetMessageIndex () const {
 
-	return smAMELHasExtraneousPeaks :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smAMELHasExtraneousPeaks::sNoticeType);
 }
 
 
 int smAMELHasExtraneousPeaks :: GetScope () const {
 
-	return smAMELHasExtraneousPeaks :: sMessageScope;
+	return SmartNotice::GetScopeForType (smAMELHasExtraneousPeaks::sNoticeType);
 }
 
 
@@ -6489,20 +6218,19 @@ int smExtraneousAMELPeak :: GetSubject () const {
 
 void smExtraneousAMELPeak :: SetIndexAndScope (int index, int scope) const {
 
-	smExtraneousAMELPeak::sMessageIndex = index;
-	smExtraneousAMELPeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smExtraneousAMELPeak::sNoticeType, index, scope);
 }
 
 
 int smExtraneousAMELPeak :: GetMessageIndex () const {
 
-	return smExtraneousAMELPeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smExtraneousAMELPeak::sNoticeType);
 }
 
 
 int smExtraneousAMELPeak :: GetScope () const {
 
-	return smExtraneousAMELPeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smExtraneousAMELPeak::sNoticeType);
 }
 
 
@@ -6549,20 +6277,19 @@ int smNegCtrlChannelHasNoPrimerPeaks :: GetSubject () const {
 
 void smNegCtrlChannelHasNoPrimerPeaks :: SetIndexAndScope (int index, int scope) const {
 
-	smNegCtrlChannelHasNoPrimerPeaks::sMessageIndex = index;
-	smNegCtrlChannelHasNoPrimerPeaks::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNegCtrlChannelHasNoPrimerPeaks::sNoticeType, index, scope);
 }
 
 
 int smNegCtrlChannelHasNoPrimerPeaks :: GetMessageIndex () const {
 
-	return smNegCtrlChannelHasNoPrimerPeaks :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNegCtrlChannelHasNoPrimerPeaks::sNoticeType);
 }
 
 
 int smNegCtrlChannelHasNoPrimerPeaks :: GetScope () const {
 
-	return smNegCtrlChannelHasNoPrimerPeaks :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNegCtrlChannelHasNoPrimerPeaks::sNoticeType);
 }
 
 
@@ -6609,20 +6336,19 @@ int smMinimumHeightForPrimerPeaks :: GetSubject () const {
 
 void smMinimumHeightForPrimerPeaks :: SetIndexAndScope (int index, int scope) const {
 
-	smMinimumHeightForPrimerPeaks::sMessageIndex = index;
-	smMinimumHeightForPrimerPeaks::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smMinimumHeightForPrimerPeaks::sNoticeType, index, scope);
 }
 
 
 int smMinimumHeightForPrimerPeaks :: GetMessageIndex () const {
 
-	return smMinimumHeightForPrimerPeaks :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smMinimumHeightForPrimerPeaks::sNoticeType);
 }
 
 
 int smMinimumHeightForPrimerPeaks :: GetScope () const {
 
-	return smMinimumHeightForPrimerPeaks :: sMessageScope;
+	return SmartNotice::GetScopeForType (smMinimumHeightForPrimerPeaks::sNoticeType);
 }
 
 
@@ -6669,20 +6395,19 @@ int smInterlocusPeaksToRight :: GetSubject () const {
 
 void smInterlocusPeaksToRight :: SetIndexAndScope (int index, int scope) const {
 
-	smInterlocusPeaksToRight::sMessageIndex = index;
-	smInterlocusPeaksToRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smInterlocusPeaksToRight::sNoticeType, index, scope);
 }
 
 
 int smInterlocusPeaksToRight :: GetMessageIndex () const {
 
-	return smInterlocusPeaksToRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smInterlocusPeaksToRight::sNoticeType);
 }
 
 
 int smInterlocusPeaksToRight :: GetScope () const {
 
-	return smInterlocusPeaksToRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smInterlocusPeaksToRight::sNoticeType);
 }
 
 
@@ -6729,20 +6454,19 @@ int smInterlocusPeaksToLeft :: GetSubject () const {
 
 void smInterlocusPeaksToLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smInterlocusPeaksToLeft::sMessageIndex = index;
-	smInterlocusPeaksToLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smInterlocusPeaksToLeft::sNoticeType, index, scope);
 }
 
 
 int smInterlocusPeaksToLeft :: GetMessageIndex () const {
 
-	return smInterlocusPeaksToLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smInterlocusPeaksToLeft::sNoticeType);
 }
 
 
 int smInterlocusPeaksToLeft :: GetScope () const {
 
-	return smInterlocusPeaksToLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smInterlocusPeaksToLeft::sNoticeType);
 }
 
 
@@ -6789,20 +6513,19 @@ int smLadderFailed :: GetSubject () const {
 
 void smLadderFailed :: SetIndexAndScope (int index, int scope) const {
 
-	smLadderFailed::sMessageIndex = index;
-	smLadderFailed::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLadderFailed::sNoticeType, index, scope);
 }
 
 
 int smLadderFailed :: GetMessageIndex () const {
 
-	return smLadderFailed :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLadderFailed::sNoticeType);
 }
 
 
 int smLadderFailed :: GetScope () const {
 
-	return smLadderFailed :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLadderFailed::sNoticeType);
 }
 
 
@@ -6849,20 +6572,19 @@ int smSampleUnanalyzable :: GetSubject () const {
 
 void smSampleUnanalyzable :: SetIndexAndScope (int index, int scope) const {
 
-	smSampleUnanalyzable::sMessageIndex = index;
-	smSampleUnanalyzable::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSampleUnanalyzable::sNoticeType, index, scope);
 }
 
 
 int smSampleUnanalyzable :: GetMessageIndex () const {
 
-	return smSampleUnanalyzable :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSampleUnanalyzable::sNoticeType);
 }
 
 
 int smSampleUnanalyzable :: GetScope () const {
 
-	return smSampleUnanalyzable :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSampleUnanalyzable::sNoticeType);
 }
 
 
@@ -6909,20 +6631,19 @@ int smCriticalMessagesAtAlleles :: GetSubject () const {
 
 void smCriticalMessagesAtAlleles :: SetIndexAndScope (int index, int scope) const {
 
-	smCriticalMessagesAtAlleles::sMessageIndex = index;
-	smCriticalMessagesAtAlleles::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smCriticalMessagesAtAlleles::sNoticeType, index, scope);
 }
 
 
 int smCriticalMessagesAtAlleles :: GetMessageIndex () const {
 
-	return smCriticalMessagesAtAlleles :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smCriticalMessagesAtAlleles::sNoticeType);
 }
 
 
 int smCriticalMessagesAtAlleles :: GetScope () const {
 
-	return smCriticalMessagesAtAlleles :: sMessageScope;
+	return SmartNotice::GetScopeForType (smCriticalMessagesAtAlleles::sNoticeType);
 }
 
 
@@ -6969,20 +6690,19 @@ int smHeightBelowPullupFractionalFilter :: GetSubject () const {
 
 void smHeightBelowPullupFractionalFilter :: SetIndexAndScope (int index, int scope) const {
 
-	smHeightBelowPullupFractionalFilter::sMessageIndex = index;
-	smHeightBelowPullupFractionalFilter::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smHeightBelowPullupFractionalFilter::sNoticeType, index, scope);
 }
 
 
 int smHeightBelowPullupFractionalFilter :: GetMessageIndex () const {
 
-	return smHeightBelowPullupFractionalFilter :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smHeightBelowPullupFractionalFilter::sNoticeType);
 }
 
 
 int smHeightBelowPullupFractionalFilter :: GetScope () const {
 
-	return smHeightBelowPullupFractionalFilter :: sMessageScope;
+	return SmartNotice::GetScopeForType (smHeightBelowPullupFractionalFilter::sNoticeType);
 }
 
 
@@ -7029,20 +6749,19 @@ int smBelowPullupFractionalFilterLeft :: GetSubject () const {
 
 void smBelowPullupFractionalFilterLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smBelowPullupFractionalFilterLeft::sMessageIndex = index;
-	smBelowPullupFractionalFilterLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBelowPullupFractionalFilterLeft::sNoticeType, index, scope);
 }
 
 
 int smBelowPullupFractionalFilterLeft :: GetMessageIndex () const {
 
-	return smBelowPullupFractionalFilterLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBelowPullupFractionalFilterLeft::sNoticeType);
 }
 
 
 int smBelowPullupFractionalFilterLeft :: GetScope () const {
 
-	return smBelowPullupFractionalFilterLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBelowPullupFractionalFilterLeft::sNoticeType);
 }
 
 
@@ -7089,20 +6808,19 @@ int smBelowPullupFractionalFilterRight :: GetSubject () const {
 
 void smBelowPullupFractionalFilterRight :: SetIndexAndScope (int index, int scope) const {
 
-	smBelowPullupFractionalFilterRight::sMessageIndex = index;
-	smBelowPullupFractionalFilterRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBelowPullupFractionalFilterRight::sNoticeType, index, scope);
 }
 
 
 int smBelowPullupFractionalFilterRight :: GetMessageIndex () const {
 
-	return smBelowPullupFractionalFilterRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBelowPullupFractionalFilterRight::sNoticeType);
 }
 
 
 int smBelowPullupFractionalFilterRight :: GetScope () const {
 
-	return smBelowPullupFractionalFilterRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBelowPullupFractionalFilterRight::sNoticeType);
 }
 
 
@@ -7149,20 +6867,19 @@ int smPossibleExtraLocusAllele :: GetSubject () const {
 
 void smPossibleExtraLocusAllele :: SetIndexAndScope (int index, int scope) const {
 
-	smPossibleExtraLocusAllele::sMessageIndex = index;
-	smPossibleExtraLocusAllele::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPossibleExtraLocusAllele::sNoticeType, index, scope);
 }
 
 
 int smPossibleExtraLocusAllele :: GetMessageIndex () const {
 
-	return smPossibleExtraLocusAllele :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPossibleExtraLocusAllele::sNoticeType);
 }
 
 
 int smPossibleExtraLocusAllele :: GetScope () const {
 
-	return smPossibleExtraLocusAllele :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPossibleExtraLocusAllele::sNoticeType);
 }
 
 
@@ -7209,20 +6926,19 @@ int smUnexpectedPeakInNegativeControl :: GetSubject () const {
 
 void smUnexpectedPeakInNegativeControl :: SetIndexAndScope (int index, int scope) const {
 
-	smUnexpectedPeakInNegativeControl::sMessageIndex = index;
-	smUnexpectedPeakInNegativeControl::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smUnexpectedPeakInNegativeControl::sNoticeType, index, scope);
 }
 
 
 int smUnexpectedPeakInNegativeControl :: GetMessageIndex () const {
 
-	return smUnexpectedPeakInNegativeControl :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smUnexpectedPeakInNegativeControl::sNoticeType);
 }
 
 
 int smUnexpectedPeakInNegativeControl :: GetScope () const {
 
-	return smUnexpectedPeakInNegativeControl :: sMessageScope;
+	return SmartNotice::GetScopeForType (smUnexpectedPeakInNegativeControl::sNoticeType);
 }
 
 
@@ -7269,20 +6985,19 @@ int smLocusContainsPeaksWithExcessiveResiduals :: GetSubject () const {
 
 void smLocusContainsPeaksWithExcessiveResiduals :: SetIndexAndScope (int index, int scope) const {
 
-	smLocusContainsPeaksWithExcessiveResiduals::sMessageIndex = index;
-	smLocusContainsPeaksWithExcessiveResiduals::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLocusContainsPeaksWithExcessiveResiduals::sNoticeType, index, scope);
 }
 
 
 int smLocusContainsPeaksWithExcessiveResiduals :: GetMessageIndex () const {
 
-	return smLocusContainsPeaksWithExcessiveResiduals :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLocusContainsPeaksWithExcessiveResiduals::sNoticeType);
 }
 
 
 int smLocusContainsPeaksWithExcessiveResiduals :: GetScope () const {
 
-	return smLocusContainsPeaksWithExcessiveResiduals :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLocusContainsPeaksWithExcessiveResiduals::sNoticeType);
 }
 
 
@@ -7329,20 +7044,19 @@ int smPrimaryInterchannelLink :: GetSubject () const {
 
 void smPrimaryInterchannelLink :: SetIndexAndScope (int index, int scope) const {
 
-	smPrimaryInterchannelLink::sMessageIndex = index;
-	smPrimaryInterchannelLink::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPrimaryInterchannelLink::sNoticeType, index, scope);
 }
 
 
 int smPrimaryInterchannelLink :: GetMessageIndex () const {
 
-	return smPrimaryInterchannelLink :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPrimaryInterchannelLink::sNoticeType);
 }
 
 
 int smPrimaryInterchannelLink :: GetScope () const {
 
-	return smPrimaryInterchannelLink :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPrimaryInterchannelLink::sNoticeType);
 }
 
 
@@ -7389,20 +7103,19 @@ int smNotInterchannelLink :: GetSubject () const {
 
 void smNotInterchannelLink :: SetIndexAndScope (int index, int scope) const {
 
-	smNotInterchannelLink::sMessageIndex = index;
-	smNotInterchannelLink::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNotInterchannelLink::sNoticeType, index, scope);
 }
 
 
 int smNotInterchannelLink :: GetMessageIndex () const {
 
-	return smNotInterchannelLink :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNotInterchannelLink::sNoticeType);
 }
 
 
 int smNotInterchannelLink :: GetScope () const {
 
-	return smNotInterchannelLink :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNotInterchannelLink::sNoticeType);
 }
 
 
@@ -7449,20 +7162,19 @@ int smHeightBelowInterlocusMinRFU :: GetSubject () const {
 
 void smHeightBelowInterlocusMinRFU :: SetIndexAndScope (int index, int scope) const {
 
-	smHeightBelowInterlocusMinRFU::sMessageIndex = index;
-	smHeightBelowInterlocusMinRFU::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smHeightBelowInterlocusMinRFU::sNoticeType, index, scope);
 }
 
 
 int smHeightBelowInterlocusMinRFU :: GetMessageIndex () const {
 
-	return smHeightBelowInterlocusMinRFU :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smHeightBelowInterlocusMinRFU::sNoticeType);
 }
 
 
 int smHeightBelowInterlocusMinRFU :: GetScope () const {
 
-	return smHeightBelowInterlocusMinRFU :: sMessageScope;
+	return SmartNotice::GetScopeForType (smHeightBelowInterlocusMinRFU::sNoticeType);
 }
 
 
@@ -7509,20 +7221,19 @@ int smFSAChannelUnreadable :: GetSubject () const {
 
 void smFSAChannelUnreadable :: SetIndexAndScope (int index, int scope) const {
 
-	smFSAChannelUnreadable::sMessageIndex = index;
-	smFSAChannelUnreadable::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smFSAChannelUnreadable::sNoticeType, index, scope);
 }
 
 
 int smFSAChannelUnreadable :: GetMessageIndex () const {
 
-	return smFSAChannelUnreadable :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smFSAChannelUnreadable::sNoticeType);
 }
 
 
 int smFSAChannelUnreadable :: GetScope () const {
 
-	return smFSAChannelUnreadable :: sMessageScope;
+	return SmartNotice::GetScopeForType (smFSAChannelUnreadable::sNoticeType);
 }
 
 
@@ -7569,20 +7280,19 @@ int smAmbiguousInterlocusCrater :: GetSubject () const {
 
 void smAmbiguousInterlocusCrater :: SetIndexAndScope (int index, int scope) const {
 
-	smAmbiguousInterlocusCrater::sMessageIndex = index;
-	smAmbiguousInterlocusCrater::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smAmbiguousInterlocusCrater::sNoticeType, index, scope);
 }
 
 
 int smAmbiguousInterlocusCrater :: GetMessageIndex () const {
 
-	return smAmbiguousInterlocusCrater :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smAmbiguousInterlocusCrater::sNoticeType);
 }
 
 
 int smAmbiguousInterlocusCrater :: GetScope () const {
 
-	return smAmbiguousInterlocusCrater :: sMessageScope;
+	return SmartNotice::GetScopeForType (smAmbiguousInterlocusCrater::sNoticeType);
 }
 
 
@@ -7629,20 +7339,19 @@ int smPossibleAmbiguousInterlocusAssignedToLocus :: GetSubject () const {
 
 void smPossibleAmbiguousInterlocusAssignedToLocus :: SetIndexAndScope (int index, int scope) const {
 
-	smPossibleAmbiguousInterlocusAssignedToLocus::sMessageIndex = index;
-	smPossibleAmbiguousInterlocusAssignedToLocus::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPossibleAmbiguousInterlocusAssignedToLocus::sNoticeType, index, scope);
 }
 
 
 int smPossibleAmbiguousInterlocusAssignedToLocus :: GetMessageIndex () const {
 
-	return smPossibleAmbiguousInterlocusAssignedToLocus :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPossibleAmbiguousInterlocusAssignedToLocus::sNoticeType);
 }
 
 
 int smPossibleAmbiguousInterlocusAssignedToLocus :: GetScope () const {
 
-	return smPossibleAmbiguousInterlocusAssignedToLocus :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPossibleAmbiguousInterlocusAssignedToLocus::sNoticeType);
 }
 
 
@@ -7689,20 +7398,19 @@ int smWouldCauseHeterozygousImbalanceLeft :: GetSubject () const {
 
 void smWouldCauseHeterozygousImbalanceLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smWouldCauseHeterozygousImbalanceLeft::sMessageIndex = index;
-	smWouldCauseHeterozygousImbalanceLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smWouldCauseHeterozygousImbalanceLeft::sNoticeType, index, scope);
 }
 
 
 int smWouldCauseHeterozygousImbalanceLeft :: GetMessageIndex () const {
 
-	return smWouldCauseHeterozygousImbalanceLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smWouldCauseHeterozygousImbalanceLeft::sNoticeType);
 }
 
 
 int smWouldCauseHeterozygousImbalanceLeft :: GetScope () const {
 
-	return smWouldCauseHeterozygousImbalanceLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smWouldCauseHeterozygousImbalanceLeft::sNoticeType);
 }
 
 
@@ -7749,20 +7457,19 @@ int smWouldCauseHeterozygousImbalanceRight :: GetSubject () const {
 
 void smWouldCauseHeterozygousImbalanceRight :: SetIndexAndScope (int index, int scope) const {
 
-	smWouldCauseHeterozygousImbalanceRight::sMessageIndex = index;
-	smWouldCauseHeterozygousImbalanceRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smWouldCauseHeterozygousImbalanceRight::sNoticeType, index, scope);
 }
 
 
 int smWouldCauseHeterozygousImbalanceRight :: GetMessageIndex () const {
 
-	return smWouldCauseHeterozygousImbalanceRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smWouldCauseHeterozygousImbalanceRight::sNoticeType);
 }
 
 
 int smWouldCauseHeterozygousImbalanceRight :: GetScope () const {
 
-	return smWouldCauseHeterozygousImbalanceRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smWouldCauseHeterozygousImbalanceRight::sNoticeType);
 }
 
 
@@ -7809,20 +7516,19 @@ int smSignalOffGridLeft :: GetSubject () const {
 
 void smSignalOffGridLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smSignalOffGridLeft::sMessageIndex = index;
-	smSignalOffGridLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSignalOffGridLeft::sNoticeType, index, scope);
 }
 
 
 int smSignalOffGridLeft :: GetMessageIndex () const {
 
-	return smSignalOffGridLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSignalOffGridLeft::sNoticeType);
 }
 
 
 int smSignalOffGridLeft :: GetScope () const {
 
-	return smSignalOffGridLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSignalOffGridLeft::sNoticeType);
 }
 
 
@@ -7869,20 +7575,19 @@ int smSignalOffGridRight :: GetSubject () const {
 
 void smSignalOffGridRight :: SetIndexAndScope (int index, int scope) const {
 
-	smSignalOffGridRight::sMessageIndex = index;
-	smSignalOffGridRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSignalOffGridRight::sNoticeType, index, scope);
 }
 
 
 int smSignalOffGridRight :: GetMessageIndex () const {
 
-	return smSignalOffGridRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSignalOffGridRight::sNoticeType);
 }
 
 
 int smSignalOffGridRight :: GetScope () const {
 
-	return smSignalOffGridRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSignalOffGridRight::sNoticeType);
 }
 
 
@@ -7929,20 +7634,19 @@ int sm0UnambiguousPeaksLeft :: GetSubject () const {
 
 void sm0UnambiguousPeaksLeft :: SetIndexAndScope (int index, int scope) const {
 
-	sm0UnambiguousPeaksLeft::sMessageIndex = index;
-	sm0UnambiguousPeaksLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm0UnambiguousPeaksLeft::sNoticeType, index, scope);
 }
 
 
 int sm0UnambiguousPeaksLeft :: GetMessageIndex () const {
 
-	return sm0UnambiguousPeaksLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm0UnambiguousPeaksLeft::sNoticeType);
 }
 
 
 int sm0UnambiguousPeaksLeft :: GetScope () const {
 
-	return sm0UnambiguousPeaksLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm0UnambiguousPeaksLeft::sNoticeType);
 }
 
 
@@ -7989,20 +7693,19 @@ int sm0UnambiguousPeaksRight :: GetSubject () const {
 
 void sm0UnambiguousPeaksRight :: SetIndexAndScope (int index, int scope) const {
 
-	sm0UnambiguousPeaksRight::sMessageIndex = index;
-	sm0UnambiguousPeaksRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm0UnambiguousPeaksRight::sNoticeType, index, scope);
 }
 
 
 int sm0UnambiguousPeaksRight :: GetMessageIndex () const {
 
-	return sm0UnambiguousPeaksRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm0UnambiguousPeaksRight::sNoticeType);
 }
 
 
 int sm0UnambiguousPeaksRight :: GetScope () const {
 
-	return sm0UnambiguousPeaksRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm0UnambiguousPeaksRight::sNoticeType);
 }
 
 
@@ -8049,20 +7752,19 @@ int sm1UnambiguousPeakLeft :: GetSubject () const {
 
 void sm1UnambiguousPeakLeft :: SetIndexAndScope (int index, int scope) const {
 
-	sm1UnambiguousPeakLeft::sMessageIndex = index;
-	sm1UnambiguousPeakLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm1UnambiguousPeakLeft::sNoticeType, index, scope);
 }
 
 
 int sm1UnambiguousPeakLeft :: GetMessageIndex () const {
 
-	return sm1UnambiguousPeakLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm1UnambiguousPeakLeft::sNoticeType);
 }
 
 
 int sm1UnambiguousPeakLeft :: GetScope () const {
 
-	return sm1UnambiguousPeakLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm1UnambiguousPeakLeft::sNoticeType);
 }
 
 
@@ -8109,20 +7811,19 @@ int sm1UnambiguousPeakRight :: GetSubject () const {
 
 void sm1UnambiguousPeakRight :: SetIndexAndScope (int index, int scope) const {
 
-	sm1UnambiguousPeakRight::sMessageIndex = index;
-	sm1UnambiguousPeakRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm1UnambiguousPeakRight::sNoticeType, index, scope);
 }
 
 
 int sm1UnambiguousPeakRight :: GetMessageIndex () const {
 
-	return sm1UnambiguousPeakRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm1UnambiguousPeakRight::sNoticeType);
 }
 
 
 int sm1UnambiguousPeakRight :: GetScope () const {
 
-	return sm1UnambiguousPeakRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm1UnambiguousPeakRight::sNoticeType);
 }
 
 
@@ -8169,20 +7870,19 @@ int sm2PlusUnambiguousPeaksLeft :: GetSubject () const {
 
 void sm2PlusUnambiguousPeaksLeft :: SetIndexAndScope (int index, int scope) const {
 
-	sm2PlusUnambiguousPeaksLeft::sMessageIndex = index;
-	sm2PlusUnambiguousPeaksLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm2PlusUnambiguousPeaksLeft::sNoticeType, index, scope);
 }
 
 
 int sm2PlusUnambiguousPeaksLeft :: GetMessageIndex () const {
 
-	return sm2PlusUnambiguousPeaksLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm2PlusUnambiguousPeaksLeft::sNoticeType);
 }
 
 
 int sm2PlusUnambiguousPeaksLeft :: GetScope () const {
 
-	return sm2PlusUnambiguousPeaksLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm2PlusUnambiguousPeaksLeft::sNoticeType);
 }
 
 
@@ -8229,20 +7929,19 @@ int sm2PlusUnambiguousPeaksRight :: GetSubject () const {
 
 void sm2PlusUnambiguousPeaksRight :: SetIndexAndScope (int index, int scope) const {
 
-	sm2PlusUnambiguousPeaksRight::sMessageIndex = index;
-	sm2PlusUnambiguousPeaksRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm2PlusUnambiguousPeaksRight::sNoticeType, index, scope);
 }
 
 
 int sm2PlusUnambiguousPeaksRight :: GetMessageIndex () const {
 
-	return sm2PlusUnambiguousPeaksRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm2PlusUnambiguousPeaksRight::sNoticeType);
 }
 
 
 int sm2PlusUnambiguousPeaksRight :: GetScope () const {
 
-	return sm2PlusUnambiguousPeaksRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm2PlusUnambiguousPeaksRight::sNoticeType);
 }
 
 
@@ -8289,20 +7988,19 @@ int sm0AmbiguousPeaksLeft :: GetSubject () const {
 
 void sm0AmbiguousPeaksLeft :: SetIndexAndScope (int index, int scope) const {
 
-	sm0AmbiguousPeaksLeft::sMessageIndex = index;
-	sm0AmbiguousPeaksLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm0AmbiguousPeaksLeft::sNoticeType, index, scope);
 }
 
 
 int sm0AmbiguousPeaksLeft :: GetMessageIndex () const {
 
-	return sm0AmbiguousPeaksLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm0AmbiguousPeaksLeft::sNoticeType);
 }
 
 
 int sm0AmbiguousPeaksLeft :: GetScope () const {
 
-	return sm0AmbiguousPeaksLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm0AmbiguousPeaksLeft::sNoticeType);
 }
 
 
@@ -8349,20 +8047,19 @@ int sm0AmbiguousPeaksRight :: GetSubject () const {
 
 void sm0AmbiguousPeaksRight :: SetIndexAndScope (int index, int scope) const {
 
-	sm0AmbiguousPeaksRight::sMessageIndex = index;
-	sm0AmbiguousPeaksRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm0AmbiguousPeaksRight::sNoticeType, index, scope);
 }
 
 
 int sm0AmbiguousPeaksRight :: GetMessageIndex () const {
 
-	return sm0AmbiguousPeaksRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm0AmbiguousPeaksRight::sNoticeType);
 }
 
 
 int sm0AmbiguousPeaksRight :: GetScope () const {
 
-	return sm0AmbiguousPeaksRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm0AmbiguousPeaksRight::sNoticeType);
 }
 
 
@@ -8409,20 +8106,19 @@ int sm1AmbiguousPeakLeft :: GetSubject () const {
 
 void sm1AmbiguousPeakLeft :: SetIndexAndScope (int index, int scope) const {
 
-	sm1AmbiguousPeakLeft::sMessageIndex = index;
-	sm1AmbiguousPeakLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm1AmbiguousPeakLeft::sNoticeType, index, scope);
 }
 
 
 int sm1AmbiguousPeakLeft :: GetMessageIndex () const {
 
-	return sm1AmbiguousPeakLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm1AmbiguousPeakLeft::sNoticeType);
 }
 
 
 int sm1AmbiguousPeakLeft :: GetScope () const {
 
-	return sm1AmbiguousPeakLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm1AmbiguousPeakLeft::sNoticeType);
 }
 
 
@@ -8469,20 +8165,19 @@ int sm1AmbiguousPeakRight :: GetSubject () const {
 
 void sm1AmbiguousPeakRight :: SetIndexAndScope (int index, int scope) const {
 
-	sm1AmbiguousPeakRight::sMessageIndex = index;
-	sm1AmbiguousPeakRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm1AmbiguousPeakRight::sNoticeType, index, scope);
 }
 
 
 int sm1AmbiguousPeakRight :: GetMessageIndex () const {
 
-	return sm1AmbiguousPeakRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm1AmbiguousPeakRight::sNoticeType);
 }
 
 
 int sm1AmbiguousPeakRight :: GetScope () const {
 
-	return sm1AmbiguousPeakRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm1AmbiguousPeakRight::sNoticeType);
 }
 
 
@@ -8529,20 +8224,19 @@ int sm2PlusAmbiguousPeaksLeft :: GetSubject () const {
 
 void sm2PlusAmbiguousPeaksLeft :: SetIndexAndScope (int index, int scope) const {
 
-	sm2PlusAmbiguousPeaksLeft::sMessageIndex = index;
-	sm2PlusAmbiguousPeaksLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm2PlusAmbiguousPeaksLeft::sNoticeType, index, scope);
 }
 
 
 int sm2PlusAmbiguousPeaksLeft :: GetMessageIndex () const {
 
-	return sm2PlusAmbiguousPeaksLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm2PlusAmbiguousPeaksLeft::sNoticeType);
 }
 
 
 int sm2PlusAmbiguousPeaksLeft :: GetScope () const {
 
-	return sm2PlusAmbiguousPeaksLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm2PlusAmbiguousPeaksLeft::sNoticeType);
 }
 
 
@@ -8589,20 +8283,19 @@ int sm2PlusAmbiguousPeaksRight :: GetSubject () const {
 
 void sm2PlusAmbiguousPeaksRight :: SetIndexAndScope (int index, int scope) const {
 
-	sm2PlusAmbiguousPeaksRight::sMessageIndex = index;
-	sm2PlusAmbiguousPeaksRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (sm2PlusAmbiguousPeaksRight::sNoticeType, index, scope);
 }
 
 
 int sm2PlusAmbiguousPeaksRight :: GetMessageIndex () const {
 
-	return sm2PlusAmbiguousPeaksRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (sm2PlusAmbiguousPeaksRight::sNoticeType);
 }
 
 
 int sm2PlusAmbiguousPeaksRight :: GetScope () const {
 
-	return sm2PlusAmbiguousPeaksRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (sm2PlusAmbiguousPeaksRight::sNoticeType);
 }
 
 
@@ -8649,20 +8342,19 @@ int smCouldBelongToLocusLeft :: GetSubject () const {
 
 void smCouldBelongToLocusLeft :: SetIndexAndScope (int index, int scope) const {
 
-	smCouldBelongToLocusLeft::sMessageIndex = index;
-	smCouldBelongToLocusLeft::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smCouldBelongToLocusLeft::sNoticeType, index, scope);
 }
 
 
 int smCouldBelongToLocusLeft :: GetMessageIndex () const {
 
-	return smCouldBelongToLocusLeft :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smCouldBelongToLocusLeft::sNoticeType);
 }
 
 
 int smCouldBelongToLocusLeft :: GetScope () const {
 
-	return smCouldBelongToLocusLeft :: sMessageScope;
+	return SmartNotice::GetScopeForType (smCouldBelongToLocusLeft::sNoticeType);
 }
 
 
@@ -8709,20 +8401,19 @@ int smCouldBelongToLocusRight :: GetSubject () const {
 
 void smCouldBelongToLocusRight :: SetIndexAndScope (int index, int scope) const {
 
-	smCouldBelongToLocusRight::sMessageIndex = index;
-	smCouldBelongToLocusRight::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smCouldBelongToLocusRight::sNoticeType, index, scope);
 }
 
 
 int smCouldBelongToLocusRight :: GetMessageIndex () const {
 
-	return smCouldBelongToLocusRight :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smCouldBelongToLocusRight::sNoticeType);
 }
 
 
 int smCouldBelongToLocusRight :: GetScope () const {
 
-	return smCouldBelongToLocusRight :: sMessageScope;
+	return SmartNotice::GetScopeForType (smCouldBelongToLocusRight::sNoticeType);
 }
 
 
@@ -8769,20 +8460,19 @@ int smChannelIsNegControl :: GetSubject () const {
 
 void smChannelIsNegControl :: SetIndexAndScope (int index, int scope) const {
 
-	smChannelIsNegControl::sMessageIndex = index;
-	smChannelIsNegControl::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smChannelIsNegControl::sNoticeType, index, scope);
 }
 
 
 int smChannelIsNegControl :: GetMessageIndex () const {
 
-	return smChannelIsNegControl :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smChannelIsNegControl::sNoticeType);
 }
 
 
 int smChannelIsNegControl :: GetScope () const {
 
-	return smChannelIsNegControl :: sMessageScope;
+	return SmartNotice::GetScopeForType (smChannelIsNegControl::sNoticeType);
 }
 
 
@@ -8829,20 +8519,19 @@ int smLocusIsNegControl :: GetSubject () const {
 
 void smLocusIsNegControl :: SetIndexAndScope (int index, int scope) const {
 
-	smLocusIsNegControl::sMessageIndex = index;
-	smLocusIsNegControl::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLocusIsNegControl::sNoticeType, index, scope);
 }
 
 
 int smLocusIsNegControl :: GetMessageIndex () const {
 
-	return smLocusIsNegControl :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLocusIsNegControl::sNoticeType);
 }
 
 
 int smLocusIsNegControl :: GetScope () const {
 
-	return smLocusIsNegControl :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLocusIsNegControl::sNoticeType);
 }
 
 
@@ -8889,20 +8578,19 @@ int smChannelIsPosControl :: GetSubject () const {
 
 void smChannelIsPosControl :: SetIndexAndScope (int index, int scope) const {
 
-	smChannelIsPosControl::sMessageIndex = index;
-	smChannelIsPosControl::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smChannelIsPosControl::sNoticeType, index, scope);
 }
 
 
 int smChannelIsPosControl :: GetMessageIndex () const {
 
-	return smChannelIsPosControl :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smChannelIsPosControl::sNoticeType);
 }
 
 
 int smChannelIsPosControl :: GetScope () const {
 
-	return smChannelIsPosControl :: sMessageScope;
+	return SmartNotice::GetScopeForType (smChannelIsPosControl::sNoticeType);
 }
 
 
@@ -8949,20 +8637,19 @@ int smLocusIsPosControl :: GetSubject () const {
 
 void smLocusIsPosControl :: SetIndexAndScope (int index, int scope) const {
 
-	smLocusIsPosControl::sMessageIndex = index;
-	smLocusIsPosControl::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLocusIsPosControl::sNoticeType, index, scope);
 }
 
 
 int smLocusIsPosControl :: GetMessageIndex () const {
 
-	return smLocusIsPosControl :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLocusIsPosControl::sNoticeType);
 }
 
 
 int smLocusIsPosControl :: GetScope () const {
 
-	return smLocusIsPosControl :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLocusIsPosControl::sNoticeType);
 }
 
 
@@ -9009,20 +8696,19 @@ int smPurePullup :: GetSubject () const {
 
 void smPurePullup :: SetIndexAndScope (int index, int scope) const {
 
-	smPurePullup::sMessageIndex = index;
-	smPurePullup::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPurePullup::sNoticeType, index, scope);
 }
 
 
 int smPurePullup :: GetMessageIndex () const {
 
-	return smPurePullup :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPurePullup::sNoticeType);
 }
 
 
 int smPurePullup :: GetScope () const {
 
-	return smPurePullup :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPurePullup::sNoticeType);
 }
 
 
@@ -9069,20 +8755,19 @@ int smChannelPeaksHaveCriticalArtifacts :: GetSubject () const {
 
 void smChannelPeaksHaveCriticalArtifacts :: SetIndexAndScope (int index, int scope) const {
 
-	smChannelPeaksHaveCriticalArtifacts::sMessageIndex = index;
-	smChannelPeaksHaveCriticalArtifacts::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smChannelPeaksHaveCriticalArtifacts::sNoticeType, index, scope);
 }
 
 
 int smChannelPeaksHaveCriticalArtifacts :: GetMessageIndex () const {
 
-	return smChannelPeaksHaveCriticalArtifacts :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smChannelPeaksHaveCriticalArtifacts::sNoticeType);
 }
 
 
 int smChannelPeaksHaveCriticalArtifacts :: GetScope () const {
 
-	return smChannelPeaksHaveCriticalArtifacts :: sMessageScope;
+	return SmartNotice::GetScopeForType (smChannelPeaksHaveCriticalArtifacts::sNoticeType);
 }
 
 
@@ -9129,20 +8814,19 @@ int smPreliminaryLocusHas2OrMoreAlleles :: GetSubject () const {
 
 void smPreliminaryLocusHas2OrMoreAlleles :: SetIndexAndScope (int index, int scope) const {
 
-	smPreliminaryLocusHas2OrMoreAlleles::sMessageIndex = index;
-	smPreliminaryLocusHas2OrMoreAlleles::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPreliminaryLocusHas2OrMoreAlleles::sNoticeType, index, scope);
 }
 
 
 int smPreliminaryLocusHas2OrMoreAlleles :: GetMessageIndex () const {
 
-	return smPreliminaryLocusHas2OrMoreAlleles :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPreliminaryLocusHas2OrMoreAlleles::sNoticeType);
 }
 
 
 int smPreliminaryLocusHas2OrMoreAlleles :: GetScope () const {
 
-	return smPreliminaryLocusHas2OrMoreAlleles :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPreliminaryLocusHas2OrMoreAlleles::sNoticeType);
 }
 
 
@@ -9189,20 +8873,19 @@ int smCraterSidePeak :: GetSubject () const {
 
 void smCraterSidePeak :: SetIndexAndScope (int index, int scope) const {
 
-	smCraterSidePeak::sMessageIndex = index;
-	smCraterSidePeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smCraterSidePeak::sNoticeType, index, scope);
 }
 
 
 int smCraterSidePeak :: GetMessageIndex () const {
 
-	return smCraterSidePeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smCraterSidePeak::sNoticeType);
 }
 
 
 int smCraterSidePeak :: GetScope () const {
 
-	return smCraterSidePeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smCraterSidePeak::sNoticeType);
 }
 
 
@@ -9249,20 +8932,19 @@ int smSignalNotACrater :: GetSubject () const {
 
 void smSignalNotACrater :: SetIndexAndScope (int index, int scope) const {
 
-	smSignalNotACrater::sMessageIndex = index;
-	smSignalNotACrater::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSignalNotACrater::sNoticeType, index, scope);
 }
 
 
 int smSignalNotACrater :: GetMessageIndex () const {
 
-	return smSignalNotACrater :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSignalNotACrater::sNoticeType);
 }
 
 
 int smSignalNotACrater :: GetScope () const {
 
-	return smSignalNotACrater :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSignalNotACrater::sNoticeType);
 }
 
 
@@ -9309,20 +8991,19 @@ int smSignalNotACraterSidePeak :: GetSubject () const {
 
 void smSignalNotACraterSidePeak :: SetIndexAndScope (int index, int scope) const {
 
-	smSignalNotACraterSidePeak::sMessageIndex = index;
-	smSignalNotACraterSidePeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSignalNotACraterSidePeak::sNoticeType, index, scope);
 }
 
 
 int smSignalNotACraterSidePeak :: GetMessageIndex () const {
 
-	return smSignalNotACraterSidePeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSignalNotACraterSidePeak::sNoticeType);
 }
 
 
 int smSignalNotACraterSidePeak :: GetScope () const {
 
-	return smSignalNotACraterSidePeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSignalNotACraterSidePeak::sNoticeType);
 }
 
 
@@ -9369,20 +9050,19 @@ int smLocusIsHomozygous :: GetSubject () const {
 
 void smLocusIsHomozygous :: SetIndexAndScope (int index, int scope) const {
 
-	smLocusIsHomozygous::sMessageIndex = index;
-	smLocusIsHomozygous::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLocusIsHomozygous::sNoticeType, index, scope);
 }
 
 
 int smLocusIsHomozygous :: GetMessageIndex () const {
 
-	return smLocusIsHomozygous :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLocusIsHomozygous::sNoticeType);
 }
 
 
 int smLocusIsHomozygous :: GetScope () const {
 
-	return smLocusIsHomozygous :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLocusIsHomozygous::sNoticeType);
 }
 
 
@@ -9429,20 +9109,19 @@ int smLocusMissingGenotype :: GetSubject () const {
 
 void smLocusMissingGenotype :: SetIndexAndScope (int index, int scope) const {
 
-	smLocusMissingGenotype::sMessageIndex = index;
-	smLocusMissingGenotype::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLocusMissingGenotype::sNoticeType, index, scope);
 }
 
 
 int smLocusMissingGenotype :: GetMessageIndex () const {
 
-	return smLocusMissingGenotype :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLocusMissingGenotype::sNoticeType);
 }
 
 
 int smLocusMissingGenotype :: GetScope () const {
 
-	return smLocusMissingGenotype :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLocusMissingGenotype::sNoticeType);
 }
 
 
@@ -9489,20 +9168,19 @@ int smStage4Successful :: GetSubject () const {
 
 void smStage4Successful :: SetIndexAndScope (int index, int scope) const {
 
-	smStage4Successful::sMessageIndex = index;
-	smStage4Successful::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smStage4Successful::sNoticeType, index, scope);
 }
 
 
 int smStage4Successful :: GetMessageIndex () const {
 
-	return smStage4Successful :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smStage4Successful::sNoticeType);
 }
 
 
 int smStage4Successful :: GetScope () const {
 
-	return smStage4Successful :: sMessageScope;
+	return SmartNotice::GetScopeForType (smStage4Successful::sNoticeType);
 }
 
 
@@ -9549,20 +9227,19 @@ int smStage5Successful :: GetSubject () const {
 
 void smStage5Successful :: SetIndexAndScope (int index, int scope) const {
 
-	smStage5Successful::sMessageIndex = index;
-	smStage5Successful::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smStage5Successful::sNoticeType, index, scope);
 }
 
 
 int smStage5Successful :: GetMessageIndex () const {
 
-	return smStage5Successful :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smStage5Successful::sNoticeType);
 }
 
 
 int smStage5Successful :: GetScope () const {
 
-	return smStage5Successful :: sMessageScope;
+	return SmartNotice::GetScopeForType (smStage5Successful::sNoticeType);
 }
 
 
@@ -9609,20 +9286,19 @@ int smPeakInCoreLadderLocus :: GetSubject () const {
 
 void smPeakInCoreLadderLocus :: SetIndexAndScope (int index, int scope) const {
 
-	smPeakInCoreLadderLocus::sMessageIndex = index;
-	smPeakInCoreLadderLocus::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPeakInCoreLadderLocus::sNoticeType, index, scope);
 }
 
 
 int smPeakInCoreLadderLocus :: GetMessageIndex () const {
 
-	return smPeakInCoreLadderLocus :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPeakInCoreLadderLocus::sNoticeType);
 }
 
 
 int smPeakInCoreLadderLocus :: GetScope () const {
 
-	return smPeakInCoreLadderLocus :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPeakInCoreLadderLocus::sNoticeType);
 }
 
 
@@ -9669,20 +9345,19 @@ int smPeakAboveOverloadLimit :: GetSubject () const {
 
 void smPeakAboveOverloadLimit :: SetIndexAndScope (int index, int scope) const {
 
-	smPeakAboveOverloadLimit::sMessageIndex = index;
-	smPeakAboveOverloadLimit::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPeakAboveOverloadLimit::sNoticeType, index, scope);
 }
 
 
 int smPeakAboveOverloadLimit :: GetMessageIndex () const {
 
-	return smPeakAboveOverloadLimit :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPeakAboveOverloadLimit::sNoticeType);
 }
 
 
 int smPeakAboveOverloadLimit :: GetScope () const {
 
-	return smPeakAboveOverloadLimit :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPeakAboveOverloadLimit::sNoticeType);
 }
 
 
@@ -9729,20 +9404,19 @@ int smRestrictedPriorityPeak :: GetSubject () const {
 
 void smRestrictedPriorityPeak :: SetIndexAndScope (int index, int scope) const {
 
-	smRestrictedPriorityPeak::sMessageIndex = index;
-	smRestrictedPriorityPeak::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smRestrictedPriorityPeak::sNoticeType, index, scope);
 }
 
 
 int smRestrictedPriorityPeak :: GetMessageIndex () const {
 
-	return smRestrictedPriorityPeak :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smRestrictedPriorityPeak::sNoticeType);
 }
 
 
 int smRestrictedPriorityPeak :: GetScope () const {
 
-	return smRestrictedPriorityPeak :: sMessageScope;
+	return SmartNotice::GetScopeForType (smRestrictedPriorityPeak::sNoticeType);
 }
 
 
@@ -9789,20 +9463,19 @@ int smChannelIsILS :: GetSubject () const {
 
 void smChannelIsILS :: SetIndexAndScope (int index, int scope) const {
 
-	smChannelIsILS::sMessageIndex = index;
-	smChannelIsILS::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smChannelIsILS::sNoticeType, index, scope);
 }
 
 
 int smChannelIsILS :: GetMessageIndex () const {
 
-	return smChannelIsILS :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smChannelIsILS::sNoticeType);
 }
 
 
 int smChannelIsILS :: GetScope () const {
 
-	return smChannelIsILS :: sMessageScope;
+	return SmartNotice::GetScopeForType (smChannelIsILS::sNoticeType);
 }
 
 
@@ -9849,20 +9522,19 @@ int smILSSpacingIsMarginal :: GetSubject () const {
 
 void smILSSpacingIsMarginal :: SetIndexAndScope (int index, int scope) const {
 
-	smILSSpacingIsMarginal::sMessageIndex = index;
-	smILSSpacingIsMarginal::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smILSSpacingIsMarginal::sNoticeType, index, scope);
 }
 
 
 int smILSSpacingIsMarginal :: GetMessageIndex () const {
 
-	return smILSSpacingIsMarginal :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smILSSpacingIsMarginal::sNoticeType);
 }
 
 
 int smILSSpacingIsMarginal :: GetScope () const {
 
-	return smILSSpacingIsMarginal :: sMessageScope;
+	return SmartNotice::GetScopeForType (smILSSpacingIsMarginal::sNoticeType);
 }
 
 
@@ -9909,20 +9581,19 @@ int smPoorPeakMorphologyOrResolution :: GetSubject () const {
 
 void smPoorPeakMorphologyOrResolution :: SetIndexAndScope (int index, int scope) const {
 
-	smPoorPeakMorphologyOrResolution::sMessageIndex = index;
-	smPoorPeakMorphologyOrResolution::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPoorPeakMorphologyOrResolution::sNoticeType, index, scope);
 }
 
 
 int smPoorPeakMorphologyOrResolution :: GetMessageIndex () const {
 
-	return smPoorPeakMorphologyOrResolution :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPoorPeakMorphologyOrResolution::sNoticeType);
 }
 
 
 int smPoorPeakMorphologyOrResolution :: GetScope () const {
 
-	return smPoorPeakMorphologyOrResolution :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPoorPeakMorphologyOrResolution::sNoticeType);
 }
 
 
@@ -9969,20 +9640,19 @@ int smPeakToRightOfILS :: GetSubject () const {
 
 void smPeakToRightOfILS :: SetIndexAndScope (int index, int scope) const {
 
-	smPeakToRightOfILS::sMessageIndex = index;
-	smPeakToRightOfILS::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPeakToRightOfILS::sNoticeType, index, scope);
 }
 
 
 int smPeakToRightOfILS :: GetMessageIndex () const {
 
-	return smPeakToRightOfILS :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPeakToRightOfILS::sNoticeType);
 }
 
 
 int smPeakToRightOfILS :: GetScope () const {
 
-	return smPeakToRightOfILS :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPeakToRightOfILS::sNoticeType);
 }
 
 
@@ -10029,20 +9699,19 @@ int smPreliminaryLocusHasNoAlleles :: GetSubject () const {
 
 void smPreliminaryLocusHasNoAlleles :: SetIndexAndScope (int index, int scope) const {
 
-	smPreliminaryLocusHasNoAlleles::sMessageIndex = index;
-	smPreliminaryLocusHasNoAlleles::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPreliminaryLocusHasNoAlleles::sNoticeType, index, scope);
 }
 
 
 int smPreliminaryLocusHasNoAlleles :: GetMessageIndex () const {
 
-	return smPreliminaryLocusHasNoAlleles :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPreliminaryLocusHasNoAlleles::sNoticeType);
 }
 
 
 int smPreliminaryLocusHasNoAlleles :: GetScope () const {
 
-	return smPreliminaryLocusHasNoAlleles :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPreliminaryLocusHasNoAlleles::sNoticeType);
 }
 
 
@@ -10089,20 +9758,19 @@ int smLocusHasPeaksBetweenDetectionAndAnalysisThresholds :: GetSubject () const
 
 void smLocusHasPeaksBetweenDetectionAndAnalysisThresholds :: SetIndexAndScope (int index, int scope) const {
 
-	smLocusHasPeaksBetweenDetectionAndAnalysisThresholds::sMessageIndex = index;
-	smLocusHasPeaksBetweenDetectionAndAnalysisThresholds::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLocusHasPeaksBetweenDetectionAndAnalysisThresholds::sNoticeType, index, scope);
 }
 
 
 int smLocusHasPeaksBetweenDetectionAndAnalysisThresholds :: GetMessageIndex () const {
 
-	return smLocusHasPeaksBetweenDetectionAndAnalysisThresholds :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLocusHasPeaksBetweenDetectionAndAnalysisThresholds::sNoticeType);
 }
 
 
 int smLocusHasPeaksBetweenDetectionAndAnalysisThresholds :: GetScope () const {
 
-	return smLocusHasPeaksBetweenDetectionAndAnalysisThresholds :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLocusHasPeaksBetweenDetectionAndAnalysisThresholds::sNoticeType);
 }
 
 
@@ -10149,20 +9817,19 @@ int smUnexpectedNoOfGridPeaks :: GetSubject () const {
 
 void smUnexpectedNoOfGridPeaks :: SetIndexAndScope (int index, int scope) const {
 
-	smUnexpectedNoOfGridPeaks::sMessageIndex = index;
-	smUnexpectedNoOfGridPeaks::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smUnexpectedNoOfGridPeaks::sNoticeType, index, scope);
 }
 
 
 int smUnexpectedNoOfGridPeaks :: GetMessageIndex () const {
 
-	return smUnexpectedNoOfGridPeaks :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smUnexpectedNoOfGridPeaks::sNoticeType);
 }
 
 
 int smUnexpectedNoOfGridPeaks :: GetScope () const {
 
-	return smUnexpectedNoOfGridPeaks :: sMessageScope;
+	return SmartNotice::GetScopeForType (smUnexpectedNoOfGridPeaks::sNoticeType);
 }
 
 
@@ -10209,20 +9876,19 @@ int smMoreThanThreeAlleles :: GetSubject () const {
 
 void smMoreThanThreeAlleles :: SetIndexAndScope (int index, int scope) const {
 
-	smMoreThanThreeAlleles::sMessageIndex = index;
-	smMoreThanThreeAlleles::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smMoreThanThreeAlleles::sNoticeType, index, scope);
 }
 
 
 int smMoreThanThreeAlleles :: GetMessageIndex () const {
 
-	return smMoreThanThreeAlleles :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smMoreThanThreeAlleles::sNoticeType);
 }
 
 
 int smMoreThanThreeAlleles :: GetScope () const {
 
-	return smMoreThanThreeAlleles :: sMessageScope;
+	return SmartNotice::GetScopeForType (smMoreThanThreeAlleles::sNoticeType);
 }
 
 
@@ -10269,20 +9935,19 @@ int smDefaultsAreOverridden :: GetSubject () const {
 
 void smDefaultsAreOverridden :: SetIndexAndScope (int index, int scope) const {
 
-	smDefaultsAreOverridden::sMessageIndex = index;
-	smDefaultsAreOverridden::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smDefaultsAreOverridden::sNoticeType, index, scope);
 }
 
 
 int smDefaultsAreOverridden :: GetMessageIndex () const {
 
-	return smDefaultsAreOverridden :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smDefaultsAreOverridden::sNoticeType);
 }
 
 
 int smDefaultsAreOverridden :: GetScope () const {
 
-	return smDefaultsAreOverridden :: sMessageScope;
+	return SmartNotice::GetScopeForType (smDefaultsAreOverridden::sNoticeType);
 }
 
 
@@ -10329,20 +9994,19 @@ int smLaserOffScalePullupOrCraterNotPrimary :: GetSubject () const {
 
 void smLaserOffScalePullupOrCraterNotPrimary :: SetIndexAndScope (int index, int scope) const {
 
-	smLaserOffScalePullupOrCraterNotPrimary::sMessageIndex = index;
-	smLaserOffScalePullupOrCraterNotPrimary::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLaserOffScalePullupOrCraterNotPrimary::sNoticeType, index, scope);
 }
 
 
 int smLaserOffScalePullupOrCraterNotPrimary :: GetMessageIndex () const {
 
-	return smLaserOffScalePullupOrCraterNotPrimary :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLaserOffScalePullupOrCraterNotPrimary::sNoticeType);
 }
 
 
 int smLaserOffScalePullupOrCraterNotPrimary :: GetScope () const {
 
-	return smLaserOffScalePullupOrCraterNotPrimary :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLaserOffScalePullupOrCraterNotPrimary::sNoticeType);
 }
 
 
@@ -10389,20 +10053,19 @@ int smLaserOffScalePrimary :: GetSubject () const {
 
 void smLaserOffScalePrimary :: SetIndexAndScope (int index, int scope) const {
 
-	smLaserOffScalePrimary::sMessageIndex = index;
-	smLaserOffScalePrimary::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLaserOffScalePrimary::sNoticeType, index, scope);
 }
 
 
 int smLaserOffScalePrimary :: GetMessageIndex () const {
 
-	return smLaserOffScalePrimary :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLaserOffScalePrimary::sNoticeType);
 }
 
 
 int smLaserOffScalePrimary :: GetScope () const {
 
-	return smLaserOffScalePrimary :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLaserOffScalePrimary::sNoticeType);
 }
 
 
@@ -10449,20 +10112,19 @@ int smLaserOffScaleNoInterchannelLink :: GetSubject () const {
 
 void smLaserOffScaleNoInterchannelLink :: SetIndexAndScope (int index, int scope) const {
 
-	smLaserOffScaleNoInterchannelLink::sMessageIndex = index;
-	smLaserOffScaleNoInterchannelLink::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLaserOffScaleNoInterchannelLink::sNoticeType, index, scope);
 }
 
 
 int smLaserOffScaleNoInterchannelLink :: GetMessageIndex () const {
 
-	return smLaserOffScaleNoInterchannelLink :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLaserOffScaleNoInterchannelLink::sNoticeType);
 }
 
 
 int smLaserOffScaleNoInterchannelLink :: GetScope () const {
 
-	return smLaserOffScaleNoInterchannelLink :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLaserOffScaleNoInterchannelLink::sNoticeType);
 }
 
 
@@ -10509,20 +10171,19 @@ int smAssociatedLadderIsCritical :: GetSubject () const {
 
 void smAssociatedLadderIsCritical :: SetIndexAndScope (int index, int scope) const {
 
-	smAssociatedLadderIsCritical::sMessageIndex = index;
-	smAssociatedLadderIsCritical::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smAssociatedLadderIsCritical::sNoticeType, index, scope);
 }
 
 
 int smAssociatedLadderIsCritical :: GetMessageIndex () const {
 
-	return smAssociatedLadderIsCritical :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smAssociatedLadderIsCritical::sNoticeType);
 }
 
 
 int smAssociatedLadderIsCritical :: GetScope () const {
 
-	return smAssociatedLadderIsCritical :: sMessageScope;
+	return SmartNotice::GetScopeForType (smAssociatedLadderIsCritical::sNoticeType);
 }
 
 
@@ -10569,20 +10230,19 @@ int smAssociatedLadderLocusIsCritical :: GetSubject () const {
 
 void smAssociatedLadderLocusIsCritical :: SetIndexAndScope (int index, int scope) const {
 
-	smAssociatedLadderLocusIsCritical::sMessageIndex = index;
-	smAssociatedLadderLocusIsCritical::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smAssociatedLadderLocusIsCritical::sNoticeType, index, scope);
 }
 
 
 int smAssociatedLadderLocusIsCritical :: GetMessageIndex () const {
 
-	return smAssociatedLadderLocusIsCritical :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smAssociatedLadderLocusIsCritical::sNoticeType);
 }
 
 
 int smAssociatedLadderLocusIsCritical :: GetScope () const {
 
-	return smAssociatedLadderLocusIsCritical :: sMessageScope;
+	return SmartNotice::GetScopeForType (smAssociatedLadderLocusIsCritical::sNoticeType);
 }
 
 
@@ -10629,20 +10289,19 @@ int smChannelHasRaisedBaseline :: GetSubject () const {
 
 void smChannelHasRaisedBaseline :: SetIndexAndScope (int index, int scope) const {
 
-	smChannelHasRaisedBaseline::sMessageIndex = index;
-	smChannelHasRaisedBaseline::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smChannelHasRaisedBaseline::sNoticeType, index, scope);
 }
 
 
 int smChannelHasRaisedBaseline :: GetMessageIndex () const {
 
-	return smChannelHasRaisedBaseline :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smChannelHasRaisedBaseline::sNoticeType);
 }
 
 
 int smChannelHasRaisedBaseline :: GetScope () const {
 
-	return smChannelHasRaisedBaseline :: sMessageScope;
+	return SmartNotice::GetScopeForType (smChannelHasRaisedBaseline::sNoticeType);
 }
 
 
@@ -10689,20 +10348,19 @@ int smChannelHasExcessiveNoiseAboveAnalysisThreshold :: GetSubject () const {
 
 void smChannelHasExcessiveNoiseAboveAnalysisThreshold :: SetIndexAndScope (int index, int scope) const {
 
-	smChannelHasExcessiveNoiseAboveAnalysisThreshold::sMessageIndex = index;
-	smChannelHasExcessiveNoiseAboveAnalysisThreshold::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smChannelHasExcessiveNoiseAboveAnalysisThreshold::sNoticeType, index, scope);
 }
 
 
 int smChannelHasExcessiveNoiseAboveAnalysisThreshold :: GetMessageIndex () const {
 
-	return smChannelHasExcessiveNoiseAboveAnalysisThreshold :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smChannelHasExcessiveNoiseAboveAnalysisThreshold::sNoticeType);
 }
 
 
 int smChannelHasExcessiveNoiseAboveAnalysisThreshold :: GetScope () const {
 
-	return smChannelHasExcessiveNoiseAboveAnalysisThreshold :: sMessageScope;
+	return SmartNotice::GetScopeForType (smChannelHasExcessiveNoiseAboveAnalysisThreshold::sNoticeType);
 }
 
 
@@ -10749,20 +10407,19 @@ int smChannelHasExcessiveNoiseAboveDetectionThreshold :: GetSubject () const {
 
 void smChannelHasExcessiveNoiseAboveDetectionThreshold :: SetIndexAndScope (int index, int scope) const {
 
-	smChannelHasExcessiveNoiseAboveDetectionThreshold::sMessageIndex = index;
-	smChannelHasExcessiveNoiseAboveDetectionThreshold::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smChannelHasExcessiveNoiseAboveDetectionThreshold::sNoticeType, index, scope);
 }
 
 
 int smChannelHasExcessiveNoiseAboveDetectionThreshold :: GetMessageIndex () const {
 
-	return smChannelHasExcessiveNoiseAboveDetectionThreshold :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smChannelHasExcessiveNoiseAboveDetectionThreshold::sNoticeType);
 }
 
 
 int smChannelHasExcessiveNoiseAboveDetectionThreshold :: GetScope () const {
 
-	return smChannelHasExcessiveNoiseAboveDetectionThreshold :: sMessageScope;
+	return SmartNotice::GetScopeForType (smChannelHasExcessiveNoiseAboveDetectionThreshold::sNoticeType);
 }
 
 
@@ -10809,20 +10466,19 @@ int smSampleChannelRaisedBaselineThreshold :: GetSubject () const {
 
 void smSampleChannelRaisedBaselineThreshold :: SetIndexAndScope (int index, int scope) const {
 
-	smSampleChannelRaisedBaselineThreshold::sMessageIndex = index;
-	smSampleChannelRaisedBaselineThreshold::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSampleChannelRaisedBaselineThreshold::sNoticeType, index, scope);
 }
 
 
 int smSampleChannelRaisedBaselineThreshold :: GetMessageIndex () const {
 
-	return smSampleChannelRaisedBaselineThreshold :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSampleChannelRaisedBaselineThreshold::sNoticeType);
 }
 
 
 int smSampleChannelRaisedBaselineThreshold :: GetScope () const {
 
-	return smSampleChannelRaisedBaselineThreshold :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSampleChannelRaisedBaselineThreshold::sNoticeType);
 }
 
 
@@ -10869,20 +10525,19 @@ int smSampleILSChannelRaisedBaselineThreshold :: GetSubject () const {
 
 void smSampleILSChannelRaisedBaselineThreshold :: SetIndexAndScope (int index, int scope) const {
 
-	smSampleILSChannelRaisedBaselineThreshold::sMessageIndex = index;
-	smSampleILSChannelRaisedBaselineThreshold::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSampleILSChannelRaisedBaselineThreshold::sNoticeType, index, scope);
 }
 
 
 int smSampleILSChannelRaisedBaselineThreshold :: GetMessageIndex () const {
 
-	return smSampleILSChannelRaisedBaselineThreshold :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSampleILSChannelRaisedBaselineThreshold::sNoticeType);
 }
 
 
 int smSampleILSChannelRaisedBaselineThreshold :: GetScope () const {
 
-	return smSampleILSChannelRaisedBaselineThreshold :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSampleILSChannelRaisedBaselineThreshold::sNoticeType);
 }
 
 
@@ -10929,20 +10584,19 @@ int smILSPeakMayBeIncorrect :: GetSubject () const {
 
 void smILSPeakMayBeIncorrect :: SetIndexAndScope (int index, int scope) const {
 
-	smILSPeakMayBeIncorrect::sMessageIndex = index;
-	smILSPeakMayBeIncorrect::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smILSPeakMayBeIncorrect::sNoticeType, index, scope);
 }
 
 
 int smILSPeakMayBeIncorrect :: GetMessageIndex () const {
 
-	return smILSPeakMayBeIncorrect :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smILSPeakMayBeIncorrect::sNoticeType);
 }
 
 
 int smILSPeakMayBeIncorrect :: GetScope () const {
 
-	return smILSPeakMayBeIncorrect :: sMessageScope;
+	return SmartNotice::GetScopeForType (smILSPeakMayBeIncorrect::sNoticeType);
 }
 
 
@@ -10989,20 +10643,19 @@ int smTestForColorCorrectionMatrixPreset :: GetSubject () const {
 
 void smTestForColorCorrectionMatrixPreset :: SetIndexAndScope (int index, int scope) const {
 
-	smTestForColorCorrectionMatrixPreset::sMessageIndex = index;
-	smTestForColorCorrectionMatrixPreset::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smTestForColorCorrectionMatrixPreset::sNoticeType, index, scope);
 }
 
 
 int smTestForColorCorrectionMatrixPreset :: GetMessageIndex () const {
 
-	return smTestForColorCorrectionMatrixPreset :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smTestForColorCorrectionMatrixPreset::sNoticeType);
 }
 
 
 int smTestForColorCorrectionMatrixPreset :: GetScope () const {
 
-	return smTestForColorCorrectionMatrixPreset :: sMessageScope;
+	return SmartNotice::GetScopeForType (smTestForColorCorrectionMatrixPreset::sNoticeType);
 }
 
 
@@ -11049,20 +10702,19 @@ int smColorCorrectionMatrixExpectedButNotFound :: GetSubject () const {
 
 void smColorCorrectionMatrixExpectedButNotFound :: SetIndexAndScope (int index, int scope) const {
 
-	smColorCorrectionMatrixExpectedButNotFound::sMessageIndex = index;
-	smColorCorrectionMatrixExpectedButNotFound::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smColorCorrectionMatrixExpectedButNotFound::sNoticeType, index, scope);
 }
 
 
 int smColorCorrectionMatrixExpectedButNotFound :: GetMessageIndex () const {
 
-	return smColorCorrectionMatrixExpectedButNotFound :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smColorCorrectionMatrixExpectedButNotFound::sNoticeType);
 }
 
 
 int smColorCorrectionMatrixExpectedButNotFound :: GetScope () const {
 
-	return smColorCorrectionMatrixExpectedButNotFound :: sMessageScope;
+	return SmartNotice::GetScopeForType (smColorCorrectionMatrixExpectedButNotFound::sNoticeType);
 }
 
 
@@ -11109,20 +10761,19 @@ int smColorCorrectionMatrixWrongSize :: GetSubject () const {
 
 void smColorCorrectionMatrixWrongSize :: SetIndexAndScope (int index, int scope) const {
 
-	smColorCorrectionMatrixWrongSize::sMessageIndex = index;
-	smColorCorrectionMatrixWrongSize::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smColorCorrectionMatrixWrongSize::sNoticeType, index, scope);
 }
 
 
 int smColorCorrectionMatrixWrongSize :: GetMessageIndex () const {
 
-	return smColorCorrectionMatrixWrongSize :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smColorCorrectionMatrixWrongSize::sNoticeType);
 }
 
 
 int smColorCorrectionMatrixWrongSize :: GetScope () const {
 
-	return smColorCorrectionMatrixWrongSize :: sMessageScope;
+	return SmartNotice::GetScopeForType (smColorCorrectionMatrixWrongSize::sNoticeType);
 }
 
 
@@ -11169,20 +10820,19 @@ int smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing :: GetSubject () con
 
 void smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing :: SetIndexAndScope (int index, int scope) const {
 
-	smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing::sMessageIndex = index;
-	smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing::sNoticeType, index, scope);
 }
 
 
 int smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing :: GetMessageIndex () const {
 
-	return smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing::sNoticeType);
 }
 
 
 int smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing :: GetScope () const {
 
-	return smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing :: sMessageScope;
+	return SmartNotice::GetScopeForType (smIgnoreNoiseAnalysisAboveDetectionThresholdInSmoothing::sNoticeType);
 }
 
 
@@ -11229,20 +10879,19 @@ int smMinimumNumberOfPrimerPeaksForNegativeControlChannel :: GetSubject () const
 
 void smMinimumNumberOfPrimerPeaksForNegativeControlChannel :: SetIndexAndScope (int index, int scope) const {
 
-	smMinimumNumberOfPrimerPeaksForNegativeControlChannel::sMessageIndex = index;
-	smMinimumNumberOfPrimerPeaksForNegativeControlChannel::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smMinimumNumberOfPrimerPeaksForNegativeControlChannel::sNoticeType, index, scope);
 }
 
 
 int smMinimumNumberOfPrimerPeaksForNegativeControlChannel :: GetMessageIndex () const {
 
-	return smMinimumNumberOfPrimerPeaksForNegativeControlChannel :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smMinimumNumberOfPrimerPeaksForNegativeControlChannel::sNoticeType);
 }
 
 
 int smMinimumNumberOfPrimerPeaksForNegativeControlChannel :: GetScope () const {
 
-	return smMinimumNumberOfPrimerPeaksForNegativeControlChannel :: sMessageScope;
+	return SmartNotice::GetScopeForType (smMinimumNumberOfPrimerPeaksForNegativeControlChannel::sNoticeType);
 }
 
 
@@ -11289,20 +10938,19 @@ int smUseSampleNamesForControlSampleTestsPreset :: GetSubject () const {
 
 void smUseSampleNamesForControlSampleTestsPreset :: SetIndexAndScope (int index, int scope) const {
 
-	smUseSampleNamesForControlSampleTestsPreset::sMessageIndex = index;
-	smUseSampleNamesForControlSampleTestsPreset::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smUseSampleNamesForControlSampleTestsPreset::sNoticeType, index, scope);
 }
 
 
 int smUseSampleNamesForControlSampleTestsPreset :: GetMessageIndex () const {
 
-	return smUseSampleNamesForControlSampleTestsPreset :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smUseSampleNamesForControlSampleTestsPreset::sNoticeType);
 }
 
 
 int smUseSampleNamesForControlSampleTestsPreset :: GetScope () const {
 
-	return smUseSampleNamesForControlSampleTestsPreset :: sMessageScope;
+	return SmartNotice::GetScopeForType (smUseSampleNamesForControlSampleTestsPreset::sNoticeType);
 }
 
 
@@ -11349,20 +10997,19 @@ int smNoYForAMEL :: GetSubject () const {
 
 void smNoYForAMEL :: SetIndexAndScope (int index, int scope) const {
 
-	smNoYForAMEL::sMessageIndex = index;
-	smNoYForAMEL::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNoYForAMEL::sNoticeType, index, scope);
 }
 
 
 int smNoYForAMEL :: GetMessageIndex () const {
 
-	return smNoYForAMEL :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNoYForAMEL::sNoticeType);
 }
 
 
 int smNoYForAMEL :: GetScope () const {
 
-	return smNoYForAMEL :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNoYForAMEL::sNoticeType);
 }
 
 
@@ -11409,20 +11056,19 @@ int smLocusIsYLinked :: GetSubject () const {
 
 void smLocusIsYLinked :: SetIndexAndScope (int index, int scope) const {
 
-	smLocusIsYLinked::sMessageIndex = index;
-	smLocusIsYLinked::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLocusIsYLinked::sNoticeType, index, scope);
 }
 
 
 int smLocusIsYLinked :: GetMessageIndex () const {
 
-	return smLocusIsYLinked :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLocusIsYLinked::sNoticeType);
 }
 
 
 int smLocusIsYLinked :: GetScope () const {
 
-	return smLocusIsYLinked :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLocusIsYLinked::sNoticeType);
 }
 
 
@@ -11469,20 +11115,19 @@ int smNumberAllelesBelowExpectation :: GetSubject () const {
 
 void smNumberAllelesBelowExpectation :: SetIndexAndScope (int index, int scope) const {
 
-	smNumberAllelesBelowExpectation::sMessageIndex = index;
-	smNumberAllelesBelowExpectation::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNumberAllelesBelowExpectation::sNoticeType, index, scope);
 }
 
 
 int smNumberAllelesBelowExpectation :: GetMessageIndex () const {
 
-	return smNumberAllelesBelowExpectation :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNumberAllelesBelowExpectation::sNoticeType);
 }
 
 
 int smNumberAllelesBelowExpectation :: GetScope () const {
 
-	return smNumberAllelesBelowExpectation :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNumberAllelesBelowExpectation::sNoticeType);
 }
 
 
@@ -11529,20 +11174,19 @@ int smBaselineRelativeStutter :: GetSubject () const {
 
 void smBaselineRelativeStutter :: SetIndexAndScope (int index, int scope) const {
 
-	smBaselineRelativeStutter::sMessageIndex = index;
-	smBaselineRelativeStutter::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBaselineRelativeStutter::sNoticeType, index, scope);
 }
 
 
 int smBaselineRelativeStutter :: GetMessageIndex () const {
 
-	return smBaselineRelativeStutter :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBaselineRelativeStutter::sNoticeType);
 }
 
 
 int smBaselineRelativeStutter :: GetScope () const {
 
-	return smBaselineRelativeStutter :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBaselineRelativeStutter::sNoticeType);
 }
 
 
@@ -11589,20 +11233,19 @@ int smBaselineRelativeAdenylation :: GetSubject () const {
 
 void smBaselineRelativeAdenylation :: SetIndexAndScope (int index, int scope) const {
 
-	smBaselineRelativeAdenylation::sMessageIndex = index;
-	smBaselineRelativeAdenylation::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBaselineRelativeAdenylation::sNoticeType, index, scope);
 }
 
 
 int smBaselineRelativeAdenylation :: GetMessageIndex () const {
 
-	return smBaselineRelativeAdenylation :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBaselineRelativeAdenylation::sNoticeType);
 }
 
 
 int smBaselineRelativeAdenylation :: GetScope () const {
 
-	return smBaselineRelativeAdenylation :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBaselineRelativeAdenylation::sNoticeType);
 }
 
 
@@ -11649,20 +11292,19 @@ int smBaselineRelativeFractionalFilter :: GetSubject () const {
 
 void smBaselineRelativeFractionalFilter :: SetIndexAndScope (int index, int scope) const {
 
-	smBaselineRelativeFractionalFilter::sMessageIndex = index;
-	smBaselineRelativeFractionalFilter::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBaselineRelativeFractionalFilter::sNoticeType, index, scope);
 }
 
 
 int smBaselineRelativeFractionalFilter :: GetMessageIndex () const {
 
-	return smBaselineRelativeFractionalFilter :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBaselineRelativeFractionalFilter::sNoticeType);
 }
 
 
 int smBaselineRelativeFractionalFilter :: GetScope () const {
 
-	return smBaselineRelativeFractionalFilter :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBaselineRelativeFractionalFilter::sNoticeType);
 }
 
 
@@ -11709,20 +11351,19 @@ int smBaselineRelativePullupFractionalFilter :: GetSubject () const {
 
 void smBaselineRelativePullupFractionalFilter :: SetIndexAndScope (int index, int scope) const {
 
-	smBaselineRelativePullupFractionalFilter::sMessageIndex = index;
-	smBaselineRelativePullupFractionalFilter::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBaselineRelativePullupFractionalFilter::sNoticeType, index, scope);
 }
 
 
 int smBaselineRelativePullupFractionalFilter :: GetMessageIndex () const {
 
-	return smBaselineRelativePullupFractionalFilter :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBaselineRelativePullupFractionalFilter::sNoticeType);
 }
 
 
 int smBaselineRelativePullupFractionalFilter :: GetScope () const {
 
-	return smBaselineRelativePullupFractionalFilter :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBaselineRelativePullupFractionalFilter::sNoticeType);
 }
 
 
@@ -11769,20 +11410,19 @@ int smBaselineRelativeBelowMinRFU :: GetSubject () const {
 
 void smBaselineRelativeBelowMinRFU :: SetIndexAndScope (int index, int scope) const {
 
-	smBaselineRelativeBelowMinRFU::sMessageIndex = index;
-	smBaselineRelativeBelowMinRFU::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBaselineRelativeBelowMinRFU::sNoticeType, index, scope);
 }
 
 
 int smBaselineRelativeBelowMinRFU :: GetMessageIndex () const {
 
-	return smBaselineRelativeBelowMinRFU :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBaselineRelativeBelowMinRFU::sNoticeType);
 }
 
 
 int smBaselineRelativeBelowMinRFU :: GetScope () const {
 
-	return smBaselineRelativeBelowMinRFU :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBaselineRelativeBelowMinRFU::sNoticeType);
 }
 
 
@@ -11829,20 +11469,19 @@ int smBaselineRelativeBelowMinInterlocusRFU :: GetSubject () const {
 
 void smBaselineRelativeBelowMinInterlocusRFU :: SetIndexAndScope (int index, int scope) const {
 
-	smBaselineRelativeBelowMinInterlocusRFU::sMessageIndex = index;
-	smBaselineRelativeBelowMinInterlocusRFU::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBaselineRelativeBelowMinInterlocusRFU::sNoticeType, index, scope);
 }
 
 
 int smBaselineRelativeBelowMinInterlocusRFU :: GetMessageIndex () const {
 
-	return smBaselineRelativeBelowMinInterlocusRFU :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBaselineRelativeBelowMinInterlocusRFU::sNoticeType);
 }
 
 
 int smBaselineRelativeBelowMinInterlocusRFU :: GetScope () const {
 
-	return smBaselineRelativeBelowMinInterlocusRFU :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBaselineRelativeBelowMinInterlocusRFU::sNoticeType);
 }
 
 
@@ -11889,20 +11528,19 @@ int smTestRelativeBaselinePreset :: GetSubject () const {
 
 void smTestRelativeBaselinePreset :: SetIndexAndScope (int index, int scope) const {
 
-	smTestRelativeBaselinePreset::sMessageIndex = index;
-	smTestRelativeBaselinePreset::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smTestRelativeBaselinePreset::sNoticeType, index, scope);
 }
 
 
 int smTestRelativeBaselinePreset :: GetMessageIndex () const {
 
-	return smTestRelativeBaselinePreset :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smTestRelativeBaselinePreset::sNoticeType);
 }
 
 
 int smTestRelativeBaselinePreset :: GetScope () const {
 
-	return smTestRelativeBaselinePreset :: sMessageScope;
+	return SmartNotice::GetScopeForType (smTestRelativeBaselinePreset::sNoticeType);
 }
 
 
@@ -11949,20 +11587,19 @@ int smIgnoreNegativeRelativeBaselinePreset :: GetSubject () const {
 
 void smIgnoreNegativeRelativeBaselinePreset :: SetIndexAndScope (int index, int scope) const {
 
-	smIgnoreNegativeRelativeBaselinePreset::sMessageIndex = index;
-	smIgnoreNegativeRelativeBaselinePreset::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smIgnoreNegativeRelativeBaselinePreset::sNoticeType, index, scope);
 }
 
 
 int smIgnoreNegativeRelativeBaselinePreset :: GetMessageIndex () const {
 
-	return smIgnoreNegativeRelativeBaselinePreset :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smIgnoreNegativeRelativeBaselinePreset::sNoticeType);
 }
 
 
 int smIgnoreNegativeRelativeBaselinePreset :: GetScope () const {
 
-	return smIgnoreNegativeRelativeBaselinePreset :: sMessageScope;
+	return SmartNotice::GetScopeForType (smIgnoreNegativeRelativeBaselinePreset::sNoticeType);
 }
 
 
@@ -12009,20 +11646,19 @@ int smNormalizeRawDataRelativeToBaselinePreset :: GetSubject () const {
 
 void smNormalizeRawDataRelativeToBaselinePreset :: SetIndexAndScope (int index, int scope) const {
 
-	smNormalizeRawDataRelativeToBaselinePreset::sMessageIndex = index;
-	smNormalizeRawDataRelativeToBaselinePreset::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smNormalizeRawDataRelativeToBaselinePreset::sNoticeType, index, scope);
 }
 
 
 int smNormalizeRawDataRelativeToBaselinePreset :: GetMessageIndex () const {
 
-	return smNormalizeRawDataRelativeToBaselinePreset :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smNormalizeRawDataRelativeToBaselinePreset::sNoticeType);
 }
 
 
 int smNormalizeRawDataRelativeToBaselinePreset :: GetScope () const {
 
-	return smNormalizeRawDataRelativeToBaselinePreset :: sMessageScope;
+	return SmartNotice::GetScopeForType (smNormalizeRawDataRelativeToBaselinePreset::sNoticeType);
 }
 
 
@@ -12069,20 +11705,19 @@ int smPercentOfStandardNoiseThreshold :: GetSubject () const {
 
 void smPercentOfStandardNoiseThreshold :: SetIndexAndScope (int index, int scope) const {
 
-	smPercentOfStandardNoiseThreshold::sMessageIndex = index;
-	smPercentOfStandardNoiseThreshold::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smPercentOfStandardNoiseThreshold::sNoticeType, index, scope);
 }
 
 
 int smPercentOfStandardNoiseThreshold :: GetMessageIndex () const {
 
-	return smPercentOfStandardNoiseThreshold :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smPercentOfStandardNoiseThreshold::sNoticeType);
 }
 
 
 int smPercentOfStandardNoiseThreshold :: GetScope () const {
 
-	return smPercentOfStandardNoiseThreshold :: sMessageScope;
+	return SmartNotice::GetScopeForType (smPercentOfStandardNoiseThreshold::sNoticeType);
 }
 
 
@@ -12129,20 +11764,19 @@ int smLadderFitThreshold :: GetSubject () const {
 
 void smLadderFitThreshold :: SetIndexAndScope (int index, int scope) const {
 
-	smLadderFitThreshold::sMessageIndex = index;
-	smLadderFitThreshold::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smLadderFitThreshold::sNoticeType, index, scope);
 }
 
 
 int smLadderFitThreshold :: GetMessageIndex () const {
 
-	return smLadderFitThreshold :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smLadderFitThreshold::sNoticeType);
 }
 
 
 int smLadderFitThreshold :: GetScope () const {
 
-	return smLadderFitThreshold :: sMessageScope;
+	return SmartNotice::GetScopeForType (smLadderFitThreshold::sNoticeType);
 }
 
 
@@ -12189,20 +11823,19 @@ int smSampleToLadderFitBelowExpectations :: GetSubject () const {
 
 void smSampleToLadderFitBelowExpectations :: SetIndexAndScope (int index, int scope) const {
 
-	smSampleToLadderFitBelowExpectations::sMessageIndex = index;
-	smSampleToLadderFitBelowExpectations::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smSampleToLadderFitBelowExpectations::sNoticeType, index, scope);
 }
 
 
 int smSampleToLadderFitBelowExpectations :: GetMessageIndex () const {
 
-	return smSampleToLadderFitBelowExpectations :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smSampleToLadderFitBelowExpectations::sNoticeType);
 }
 
 
 int smSampleToLadderFitBelowExpectations :: GetScope () const {
 
-	return smSampleToLadderFitBelowExpectations :: sMessageScope;
+	return SmartNotice::GetScopeForType (smSampleToLadderFitBelowExpectations::sNoticeType);
 }
 
 
@@ -12249,20 +11882,19 @@ int smEnableRawDataFilterForNormalizationPreset :: GetSubject () const {
 
 void smEnableRawDataFilterForNormalizationPreset :: SetIndexAndScope (int index, int scope) const {
 
-	smEnableRawDataFilterForNormalizationPreset::sMessageIndex = index;
-	smEnableRawDataFilterForNormalizationPreset::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smEnableRawDataFilterForNormalizationPreset::sNoticeType, index, scope);
 }
 
 
 int smEnableRawDataFilterForNormalizationPreset :: GetMessageIndex () const {
 
-	return smEnableRawDataFilterForNormalizationPreset :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smEnableRawDataFilterForNormalizationPreset::sNoticeType);
 }
 
 
 int smEnableRawDataFilterForNormalizationPreset :: GetScope () const {
 
-	return smEnableRawDataFilterForNormalizationPreset :: sMessageScope;
+	return SmartNotice::GetScopeForType (smEnableRawDataFilterForNormalizationPreset::sNoticeType);
 }
 
 
@@ -12309,20 +11941,19 @@ int smBaselineEstimationThreshold :: GetSubject () const {
 
 void smBaselineEstimationThreshold :: SetIndexAndScope (int index, int scope) const {
 
-	smBaselineEstimationThreshold::sMessageIndex = index;
-	smBaselineEstimationThreshold::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smBaselineEstimationThreshold::sNoticeType, index, scope);
 }
 
 
 int smBaselineEstimationThreshold :: GetMessageIndex () const {
 
-	return smBaselineEstimationThreshold :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smBaselineEstimationThreshold::sNoticeType);
 }
 
 
 int smBaselineEstimationThreshold :: GetScope () const {
 
-	return smBaselineEstimationThreshold :: sMessageScope;
+	return SmartNotice::GetScopeForType (smBaselineEstimationThreshold::sNoticeType);
 }
 
 
@@ -12369,20 +12000,19 @@ int smFilterWindowWidthForBaselineEstimation :: GetSubject () const {
 
 void smFilterWindowWidthForBaselineEstimation :: SetIndexAndScope (int index, int scope) const {
 
-	smFilterWindowWidthForBaselineEstimation::sMessageIndex = index;
-	smFilterWindowWidthForBaselineEstimation::sMessageScope = scope;
+	SmartNotice::SetIndexAndScopeForType (smFilterWindowWidthForBaselineEstimation::sNoticeType, index, scope);
 }
 
 
 int smFilterWindowWidthForBaselineEstimation :: GetMessageIndex () const {
 
-	return smFilterWindowWidthForBaselineEstimation :: sMessageIndex;
+	return SmartNotice::GetMessageIndexForType (smFilterWindowWidthForBaselineEstimation::sNoticeType);
 }
 
 
 int smFilterWindowWidthForBaselineEstimation :: GetScope () const {
 
-	return smFilterWindowWidthForBaselineEstimation :: sMessageScope;
+	return SmartNotice::GetScopeForType (smFilterWindowWidthForBaselineEstimation::sNoticeType);
 }
 
 
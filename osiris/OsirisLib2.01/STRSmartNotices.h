@@ -220,8 +220,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -248,8 +247,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -276,8 +274,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -304,8 +301,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -332,8 +328,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -360,8 +355,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -388,8 +382,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -416,8 +409,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -444,8 +436,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -472,8 +463,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -500,8 +490,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -528,8 +517,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -556,8 +544,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -584,8 +571,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -612,8 +598,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -640,8 +625,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -668,8 +652,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -696,8 +679,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -724,8 +706,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -752,8 +733,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -780,8 +760,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -808,8 +787,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -836,8 +814,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -864,8 +841,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -892,8 +868,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -920,8 +895,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -948,8 +922,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -976,8 +949,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1004,8 +976,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1032,8 +1003,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1060,8 +1030,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1088,8 +1057,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1116,8 +1084,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1144,8 +1111,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1172,8 +1138,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1200,8 +1165,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1228,8 +1192,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1256,8 +1219,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1284,8 +1246,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1312,8 +1273,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1340,8 +1300,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1368,8 +1327,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1396,8 +1354,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1424,8 +1381,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1452,8 +1408,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1480,8 +1435,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1508,8 +1462,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1536,8 +1489,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1564,8 +1516,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1592,8 +1543,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1620,8 +1570,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1648,8 +1597,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1676,8 +1624,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1704,8 +1651,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1732,8 +1678,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1760,8 +1705,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1788,8 +1732,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1816,8 +1759,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1844,8 +1786,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1872,8 +1813,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1900,8 +1840,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1928,8 +1867,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1956,8 +1894,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -1984,8 +1921,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2012,8 +1948,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2040,8 +1975,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2068,8 +2002,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2096,8 +2029,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2124,8 +2056,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2152,8 +2083,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2180,8 +2110,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2208,8 +2137,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2236,8 +2164,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2264,8 +2191,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2292,8 +2218,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2320,8 +2245,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2348,8 +2272,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2376,8 +2299,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2404,8 +2326,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2432,8 +2353,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2460,8 +2380,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2488,8 +2407,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2516,8 +2434,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2544,8 +2461,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2572,8 +2488,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2600,8 +2515,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2628,8 +2542,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2656,8 +2569,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2684,8 +2596,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2712,8 +2623,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2740,8 +2650,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2768,8 +2677,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2796,8 +2704,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2824,8 +2731,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2852,8 +2758,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2880,8 +2785,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2908,8 +2812,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2936,8 +2839,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2964,8 +2866,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -2992,8 +2893,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3020,8 +2920,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3048,8 +2947,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3076,8 +2974,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3104,8 +3001,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3132,8 +3028,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3160,8 +3055,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3188,8 +3082,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3216,8 +3109,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3244,8 +3136,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3272,8 +3163,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3300,8 +3190,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3328,8 +3217,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3356,8 +3244,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3384,8 +3271,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3412,8 +3298,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3440,8 +3325,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3468,8 +3352,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3496,8 +3379,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3524,8 +3406,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3552,8 +3433,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3580,8 +3460,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3608,8 +3487,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3636,8 +3514,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3664,8 +3541,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3692,8 +3568,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3720,8 +3595,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3748,8 +3622,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3776,8 +3649,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3804,8 +3676,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3832,8 +3703,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3860,8 +3730,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3888,8 +3757,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3916,8 +3784,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3944,8 +3811,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -3972,8 +3838,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4000,8 +3865,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4028,8 +3892,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4056,8 +3919,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4084,8 +3946,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4112,8 +3973,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4140,8 +4000,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4168,8 +4027,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4196,8 +4054,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4224,8 +4081,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4252,8 +4108,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4280,8 +4135,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4308,8 +4162,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4336,8 +4189,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4364,8 +4216,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4392,8 +4243,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4420,8 +4270,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4448,8 +4297,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4476,8 +4324,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4504,8 +4351,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4532,8 +4378,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4560,8 +4405,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4588,8 +4432,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4616,8 +4459,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4644,8 +4486,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4672,8 +4513,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4700,8 +4540,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4728,8 +4567,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4756,8 +4594,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4784,8 +4621,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4812,8 +4648,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4840,8 +4675,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4868,8 +4702,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4896,8 +4729,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4924,8 +4756,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4952,8 +4783,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -4980,8 +4810,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5008,8 +4837,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5036,8 +4864,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5064,8 +4891,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5092,8 +4918,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5120,8 +4945,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5148,8 +4972,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5176,8 +4999,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5204,8 +5026,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5232,8 +5053,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5260,8 +5080,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5288,8 +5107,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5316,8 +5134,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5344,8 +5161,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 
@@ -5372,8 +5188,7 @@ public:
 protected:
 	static RGString sName;
 	static int sSubject;
-	static int sMessageIndex;
-	static int sMessageScope;
+	static int sNoticeType;
 };
 
 #endif /* _STRSMARTNOTICES_H_ */
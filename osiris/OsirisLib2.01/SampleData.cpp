@@ -175,3 +175,9 @@ double* SampleData :: GetMatrix (int& numElements) {
 }
 
 
+double** SampleData :: GetColorCorrectedRawData (const double* matrix, int numberOfChannels, int& numDataPoints) {
+
+	return NULL;
+}
+
+
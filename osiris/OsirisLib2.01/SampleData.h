@@ -82,6 +82,7 @@ public:
 
 	virtual const long* GetOffScaleData (int& numElements);
 	virtual double* GetMatrix (int& numElements);
+	virtual double** GetColorCorrectedRawData (const double* matrix, int numberOfChannels, int& numDataPoints);
 
 private:
 	RGString mSampleFileName;
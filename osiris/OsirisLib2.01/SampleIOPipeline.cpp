@@ -0,0 +1,592 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: SampleIOPipeline.cpp
+*
+*/
+//
+//  class SampleIOPipeline reads sample files ahead of, and writes graphics files behind, the serial sample loop (POSIX only).
+//  See SampleIOPipeline.h
+//
+
+#include "SampleIOPipeline.h"
+#include "DirectoryManager.h"
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#endif
+
+using namespace std;
+
+
+SampleIOPipeline* SampleIOPipeline::ActivePipeline = NULL;
+
+
+//
+//  The contents of a SampleOutputFile:  a growable buffer behind a stdio stream, so that RGFile and RGTextOutput write to it
+//  as to any file, including seeking back to fill in a header (see PlotDataPoints::EndBinaryFile)
+//
+
+struct SampleMemoryStream {
+
+	char* mData;
+	size_t mLength;
+	size_t mCapacity;
+	size_t mPosition;
+};
+
+
+#ifndef _WIN32
+
+static double CurrentSeconds () {
+
+	struct timeval now;
+	gettimeofday (&now, NULL);
+	return (double)now.tv_sec + 1.0e-6 * (double)now.tv_usec;
+}
+
+
+static bool WriteWholeFile (const SampleIOWrite& write) {
+
+	FILE* file = fopen (write.mFileName.c_str (), write.mMode.c_str ());
+
+	if (file == NULL)
+		return false;
+
+	bool ok = (write.mLength == 0) || (fwrite (write.mData, 1, write.mLength, file) == write.mLength);
+
+	if (fclose (file) != 0)
+		ok = false;
+
+	return ok;
+}
+
+
+static long MemoryStreamWrite (SampleMemoryStream* stream, const char* data, size_t n) {
+
+	size_t end = stream->mPosition + n;
+
+	if (end > stream->mCapacity) {
+
+		size_t capacity = (stream->mCapacity < 65536) ? 65536 : 2 * stream->mCapacity;
+
+		while (capacity < end)
+			capacity *= 2;
+
+		char* newData = (char*) realloc (stream->mData, capacity);
+
+		if (newData == NULL)
+			return -1;
+
+		stream->mData = newData;
+		stream->mCapacity = capacity;
+	}
+
+	if (stream->mPosition > stream->mLength)
+		memset (stream->mData + stream->mLength, 0, stream->mPosition - stream->mLength);
+
+	memcpy (stream->mData + stream->mPosition, data, n);
+	stream->mPosition = end;
+
+	if (end > stream->mLength)
+		stream->mLength = end;
+
+	return (long) n;
+}
+
+
+static long MemoryStreamSeek (SampleMemoryStream* stream, long offset, int whence) {
+
+	long base;
+
+	if (whence == SEEK_SET)
+		base = 0;
+
+	else if (whence == SEEK_CUR)
+		base = (long) stream->mPosition;
+
+	else
+		base = (long) stream->mLength;
+
+	if (base + offset < 0)
+		return -1;
+
+	stream->mPosition = (size_t)(base + offset);
+	return (long) stream->mPosition;
+}
+
+#if defined (__APPLE__) || defined (__FreeBSD__)
+
+static int CookieWrite (void* cookie, const char* data, int n) {
+
+	return (int) MemoryStreamWrite ((SampleMemoryStream*) cookie, data, (size_t) n);
+}
+
+
+static fpos_t CookieSeek (void* cookie, fpos_t offset, int whence) {
+
+	return (fpos_t) MemoryStreamSeek ((SampleMemoryStream*) cookie, (long) offset, whence);
+}
+
+
+static int CookieClose (void* cookie) {
+
+	return 0;	// the contents are taken by SampleOutputFile::Close
+}
+
+
+static FILE* OpenMemoryStream (SampleMemoryStream* stream) {
+
+	return funopen (stream, NULL, CookieWrite, CookieSeek, CookieClose);
+}
+
+#else
+
+static ssize_t CookieWrite (void* cookie, const char* data, size_t n) {
+
+	long written = MemoryStreamWrite ((SampleMemoryStream*) cookie, data, n);
+	return (written < 0) ? 0 : (ssize_t) written;
+}
+
+
+static int CookieSeek (void* cookie, off64_t* offset, int whence) {
+
+	long position = MemoryStreamSeek ((SampleMemoryStream*) cookie, (long) *offset, whence);
+
+	if (position < 0)
+		return -1;
+
+	*offset = (off64_t) position;
+	return 0;
+}
+
+
+static int CookieClose (void* cookie) {
+
+	return 0;	// the contents are taken by SampleOutputFile::Close
+}
+
+
+static FILE* OpenMemoryStream (SampleMemoryStream* stream) {
+
+	cookie_io_functions_t functions;
+	functions.read = NULL;
+	functions.write = CookieWrite;
+	functions.seek = CookieSeek;
+	functions.close = CookieClose;
+	return fopencookie (stream, "w", functions);
+}
+
+#endif
+
+#endif
+
+
+
+SampleIOPipeline :: SampleIOPipeline (int readAhead, int writeBehind) : mReadAhead (readAhead), mWriteBehind (writeBehind),
+mRunning (false), mEndOfDirectory (false), mWriting (false), mNumberOfWriteErrors (0), mSecondsWaitingForInput (0.0), mSecondsWaitingForOutput (0.0) {
+
+	if (!IsAvailable () || (mReadAhead < 0))
+		mReadAhead = 0;
+
+	if (!IsAvailable () || (mWriteBehind < 0))
+		mWriteBehind = 0;
+
+#ifndef _WIN32
+	pthread_mutex_init (&mMutex, NULL);
+	pthread_cond_init (&mReadCondition, NULL);
+	pthread_cond_init (&mWriteCondition, NULL);
+	mRunning = true;
+
+	if ((mReadAhead > 0) && (pthread_create (&mReader, NULL, ReaderThread, this) != 0))
+		mReadAhead = 0;
+
+	if ((mWriteBehind > 0) && (pthread_create (&mWriter, NULL, WriterThread, this) != 0))
+		mWriteBehind = 0;
+#endif
+
+	ActivePipeline = this;
+}
+
+
+SampleIOPipeline :: ~SampleIOPipeline () {
+
+	FinishWrites ();
+
+#ifndef _WIN32
+	pthread_mutex_lock (&mMutex);
+	mRunning = false;
+	pthread_cond_broadcast (&mReadCondition);
+	pthread_cond_broadcast (&mWriteCondition);
+	pthread_mutex_unlock (&mMutex);
+
+	if (mReadAhead > 0)
+		pthread_join (mReader, NULL);
+
+	if (mWriteBehind > 0)
+		pthread_join (mWriter, NULL);
+
+	pthread_cond_destroy (&mReadCondition);
+	pthread_cond_destroy (&mWriteCondition);
+	pthread_mutex_destroy (&mMutex);
+#endif
+
+	if (ActivePipeline == this)
+		ActivePipeline = NULL;
+}
+
+
+bool SampleIOPipeline :: IsAvailable () {
+
+#ifdef _WIN32
+	return false;
+#else
+	return true;
+#endif
+}
+
+
+Boolean SampleIOPipeline :: GetNextOrderedSampleFile (DirectoryManager& directory, const RGString& directoryName, RGString& fileName) {
+
+	if (mReadAhead <= 0)
+		return directory.GetNextOrderedSampleFile (fileName);
+
+#ifndef _WIN32
+	RGString name;
+	RGString fullPath;
+
+	//  Keep the next mReadAhead samples, after the one returned, queued for reading
+
+	while (!mEndOfDirectory && ((int)mLookAhead.size () <= mReadAhead)) {
+
+		if (!directory.GetNextOrderedSampleFile (name)) {
+
+			mEndOfDirectory = true;
+			break;
+		}
+
+		mLookAhead.push_back (string (name.GetData ()));
+		fullPath = directoryName + "/" + name;
+		pthread_mutex_lock (&mMutex);
+		mReadQueue.push_back (string (fullPath.GetData ()));
+		pthread_cond_broadcast (&mReadCondition);
+		pthread_mutex_unlock (&mMutex);
+	}
+
+	if (mLookAhead.empty ())
+		return FALSE;
+
+	fileName = mLookAhead.front ().c_str ();
+	mLookAhead.pop_front ();
+	fullPath = directoryName + "/" + fileName;
+	string path (fullPath.GetData ());
+	list<string>::iterator it;
+	double start = 0.0;
+
+	pthread_mutex_lock (&mMutex);
+
+	while (true) {
+
+		for (it = mReadQueue.begin (); it != mReadQueue.end (); it++) {
+
+			if (*it == path)
+				break;
+		}
+
+		if ((it == mReadQueue.end ()) && (mReading != path))
+			break;
+
+		if (start == 0.0)
+			start = CurrentSeconds ();
+
+		pthread_cond_wait (&mReadCondition, &mMutex);
+	}
+
+	pthread_mutex_unlock (&mMutex);
+
+	if (start > 0.0)
+		mSecondsWaitingForInput += CurrentSeconds () - start;
+#endif
+
+	return TRUE;
+}
+
+
+RGFile* SampleIOPipeline :: OpenOutputFile (const RGString& fullPath, const char* mode) {
+
+	RGFile* file = NULL;
+
+	if ((ActivePipeline != NULL) && (ActivePipeline->mWriteBehind > 0))
+		file = SampleOutputFile::Open (fullPath, mode, ActivePipeline);
+
+	if (file == NULL)
+		file = new RGFile (fullPath, mode);
+
+	if (!file->isValid ()) {
+
+		delete file;
+		return NULL;
+	}
+
+	return file;
+}
+
+
+void SampleIOPipeline :: QueueWrite (SampleIOWrite& write) {
+
+#ifndef _WIN32
+	if (mWriteBehind <= 0) {
+
+		if (!WriteWholeFile (write)) {
+
+			cout << "Could not write graphic file:  " << write.mFileName << endl;
+			mNumberOfWriteErrors++;
+		}
+
+		free (write.mData);
+		write.mData = NULL;
+		return;
+	}
+
+	double start = 0.0;
+	pthread_mutex_lock (&mMutex);
+	ReportWriteErrors ();
+
+	while ((int)mWriteQueue.size () >= mWriteBehind) {
+
+		if (start == 0.0)
+			start = CurrentSeconds ();
+
+		pthread_cond_wait (&mWriteCondition, &mMutex);
+	}
+
+	mWriteQueue.push_back (write);
+	write.mData = NULL;
+	pthread_cond_broadcast (&mWriteCondition);
+	pthread_mutex_unlock (&mMutex);
+
+	if (start > 0.0)
+		mSecondsWaitingForOutput += CurrentSeconds () - start;
+#endif
+}
+
+
+void SampleIOPipeline :: FinishWrites () {
+
+#ifndef _WIN32
+	if (mWriteBehind <= 0)
+		return;
+
+	double start = 0.0;
+	pthread_mutex_lock (&mMutex);
+
+	while (!mWriteQueue.empty () || mWriting) {
+
+		if (start == 0.0)
+			start = CurrentSeconds ();
+
+		pthread_cond_wait (&mWriteCondition, &mMutex);
+	}
+
+	ReportWriteErrors ();
+	pthread_mutex_unlock (&mMutex);
+
+	if (start > 0.0)
+		mSecondsWaitingForOutput += CurrentSeconds () - start;
+#endif
+}
+
+
+void SampleIOPipeline :: ReportWriteErrors () {
+
+	while (!mWriteErrors.empty ()) {
+
+		cout << "Could not write graphic file:  " << mWriteErrors.front () << endl;
+		mWriteErrors.pop_front ();
+		mNumberOfWriteErrors++;
+	}
+}
+
+
+#ifndef _WIN32
+
+void* SampleIOPipeline :: ReaderThread (void* pipeline) {
+
+	((SampleIOPipeline*) pipeline)->ReadFiles ();
+	return NULL;
+}
+
+
+void* SampleIOPipeline :: WriterThread (void* pipeline) {
+
+	((SampleIOPipeline*) pipeline)->WriteFiles ();
+	return NULL;
+}
+
+#endif
+
+
+void SampleIOPipeline :: ReadFiles () {
+
+	//  Reads each queued file once, so that it is in the system's file cache when the analysis opens it
+
+#ifndef _WIN32
+	const size_t blockSize = 262144;
+	char* block = (char*) malloc (blockSize);
+	int fd;
+
+	pthread_mutex_lock (&mMutex);
+
+	while (true) {
+
+		while (mReadQueue.empty () && mRunning)
+			pthread_cond_wait (&mReadCondition, &mMutex);
+
+		if (!mRunning)
+			break;
+
+		mReading = mReadQueue.front ();
+		mReadQueue.pop_front ();
+		pthread_mutex_unlock (&mMutex);
+
+		fd = open (mReading.c_str (), O_RDONLY);
+
+		if (fd >= 0) {
+
+			while ((block != NULL) && (read (fd, block, blockSize) > 0))
+				;
+
+			close (fd);
+		}
+
+		pthread_mutex_lock (&mMutex);
+		mReading.clear ();
+		pthread_cond_broadcast (&mReadCondition);
+	}
+
+	pthread_mutex_unlock (&mMutex);
+	free (block);
+#endif
+}
+
+
+void SampleIOPipeline :: WriteFiles () {
+
+#ifndef _WIN32
+	SampleIOWrite write;
+	bool ok;
+
+	pthread_mutex_lock (&mMutex);
+
+	while (true) {
+
+		while (mWriteQueue.empty () && mRunning)
+			pthread_cond_wait (&mWriteCondition, &mMutex);
+
+		if (mWriteQueue.empty ())
+			break;
+
+		write = mWriteQueue.front ();
+		mWriteQueue.pop_front ();
+		mWriting = true;
+		pthread_mutex_unlock (&mMutex);
+
+		ok = WriteWholeFile (write);
+		free (write.mData);
+
+		pthread_mutex_lock (&mMutex);
+		mWriting = false;
+
+		if (!ok)
+			mWriteErrors.push_back (write.mFileName);
+
+		pthread_cond_broadcast (&mWriteCondition);
+	}
+
+	pthread_mutex_unlock (&mMutex);
+#endif
+}
+
+
+
+SampleOutputFile :: SampleOutputFile (FILE* file, const RGString& fullPath, const char* mode, SampleIOPipeline* pipeline, SampleMemoryStream* stream) :
+RGFile (file, fullPath.GetData (), mode), mPipeline (pipeline), mStream (stream) {
+
+}
+
+
+SampleOutputFile :: ~SampleOutputFile () {
+
+	Close ();
+	free (mStream->mData);
+	delete mStream;
+}
+
+
+SampleOutputFile* SampleOutputFile :: Open (const RGString& fullPath, const char* mode, SampleIOPipeline* pipeline) {
+
+#ifdef _WIN32
+	return NULL;
+#else
+	SampleMemoryStream* stream = new SampleMemoryStream;
+	stream->mData = NULL;
+	stream->mLength = stream->mCapacity = stream->mPosition = 0;
+	FILE* file = OpenMemoryStream (stream);
+
+	if (file == NULL) {
+
+		delete stream;
+		return NULL;
+	}
+
+	return new SampleOutputFile (file, fullPath, mode, pipeline, stream);
+#endif
+}
+
+
+Boolean SampleOutputFile :: Close () {
+
+	if (FilePtr == NULL)
+		return FALSE;
+
+	Boolean status = RGFile::Close ();	// flushes the stream into mStream
+	SampleIOWrite write;
+	write.mFileName = FileName;
+	write.mMode = Mode;
+	write.mData = mStream->mData;
+	write.mLength = mStream->mLength;
+	mStream->mData = NULL;
+	mStream->mLength = mStream->mCapacity = mStream->mPosition = 0;
+	mPipeline->QueueWrite (write);
+	return status;
+}
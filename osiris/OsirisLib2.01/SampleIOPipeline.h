@@ -0,0 +1,143 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: SampleIOPipeline.h
+*
+*/
+//
+//  class SampleIOPipeline keeps disk access off the analysis thread in the serial sample loop (POSIX only).  A reader thread
+//  reads the next few sample files, in the order in which they will be analyzed, so that they are in memory when the analysis
+//  opens them, and a writer thread writes the graphics files of finished samples.  A SampleOutputFile collects its contents in
+//  memory and, when closed, queues them for the writer thread.  Files are written in the order in which they are closed.  Both
+//  queues are bounded:  the analysis waits only when the next file has not been read yet or when the write queue is full, and
+//  that time is accumulated for reporting.  Files that cannot be written are counted, so that the analysis can fail at the end
+//
+
+#ifndef _SAMPLEIOPIPELINE_H_
+#define _SAMPLEIOPIPELINE_H_
+
+#include "rgstring.h"
+#include "rgfile.h"
+
+#include <list>
+#include <string>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+using namespace std;
+
+class DirectoryManager;
+
+
+struct SampleIOWrite {
+
+	string mFileName;
+	string mMode;
+	char* mData;	// malloc'ed; freed by the writer thread
+	size_t mLength;
+};
+
+
+class SampleIOPipeline {
+
+public:
+	SampleIOPipeline (int readAhead, int writeBehind);
+	~SampleIOPipeline ();	// finishes all queued writes
+
+	static bool IsAvailable ();
+	static SampleIOPipeline* GetActivePipeline () { return ActivePipeline; }
+
+	// Read ahead
+
+	Boolean GetNextOrderedSampleFile (DirectoryManager& directory, const RGString& directoryName, RGString& fileName);	// returns once fileName has been read ahead
+
+	// Write behind
+
+	static RGFile* OpenOutputFile (const RGString& fullPath, const char* mode);	// a SampleOutputFile if a pipeline is active; NULL if the file cannot be opened
+	void QueueWrite (SampleIOWrite& write);	// takes ownership of write.mData
+	void FinishWrites ();
+	int GetNumberOfWriteErrors () const { return mNumberOfWriteErrors; }	// graphics files that could not be written, so far
+
+	double GetSecondsWaitingForInput () const { return mSecondsWaitingForInput; }
+	double GetSecondsWaitingForOutput () const { return mSecondsWaitingForOutput; }
+
+protected:
+	int mReadAhead;
+	int mWriteBehind;
+	bool mRunning;
+	bool mEndOfDirectory;
+
+	list<string> mLookAhead;	// sample names, in analysis order; the first mReadAhead are queued for reading
+	list<string> mReadQueue;	// full paths
+	string mReading;
+	list<SampleIOWrite> mWriteQueue;
+	bool mWriting;
+	list<string> mWriteErrors;
+	int mNumberOfWriteErrors;
+
+	double mSecondsWaitingForInput;
+	double mSecondsWaitingForOutput;
+
+#ifndef _WIN32
+	pthread_mutex_t mMutex;
+	pthread_cond_t mReadCondition;
+	pthread_cond_t mWriteCondition;
+	pthread_t mReader;
+	pthread_t mWriter;
+
+	static void* ReaderThread (void* pipeline);
+	static void* WriterThread (void* pipeline);
+#endif
+
+	void ReadFiles ();
+	void WriteFiles ();
+	void ReportWriteErrors ();	// holding mutex
+
+	static SampleIOPipeline* ActivePipeline;
+};
+
+
+class SampleOutputFile : public RGFile {
+
+	//  An RGFile whose contents are written by the active SampleIOPipeline when closed
+
+public:
+	virtual ~SampleOutputFile ();
+
+	static SampleOutputFile* Open (const RGString& fullPath, const char* mode, SampleIOPipeline* pipeline);	// NULL if memory stream not available
+
+	virtual Boolean Close ();
+
+protected:
+	SampleOutputFile (FILE* file, const RGString& fullPath, const char* mode, SampleIOPipeline* pipeline, struct SampleMemoryStream* stream);
+
+	SampleIOPipeline* mPipeline;
+	struct SampleMemoryStream* mStream;
+};
+
+
+#endif  /*  _SAMPLEIOPIPELINE_H_  */
@@ -0,0 +1,629 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: SampleWorkerPool.cpp
+*
+*/
+//
+//  class SampleWorkerPool analyzes samples concurrently, each in its own worker process (POSIX only).  See SampleWorkerPool.h
+//
+
+#include "SampleWorkerPool.h"
+#include "DataSignal.h"
+#include "Notice.h"
+#include "SmartMessage.h"
+
+#include <string>
+#include <iostream>
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+using namespace std;
+
+
+#ifndef _WIN32
+
+static void PutData (string& buffer, const void* data, size_t n) {
+
+	buffer.append ((const char*) data, n);
+}
+
+
+static bool GetData (const string& buffer, size_t& position, void* data, size_t n) {
+
+	if (position + n > buffer.length ())
+		return false;
+
+	buffer.copy ((char*) data, n, position);
+	position += n;
+	return true;
+}
+
+
+static bool WriteAll (int fd, const char* data, size_t n) {
+
+	ssize_t written;
+
+	while (n > 0) {
+
+		written = write (fd, data, n);
+
+		if (written < 0) {
+
+			if (errno == EINTR)
+				continue;
+
+			return false;
+		}
+
+		data += written;
+		n -= written;
+	}
+
+	return true;
+}
+
+
+static bool ReadAll (int fd, char* data, size_t n) {
+
+	ssize_t nRead;
+
+	while (n > 0) {
+
+		nRead = read (fd, data, n);
+
+		if (nRead < 0) {
+
+			if (errno == EINTR)
+				continue;
+
+			return false;
+		}
+
+		if (nRead == 0)
+			return false;
+
+		data += nRead;
+		n -= nRead;
+	}
+
+	return true;
+}
+
+
+static void PutObjectID (string& buffer, RGPersistent* object) {
+
+	int id = (object != NULL) ? ((SmartMessagingObject*) object)->GetDirectoryObjectID () : -1;
+	PutData (buffer, &id, sizeof (int));
+}
+
+
+static bool GetObjectID (const string& buffer, size_t& position, const SampleWorker& worker, SmartMessagingObject*& object) {
+
+	//  Only objects that existed when the worker was forked are the same in both processes
+
+	int id;
+	object = NULL;
+
+	if (!GetData (buffer, position, &id, sizeof (int)))
+		return false;
+
+	if ((id < 0) || (id >= worker.mDirectoryObjectsAtStart))
+		return false;
+
+	object = SmartMessagingObject::GetDirectoryObject (id);
+	return (object != NULL);
+}
+
+
+static void PutMessageID (string& buffer, const SmartMessage* message) {
+
+	int scope = -1;
+	int element = (message != NULL) ? SmartMessage::GetMessageIndex (message, scope) : -1;
+	PutData (buffer, &scope, sizeof (int));
+	PutData (buffer, &element, sizeof (int));
+}
+
+
+static bool GetMessageID (const string& buffer, size_t& position, SmartMessage*& message) {
+
+	int scope;
+	int element;
+	message = NULL;
+
+	if (!GetData (buffer, position, &scope, sizeof (int)) || !GetData (buffer, position, &element, sizeof (int)))
+		return false;
+
+	if ((element < 0) || (element >= SmartMessage::GetSizeOfArrayForScope (scope)))
+		return false;
+
+	message = SmartMessage::GetSmartMessageForScopeAndElement (scope, element);
+	return (message != NULL);
+}
+
+#endif
+
+
+SampleWorkerResult :: SampleWorkerResult () : mSampleWasPrepared (false), mIsPositiveControl (false), mIsNegativeControl (false), mSampleOK (false) {
+
+}
+
+
+void SampleWorkerResult :: Reset () {
+
+	mSampleWasPrepared = mIsPositiveControl = mIsNegativeControl = mSampleOK = false;
+	mBaseLoci.Clear ();
+}
+
+
+
+SampleWorkerPool :: SampleWorkerPool (int maxWorkers, const RGString& fragmentPrefix) : mMaxWorkers (maxWorkers),
+mFragmentPrefix (fragmentPrefix), mSequenceNumber (0), mPreviousSigPipeHandler (NULL), mSignalIDAtStart (0) {
+
+	if (mMaxWorkers < 1)
+		mMaxWorkers = 1;
+
+	mSelf.mPid = 0;
+	mSelf.mToWorker = mSelf.mFromWorker = -1;
+	mSelf.mSequenceNumber = 0;
+	mSelf.mStartedAfterOthers = false;
+	mSelf.mDirectoryObjectsAtStart = 0;
+
+#ifndef _WIN32
+	mPreviousSigPipeHandler = signal (SIGPIPE, SIG_IGN);	// a worker that dies is detected when its result cannot be read
+#endif
+}
+
+
+SampleWorkerPool :: ~SampleWorkerPool () {
+
+	//  Workers that were never collected are discarded:  without their reporting turn, they exit without a result
+
+#ifndef _WIN32
+	list<SampleWorker>::iterator wIterator;
+	int status;
+
+	for (wIterator = mWorkers.begin (); wIterator != mWorkers.end (); wIterator++) {
+
+		close ((*wIterator).mToWorker);
+		close ((*wIterator).mFromWorker);
+		waitpid ((pid_t) (*wIterator).mPid, &status, 0);
+		AppendFragments (*wIterator, false);
+	}
+
+	mWorkers.clear ();
+
+	if (mPreviousSigPipeHandler != SIG_ERR)
+		signal (SIGPIPE, mPreviousSigPipeHandler);
+#endif
+}
+
+
+bool SampleWorkerPool :: IsAvailable () {
+
+#ifdef _WIN32
+	return false;
+#else
+	return true;
+#endif
+}
+
+
+void SampleWorkerPool :: AddOutputFile (RGFile* file) {
+
+	if ((file != NULL) && file->isValid ())
+		mOutputFiles.push_back (file);
+}
+
+
+RGString SampleWorkerPool :: GetNextFileName () const {
+
+	if (mWorkers.empty ())
+		return "";
+
+	return mWorkers.front ().mFileName;
+}
+
+
+int SampleWorkerPool :: StartWorker (const RGString& fileName) {
+
+#ifdef _WIN32
+	return -1;
+#else
+	int toWorker [2];
+	int fromWorker [2];
+
+	if (pipe (toWorker) != 0)
+		return -1;
+
+	if (pipe (fromWorker) != 0) {
+
+		close (toWorker [0]);
+		close (toWorker [1]);
+		return -1;
+	}
+
+	// Anything still buffered would otherwise be written twice
+
+	cout.flush ();
+	fflush (NULL);
+
+	SampleWorker worker;
+	mSequenceNumber++;
+	worker.mSequenceNumber = mSequenceNumber;
+	worker.mStartedAfterOthers = !mWorkers.empty ();
+	worker.mFileName = fileName;
+	worker.mDirectoryObjectsAtStart = SmartMessagingObject::GetNumberOfDirectoryObjects ();
+
+	pid_t pid = fork ();
+
+	if (pid < 0) {
+
+		close (toWorker [0]);
+		close (toWorker [1]);
+		close (fromWorker [0]);
+		close (fromWorker [1]);
+		mSequenceNumber--;
+		return -1;
+	}
+
+	if (pid == 0) {
+
+		close (toWorker [1]);
+		close (fromWorker [0]);
+		list<SampleWorker>::iterator wIterator;
+
+		for (wIterator = mWorkers.begin (); wIterator != mWorkers.end (); wIterator++) {
+
+			close ((*wIterator).mToWorker);
+			close ((*wIterator).mFromWorker);
+		}
+
+		mWorkers.clear ();
+		mSelf = worker;
+		mSelf.mPid = (int) getpid ();
+		mSelf.mToWorker = toWorker [0];
+		mSelf.mFromWorker = fromWorker [1];
+
+		RedirectOutputToFragments ();
+		mSignalIDAtStart = DataSignal::GetCurrentSignalID ();
+		mJournal.Clear ();
+		SmartMessagingObject::SetJournal (&mJournal);
+		return 0;
+	}
+
+	close (toWorker [0]);
+	close (fromWorker [1]);
+	worker.mPid = (int) pid;
+	worker.mToWorker = toWorker [1];
+	worker.mFromWorker = fromWorker [0];
+	mWorkers.push_back (worker);
+	return 1;
+#endif
+}
+
+
+int SampleWorkerPool :: CollectNextWorker (SampleWorkerResult& result) {
+
+	result.Reset ();
+
+	if (mWorkers.empty ())
+		return -1;
+
+	SampleWorker worker = mWorkers.front ();
+	mWorkers.pop_front ();
+
+#ifdef _WIN32
+	return -1;
+#else
+	//  Give the worker the numbering it would have had in a serial analysis...
+
+	int messageNumber = Notice::GetCurrentMessageNumber ();
+	int linkNumber = Notice::GetCurrentLinkNumber ();
+	unsigned long signalBase = DataSignal::GetCurrentSignalID ();
+	string buffer;
+	PutData (buffer, &messageNumber, sizeof (int));
+	PutData (buffer, &linkNumber, sizeof (int));
+	PutData (buffer, &signalBase, sizeof (unsigned long));
+	bool ok = WriteAll (worker.mToWorker, buffer.data (), buffer.length ());
+
+	//  ...and read back what it did with it
+
+	size_t length = 0;
+	ok = ok && ReadAll (worker.mFromWorker, (char*) &length, sizeof (size_t));
+
+	if (ok) {
+
+		buffer.resize (length);
+		ok = (length == 0) || ReadAll (worker.mFromWorker, &buffer [0], length);
+	}
+
+	close (worker.mToWorker);
+	close (worker.mFromWorker);
+	int status = 0;
+
+	while ((waitpid ((pid_t) worker.mPid, &status, 0) < 0) && (errno == EINTR))
+		;
+
+	ok = ok && WIFEXITED (status) && (WEXITSTATUS (status) == 0);
+
+	unsigned long signalsCreated = 0;
+	char flags [5];
+	int nBaseLoci = 0;
+	int nEntries = 0;
+	int i;
+	int textLength;
+	SmartMessagingObject* baseLocus;
+	SmartMessageJournal journal;
+	SmartMessageJournalEntry entry;
+	size_t position = 0;
+
+	ok = ok && GetData (buffer, position, &messageNumber, sizeof (int));
+	ok = ok && GetData (buffer, position, &linkNumber, sizeof (int));
+	ok = ok && GetData (buffer, position, &signalsCreated, sizeof (unsigned long));
+	ok = ok && GetData (buffer, position, flags, 5);
+	ok = ok && GetData (buffer, position, &nBaseLoci, sizeof (int));
+
+	for (i=0; ok && (i<nBaseLoci); i++) {
+
+		ok = GetObjectID (buffer, position, worker, baseLocus);
+
+		if (ok)
+			result.mBaseLoci.Append (baseLocus);
+	}
+
+	ok = ok && GetData (buffer, position, &nEntries, sizeof (int));
+
+	for (i=0; ok && (i<nEntries); i++) {
+
+		ok = GetData (buffer, position, &entry.mType, sizeof (int));
+		ok = ok && ((entry.mType == SmartMessageJournal::ExportSpecification) ?
+			GetMessageID (buffer, position, entry.mMessage) : GetObjectID (buffer, position, worker, entry.mTarget));
+		ok = ok && GetData (buffer, position, &entry.mScope, sizeof (int));
+		ok = ok && GetData (buffer, position, &entry.mIndex, sizeof (int));
+		ok = ok && GetData (buffer, position, &entry.mValue, sizeof (int));
+		ok = ok && GetData (buffer, position, &textLength, sizeof (int));
+		ok = ok && (textLength >= 0) && (position + textLength <= buffer.length ());
+
+		if (ok) {
+
+			entry.mText = buffer.substr (position, textLength).c_str ();
+			position += textLength;
+			journal.Append (entry);
+		}
+	}
+
+	if (!ok) {
+
+		cout << "Sample worker for file " << worker.mFileName << " did not complete.  Reanalyzing..." << endl;
+		AppendFragments (worker, false);
+		result.Reset ();
+		return -1;
+	}
+
+	if ((flags [3] != 0) && worker.mStartedAfterOthers) {
+
+		// The sample tested directory data that earlier samples, still in progress when it started, may have changed
+
+		AppendFragments (worker, false);
+		result.Reset ();
+		return -2;
+	}
+
+	AppendFragments (worker, true);
+	Notice::SetCurrentMessageNumber (messageNumber);
+	Notice::SetCurrentLinkNumber (linkNumber);
+	DataSignal::SetCurrentSignalID (signalBase + signalsCreated);
+	journal.Replay ();
+
+	result.mSampleWasPrepared = (flags [0] != 0);
+	result.mIsPositiveControl = (flags [1] != 0);
+	result.mIsNegativeControl = (flags [2] != 0);
+	result.mSampleOK = (flags [4] != 0);
+	return 0;
+#endif
+}
+
+
+void SampleWorkerPool :: WaitForReportingTurn () {
+
+#ifndef _WIN32
+	int messageNumber;
+	int linkNumber;
+	unsigned long signalBase;
+	char buffer [2 * sizeof (int) + sizeof (unsigned long)];
+
+	if (!ReadAll (mSelf.mToWorker, buffer, sizeof (buffer)))
+		AbandonWorker ();
+
+	string input (buffer, sizeof (buffer));
+	size_t position = 0;
+	GetData (input, position, &messageNumber, sizeof (int));
+	GetData (input, position, &linkNumber, sizeof (int));
+	GetData (input, position, &signalBase, sizeof (unsigned long));
+
+	Notice::SetCurrentMessageNumber (messageNumber);
+	Notice::SetCurrentLinkNumber (linkNumber);
+	DataSignal::SetSignalIDOffset (mSignalIDAtStart, signalBase - mSignalIDAtStart);
+#endif
+}
+
+
+void SampleWorkerPool :: FinishWorker (const SampleWorkerResult& result) {
+
+#ifndef _WIN32
+	string buffer;
+	int messageNumber = Notice::GetCurrentMessageNumber ();
+	int linkNumber = Notice::GetCurrentLinkNumber ();
+	unsigned long signalsCreated = DataSignal::GetCurrentSignalID () - mSignalIDAtStart;
+	char flags [5];
+	flags [0] = result.mSampleWasPrepared;
+	flags [1] = result.mIsPositiveControl;
+	flags [2] = result.mIsNegativeControl;
+	flags [3] = mJournal.ReadsDirectoryData ();
+	flags [4] = result.mSampleOK;
+
+	PutData (buffer, &messageNumber, sizeof (int));
+	PutData (buffer, &linkNumber, sizeof (int));
+	PutData (buffer, &signalsCreated, sizeof (unsigned long));
+	PutData (buffer, flags, 5);
+
+	int n = result.mBaseLoci.Entries ();
+	PutData (buffer, &n, sizeof (int));
+	RGDListIterator it ((RGDList&) result.mBaseLoci);
+	RGPersistent* nextBaseLocus;
+
+	while ((nextBaseLocus = it ()))
+		PutObjectID (buffer, nextBaseLocus);
+
+	const list<SmartMessageJournalEntry>& entries = mJournal.GetEntries ();
+	n = (int) entries.size ();
+	PutData (buffer, &n, sizeof (int));
+	list<SmartMessageJournalEntry>::const_iterator c1Iterator;
+
+	for (c1Iterator = entries.begin (); c1Iterator != entries.end (); c1Iterator++) {
+
+		const SmartMessageJournalEntry& entry = *c1Iterator;
+		PutData (buffer, &entry.mType, sizeof (int));
+
+		if (entry.mType == SmartMessageJournal::ExportSpecification)
+			PutMessageID (buffer, entry.mMessage);
+
+		else
+			PutObjectID (buffer, entry.mTarget);
+
+		PutData (buffer, &entry.mScope, sizeof (int));
+		PutData (buffer, &entry.mIndex, sizeof (int));
+		PutData (buffer, &entry.mValue, sizeof (int));
+		n = (int) entry.mText.Length ();
+		PutData (buffer, &n, sizeof (int));
+		PutData (buffer, entry.mText.GetData (), n);
+	}
+
+	// Fragments must be complete before the parent hears from us
+
+	cout.flush ();
+	fflush (NULL);
+
+	size_t length = buffer.length ();
+	bool ok = WriteAll (mSelf.mFromWorker, (const char*) &length, sizeof (size_t));
+	ok = ok && WriteAll (mSelf.mFromWorker, buffer.data (), length);
+	_exit (ok ? 0 : 1);
+#endif
+}
+
+
+void SampleWorkerPool :: AbandonWorker () {
+
+#ifndef _WIN32
+	cout.flush ();
+	fflush (NULL);
+	_exit (1);
+#endif
+}
+
+
+RGString SampleWorkerPool :: FragmentName (int sequenceNumber, int fileNumber) const {
+
+	RGString name = mFragmentPrefix;
+	name << sequenceNumber << "_" << fileNumber << ".txt";
+	return name;
+}
+
+
+void SampleWorkerPool :: RedirectOutputToFragments () {
+
+	list<RGFile*>::iterator fIterator;
+	int i = 0;
+
+	for (fIterator = mOutputFiles.begin (); fIterator != mOutputFiles.end (); fIterator++) {
+
+		if (!(*fIterator)->Reopen (FragmentName (mSelf.mSequenceNumber, i).GetData (), "wb"))
+			AbandonWorker ();
+
+		i++;
+	}
+
+	if (freopen (FragmentName (mSelf.mSequenceNumber, i).GetData (), "wb", stdout) == NULL)
+		AbandonWorker ();
+}
+
+
+void SampleWorkerPool :: AppendFragments (const SampleWorker& worker, bool merge) {
+
+	//  Appends each fragment to the file it was redirected from (the last one is stdout) and removes it
+
+	list<RGFile*>::iterator fIterator = mOutputFiles.begin ();
+	int nFiles = (int) mOutputFiles.size ();
+	int i;
+	FILE* target;
+	FILE* fragment;
+	RGString name;
+	char buffer [8192];
+	size_t n;
+
+	if (merge)
+		cout.flush ();
+
+	for (i=0; i<=nFiles; i++) {
+
+		if (i < nFiles) {
+
+			target = (*fIterator)->GetFile ();
+			fIterator++;
+		}
+
+		else
+			target = stdout;
+
+		name = FragmentName (worker.mSequenceNumber, i);
+
+		if (merge) {
+
+			fragment = fopen (name.GetData (), "rb");
+
+			if (fragment != NULL) {
+
+				while ((n = fread (buffer, 1, 8192, fragment)) > 0)
+					fwrite (buffer, 1, n, target);
+
+				fclose (fragment);
+			}
+		}
+
+		remove (name.GetData ());
+	}
+
+	if (merge)
+		fflush (stdout);
+}
+
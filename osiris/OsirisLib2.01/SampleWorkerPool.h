@@ -0,0 +1,120 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: SampleWorkerPool.h
+*
+*/
+//
+//  class SampleWorkerPool analyzes samples concurrently, each in its own worker process (POSIX only).  A worker inherits the
+//  directory state (ladders, BaseLoci, messages) by fork, writes its share of the shared output files to fragment files and
+//  journals its changes to directory level objects.  The parent collects workers strictly in sample order:  it hands each one
+//  the current message, link and signal numbering before the worker writes its reports, then appends the fragments and replays
+//  the journal.  The result is the same, byte for byte, as a serial analysis.  The worker names BaseLoci and journal targets by
+//  directory object ID and messages by scope and element, never by address:  the parent resolves them in its own memory
+//
+
+#ifndef _SAMPLEWORKERPOOL_H_
+#define _SAMPLEWORKERPOOL_H_
+
+#include "rgstring.h"
+#include "rgfile.h"
+#include "rgdlist.h"
+#include "SmartMessagingObject.h"
+
+#include <list>
+
+using namespace std;
+
+
+struct SampleWorkerResult {
+
+	bool mSampleWasPrepared;	// if true, mBaseLoci contains the BaseLoci of the sample (not owned)
+	bool mIsPositiveControl;
+	bool mIsNegativeControl;
+	bool mSampleOK;		// analyzed without failing
+	RGDList mBaseLoci;
+
+	SampleWorkerResult ();
+	void Reset ();
+};
+
+
+struct SampleWorker {
+
+	int mPid;
+	int mToWorker;
+	int mFromWorker;
+	int mSequenceNumber;
+	bool mStartedAfterOthers;	// other samples were still in progress when this one started
+	int mDirectoryObjectsAtStart;	// directory objects with smaller IDs existed in both processes at fork
+	RGString mFileName;
+};
+
+
+class SampleWorkerPool {
+
+public:
+	SampleWorkerPool (int maxWorkers, const RGString& fragmentPrefix);
+	~SampleWorkerPool ();
+
+	static bool IsAvailable ();
+
+	void AddOutputFile (RGFile* file);	// files written by sample analysis; redirected to fragments in each worker
+
+	bool IsFull () const { return (int)mWorkers.size () >= mMaxWorkers; }
+	bool IsEmpty () const { return mWorkers.empty (); }
+	RGString GetNextFileName () const;	// file name of oldest worker
+
+	// Parent functions
+
+	int StartWorker (const RGString& fileName);	// returns 1 in parent, 0 in worker and < 0 if no worker could be started
+	int CollectNextWorker (SampleWorkerResult& result);	// returns 0 if merged and < 0 if the sample must be reanalyzed serially
+
+	// Worker functions
+
+	void WaitForReportingTurn ();
+	void FinishWorker (const SampleWorkerResult& result);	// does not return
+	void AbandonWorker ();	// does not return
+
+protected:
+	int mMaxWorkers;
+	RGString mFragmentPrefix;
+	list<SampleWorker> mWorkers;
+	list<RGFile*> mOutputFiles;
+	int mSequenceNumber;
+	void (*mPreviousSigPipeHandler) (int);	// restored when the pool is destroyed
+
+	// Worker state
+	SampleWorker mSelf;
+	SmartMessageJournal mJournal;
+	unsigned long mSignalIDAtStart;
+
+	RGString FragmentName (int sequenceNumber, int fileNumber) const;
+	void RedirectOutputToFragments ();
+	void AppendFragments (const SampleWorker& worker, bool merge);
+};
+
+
+#endif  /*  _SAMPLEWORKERPOOL_H_  */
@@ -0,0 +1,696 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: SignalKernels.cpp
+*
+*/
+//
+//  class SignalKernels:  vector kernels on sample arrays.  See SignalKernels.h
+//
+
+#include "SignalKernels.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#define _SIGNALKERNELS_X86_
+#define SIGNALKERNELS_TARGET(x) __attribute__ ((target (x)))
+#include <immintrin.h>
+#elif defined (_MSC_VER) && (defined (_M_X64) || defined (_M_IX86))
+#define _SIGNALKERNELS_X86_
+#define SIGNALKERNELS_TARGET(x)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+
+//  exp (-x) is computed as 2^-k * exp (r), with k the nearest integer to x / ln 2 and |r| <= ln 2 / 2, and exp (r) from its
+//  Taylor polynomial of degree 13 (truncation error below 1e-17), summed as even and odd parts in r^2 to shorten the dependency
+//  chain.  Above ExpMaximumArgument, 2^-k is not a normal double, so those arguments go to exp ().  Adding ExpRoundingConstant
+//  (1.5 * 2^52) rounds to an integer in the low order bits
+
+static const double ExpMaximumArgument = 708.0;
+static const double ExpRoundingConstant = 6755399441055744.0;
+static const double ExpLog2e = 1.4426950408889634074;
+static const double ExpLn2High = 6.93147180369123816490e-01;
+static const double ExpLn2Low = 1.90821492927058770002e-10;
+static const int ExpDegree = 13;
+
+static const double ExpCoefficients [ExpDegree + 1] = {1.0, 1.0, 1.0 / 2.0, 1.0 / 6.0, 1.0 / 24.0, 1.0 / 120.0, 1.0 / 720.0,
+	1.0 / 5040.0, 1.0 / 40320.0, 1.0 / 362880.0, 1.0 / 3628800.0, 1.0 / 39916800.0, 1.0 / 479001600.0, 1.0 / 6227020800.0};
+
+int SignalKernels::VectorLevel = -1;
+int SignalKernels::VectorExpValid = -1;
+const double SignalKernels::VectorExpErrorBound = 1.0e-14;
+
+
+#ifdef _SIGNALKERNELS_X86_
+
+SIGNALKERNELS_TARGET ("sse2")
+static double DotProductSSE2 (const double* a, const double* b, int n) {
+
+	__m128d s0 = _mm_setzero_pd ();
+	__m128d s1 = _mm_setzero_pd ();
+	int i;
+
+	for (i=0; i+4<=n; i+=4) {
+
+		s0 = _mm_add_pd (s0, _mm_mul_pd (_mm_loadu_pd (a + i), _mm_loadu_pd (b + i)));
+		s1 = _mm_add_pd (s1, _mm_mul_pd (_mm_loadu_pd (a + i + 2), _mm_loadu_pd (b + i + 2)));
+	}
+
+	double lanes [2];
+	_mm_storeu_pd (lanes, _mm_add_pd (s0, s1));
+	double s = lanes [0] + lanes [1];
+
+	for (; i<n; i++)
+		s += a [i] * b [i];
+
+	return s;
+}
+
+
+SIGNALKERNELS_TARGET ("avx2")
+static double DotProductAVX2 (const double* a, const double* b, int n) {
+
+	__m256d s0 = _mm256_setzero_pd ();
+	__m256d s1 = _mm256_setzero_pd ();
+	int i;
+
+	for (i=0; i+8<=n; i+=8) {
+
+		s0 = _mm256_add_pd (s0, _mm256_mul_pd (_mm256_loadu_pd (a + i), _mm256_loadu_pd (b + i)));
+		s1 = _mm256_add_pd (s1, _mm256_mul_pd (_mm256_loadu_pd (a + i + 4), _mm256_loadu_pd (b + i + 4)));
+	}
+
+	double lanes [4];
+	_mm256_storeu_pd (lanes, _mm256_add_pd (s0, s1));
+	double s = (lanes [0] + lanes [1]) + (lanes [2] + lanes [3]);
+
+	for (; i<n; i++)
+		s += a [i] * b [i];
+
+	return s;
+}
+
+
+SIGNALKERNELS_TARGET ("sse2")
+static inline __m128d NegativeExpCoreSSE2 (__m128d a) {
+
+	//  exp (-a) for 0 <= a <= ExpMaximumArgument;  other arguments are clamped to that range
+
+	const __m128d zero = _mm_setzero_pd ();
+	const __m128d rounding = _mm_set1_pd (ExpRoundingConstant);
+	__m128d t = _mm_sub_pd (zero, _mm_min_pd (_mm_max_pd (a, zero), _mm_set1_pd (ExpMaximumArgument)));
+	__m128d kd = _mm_add_pd (_mm_mul_pd (t, _mm_set1_pd (ExpLog2e)), rounding);
+	__m128d k = _mm_sub_pd (kd, rounding);
+	__m128d r = _mm_sub_pd (_mm_sub_pd (t, _mm_mul_pd (k, _mm_set1_pd (ExpLn2High))), _mm_mul_pd (k, _mm_set1_pd (ExpLn2Low)));
+	__m128d r2 = _mm_mul_pd (r, r);
+	__m128d pEven = _mm_set1_pd (ExpCoefficients [ExpDegree - 1]);
+	__m128d pOdd = _mm_set1_pd (ExpCoefficients [ExpDegree]);
+
+	for (int j=ExpDegree-3; j>=0; j-=2) {
+
+		pEven = _mm_add_pd (_mm_mul_pd (pEven, r2), _mm_set1_pd (ExpCoefficients [j]));
+		pOdd = _mm_add_pd (_mm_mul_pd (pOdd, r2), _mm_set1_pd (ExpCoefficients [j + 1]));
+	}
+
+	__m128i twoToK = _mm_slli_epi64 (_mm_add_epi64 (_mm_castpd_si128 (kd), _mm_set1_epi64x (1023)), 52);
+	return _mm_mul_pd (_mm_add_pd (pEven, _mm_mul_pd (pOdd, r)), _mm_castsi128_pd (twoToK));
+}
+
+
+SIGNALKERNELS_TARGET ("avx2")
+static inline __m256d NegativeExpCoreAVX2 (__m256d a) {
+
+	const __m256d zero = _mm256_setzero_pd ();
+	const __m256d rounding = _mm256_set1_pd (ExpRoundingConstant);
+	__m256d t = _mm256_sub_pd (zero, _mm256_min_pd (_mm256_max_pd (a, zero), _mm256_set1_pd (ExpMaximumArgument)));
+	__m256d kd = _mm256_add_pd (_mm256_mul_pd (t, _mm256_set1_pd (ExpLog2e)), rounding);
+	__m256d k = _mm256_sub_pd (kd, rounding);
+	__m256d r = _mm256_sub_pd (_mm256_sub_pd (t, _mm256_mul_pd (k, _mm256_set1_pd (ExpLn2High))), _mm256_mul_pd (k, _mm256_set1_pd (ExpLn2Low)));
+	__m256d r2 = _mm256_mul_pd (r, r);
+	__m256d pEven = _mm256_set1_pd (ExpCoefficients [ExpDegree - 1]);
+	__m256d pOdd = _mm256_set1_pd (ExpCoefficients [ExpDegree]);
+
+	for (int j=ExpDegree-3; j>=0; j-=2) {
+
+		pEven = _mm256_add_pd (_mm256_mul_pd (pEven, r2), _mm256_set1_pd (ExpCoefficients [j]));
+		pOdd = _mm256_add_pd (_mm256_mul_pd (pOdd, r2), _mm256_set1_pd (ExpCoefficients [j + 1]));
+	}
+
+	__m256i twoToK = _mm256_slli_epi64 (_mm256_add_epi64 (_mm256_castpd_si256 (kd), _mm256_set1_epi64x (1023)), 52);
+	return _mm256_mul_pd (_mm256_add_pd (pEven, _mm256_mul_pd (pOdd, r)), _mm256_castsi256_pd (twoToK));
+}
+
+
+SIGNALKERNELS_TARGET ("sse2")
+static void NegativeExpSSE2 (const double* x, double* y, int n) {
+
+	const __m128d maxArgument = _mm_set1_pd (ExpMaximumArgument);
+	__m128d a;
+	int i;
+	int j;
+
+	for (i=0; i+2<=n; i+=2) {
+
+		a = _mm_loadu_pd (x + i);
+		_mm_storeu_pd (y + i, NegativeExpCoreSSE2 (a));
+
+		if (_mm_movemask_pd (_mm_cmpgt_pd (a, maxArgument)) != 0) {
+
+			for (j=i; j<i+2; j++) {
+
+				if (x [j] > ExpMaximumArgument)
+					y [j] = exp (-x [j]);
+			}
+		}
+	}
+
+	for (; i<n; i++)
+		y [i] = exp (-x [i]);
+}
+
+
+SIGNALKERNELS_TARGET ("avx2")
+static void NegativeExpAVX2 (const double* x, double* y, int n) {
+
+	const __m256d maxArgument = _mm256_set1_pd (ExpMaximumArgument);
+	__m256d a;
+	int i;
+	int j;
+
+	for (i=0; i+4<=n; i+=4) {
+
+		a = _mm256_loadu_pd (x + i);
+		_mm256_storeu_pd (y + i, NegativeExpCoreAVX2 (a));
+
+		if (_mm256_movemask_pd (_mm256_cmp_pd (a, maxArgument, _CMP_GT_OQ)) != 0) {
+
+			for (j=i; j<i+4; j++) {
+
+				if (x [j] > ExpMaximumArgument)
+					y [j] = exp (-x [j]);
+			}
+		}
+	}
+
+	if (i < n)
+		NegativeExpSSE2 (x + i, y + i, n - i);
+}
+
+
+SIGNALKERNELS_TARGET ("sse2")
+static void PeakValuesSSE2 (double x0, double spacing, int first, int count, double mean, double sigma, int degree, double scale, double* y) {
+
+	const __m128d maxArgument = _mm_set1_pd (ExpMaximumArgument);
+	const __m128d x0v = _mm_set1_pd (x0);
+	const __m128d spacingv = _mm_set1_pd (spacing);
+	const __m128d meanv = _mm_set1_pd (mean);
+	const __m128d sigmav = _mm_set1_pd (sigma);
+	const __m128d half = _mm_set1_pd (0.5);
+	const __m128d one = _mm_set1_pd (1.0);
+	const __m128d signBit = _mm_set1_pd (-0.0);
+	const __m128d scalev = _mm_set1_pd (scale);
+	__m128d index = _mm_add_pd (_mm_set1_pd ((double)first), _mm_set_pd (1.0, 0.0));
+	const __m128d step = _mm_set1_pd (2.0);
+	__m128d t;
+	__m128d e;
+	double arguments [2];
+	int i;
+	int j;
+
+	for (i=0; i+2<=count; i+=2) {
+
+		t = _mm_div_pd (_mm_sub_pd (_mm_add_pd (x0v, _mm_mul_pd (index, spacingv)), meanv), sigmav);
+		index = _mm_add_pd (index, step);
+
+		if (degree == 0)
+			e = _mm_mul_pd (t, _mm_mul_pd (half, t));
+
+		else {
+
+			t = _mm_andnot_pd (signBit, t);
+			e = one;
+
+			for (j=0; j<degree; j++)
+				e = _mm_mul_pd (e, t);
+		}
+
+		_mm_storeu_pd (y + i, _mm_mul_pd (scalev, NegativeExpCoreSSE2 (e)));
+
+		if (_mm_movemask_pd (_mm_cmpgt_pd (e, maxArgument)) != 0) {
+
+			_mm_storeu_pd (arguments, e);
+
+			for (j=0; j<2; j++) {
+
+				if (arguments [j] > ExpMaximumArgument)
+					y [i + j] = scale * exp (-arguments [j]);
+			}
+		}
+	}
+
+	for (; i<count; i++)
+		y [i] = SignalKernels::PeakValue (x0, spacing, first + i, mean, sigma, degree, scale);
+}
+
+
+SIGNALKERNELS_TARGET ("avx2")
+static void PeakValuesAVX2 (double x0, double spacing, int first, int count, double mean, double sigma, int degree, double scale, double* y) {
+
+	const __m256d maxArgument = _mm256_set1_pd (ExpMaximumArgument);
+	const __m256d x0v = _mm256_set1_pd (x0);
+	const __m256d spacingv = _mm256_set1_pd (spacing);
+	const __m256d meanv = _mm256_set1_pd (mean);
+	const __m256d sigmav = _mm256_set1_pd (sigma);
+	const __m256d half = _mm256_set1_pd (0.5);
+	const __m256d one = _mm256_set1_pd (1.0);
+	const __m256d signBit = _mm256_set1_pd (-0.0);
+	const __m256d scalev = _mm256_set1_pd (scale);
+	__m256d index = _mm256_add_pd (_mm256_set1_pd ((double)first), _mm256_set_pd (3.0, 2.0, 1.0, 0.0));
+	const __m256d step = _mm256_set1_pd (4.0);
+	__m256d t;
+	__m256d e;
+	double arguments [4];
+	int i;
+	int j;
+
+	for (i=0; i+4<=count; i+=4) {
+
+		t = _mm256_div_pd (_mm256_sub_pd (_mm256_add_pd (x0v, _mm256_mul_pd (index, spacingv)), meanv), sigmav);
+		index = _mm256_add_pd (index, step);
+
+		if (degree == 0)
+			e = _mm256_mul_pd (t, _mm256_mul_pd (half, t));
+
+		else {
+
+			t = _mm256_andnot_pd (signBit, t);
+			e = one;
+
+			for (j=0; j<degree; j++)
+				e = _mm256_mul_pd (e, t);
+		}
+
+		_mm256_storeu_pd (y + i, _mm256_mul_pd (scalev, NegativeExpCoreAVX2 (e)));
+
+		if (_mm256_movemask_pd (_mm256_cmp_pd (e, maxArgument, _CMP_GT_OQ)) != 0) {
+
+			_mm256_storeu_pd (arguments, e);
+
+			for (j=0; j<4; j++) {
+
+				if (arguments [j] > ExpMaximumArgument)
+					y [i + j] = scale * exp (-arguments [j]);
+			}
+		}
+	}
+
+	if (i < count)
+		PeakValuesSSE2 (x0, spacing, first + i, count - i, mean, sigma, degree, scale, y + i);
+}
+
+
+//  Two samples of a 16 bit big endian array, as doubles:  swap the bytes, sign extend to 32 bits and convert
+
+SIGNALKERNELS_TARGET ("sse2")
+static inline __m128d DecodeBigEndianINT16SSE2 (const unsigned char* p) {
+
+	int pair;
+	memcpy (&pair, p, sizeof (int));
+	__m128i x = _mm_cvtsi32_si128 (pair);
+	x = _mm_or_si128 (_mm_slli_epi16 (x, 8), _mm_srli_epi16 (x, 8));
+	x = _mm_srai_epi32 (_mm_unpacklo_epi16 (x, x), 16);
+	return _mm_cvtepi32_pd (x);
+}
+
+
+SIGNALKERNELS_TARGET ("sse2")
+static void ColorCorrectSSE2 (const unsigned char* const* raw, int nChannels, int first, int n, const double* matrix, double** corrected) {
+
+	__m128d x [SIGNALKERNELS_MAXCOLORCHANNELS];
+	__m128d sum;
+	int i;
+	int j;
+	int k;
+	const double* row;
+
+	for (k=first; k+2<=n; k+=2) {
+
+		for (j=0; j<nChannels; j++)
+			x [j] = DecodeBigEndianINT16SSE2 (raw [j] + 2 * k);
+
+		row = matrix;
+
+		for (i=0; i<nChannels; i++) {
+
+			sum = _mm_setzero_pd ();
+
+			for (j=0; j<nChannels; j++)
+				sum = _mm_add_pd (sum, _mm_mul_pd (_mm_set1_pd (row [j]), x [j]));
+
+			_mm_storeu_pd (corrected [i] + k, sum);
+			row += nChannels;
+		}
+	}
+
+	if (k < n)
+		SignalKernels::ColorCorrectSerial (raw, nChannels, k, n, matrix, corrected);
+}
+
+
+SIGNALKERNELS_TARGET ("avx2")
+static void ColorCorrectAVX2 (const unsigned char* const* raw, int nChannels, int n, const double* matrix, double** corrected) {
+
+	//  Four samples at a time; the byte shuffle swaps each pair
+
+	const __m128i swap = _mm_setr_epi8 (1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+	__m256d x [SIGNALKERNELS_MAXCOLORCHANNELS];
+	__m256d sum;
+	__m128i quad;
+	int i;
+	int j;
+	int k;
+	const double* row;
+
+	for (k=0; k+4<=n; k+=4) {
+
+		for (j=0; j<nChannels; j++) {
+
+			quad = _mm_shuffle_epi8 (_mm_loadl_epi64 ((const __m128i*) (raw [j] + 2 * k)), swap);
+			x [j] = _mm256_cvtepi32_pd (_mm_cvtepi16_epi32 (quad));
+		}
+
+		row = matrix;
+
+		for (i=0; i<nChannels; i++) {
+
+			sum = _mm256_setzero_pd ();
+
+			for (j=0; j<nChannels; j++)
+				sum = _mm256_add_pd (sum, _mm256_mul_pd (_mm256_set1_pd (row [j]), x [j]));
+
+			_mm256_storeu_pd (corrected [i] + k, sum);
+			row += nChannels;
+		}
+	}
+
+	if (k < n)
+		ColorCorrectSSE2 (raw, nChannels, k, n, matrix, corrected);
+}
+
+#endif
+
+
+int SignalKernels :: GetVectorLevel () {
+
+	if (VectorLevel < 0)
+		VectorLevel = FindVectorLevel ();
+
+	return VectorLevel;
+}
+
+
+const char* SignalKernels :: GetVectorLevelName () {
+
+	switch (GetVectorLevel ()) {
+
+		case SIGNALKERNELS_AVX2:
+			return "AVX2";
+
+		case SIGNALKERNELS_SSE2:
+			return "SSE2";
+	}
+
+	return "scalar";
+}
+
+
+double SignalKernels :: VectorDotProduct (const double* a, const double* b, int n) {
+
+	if (n <= 0)
+		return 0.0;
+
+#ifdef _SIGNALKERNELS_X86_
+	switch (GetVectorLevel ()) {
+
+		case SIGNALKERNELS_AVX2:
+			return DotProductAVX2 (a, b, n);
+
+		case SIGNALKERNELS_SSE2:
+			return DotProductSSE2 (a, b, n);
+	}
+#endif
+
+	double sum = 0.0;
+
+	for (int i=0; i<n; i++)
+		sum += a [i] * b [i];
+
+	return sum;
+}
+
+
+void SignalKernels :: ColorCorrect (const unsigned char* const* raw, int nChannels, int n, const double* matrix, double** corrected) {
+
+	if (n <= 0)
+		return;
+
+#ifdef _SIGNALKERNELS_X86_
+	if (nChannels <= SIGNALKERNELS_MAXCOLORCHANNELS) {
+
+		switch (GetVectorLevel ()) {
+
+			case SIGNALKERNELS_AVX2:
+				ColorCorrectAVX2 (raw, nChannels, n, matrix, corrected);
+				return;
+
+			case SIGNALKERNELS_SSE2:
+				ColorCorrectSSE2 (raw, nChannels, 0, n, matrix, corrected);
+				return;
+		}
+	}
+#endif
+
+	ColorCorrectSerial (raw, nChannels, 0, n, matrix, corrected);
+}
+
+
+void SignalKernels :: ColorCorrectSerial (const unsigned char* const* raw, int nChannels, int first, int n, const double* matrix, double** corrected) {
+
+	double* x = new double [nChannels];
+	double sum;
+	const unsigned char* p;
+	const double* row;
+	int i;
+	int j;
+	int k;
+
+	for (k=first; k<n; k++) {
+
+		for (j=0; j<nChannels; j++) {
+
+			p = raw [j] + 2 * k;
+			x [j] = (double)(short)((p [0] << 8) | p [1]);
+		}
+
+		row = matrix;
+
+		for (i=0; i<nChannels; i++) {
+
+			sum = 0.0;
+
+			for (j=0; j<nChannels; j++)
+				sum += row [j] * x [j];
+
+			corrected [i][k] = sum;
+			row += nChannels;
+		}
+	}
+
+	delete[] x;
+}
+
+
+double SignalKernels :: PeakValue (double x0, double spacing, int i, double mean, double sigma, int degree, double scale) {
+
+	//  Same operations, in the same order, as Gaussian::Value (degree 0) and SuperGaussian::Value
+
+	double temp = (x0 + i * spacing - mean) / sigma;
+
+	if (degree == 0) {
+
+		temp *= 0.5 * temp;
+		return scale * exp (-temp);
+	}
+
+	temp = fabs (temp);
+	double exponent = 1.0;
+
+	for (int j=0; j<degree; j++)
+		exponent *= temp;
+
+	return scale * exp (-exponent);
+}
+
+
+void SignalKernels :: VectorPeakValues (double x0, double spacing, int first, int count, double mean, double sigma, int degree, double scale, double* y) {
+
+#ifdef _SIGNALKERNELS_X86_
+	if (VectorExpIsValid ()) {
+
+		switch (GetVectorLevel ()) {
+
+			case SIGNALKERNELS_AVX2:
+				PeakValuesAVX2 (x0, spacing, first, count, mean, sigma, degree, scale, y);
+				return;
+
+			case SIGNALKERNELS_SSE2:
+				PeakValuesSSE2 (x0, spacing, first, count, mean, sigma, degree, scale, y);
+				return;
+		}
+	}
+#endif
+
+	for (int i=0; i<count; i++)
+		y [i] = PeakValue (x0, spacing, first + i, mean, sigma, degree, scale);
+}
+
+
+bool SignalKernels :: VectorExpIsValid () {
+
+	//
+	//  The check covers the whole range of the reduction, 0 <= x <= ExpMaximumArgument, and the neighborhood of 0, where
+	//  most of the arguments from Digitize fall
+	//
+
+	if (VectorExpValid < 0) {
+
+		if (GetVectorLevel () == SIGNALKERNELS_SCALAR)
+			VectorExpValid = 0;
+
+		else if ((MeasureVectorExpError (ExpMaximumArgument, 20000) <= VectorExpErrorBound) && (MeasureVectorExpError (2.0, 20000) <= VectorExpErrorBound))
+			VectorExpValid = 1;
+
+		else
+			VectorExpValid = 0;
+	}
+
+	return VectorExpValid != 0;
+}
+
+
+double SignalKernels :: MeasureVectorExpError (double maxArgument, int nPoints) {
+
+	if (nPoints < 2)
+		nPoints = 2;
+
+	double* x = new double [nPoints];
+	double* y = new double [nPoints];
+	double step = maxArgument / (nPoints - 1);
+	double maxError = 0.0;
+	double exact;
+	double error;
+	int i;
+
+	for (i=0; i<nPoints; i++)
+		x [i] = i * step;
+
+	ApplyVectorNegativeExp (x, y, nPoints);
+
+	for (i=0; i<nPoints; i++) {
+
+		exact = exp (-x [i]);
+		error = fabs (y [i] - exact) / exact;
+
+		if (error != error)		// NaN
+			error = 1.0;
+
+		if (error > maxError)
+			maxError = error;
+	}
+
+	delete[] x;
+	delete[] y;
+	return maxError;
+}
+
+
+void SignalKernels :: ApplyVectorNegativeExp (const double* x, double* y, int n) {
+
+#ifdef _SIGNALKERNELS_X86_
+	switch (GetVectorLevel ()) {
+
+		case SIGNALKERNELS_AVX2:
+			NegativeExpAVX2 (x, y, n);
+			return;
+
+		case SIGNALKERNELS_SSE2:
+			NegativeExpSSE2 (x, y, n);
+			return;
+	}
+#endif
+
+	for (int i=0; i<n; i++)
+		y [i] = exp (-x [i]);
+}
+
+
+int SignalKernels :: FindVectorLevel () {
+
+#if defined (_SIGNALKERNELS_X86_) && defined (__GNUC__)
+	__builtin_cpu_init ();
+
+	if (__builtin_cpu_supports ("avx2"))
+		return SIGNALKERNELS_AVX2;
+
+	if (__builtin_cpu_supports ("sse2"))
+		return SIGNALKERNELS_SSE2;
+#elif defined (_SIGNALKERNELS_X86_)
+	int info [4];
+	__cpuid (info, 0);
+	int maxLeaf = info [0];
+	__cpuid (info, 1);
+	bool hasSSE2 = (info [3] & (1 << 26)) != 0;
+	bool osSavesAVX = ((info [2] & (1 << 27)) != 0) && ((_xgetbv (0) & 6) == 6);
+
+	if (osSavesAVX && (maxLeaf >= 7)) {
+
+		__cpuidex (info, 7, 0);
+
+		if (info [1] & (1 << 5))
+			return SIGNALKERNELS_AVX2;
+	}
+
+	if (hasSSE2)
+		return SIGNALKERNELS_SSE2;
+#endif
+
+	return SIGNALKERNELS_SCALAR;
+}
+
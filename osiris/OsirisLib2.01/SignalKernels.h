@@ -0,0 +1,90 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: SignalKernels.h
+*
+*/
+//
+//  class SignalKernels holds the vector (SSE2 or AVX2, chosen at run time) kernels of the fast Gaussian fit, of
+//  CompositeCurve::Digitize and of color correction
+//
+
+#ifndef _SIGNALKERNELS_H_
+#define _SIGNALKERNELS_H_
+
+
+const int SIGNALKERNELS_SCALAR = 0;
+const int SIGNALKERNELS_SSE2 = 1;
+const int SIGNALKERNELS_AVX2 = 2;
+
+const int SIGNALKERNELS_MAXCOLORCHANNELS = 16;		// more channels than this are color corrected by the serial kernel
+
+
+class SignalKernels {
+
+public:
+	static int GetVectorLevel ();
+	static const char* GetVectorLevelName ();
+
+	static double VectorDotProduct (const double* a, const double* b, int n);
+
+	//
+	//  ColorCorrect sets corrected [i][k] to the sum over j of matrix [i * nChannels + j] * raw [j][k], 0 <= i, j < nChannels and
+	//  0 <= k < n, where raw [j] is an array of 16 bit big endian integers as stored in an .fsa file.  Each sample is decoded once
+	//  and each product is added in order of j, starting from 0.0, so the vector kernels give the serial result to the last bit.
+	//  ColorCorrectSerial does samples first <= k < n
+	//
+
+	static void ColorCorrect (const unsigned char* const* raw, int nChannels, int n, const double* matrix, double** corrected);
+	static void ColorCorrectSerial (const unsigned char* const* raw, int nChannels, int first, int n, const double* matrix, double** corrected);
+
+	//
+	//  The vector exponential computes exp (-x) for x >= 0 from a reduced polynomial, two or four at a time, with relative error
+	//  at most GetVectorExpErrorBound ().  The bound is checked against exp () on first use; if the check fails, or there are no
+	//  vector instructions, the kernels below call exp () instead.
+	//
+	//  PeakValue is scale * exp (-e), where t = (x0 + i * spacing - mean) / sigma and e = t * (0.5 * t) for degree 0, as in
+	//  Gaussian::Value, or |t|^degree, as in SuperGaussian::Value.  VectorPeakValues sets y [k] to PeakValue at i = first + k,
+	//  0 <= k < count, computing e with the same operations, so that only the exponential differs
+	//
+
+	static double GetVectorExpErrorBound () { return VectorExpErrorBound; }
+	static bool VectorExpIsValid ();
+	static double MeasureVectorExpError (double maxArgument, int nPoints);	// largest relative error against exp () on [0, maxArgument]
+
+	static double PeakValue (double x0, double spacing, int i, double mean, double sigma, int degree, double scale);
+	static void VectorPeakValues (double x0, double spacing, int first, int count, double mean, double sigma, int degree, double scale, double* y);
+
+protected:
+	static int VectorLevel;
+	static int VectorExpValid;
+	static const double VectorExpErrorBound;
+	static int FindVectorLevel ();
+	static void ApplyVectorNegativeExp (const double* x, double* y, int n);
+};
+
+
+#endif  /*  _SIGNALKERNELS_H_  */
+
@@ -36,6 +36,7 @@
 #include "rgtokenizer.h"
 #include "SmartNotice.h"
 #include "STRLCAnalysis.h"
+#include "AnalysisTiming.h"
 
 
 
@@ -43,22 +44,6 @@ PERSISTENT_DEFINITION (SmartMessageData, _SMARTMESSAGEDATA_, "SmartMessageData")
 PERSISTENT_DEFINITION (SmartMessageReporter, _SMARTMESSAGEREPORTER_, "SmartMessageReporter")
 
 
-RGHashTable* SmartMessage :: OverAllMessageTable = new RGHashTable (113);
-RGDList SmartMessage :: OverAllMessageList;
-int SmartMessage :: NumberOfMessageTables = 7;
-RGDList** SmartMessage :: MessageTables = new RGDList* [SmartMessage::NumberOfMessageTables];
-SmartMessage*** SmartMessage :: MessageArrays = new SmartMessage** [SmartMessage::NumberOfMessageTables];
-int* SmartMessage :: MessageArraySize = new int [SmartMessage::NumberOfMessageTables];
-int SmartMessage :: LastStage = 0;
-int** SmartMessage :: StageStartIndex = new int* [SmartMessage::NumberOfMessageTables];
-int** SmartMessage :: StageEndIndex = new int* [SmartMessage::NumberOfMessageTables];
-bool SmartMessage :: Initialized = false;
-int* SmartMessage :: MessageValueArraySize = new int [SmartMessage::NumberOfMessageTables];
-int SmartMessage :: DebugMode = 0;
-RGFile* SmartMessage :: DebugFile = NULL;
-RGTextOutput* SmartMessage :: DebugTextOutput = NULL;
-RGString SmartMessage :: MsgBookText;
-int SmartMessage :: SeverityTrigger = 15;
 SmartMessageKill SmartMessage :: kill;
 
 
@@ -76,6 +61,84 @@ SmartMessageKill :: ~SmartMessageKill () {
 }
 
 
+AnalysisMessageBook :: AnalysisMessageBook () : OverAllMessageTable (new RGHashTable (113)), NumberOfMessageTables (7),
+LastStage (0), Initialized (false), DebugMode (0), DataSignalInitialMatrix (NULL), LocusInitialMatrix (NULL),
+BaseLocusInitialMatrix (NULL), ChannelDataInitialMatrix (NULL), CoreBioComponentInitialMatrix (NULL), AnalysisInitialMatrix (NULL) {
+
+	MessageTables = new RGDList* [NumberOfMessageTables];
+	MessageArrays = new SmartMessage** [NumberOfMessageTables];
+	MessageArraySize = new int [NumberOfMessageTables];
+	StageStartIndex = new int* [NumberOfMessageTables];
+	StageEndIndex = new int* [NumberOfMessageTables];
+	MessageValueArraySize = new int [NumberOfMessageTables];
+}
+
+
+AnalysisMessageBook :: ~AnalysisMessageBook () {
+
+	ClearTables ();
+	delete[] DataSignalInitialMatrix;
+	delete[] LocusInitialMatrix;
+	delete[] BaseLocusInitialMatrix;
+	delete[] ChannelDataInitialMatrix;
+	delete[] CoreBioComponentInitialMatrix;
+	delete[] AnalysisInitialMatrix;
+}
+
+
+void AnalysisMessageBook :: ClearTables () {
+
+	int i;
+
+	for (i=1; i<=NumberOfMessageTables; i++) {
+
+		if (Initialized) {
+			
+			MessageTables [i]->Clear ();
+			delete MessageTables [i];
+			delete[] MessageArrays [i];
+		}
+	}
+
+	delete[] MessageTables;
+	delete[] MessageArrays;
+	delete[] MessageArraySize;
+	delete[] MessageValueArraySize;
+
+	if (OverAllMessageTable != NULL) {
+
+		OverAllMessageTable->Clear ();
+		delete OverAllMessageTable;
+	}
+
+	OverAllMessageList.ClearAndDelete ();
+
+	if (Initialized) {
+
+		for (i=1; i<=NumberOfMessageTables; i++) {
+
+			delete[] StageStartIndex [i];
+			delete[] StageEndIndex [i];
+		}
+	}
+
+	delete[] StageStartIndex;
+	delete[] StageEndIndex;
+
+	//  Cleared once:  the tables cannot be reloaded
+
+	OverAllMessageTable = NULL;
+	NumberOfMessageTables = 0;
+	MessageTables = NULL;
+	MessageArrays = NULL;
+	MessageArraySize = NULL;
+	MessageValueArraySize = NULL;
+	StageStartIndex = NULL;
+	StageEndIndex = NULL;
+	Initialized = false;
+}
+
+
 /*
 int mIntegerData;
 RGString mName;
@@ -242,24 +305,25 @@ void SmartMessage :: SaveAll (RGVOutStream& f) const {
 
 int SmartMessage :: AssembleMessages () {
 
-	RGDListIterator it (OverAllMessageList);
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	RGDListIterator it (book.OverAllMessageList);
 	SmartMessage* nextMsg;
 	int i;
 	int whichList;
 	SmartNotice* assocNotice;
 	SmartNoticeWarehouse* warehouse = new SmartNoticeWarehouse;
 
-	NumberOfMessageTables--;
-	MessageTables [0] = NULL;
-	MessageArraySize [0] = 0;
+	book.NumberOfMessageTables--;
+	book.MessageTables [0] = NULL;
+	book.MessageArraySize [0] = 0;
 
-	for (i=1; i<=NumberOfMessageTables; i++)
-		MessageTables [i] = new RGDList;
+	for (i=1; i<=book.NumberOfMessageTables; i++)
+		book.MessageTables [i] = new RGDList;
 
 	while (nextMsg = (SmartMessage*) it ()) {
 
 		whichList = nextMsg->GetScope ();
-		MessageTables [whichList]->Append (nextMsg);
+		book.MessageTables [whichList]->Append (nextMsg);
 	}
 
 	RGDListIterator* msgIt;
@@ -268,23 +332,23 @@ int SmartMessage :: AssembleMessages () {
 	int stage;
 	int valueSize = 0;
 
-	for (i=1; i<=NumberOfMessageTables; i++) {
+	for (i=1; i<=book.NumberOfMessageTables; i++) {
 
-		msgIt = new RGDListIterator (*MessageTables [i]);
-		size = MessageTables [i]->Entries ();
-		MessageArraySize [i] = size;
-		MessageArrays [i] = new SmartMessage* [size];
+		msgIt = new RGDListIterator (*book.MessageTables [i]);
+		size = book.MessageTables [i]->Entries ();
+		book.MessageArraySize [i] = size;
+		book.MessageArrays [i] = new SmartMessage* [size];
 
 		while (nextMsg = (SmartMessage*) (*msgIt) ())
 			valueSize += nextMsg->NumberOfIntegerValueCellsNeeded ();
 
-		MessageValueArraySize [i] = valueSize;
+		book.MessageValueArraySize [i] = valueSize;
 
 		j = 0;
 		valueSize = 0;
 		int currentValueSize;
 
-		for (stage=0; stage<=LastStage; stage++) {		// test stage 0
+		for (stage=0; stage<=book.LastStage; stage++) {		// test stage 0
 
 			msgIt->Reset ();
 			
@@ -293,7 +357,7 @@ int SmartMessage :: AssembleMessages () {
 				if (nextMsg->GetStage () != stage)
 					continue;
 
-				MessageArrays [i][j] = nextMsg;
+				book.MessageArrays [i][j] = nextMsg;
 				nextMsg->SetWhichElementInMsgArray (j);
 				currentValueSize = nextMsg->NumberOfIntegerValueCellsNeeded ();
 
@@ -322,40 +386,40 @@ int SmartMessage :: AssembleMessages () {
 		}
 	}
 
-	for (i=1; i<=NumberOfMessageTables; i++) {
+	for (i=1; i<=book.NumberOfMessageTables; i++) {
 
-		StageStartIndex [i] = new int [LastStage + 1];
-		StageEndIndex [i] = new int [LastStage + 1];
+		book.StageStartIndex [i] = new int [book.LastStage + 1];
+		book.StageEndIndex [i] = new int [book.LastStage + 1];
 	}
 
 	int endOfLastStage;
 	int endOfThisStage;
 
-	for (i=1; i<=NumberOfMessageTables; i++) {
+	for (i=1; i<=book.NumberOfMessageTables; i++) {
 
 		endOfLastStage = -1;
 
-		for (stage=0; stage<=LastStage; stage++) {		// test stage 0
+		for (stage=0; stage<=book.LastStage; stage++) {		// test stage 0
 
-			StageStartIndex [i][stage] = endOfLastStage + 1;
+			book.StageStartIndex [i][stage] = endOfLastStage + 1;
 			endOfThisStage = endOfLastStage;
-			size = MessageArraySize [i];
+			size = book.MessageArraySize [i];
 
-			for (j=StageStartIndex [i][stage]; j<size; j++) {
+			for (j=book.StageStartIndex [i][stage]; j<size; j++) {
 
-				if (MessageArrays [i][j]->GetStage () == stage)
+				if (book.MessageArrays [i][j]->GetStage () == stage)
 					endOfThisStage = j;
 
 				else
 					break;
 			}
 
-			StageEndIndex [i][stage] = endOfThisStage;
+			book.StageEndIndex [i][stage] = endOfThisStage;
 			endOfLastStage = endOfThisStage;
 		}
 	}
 
-	Initialized = true;
+	book.Initialized = true;
 	delete warehouse;
 	return 0;
 }
@@ -363,6 +427,7 @@ int SmartMessage :: AssembleMessages () {
 
 int SmartMessage :: AssembleMessagesV4 (const RGString& inputString, size_t startIndex, SmartMessage* prototype) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	int status = ImportMessageDynamicDataV4 (inputString, startIndex, prototype);
 
 	if (status < 0)
@@ -379,23 +444,23 @@ int SmartMessage :: AssembleMessagesV4 (const RGString& inputString, size_t star
 	int stage;
 	int valueSize = 0;
 
-	for (i=1; i<=NumberOfMessageTables; i++) {
+	for (i=1; i<=book.NumberOfMessageTables; i++) {
 
-		msgIt = new RGDListIterator (*MessageTables [i]);
-		size = MessageTables [i]->Entries ();
-		MessageArraySize [i] = size;
-		MessageArrays [i] = new SmartMessage* [size];
+		msgIt = new RGDListIterator (*book.MessageTables [i]);
+		size = book.MessageTables [i]->Entries ();
+		book.MessageArraySize [i] = size;
+		book.MessageArrays [i] = new SmartMessage* [size];
 
 		while (nextMsg = (SmartMessage*) (*msgIt) ())
 			valueSize += nextMsg->NumberOfIntegerValueCellsNeeded ();
 
-		MessageValueArraySize [i] = valueSize;
+		book.MessageValueArraySize [i] = valueSize;
 
 		j = 0;
 		valueSize = 0;
 		int currentValueSize;
 
-		for (stage=0; stage<=LastStage; stage++) {		// test stage 0
+		for (stage=0; stage<=book.LastStage; stage++) {		// test stage 0
 
 			msgIt->Reset ();
 			
@@ -404,7 +469,7 @@ int SmartMessage :: AssembleMessagesV4 (const RGString& inputString, size_t star
 				if (nextMsg->GetStage () != stage)
 					continue;
 
-				MessageArrays [i][j] = nextMsg;
+				book.MessageArrays [i][j] = nextMsg;
 				nextMsg->SetWhichElementInMsgArray (j);
 				currentValueSize = nextMsg->NumberOfIntegerValueCellsNeeded ();
 
@@ -434,40 +499,40 @@ int SmartMessage :: AssembleMessagesV4 (const RGString& inputString, size_t star
 		}
 	}
 
-	for (i=1; i<=NumberOfMessageTables; i++) {
+	for (i=1; i<=book.NumberOfMessageTables; i++) {
 
-		StageStartIndex [i] = new int [LastStage + 1];
-		StageEndIndex [i] = new int [LastStage + 1];
+		book.StageStartIndex [i] = new int [book.LastStage + 1];
+		book.StageEndIndex [i] = new int [book.LastStage + 1];
 	}
 
 	int endOfLastStage;
 	int endOfThisStage;
 
-	for (i=1; i<=NumberOfMessageTables; i++) {
+	for (i=1; i<=book.NumberOfMessageTables; i++) {
 
 		endOfLastStage = -1;
 
-		for (stage=0; stage<=LastStage; stage++) {		// test stage 0
+		for (stage=0; stage<=book.LastStage; stage++) {		// test stage 0
 
-			StageStartIndex [i][stage] = endOfLastStage + 1;
+			book.StageStartIndex [i][stage] = endOfLastStage + 1;
 			endOfThisStage = endOfLastStage;
-			size = MessageArraySize [i];
+			size = book.MessageArraySize [i];
 
-			for (j=StageStartIndex [i][stage]; j<size; j++) {
+			for (j=book.StageStartIndex [i][stage]; j<size; j++) {
 
-				if (MessageArrays [i][j]->GetStage () == stage)
+				if (book.MessageArrays [i][j]->GetStage () == stage)
 					endOfThisStage = j;
 
 				else
 					break;
 			}
 
-			StageEndIndex [i][stage] = endOfThisStage;
+			book.StageEndIndex [i][stage] = endOfThisStage;
 			endOfLastStage = endOfThisStage;
 		}
 	}
 
-	Initialized = true;
+	book.Initialized = true;
 	delete warehouse;
 	return 0;
 }
@@ -475,6 +540,7 @@ int SmartMessage :: AssembleMessagesV4 (const RGString& inputString, size_t star
 
 int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, size_t startIndex, SmartMessage* prototype) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	RGString localInputString (inputString);
 
 	size_t endIndex;
@@ -512,16 +578,16 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 //	startIndex = 0;
 	int currentStage = 0;
 	SmartMessage* nextSM;
-	NumberOfMessageTables--;
-	int numberOfScopes = NumberOfMessageTables;
+	book.NumberOfMessageTables--;
+	int numberOfScopes = book.NumberOfMessageTables;
 
 	for (i=1; i<=numberOfScopes; i++) {
 
-		MessageTables [i] = new RGDList;
+		book.MessageTables [i] = new RGDList;
 	}
 
-	MessageTables [0] = NULL;
-	MessageArraySize [0] = 0;
+	book.MessageTables [0] = NULL;
+	book.MessageArraySize [0] = 0;
 
 	// Now interpret the data in TestUnitsSampleLevel and TestUnitsDirectoryLevel...
 
@@ -582,7 +648,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 		}
 
 		stageLevelStart = stageLevelEnd;
-		LastStage = currentStage = numericString.ConvertToInteger ();
+		book.LastStage = currentStage = numericString.ConvertToInteger ();
 
 		if (!stageDynamicsSearch.FindNextTag (stageLevelStart, stageLevelEnd, stageString)) {
 
@@ -624,7 +690,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 
 					finalDetailStart = finalDetailEnd;
 					prototype->SetName (nameString);
-					nextSM = (SmartMessage*) OverAllMessageTable->Find (prototype);
+					nextSM = (SmartMessage*) book.OverAllMessageTable->Find (prototype);
 
 					if (nextSM == NULL) {
 
@@ -640,7 +706,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 
 					nextSM->SetScope (scope);
 					nextSM->SetStage (currentStage);
-					MessageTables [scope]->Append (nextSM);
+					book.MessageTables [scope]->Append (nextSM);
 					availableForTriggers.Insert (nextSM);
 				}
 			}
@@ -655,7 +721,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 
 					finalDetailStart = finalDetailEnd;
 					prototype->SetName (nameString);
-					nextSM = (SmartMessage*) OverAllMessageTable->Find (prototype);
+					nextSM = (SmartMessage*) book.OverAllMessageTable->Find (prototype);
 
 					if (nextSM == NULL) {
 
@@ -671,7 +737,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 
 					nextSM->SetScope (scope);
 					nextSM->SetStage (currentStage);
-					MessageTables [scope]->Append (nextSM);
+					book.MessageTables [scope]->Append (nextSM);
 					availableForTriggers.Insert (nextSM);
 				}
 			}
@@ -697,7 +763,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 					subExpressionString = expressionString.ExtractSubstring (equalsLocation + 1, expressionString.Length () - 1);
 
 					prototype->SetName (nameString);
-					nextSM = (SmartMessage*) OverAllMessageTable->Find (prototype);
+					nextSM = (SmartMessage*) book.OverAllMessageTable->Find (prototype);
 
 					if (nextSM == NULL) {
 
@@ -714,7 +780,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 					nextSM->SetScope (scope);
 					nextSM->SetStage (currentStage);
 					nextSM->ImportTestCriterion (subExpressionString);
-					MessageTables [scope]->Append (nextSM);
+					book.MessageTables [scope]->Append (nextSM);
 					availableForTriggers.Insert (nextSM);
 				}
 			}
@@ -752,7 +818,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 
 					nameString.FindAndReplaceAllSubstrings (" ", "");
 					prototype->SetName (nameString);
-					nextSM = (SmartMessage*) OverAllMessageTable->Find (prototype);
+					nextSM = (SmartMessage*) book.OverAllMessageTable->Find (prototype);
 
 					if (nextSM == NULL) {
 
@@ -854,7 +920,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 
 					finalDetailStart = finalDetailEnd;
 					prototype->SetName (nameString);
-					nextSM = (SmartMessage*) OverAllMessageTable->Find (prototype);
+					nextSM = (SmartMessage*) book.OverAllMessageTable->Find (prototype);
 
 					if (nextSM == NULL) {
 
@@ -870,7 +936,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 
 					nextSM->SetScope (scope);
 					nextSM->SetStage (currentStage);
-					MessageTables [scope]->Append (nextSM);
+					book.MessageTables [scope]->Append (nextSM);
 					availableForTriggers.Insert (nextSM);
 				}
 			}
@@ -885,7 +951,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 
 					finalDetailStart = finalDetailEnd;
 					prototype->SetName (nameString);
-					nextSM = (SmartMessage*) OverAllMessageTable->Find (prototype);
+					nextSM = (SmartMessage*) book.OverAllMessageTable->Find (prototype);
 
 					if (nextSM == NULL) {
 
@@ -901,7 +967,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 
 					nextSM->SetScope (scope);
 					nextSM->SetStage (currentStage);
-					MessageTables [scope]->Append (nextSM);
+					book.MessageTables [scope]->Append (nextSM);
 					availableForTriggers.Insert (nextSM);
 				}
 			}
@@ -927,7 +993,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 					subExpressionString = expressionString.ExtractSubstring (equalsLocation + 1, expressionString.Length () - 1);
 
 					prototype->SetName (nameString);
-					nextSM = (SmartMessage*) OverAllMessageTable->Find (prototype);
+					nextSM = (SmartMessage*) book.OverAllMessageTable->Find (prototype);
 
 					if (nextSM == NULL) {
 
@@ -944,7 +1010,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 					nextSM->SetScope (scope);
 					nextSM->SetStage (currentStage);
 					nextSM->ImportTestCriterion (subExpressionString);
-					MessageTables [scope]->Append (nextSM);
+					book.MessageTables [scope]->Append (nextSM);
 					availableForTriggers.Insert (nextSM);
 				}
 			}
@@ -1018,7 +1084,7 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 
 					nameString.FindAndReplaceAllSubstrings (" ", "");
 					prototype->SetName (nameString);
-					nextSM = (SmartMessage*) OverAllMessageTable->Find (prototype);
+					nextSM = (SmartMessage*) book.OverAllMessageTable->Find (prototype);
 
 					if (nextSM == NULL) {
 
@@ -1058,7 +1124,8 @@ int SmartMessage :: ImportMessageDynamicDataV4 (const RGString& inputString, siz
 
 int SmartMessage :: GetMessageIndex (const SmartMessage* msg, int& whichDataArray) {
 
-	SmartMessage* foundMsg = (SmartMessage*) OverAllMessageTable->Find (msg);
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	SmartMessage* foundMsg = (SmartMessage*) book.OverAllMessageTable->Find (msg);
 
 	if (foundMsg == NULL) {
 
@@ -1073,6 +1140,7 @@ int SmartMessage :: GetMessageIndex (const SmartMessage* msg, int& whichDataArra
 
 int SmartMessage :: LoadAllMessages (const RGString& inputString, const SmartMessage* prototype) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	int stage;
 	RGString stageString;
 	RGString testUnitString;
@@ -1094,10 +1162,10 @@ int SmartMessage :: LoadAllMessages (const RGString& inputString, const SmartMes
 	int status = 0;
 	int i;
 
-	for (i=1; i<NumberOfMessageTables; i++) {
+	for (i=1; i<book.NumberOfMessageTables; i++) {
 
-		StageStartIndex [i] = NULL;
-		StageEndIndex [i] = NULL;
+		book.StageStartIndex [i] = NULL;
+		book.StageEndIndex [i] = NULL;
 	}
 
 	if (debugSearch.FindNextTag (startIndex, endIndex, debugString)) {
@@ -1105,14 +1173,14 @@ int SmartMessage :: LoadAllMessages (const RGString& inputString, const SmartMes
 		debugInt = debugString.ConvertToInteger ();
 
 		if (debugInt == 0)
-			DebugMode = 0;
+			book.DebugMode = 0;
 
 		else
-			DebugMode = 1;
+			book.DebugMode = 1;
 	}
 
 	else
-		DebugMode = 0;
+		book.DebugMode = 0;
 
 	while (testUnitSearch.FindNextTag (startIndex, endIndex, testUnitString)) {
 
@@ -1126,15 +1194,15 @@ int SmartMessage :: LoadAllMessages (const RGString& inputString, const SmartMes
 
 		stage = stageString.ConvertToInteger ();
 		testStartIndex = testEndIndex;
-		LastStage = stage;
+		book.LastStage = stage;
 
 		while (msgSearch.FindNextTag (testStartIndex, testEndIndex, msgString)) {
 
 			testStartIndex = testEndIndex;
 			nextMsg = prototype->GetNewMessage (msgString);
 			nextMsg->SetStage (stage);
-			OverAllMessageTable->Append (nextMsg);
-			OverAllMessageList.Append (nextMsg);
+			book.OverAllMessageTable->Append (nextMsg);
+			book.OverAllMessageList.Append (nextMsg);
 
 			if (!nextMsg->IsValid ())
 				status = -1;
@@ -1150,57 +1218,31 @@ int SmartMessage :: LoadAllMessages (const RGString& inputString, const SmartMes
 
 void SmartMessage :: ClearAllMessages () {
 
-	int i;
-//	int j;
-
-	for (i=1; i<=NumberOfMessageTables; i++) {
-
-		if (Initialized) {
-			
-			MessageTables [i]->Clear ();
-			delete MessageTables [i];
-			delete[] MessageArrays [i];
-		}
-	}
-
-	delete[] MessageTables;
-	delete[] MessageArrays;
-	delete[] MessageArraySize;
-	delete[] MessageValueArraySize;
-	OverAllMessageTable->Clear ();
-	delete OverAllMessageTable;
-	OverAllMessageList.ClearAndDelete ();
-
-	if (Initialized) {
-
-		for (i=1; i<=NumberOfMessageTables; i++) {
-
-			delete[] StageStartIndex [i];
-			delete[] StageEndIndex [i];
-		}
-	}
-
-	delete[] StageStartIndex;
-	delete[] StageEndIndex;
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+	book.ClearTables ();
 
-	if (DebugMode != 0) {
+	if (book.DebugMode != 0) {
 
-		if (DebugFile != NULL)
-			DebugFile->Flush ();
+		if (scratch.MessageDebugFile != NULL)
+			scratch.MessageDebugFile->Flush ();
 
-		delete DebugTextOutput;
-		delete DebugFile;
+		delete scratch.MessageDebugText;
+		delete scratch.MessageDebugFile;
+		scratch.MessageDebugText = NULL;
+		scratch.MessageDebugFile = NULL;
 	}
 }
 
 
 int SmartMessage :: GetStartIndexForListAndStage (int list, int stage) {
 
-	if (stage > LastStage)
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	if (stage > book.LastStage)
 		return 0;
 
-	if (StageStartIndex [list] != NULL)
-		return StageStartIndex [list][stage];
+	if (book.StageStartIndex [list] != NULL)
+		return book.StageStartIndex [list][stage];
 
 	return 0;
 }
@@ -1208,11 +1250,12 @@ int SmartMessage :: GetStartIndexForListAndStage (int list, int stage) {
 
 int SmartMessage :: GetEndIndexForListAndStage (int list, int stage) {
 
-	if (stage > LastStage)
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	if (stage > book.LastStage)
 		return -1;
 
-	if (StageEndIndex [list] != NULL)
-		return StageEndIndex [list][stage];
+	if (book.StageEndIndex [list] != NULL)
+		return book.StageEndIndex [list][stage];
 
 	return -1;
 }
@@ -1220,6 +1263,7 @@ int SmartMessage :: GetEndIndexForListAndStage (int list, int stage) {
 
 int SmartMessage :: LoadAllMessagesV4 (const RGString& inputString, SmartMessage* prototype) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	RGString declarationString;
 	RGString msgString;
 	RGString overallString (inputString);
@@ -1240,10 +1284,10 @@ int SmartMessage :: LoadAllMessagesV4 (const RGString& inputString, SmartMessage
 	int status = 0;
 	int i;
 
-	for (i=1; i<NumberOfMessageTables; i++) {
+	for (i=1; i<book.NumberOfMessageTables; i++) {
 
-		StageStartIndex [i] = NULL;
-		StageEndIndex [i] = NULL;
+		book.StageStartIndex [i] = NULL;
+		book.StageEndIndex [i] = NULL;
 	}
 
 	if (buildTimeSearch.FindNextTag (startIndex, endIndex, buildString)) {
@@ -1258,14 +1302,14 @@ int SmartMessage :: LoadAllMessagesV4 (const RGString& inputString, SmartMessage
 		startIndex = endIndex;
 
 		if (debugInt == 0)
-			DebugMode = 0;
+			book.DebugMode = 0;
 
 		else
-			DebugMode = 1;
+			book.DebugMode = 1;
 	}
 
 	else
-		DebugMode = 0;
+		book.DebugMode = 0;
 
 	if (!declarationsSearch.FindNextTag (startIndex, endIndex, declarationString)) {
 
@@ -1281,7 +1325,7 @@ int SmartMessage :: LoadAllMessagesV4 (const RGString& inputString, SmartMessage
 
 		testStartIndex = testEndIndex;
 		nextMsg = prototype->GetNewMessageV4 (msgString);
-		OverAllMessageTable->Append (nextMsg);
+		book.OverAllMessageTable->Append (nextMsg);
 //		OverAllMessageList.Append (nextMsg);
 
 		if (!nextMsg->IsValid ())
@@ -1297,7 +1341,8 @@ int SmartMessage :: LoadAllMessagesV4 (const RGString& inputString, SmartMessage
 
 int SmartMessage :: CompileAllMessages () {
 
-	RGHashTableIterator it (*OverAllMessageTable);
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	RGHashTableIterator it (*book.OverAllMessageTable);
 	SmartMessage* nextMessage;
 	int status = 0;
 	bool result;
@@ -1316,7 +1361,8 @@ int SmartMessage :: CompileAllMessages () {
 
 int SmartMessage :: InitializeAllMessages () {
 
-	RGHashTableIterator it (*OverAllMessageTable);
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	RGHashTableIterator it (*book.OverAllMessageTable);
 	SmartMessage* nextMessage;
 	int status = 0;
 	int result;
@@ -1335,12 +1381,16 @@ int SmartMessage :: InitializeAllMessages () {
 
 bool SmartMessage :: EvaluateAllMessages (bool* const msgMatrix, RGDList& subObjects, int stage, int scope) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	int startIndex = GetStartIndexForListAndStage (scope, stage);
 	int endIndex = GetEndIndexForListAndStage (scope, stage);
 	int i;
 
 	for (i=startIndex; i<=endIndex; i++)
-		MessageArrays [scope][i]->Evaluate (msgMatrix, subObjects);
+		book.MessageArrays [scope][i]->Evaluate (msgMatrix, subObjects);
+
+	if (endIndex >= startIndex)
+		AnalysisTiming::Count (TIMINGSMARTMESSAGES, endIndex - startIndex + 1);
 
 	return true;
 }
@@ -1348,27 +1398,32 @@ bool SmartMessage :: EvaluateAllMessages (bool* const msgMatrix, RGDList& subObj
 
 bool SmartMessage :: EvaluateAllMessages (SmartMessagingComm& comm, int numHigherObjects, int stage, int scope) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	int startIndex = GetStartIndexForListAndStage (scope, stage);
 	int endIndex = GetEndIndexForListAndStage (scope, stage);
 	int i;
 
 	for (i=startIndex; i<=endIndex; i++) {
 
-		MessageArrays [scope][i]->Evaluate (comm, numHigherObjects);
+		book.MessageArrays [scope][i]->Evaluate (comm, numHigherObjects);
 	}
 
+	if (endIndex >= startIndex)
+		AnalysisTiming::Count (TIMINGSMARTMESSAGES, endIndex - startIndex + 1);
+
 	return true;
 }
 
 
 bool SmartMessage :: SetTriggersForAllMessages (bool* const msgMatrix, bool* const higherMsgMatrix, int stage, int scope) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	int startIndex = GetStartIndexForListAndStage (scope, stage);
 	int endIndex = GetEndIndexForListAndStage (scope, stage);
 	int i;
 
 	for (i=startIndex; i<=endIndex; i++)
-		MessageArrays [scope][i]->SetAllTriggers (msgMatrix, higherMsgMatrix);
+		book.MessageArrays [scope][i]->SetAllTriggers (msgMatrix, higherMsgMatrix);
 
 	return true;
 }
@@ -1376,12 +1431,13 @@ bool SmartMessage :: SetTriggersForAllMessages (bool* const msgMatrix, bool* con
 
 bool SmartMessage :: SetTriggersForAllMessages (bool* const msgMatrix, bool* const higherMsgMatrix, RGHashTable* messageDataTable, int stage, int scope, int higherScope, int intBP, const RGString& alleleName) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	int startIndex = GetStartIndexForListAndStage (scope, stage);
 	int endIndex = GetEndIndexForListAndStage (scope, stage);
 	int i;
 
 	for (i=startIndex; i<=endIndex; i++)
-		MessageArrays [scope][i]->SetAllTriggers (msgMatrix, higherMsgMatrix);
+		book.MessageArrays [scope][i]->SetAllTriggers (msgMatrix, higherMsgMatrix);
 
 	return true;
 }
@@ -1389,12 +1445,13 @@ bool SmartMessage :: SetTriggersForAllMessages (bool* const msgMatrix, bool* con
 
 bool SmartMessage :: SetTriggersForAllMessages (SmartMessagingComm& comm, int numHigherObjects, int stage, int scope, int intBP, const RGString& alleleName) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	int startIndex = GetStartIndexForListAndStage (scope, stage);
 	int endIndex = GetEndIndexForListAndStage (scope, stage);
 	int i;
 
 	for (i=startIndex; i<=endIndex; i++)
-		MessageArrays [scope][i]->SetAllTriggers (comm, numHigherObjects, stage, intBP, alleleName);
+		book.MessageArrays [scope][i]->SetAllTriggers (comm, numHigherObjects, stage, intBP, alleleName);
 
 	return true;
 }
@@ -1402,12 +1459,13 @@ bool SmartMessage :: SetTriggersForAllMessages (SmartMessagingComm& comm, int nu
 
 bool SmartMessage :: SetTriggersForAllMessages (SmartMessagingComm& comm, int numHigherObjects, int stage, int scope) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	int startIndex = GetStartIndexForListAndStage (scope, stage);
 	int endIndex = GetEndIndexForListAndStage (scope, stage);
 	int i;
 
 	for (i=startIndex; i<=endIndex; i++)
-		MessageArrays [scope][i]->SetAllTriggers (comm, numHigherObjects, stage);
+		book.MessageArrays [scope][i]->SetAllTriggers (comm, numHigherObjects, stage);
 
 	return true;
 }
@@ -1415,12 +1473,13 @@ bool SmartMessage :: SetTriggersForAllMessages (SmartMessagingComm& comm, int nu
 
 bool SmartMessage :: EvaluateAllReports (const bool* msgMatrix, bool* const reportMatrix, int scope) {
 
-	int size = MessageArraySize [scope];
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	int size = book.MessageArraySize [scope];
 	int i;
 
 	for (i=0; i<size; i++) {
 
-		reportMatrix [i] = MessageArrays [scope][i]->EvaluateReport (msgMatrix);
+		reportMatrix [i] = book.MessageArrays [scope][i]->EvaluateReport (msgMatrix);
 	}
 
 	return true;
@@ -1429,15 +1488,16 @@ bool SmartMessage :: EvaluateAllReports (const bool* msgMatrix, bool* const repo
 
 bool SmartMessage :: TestAllMessagesForCall (const bool* msgMatrix, int scope) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	// This should only be called for scope = 1, DataSignal, because the decision to call or not
 	// only applies to peaks
 	
-	int size = MessageArraySize [scope];
+	int size = book.MessageArraySize [scope];
 	int i;
 
 	for (i=0; i<size; i++) {
 
-		if (!MessageArrays [scope][i]->EvaluateCall (msgMatrix))
+		if (!book.MessageArrays [scope][i]->EvaluateCall (msgMatrix))
 			return false;
 	}
 
@@ -1447,17 +1507,18 @@ bool SmartMessage :: TestAllMessagesForCall (const bool* msgMatrix, int scope) {
 
 int SmartMessage :: FindRestrictionLevel (const bool* msgMatrix, int scope) {
 
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	// This should only be called for scope = 1, DataSignal, because restriction levels
 	// only apply to peaks, at least in the current version
 	
-	int size = MessageArraySize [scope];
+	int size = book.MessageArraySize [scope];
 	int i;
 	int restrictionLevel = -1;
 	int currentLevel;
 
 	for (i=0; i<size; i++) {
 
-		currentLevel = MessageArrays [scope][i]->EvaluateRestrictionLevel (msgMatrix);
+		currentLevel = book.MessageArrays [scope][i]->EvaluateRestrictionLevel (msgMatrix);
 		
 		if (currentLevel > restrictionLevel)
 			restrictionLevel = currentLevel;
@@ -1469,12 +1530,13 @@ int SmartMessage :: FindRestrictionLevel (const bool* msgMatrix, int scope) {
 
 bool SmartMessage :: EvaluateAllReportLevels (const bool* msgMatrix, int* const reportLevelMatrix, int scope) {
 
-	int size = MessageArraySize [scope];
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	int size = book.MessageArraySize [scope];
 	int i;
 
 	for (i=0; i<size; i++) {
 
-		reportLevelMatrix [i] = MessageArrays [scope][i]->EvaluateReportLevel (msgMatrix);
+		reportLevelMatrix [i] = book.MessageArrays [scope][i]->EvaluateReportLevel (msgMatrix);
 	}
 
 	return true;
@@ -1483,10 +1545,11 @@ bool SmartMessage :: EvaluateAllReportLevels (const bool* msgMatrix, int* const
 
 int SmartMessage :: GetSizeOfArrayForScope (int scope) {
 
-	if (Initialized) {
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	if (book.Initialized) {
 
-		if ((1 <= scope) && (scope <= NumberOfMessageTables))
-			return MessageArraySize [scope];
+		if ((1 <= scope) && (scope <= book.NumberOfMessageTables))
+			return book.MessageArraySize [scope];
 
 		return 0;
 	}
@@ -1497,10 +1560,11 @@ int SmartMessage :: GetSizeOfArrayForScope (int scope) {
 
 int SmartMessage :: GetSizeOfValueArrayForScope (int scope) {
 
-	if (Initialized) {
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	if (book.Initialized) {
 
-		if ((1 <= scope) && (scope <= NumberOfMessageTables))
-			return MessageValueArraySize [scope];
+		if ((1 <= scope) && (scope <= book.NumberOfMessageTables))
+			return book.MessageValueArraySize [scope];
 
 		return 0;
 	}
@@ -1511,21 +1575,24 @@ int SmartMessage :: GetSizeOfValueArrayForScope (int scope) {
 
 bool SmartMessage :: CreateDebugFile (const RGString& fullPathDebugName) {
 
-	if (!DebugMode)
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	AnalysisScratch& scratch = AnalysisContext::GetCurrentScratch ();
+
+	if (!book.DebugMode)
 		return false;
 
-	DebugFile = new RGFile (fullPathDebugName, "wt");
+	scratch.MessageDebugFile = new RGFile (fullPathDebugName, "wt");
 
-	if (!DebugFile->isValid ()) {
+	if (!scratch.MessageDebugFile->isValid ()) {
 
 		cout << "Could not open debug file named:  " << fullPathDebugName << endl;
-		delete DebugFile;
-		DebugFile = NULL;
-		DebugMode = 0;
+		delete scratch.MessageDebugFile;
+		scratch.MessageDebugFile = NULL;
+		book.DebugMode = 0;
 		return false;
 	}
 
-	DebugTextOutput = new RGTextOutput (DebugFile, FALSE);
+	scratch.MessageDebugText = new RGTextOutput (scratch.MessageDebugFile, FALSE);
 	cout << "Message Book Debug File opened successfully" << endl;
 	return true;
 }
@@ -1533,18 +1600,21 @@ bool SmartMessage :: CreateDebugFile (const RGString& fullPathDebugName) {
 
 bool SmartMessage :: OutputDebugString (const RGString& string) {
 
-	if (DebugTextOutput == NULL)
+	RGTextOutput* debugText = AnalysisContext::GetCurrentScratch ().MessageDebugText;
+
+	if (debugText == NULL)
 		return false;
 
 	Endl endLine;
 
-	*DebugTextOutput << string << endLine;
+	*debugText << string << endLine;
 	return true;
 }
 
 
 int SmartMessage :: LoadAndActivateAllMessages (const RGString& messageFullPathFileName, SmartMessage* prototype) {
 	
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
 	// call this function to set up all SmartMessages
 
 	RGFile inputFile (messageFullPathFileName, "rt");
@@ -1557,7 +1627,7 @@ int SmartMessage :: LoadAndActivateAllMessages (const RGString& messageFullPathF
 
 	RGString inputString;
 	inputString.ReadTextFile (inputFile);
-	SmartMessage::MsgBookText = inputString;
+	book.MsgBookText = inputString;
 
 	int status = SmartMessage::LoadAllMessagesV4 (inputString, prototype);
 
@@ -1589,7 +1659,8 @@ int SmartMessage :: LoadAndActivateAllMessages (const RGString& messageFullPathF
 
 int SmartMessage :: WriteMsgBookFile (RGFile& msgFile) {
 
-	MsgBookText.WriteTextLine (msgFile);
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+	book.MsgBookText.WriteTextLine (msgFile);
 	return 0;
 }
 
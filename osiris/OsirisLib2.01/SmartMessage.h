@@ -43,6 +43,7 @@
 #include "rgfile.h"
 #include "rgvstream.h"
 #include "RGTextOutput.h"
+#include "AnalysisContext.h"
 
 //#include "CoreBioComponent.h"
 //#include "ChannelData.h"
@@ -188,7 +189,7 @@ public:
 
 	static int LoadAllMessages (const RGString& inputString, const SmartMessage* prototype);
 	static void ClearAllMessages ();
-	static int GetLastStage () { return LastStage; }
+	static int GetLastStage () { return AnalysisContext::GetCurrentMessageBook ().LastStage; }
 	static int GetMessageIndex (const SmartMessage* msg, int& whichDataArray);
 	static int GetStartIndexForListAndStage (int list, int stage);
 	static int GetEndIndexForListAndStage (int list, int stage);
@@ -198,11 +199,11 @@ public:
 	virtual SmartMessage* GetNewMessageV4 (const RGString& inputString) const = 0;
 	virtual int ConfigureV4 (const RGString& inputString, size_t startIndex) = 0;
 
-	static void SetDebugMode (int mode) { DebugMode = mode; }
-	static int GetDebugMode () { return DebugMode; }
+	static void SetDebugMode (int mode) { AnalysisContext::GetCurrentMessageBook ().DebugMode = mode; }
+	static int GetDebugMode () { return AnalysisContext::GetCurrentMessageBook ().DebugMode; }
 
-	static int GetSeverityTrigger () { return SeverityTrigger; }
-	static void SetSeverityTrigger (int severity) { SeverityTrigger = severity; }
+	static int GetSeverityTrigger () { return Settings ().SeverityTrigger; }
+	static void SetSeverityTrigger (int severity) { Settings ().SeverityTrigger = severity; }
 
 	static int CompileAllMessages ();
 	static int InitializeAllMessages ();
@@ -216,11 +217,12 @@ public:
 	static bool TestAllMessagesForCall (const bool* msgMatrix, int scope);
 	static int FindRestrictionLevel (const bool* msgMatrix, int scope);
 	static bool EvaluateAllReportLevels (const bool* msgMatrix, int* const reportLevelMatrix, int scope);
-	static bool IsInitialized () { return Initialized; }
+	static bool IsInitialized () { return AnalysisContext::GetCurrentMessageBook ().Initialized; }
 	static int GetSizeOfArrayForScope (int scope);
 	static int GetSizeOfValueArrayForScope (int scope);
-	static SmartMessage* GetSmartMessageForScopeAndElement (int scope, int element) { return MessageArrays [scope][element]; }
+	static SmartMessage* GetSmartMessageForScopeAndElement (int scope, int element) { return AnalysisContext::GetCurrentMessageBook ().MessageArrays [scope][element]; }
 	static bool CreateDebugFile (const RGString& fullPathDebugName);
+	static RGFile* GetDebugFile () { return AnalysisContext::GetCurrentScratch ().MessageDebugFile; }
 	static bool OutputDebugString (const RGString& string);
 
 	static int LoadAndActivateAllMessages (const RGString& messageFullPathFileName, SmartMessage* prototype);  // call this function to set up all SmartMessages
@@ -247,26 +249,11 @@ protected:
 	int mAllowPeakEdit;
 	bool mDebugOn;
 
-	static RGHashTable* OverAllMessageTable;
-	static RGDList OverAllMessageList;
-	static int NumberOfMessageTables;
-	static RGDList** MessageTables;
-	static SmartMessage*** MessageArrays;
-	static int* MessageArraySize;
-	static int LastStage;
-	static int** StageStartIndex;
-	static int** StageEndIndex;
-	static bool Initialized;
-	static int* MessageValueArraySize;
-	static int DebugMode;
-	static RGFile* DebugFile;
-	static RGTextOutput* DebugTextOutput;
-	static RGString MsgBookText;
-	static int SeverityTrigger;
 
 	static int AssembleMessages ();
 	static int AssembleMessagesV4 (const RGString& inputString, size_t startIndex, SmartMessage* prototype);
 	static int ImportMessageDynamicDataV4 (const RGString& inputString, size_t startIndex, SmartMessage* prototype);
+	static SmartMessageSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mSmartMessage; }
 	static SmartMessageKill kill;
 };
 
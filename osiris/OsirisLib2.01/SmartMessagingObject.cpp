@@ -34,7 +34,6 @@
 
 #include "SmartMessagingObject.h"
 
-RGHashTable SmartMessagingObject :: ExportSpecifications;
 
 ABSTRACT_DEFINITION (SmartMessagingObject)
 
@@ -79,29 +78,62 @@ protected:
 
 
 SmartMessagingObject :: SmartMessagingObject () : RGPersistent (), mStageCompleted (0), mTriggerStageCompleted (0), 
-mHighestSeverityLevel (-1), mHighestMessageLevel (-1) {
+mHighestSeverityLevel (-1), mHighestMessageLevel (-1), mDirectoryObjectID (-1) {
 
 }
 
 
 SmartMessagingObject :: SmartMessagingObject (const SmartMessagingObject& smo) : RGPersistent (smo), mStageCompleted (smo.mStageCompleted),
-mTriggerStageCompleted (smo.mTriggerStageCompleted), mHighestSeverityLevel (smo.mHighestSeverityLevel), mHighestMessageLevel (smo.mHighestMessageLevel) {
+mTriggerStageCompleted (smo.mTriggerStageCompleted), mHighestSeverityLevel (smo.mHighestSeverityLevel), mHighestMessageLevel (smo.mHighestMessageLevel),
+mDirectoryObjectID (-1) {
 
 }
 
 
 SmartMessagingObject :: ~SmartMessagingObject () {
 
+	if (mDirectoryObjectID >= 0)
+		AnalysisContext::GetCurrentScratch ().DirectoryObjects [mDirectoryObjectID] = NULL;
+
 	CleanupSmartMessages ();
 }
 
 
+SmartMessagingObject* SmartMessagingObject :: GetDirectoryObject (int id) {
+
+	vector<SmartMessagingObject*>& directoryObjects = AnalysisContext::GetCurrentScratch ().DirectoryObjects;
+
+	if ((id < 0) || (id >= (int) directoryObjects.size ()))
+		return NULL;
+
+	return directoryObjects [id];
+}
+
+
+void SmartMessagingObject :: RegisterDirectoryObject () {
+
+	//  Called from InitializeSmartMessages, in the constructor of the most derived class, where GetObjectScope is known
+
+	if ((mDirectoryObjectID < 0) && (GetObjectScope () >= SmartMessageJournalMinScope)) {
+
+		vector<SmartMessagingObject*>& directoryObjects = AnalysisContext::GetCurrentScratch ().DirectoryObjects;
+		mDirectoryObjectID = (int) directoryObjects.size ();
+		directoryObjects.push_back (this);
+	}
+}
+
+
 void SmartMessagingObject :: SetMessageValue (int scope, int location, bool value) {
 
 	int myScope = GetObjectScope ();
 
 	if (myScope == scope) {
 
+		SmartMessageJournal* journal = GetJournal ();
+
+		if ((journal != NULL) && (myScope >= SmartMessageJournalMinScope))
+			journal->Record (SmartMessageJournal::SetValue, this, scope, location, (int)value, "");
+
 		SmartMessage* msg = SmartMessage::GetSmartMessageForScopeAndElement (scope, location);
 		msg->SetMessageValue (mMessageArray, mValueArray, location, value);
 	}
@@ -131,8 +163,15 @@ void SmartMessagingObject :: SetMessageValue (int scope, int location, bool valu
 	if (useVirtualMethod)
 		SetMessageValue (scope, location, value);
 
-	else if (scope == GetObjectScope ())
+	else if (scope == GetObjectScope ()) {
+
+		SmartMessageJournal* journal = GetJournal ();
+
+		if ((journal != NULL) && (scope >= SmartMessageJournalMinScope))
+			journal->Record (SmartMessageJournal::SetValueDirect, this, scope, location, (int)value, "");
+
 		mMessageArray [location] = value;
+	}
 }
 
 
@@ -237,10 +276,19 @@ int SmartMessagingObject :: GetHighestMessageLevelWithRestrictionSM () const {
 
 void SmartMessagingObject :: SetDataForSmartMessage (const SmartNotice& notice, const RGString& text) {
 
-	if (notice.GetScope () == GetObjectScope ()) {
+	SetDataForSmartMessage (notice.GetScope (), notice.GetMessageIndex (), text);
+}
+
+
+void SmartMessagingObject :: SetDataForSmartMessage (int scope, int index, const RGString& text) {
+
+	if (scope == GetObjectScope ()) {
+
+		SmartMessageJournal* journal = GetJournal ();
+
+		if ((journal != NULL) && (scope >= SmartMessageJournalMinScope))
+			journal->Record (SmartMessageJournal::SetData, this, scope, index, 0, text);
 
-		int index = notice.GetMessageIndex ();
-		int scope = notice.GetScope ();
 		SmartMessageData target (index);
 		SmartMessageData* smd = (SmartMessageData*) mMessageDataTable->Find (&target);
 
@@ -260,13 +308,22 @@ void SmartMessagingObject :: SetDataForSmartMessage (const SmartNotice& notice,
 
 void SmartMessagingObject :: AppendDataForSmartMessage (const SmartNotice& notice, const RGString& text) {
 
+	AppendDataForSmartMessage (notice.GetScope (), notice.GetMessageIndex (), text);
+}
+
+
+void SmartMessagingObject :: AppendDataForSmartMessage (int scope, int index, const RGString& text) {
+
 	if (text.Length () == 0)
 		return;
 
-	if (notice.GetScope () == GetObjectScope ()) {
+	if (scope == GetObjectScope ()) {
+
+		SmartMessageJournal* journal = GetJournal ();
+
+		if ((journal != NULL) && (scope >= SmartMessageJournalMinScope))
+			journal->Record (SmartMessageJournal::AppendData, this, scope, index, 0, text);
 
-		int index = notice.GetMessageIndex ();
-		int scope = notice.GetScope ();
 		SmartMessageData target (index);
 		SmartMessageData* smd = (SmartMessageData*) mMessageDataTable->Find (&target);
 
@@ -278,7 +335,7 @@ void SmartMessagingObject :: AppendDataForSmartMessage (const SmartNotice& notic
 
 		else {
 
-			smd->AppendText (text, notice);
+			smd->AppendText (text, index, scope);
 		}
 	}
 }
@@ -302,6 +359,11 @@ void SmartMessagingObject :: AppendDataForSmartMessage (const SmartNotice& notic
 
 void SmartMessagingObject :: AppendDataForSmartMessage (int scope, int index, int value, const RGString& text) {
 
+	SmartMessageJournal* journal = GetJournal ();
+
+	if ((journal != NULL) && (GetObjectScope () >= SmartMessageJournalMinScope))
+		journal->Record (SmartMessageJournal::AppendTriggerData, this, scope, index, value, text);
+
 	if (scope = GetObjectScope ()) {
 
 		SmartMessage* thisMsg = SmartMessage::GetSmartMessageForScopeAndElement (scope, index);
@@ -430,28 +492,37 @@ void SmartMessagingObject :: MergeAllSmartMessageReporters () {
 
 void SmartMessagingObject :: InsertExportSpecificationsIntoTable (SmartMessage* sm) {
 
-	if (ExportSpecifications.Contains (sm))
+	RGHashTable& exportSpecifications = AnalysisContext::GetCurrentMessageBook ().ExportSpecifications;
+
+	if (exportSpecifications.Contains (sm))
 		return;
 
-	ExportSpecifications.Append (sm);
+	SmartMessageJournal* journal = GetJournal ();
+
+	if (journal != NULL)
+		journal->RecordExportSpecification (sm);
+
+	exportSpecifications.Append (sm);
 }
 
 
 void SmartMessagingObject :: ClearExportSpecifications () {
 
-	ExportSpecifications.Clear ();
+	AnalysisContext::GetCurrentMessageBook ().ExportSpecifications.Clear ();
 }
 
 
 void SmartMessagingObject :: ReportAllExportSpecifications (RGLogBook& oar) {
 
-	if (ExportSpecifications.Entries () == 0)
+	RGHashTable& exportSpecifications = AnalysisContext::GetCurrentMessageBook ().ExportSpecifications;
+
+	if (exportSpecifications.Entries () == 0)
 		return;
 
 	oar.SetOutputLevel (1);
 	oar << "\t<ExportSpecifications>\n";
 
-	RGHashTableIterator it (ExportSpecifications);
+	RGHashTableIterator it (exportSpecifications);
 	SmartMessage* sm;
 
 	while (sm = (SmartMessage*) it ()) {
@@ -469,6 +540,8 @@ void SmartMessagingObject :: ReportAllExportSpecifications (RGLogBook& oar) {
 
 void SmartMessagingObject :: InitializeSmartMessages () {
 
+	RegisterDirectoryObject ();
+
 	if (SmartMessage::IsInitialized ()) {
 
 		int scope = GetObjectScope ();
@@ -515,6 +588,7 @@ void SmartMessagingObject :: InitializeSmartMessages () {
 void SmartMessagingObject :: InitializeSmartMessages (const SmartMessagingObject& smo) {
 
 	int scope = GetObjectScope ();
+	RegisterDirectoryObject ();
 
 	if (SmartMessage::IsInitialized ()) {
 
@@ -604,3 +678,90 @@ void SmartMessagingObject :: CleanupSmartMessages () {
 }
 
 
+
+SmartMessageJournalEntry :: SmartMessageJournalEntry () : mType (0), mTarget (NULL), mMessage (NULL), mScope (0), mIndex (0), mValue (0) {
+
+}
+
+
+SmartMessageJournal :: SmartMessageJournal () : mReadsDirectoryData (false) {
+
+}
+
+
+SmartMessageJournal :: ~SmartMessageJournal () {
+
+}
+
+
+void SmartMessageJournal :: Record (int type, SmartMessagingObject* target, int scope, int index, int value, const RGString& text) {
+
+	SmartMessageJournalEntry entry;
+	entry.mType = type;
+	entry.mTarget = target;
+	entry.mScope = scope;
+	entry.mIndex = index;
+	entry.mValue = value;
+	entry.mText = text;
+	mEntries.push_back (entry);
+}
+
+
+void SmartMessageJournal :: RecordExportSpecification (SmartMessage* sm) {
+
+	SmartMessageJournalEntry entry;
+	entry.mType = ExportSpecification;
+	entry.mMessage = sm;
+	mEntries.push_back (entry);
+}
+
+
+void SmartMessageJournal :: Clear () {
+
+	mEntries.clear ();
+	mReadsDirectoryData = false;
+}
+
+
+void SmartMessageJournal :: Replay () const {
+
+	//  Called with no journal active, so that the replayed changes are not recorded again
+
+	list<SmartMessageJournalEntry>::const_iterator c1Iterator;
+
+	for (c1Iterator = mEntries.begin (); c1Iterator != mEntries.end (); c1Iterator++) {
+
+		const SmartMessageJournalEntry& entry = *c1Iterator;
+
+		switch (entry.mType) {
+
+			case SetValue:
+				entry.mTarget->SetMessageValue (entry.mScope, entry.mIndex, entry.mValue != 0);
+				break;
+
+			case SetValueDirect:
+				entry.mTarget->SetMessageValue (entry.mScope, entry.mIndex, entry.mValue != 0, false);
+				break;
+
+			case SetData:
+				entry.mTarget->SetDataForSmartMessage (entry.mScope, entry.mIndex, entry.mText);
+				break;
+
+			case AppendData:
+				entry.mTarget->AppendDataForSmartMessage (entry.mScope, entry.mIndex, entry.mText);
+				break;
+
+			case AppendTriggerData:
+				entry.mTarget->AppendDataForSmartMessage (entry.mScope, entry.mIndex, entry.mValue, entry.mText);
+				break;
+
+			case ExportSpecification:
+				SmartMessagingObject::InsertExportSpecificationsIntoTable (entry.mMessage);
+				break;
+
+			default:
+				break;
+		}
+	}
+}
+
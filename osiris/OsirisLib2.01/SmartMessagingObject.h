@@ -42,7 +42,13 @@
 #include "SmartNotice.h"
 #include "RGLogBook.h"
 
+#include <list>
+#include <vector>
+
+using namespace std;
+
 const int SmartMessagingCommDepth = 7;
+const int SmartMessageJournalMinScope = 5;	// BaseLocus and directory (STRLCAnalysis) objects
 
 class SmartMessagingObject;
 
@@ -53,6 +59,52 @@ struct SmartMessagingComm {
 };
 
 
+//
+//	SmartMessageJournal records the changes that sample analysis makes to directory level objects.  A worker process analyzing a sample
+//  keeps a journal; the parent process replays it, in sample order, on its own copies of the same objects.  Directory level objects
+//  (scope SmartMessageJournalMinScope and up) are numbered as they are created, so that a worker can name the objects it changed by
+//  number rather than by address, and the parent can tell them from objects created after the worker started
+//
+
+struct SmartMessageJournalEntry {
+
+	int mType;
+	SmartMessagingObject* mTarget;
+	SmartMessage* mMessage;
+	int mScope;
+	int mIndex;
+	int mValue;
+	RGString mText;
+
+	SmartMessageJournalEntry ();
+};
+
+
+class SmartMessageJournal {
+
+public:
+	SmartMessageJournal ();
+	~SmartMessageJournal ();
+
+	enum EntryType { SetValue = 1, SetValueDirect, SetData, AppendData, AppendTriggerData, ExportSpecification };
+
+	void Record (int type, SmartMessagingObject* target, int scope, int index, int value, const RGString& text);
+	void RecordExportSpecification (SmartMessage* sm);
+	void Append (const SmartMessageJournalEntry& entry) { mEntries.push_back (entry); }
+	const list<SmartMessageJournalEntry>& GetEntries () const { return mEntries; }
+
+	void SetReadsDirectoryData (bool reads) { mReadsDirectoryData = reads; }
+	bool ReadsDirectoryData () const { return mReadsDirectoryData; }
+
+	void Clear ();
+	void Replay () const;
+
+protected:
+	list<SmartMessageJournalEntry> mEntries;
+	bool mReadsDirectoryData;
+};
+
+
 class SmartMessagingObject : public RGPersistent {
 
 ABSTRACT_DECLARATION (SmartMessagingObject)
@@ -83,9 +135,11 @@ public:
 	int GetHighestMessageLevelWithRestrictionSM () const;
 
 	void SetDataForSmartMessage (const SmartNotice& notice, const RGString& text);
+	void SetDataForSmartMessage (int scope, int index, const RGString& text);
 	void AppendDataForSmartMessage (const SmartNotice& notice, const RGString& text);
 	void AppendDataForSmartMessage (const SmartNotice& notice, int value);
 	void AppendDataForSmartMessage (const SmartNotice& notice, double value);
+	void AppendDataForSmartMessage (int scope, int index, const RGString& text);
 	void AppendDataForSmartMessage (int scope, int index, int value, const RGString& text);
 
 	virtual void ClearSmartNoticeObjects ();
@@ -102,6 +156,14 @@ public:
 	static void ClearExportSpecifications ();
 	static void ReportAllExportSpecifications (RGLogBook& oar);
 
+	static void SetJournal (SmartMessageJournal* journal) { AnalysisContext::GetCurrentScratch ().Journal = journal; }
+	static SmartMessageJournal* GetJournal () { return AnalysisContext::GetCurrentScratch ().Journal; }
+	static void TestForDirectoryDataRead (int scope) { SmartMessageJournal* journal = GetJournal (); if ((journal != NULL) && (scope >= SmartMessageJournalMinScope)) journal->SetReadsDirectoryData (true); }
+
+	int GetDirectoryObjectID () const { return mDirectoryObjectID; }	// -1 if not a directory level object
+	static int GetNumberOfDirectoryObjects () { return (int) AnalysisContext::GetCurrentScratch ().DirectoryObjects.size (); }
+	static SmartMessagingObject* GetDirectoryObject (int id);	// NULL if id is out of range or the object was deleted
+
 protected:
 	bool* mMessageArray;
 	int* mValueArray;
@@ -114,8 +176,9 @@ protected:
 
 	int mHighestSeverityLevel;
 	int mHighestMessageLevel;
+	int mDirectoryObjectID;	// index in the directory objects of the current context
 
-	static RGHashTable ExportSpecifications;
+	void RegisterDirectoryObject ();
 
 	void InitializeSmartMessages ();
 	void InitializeSmartMessages (const SmartMessagingObject& smo);
@@ -48,6 +48,7 @@ using namespace std;
 
 int SmartNotice::sSubject = 1;
 RGString SmartNotice::sName;
+int SmartNotice::NumberOfNoticeTypes = 0;
 int SmartNoticeWarehouse::ReferenceCount = 0;
 SmartNoticeWarehouse* SmartNoticeWarehouse::OneAndOnlySelf = NULL;
 bool SmartNoticeWarehouse::DebugFlag = false;
@@ -91,6 +92,43 @@ unsigned SmartNotice :: HashNumber (unsigned long Base) const {
 }
 
 
+void SmartNotice :: SetIndexAndScopeForType (int type, int index, int scope) {
+
+	AnalysisMessageBook& book = AnalysisContext::GetCurrentMessageBook ();
+
+	if ((int)book.NoticeIndex.size () < NumberOfNoticeTypes) {
+
+		book.NoticeIndex.resize (NumberOfNoticeTypes, 0);
+		book.NoticeScope.resize (NumberOfNoticeTypes, 0);
+	}
+
+	book.NoticeIndex [type] = index;
+	book.NoticeScope [type] = scope;
+}
+
+
+int SmartNotice :: GetMessageIndexForType (int type) {
+
+	vector<int>& noticeIndex = AnalysisContext::GetCurrentMessageBook ().NoticeIndex;
+
+	if (type < (int)noticeIndex.size ())
+		return noticeIndex [type];
+
+	return 0;
+}
+
+
+int SmartNotice :: GetScopeForType (int type) {
+
+	vector<int>& noticeScope = AnalysisContext::GetCurrentMessageBook ().NoticeScope;
+
+	if (type < (int)noticeScope.size ())
+		return noticeScope [type];
+
+	return 0;
+}
+
+
 
 SmartNoticeWarehouse :: SmartNoticeWarehouse () {
 
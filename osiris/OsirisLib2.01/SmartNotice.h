@@ -40,6 +40,7 @@
 //#include "RGTextOutput.h"
 #include "rgfile.h"
 #include "rghashtable.h"
+#include "AnalysisContext.h"
 
 
 class SmartNotice : public RGPersistent {
@@ -65,9 +66,18 @@ public:
 
 	static int LoadType () { return -1; }
 
+	//  Each SmartNotice subclass has a type number; its message index and scope, which depend on the message book, are kept
+	//  by type in the message book of the current context
+
+	static int GetNextNoticeType () { return NumberOfNoticeTypes++; }
+	static void SetIndexAndScopeForType (int type, int index, int scope);
+	static int GetMessageIndexForType (int type);
+	static int GetScopeForType (int type);
+
 protected:
 	static int sSubject;
 	static RGString sName;
+	static int NumberOfNoticeTypes;
 
 //	int mCurrentMsgNumber;
 };
@@ -63,9 +63,6 @@ PERSISTENT_DEFINITION (STRTestSampleCharacteristicSet, _STRTESTSAMPLECHARACTERIS
 PERSISTENT_DEFINITION (STRTestControlCharacteristicSet, _STRTESTCONTROLCHARACTERISTICSET_, "STRTestControlCharacteristicSet")
 
 
-bool TestCharacteristic::globalTestForNegative = false;
-
-
 TestCharacteristic :: TestCharacteristic () : RGPersistent () {
 
 }
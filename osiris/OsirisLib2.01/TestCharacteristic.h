@@ -39,6 +39,7 @@
 
 #include "rgpersist.h"
 #include "rgdefs.h"
+#include "AnalysisContext.h"
 
 
 //
@@ -96,8 +97,8 @@ public:
 //	virtual unsigned HashNumber (unsigned long Base) const;
 //	virtual Boolean IsEqualTo (const RGPersistent*) const;
 
-	static void SetGlobalTestForNegative (bool test) { globalTestForNegative = test; }
-	static bool GetGlobalTestForNegative () { return globalTestForNegative; }
+	static void SetGlobalTestForNegative (bool test) { Settings ().globalTestForNegative = test; }
+	static bool GetGlobalTestForNegative () { return Settings ().globalTestForNegative; }
 
 	virtual void RestoreAll (RGFile& f);
 	virtual void RestoreAll (RGVInStream& f);
@@ -105,7 +106,7 @@ public:
 	virtual void SaveAll (RGVOutStream& f) const;
 
 protected:
-	static bool globalTestForNegative;
+	static TestCharacteristicSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mTestCharacteristic; }
 };
 
 
@@ -39,15 +39,7 @@
 #include "DataInterval.h"
 #include "DataSignal.h"
 #include "RGTextOutput.h"
-
-
-double TracePrequalification::noiseThreshold = 400.0;
-int TracePrequalification::windowWidth = 9;
-double TracePrequalification::lowHeightThreshold = 0.1;
-double TracePrequalification::lowSlopeThreshold = 0.1;
-int TracePrequalification::minSamplesForSlopeRegression = 4;
-double TracePrequalification::defaultNoiseThreshold = 400.0;
-int TracePrequalification::defaultWindowWidth = 9;
+#include "AnalysisTiming.h"
 
 
 ABSTRACT_DEFINITION (TracePrequalification)
@@ -99,7 +91,7 @@ void TracePrequalification :: SetWindowWidth (int width) {
 //		windowWidth = width + 1;		//  !!! Changed to accomodate odd-valued WindowWidth's
 	
 //	else								//  !!! Changed to accomodate odd-valued WindowWidth's
-		windowWidth = width;
+		Settings ().windowWidth = width;
 }
 
 
@@ -109,17 +101,17 @@ void TracePrequalification :: SetDefaultWindowWidth (int width) {
 //		windowWidth = width + 1;		//  !!! Changed to accomodate odd-valued WindowWidth's
 	
 //	else								//  !!! Changed to accomodate odd-valued WindowWidth's
-		defaultWindowWidth = width;
+		Settings ().defaultWindowWidth = width;
 }
 
 
 void TracePrequalification :: SetMinSamplesForSlopeRegression (int samples) {
 
 	if (samples < 3)
-		minSamplesForSlopeRegression = 3;
+		Settings ().minSamplesForSlopeRegression = 3;
 
 	else
-		minSamplesForSlopeRegression = samples;
+		Settings ().minSamplesForSlopeRegression = samples;
 }
 
 
@@ -626,6 +618,7 @@ DataInterval* STRTracePrequalification :: GetNextDataInterval (NoiseInterval*& C
 					}
 
 					dataInterval = new DataInterval (PeakLeft, currentMode, PeakRight);
+					AnalysisTiming::Count (TIMINGDATAINTERVALS);
 					dataInterval->SetHeight (PeakHeight);
 					dataInterval->SetMass (PeakMass);
 					dataInterval->SetLeftMinimum (Data->Value (PeakLeft));
@@ -735,8 +728,11 @@ DataInterval* STRTracePrequalification :: GetNextDataInterval (NoiseInterval*& C
 					
 		PeakLeft = CurrentIndex;
 		dataInterval = new DataInterval (PeakLeft, PeakCenter, PeakRight);
+		AnalysisTiming::Count (TIMINGDATAINTERVALS);
 		dataInterval->SetHeight (PeakHeight);
 		dataInterval->SetMass (PeakMass);
+		dataInterval->SetLeftMinimum (Data->Value (PeakLeft));
+		dataInterval->SetRightMinimum (Data->Value (PeakRight));
 		dataInterval->SetNumberOfMinima (0);
 		dataInterval->SetMode (currentMode);
 		dataInterval->SetMaxAtMode (currentMaxAtMode);
@@ -1222,6 +1218,7 @@ DataInterval* STRTracePrequalification :: GetNextDataIntervalWithPrecomputedConv
 					}
 
 					dataInterval = new DataInterval (PeakLeft, currentMode, PeakRight);
+					AnalysisTiming::Count (TIMINGDATAINTERVALS);
 					dataInterval->SetHeight (PeakHeight);
 					dataInterval->SetMass (PeakMass);
 					dataInterval->SetLeftMinimum (Data->Value (PeakLeft));
@@ -1363,8 +1360,11 @@ DataInterval* STRTracePrequalification :: GetNextDataIntervalWithPrecomputedConv
 					
 		PeakLeft = CurrentIndex;
 		dataInterval = new DataInterval (PeakLeft, PeakCenter, PeakRight);
+		AnalysisTiming::Count (TIMINGDATAINTERVALS);
 		dataInterval->SetHeight (PeakHeight);
 		dataInterval->SetMass (PeakMass);
+		dataInterval->SetLeftMinimum (Data->Value (PeakLeft));
+		dataInterval->SetRightMinimum (Data->Value (PeakRight));
 		dataInterval->SetNumberOfMinima (0);
 		dataInterval->SetMode (currentMode);
 		dataInterval->SetMaxAtMode (currentMaxAtMode);
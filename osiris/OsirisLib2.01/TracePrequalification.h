@@ -37,6 +37,7 @@
 #define _TRACEPREQUALIFICATION_H_
 
 #include "rgpersist.h"
+#include "AnalysisContext.h"
 
 class RGFile;
 class RGVInStream;
@@ -73,36 +74,29 @@ public:
 	virtual DataInterval* GetNextDataIntervalWithPrecomputedConvolution (NoiseInterval*& noiseInterval, RGTextOutput& text, double minRFU, DataInterval* prevInterval, Boolean print = TRUE) = 0;
 	virtual double GetNorm () const = 0;
 
-	static void SetNoiseThreshold (double threshold) { noiseThreshold = threshold; }
-	static double GetNoiseThreshold () { return noiseThreshold; }
+	static void SetNoiseThreshold (double threshold) { Settings ().noiseThreshold = threshold; }
+	static double GetNoiseThreshold () { return Settings ().noiseThreshold; }
 
-	static void SetDefaultNoiseThreshold (double threshold) { defaultNoiseThreshold = threshold; }
-	static double GetDefaultNoiseThreshold () { return defaultNoiseThreshold; }
+	static void SetDefaultNoiseThreshold (double threshold) { Settings ().defaultNoiseThreshold = threshold; }
+	static double GetDefaultNoiseThreshold () { return Settings ().defaultNoiseThreshold; }
 
 	static void SetWindowWidth (int width);
-	static int GetWindowWidth () { return windowWidth; }
+	static int GetWindowWidth () { return Settings ().windowWidth; }
 
 	static void SetDefaultWindowWidth (int width);
-	static int GetDefaultWindowWidth () { return defaultWindowWidth; }
+	static int GetDefaultWindowWidth () { return Settings ().defaultWindowWidth; }
 
-	static void SetLowHeightThreshold (double height) { lowHeightThreshold = height; }
-	static double GetLowHeightThreshold () { return lowHeightThreshold; }
+	static void SetLowHeightThreshold (double height) { Settings ().lowHeightThreshold = height; }
+	static double GetLowHeightThreshold () { return Settings ().lowHeightThreshold; }
 
-	static void SetLowSlopeThreshold (double slope) { lowSlopeThreshold = slope; }
-	static double GetLowSlopeThreshold () { return lowSlopeThreshold; }
+	static void SetLowSlopeThreshold (double slope) { Settings ().lowSlopeThreshold = slope; }
+	static double GetLowSlopeThreshold () { return Settings ().lowSlopeThreshold; }
 
 	static void SetMinSamplesForSlopeRegression (int samples);
-	static int GetMinSamplesForSlopeRegression () { return minSamplesForSlopeRegression; }
+	static int GetMinSamplesForSlopeRegression () { return Settings ().minSamplesForSlopeRegression; }
 
 private:
-	static double noiseThreshold;
-	static int windowWidth;
-	static double lowHeightThreshold;
-	static double lowSlopeThreshold;
-	static int minSamplesForSlopeRegression;
-
-	static double defaultNoiseThreshold;
-	static int defaultWindowWidth;
+	static TracePrequalificationSettings& Settings () { return AnalysisContext::GetCurrentSettings ().mTracePrequalification; }
 };
 
 
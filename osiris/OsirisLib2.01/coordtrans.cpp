@@ -706,3 +706,175 @@ double CSplineTransform :: CalculateCubic (double abscissa, int interval) {
 	double x = abscissa - Knots[interval];
 	return (((D[interval] * x + C[interval]) * x) + B[interval]) * x + A[interval];
 }
+
+
+
+CSplineCurvature :: CSplineCurvature (const double* knots, int size) : NumberOfKnots (size), NumberOfCubics (size - 1) {
+
+	//  The knot-dependent half of CSplineTransform::Initialize
+
+	int j;
+	h = new double [NumberOfKnots];
+	alpha = new double [NumberOfKnots];
+	lambda = new double [NumberOfKnots];
+	mu = new double [NumberOfKnots];
+	p = new double [NumberOfKnots];
+	q = new double [NumberOfKnots];
+	gamma = new double [NumberOfKnots];
+	u = new double [NumberOfKnots];
+	moments = new double [NumberOfKnots];
+
+	for (j=0; j<NumberOfCubics; j++)
+		h[j+1] = knots[j+1] - knots[j];
+
+	for (j=1; j<NumberOfCubics; j++) {
+
+		alpha[j] = 1.0 / (h[j] + h[j+1]);
+		lambda[j] = h[j+1] * alpha[j];
+		mu[j] = 1.0 - lambda[j];
+	}
+
+	if (NumberOfCubics < 1)
+		return;
+
+	lambda[0] = mu[NumberOfCubics] = 0.0;
+	q[0] = - 0.5 * lambda[0];
+	lambda [NumberOfCubics] = 0.0;
+
+	for (j=1; j<=NumberOfCubics; j++) {
+
+		p[j] = mu[j] * q[j-1] + 2.0;
+		q[j] = - lambda[j] / p[j];
+	}
+}
+
+
+CSplineCurvature :: ~CSplineCurvature () {
+
+	delete[] h;
+	delete[] alpha;
+	delete[] lambda;
+	delete[] mu;
+	delete[] p;
+	delete[] q;
+	delete[] gamma;
+	delete[] u;
+	delete[] moments;
+}
+
+
+double CSplineCurvature :: MaxSecondDerivative (const double* ordinates) {
+
+	return MaxSecondDerivative (ordinates, DOUBLEMAX);
+}
+
+
+double CSplineCurvature :: MaxSecondDerivative (const double* ordinates, double bound) {
+
+	int j;
+	double d;
+	double maxValue = 0.0;
+	double temp;
+
+	if (NumberOfCubics < 1)
+		return 0.0;
+
+	for (j=0; j<NumberOfCubics; j++)
+		gamma[j+1] = (ordinates[j+1] - ordinates[j]) / h[j+1];
+
+	u[0] = 0.5 * 0.0;
+
+	for (j=1; j<NumberOfCubics; j++) {
+
+		d = 6.0 * alpha[j] * (gamma[j+1] - gamma[j]);
+		u[j] = (d - mu[j] * u[j-1]) / p[j];
+	}
+
+	u[NumberOfCubics] = (0.0 - mu[NumberOfCubics] * u[NumberOfCubics-1]) / p[NumberOfCubics];
+	moments [NumberOfCubics] = u[NumberOfCubics];
+
+	for (j=NumberOfCubics-1; j>=0; j--) {
+
+		moments[j] = q[j] * moments[j+1] + u[j];
+		temp = fabs (moments[j]);
+
+		if (temp > maxValue) {
+
+			maxValue = temp;
+
+			if (maxValue >= bound)
+				break;
+		}
+	}
+
+	return maxValue;
+}
+
+
+
+CTransformTable :: CTransformTable (CSplineTransform* transform, int first, int last) : mTransform (transform), mFirst (first),
+mNumberOfEntries (0), mIntervals (NULL) {
+
+	if ((last < first) || !transform->IsValid () || (transform->NumberOfCubics < 1))
+		return;
+
+	mNumberOfEntries = last - first + 1;
+	mIntervals = new int [mNumberOfEntries];
+	int interval = 0;
+	int lastCubic = transform->NumberOfCubics - 1;
+	const double* knots = transform->Knots;
+	double x;
+
+	//  The cubic for each abscissa is the one SearchForInterval finds:  the first whose right knot is not to the left of it
+
+	for (int i=0; i<mNumberOfEntries; i++) {
+
+		x = (double)(first + i);
+
+		while ((interval < lastCubic) && (x > knots [interval + 1]))
+			interval++;
+
+		mIntervals [i] = interval;
+	}
+}
+
+
+CTransformTable :: ~CTransformTable () {
+
+	delete[] mIntervals;
+}
+
+
+double CTransformTable :: Evaluate (double abscissa) {
+
+	if (mIntervals == NULL)
+		return mTransform->EvaluateWithExtrapolation (abscissa);
+
+	if (abscissa < mTransform->Left)
+		return (abscissa - mTransform->Left) * mTransform->mLeft + mTransform->bLeft;
+
+	if (abscissa > mTransform->Right)
+		return (abscissa - mTransform->Right) * mTransform->mRight + mTransform->bRight;
+
+	//  The cubic at floor (abscissa), or at the nearer end of the table, is never to the right of the cubic for abscissa
+
+	double offset = abscissa - (double)mFirst;
+	int interval;
+
+	if (!(offset >= 0.0))
+		interval = 0;
+
+	else if (offset >= (double)(mNumberOfEntries - 1))
+		interval = mIntervals [mNumberOfEntries - 1];
+
+	else
+		interval = mIntervals [(int)offset];
+
+	int lastCubic = mTransform->NumberOfCubics - 1;
+	const double* knots = mTransform->Knots;
+
+	while ((interval < lastCubic) && (abscissa > knots [interval + 1]))
+		interval++;
+
+	return mTransform->CalculateCubic (abscissa, interval);
+}
@@ -146,6 +146,65 @@ private:
 	int SearchForInterval (double abscissa, double start, int startInterval);
 
 	double CalculateCubic (double abscissa, int interval);
+
+	friend class CTransformTable;
+};
+
+
+//
+//  class CSplineCurvature gives CSplineTransform (knots, ordinates, size).MaxSecondDerivative () for many sets of ordinates on
+//  the same knots, without building the transforms.  The maximum second derivative of the natural spline is the largest moment,
+//  and the elimination that yields the moments depends only on the knots, so it is done once, in the constructor.  Each set of
+//  ordinates then costs a forward and a back substitution, with the same operations as CSplineTransform::Initialize, so the
+//  result is the same, bit for bit.  With a bound, the back substitution stops at the first moment that reaches the bound and
+//  returns it; the true maximum is then at least as large
+//
+
+class CSplineCurvature {
+
+public:
+	CSplineCurvature (const double* knots, int size);
+	~CSplineCurvature ();
+
+	double MaxSecondDerivative (const double* ordinates);
+	double MaxSecondDerivative (const double* ordinates, double bound);
+
+private:
+	int NumberOfKnots;
+	int NumberOfCubics;
+
+	double* h;
+	double* alpha;
+	double* lambda;
+	double* mu;
+	double* p;
+	double* q;
+
+	double* gamma;	// the rest are work space for the ordinates
+	double* u;
+	double* moments;
+};
+
+
+//
+//  class CTransformTable holds, for every integer abscissa from first to last, the cubic of a CSplineTransform that covers it.
+//  Evaluate (x) starts from the cubic at floor (x) instead of searching the knots, so it gives EvaluateWithExtrapolation (x), bit
+//  for bit.  The lane standard keeps one for time to bp, over all the scans of the sample, and one for bp to time
+//
+
+class CTransformTable {
+
+public:
+	CTransformTable (CSplineTransform* transform, int first, int last);	// does not own transform
+	~CTransformTable ();
+
+	double Evaluate (double abscissa);	// transform->EvaluateWithExtrapolation (abscissa)
+
+private:
+	CSplineTransform* mTransform;
+	int mFirst;
+	int mNumberOfEntries;
+	int* mIntervals;
 };
 
 
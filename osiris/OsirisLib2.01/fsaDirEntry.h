@@ -257,6 +257,9 @@ http://www.appliedbiosystems.com/support/software_community/ABIF_File_Format.pdf
           returns true is this entry is a user defined type, 
           false otherwise
 
+      bool IsLoaded() const
+          returns true if the data has been loaded or set
+
       const void *GetDataRaw(bool bThrow = false)
           retrieves the raw data read from the file, however if this
           is a little endian computer, then the appropriate bytes are 
@@ -581,6 +584,10 @@ public:
   {
     return IsTypeUser(nElementType);
   }
+  bool IsLoaded() const
+  {
+    return pData != NULL;
+  }
   const void *GetDataRaw(bool bThrow = false);
   const UINT8 *GetDataUINT8(bool bThrow = false);
   const char *GetDataString(bool bThrow = false);
@@ -89,11 +89,15 @@ fsaFile::~fsaFile()
 
 
 
-fsaDirEntry *fsaFile::FindDirEntry(const char *ps, INT32 n)
+fsaDirEntry *fsaFile::FindDirEntry(const char *ps, INT32 n, bool bLoadData)
 {
   RGString s = fsaDirEntry::MakeKey(ps,n);
   MapDirEntry::iterator itr = _mapDirEntry.find(s);
   fsaDirEntry *pRtn = (itr == _mapDirEntry.end()) ? NULL : itr->second;
+  if((pRtn != NULL) && bLoadData)
+  {
+    _LoadEntry(pRtn);
+  }
   return pRtn;
 }
 
@@ -78,9 +78,12 @@ http://www.appliedbiosystems.com/support/software_community/ABIF_File_Format.pdf
         retrieve the fsaDirEntry instance which contains the location of
         the other entries.  This should not be needed outside the class.
 
-      fsaDirEntry *FindDirEntry(const char *psName, int nNumber);
+      fsaDirEntry *FindDirEntry(const char *psName, int nNumber, bool bLoadData = true);
         search for an instance of fsaDirEntry with the specified 
         name and number.  The search is NOT case sensitive.
+        If bLoadData is false, the data of an entry that has not
+        yet been loaded is left in the file; see
+        fsaFileInput::GetDataINT16AsDouble()
 
       INT16 version()
         retrieve the version of the fsa file (x100).  This has been 
@@ -165,6 +168,7 @@ public:
     {
       pRtn = _vecDirEntry.at(_nNextEntry);
       _nNextEntry++;
+      _LoadEntry(pRtn);
     }
 
     return pRtn;
@@ -181,6 +185,10 @@ public:
     fsaDirEntry *p = (n < (UINT32)_vecDirEntry.size())
       ? _vecDirEntry.at(n)
       : NULL;
+    if(p != NULL)
+    {
+      _LoadEntry(p);
+    }
     return p;
   }
   int rewindDirEntries()
@@ -201,7 +209,7 @@ public:
     return _pDir;
   }
 
-  fsaDirEntry *FindDirEntry(const char *psName, int nNumber);
+  fsaDirEntry *FindDirEntry(const char *psName, int nNumber, bool bLoadData = true);
   bool CopyAddDirEntry(const fsaDirEntry &Entry);
   bool AddDirEntry(fsaDirEntry *pEntry);
   bool CopyEntries(fsaFile &From);
@@ -225,6 +233,11 @@ protected:
   typedef map<RGString, fsaDirEntry *> MapDirEntry;
   void cleanup();
   void BuildDirEntry();
+  virtual void _LoadEntry(fsaDirEntry *)
+  {
+    // called before an entry is returned, for classes that
+    // load entry data on demand, see fsaFileInput
+  }
 
   bool _bFileBigEndian;
   MapDirEntry _mapDirEntry;
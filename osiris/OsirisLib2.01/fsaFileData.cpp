@@ -34,6 +34,7 @@
 
 #include "fsaFileData.h"
 #include "fsaDataDefs.h"
+#include "SignalKernels.h"
 
 /*
 const char* ABIModelNumberTag = "MODL";
@@ -65,7 +66,7 @@ const int AmbientChannelIDLimit = 4;
 */
 
 
-fsaFileData :: fsaFileData (const RGString& fsaFileName) : SampleData (fsaFileName) {
+fsaFileData :: fsaFileData (const RGString& fsaFileName) : SampleData (fsaFileName), mOffScaleData (NULL) {
 
 	fsaInput = new fsaFileInput (fsaFileName);
 }
@@ -74,6 +75,7 @@ fsaFileData :: fsaFileData (const RGString& fsaFileName) : SampleData (fsaFileNa
 fsaFileData :: ~fsaFileData () {
 
 	delete fsaInput;
+	delete[] mOffScaleData;
 }
 
 
@@ -144,7 +146,7 @@ int fsaFileData :: GetNumberOfDataElementsForDataChannel (int channelNumber) {
 	else
 		ID = DataChannelIDBase + channelNumber;
 
-	fsaDirEntry* entry = fsaInput->FindDirEntry (DataChannelTag, ID);
+	fsaDirEntry* entry = fsaInput->FindDirEntry (DataChannelTag, ID, false);
 
 	if (entry == NULL)
 		return 0;
@@ -187,7 +189,7 @@ DataSignal* fsaFileData :: GetDataSignalForDataChannel (int channelNumber) {
 	else
 		ID = DataChannelIDBase + channelNumber;
 
-	fsaDirEntry* entry = fsaInput->FindDirEntry (DataChannelTag, ID);
+	fsaDirEntry* entry = fsaInput->FindDirEntry (DataChannelTag, ID, false);
 
 	if (entry == NULL)
 		return NULL;
@@ -197,15 +199,13 @@ DataSignal* fsaFileData :: GetDataSignalForDataChannel (int channelNumber) {
 	if (N <= 1)
 		return NULL;
 
-	const INT16* intData = entry->GetDataINT16 ();
-
-	if (intData == NULL)
-		return NULL;
-
 	data = new double [N];
 
-	for (int i=0; i<N; i++)
-		data[i] = (double)intData [i];
+	if (!fsaInput->GetDataINT16AsDouble (entry, data)) {
+
+		delete[] data;
+		return NULL;
+	}
 
 	double spacing = 1.0;
 	DataSignal* ds = new SampledData (N, 0.0, N * spacing, data);
@@ -224,21 +224,19 @@ double* fsaFileData :: GetDataForDataChannel (int channelNumber) {
 	else
 		ID = DataChannelIDBase + channelNumber;
 
-	fsaDirEntry* entry = fsaInput->FindDirEntry (DataChannelTag, ID);
+	fsaDirEntry* entry = fsaInput->FindDirEntry (DataChannelTag, ID, false);
 
 	if (entry == NULL)
 		return NULL;
 
 	int N = (int)entry->NumElements ();
-	const INT16* intData = entry->GetDataINT16 ();
-
-	if (intData == NULL)
-		return NULL;
-
 	data = new double [N];
 
-	for (int i=0; i<N; i++)
-		data[i] = (double)intData [i];
+	if (!fsaInput->GetDataINT16AsDouble (entry, data)) {
+
+		delete[] data;
+		return NULL;
+	}
 
 	return data;
 }
@@ -255,22 +253,19 @@ DataSignal* fsaFileData :: GetRawDataSignalForDataChannel (int channelNumber) {
 	else
 		ID = RawDataBase + channelNumber;
 
-	fsaDirEntry* entry = fsaInput->FindDirEntry (RawDataTag, ID);
+	fsaDirEntry* entry = fsaInput->FindDirEntry (RawDataTag, ID, false);
 
 	if (entry == NULL)
 		return NULL;
 
 	int N = (int)entry->NumElements ();
-	const INT16* intData = entry->GetDataINT16 ();
-
-	if (intData == NULL)
-		return NULL;
-
-//	intData += GetDataOffset ();  //This skips the "bad" stuff but gives an array mismatch
 	data = new double [N];
 
-	for (int i=0; i<N; i++)
-		data[i] = (double)intData [i];
+	if (!fsaInput->GetDataINT16AsDouble (entry, data)) {
+
+		delete[] data;
+		return NULL;
+	}
 
 	double spacing = 1.0;
 	DataSignal* ds = new SampledData (N, 0.0, N * spacing, data);
@@ -289,24 +284,73 @@ double* fsaFileData :: GetRawDataForDataChannel (int channelNumber, int& numData
 	else
 		ID = RawDataBase + channelNumber;
 
-	fsaDirEntry* entry = fsaInput->FindDirEntry (RawDataTag, ID);
+	fsaDirEntry* entry = fsaInput->FindDirEntry (RawDataTag, ID, false);
 
 	if (entry == NULL)
 		return NULL;
 
 	numDataPoints = (int)entry->NumElements ();
-	const INT16* intData = entry->GetDataINT16 ();
+	data = new double [numDataPoints];
+
+	if (!fsaInput->GetDataINT16AsDouble (entry, data)) {
 
-	if (intData == NULL)
+		delete[] data;
 		return NULL;
+	}
 
-//	intData += GetDataOffset ();  //This skips the "bad" stuff but gives an array mismatch
-	data = new double [numDataPoints];
+	return data;
+}
 
-	for (int i=0; i<numDataPoints; i++)
-		data[i] = (double)intData [i];
 
-	return data;
+double** fsaFileData :: GetColorCorrectedRawData (const double* matrix, int numberOfChannels, int& numDataPoints) {
+
+	const unsigned char** raw = new const unsigned char* [numberOfChannels];
+	fsaDirEntry* entry;
+	int ID;
+	int i;
+	int n = 0;
+
+	for (i=1; i<=numberOfChannels; i++) {
+
+		if (i > RawDataLimit)
+			ID = RawDataSecondaryBase + i;
+
+		else
+			ID = RawDataBase + i;
+
+		entry = fsaInput->FindDirEntry (RawDataTag, ID, false);
+
+		if (entry == NULL)
+			break;
+
+		if (i == 1)
+			n = (int)entry->NumElements ();
+
+		else if ((int)entry->NumElements () != n)
+			break;
+
+		raw [i - 1] = fsaInput->GetDataINT16View (entry);
+
+		if (raw [i - 1] == NULL)
+			break;
+	}
+
+	if (i <= numberOfChannels) {
+
+		delete[] raw;
+		return NULL;
+	}
+
+	double** corrected = new double* [numberOfChannels + 1];
+	corrected [0] = NULL;
+
+	for (i=1; i<=numberOfChannels; i++)
+		corrected [i] = new double [n];
+
+	SignalKernels::ColorCorrect (raw, numberOfChannels, n, matrix, corrected + 1);
+	delete[] raw;
+	numDataPoints = n;
+	return corrected;
 }
 
 
@@ -319,7 +363,7 @@ int fsaFileData :: GetNumberOfDataElementsForAmbientChannel (int channelNumber)
 
 	ID = channelNumber + AmbientChannelIDBase;
 
-	fsaDirEntry* entry = fsaInput->FindDirEntry (AmbientChannelTag, ID);
+	fsaDirEntry* entry = fsaInput->FindDirEntry (AmbientChannelTag, ID, false);
 
 	if (entry == NULL)
 		return 0;
@@ -338,22 +382,20 @@ double* fsaFileData :: GetDataForAmbientChannel (int channelNumber) {
 
 	ID = channelNumber + AmbientChannelIDBase;
 
-	fsaDirEntry* entry = fsaInput->FindDirEntry (AmbientChannelTag, ID);
+	fsaDirEntry* entry = fsaInput->FindDirEntry (AmbientChannelTag, ID, false);
 
 	if (entry == NULL)
 		return NULL;
 
 	int N = (int)entry->NumElements ();
 
-	const INT16* intData = entry->GetDataINT16 ();
-
-	if (intData == NULL)
-		return NULL;
-
 	data = new double [N];
 
-	for (int i=0; i<N; i++)
-		data[i] = (double)intData [i];
+	if (!fsaInput->GetDataINT16AsDouble (entry, data)) {
+
+		delete[] data;
+		return NULL;
+	}
 
 	return data;
 }
@@ -504,7 +546,7 @@ long fsaFileData :: GetDataOffset () {
 	if (entry == NULL)
 		return 0;
 
-	long* AnsPtr = (long*)entry->GetDataINT32 ();
+	const INT32* AnsPtr = entry->GetDataINT32 ();
 
 	if (AnsPtr == NULL)
 		return 0;
@@ -534,15 +576,29 @@ const short* fsaFileData :: GetRawDataForChannel (int channel) {
 
 const long* fsaFileData :: GetOffScaleData (int& numElements) {
 
-	const long* data;
+	const INT32* data;
 	fsaDirEntry* entry = fsaInput->FindDirEntry (OffScaleDataTag, OffScaleDataID);
 
 	if (entry == NULL)
 		return NULL;
 
-	data = (const long*) entry->GetDataINT32();
+	data = entry->GetDataINT32();
+
+	if (data == NULL)
+		return NULL;
+
+	//  The file stores 32 bit integers; copy them rather than cast, because long is 64 bits on some platforms and the cast
+	//  would read past the end of the entry
+
 	numElements = (int)entry->NumElements ();
-	return data;
+	delete[] mOffScaleData;
+	mOffScaleData = new long [numElements + 1];
+	int i;
+
+	for (i=0; i<numElements; i++)
+		mOffScaleData [i] = data [i];
+
+	return mOffScaleData;
 }
 
 
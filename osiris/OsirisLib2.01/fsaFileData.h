@@ -87,8 +87,14 @@ public:
 	virtual const long* GetOffScaleData (int& numElements);
 	virtual double* GetMatrix (int& numElements);
 
+	//  Channels 1 to numberOfChannels (in [1]...[numberOfChannels]), each a new array, with the matrix applied as it is read
+	//  from the file; NULL if a raw data array is not available as stored in the file or the arrays differ in length
+
+	virtual double** GetColorCorrectedRawData (const double* matrix, int numberOfChannels, int& numDataPoints);
+
 private:
 	fsaFileInput* fsaInput;
+	long* mOffScaleData;
 };
 
 
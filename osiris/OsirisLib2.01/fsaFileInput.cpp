@@ -50,6 +50,72 @@ fsaFileInput::~fsaFileInput()
   _CleanupBuffer();
 }
 
+void fsaFileInput::_CleanupBuffer()
+{
+  if(_pBuffer != NULL)
+  {
+    free(_pBuffer);
+    _pBuffer = NULL;
+  }
+  _pBufferSeek = NULL;
+  _nBufferSize = 0;
+}
+void fsaFileInput::_LoadEntry(fsaDirEntry *p)
+{
+  if(!(_bError || p->IsLoaded()))
+  {
+    p->LoadData(false,this);
+  }
+}
+bool fsaFileInput::GetDataINT16AsDouble(fsaDirEntry *pEntry, double *pDest)
+{
+  bool bRtn = false;
+  UINT32 nCount = pEntry->NumElements();
+  size_t nBytes = (size_t)nCount * sizeof(INT16);
+  const UINT8 *pView;
+  if(pEntry->ElementType() != fsaDirEntry::TYPE_INT16) {}
+  else if(pEntry->IsLoaded() || (nBytes <= 4))
+  {
+    // loaded, possibly changed, or stored in the entry itself
+    _LoadEntry(pEntry);
+    const INT16 *pn = pEntry->GetDataINT16();
+    if(pn != NULL)
+    {
+      for(UINT32 i = 0; i < nCount; i++)
+      {
+        pDest[i] = (double)pn[i];
+      }
+      bRtn = true;
+    }
+  }
+  else if(_bError) {}
+  else if((pView = GetView(pEntry->Offset(),nBytes)) != NULL)
+  {
+    // the file is big endian regardless of this computer
+    for(UINT32 i = 0; i < nCount; i++)
+    {
+      pDest[i] = (double)(INT16)((pView[0] << 8) | pView[1]);
+      pView += sizeof(INT16);
+    }
+    bRtn = true;
+  }
+  return bRtn;
+}
+
+
+const UINT8 *fsaFileInput::GetDataINT16View(fsaDirEntry *pEntry)
+{
+  const UINT8 *pRtn = NULL;
+  size_t nBytes = (size_t)pEntry->NumElements() * sizeof(INT16);
+  if(pEntry->ElementType() != fsaDirEntry::TYPE_INT16) {}
+  else if(pEntry->IsLoaded() || (nBytes <= 4) || _bError) {}
+  else
+  {
+    pRtn = GetView(pEntry->Offset(),nBytes);
+  }
+  return pRtn;
+}
+
 
 void fsaFileInput::Insert(UINT8 *pBuffer)
 {
@@ -428,34 +494,18 @@ bool fsaFileInput::_LoadFileBuffer(const char *psName)
   {
     _bError = true;
   }
-  else if((_pBuffer = (UINT8 *)malloc((size_t)_nBufferSize)) == NULL)
-  {
-    _bError = true;
-  }
   else 
   {
     FILE *pf = File.GetFile();
-    size_t nCHUNK = 8192;
-    size_t nToRead = _nBufferSize;
-    size_t nRead;
-    UINT8 *p = _pBuffer;
-    memset(_pBuffer,0,(size_t)_nBufferSize);
-    while((nToRead > 0) && (!_bError))
+    // the file is read at once and kept, not mapped, so that
+    //  truncating it during the analysis cannot fault a later access
+    if((_pBuffer = (UINT8 *)malloc((size_t)_nBufferSize)) == NULL)
     {
-      if(nToRead < nCHUNK)
-      {
-        nCHUNK = nToRead;
-      }
-      nRead = fread(p,1,nCHUNK,pf);
-      if(nRead > 0)
-      {
-        p += nRead;
-        nToRead -= nRead;
-      }
-      else
-      {
-        _bError = true;
-      }
+      _bError = true;
+    }
+    else if(fread(_pBuffer,1,_nBufferSize,pf) != _nBufferSize)
+    {
+      _bError = true;
     }
     if(_bError) {}
     else if(strncmp((char *)_pBuffer,"ABIF",4))
@@ -527,14 +577,13 @@ fsaFileInput::fsaFileInput(const char *psName,bool bUseWarning) :
 				i = nMax; // loop exit
 			}
 		}
-    for(UINT32 i = _bError ? nMax : 0; i < nMax; i++)
-    {
-      // do this loop after the previous because the previous is sequential reading
-      //  and this requires seeking for each read.
-      this->_vecDirEntry.at(i)->LoadData(false,this);
-    }
+    // the data of each entry is loaded when the entry is retrieved,
+    // see _LoadEntry(), so the buffer is kept until destruction
 	}
-  _CleanupBuffer();
+  if(_bError)
+  {
+    _CleanupBuffer();
+  }
 }
 bool fsaFileInput::isValid()
 { 
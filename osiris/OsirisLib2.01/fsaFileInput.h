@@ -53,7 +53,30 @@ http://www.appliedbiosystems.com/support/software_community/ABIF_File_Format.pdf
       fsaFileInput(const char *psFileName)
        psFileName - name of the file to be opened
        The constructor opens the file and reads all of the 
-       directory entries.
+       directory entries.  The file is read into memory and
+       remains there until destruction.  The data of an entry is loaded the first
+       time the entry is retrieved, see fsaFile::FindDirEntry()
+
+    methods:
+
+      const UINT8 *GetView(UINT32 nOffset, size_t nBytes) const
+        retrieve a pointer to nBytes of the file, beginning at
+        nOffset, as stored in the file (big endian), or NULL
+        if out of range
+
+      bool GetDataINT16AsDouble(fsaDirEntry *pEntry, double *pDest)
+        store the INT16 array of pEntry, e.g. DATA, in pDest, which
+        must have room for pEntry->NumElements() values.  If the
+        entry has not been loaded, the values are decoded directly
+        from the file.  Returns false if the entry is not INT16
+        or the data is not in the file.
+
+      const UINT8 *GetDataINT16View(fsaDirEntry *pEntry)
+        retrieve the INT16 array of pEntry as stored in the file
+        (big endian), without loading the entry, or NULL if the
+        entry is not INT16, has been loaded (and so may have been
+        changed), is stored in the entry itself or is not in the
+        file
 
  */
 
@@ -82,21 +105,27 @@ public:
   {
     return _bHID;
   }
+  const UINT8 *GetView(UINT32 nOffset, size_t nBytes) const
+  {
+    const UINT8 *pRtn = NULL;
+    if( (_pBuffer != NULL) &&
+        (nOffset <= _nBufferSize) &&
+        (nBytes <= (_nBufferSize - nOffset)) )
+    {
+      pRtn = _pBuffer + nOffset;
+    }
+    return pRtn;
+  }
+  bool GetDataINT16AsDouble(fsaDirEntry *pEntry, double *pDest);
+  const UINT8 *GetDataINT16View(fsaDirEntry *pEntry);
+protected:
+  virtual void _LoadEntry(fsaDirEntry *p);
 private:
   enum
   {
      NADDRS = 12
   };
-  void _CleanupBuffer()
-  {
-    if(_pBuffer != NULL)
-    {
-      free(_pBuffer);
-      _pBuffer = NULL;
-    }
-    _pBufferSeek = NULL;
-    _nBufferSize = 0;
-  }
+  void _CleanupBuffer();
   bool _SeekTo(size_t nOffset);
   size_t _Tell()
   {
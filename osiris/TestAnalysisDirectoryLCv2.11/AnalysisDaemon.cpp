@@ -0,0 +1,704 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: AnalysisDaemon.cpp
+*
+*/
+//
+//
+//  class AnalysisDaemon keeps analysis setups cached between runs and accepts analysis jobs on a local (Unix domain) socket.
+//  The client side, SubmitJob, is used by TestAnalysisDirectoryLC when OSIRIS_ANALYSIS_DAEMON is set
+//
+
+#ifdef _WINDOWS
+#include "stdafx.h"
+#endif
+
+#include "AnalysisDaemon.h"
+#include "TestAnalysisDirectoryLC.h"
+#include "OsirisInputFile.h"
+#include "STRLCAnalysis.h"
+#include "AnalysisContext.h"
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <errno.h>
+#include <signal.h>
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#endif
+
+using namespace std;
+
+
+const int AnalysisDaemon::MaxCachedSetups = 8;
+
+static const char* JobHeader = "OsirisAnalysisJob ";	// followed by the client's working directory, then the input lines
+static const char* JobStatusPrefix = "OsirisAnalysisJobStatus = ";
+
+
+RGString AnalysisDaemon :: GetSocketName () {
+
+	const char* name = getenv ("OSIRIS_ANALYSIS_DAEMON");
+
+	if (name == NULL)
+		return RGString ();
+
+	return RGString (name);
+}
+
+
+#ifdef _WIN32
+
+AnalysisDaemon :: AnalysisDaemon (const RGString& socketName) : mSocketName (socketName), mSocket (-1), mUseCount (0), mSavedOutput (-1) {
+
+}
+
+
+AnalysisDaemon :: ~AnalysisDaemon () {
+
+}
+
+
+int AnalysisDaemon :: Run () {
+
+	cout << "The analysis daemon is not available on this platform.  Exiting..." << endl;
+	return -1;
+}
+
+
+int AnalysisDaemon :: SubmitJob (const RGString& socketName, OsirisInputFile& inputFile, int& jobStatus) {
+
+	return -1;
+}
+
+#else
+
+static bool WriteAll (int fd, const char* data, size_t n) {
+
+	ssize_t written;
+
+	while (n > 0) {
+
+		written = write (fd, data, n);
+
+		if (written < 0) {
+
+			if (errno == EINTR)
+				continue;
+
+			return false;
+		}
+
+		data += written;
+		n -= written;
+	}
+
+	return true;
+}
+
+
+static bool ReadToEnd (int fd, string& data) {
+
+	char buffer [4096];
+	ssize_t nRead;
+
+	while (true) {
+
+		nRead = read (fd, buffer, sizeof (buffer));
+
+		if (nRead < 0) {
+
+			if (errno == EINTR)
+				continue;
+
+			return false;
+		}
+
+		if (nRead == 0)
+			return true;
+
+		data.append (buffer, nRead);
+	}
+}
+
+
+static int OpenSocket (const RGString& socketName, bool listening) {
+
+	struct sockaddr_un address;
+	struct stat status;
+
+	if (socketName.Length () >= sizeof (address.sun_path))
+		return -1;
+
+	memset (&address, 0, sizeof (address));
+	address.sun_family = AF_UNIX;
+	strcpy (address.sun_path, socketName.GetData ());
+	int fd = socket (AF_UNIX, SOCK_STREAM, 0);
+
+	if (fd < 0)
+		return -1;
+
+	if (connect (fd, (struct sockaddr*) &address, sizeof (address)) == 0) {
+
+		if (!listening)
+			return fd;
+
+		// Another daemon is listening on this socket
+
+		close (fd);
+		return -1;
+	}
+
+	if (!listening) {
+
+		close (fd);
+		return -1;
+	}
+
+	// Remove a socket left by a daemon that did not exit cleanly, but nothing else
+
+	if ((stat (address.sun_path, &status) == 0) && S_ISSOCK (status.st_mode))
+		unlink (address.sun_path);
+
+	close (fd);
+	fd = socket (AF_UNIX, SOCK_STREAM, 0);
+
+	if (fd < 0)
+		return -1;
+
+	// Only the daemon's user may connect:  the socket is created without group or other permissions
+
+	mode_t savedMask = umask (S_IRWXG | S_IRWXO);
+	int bindStatus = bind (fd, (struct sockaddr*) &address, sizeof (address));
+	umask (savedMask);
+
+	if ((bindStatus < 0) || (chmod (address.sun_path, S_IRUSR | S_IWUSR) < 0) || (listen (fd, 16) < 0)) {
+
+		close (fd);
+		return -1;
+	}
+
+	return fd;
+}
+
+
+static bool PeerIsDaemonUser (int connection) {
+
+	// The socket's permissions already exclude other users; this also covers a socket directory with looser permissions
+
+#ifdef SO_PEERCRED
+	struct ucred credentials;
+	socklen_t length = sizeof (credentials);
+
+	if (getsockopt (connection, SOL_SOCKET, SO_PEERCRED, &credentials, &length) < 0)
+		return false;
+
+	return credentials.uid == getuid ();
+#else
+	uid_t uid;
+	gid_t gid;
+
+	if (getpeereid (connection, &uid, &gid) < 0)
+		return false;
+
+	return uid == getuid ();
+#endif
+}
+
+
+static void ReapJobs (int) {
+
+	int savedErrno = errno;
+
+	while (waitpid (-1, NULL, WNOHANG) > 0)
+		;
+
+	errno = savedErrno;
+}
+
+
+static void AppendFileStamp (RGString& stamp, const RGString& fileName) {
+
+	struct stat status;
+
+	if (stat (fileName.GetData (), &status) == 0)
+		stamp << (long) status.st_mtime << "/" << (long) status.st_size;
+
+	else
+		stamp << "-";
+
+	stamp << "\n";
+}
+
+
+AnalysisDaemon :: AnalysisDaemon (const RGString& socketName) : mSocketName (socketName), mSocket (-1), mUseCount (0), mSavedOutput (-1) {
+
+}
+
+
+AnalysisDaemon :: ~AnalysisDaemon () {
+
+	list<AnalysisDaemonSetup*>::iterator sIterator;
+
+	for (sIterator = mSetups.begin (); sIterator != mSetups.end (); sIterator++)
+		DeleteSetup (*sIterator);
+
+	mSetups.clear ();
+
+	if (mSocket >= 0) {
+
+		close (mSocket);
+		unlink (mSocketName.GetData ());
+	}
+}
+
+
+int AnalysisDaemon :: Run () {
+
+	int connection;
+	struct sigaction reaper;
+
+	signal (SIGPIPE, SIG_IGN);	// a client that goes away must not take the daemon with it
+
+	// Finished jobs are reaped as they exit, even while the daemon waits for the next connection
+
+	memset (&reaper, 0, sizeof (reaper));
+	reaper.sa_handler = ReapJobs;
+	sigemptyset (&reaper.sa_mask);
+	reaper.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+	sigaction (SIGCHLD, &reaper, NULL);
+	mSocket = OpenSocket (mSocketName, true);
+
+	if (mSocket < 0) {
+
+		cout << "Could not open analysis daemon socket " << mSocketName.GetData () << ".  Exiting..." << endl;
+		return -1;
+	}
+
+	cout << "Analysis daemon listening on " << mSocketName.GetData () << endl;
+
+	while (true) {
+
+		connection = accept (mSocket, NULL, NULL);
+
+		if (connection < 0) {
+
+			if (errno == EINTR)
+				continue;
+
+			cout << "Analysis daemon could not accept connection.  Exiting..." << endl;
+			break;
+		}
+
+		if (!PeerIsDaemonUser (connection)) {
+
+			cout << "Analysis daemon refused a job from another user" << endl;
+			close (connection);
+			continue;
+		}
+
+		HandleJob (connection);
+		close (connection);
+	}
+
+	return -1;
+}
+
+
+int AnalysisDaemon :: SubmitJob (const RGString& socketName, OsirisInputFile& inputFile, int& jobStatus) {
+
+	int fd = OpenSocket (socketName, false);
+
+	if (fd < 0)
+		return -1;
+
+	char workingDirectory [4096];
+
+	if (getcwd (workingDirectory, sizeof (workingDirectory)) == NULL) {
+
+		close (fd);
+		return -1;
+	}
+
+	string request (JobHeader);
+	request += workingDirectory;
+	request += "\n";
+	RGString* nextInputLine;
+	inputFile.ResetInputLines ();
+
+	while ((nextInputLine = inputFile.GetNextInputLine ())) {
+
+		request += nextInputLine->GetData ();
+		request += "\n";
+	}
+
+	if (!WriteAll (fd, request.data (), request.length ())) {
+
+		close (fd);
+		return -1;
+	}
+
+	shutdown (fd, SHUT_WR);
+
+	//  Pass the job's output through as it arrives (the caller may be following "Progress = " lines), except for its status
+
+	string pending;
+	string line;
+	char buffer [4096];
+	ssize_t nRead;
+	size_t end;
+	size_t prefixLength = strlen (JobStatusPrefix);
+	bool foundStatus = false;
+
+	while (true) {
+
+		nRead = read (fd, buffer, sizeof (buffer));
+
+		if (nRead < 0) {
+
+			if (errno == EINTR)
+				continue;
+
+			break;
+		}
+
+		if (nRead == 0)
+			break;
+
+		pending.append (buffer, nRead);
+
+		while ((end = pending.find ('\n')) != string::npos) {
+
+			line = pending.substr (0, end + 1);
+			pending.erase (0, end + 1);
+
+			if (line.compare (0, prefixLength, JobStatusPrefix) == 0) {
+
+				jobStatus = atoi (line.c_str () + prefixLength);
+				foundStatus = true;
+			}
+
+			else
+				cout << line;
+		}
+
+		cout.flush ();
+	}
+
+	cout << pending;
+	close (fd);
+
+	if (!foundStatus) {
+
+		cout << "Analysis daemon job ended without reporting a status" << endl;
+		jobStatus = -1;
+	}
+
+	return 0;
+}
+
+
+void AnalysisDaemon :: HandleJob (int connection) {
+
+	string request;
+	size_t headerLength = strlen (JobHeader);
+
+	if (!ReadToEnd (connection, request))
+		return;
+
+	size_t end = request.find ('\n');
+
+	if ((end == string::npos) || (request.compare (0, headerLength, JobHeader) != 0)) {
+
+		cout << "Analysis daemon received an invalid job" << endl;
+		return;
+	}
+
+	string workingDirectory = request.substr (headerLength, end - headerLength);
+	istringstream input (request.substr (end + 1));
+	OsirisInputFile inputFile (false);
+	int inputStatus = -1;
+	int status;
+
+	//  Input is read with output to the daemon's log, since the client has already shown it
+
+	cout << "Analysis daemon received job from " << workingDirectory.c_str () << endl;
+	bool changedDirectory = (chdir (workingDirectory.c_str ()) == 0);
+
+	if (changedDirectory) {
+
+		inputStatus = inputFile.ReadAllInputs (input);
+
+		if (inputStatus == 0)
+			inputStatus = inputFile.AssembleInputs ();
+	}
+
+	RedirectOutput (connection);
+
+	if (!changedDirectory) {
+
+		cout << "Could not change to working directory " << workingDirectory.c_str () << ".  Terminating..." << endl;
+		WriteJobStatus (-1);
+		RestoreOutput ();
+		return;
+	}
+
+	if (inputStatus != 0) {
+
+		cout << "File input failed.  Terminating..." << endl;
+		WriteJobStatus (-1);
+		RestoreOutput ();
+		return;
+	}
+
+	cout << "File input succeeded.  Continuing..." << endl << endl;
+
+	RGString key = BuildKey (inputFile, RGString (workingDirectory.c_str ()));
+	RGString stamp = BuildStamp (inputFile);
+	AnalysisDaemonSetup* setup = FindSetup (key, stamp);
+
+	if (setup != NULL)
+		cout << "Using cached settings, ladder information and message book..." << endl;
+
+	else {
+
+		setup = BuildSetup (inputFile, key, stamp, status);
+
+		if (setup == NULL) {
+
+			WriteJobStatus (status);
+			RestoreOutput ();
+			return;
+		}
+	}
+
+	mUseCount++;
+	setup->mLastUse = mUseCount;
+	cout.flush ();
+	fflush (stdout);
+	pid_t pid = fork ();
+
+	if (pid == 0) {
+
+		// The job:  its changes to the setup are lost when it exits
+
+		signal (SIGCHLD, SIG_DFL);	// the analysis waits for its own sample workers
+		close (mSocket);
+		close (mSavedOutput);
+		setup->mContext->MakeCurrent ();
+		status = RunAnalysis (inputFile, *setup->mAnalysis);
+		delete setup->mAnalysis;	// closes and removes the working file
+		WriteJobStatus (status);
+		_exit (0);
+	}
+
+	if (pid < 0) {
+
+		cout << "Could not start analysis job.  Terminating..." << endl;
+		WriteJobStatus (-1);
+	}
+
+	RestoreOutput ();
+}
+
+
+AnalysisDaemonSetup* AnalysisDaemon :: FindSetup (const RGString& key, const RGString& stamp) {
+
+	list<AnalysisDaemonSetup*>::iterator sIterator;
+	AnalysisDaemonSetup* setup;
+
+	for (sIterator = mSetups.begin (); sIterator != mSetups.end (); sIterator++) {
+
+		setup = *sIterator;
+
+		if (setup->mKey != key)
+			continue;
+
+		if (setup->mStamp == stamp)
+			return setup;
+
+		cout << "Settings, ladder information or message book modified since last use..." << endl;
+		mSetups.erase (sIterator);
+		DeleteSetup (setup);
+		return NULL;
+	}
+
+	return NULL;
+}
+
+
+AnalysisDaemonSetup* AnalysisDaemon :: BuildSetup (OsirisInputFile& inputFile, const RGString& key, const RGString& stamp, int& status) {
+
+	//  Each setup starts from the settings of the process at startup
+
+	AnalysisContext::GetDefaultContext ()->MakeCurrent ();
+	AnalysisContext* context = new AnalysisContext;
+	context->MakeCurrent ();
+	STRLCAnalysis* analysis;
+	status = SetUpAnalysis (inputFile, analysis);
+
+	if (status < 0) {
+
+		delete context;
+		return NULL;
+	}
+
+	if ((int) mSetups.size () >= MaxCachedSetups) {
+
+		list<AnalysisDaemonSetup*>::iterator sIterator;
+		list<AnalysisDaemonSetup*>::iterator oldest = mSetups.begin ();
+
+		for (sIterator = mSetups.begin (); sIterator != mSetups.end (); sIterator++) {
+
+			if ((*sIterator)->mLastUse < (*oldest)->mLastUse)
+				oldest = sIterator;
+		}
+
+		DeleteSetup (*oldest);
+		mSetups.erase (oldest);
+	}
+
+	AnalysisDaemonSetup* setup = new AnalysisDaemonSetup;
+	setup->mKey = key;
+	setup->mStamp = stamp;
+	setup->mContext = context;
+	setup->mAnalysis = analysis;
+	setup->mLastUse = 0;
+	mSetups.push_back (setup);
+	return setup;
+}
+
+
+void AnalysisDaemon :: DeleteSetup (AnalysisDaemonSetup* setup) {
+
+	setup->mContext->MakeCurrent ();
+	delete setup->mAnalysis;
+	delete setup->mContext;
+	delete setup;
+}
+
+
+void AnalysisDaemon :: RedirectOutput (int connection) {
+
+	cout.flush ();
+	fflush (stdout);
+	mSavedOutput = dup (1);
+	dup2 (connection, 1);
+}
+
+
+void AnalysisDaemon :: RestoreOutput () {
+
+	cout.flush ();
+	fflush (stdout);
+	dup2 (mSavedOutput, 1);
+	close (mSavedOutput);
+	mSavedOutput = -1;
+}
+
+
+RGString AnalysisDaemon :: BuildKey (OsirisInputFile& inputFile, const RGString& workingDirectory) {
+
+	//  The working directory matters only if a path is relative
+
+	RGString key;
+
+	if ((inputFile.GetLadderDirectory ().GetFirstCharacter () != '/') || (inputFile.GetFinalStdSettingsName ().GetFirstCharacter () != '/') ||
+		(inputFile.GetFinalLabSettingsName ().GetFirstCharacter () != '/') || (inputFile.GetFinalMessageBookName ().GetFirstCharacter () != '/'))
+		key << workingDirectory;
+
+	key << "\n" << inputFile.GetLadderDirectory () << "\n" << inputFile.GetMarkerSetName () << "\n";
+	key << inputFile.GetLaneStandardName () << "\n" << inputFile.GetCriticalOutputLevel () << "\n";
+	key << inputFile.GetMinSampleRFU () << "\n" << inputFile.GetMinLaneStandardRFU () << "\n" << inputFile.GetMinLadderRFU () << "\n";
+	key << inputFile.GetMinInterlocusRFU () << "\n" << inputFile.GetMinLadderInterlocusRFU () << "\n";
+	key << inputFile.GetSampleDetectionThreshold () << "\n" << (inputFile.UseRawData () ? "R" : "A") << "\n";
+	key << inputFile.GetFinalStdSettingsName () << "\n" << inputFile.GetFinalLabSettingsName () << "\n";
+	key << inputFile.GetFinalMessageBookName () << "\n";
+	return key;
+}
+
+
+RGString AnalysisDaemon :: BuildStamp (OsirisInputFile& inputFile) {
+
+	RGString stamp;
+	AppendFileStamp (stamp, inputFile.GetFinalStdSettingsName ());
+	AppendFileStamp (stamp, inputFile.GetFinalLabSettingsName ());
+	AppendFileStamp (stamp, inputFile.GetFinalMessageBookName ());
+
+	//  Ladder and ILS information:  all of LadderSpecifications, as read by PopulationCollection
+
+	RGString ladderDirectory = inputFile.GetLadderDirectory () + "/LadderSpecifications";
+	DIR* directory = opendir (ladderDirectory.GetData ());
+	struct dirent* entry;
+	struct stat status;
+	long latest = 0;
+	long totalSize = 0;
+	int nFiles = 0;
+
+	if (directory != NULL) {
+
+		while ((entry = readdir (directory)) != NULL) {
+
+			RGString fileName = ladderDirectory + "/" + entry->d_name;
+
+			if ((stat (fileName.GetData (), &status) != 0) || !S_ISREG (status.st_mode))
+				continue;
+
+			if ((long) status.st_mtime > latest)
+				latest = (long) status.st_mtime;
+
+			totalSize += (long) status.st_size;
+			nFiles++;
+		}
+
+		closedir (directory);
+	}
+
+	stamp << latest << "/" << totalSize << "/" << nFiles << "\n";
+	return stamp;
+}
+
+
+void AnalysisDaemon :: WriteJobStatus (int status) {
+
+	cout << "\n" << JobStatusPrefix << status << endl;
+	cout.flush ();
+	fflush (stdout);
+}
+
+#endif
+
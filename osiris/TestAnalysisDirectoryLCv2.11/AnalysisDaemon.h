@@ -0,0 +1,102 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: AnalysisDaemon.h
+*
+*/
+//
+//
+//  class AnalysisDaemon keeps analysis setups (settings, ladder information and message book, each in its own AnalysisContext)
+//  cached between runs and accepts analysis jobs on a local (Unix domain) socket.  A setup is reused for any job with the same
+//  settings, provided that none of the settings, message book or ladder specification files has been modified since it was
+//  built.  Each job runs in a child process forked from the daemon, so the cached setups are never altered by an analysis and
+//  jobs can run concurrently.  The job's output is streamed back to the client, followed by its status.  Only the user running
+//  the daemon can connect to its socket or submit jobs.
+//
+//  The client is TestAnalysisDirectoryLC itself:  when the environment variable OSIRIS_ANALYSIS_DAEMON names the daemon's socket,
+//  the input read from stdin is forwarded to the daemon, and if no daemon answers, the analysis runs in process as usual.  Start
+//  the daemon with:  TestAnalysisDirectoryLC -daemon <socket path>  (POSIX only)
+//
+
+#ifndef _ANALYSISDAEMON_H_
+#define _ANALYSISDAEMON_H_
+
+#include "rgstring.h"
+
+#include <list>
+
+using namespace std;
+
+class OsirisInputFile;
+class STRLCAnalysis;
+class AnalysisContext;
+
+
+struct AnalysisDaemonSetup {
+
+	RGString mKey;		// the settings on which the setup depends
+	RGString mStamp;	// modification times of the files read by the setup
+	AnalysisContext* mContext;
+	STRLCAnalysis* mAnalysis;
+	unsigned long mLastUse;
+};
+
+
+class AnalysisDaemon {
+
+public:
+	AnalysisDaemon (const RGString& socketName);
+	~AnalysisDaemon ();
+
+	int Run ();		// returns only if the socket cannot be opened
+
+	static RGString GetSocketName ();	// from OSIRIS_ANALYSIS_DAEMON; empty if not set
+	static int SubmitJob (const RGString& socketName, OsirisInputFile& inputFile, int& jobStatus);	// returns < 0 if no daemon answers
+
+	static const int MaxCachedSetups;
+
+protected:
+	RGString mSocketName;
+	int mSocket;
+	list<AnalysisDaemonSetup*> mSetups;
+	unsigned long mUseCount;
+	int mSavedOutput;
+
+	void HandleJob (int connection);
+	AnalysisDaemonSetup* FindSetup (const RGString& key, const RGString& stamp);
+	AnalysisDaemonSetup* BuildSetup (OsirisInputFile& inputFile, const RGString& key, const RGString& stamp, int& status);
+	void DeleteSetup (AnalysisDaemonSetup* setup);
+
+	void RedirectOutput (int connection);
+	void RestoreOutput ();
+
+	static RGString BuildKey (OsirisInputFile& inputFile, const RGString& workingDirectory);
+	static RGString BuildStamp (OsirisInputFile& inputFile);
+	static void WriteJobStatus (int status);
+};
+
+
+#endif  /*  _ANALYSISDAEMON_H_  */
+
@@ -0,0 +1,266 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: DigitizeBenchmark.cpp
+*
+*/
+//
+//
+//  DigitizeBenchmark times CompositeCurve::Digitize on synthetic traces:  numSamples samples covered by numPeaks random
+//  Gaussian, DoubleGaussian and SuperGaussian peaks, split by ProjectNeighboringSignals as in the baseline and fit data output.
+//  It compares the support limited Digitize (numSamples, left, resolution) with the full evaluation, Digitize (numSamples, left)
+//  followed by TruncateToResolution, and reports the time of each and the number of samples that differ, which should be 0.
+//  It also reports the largest relative error of the vector exponential against exp () and of the support values of the curves
+//  against Value (double), with the error bound that Digitize relies on.  Usage:
+//
+//      DigitizeBenchmark [-n numSamples] [-p numPeaks] [-r repetitions] [-s seed]
+//
+//  Not built by default:  make DigitizeBenchmark
+//
+
+#ifdef _WINDOWS
+#include "stdafx.h"
+#endif
+
+#include "DataSignal.h"
+#include "SignalKernels.h"
+#include "rgdlist.h"
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+using namespace std;
+
+
+static double Uniform (double low, double high) {
+
+	return low + (high - low) * (double)rand () / (double)RAND_MAX;
+}
+
+
+static void MakeCurves (int numSamples, int numPeaks, RGDList& curves) {
+
+	//
+	//  Evenly spaced peaks with some jitter, widths of 1.5 to 4 samples and heights of 50 to 30000 RFU.  Most are
+	//  DoubleGaussians, as in the analysis
+	//
+
+	double step = (double)numSamples / (numPeaks + 1);
+	double mean;
+	double sigma;
+	double height;
+	double kind;
+	ParametricCurve* curve;
+
+	for (int i=1; i<=numPeaks; i++) {
+
+		mean = i * step + Uniform (-0.25, 0.25) * step;
+		sigma = Uniform (1.5, 4.0);
+		height = exp (Uniform (log (50.0), log (30000.0)));
+		kind = Uniform (0.0, 1.0);
+
+		if (kind < 0.8) {
+
+			DoubleGaussian* dg = new DoubleGaussian (mean, sigma, Uniform (1.2, 2.5));
+			dg->SetScale (1, Uniform (0.3, 1.0));
+			dg->SetScale (2, Uniform (0.0, 0.5));
+			curve = dg;
+		}
+
+		else if (kind < 0.9)
+			curve = new SuperGaussian (mean, sigma, 3);
+
+		else
+			curve = new Gaussian (mean, sigma);
+
+		curve->SetPeak (height);
+		curves.Append (curve);
+	}
+}
+
+
+static double SupportError (const RGDList& curves, double left) {
+
+	//  Largest relative difference of SupportValues from Value (double), over the support of each curve
+
+	RGDListIterator it ((RGDList&)curves);
+	ParametricCurve* curve;
+	double spacing = DataSignal::GetSampleSpacing ();
+	double values [ParametricCurve::DigitizeBlockSize];
+	double supportLeft;
+	double supportRight;
+	double tailBound;
+	double exact;
+	double error;
+	double maxError = 0.0;
+	int first;
+	int last;
+	int count;
+	int i;
+	int k;
+
+	while ((curve = (ParametricCurve*) it ())) {
+
+		if (!curve->GetSupport (supportLeft, supportRight, tailBound))
+			continue;
+
+		first = (int) ceil ((supportLeft - left) / spacing);
+		last = (int) floor ((supportRight - left) / spacing);
+
+		for (i=first; i<=last; i+=ParametricCurve::DigitizeBlockSize) {
+
+			count = last - i + 1;
+
+			if (count > ParametricCurve::DigitizeBlockSize)
+				count = ParametricCurve::DigitizeBlockSize;
+
+			curve->SupportValues (left, i, count, values);
+
+			for (k=0; k<count; k++) {
+
+				exact = curve->Value (left + (i + k) * spacing);
+
+				if (exact == 0.0)
+					continue;
+
+				error = fabs (values [k] - exact) / fabs (exact);
+
+				if (error > maxError)
+					maxError = error;
+			}
+		}
+	}
+
+	return maxError;
+}
+
+
+int main (int argc, char** argv) {
+
+	int numSamples = 12000;
+	int numPeaks = 300;
+	int repetitions = 20;
+	unsigned seed = 1;
+	int i;
+	int r;
+
+	for (i=1; i<argc; i++) {
+
+		if ((strcmp (argv [i], "-n") == 0) && (i + 1 < argc))
+			numSamples = atoi (argv [++i]);
+
+		else if ((strcmp (argv [i], "-p") == 0) && (i + 1 < argc))
+			numPeaks = atoi (argv [++i]);
+
+		else if ((strcmp (argv [i], "-r") == 0) && (i + 1 < argc))
+			repetitions = atoi (argv [++i]);
+
+		else if ((strcmp (argv [i], "-s") == 0) && (i + 1 < argc))
+			seed = (unsigned) atoi (argv [++i]);
+
+		else {
+
+			cout << "Usage:  DigitizeBenchmark [-n numSamples] [-p numPeaks] [-r repetitions] [-s seed]" << endl;
+			return 1;
+		}
+	}
+
+	if ((numSamples < 2) || (numPeaks < 1) || (repetitions < 1)) {
+
+		cout << "Usage:  DigitizeBenchmark [-n numSamples] [-p numPeaks] [-r repetitions] [-s seed]" << endl;
+		return 1;
+	}
+
+	srand (seed);
+	DataSignal::SetSampleSpacing (1.0);
+	double left = 0.0;
+	double right = numSamples - 1.0;
+	RGDList curves;
+	MakeCurves (numSamples, numPeaks, curves);
+	double supportError = SupportError (curves, left);
+
+	CompositeCurve composite (left, right, curves);		// owns the curves
+	composite.ProjectNeighboringSignals (1.0, 1.0);
+
+	DataSignal* full = NULL;
+	DataSignal* limited = NULL;
+	clock_t start;
+
+	start = clock ();
+
+	for (r=0; r<repetitions; r++) {
+
+		delete full;
+		full = composite.Digitize (numSamples, left);
+		((SampledData*)full)->TruncateToResolution (1.0);
+	}
+
+	double fullSeconds = (double)(clock () - start) / CLOCKS_PER_SEC;
+	start = clock ();
+
+	for (r=0; r<repetitions; r++) {
+
+		delete limited;
+		limited = composite.Digitize (numSamples, left, 1.0);
+	}
+
+	double limitedSeconds = (double)(clock () - start) / CLOCKS_PER_SEC;
+	const double* fullData = full->GetData ();
+	const double* limitedData = limited->GetData ();
+	int nDifferent = 0;
+	double maxDifference = 0.0;
+
+	for (i=0; i<numSamples; i++) {
+
+		if (fullData [i] != limitedData [i]) {
+
+			nDifferent++;
+
+			if (fabs (fullData [i] - limitedData [i]) > maxDifference)
+				maxDifference = fabs (fullData [i] - limitedData [i]);
+		}
+	}
+
+	char line [200];
+	cout << "Samples:  " << numSamples << ", peaks:  " << numPeaks << ", repetitions:  " << repetitions << endl;
+	cout << "Vector kernels:  " << SignalKernels::GetVectorLevelName () << ", vector exponential ";
+	cout << (SignalKernels::VectorExpIsValid () ? "in use" : "not in use") << endl;
+	sprintf (line, "Error bound %.3g, exponential error %.3g, support value error %.3g", SignalKernels::GetVectorExpErrorBound (),
+		SignalKernels::MeasureVectorExpError (708.0, 1000000), supportError);
+	cout << line << endl;
+	sprintf (line, "%-14s %10.4f s", "full", fullSeconds);
+	cout << line << endl;
+	sprintf (line, "%-14s %10.4f s  %8.2f x", "support", limitedSeconds, (limitedSeconds > 0.0) ? fullSeconds / limitedSeconds : 0.0);
+	cout << line << endl;
+	cout << "Samples that differ:  " << nDifferent << ", largest difference " << maxDifference << endl;
+
+	delete full;
+	delete limited;
+	return (nDifferent == 0) ? 0 : 1;
+}
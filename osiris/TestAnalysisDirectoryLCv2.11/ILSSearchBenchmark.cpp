@@ -0,0 +1,393 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: ILSSearchBenchmark.cpp
+*
+*/
+//
+//
+//  ILSSearchBenchmark replays the ILS subset searches recorded in a search log (input setting ILSSearchLog=file) with the
+//  RecursiveInnerProduct tree and with InnerProductSubsetSearch.  It reports the time of each, the largest single search, the
+//  number of nodes visited and every search for which the two choose different subsets or correlations.  -x adds that many random
+//  candidates to each recorded search, to simulate samples with many extra ILS channel peaks; -o skips the tree, which may not
+//  finish on such searches.  Usage:
+//
+//      ILSSearchBenchmark [-r repetitions] [-x extraPeaks] [-s seed] [-n nodeLimit] [-o] searchLog ...
+//
+//  Not built by default:  make ILSSearchBenchmark
+//
+
+#ifdef _WINDOWS
+#include "stdafx.h"
+#endif
+
+#include "RecursiveInnerProduct.h"
+#include "InnerProductSubsetSearch.h"
+#include "DataSignal.h"
+#include "rgdlist.h"
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+using namespace std;
+
+
+struct RecordedSearch {
+
+	bool fromLeft;
+	int setSize;
+	int nCandidates;
+	int ptsRemaining;
+	int extraPts;
+	double clim;
+	double maxHeight;
+	int discrepancy;
+	bool accurate;
+	double* pts;
+	double* diffs;
+	double* norm2s;
+	int* heights;
+	double* means;
+	double* peaks;
+
+	RecordedSearch () : pts (NULL), diffs (NULL), norm2s (NULL), heights (NULL), means (NULL), peaks (NULL) {}
+	~RecordedSearch () { delete[] pts; delete[] diffs; delete[] norm2s; delete[] heights; delete[] means; delete[] peaks; }
+};
+
+
+static bool ReadDoubles (FILE* f, double* values, int n) {
+
+	for (int i=0; i<n; i++) {
+
+		if (fscanf (f, "%lf", values + i) != 1)
+			return false;
+	}
+
+	return true;
+}
+
+
+static bool ReadSearch (FILE* f, RecordedSearch& s) {
+
+	char word [64];
+	int fromLeft;
+	int accurate;
+	int i;
+
+	if (fscanf (f, "%63s", word) != 1)
+		return false;
+
+	if (strcmp (word, "ILSSearch") != 0)
+		return false;
+
+	if (fscanf (f, "%d %d %d %d %d %lf %lf %d %d", &fromLeft, &s.setSize, &s.nCandidates, &s.ptsRemaining, &s.extraPts, &s.clim, &s.maxHeight, &s.discrepancy, &accurate) != 9)
+		return false;
+
+	if ((s.setSize < 2) || (s.nCandidates < 1))
+		return false;
+
+	s.fromLeft = (fromLeft != 0);
+	s.accurate = (accurate != 0);
+	s.pts = new double [s.setSize];
+	s.diffs = new double [s.setSize];
+	s.norm2s = new double [s.setSize];
+	s.means = new double [s.nCandidates];
+	s.peaks = new double [s.nCandidates];
+
+	if (!ReadDoubles (f, s.pts, s.setSize) || !ReadDoubles (f, s.diffs, s.setSize - 1) || !ReadDoubles (f, s.norm2s, s.setSize - 1))
+		return false;
+
+	if (fscanf (f, "%63s", word) != 1)
+		return false;
+
+	if (strcmp (word, "none") != 0) {
+
+		s.heights = new int [s.setSize];
+		s.heights [0] = atoi (word);
+
+		for (i=1; i<s.setSize; i++) {
+
+			if (fscanf (f, "%d", s.heights + i) != 1)
+				return false;
+		}
+	}
+
+	for (i=0; i<s.nCandidates; i++) {
+
+		if (fscanf (f, "%lf %lf", s.means + i, s.peaks + i) != 2)
+			return false;
+	}
+
+	return true;
+}
+
+
+static void AddRandomCandidates (RecordedSearch& s, int nExtra) {
+
+	// Spikes and pull-up:  random positions between the first and last candidates, random heights up to the maximum height
+
+	int n = s.nCandidates + nExtra;
+	double* means = new double [n];
+	double* peaks = new double [n];
+	double first = s.means [0];
+	double last = s.means [s.nCandidates - 1];
+	double mean;
+	int i;
+	int j;
+
+	for (i=0; i<s.nCandidates; i++) {
+
+		means [i] = s.means [i];
+		peaks [i] = s.peaks [i];
+	}
+
+	for (i=s.nCandidates; i<n; i++) {
+
+		mean = first + (last - first) * ((double)rand () + 0.5) / ((double)RAND_MAX + 1.0);
+		j = i;
+
+		while ((j > 0) && (means [j-1] > mean)) {
+
+			means [j] = means [j-1];
+			peaks [j] = peaks [j-1];
+			j--;
+		}
+
+		means [j] = mean;
+		peaks [j] = s.maxHeight * (0.1 + 0.9 * (double)rand () / (double)RAND_MAX);
+	}
+
+	delete[] s.means;
+	delete[] s.peaks;
+	s.means = means;
+	s.peaks = peaks;
+	s.nCandidates = n;
+	s.extraPts += nExtra;
+}
+
+
+int main (int argc, char** argv) {
+
+	int repetitions = 1;
+	int nExtra = 0;
+	unsigned seed = 1;
+	bool runTree = true;
+	int i;
+	int k;
+	int r;
+	int nSearches = 0;
+	int nMismatches = 0;
+	int nLimited = 0;
+	double treeSeconds = 0.0;
+	double searchSeconds = 0.0;
+	double maxTreeSeconds = 0.0;
+	double maxSearchSeconds = 0.0;
+	double seconds;
+	long totalNodes = 0;
+	long maxNodes = 0;
+	clock_t start;
+	char line [300];
+	int nLogs = 0;
+
+	for (i=1; i<argc; i++) {
+
+		if ((strcmp (argv [i], "-r") == 0) && (i + 1 < argc)) {
+
+			repetitions = atoi (argv [++i]);
+			continue;
+		}
+
+		if ((strcmp (argv [i], "-x") == 0) && (i + 1 < argc)) {
+
+			nExtra = atoi (argv [++i]);
+			continue;
+		}
+
+		if ((strcmp (argv [i], "-s") == 0) && (i + 1 < argc)) {
+
+			seed = (unsigned) atoi (argv [++i]);
+			continue;
+		}
+
+		if ((strcmp (argv [i], "-n") == 0) && (i + 1 < argc)) {
+
+			InnerProductSubsetSearch::SetNodeLimit (atol (argv [++i]));
+			continue;
+		}
+
+		if (strcmp (argv [i], "-o") == 0) {
+
+			runTree = false;
+			continue;
+		}
+
+		FILE* log = fopen (argv [i], "r");
+
+		if (log == NULL) {
+
+			cout << "Could not open search log " << argv [i] << endl;
+			continue;
+		}
+
+		nLogs++;
+		srand (seed);
+
+		while (true) {
+
+			RecordedSearch s;
+
+			if (!ReadSearch (log, s))
+				break;
+
+			if (nExtra > 0)
+				AddRandomCandidates (s, nExtra);
+
+			RGDList signals;
+			DataSignal* nextSignal;
+
+			for (k=0; k<s.nCandidates; k++) {
+
+				nextSignal = new Gaussian (s.means [k], 1.0);
+				nextSignal->SetPeak (s.peaks [k]);
+				signals.Append (nextSignal);
+			}
+
+			int* treeSelection = new int [s.nCandidates];
+			int* searchSelection = new int [s.nCandidates];
+			double treeCorrelation = 0.0;
+			double searchCorrelation = 0.0;
+			int treeStatus = 0;
+			int searchStatus = 0;
+
+			for (k=0; k<s.nCandidates; k++)
+				treeSelection [k] = searchSelection [k] = 0;
+
+			if (runTree) {
+
+				start = clock ();
+
+				for (r=0; r<repetitions; r++) {
+
+					RecursiveInnerProduct tree (signals, s.pts, s.diffs, s.heights, s.norm2s, s.setSize, s.maxHeight, s.discrepancy);
+					tree.SetSignalIntervalIsAccurate (s.accurate);
+					treeStatus = s.fromLeft ? tree.BuildFromLeft (s.ptsRemaining, s.extraPts, s.clim) : tree.BuildFromRight (s.ptsRemaining, s.extraPts, s.clim);
+
+					if ((treeStatus >= 0) && (r == repetitions - 1)) {
+
+						treeCorrelation = tree.GetCumulativeCorrelation ();
+						tree.GetBestSelection (treeSelection);
+					}
+				}
+
+				seconds = (double)(clock () - start) / CLOCKS_PER_SEC;
+				treeSeconds += seconds;
+
+				if (seconds > maxTreeSeconds)
+					maxTreeSeconds = seconds;
+			}
+
+			start = clock ();
+
+			for (r=0; r<repetitions; r++) {
+
+				InnerProductSubsetSearch search (s.means, s.peaks, s.nCandidates, s.pts, s.diffs, s.heights, s.norm2s, s.setSize, s.maxHeight, s.discrepancy);
+				search.SetSignalIntervalIsAccurate (s.accurate);
+				searchStatus = s.fromLeft ? search.BuildFromLeft (s.ptsRemaining, s.extraPts, s.clim) : search.BuildFromRight (s.ptsRemaining, s.extraPts, s.clim);
+
+				if ((searchStatus >= 0) && (r == repetitions - 1)) {
+
+					searchCorrelation = search.GetCumulativeCorrelation ();
+					search.GetBestSelection (searchSelection);
+					totalNodes += search.GetNumberOfNodes ();
+
+					if (search.GetNumberOfNodes () > maxNodes)
+						maxNodes = search.GetNumberOfNodes ();
+
+					if (search.ReachedNodeLimit ())
+						nLimited++;
+				}
+			}
+
+			seconds = (double)(clock () - start) / CLOCKS_PER_SEC;
+			searchSeconds += seconds;
+
+			if (seconds > maxSearchSeconds)
+				maxSearchSeconds = seconds;
+
+			if (runTree) {
+
+				bool same = (treeStatus == searchStatus) && (treeCorrelation == searchCorrelation);
+
+				for (k=0; k<s.nCandidates; k++) {
+
+					if (treeSelection [k] != searchSelection [k])
+						same = false;
+				}
+
+				if (!same) {
+
+					nMismatches++;
+					sprintf (line, "Search %d (%s, %d candidates, %d points):  tree correlation %.17g, search correlation %.17g", nSearches + 1,
+						s.fromLeft ? "left" : "right", s.nCandidates, s.ptsRemaining, treeCorrelation, searchCorrelation);
+					cout << line << endl;
+				}
+			}
+
+			nSearches++;
+			delete[] treeSelection;
+			delete[] searchSelection;
+			signals.ClearAndDelete ();
+		}
+
+		fclose (log);
+	}
+
+	if (nLogs == 0) {
+
+		cout << "Usage:  ILSSearchBenchmark [-r repetitions] [-x extraPeaks] [-s seed] [-n nodeLimit] [-o] searchLog ..." << endl;
+		return 1;
+	}
+
+	cout << "Searches:  " << nSearches << ", random candidates added to each:  " << nExtra << ", repetitions:  " << repetitions << endl;
+
+	if (runTree) {
+
+		sprintf (line, "tree         %10.4f s  (largest search %.4f s)", treeSeconds, maxTreeSeconds);
+		cout << line << endl;
+	}
+
+	sprintf (line, "search       %10.4f s  (largest search %.4f s)  %8.2f x", searchSeconds, maxSearchSeconds, (runTree && (searchSeconds > 0.0)) ? treeSeconds / searchSeconds : 0.0);
+	cout << line << endl;
+	cout << "Nodes visited:  " << totalNodes << " (largest search " << maxNodes << "), searches stopped at node limit:  " << nLimited << endl;
+
+	if (runTree)
+		cout << "Searches with different results:  " << nMismatches << endl;
+
+	return 0;
+}
@@ -67,21 +67,24 @@
 #include "TracePrequalification.h"
 #include "xmlwriter.h"
 #include "OsirisInputFile.h"
+#include "InnerProductSubsetSearch.h"
+#include "TestAnalysisDirectoryLC.h"
+#include "AnalysisDaemon.h"
+#include "AnalysisStatus.h"
+#include "AnalysisTiming.h"
 
 
 #include <string>
 #include <math.h>
 #include <list>
+#include <string.h>
 
 using namespace std;
 
 
 
-int _tmain(int argc, _TCHAR* argv[]) {
+int SetUpAnalysis (OsirisInputFile& inputFile, STRLCAnalysis*& analysis) {
 
-	// These are all input
-	int* testMemory = new int [4];
-	testMemory [0] = 1;
 	RGString PrototypeInputDirectory;
 	RGString LadderInformationDirectory;
 	RGString ParentDirectoryForReports;
@@ -94,67 +97,20 @@ int _tmain(int argc, _TCHAR* argv[]) {
 	double minInterlocusRFU = -1.0;
 	double minLadderInterlocusRFU = -1.0;
 	double sampleDetectionThreshold = -1.0;
-	int severity = 0;
-	int testRatio = 1;
 	RGString MessageBookPath;
-	RGString graphicsDirectory;
-//	CoreBioComponent::DontUseRawData ();
-	CoreBioComponent::SetOtherSignature ();
-	RGString RfuString;
-	RGString CommandLine;
-	RGString pResult;
-	
-	RGString token;
-	RGString LevelString;
-	RGString Comma (",");
-	RGStringArray tokens (3);
-	RGStringArray delims (3);
 	RGString UserLaneStandardName;
-	RGString rawDataString;
 
 	RGString stdSettingsFileName;
 	RGString labSettingsFileName;
-	RGString defaultStdSettingsFile ("../OsirisXML/OsirisSTRStandardSettings.xml");
-	RGString defaultLabSettingsFile ("../OsirisXML/GenericLabSettings.xml");
-	RGString ConfigDirectory;
-	CoreBioComponent::SetUseRawData ();
-
-	//
-	//	OsirisInputFile is always started with a debug value of "false", even for debug runs, because the debugger
-	//	is specified to stream the file BaseInputFile.txt to standard in.  Therefore, this program always looks for
-	//	its input on standard in, whether debugging or not
-	//
-
-	OsirisInputFile inputFile (false);
-
-	int inputStatus = inputFile.ReadAllInputs ("BaseInputFile.txt");
-//	inputFile.OutputAllData ();
-
-	if (inputStatus != 0) {
-
-		cout << "File input failed.  Terminating..." << endl;
-		return -1;
-	}
-
-	inputStatus = inputFile.AssembleInputs ();
-
-	if (inputStatus != 0) {
-
-		cout << "File input incomplete.  Terminating..." << endl;
-		return -1;
-	}
+	analysis = NULL;
 
-	cout << "File input succeeded.  Continuing..." << endl << endl;
-
-	inputFile.ResetInputLines ();
-	RGString* nextInputLine;
-
-	while (nextInputLine = inputFile.GetNextInputLine ())
-		CommandLine << "\t\t\t<argv>" << xmlwriter::EscAscii (*nextInputLine, &pResult) << "</argv>\n";
+//	CoreBioComponent::DontUseRawData ();
+	CoreBioComponent::SetOtherSignature ();
+	CoreBioComponent::SetUseRawData ();
 
 	PrototypeInputDirectory = inputFile.GetInputDirectory ();
-	ConfigDirectory = LadderInformationDirectory = inputFile.GetLadderDirectory ();
-	graphicsDirectory = ParentDirectoryForReports = inputFile.GetReportDirectory ();
+	LadderInformationDirectory = inputFile.GetLadderDirectory ();
+	ParentDirectoryForReports = inputFile.GetReportDirectory ();
 	OutputSubDirectory = inputFile.GetOutputSubDirectory ();
 	MarkerSetName = inputFile.GetMarkerSetName ();
 	UserLaneStandardName = inputFile.GetLaneStandardName ();
@@ -163,11 +119,6 @@ int _tmain(int argc, _TCHAR* argv[]) {
 	SmartMessage::SetSeverityTrigger (OutputLevel);
 	MessageBookPath = inputFile.GetFinalMessageBookName ();
 
-	STRLCAnalysis::SetOutputSubDirectory (OutputSubDirectory);
-
-	if (!inputFile.OverrideStringIsEmpty ())
-		STRLCAnalysis::SetOverrideString (inputFile.GetOverrideString ());
-
 	cout << "Input directory = " << PrototypeInputDirectory.GetData () << endl;
 	cout << "Ladder info directory = " << LadderInformationDirectory.GetData () << endl;
 	cout << "Report directory = " << ParentDirectoryForReports.GetData () << endl;
@@ -213,8 +164,6 @@ int _tmain(int argc, _TCHAR* argv[]) {
 		cout << "Don't use raw data..." << endl;
 	}
 
-	cout << "\nNumber of arguments = " << argc << endl << endl;
-
 	// It seems we are no longer using "TestRatio" and so no need to execute:  "Locus::SetTestRatio (testRatio);  // default = 1  (option = 0)"
 
 	double minPeak = minSampleRFU;
@@ -283,37 +232,85 @@ int _tmain(int argc, _TCHAR* argv[]) {
 	if (UserLaneStandardName.Length () > 0)
 		PopulationMarkerSet::SetUserLaneStandardName (UserLaneStandardName);
 
-	size_t startPosition = 0;
-	size_t endPosition;
-	PrototypeInputDirectory.FindLastSubstring ("/", startPosition, endPosition);
-	size_t nChars = PrototypeInputDirectory.Length () - endPosition - 1;
-	RGString OutputDirectoryBase = PrototypeInputDirectory.ExtractLastCharacters (nChars);
-
-	RGString FullPathForReports = ParentDirectoryForReports + "/" + OutputDirectoryBase;
-
-	RGString DirectoryName = PrototypeInputDirectory;
-	RGString CommandLineName = FullPathForReports + "/CommandLine.txt";
-
 	cout << "Maximum sample peak = " << STRSampleChannelData::GetMaxRFU () << endl;
 	bool isSmartMessageAnalysis = true;
 
-	STRLCAnalysis analysis (LadderInformationDirectory, MarkerSetName, ParentDirectoryForReports, fullPathMessageBookName, isSmartMessageAnalysis, true);
+	analysis = new STRLCAnalysis (LadderInformationDirectory, MarkerSetName, ParentDirectoryForReports, fullPathMessageBookName, isSmartMessageAnalysis, true);
+
+	if (!analysis->isValid ()) {
 
-	if (!analysis.isValid ())
+		delete analysis;
+		analysis = NULL;
 		return -5;
+	}
+
+	return 0;
+}
+
+
+int RunAnalysis (OsirisInputFile& inputFile, STRLCAnalysis& analysis) {
+
+	//  Inputs that do not affect the setup, so that a setup can be used for any input and report directories
+
+	RGString PrototypeInputDirectory = inputFile.GetInputDirectory ();
+	RGString graphicsDirectory = inputFile.GetReportDirectory ();
+	RGString CommandLine;
+	RGString pResult;
+
+	STRLCAnalysis::SetOutputSubDirectory (inputFile.GetOutputSubDirectory ());
+	STRLCAnalysis::SetNumberOfJobs (inputFile.GetNumberOfJobs ());
+	STRLCAnalysis::SetUseILSCache (inputFile.UseILSCache ());
+	STRLCAnalysis::SetReadAhead (inputFile.GetReadAhead ());
+	STRLCAnalysis::SetWriteBehind (inputFile.GetWriteBehind ());
 
+	if (inputFile.GetILSSearchNodeLimit () >= 0)
+		InnerProductSubsetSearch::SetNodeLimit (inputFile.GetILSSearchNodeLimit ());
+
+	if (inputFile.GetILSSearchLog ().Length () > 0)
+		InnerProductSubsetSearch::OpenSearchLog (inputFile.GetILSSearchLog ());
+
+	if (!inputFile.OverrideStringIsEmpty ())
+		STRLCAnalysis::SetOverrideString (inputFile.GetOverrideString ());
+
+	if (inputFile.GetStatusServer ().Length () > 0) {
+
+		if (AnalysisStatus::Connect (inputFile.GetStatusServer ()) < 0)
+			cout << "Could not connect to status server " << inputFile.GetStatusServer ().GetData () << ".  Continuing..." << endl;
+
+		else
+			AnalysisStatus::SetConsoleProgress (inputFile.UseConsoleProgress ());
+	}
+
+	if (inputFile.GetTiming () == "csv")
+		AnalysisTiming::SetFormat (TIMINGCSV);
+
+	else if (inputFile.GetTiming () == "json")
+		AnalysisTiming::SetFormat (TIMINGJSON);
+
+	AnalysisTiming::SetInOAR (inputFile.UseTimingInOAR ());
+
+	inputFile.ResetInputLines ();
+	RGString* nextInputLine;
+
+	while (nextInputLine = inputFile.GetNextInputLine ())
+		CommandLine << "\t\t\t<argv>" << xmlwriter::EscAscii (*nextInputLine, &pResult) << "</argv>\n";
+
+	analysis.SetParentDirectoryForReports (inputFile.GetReportDirectory ());
 	analysis.SetXMLCommandLineString (CommandLine);
 	int status = 0;
 
 	try {
 
-		status = analysis.AnalyzeIncrementallySM (PrototypeInputDirectory, MarkerSetName, OutputLevel, graphicsDirectory);
+		status = analysis.AnalyzeIncrementallySM (PrototypeInputDirectory, inputFile.GetMarkerSetName (), inputFile.GetCriticalOutputLevel (), graphicsDirectory);
 	}
 
 	catch (...) {
 		status = -1170;
 	}
 
+	AnalysisStatus::ReportAnalysisFinished (status);
+	AnalysisStatus::Disconnect ();
+
 	if (status < 0) {
 
 		cout << "Could not complete analysis...exiting with status:  " << status << endl;
@@ -322,10 +319,66 @@ int _tmain(int argc, _TCHAR* argv[]) {
 
 	cout << endl << "Analysis Complete" << endl;
 	return 0;
-
 }
 
 
+int _tmain(int argc, _TCHAR* argv[]) {
 
+	if ((argc > 2) && (strcmp (argv [1], "-daemon") == 0)) {
 
+		AnalysisDaemon daemon (argv [2]);
+		return daemon.Run ();
+	}
 
+	//
+	//	OsirisInputFile is always started with a debug value of "false", even for debug runs, because the debugger
+	//	is specified to stream the file BaseInputFile.txt to standard in.  Therefore, this program always looks for
+	//	its input on standard in, whether debugging or not
+	//
+
+	OsirisInputFile inputFile (false);
+
+	int inputStatus = inputFile.ReadAllInputs ("BaseInputFile.txt");
+//	inputFile.OutputAllData ();
+
+	if (inputStatus != 0) {
+
+		cout << "File input failed.  Terminating..." << endl;
+		return -1;
+	}
+
+	//  If an analysis daemon is named, it does the analysis with its cached setup, if it answers
+
+	RGString daemonSocketName = AnalysisDaemon::GetSocketName ();
+
+	if (daemonSocketName.Length () > 0) {
+
+		int jobStatus;
+
+		if (AnalysisDaemon::SubmitJob (daemonSocketName, inputFile, jobStatus) == 0)
+			return jobStatus;
+
+		cout << "Analysis daemon " << daemonSocketName.GetData () << " is not available.  Analyzing in this process..." << endl;
+	}
+
+	inputStatus = inputFile.AssembleInputs ();
+
+	if (inputStatus != 0) {
+
+		cout << "File input incomplete.  Terminating..." << endl;
+		return -1;
+	}
+
+	cout << "File input succeeded.  Continuing..." << endl << endl;
+
+	STRLCAnalysis* analysis;
+	int status = SetUpAnalysis (inputFile, analysis);
+
+	if (status < 0)
+		return status;
+
+	cout << "\nNumber of arguments = " << argc << endl << endl;
+	status = RunAnalysis (inputFile, *analysis);
+	delete analysis;	// closes and removes the working file
+	return status;
+}
@@ -0,0 +1,47 @@
+/*
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+*  FileName: TestAnalysisDirectoryLC.h
+*
+*/
+//
+//
+//  Analysis steps of TestAnalysisDirectoryLC, shared by the command line program and the analysis daemon.  SetUpAnalysis does
+//  all the work that depends only on the kit and settings (standard and lab settings, ladder information, message book), so
+//  its result can be reused for any number of runs.  RunAnalysis applies the per-run inputs and analyzes the input directory
+//
+
+#ifndef _TESTANALYSISDIRECTORYLC_H_
+#define _TESTANALYSISDIRECTORYLC_H_
+
+class OsirisInputFile;
+class STRLCAnalysis;
+
+int SetUpAnalysis (OsirisInputFile& inputFile, STRLCAnalysis*& analysis);	// inputFile must be assembled; analysis is NULL if status < 0
+int RunAnalysis (OsirisInputFile& inputFile, STRLCAnalysis& analysis);
+
+
+#endif  /*  _TESTANALYSISDIRECTORYLC_H_  */
+
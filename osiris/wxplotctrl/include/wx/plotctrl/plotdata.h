@@ -126,6 +126,13 @@ public:
     // are consecutive x points always > than the previous ones
     bool GetIsXOrdered() const;
 
+    // Get the (min, max) y value pairs of consecutive blocks of 2^level points,
+    //   block b covers the indexes [b*2^level, (b+1)*2^level), 1 <= level <= 30
+    //   the levels are built from each other on first use and kept until the
+    //   y data changes or CalcBoundingRect is called, a block of only non finite
+    //   values has min > max. Returns NULL on failure, the data is owned by the plotdata
+    const double *GetMinMaxLevel( int level, int *block_count ) const;
+
     //-------------------------------------------------------------------------
     // Load/Save, Filename, file header, saving options
     //-------------------------------------------------------------------------
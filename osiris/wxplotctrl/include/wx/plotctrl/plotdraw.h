@@ -221,6 +221,15 @@ public:
     virtual void Draw(wxDC *WXUNUSED(dc), bool WXUNUSED(refresh)) {} // unused
     virtual void Draw(wxDC *dc, wxPlotData* plotData, int curve_index);
 
+protected:
+    // Get the min/max level to draw the x ordered points n_start to n_end-1 from,
+    //   or 0 if there are too few points per pixel column and they're drawn one by one
+    int GetMinMaxLevel(wxPlotData* plotData, int n_start, int n_end) const;
+    // Draw the points n_start to n_end-1 as one vertical min/max line per pixel column
+    //   joined to the next column, using the wxPlotData::GetMinMaxLevel blocks
+    void DrawMinMax(wxDC *dc, wxPlotData* plotData, int level,
+                    int n_start, int n_end, const wxRect2DDouble& viewRect);
+
 private:
     DECLARE_ABSTRACT_CLASS(wxPlotDrawerDataCurve);
 };
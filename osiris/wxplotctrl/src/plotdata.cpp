@@ -36,6 +36,7 @@
 #include "wx/things/medsort.h"
 #include "wx/things/range.h"
 #include <math.h>
+#include <float.h>
 
 #define wxPLOTDATA_MAX_DATA_COLUMNS 64
 
@@ -66,6 +67,11 @@ public:
     void CopyData(const wxPlotDataRefData &source);
     void CopyExtra(const wxPlotDataRefData &source);
 
+    // discard the min/max pyramid, call whenever the y data changes
+    void DestroyMinMax();
+    // make sure levels 1..level of the min/max pyramid exist
+    bool CreateMinMax(int level);
+
     int     m_count;
 
     double *m_Xdata;
@@ -75,6 +81,11 @@ public:
 
     bool    m_Xordered;
 
+    // min/max pyramid of the y data, m_minmaxData[level-1] holds the
+    //   (min, max) pairs of the blocks of 2^level points, see GetMinMaxLevel
+    int      m_minmaxLevels;
+    double **m_minmaxData;
+
     wxBitmap m_normalSymbol,
              m_activeSymbol,
              m_selectedSymbol;
@@ -92,6 +103,9 @@ wxPlotDataRefData::wxPlotDataRefData() : wxPlotCurveRefData()
 
     m_Xordered = false;
 
+    m_minmaxLevels = 0;
+    m_minmaxData   = (double**)NULL;
+
     m_normalSymbol   = wxPlotSymbolNormal;
     m_activeSymbol   = wxPlotSymbolActive;
     m_selectedSymbol = wxPlotSymbolSelected;
@@ -100,6 +114,9 @@ wxPlotDataRefData::wxPlotDataRefData() : wxPlotCurveRefData()
 wxPlotDataRefData::wxPlotDataRefData(const wxPlotDataRefData& data)
                   :wxPlotCurveRefData()
 {
+    m_minmaxLevels = 0;
+    m_minmaxData   = (double**)NULL;
+
     CopyData(data);
     CopyExtra(data);
 }
@@ -123,6 +140,90 @@ void wxPlotDataRefData::Destroy()
     m_Ydata    = NULL;
     m_Yidata   = NULL;
     m_Xordered = false;
+
+    DestroyMinMax();
+}
+
+void wxPlotDataRefData::DestroyMinMax()
+{
+    if (m_minmaxData)
+    {
+        for (int level = 0; level < m_minmaxLevels; level++)
+            free( m_minmaxData[level] );
+
+        free( m_minmaxData );
+    }
+
+    m_minmaxLevels = 0;
+    m_minmaxData   = NULL;
+}
+
+// number of blocks of 2^level points needed to cover count points
+static inline int wxPlotMinMaxBlocks(int count, int level)
+{
+    return (count >> level) + ((count & ((1 << level) - 1)) ? 1 : 0);
+}
+
+bool wxPlotDataRefData::CreateMinMax(int level)
+{
+    if (level <= m_minmaxLevels)
+        return true;
+
+    if (!m_minmaxData)
+    {
+        // enough levels for any int count
+        m_minmaxData = (double**)calloc( 32, sizeof(double*) );
+        if (!m_minmaxData) return false;
+    }
+
+    for (int k = m_minmaxLevels + 1; k <= level; k++)
+    {
+        int blocks = wxPlotMinMaxBlocks(m_count, k);
+        double *dst = (double*)malloc( 2*blocks*sizeof(double) );
+        if (!dst) return false;
+
+        // each block starts empty (min > max), non finite values are skipped
+        //   like they are in CalcBoundingRect
+        if (k == 1)
+        {
+            const double *y_data = m_Ydata;
+            for (int b = 0; b < blocks; b++)
+            {
+                double y_min = DBL_MAX, y_max = -DBL_MAX;
+                int n_end = wxMin(2*b + 2, m_count);
+                for (int n = 2*b; n < n_end; n++)
+                {
+                    double y = y_data[n];
+                    if (wxFinite(y) == 0) continue;
+                    if (y < y_min) y_min = y;
+                    if (y > y_max) y_max = y;
+                }
+                dst[2*b]   = y_min;
+                dst[2*b+1] = y_max;
+            }
+        }
+        else
+        {
+            const double *src = m_minmaxData[k-2];
+            int src_blocks = wxPlotMinMaxBlocks(m_count, k-1);
+            for (int b = 0; b < blocks; b++)
+            {
+                double y_min = src[4*b], y_max = src[4*b+1];
+                if (2*b + 1 < src_blocks)
+                {
+                    if (src[4*b+2] < y_min) y_min = src[4*b+2];
+                    if (src[4*b+3] > y_max) y_max = src[4*b+3];
+                }
+                dst[2*b]   = y_min;
+                dst[2*b+1] = y_max;
+            }
+        }
+
+        m_minmaxData[k-1] = dst;
+        m_minmaxLevels = k;
+    }
+
+    return true;
 }
 
 void wxPlotDataRefData::CopyData(const wxPlotDataRefData &source)
@@ -530,6 +631,7 @@ void wxPlotData::CalcBoundingRect()
     wxCHECK_RET( Ok(), wxT("Invalid wxPlotData") );
 
     M_PLOTDATA->m_boundingRect = wxNullPlotBounds;
+    M_PLOTDATA->DestroyMinMax();
 
     double *x_data = M_PLOTDATA->m_Xdata,
            *y_data = M_PLOTDATA->m_Ydata;
@@ -585,6 +687,24 @@ bool wxPlotData::GetIsXOrdered() const
     return M_PLOTDATA->m_Xordered;
 }
 
+const double *wxPlotData::GetMinMaxLevel( int level, int *block_count ) const
+{
+    if (block_count) *block_count = 0;
+    wxCHECK_MSG( Ok(), NULL, wxT("Invalid wxPlotData") );
+    wxPCHECK_MINMAX_MSG(level, 1, 30, NULL, wxT("Invalid min/max level"));
+
+    if (!M_PLOTDATA->CreateMinMax(level))
+    {
+        M_PLOTDATA->DestroyMinMax();
+        return NULL;
+    }
+
+    if (block_count)
+        *block_count = wxPlotMinMaxBlocks(M_PLOTDATA->m_count, level);
+
+    return M_PLOTDATA->m_minmaxData[level-1];
+}
+
 //----------------------------------------------------------------------------
 // Load/Save Get/Set Filename, Header
 //----------------------------------------------------------------------------
@@ -1129,6 +1249,7 @@ void wxPlotData::SetYValue( int index, double y )
     }
 
     M_PLOTDATA->m_Ydata[index] = y;
+    M_PLOTDATA->DestroyMinMax();
 }
 
 void wxPlotData::SetValue(int index, double x, double y)
@@ -1140,6 +1261,7 @@ void wxPlotData::SetValue(int index, double x, double y)
 
     M_PLOTDATA->m_Xdata[index] = x;
     M_PLOTDATA->m_Ydata[index] = y;
+    M_PLOTDATA->DestroyMinMax();
 
     if (M_PLOTDATA->m_count == 1)
     {
@@ -1191,6 +1313,8 @@ void wxPlotData::SetYValues( int start_index, int count, double y )
     double *y_data = M_PLOTDATA->m_Ydata;
     for (int n = start_index; n <= end_index; n++)
         *y_data++ = y;
+
+    M_PLOTDATA->DestroyMinMax();
 }
 
 void wxPlotData::SetXStepValues( int start_index, int count, double x_start, double dx )
@@ -1218,6 +1342,8 @@ void wxPlotData::SetYStepValues( int start_index, int count, double y_start, dou
     double *y_data = M_PLOTDATA->m_Ydata + start_index;
     for (int i = 0; i < count; i++, y_data++)
         *y_data = y_start + (i * dy);
+
+    M_PLOTDATA->DestroyMinMax();
 }
 
 int wxPlotData::GetIndexFromX( double x, wxPlotData::Index_Type type ) const
@@ -879,6 +879,21 @@ void wxPlotDrawerDataCurve::Draw(wxDC *dc, wxPlotData* curve, int curve_index)
     bool draw_symbols = m_owner->GetDrawSymbols();
     bool draw_spline  = m_owner->GetDrawSpline();
 
+    // zoomed out there are many points per pixel column, draw them as min/max
+    //   lines so the cost depends on the width of the window, not the number of
+    //   points. Symbols, splines and selections need every point.
+    if (x_ordered && draw_lines && !draw_symbols && !draw_spline &&
+        ((min_sel < 0) || (min_sel >= n_end)))
+    {
+        int level = GetMinMaxLevel(curve, n_start, n_end);
+        if (level > 0)
+        {
+            DrawMinMax(dc, curve, level, n_start, n_end, viewRect);
+            dc->SetPen(wxNullPen);
+            return;
+        }
+    }
+
     SplineDrawer sd;
     wxRangeDoubleSelection dblRangeSel;
 
@@ -979,6 +994,129 @@ void wxPlotDrawerDataCurve::Draw(wxDC *dc, wxPlotData* curve, int curve_index)
     dc->SetPen(wxNullPen);
 }
 
+// use the min/max pyramid when there are at least this many points per pixel
+//   column, the level is picked so there are about 2 blocks per column
+#define wxPLOTDRAW_MINMAX_POINTS_PER_COLUMN 4
+
+int wxPlotDrawerDataCurve::GetMinMaxLevel(wxPlotData* curve, int n_start, int n_end) const
+{
+    if (n_end - n_start < 2*wxPLOTDRAW_MINMAX_POINTS_PER_COLUMN)
+        return 0;
+
+    wxRect dcRect(GetDCRect());
+    const double *x_data = curve->GetXData();
+    int i_start = m_owner->GetClientCoordFromPlotX(x_data[n_start]);
+    int i_end   = m_owner->GetClientCoordFromPlotX(x_data[n_end-1]);
+    i_start = wxMax(i_start, dcRect.x);
+    i_end   = wxMin(i_end, dcRect.GetRight());
+
+    double columns = (i_end > i_start) ? (i_end - i_start + 1) : 1;
+    double points_per_column = (n_end - n_start)/columns;
+    if (points_per_column < wxPLOTDRAW_MINMAX_POINTS_PER_COLUMN)
+        return 0;
+
+    // largest level with at least 2 blocks per column
+    int level = 1;
+    while ((level < 30) && (points_per_column >= double(4 << level)))
+        level++;
+
+    return level;
+}
+
+void wxPlotDrawerDataCurve::DrawMinMax(wxDC *dc, wxPlotData* curve, int level,
+                                       int n_start, int n_end,
+                                       const wxRect2DDouble& viewRect)
+{
+    INITIALIZE_FAST_GRAPHICS
+
+    int block_count = 0;
+    const double *minmax = curve->GetMinMaxLevel(level, &block_count);
+    if (!minmax) return;
+
+    const double *x_data = curve->GetXData();
+    const double *y_data = curve->GetYData();
+    const int count = curve->GetCount();
+
+    const int b_start = n_start >> level;
+    const int b_end   = wxMin(((n_end - 1) >> level) + 1, block_count);
+
+    int i0, j0, i1, j1;            // curve coords in pixels
+    double xx0, yy0, xx1, yy1;     // clipped curve coords
+
+    // the pixel column being collected, its x, y range and first and last y
+    int col = 0;
+    double col_x = 0, col_min = 0, col_max = 0, col_first = 0, col_last = 0;
+    // the last y of the previous column to join to this one
+    double last_x = 0, last_y = 0;
+    bool have_col = false, have_last = false;
+
+    for (int b = b_start; b <= b_end; b++)
+    {
+        int n = b << level, n_last = 0, i = 0;
+
+        if (b < b_end)
+        {
+            n_last = wxMin(n + (1 << level), count) - 1;
+            i = m_owner->GetClientCoordFromPlotX(x_data[n]);
+
+            if (have_col && (i == col))
+            {
+                if (minmax[2*b]   < col_min) col_min = minmax[2*b];
+                if (minmax[2*b+1] > col_max) col_max = minmax[2*b+1];
+                col_last = y_data[n_last];
+                continue;
+            }
+        }
+
+        if (have_col) // draw the finished column
+        {
+            if (have_last)
+            {
+                xx0 = last_x; yy0 = last_y; xx1 = col_x; yy1 = col_first;
+                if (ClipLineToRect(xx0, yy0, xx1, yy1, viewRect) != ClippedOut)
+                {
+                    i0 = m_owner->GetClientCoordFromPlotX(xx0);
+                    j0 = m_owner->GetClientCoordFromPlotY(yy0);
+                    i1 = m_owner->GetClientCoordFromPlotX(xx1);
+                    j1 = m_owner->GetClientCoordFromPlotY(yy1);
+                    if ((i0 != i1) || (j0 != j1))
+                    {
+                        wxPLOTCTRL_DRAW_LINE(dc, window, pen, i0, j0, i1, j1);
+                    }
+                }
+            }
+
+            if (col_min <= col_max)
+            {
+                xx0 = xx1 = col_x; yy0 = col_min; yy1 = col_max;
+                if (ClipLineToRect(xx0, yy0, xx1, yy1, viewRect) != ClippedOut)
+                {
+                    i0 = m_owner->GetClientCoordFromPlotX(xx0);
+                    j0 = m_owner->GetClientCoordFromPlotY(yy0);
+                    j1 = m_owner->GetClientCoordFromPlotY(yy1);
+                    // the end point isn't drawn, go one past so a flat column shows
+                    wxPLOTCTRL_DRAW_LINE(dc, window, pen, i0, j0, i0, j1 - 1);
+                }
+            }
+
+            last_x = col_x;
+            last_y = col_last;
+            have_last = true;
+        }
+
+        if (b == b_end) break;
+
+        // start a new column
+        col       = i;
+        col_x     = x_data[n];
+        col_min   = minmax[2*b];
+        col_max   = minmax[2*b+1];
+        col_first = y_data[n];
+        col_last  = y_data[n_last];
+        have_col  = true;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // wxPlotDrawerMarkers
 //-----------------------------------------------------------------------------